@@ -78,6 +78,23 @@
 #define LV_COLOR_PREMULT      lv_color_premult
 #define LV_COLOR_MIX_PREMULT      lv_color_mix_premult
 
+/*====================
+   OPERATING SYSTEM
+ *====================*/
+
+/*Select an operating system to use. Possible options:
+ * - LV_OS_NONE
+ * - LV_OS_PTHREAD
+ *With an operating system slow jobs (e.g. decoding images) can run in worker threads.*/
+#define LV_USE_OS   LV_OS_NONE
+#if LV_USE_OS != LV_OS_NONE
+    /*Number of threads running the background jobs (see `lv_worker.h`)*/
+    #define LV_WORKER_THREAD_CNT 1
+
+    /*Stack size of the worker threads [bytes]*/
+    #define LV_WORKER_STACK_SIZE (32 * 1024)
+#endif
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -317,6 +334,39 @@
  *0: to disable caching*/
 #define LV_IMG_CACHE_DEF_SIZE 0
 
+/*Limit the memory used by the decoded images in the image cache [bytes].
+ *The least recently used images are closed if a new image doesn't fit.
+ *0: no limit, only the number of images is limited by LV_IMG_CACHE_DEF_SIZE*/
+#define LV_IMG_CACHE_DEF_MEM_SIZE 0
+
+/*1: Decode the images which are not cached yet in a worker thread by default.
+ *Nothing is drawn in place of them until they are decoded, but the frames are not blocked by slow decoders.
+ *Requires LV_USE_OS and LV_IMG_CACHE_DEF_SIZE > 0. Can be changed by `lv_img_cache_set_async()`*/
+#define LV_IMG_CACHE_ASYNC 0
+
+/*1: Create downscaled versions (mipmaps) of the images drawn with `zoom <= 128` and draw the best fitting one.
+ *It's faster and nicer with large zoomed out images (e.g. thumbnails) but uses at most 1/3 more memory per image.
+ *The mipmaps are freed when the image is closed, so use it with the image cache. They count in its memory limit.
+ *Only LV_COLOR_FORMAT_NATIVE and LV_COLOR_FORMAT_NATIVE_ALPHA images are supported.*/
+#define LV_USE_IMG_MIPMAP 0
+
+/*Keep the rotated/zoomed images, so that redrawing them with the same transformation is only a copy.
+ *The transformed images are stored with alpha channel. Set the memory limit in bytes (0: disable caching).
+ *Only LV_COLOR_FORMAT_NATIVE(_ALPHA/_CHROMA_KEYED) images are cached.*/
+#define LV_USE_IMG_TRANSFORM_CACHE 0
+#if LV_USE_IMG_TRANSFORM_CACHE
+    #define LV_IMG_TRANSFORM_CACHE_DEF_MEM_SIZE (256 * 1024)
+#endif
+
+/*Draw the images which can't be decoded at once (e.g. huge images) by decoding only the visible tiles.
+ *The recently used tiles are kept in the memory, limited to LV_IMG_TILE_CACHE_DEF_MEM_SIZE bytes.
+ *Decoders can read the tiles with `read_tile_cb` or with `read_line_cb` line by line.*/
+#define LV_USE_IMG_TILE_CACHE 0
+#if LV_USE_IMG_TILE_CACHE
+    #define LV_IMG_TILE_SIZE 64
+    #define LV_IMG_TILE_CACHE_DEF_MEM_SIZE (256 * 1024)
+#endif
+
 
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
@@ -423,6 +473,13 @@
 /*Enable drawing placeholders when glyph dsc is not found*/
 #define LV_USE_FONT_PLACEHOLDER 1
 
+/*Number of letters whose font is remembered when searching the `fallback` fonts. 0: disable*/
+#define LV_FONT_FALLBACK_CACHE_SIZE 0
+
+/*Enable fonts with signed distance field glyphs which can be drawn in any size.
+ *See lv_font_sdf.h and scripts/sdf_font_conv.py*/
+#define LV_USE_FONT_SDF 0
+
 /*=================
  *  TEXT SETTINGS
  *=================*/
@@ -463,6 +520,10 @@
     *`LV_BASE_DIR_RTL` Right-to-Left
     *`LV_BASE_DIR_AUTO` detect texts base direction*/
     #define LV_BIDI_BASE_DIR_DEF LV_BASE_DIR_AUTO
+
+    /*Number of processed lines to remember. Drawing, measuring and the cursor handling
+     *of the same line reuse the result instead of running the algorithm again. 0: disable*/
+    #define LV_BIDI_CACHE_SIZE 0
 #endif
 
 /*Enable Arabic/Persian processing
@@ -602,6 +663,14 @@
 
 /*File system interfaces for common APIs */
 
+/*Keep the recently read blocks of the files in a cache shared by all opened files and drivers*/
+#define LV_USE_FS_CACHE 0
+#if LV_USE_FS_CACHE
+    #define LV_FS_CACHE_BLOCK_SIZE 4096             /*Size of a cached block in bytes*/
+    #define LV_FS_CACHE_DEF_MEM_SIZE (64 * 1024)    /*Default memory size of the cache in bytes. Can be changed with `lv_fs_cache_set_mem_size()`*/
+    #define LV_FS_CACHE_READ_AHEAD 2                /*Read this number of extra blocks if a file is read sequentially*/
+#endif
+
 /*API for fopen, fread, etc*/
 #define LV_USE_FS_STDIO 0
 #if LV_USE_FS_STDIO
@@ -635,6 +704,12 @@
 
 /*PNG decoder library*/
 #define LV_USE_PNG 0
+#if LV_USE_PNG
+    /*1: Don't decode the whole image but read the rows on demand while drawing.
+     *   Uses only ~40 kB RAM regardless of the image size but redrawing is slower.
+     *0: Decode the whole image at once (falls back to reading the rows if there is not enough memory)*/
+    #define LV_PNG_USE_READ_LINE 0
+#endif
 
 /*BMP decoder library*/
 #define LV_USE_BMP 0
@@ -642,9 +717,23 @@
 /* JPG + split JPG decoder library.
  * Split JPG is a custom format optimized for embedded systems. */
 #define LV_USE_SJPG 0
+#if LV_USE_SJPG
+    /*Number of decoded fragments to keep per image. Each needs `image width x fragment height x 3` bytes.
+     *More fragments make scrolling back and forth faster.*/
+    #define LV_SJPG_FRAG_CACHE_CNT 1
+
+    /*Decode this many fragments ahead of the drawn one in worker threads (requires LV_USE_OS).
+     *Should be less than LV_SJPG_FRAG_CACHE_CNT. 0: disable*/
+    #define LV_SJPG_PREFETCH_CNT 0
+#endif
 
 /*GIF decoder library*/
 #define LV_USE_GIF 0
+#if LV_USE_GIF
+    /*Decode the next frame in a worker thread while the current one is shown (requires LV_USE_OS).
+     *Needs an other `width x height x pixel size` buffer per GIF. Can be changed with `lv_gif_set_async()`*/
+    #define LV_GIF_ASYNC 0
+#endif
 
 /*QR code library*/
 #define LV_USE_QRCODE 0
@@ -688,6 +777,10 @@
 #if LV_USE_FFMPEG
     /*Dump input information to stderr*/
     #define LV_FFMPEG_DUMP_FORMAT 0
+
+    /*Decode the video in a separate thread (requires LV_USE_OS) and queue this many converted frames.
+     *Each needs `width x height x pixel size` bytes. 0: decode in the LVGL thread*/
+    #define LV_FFMPEG_FRAME_QUEUE_CNT 2
 #endif
 
 /*==================
@@ -26,11 +26,15 @@ extern "C" {
 #include "src/misc/lv_math.h"
 #include "src/misc/lv_mem.h"
 #include "src/misc/lv_async.h"
+#include "src/misc/lv_worker.h"
+#include "src/misc/lv_fs_cache.h"
 #include "src/misc/lv_anim_timeline.h"
 #include "src/misc/lv_printf.h"
 
 #include "src/hal/lv_hal.h"
 
+#include "src/osal/lv_os.h"
+
 #include "src/core/lv_obj.h"
 #include "src/core/lv_group.h"
 #include "src/core/lv_indev.h"
@@ -40,6 +44,7 @@ extern "C" {
 
 #include "src/font/lv_font.h"
 #include "src/font/lv_font_loader.h"
+#include "src/font/lv_font_sdf.h"
 #include "src/font/lv_font_fmt_txt.h"
 
 #include "src/widgets/animimg/lv_animimg.h"
@@ -0,0 +1,212 @@
+#!/usr/bin/env python3
+##################################################################
+# Compress LVGL images with the RLE format of the built-in image decoder
+#
+# The input can be a "*.bin" image created by the image converter or
+# any image which can be opened by Pillow (PNG, JPG, etc.). In the latter
+# case the color format needs to be set with --cf.
+#
+# Creates a compressed "*.bin" file and/or a C array.
+# Dependencies: Python 3, Pillow (only for not "*.bin" inputs)
+##################################################################
+import argparse
+import os
+import struct
+import sys
+
+# Values of lv_color_format_t which can be compressed and their pixel size in bytes
+COLOR_FORMATS = {
+    "L8": (1, 1),
+    "A8": (2, 1),
+    "A8L8": (7, 2),
+    "ARGB2222": (8, 1),
+    "RGB565": (9, 2),
+    "ARGB1555": (11, 2),
+    "ARGB4444": (12, 2),
+    "ARGB8565": (14, 3),
+    "ARGB8888": (17, 4),
+    "XRGB8888": (18, 4),
+}
+
+# The 4 bytes of lv_img_header_t: cf: 5, always_zero: 3, compressed: 1, reserved: 1, w: 11, h: 11
+HEADER_SIZE = 4
+HEADER_COMPRESSED_BIT = 8
+HEADER_W_SHIFT = 10
+HEADER_H_SHIFT = 21
+MAX_PACKET_LEN = 128
+MAX_SIZE = 2047
+
+
+def cf_by_value(value):
+    for name, (v, px_size) in COLOR_FORMATS.items():
+        if v == value:
+            return name, px_size
+    return None, 0
+
+
+def read_bin(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if len(data) < HEADER_SIZE:
+        sys.exit("The file is too short: " + path)
+
+    header = struct.unpack("<I", data[:HEADER_SIZE])[0]
+    if header & (1 << HEADER_COMPRESSED_BIT):
+        sys.exit("The image is already compressed: " + path)
+
+    cf, px_size = cf_by_value(header & 0x1F)
+    if cf is None:
+        sys.exit("The color format of the image can't be compressed: " + str(header & 0x1F))
+
+    w = (header >> HEADER_W_SHIFT) & 0x7FF
+    h = (header >> HEADER_H_SHIFT) & 0x7FF
+    pixels = data[HEADER_SIZE:HEADER_SIZE + w * h * px_size]
+    if len(pixels) != w * h * px_size:
+        sys.exit("The file is shorter than expected: " + path)
+
+    return cf, w, h, pixels
+
+
+def convert_image(path, cf):
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit("Pillow is required to convert " + path)
+
+    im = Image.open(path).convert("RGBA")
+    w, h = im.size
+    out = bytearray()
+    for r, g, b, a in im.getdata():
+        if cf == "ARGB8888":
+            out += bytes((b, g, r, a))
+        elif cf == "XRGB8888":
+            out += bytes((b, g, r, 0xFF))
+        elif cf == "RGB565":
+            out += struct.pack("<H", ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3))
+        elif cf == "ARGB8565":
+            out += struct.pack("<HB", ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3), a)
+        elif cf == "A8":
+            out.append(a)
+        elif cf == "L8":
+            out.append((r * 299 + g * 587 + b * 114) // 1000)
+        else:
+            sys.exit("Converting to " + cf + " is not supported, use a \"*.bin\" input")
+
+    return w, h, bytes(out)
+
+
+def compress_row(row, px_size):
+    """Split the row to packets of repeated pixels and not compressed pixels"""
+    px = [row[i:i + px_size] for i in range(0, len(row), px_size)]
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_PACKET_LEN]
+            del literal[:MAX_PACKET_LEN]
+            out.append(len(chunk) - 1)
+            for p in chunk:
+                out.extend(p)
+
+    i = 0
+    while i < len(px):
+        run = 1
+        while i + run < len(px) and run < MAX_PACKET_LEN and px[i + run] == px[i]:
+            run += 1
+
+        # A run of 2 pixels is not shorter than adding them to a literal packet
+        if run > 2:
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            out.extend(px[i])
+            i += run
+        else:
+            literal.append(px[i])
+            i += 1
+
+    flush_literal()
+    return bytes(out)
+
+
+def compress(w, h, px_size, pixels):
+    stride = w * px_size
+    rows = [compress_row(pixels[y * stride:(y + 1) * stride], px_size) for y in range(h)]
+
+    # The offsets are counted from the beginning of the offset table
+    ofs = (h + 1) * 4
+    table = bytearray()
+    for row in rows:
+        table += struct.pack("<I", ofs)
+        ofs += len(row)
+    table += struct.pack("<I", ofs)
+
+    return bytes(table) + b"".join(rows)
+
+
+def c_array(name, cf, w, h, data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+
+    return """#include "lvgl/lvgl.h"
+
+/*RLE compressed image, created by img_compress.py*/
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t {name}_map[] = {{
+{data}
+}};
+
+const lv_img_dsc_t {name} = {{
+    .header.cf = LV_COLOR_FORMAT_{cf},
+    .header.compressed = 1,
+    .header.always_zero = 0,
+    .header.w = {w},
+    .header.h = {h},
+    .data_size = {size},
+    .data = {name}_map,
+}};
+""".format(name=name, cf=cf, w=w, h=h, size=len(data), data="\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compress LVGL images with RLE")
+    parser.add_argument("input", help="a \"*.bin\" LVGL image or an image file readable by Pillow")
+    parser.add_argument("--cf", choices=sorted(COLOR_FORMATS.keys()),
+                        help="color format for not \"*.bin\" inputs")
+    parser.add_argument("--bin", help="write the compressed image to this \"*.bin\" file")
+    parser.add_argument("--c", help="write the compressed image as a C array to this file")
+    parser.add_argument("--name", help="name of the C variable (default: the input's name)")
+    args = parser.parse_args()
+
+    if args.input.endswith(".bin"):
+        cf, w, h, pixels = read_bin(args.input)
+    else:
+        if args.cf is None:
+            sys.exit("--cf is required for not \"*.bin\" inputs")
+        cf = args.cf
+        w, h, pixels = convert_image(args.input, cf)
+
+    if w > MAX_SIZE or h > MAX_SIZE:
+        sys.exit("The image is too large")
+
+    name = args.name or os.path.splitext(os.path.basename(args.input))[0]
+    data = compress(w, h, COLOR_FORMATS[cf][1], pixels)
+    print("%s: %dx%d %s, %d -> %d bytes" % (args.input, w, h, cf, len(pixels), len(data)))
+
+    if args.bin is None and args.c is None:
+        args.c = name + ".c"
+
+    if args.bin:
+        header = COLOR_FORMATS[cf][0] | (1 << HEADER_COMPRESSED_BIT) | (w << HEADER_W_SHIFT) | (h << HEADER_H_SHIFT)
+        with open(args.bin, "wb") as f:
+            f.write(struct.pack("<I", header))
+            f.write(data)
+
+    if args.c:
+        with open(args.c, "w") as f:
+            f.write(c_array(name, cf, w, h, data))
+
+
+if __name__ == "__main__":
+    main()
@@ -32,6 +32,9 @@ fout.write(
 
 #include <stdint.h>
 
+#define LV_OS_NONE      0
+#define LV_OS_PTHREAD   1
+
 /* Handle special Kconfig options */
 #ifndef LV_KCONFIG_IGNORE
     #include "lv_conf_kconfig.h"
@@ -0,0 +1,276 @@
+#!/usr/bin/env python3
+
+"""
+Convert a TTF/OTF font to an LVGL font with signed distance field glyphs (see lv_font_sdf.h)
+The glyphs are rendered with a large size, their distance field is calculated
+and sampled at the font size given by --size.
+Dependencies: Python 3, Pillow with FreeType support
+Example: python sdf_font_conv.py --font Montserrat-Medium.ttf --size 32 -r 0x20-0x7E --name lv_font_montserrat_sdf -o lv_font_montserrat_sdf.c
+"""
+
+import argparse
+import math
+from PIL import Image, ImageDraw, ImageFont
+
+UPSCALE = 8     # Render the glyphs this many times larger to calculate the distances
+INF = 1e20
+
+parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawTextHelpFormatter)
+parser.add_argument('--font', metavar='file', required=True, help='A TTF or OTF file')
+parser.add_argument('-s', '--size', type=int, metavar='px', default=32,
+                    help='Size of the distance fields in px. Default is 32')
+parser.add_argument('--spread', type=int, metavar='px', default=4,
+                    help='Distance from the edges (in px at --size) stored in the distance fields. Default is 4')
+parser.add_argument('-r', '--range', nargs='+', metavar='start-end', default=['0x20-0x7E'],
+                    help='Ranges and/or characters to include. Default is 0x20-0x7E (ASCII). E.g. -r 0x20-0x7F,0xB0')
+parser.add_argument('--symbols', default='', help='Symbols to include. E.g. --symbols ÁÉŐ')
+parser.add_argument('--name', required=True, help='Name of the font. E.g. lv_font_montserrat_sdf')
+parser.add_argument('-o', '--output', metavar='file', required=True, help='Output file name')
+args = parser.parse_args()
+
+
+def parse_letters():
+    letters = set()
+    for r in ','.join(args.range).split(','):
+        r = r.strip()
+        if not r:
+            continue
+        if '-' in r:
+            start, end = r.split('-')
+            letters.update(range(int(start, 0), int(end, 0) + 1))
+        else:
+            letters.add(int(r, 0))
+    letters.update(ord(c) for c in args.symbols)
+    return sorted(letters)
+
+
+def edt_1d(f):
+    """Squared Euclidean distance transform of a row (Felzenszwalb & Huttenlocher)"""
+    n = len(f)
+    d = [0.0] * n
+    v = [0] * n
+    z = [0.0] * (n + 1)
+    k = 0
+    z[0] = -INF
+    z[1] = INF
+    for q in range(1, n):
+        s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * q - 2 * v[k])
+        while s <= z[k]:
+            k -= 1
+            s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * q - 2 * v[k])
+        k += 1
+        v[k] = q
+        z[k] = s
+        z[k + 1] = INF
+    k = 0
+    for q in range(n):
+        while z[k + 1] < q:
+            k += 1
+        d[q] = (q - v[k]) * (q - v[k]) + f[v[k]]
+    return d
+
+
+def edt(inside, w, h):
+    """Distance of every pixel to the nearest pixel where `inside` is True"""
+    grid = [0.0 if i else INF for i in inside]
+    for y in range(h):
+        grid[y * w:(y + 1) * w] = edt_1d(grid[y * w:(y + 1) * w])
+    for x in range(w):
+        col = edt_1d(grid[x::w])
+        for y in range(h):
+            grid[y * w + x] = col[y]
+    return [math.sqrt(g) for g in grid]
+
+
+def glyph_convert(font_hi, letter):
+    s = args.spread
+    ch = chr(letter)
+    adv_w = round(font_hi.getlength(ch) / UPSCALE * 16)
+    bbox = font_hi.getbbox(ch, anchor='ls')
+    if bbox[2] <= bbox[0] or bbox[3] <= bbox[1]:
+        return {'adv_w': adv_w, 'box_w': 0, 'box_h': 0, 'ofs_x': 0, 'ofs_y': 0, 'bitmap': [], 'top': 0, 'bottom': 0}
+
+    # The box of the distance field in px at --size, aligned to the pixel grid
+    x1 = math.floor(bbox[0] / UPSCALE) - s
+    x2 = math.ceil(bbox[2] / UPSCALE) + s
+    y1 = math.floor(bbox[1] / UPSCALE) - s      # Top, negative above the base line
+    y2 = math.ceil(bbox[3] / UPSCALE) + s
+    w = x2 - x1
+    h = y2 - y1
+
+    img = Image.new('L', (w * UPSCALE, h * UPSCALE), 0)
+    ImageDraw.Draw(img).text((-x1 * UPSCALE, -y1 * UPSCALE), ch, font=font_hi, fill=255, anchor='ls')
+    px = img.tobytes()
+    w_hi = w * UPSCALE
+    h_hi = h * UPSCALE
+    dist_out = edt([p >= 128 for p in px], w_hi, h_hi)
+    dist_in = edt([p < 128 for p in px], w_hi, h_hi)
+
+    bitmap = []
+    for y in range(h):
+        for x in range(w):
+            # Average the 2x2 hi-res pixels around the center of the pixel
+            d = 0
+            for yh in (y * UPSCALE + UPSCALE // 2 - 1, y * UPSCALE + UPSCALE // 2):
+                for xh in (x * UPSCALE + UPSCALE // 2 - 1, x * UPSCALE + UPSCALE // 2):
+                    i = yh * w_hi + xh
+                    d += (dist_in[i] - 0.5) if dist_out[i] == 0 else -(dist_out[i] - 0.5)
+            d = d / 4 / UPSCALE
+            bitmap.append(max(0, min(255, round(128 + d * 127 / s))))
+
+    # The extents of the glyph without the spread for the line height
+    top = math.ceil(-bbox[1] / UPSCALE)
+    bottom = math.floor(-bbox[3] / UPSCALE)
+    return {'adv_w': adv_w, 'box_w': w, 'box_h': h, 'ofs_x': x1, 'ofs_y': -y2, 'bitmap': bitmap,
+            'top': top, 'bottom': bottom}
+
+
+def cmaps_get(letters):
+    """Group the letters into continuous ranges"""
+    cmaps = []
+    glyph_id = 1
+    for letter in letters:
+        if cmaps and cmaps[-1]['start'] + cmaps[-1]['length'] == letter:
+            cmaps[-1]['length'] += 1
+        else:
+            cmaps.append({'start': letter, 'length': 1, 'glyph_id': glyph_id})
+        glyph_id += 1
+    return cmaps
+
+
+def char_comment(letter):
+    ch = chr(letter)
+    if ch in '\\"' or not ch.isprintable():
+        return 'U+%04X' % letter
+    return 'U+%04X "%s"' % (letter, ch)
+
+
+def main():
+    letters = parse_letters()
+    font_hi = ImageFont.truetype(args.font, args.size * UPSCALE)
+
+    glyphs = [glyph_convert(font_hi, letter) for letter in letters]
+
+    # Like lv_font_conv, the line height is set by the highest and lowest glyphs
+    ascent = max(g['top'] for g in glyphs)
+    descent = -min(g['bottom'] for g in glyphs)
+    underline = max(1, round(args.size / 16))
+
+    out = []
+    out.append('/*******************************************************************************')
+    out.append(' * Size: %d px' % args.size)
+    out.append(' * Bpp: 8, signed distance field, spread: %d px' % args.spread)
+    out.append(' * Opts: --font %s --size %d --spread %d -r %s --name %s' %
+               (args.font.split('/')[-1], args.size, args.spread, ','.join(args.range), args.name))
+    out.append(' ******************************************************************************/')
+    out.append('')
+    out.append('#ifdef LV_LVGL_H_INCLUDE_SIMPLE')
+    out.append('    #include "lvgl.h"')
+    out.append('#else')
+    out.append('    #include "../../lvgl.h"')
+    out.append('#endif')
+    out.append('')
+    out.append('#if LV_USE_FONT_SDF')
+    out.append('')
+    out.append('/*-----------------')
+    out.append(' *    BITMAPS')
+    out.append(' *----------------*/')
+    out.append('')
+    out.append('/*Store the distance fields of the glyphs*/')
+    out.append('static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {')
+    bitmap_index = 0
+    for letter, g in zip(letters, glyphs):
+        g['bitmap_index'] = bitmap_index
+        if not g['bitmap']:
+            continue
+        out.append('    /* %s */' % char_comment(letter))
+        for y in range(g['box_h']):
+            row = g['bitmap'][y * g['box_w']:(y + 1) * g['box_w']]
+            out.append('    ' + ', '.join('0x%02x' % v for v in row) + ',')
+        out.append('')
+        bitmap_index += len(g['bitmap'])
+    if bitmap_index == 0:
+        out.append('    0x00')
+    out.append('};')
+    out.append('')
+    out.append('')
+    out.append('/*---------------------')
+    out.append(' *  GLYPH DESCRIPTION')
+    out.append(' *--------------------*/')
+    out.append('')
+    out.append('static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {')
+    dsc = ['    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */']
+    for g in glyphs:
+        dsc.append('    {.bitmap_index = %d, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, .ofs_y = %d}' %
+                   (g['bitmap_index'], g['adv_w'], g['box_w'], g['box_h'], g['ofs_x'], g['ofs_y']))
+    out.append(',\n'.join(dsc))
+    out.append('};')
+    out.append('')
+    out.append('/*---------------------')
+    out.append(' *  CHARACTER MAPPING')
+    out.append(' *--------------------*/')
+    out.append('')
+    out.append('/*Collect the unicode lists and glyph_id offsets*/')
+    out.append('static const lv_font_fmt_txt_cmap_t cmaps[] = {')
+    cmaps = cmaps_get(letters)
+    cm = []
+    for c in cmaps:
+        cm.append('    {\n'
+                  '        .range_start = %d, .range_length = %d, .glyph_id_start = %d,\n'
+                  '        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, '
+                  '.type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY\n'
+                  '    }' % (c['start'], c['length'], c['glyph_id']))
+    out.append(',\n'.join(cm))
+    out.append('};')
+    out.append('')
+    out.append('/*--------------------')
+    out.append(' *  ALL CUSTOM DATA')
+    out.append(' *--------------------*/')
+    out.append('')
+    out.append('/*Store all the custom data of the font*/')
+    out.append('static lv_font_fmt_txt_glyph_cache_t cache;')
+    out.append('static const lv_font_fmt_txt_dsc_t font_dsc = {')
+    out.append('    .glyph_bitmap = glyph_bitmap,')
+    out.append('    .glyph_dsc = glyph_dsc,')
+    out.append('    .cmaps = cmaps,')
+    out.append('    .kern_dsc = NULL,')
+    out.append('    .kern_scale = 0,')
+    out.append('    .cmap_num = %d,' % len(cmaps))
+    out.append('    .bpp = 8,')
+    out.append('    .kern_classes = 0,')
+    out.append('    .bitmap_format = 0,')
+    out.append('    .cache = &cache')
+    out.append('};')
+    out.append('')
+    out.append('static const lv_font_t font = {')
+    out.append('    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph\'s data*/')
+    out.append('    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph\'s bitmap*/')
+    out.append('    .line_height = %d,          /*The maximum line height required by the font*/' % (ascent + descent))
+    out.append('    .base_line = %d,             /*Baseline measured from the bottom of the line*/' % descent)
+    out.append('    .subpx = LV_FONT_SUBPX_NONE,')
+    out.append('    .underline_position = %d,' % -underline)
+    out.append('    .underline_thickness = %d,' % underline)
+    out.append('    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */')
+    out.append('};')
+    out.append('')
+    out.append('')
+    out.append('/*-----------------')
+    out.append(' *  PUBLIC FONT')
+    out.append(' *----------------*/')
+    out.append('')
+    out.append('/*Use it with `lv_font_sdf_create(&%s, size)`*/' % args.name)
+    out.append('const lv_font_sdf_src_t %s = {' % args.name)
+    out.append('    .font = &font,')
+    out.append('    .size = %d,' % args.size)
+    out.append('    .spread = %d' % args.spread)
+    out.append('};')
+    out.append('')
+    out.append('#endif /*LV_USE_FONT_SDF*/')
+    out.append('')
+
+    with open(args.output, 'w') as f:
+        f.write('\n'.join(out))
+
+
+if __name__ == '__main__':
+    main()
@@ -55,6 +55,7 @@ static void set_x_anim(void * obj, int32_t v);
 static void set_y_anim(void * obj, int32_t v);
 static void scr_anim_ready(lv_anim_t * a);
 static bool is_out_anim(lv_scr_load_anim_t a);
+static void draw_buf_ring_free_history(lv_disp_t * disp);
 
 /**********************
  *  STATIC VARIABLES
@@ -189,6 +190,9 @@ void lv_disp_remove(lv_disp_t * disp)
 
     _lv_ll_remove(&LV_GC_ROOT(_lv_disp_ll), disp);
     if(disp->refr_timer) lv_timer_del(disp->refr_timer);
+    if(disp->flush_list) lv_free(disp->flush_list);
+    draw_buf_ring_free_history(disp);
+    if(disp->rot_buf) lv_free(disp->rot_buf);
     lv_free(disp);
 
     if(was_default) lv_disp_set_default(_lv_ll_get_head(&LV_GC_ROOT(_lv_disp_ll)));
@@ -396,6 +400,71 @@ void lv_disp_set_draw_buffers(lv_disp_t * disp, void * buf1, void * buf2, uint32
     disp->draw_buf_2 = buf2;
     disp->draw_buf_act = buf1;
     disp->draw_buf_size = buf_size_byte;
+    disp->draw_buf_ring = NULL;
+    disp->draw_buf_ring_cnt = 0;
+    disp->render_mode = render_mode;
+    draw_buf_ring_free_history(disp);
+}
+
+void lv_disp_set_draw_buffer_ring(lv_disp_t * disp, void ** bufs, uint32_t buf_cnt, uint32_t buf_size_byte,
+                                  lv_disp_render_mode_t render_mode)
+{
+    if(disp == NULL) disp = lv_disp_get_default();
+    if(disp == NULL) return;
+
+    LV_ASSERT_NULL(bufs);
+    if(buf_cnt == 0) {
+        LV_LOG_WARN("at least 1 buffer is required");
+        return;
+    }
+
+    if(render_mode == LV_DISP_RENDER_MODE_FULL) {
+        LV_LOG_WARN("LV_DISP_RENDER_MODE_FULL is not supported");
+        return;
+    }
+
+    /*One buffer is always on the screen in direct mode*/
+    if(render_mode == LV_DISP_RENDER_MODE_DIRECT && buf_cnt < 2) {
+        LV_LOG_WARN("at least 2 buffers are required in direct mode");
+        return;
+    }
+
+    /*Wait for the ongoing flushes as the counters are reset*/
+    while(disp->flushing) {
+        if(disp->wait_cb) disp->wait_cb(disp);
+    }
+
+    draw_buf_ring_free_history(disp);
+    disp->flush_queue = lv_malloc(sizeof(_lv_disp_flush_entry_t) * buf_cnt);
+    LV_ASSERT_MALLOC(disp->flush_queue);
+    if(disp->flush_queue == NULL) return;
+
+    if(render_mode == LV_DISP_RENDER_MODE_DIRECT) {
+        /*All zero: none of the buffers were rendered yet*/
+        disp->draw_buf_ring_frame = lv_malloc(sizeof(uint32_t) * buf_cnt);
+        disp->draw_buf_ring_dmg = lv_malloc(sizeof(_lv_disp_dmg_frame_t) * buf_cnt);
+        LV_ASSERT_MALLOC(disp->draw_buf_ring_frame);
+        LV_ASSERT_MALLOC(disp->draw_buf_ring_dmg);
+        if(disp->draw_buf_ring_frame == NULL || disp->draw_buf_ring_dmg == NULL) {
+            draw_buf_ring_free_history(disp);
+            return;
+        }
+        lv_memzero(disp->draw_buf_ring_frame, sizeof(uint32_t) * buf_cnt);
+        lv_memzero(disp->draw_buf_ring_dmg, sizeof(_lv_disp_dmg_frame_t) * buf_cnt);
+        disp->draw_buf_ring_frame_act = 1;
+    }
+
+    disp->draw_buf_1 = bufs[0];
+    disp->draw_buf_2 = NULL;
+    disp->draw_buf_act = bufs[0];
+    disp->draw_buf_size = buf_size_byte;
+    disp->draw_buf_ring = bufs;
+    disp->draw_buf_ring_cnt = buf_cnt;
+    disp->draw_buf_ring_act = 0;
+    disp->flush_started_cnt = 0;
+    disp->flush_finished_cnt = 0;
+    disp->flush_seq_started = 0;
+    disp->flush_seq_finished = 0;
     disp->render_mode = render_mode;
 }
 
@@ -407,6 +476,26 @@ void lv_disp_set_flush_cb(lv_disp_t * disp, lv_disp_flush_cb_t flush_cb)
     disp->flush_cb = flush_cb;
 }
 
+void lv_disp_set_flush_list_cb(lv_disp_t * disp, lv_disp_flush_list_cb_t flush_list_cb)
+{
+    if(disp == NULL) disp = lv_disp_get_default();
+    if(disp == NULL) return;
+
+    if(flush_list_cb && disp->flush_list == NULL) {
+        disp->flush_list = lv_malloc(sizeof(lv_disp_flush_area_t) * LV_INV_BUF_SIZE);
+        LV_ASSERT_MALLOC(disp->flush_list);
+        if(disp->flush_list == NULL) return;
+    }
+    else if(flush_list_cb == NULL && disp->flush_list) {
+        lv_free(disp->flush_list);
+        disp->flush_list = NULL;
+    }
+
+    disp->flush_list_cb = flush_list_cb;
+    disp->flush_list_cnt = 0;
+    disp->flush_list_buf_ofs = 0;
+}
+
 void lv_disp_set_color_format(lv_disp_t * disp, lv_color_format_t color_format)
 {
     if(disp == NULL) disp = lv_disp_get_default();
@@ -443,12 +532,32 @@ bool lv_disp_get_antialiasing(lv_disp_t * disp)
 
 LV_ATTRIBUTE_FLUSH_READY void lv_disp_flush_ready(lv_disp_t * disp)
 {
+    /*With a buffer ring more flushes can be in progress. Clear the flag only when all are finished.*/
+    if(disp->draw_buf_ring) {
+        disp->flush_seq_finished++;
+
+        /*Free the oldest buffer if its last flush is finished*/
+        if(disp->flush_finished_cnt != disp->flush_started_cnt) {
+            const _lv_disp_flush_entry_t * entry = &disp->flush_queue[disp->flush_finished_cnt % disp->draw_buf_ring_cnt];
+            if(entry->flush_seq == disp->flush_seq_finished) disp->flush_finished_cnt++;
+        }
+
+        if(disp->flush_seq_finished != disp->flush_seq_started) return;
+    }
+
     disp->flushing = 0;
     disp->flushing_last = 0;
 }
 
 LV_ATTRIBUTE_FLUSH_READY bool lv_disp_flush_is_last(lv_disp_t * disp)
 {
+    /*With a buffer ring tell it about the oldest not finished flush*/
+    if(disp->draw_buf_ring) {
+        if(disp->flush_finished_cnt == disp->flush_started_cnt) return false;
+        const _lv_disp_flush_entry_t * entry = &disp->flush_queue[disp->flush_finished_cnt % disp->draw_buf_ring_cnt];
+        return entry->last && entry->flush_seq == disp->flush_seq_finished + 1;
+    }
+
     return disp->flushing_last;
 }
 
@@ -457,6 +566,17 @@ bool lv_disp_is_double_buffered(lv_disp_t * disp)
     return disp->draw_buf_2 ? true : false;
 }
 
+void lv_disp_get_refr_stats(lv_disp_t * disp, lv_disp_refr_stats_t * stats)
+{
+    if(disp == NULL) disp = lv_disp_get_default();
+    if(disp == NULL) {
+        lv_memzero(stats, sizeof(lv_disp_refr_stats_t));
+        return;
+    }
+
+    lv_memcpy(stats, &disp->refr_stats, sizeof(lv_disp_refr_stats_t));
+}
+
 /*---------------------
  * DRAW CONTEXT
  *--------------------*/
@@ -751,6 +871,13 @@ void lv_disp_set_rotation(lv_disp_t * disp, lv_disp_rotation_t rotation, bool sw
 
     disp->rotation = rotation;
     disp->sw_rotate = sw_rotate;
+
+    /*The temporary buffer is required only for 90 and 270 degree software rotation*/
+    if(disp->rot_buf && (!sw_rotate || rotation == LV_DISP_ROTATION_0 || rotation == LV_DISP_ROTATION_180)) {
+        lv_free(disp->rot_buf);
+        disp->rot_buf = NULL;
+    }
+
     update_resolution(disp);
 }
 
@@ -999,3 +1126,13 @@ static bool is_out_anim(lv_scr_load_anim_t anim_type)
            anim_type == LV_SCR_LOAD_ANIM_OUT_TOP   ||
            anim_type == LV_SCR_LOAD_ANIM_OUT_BOTTOM;
 }
+
+static void draw_buf_ring_free_history(lv_disp_t * disp)
+{
+    if(disp->draw_buf_ring_frame) lv_free(disp->draw_buf_ring_frame);
+    if(disp->draw_buf_ring_dmg) lv_free(disp->draw_buf_ring_dmg);
+    if(disp->flush_queue) lv_free(disp->flush_queue);
+    disp->draw_buf_ring_frame = NULL;
+    disp->draw_buf_ring_dmg = NULL;
+    disp->flush_queue = NULL;
+}
@@ -87,6 +87,29 @@ typedef enum {
 
 typedef void (*lv_disp_flush_cb_t)(struct _lv_disp_t * disp, const lv_area_t * area, lv_color_t * px_map);
 
+/**
+ * Describes an area passed to `flush_list_cb`
+ */
+typedef struct {
+    lv_area_t area;         /**< The area to update on the display (display offset already applied)*/
+    uint32_t buf_ofs;       /**< Offset of the area's first pixel from the beginning of the draw buffer [bytes]*/
+    lv_coord_t stride;      /**< Width of a line of the area in the draw buffer [px]*/
+} lv_disp_flush_area_t;
+
+typedef void (*lv_disp_flush_list_cb_t)(struct _lv_disp_t * disp, const lv_disp_flush_area_t * areas,
+                                        uint32_t area_cnt, uint8_t * buf);
+
+/**
+ * Statistics about the last refresh of a display
+ */
+typedef struct {
+    uint32_t flush_cnt;         /**< Number of `flush_cb` or `flush_list_cb` calls*/
+    uint32_t flush_wait_cnt;    /**< How many times the rendering waited for a buffer being flushed*/
+    uint32_t flush_wait_time;   /**< Time spent waiting for the buffers being flushed [ms]*/
+    uint32_t band_cnt;          /**< Number of full width bands rendered in PARTIAL mode*/
+    uint32_t tile_cnt;          /**< Number of tiles rendered in PARTIAL mode when the areas were split into columns too*/
+} lv_disp_refr_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -245,12 +268,45 @@ lv_coord_t lv_disp_get_dpi(const lv_disp_t * disp);
 void lv_disp_set_draw_buffers(lv_disp_t * disp, void * buf1, void * buf2, uint32_t buf_size_byte,
                               lv_disp_render_mode_t render_mode);
 
+/**
+ * Set a ring of draw buffers to pipeline rendering and flushing.
+ * LVGL renders into the buffers one after the other and calls `flush_cb` without waiting for the previous
+ * flushes to be finished. Rendering waits only if all the buffers are still being flushed.
+ * Therefore the driver should queue the flush requests and call `lv_disp_flush_ready()` once for each,
+ * in the same order as they were received.
+ * In direct mode the buffers are screen sized and a buffer is shown until the next one's flush is finished.
+ * LVGL remembers the invalidated areas of the previous frames and redraws everything that changed since
+ * a buffer was rendered last time, so there is no need to copy the areas between the buffers.
+ * @param disp              pointer to a display
+ * @param bufs              array of `buf_cnt` buffer pointers. Only the pointer is saved, so it can't be a local variable.
+ * @param buf_cnt           number of buffers (at least 1, in direct mode at least 2)
+ * @param buf_size_byte     size of each buffer in bytes
+ * @param render_mode       `LV_DISP_RENDER_MODE_PARTIAL` or `LV_DISP_RENDER_MODE_DIRECT`
+ */
+void lv_disp_set_draw_buffer_ring(lv_disp_t * disp, void ** bufs, uint32_t buf_cnt, uint32_t buf_size_byte,
+                                  lv_disp_render_mode_t render_mode);
+
 /**
  * Set the flush callback whcih will be called to copy the rendered image to the display.
  * @param disp      pointer to a display
  * @param flush_cb  the flush callback (`px_map` contains the rendered image as raw pixel map and it should be copied to `area` on the display)
  */
 void lv_disp_set_flush_cb(lv_disp_t * disp, lv_disp_flush_cb_t flush_cb);
+
+/**
+ * Set a callback which receives all the areas rendered into a draw buffer at once instead of calling
+ * `flush_cb` for each area. It lets the driver coalesce, reorder and transfer the areas together.
+ * In `LV_DISP_RENDER_MODE_PARTIAL` mode the small areas are packed one after the other into the draw buffer
+ * and the list is flushed when the next area doesn't fit or the refreshing is finished.
+ * In `LV_DISP_RENDER_MODE_DIRECT` and `LV_DISP_RENDER_MODE_FULL` modes all the areas are flushed once
+ * at the end of the refresh cycle.
+ * `lv_disp_flush_ready()` needs to be called once when all the areas of the list are flushed.
+ * @param disp              pointer to a display
+ * @param flush_list_cb     the callback or `NULL` to use `flush_cb` again.
+ * @note If software rotation is used the rotated chunks are still flushed one by one.
+ */
+void lv_disp_set_flush_list_cb(lv_disp_t * disp, lv_disp_flush_list_cb_t flush_list_cb);
+
 /**
  * Set the color format of the display.
  * If set to other than `LV_COLOR_FORMAT_NATIVE` the draw_ctx's `buffer_convert` function will be used
@@ -295,6 +351,8 @@ LV_ATTRIBUTE_FLUSH_READY void lv_disp_flush_ready(lv_disp_t * disp);
 /**
  * Tell if it's the last area of the refreshing process.
  * Can be called from `flush_cb` to execute some special display refreshing if needed when all areas area flushed.
+ * With a buffer ring it refers to the oldest flush for which `lv_disp_flush_ready()` wasn't called yet,
+ * i.e. the one the driver processes if the flushes are queued.
  * @param disp      pointer to display
  * @return          true: it's the last area to flush;
  *                  false: there are other areas too which will be refreshed soon
@@ -306,6 +364,13 @@ LV_ATTRIBUTE_FLUSH_READY bool lv_disp_flush_is_last(lv_disp_t * disp);
 
 bool lv_disp_is_double_buffered(lv_disp_t * disp);
 
+/**
+ * Get the statistics about the last refresh of a display.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @param stats     the statistics will be copied here
+ */
+void lv_disp_get_refr_stats(lv_disp_t * disp, lv_disp_refr_stats_t * stats);
+
 /*---------------------
  * DRAW CONTEXT
  *--------------------*/
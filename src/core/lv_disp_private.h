@@ -31,6 +31,18 @@ struct _lv_disp_t;
 
 typedef void (*lv_disp_flush_cb_t)(struct _lv_disp_t * disp, const lv_area_t * area, lv_color_t * px_map);
 
+/** The areas invalidated in a frame*/
+typedef struct {
+    lv_area_t areas[LV_INV_BUF_SIZE];
+    uint16_t area_cnt;
+} _lv_disp_dmg_frame_t;
+
+/** A draw buffer of a ring handed off to the driver*/
+typedef struct {
+    uint32_t flush_seq;     /**< Index of the flush which finishes the buffer*/
+    uint32_t last;          /**< 1: the flush belongs to the last area of a refresh cycle*/
+} _lv_disp_flush_entry_t;
+
 struct _lv_disp_t {
 
     /*---------------------
@@ -73,15 +85,53 @@ struct _lv_disp_t {
     /** In byte count*/
     uint32_t draw_buf_size;
 
+    /** Draw buffers set by `lv_disp_set_draw_buffer_ring()`. NULL if not used.*/
+    void ** draw_buf_ring;
+    uint32_t draw_buf_ring_cnt;
+    uint32_t draw_buf_ring_act;     /**< Index of `draw_buf_act` in `draw_buf_ring`*/
+
+    /** In DIRECT mode the index of the frame when a buffer of the ring was rendered last time (0: never).
+     * Used to find out which areas have changed since then.*/
+    uint32_t * draw_buf_ring_frame;
+    uint32_t draw_buf_ring_frame_act;   /**< Index of the frame being rendered now*/
+
+    /** Invalidated areas of the last `draw_buf_ring_cnt` frames in DIRECT mode*/
+    _lv_disp_dmg_frame_t * draw_buf_ring_dmg;
+
+    /** The buffers of the ring being flushed in the order of handing them off (`draw_buf_ring_cnt` elements).
+     * The first one is at `flush_finished_cnt % draw_buf_ring_cnt`.*/
+    _lv_disp_flush_entry_t * flush_queue;
+
     /** MANDATORY: Write the internal buffer (draw_buf) to the display. 'lv_disp_flush_ready()' has to be
      * called when finished*/
     lv_disp_flush_cb_t flush_cb;
 
+    /** OPTIONAL: Flush all the areas rendered into a draw buffer at once instead of calling `flush_cb` for each.
+     * 'lv_disp_flush_ready()' has to be called when finished*/
+    lv_disp_flush_list_cb_t flush_list_cb;
+
+    /** Areas collected for `flush_list_cb` (`LV_INV_BUF_SIZE` elements)*/
+    lv_disp_flush_area_t * flush_list;
+    uint32_t flush_list_cnt;
+
+    /** The first free byte in the draw buffer in PARTIAL mode when `flush_list_cb` is used*/
+    uint32_t flush_list_buf_ofs;
+
     /*1: flushing is in progress. (It can't be a bit field because when it's cleared from IRQ Read-Modify-Write issue might occur)*/
     volatile int flushing;
 
     /*1: It was the last chunk to flush. (It can't be a bit field because when it's cleared from IRQ Read-Modify-Write issue might occur)*/
     volatile int flushing_last;
+    /*Number of buffers of the ring handed off to the driver and flushed completely.
+     *(Separate counters because they are incremented from different contexts)*/
+    volatile uint32_t flush_started_cnt;
+    volatile uint32_t flush_finished_cnt;
+
+    /*Number of `flush_cb`/`flush_list_cb` calls and `lv_disp_flush_ready()` calls with a buffer ring.
+     *In direct mode a buffer is flushed in several calls.*/
+    volatile uint32_t flush_seq_started;
+    volatile uint32_t flush_seq_finished;
+
     volatile uint32_t last_area         : 1; /*1: the last area is being rendered*/
     volatile uint32_t last_part         : 1; /*1: the last part of the current area is being rendered*/
 
@@ -138,6 +188,9 @@ struct _lv_disp_t {
     uint32_t sw_rotate : 1; /**< 1: use software rotation (slower)*/
     uint32_t rotation  : 2; /**< Element of  @lv_disp_rotation_t*/
 
+    /** Temporary buffer for software rotation (`LV_DISP_ROT_MAX_BUF` bytes). Allocated on first use.*/
+    lv_color_t * rot_buf;
+
     /**< The theme assigned to the screen*/
     struct _lv_theme_t * theme;
 
@@ -149,6 +202,9 @@ struct _lv_disp_t {
 
     uint32_t last_render_start_time;
 
+    /** Statistics of the last refresh*/
+    lv_disp_refr_stats_t refr_stats;
+
     /** OPTIONAL: Called periodically while lvgl waits for operation to be completed.
      * For example flushing or GPU
      * User can execute very simple tasks here or yield the task*/
@@ -20,6 +20,7 @@
 #include "../misc/lv_anim.h"
 #include "../misc/lv_timer.h"
 #include "../misc/lv_async.h"
+#include "../misc/lv_worker.h"
 #include "../misc/lv_fs.h"
 #include "../misc/lv_gc.h"
 #include "../misc/lv_math.h"
@@ -168,6 +169,18 @@ void lv_init(void)
 
     _lv_img_cache_builtin_init();
 
+#if LV_USE_IMG_TRANSFORM_CACHE
+    _lv_img_transform_cache_init();
+#endif
+
+#if LV_USE_IMG_TILE_CACHE
+    _lv_img_tile_cache_init();
+#endif
+
+#if LV_USE_BIDI
+    _lv_bidi_init();
+#endif
+
     /*Test if the IDE has UTF-8 encoding*/
     const char * txt = "Á";
 
@@ -270,10 +283,16 @@ void lv_init(void)
 
 void lv_deinit(void)
 {
+    _lv_worker_deinit();
+
     _lv_gc_clear_roots();
 
     lv_disp_set_default(NULL);
 
+#if LV_USE_BIDI
+    _lv_bidi_deinit();
+#endif
+
 #if LV_USE_BUILTIN_MALLOC
     lv_mem_deinit_builtin();
 #endif
@@ -22,23 +22,51 @@
  *      DEFINES
  *********************/
 
+/*Areas packed into the draw buffer for `flush_list_cb` start on this byte boundary*/
+#define FLUSH_LIST_ALIGN    LV_MAX(LV_ATTRIBUTE_MEM_ALIGN_SIZE, 4)
+
+/*Size of the square blocks in which the software rotation processes the image*/
+#define LV_DISP_ROT_BLOCK_SIZE      16
+
+/*Number of column counts to try when an area is split into tiles in PARTIAL mode*/
+#define LV_REFR_TILE_COL_MAX_TRY    8
+
+/*Number of row counts whose rounded value is remembered during a refresh*/
+#define LV_REFR_ROW_CNT_CACHE_SIZE  (LV_REFR_TILE_COL_MAX_TRY + 1)
+
 /**********************
  *      TYPEDEFS
  **********************/
+typedef struct {
+    int32_t row_cnt;            /*Number of rows fitting into the draw buffer*/
+    int32_t row_cnt_rounded;    /*The same after the rounder or 0 if it can't be rounded*/
+} row_cnt_cache_t;
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void lv_refr_join_area(void);
 static void refr_invalid_areas(void);
+static void draw_buf_ring_add_damage(lv_disp_t * disp);
 static void refr_area(const lv_area_t * area_p);
 static void refr_area_part(lv_draw_ctx_t * draw_ctx);
+static void refr_partial_part(lv_draw_ctx_t * draw_ctx, lv_area_t * sub_area);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj);
 static void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
 static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h);
+static uint32_t get_tile_col_cnt(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h, int32_t * max_row);
+static uint32_t get_px_size(lv_disp_t * disp);
 static void draw_buf_flush(lv_disp_t * disp);
+static void wait_for_flushing(lv_disp_t * disp);
+static void wait_for_free_buf(lv_disp_t * disp);
+static void flush_queue_add(lv_disp_t * disp, bool last);
+static void draw_buf_swap(lv_disp_t * disp, bool flushing_last);
 static void call_flush_cb(lv_disp_t * disp, const lv_area_t * area, lv_color_t * color_p);
+static bool flush_list_is_used(lv_disp_t * disp);
+static uint32_t flush_list_get_area_size(lv_disp_t * disp, const lv_area_t * area);
+static void flush_list_add(lv_disp_t * disp);
+static void flush_list_send(lv_disp_t * disp, bool last);
 
 /**********************
  *  STATIC VARIABLES
@@ -46,6 +74,11 @@ static void call_flush_cb(lv_disp_t * disp, const lv_area_t * area, lv_color_t *
 
 static lv_disp_t * disp_refr; /*Display being refreshed*/
 
+/*The rounder events of `get_max_row()` are sent only once per row count in a refresh*/
+static row_cnt_cache_t row_cnt_cache[LV_REFR_ROW_CNT_CACHE_SIZE];
+static uint32_t row_cnt_cache_cnt;
+static uint32_t row_cnt_cache_next;
+
 /**********************
  *      MACROS
  **********************/
@@ -257,6 +290,9 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
         return;
     }
 
+    row_cnt_cache_cnt = 0;
+    row_cnt_cache_next = 0;
+
     if(disp_refr->draw_buf_size == 0) {
         LV_LOG_WARN("draw_buf_size == 0");
         return;
@@ -270,6 +306,7 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
     lv_disp_send_event(disp_refr, LV_EVENT_REFR_START, NULL);
 
     disp_refr->last_render_start_time = start;
+    lv_memzero(&disp_refr->refr_stats, sizeof(lv_disp_refr_stats_t));
 
     /*Refresh the screen's layout if required*/
     lv_obj_update_layout(disp_refr->act_scr);
@@ -294,8 +331,20 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
 
     lv_refr_join_area();
 
+    /*Save the invalidated areas and add the ones which were drawn since the buffer was rendered last time*/
+    uint32_t ring_buf_rendered = disp_refr->draw_buf_ring_act;
+    if(disp_refr->draw_buf_ring_dmg && disp_refr->inv_p) {
+        draw_buf_ring_add_damage(disp_refr);
+        lv_refr_join_area();
+    }
+
     refr_invalid_areas();
 
+    if(disp_refr->draw_buf_ring_dmg && disp_refr->inv_p) {
+        disp_refr->draw_buf_ring_frame[ring_buf_rendered] = disp_refr->draw_buf_ring_frame_act;
+        disp_refr->draw_buf_ring_frame_act++;
+    }
+
     if(disp_refr->inv_p == 0) goto refr_cache_clean_up;
 
     /*If refresh happened ...*/
@@ -306,9 +355,7 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
 
     /*With double buffered direct mode synchronize the rendered areas to the other buffer*/
     /*We need to wait for ready here to not mess up the active screen*/
-    while(disp_refr->flushing) {
-        if(disp_refr->wait_cb) disp_refr->wait_cb(disp_refr);
-    }
+    wait_for_flushing(disp_refr);
     /*The buffers are already swapped.
      *So the active buffer is the off screen buffer where LVGL will render*/
     void * buf_off_screen = disp_refr->draw_buf_act;
@@ -387,6 +434,56 @@ static void lv_refr_join_area(void)
     }
 }
 
+/**
+ * In direct mode with a buffer ring save the invalidated areas of the current frame
+ * and add the areas invalidated since the active buffer was rendered last time.
+ * @param disp      pointer to a display
+ */
+static void draw_buf_ring_add_damage(lv_disp_t * disp)
+{
+    uint32_t ring_cnt = disp->draw_buf_ring_cnt;
+    uint32_t frame_act = disp->draw_buf_ring_frame_act;
+
+    /*Save the areas of this frame. The history has `ring_cnt` slots
+     *so it doesn't overwrite the `ring_cnt - 1` previous frames needed below.*/
+    _lv_disp_dmg_frame_t * dmg = &disp->draw_buf_ring_dmg[frame_act % ring_cnt];
+    dmg->area_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        if(disp->inv_area_joined[i]) continue;
+        dmg->areas[dmg->area_cnt] = disp->inv_areas[i];
+        dmg->area_cnt++;
+    }
+
+    /*If the buffer was never rendered or it's too old redraw everything.*/
+    lv_area_t scr_area;
+    lv_area_set(&scr_area, 0, 0, lv_disp_get_hor_res(disp) - 1, lv_disp_get_ver_res(disp) - 1);
+    uint32_t frame_buf = disp->draw_buf_ring_frame[disp->draw_buf_ring_act];
+    bool full = frame_buf == 0 || frame_act - frame_buf > ring_cnt;
+
+    /*Add the areas of the skipped frames*/
+    uint32_t f;
+    for(f = frame_buf + 1; !full && f < frame_act; f++) {
+        _lv_disp_dmg_frame_t * dmg_prev = &disp->draw_buf_ring_dmg[f % ring_cnt];
+        if(disp->inv_p + dmg_prev->area_cnt > LV_INV_BUF_SIZE) {
+            full = true;
+            break;
+        }
+
+        for(i = 0; i < dmg_prev->area_cnt; i++) {
+            disp->inv_areas[disp->inv_p] = dmg_prev->areas[i];
+            disp->inv_area_joined[disp->inv_p] = 0;
+            disp->inv_p++;
+        }
+    }
+
+    if(full) {
+        disp->inv_areas[0] = scr_area;
+        disp->inv_p = 1;
+        lv_memzero(disp->inv_area_joined, sizeof(disp->inv_area_joined));
+    }
+}
+
 /**
  * Refresh the joined areas
  */
@@ -422,6 +519,9 @@ static void refr_invalid_areas(void)
         }
     }
 
+    /*Be sure nothing remains in the flush list*/
+    if(disp_refr->flush_list_cnt) flush_list_send(disp_refr, true);
+
     disp_refr->rendering_in_progress = false;
     LV_PROFILER_END;
 }
@@ -465,50 +565,72 @@ static void refr_area(const lv_area_t * area_p)
     lv_coord_t y2 = area_p->y2 >= lv_disp_get_ver_res(disp_refr) ?
                     lv_disp_get_ver_res(disp_refr) - 1 : area_p->y2;
 
-    int32_t max_row = get_max_row(disp_refr, w, h);
+    /*Split the area into columns too if it results in less parts*/
+    int32_t max_row;
+    uint32_t col_cnt = get_tile_col_cnt(disp_refr, w, h, &max_row);
+    if(col_cnt == 0 || max_row <= 0) return;
+    lv_coord_t tile_w = (w + col_cnt - 1) / col_cnt;
 
     lv_coord_t row;
-    lv_coord_t row_last = 0;
+    lv_coord_t col;
     lv_area_t sub_area;
-    for(row = area_p->y1; row + max_row - 1 <= y2; row += max_row) {
-        /*Calc. the next y coordinates of draw_buf*/
-        sub_area.x1 = area_p->x1;
-        sub_area.x2 = area_p->x2;
-        sub_area.y1 = row;
-        sub_area.y2 = row + max_row - 1;
-        draw_ctx->buf_area = &sub_area;
-        draw_ctx->clip_area = &sub_area;
-        draw_ctx->buf = disp_refr->draw_buf_act;
-        if(sub_area.y2 > y2) sub_area.y2 = y2;
-        row_last = sub_area.y2;
-        if(y2 == row_last) disp_refr->last_part = 1;
-        refr_area_part(draw_ctx);
-    }
-
-    /*If the last y coordinates are not handled yet ...*/
-    if(y2 != row_last) {
-        /*Calc. the next y coordinates of draw_buf*/
-        sub_area.x1 = area_p->x1;
-        sub_area.x2 = area_p->x2;
-        sub_area.y1 = row;
-        sub_area.y2 = y2;
-        draw_ctx->clip_area_original = sub_area;
-        draw_ctx->buf_area = &sub_area;
-        draw_ctx->clip_area = &sub_area;
+    for(row = area_p->y1; row <= y2; row += max_row) {
+        for(col = area_p->x1; col <= area_p->x2; col += tile_w) {
+            /*Calc. the next coordinates of draw_buf.
+             *Set all of them as software rotation modifies the flushed area.*/
+            sub_area.y1 = row;
+            sub_area.y2 = row + max_row - 1;
+            if(sub_area.y2 > y2) sub_area.y2 = y2;
+            sub_area.x1 = col;
+            sub_area.x2 = col + tile_w - 1;
+            if(sub_area.x2 > area_p->x2) sub_area.x2 = area_p->x2;
+
+            if(sub_area.y2 == y2 && sub_area.x2 == area_p->x2) disp_refr->last_part = 1;
+
+            if(col_cnt == 1) disp_refr->refr_stats.band_cnt++;
+            else disp_refr->refr_stats.tile_cnt++;
+
+            refr_partial_part(draw_ctx, &sub_area);
+        }
+    }
+}
+
+/**
+ * Render a part of an area in PARTIAL mode
+ * @param draw_ctx  pointer to the display's draw context
+ * @param sub_area  the area to render. Should fit into the draw buffer.
+ */
+static void refr_partial_part(lv_draw_ctx_t * draw_ctx, lv_area_t * sub_area)
+{
+    draw_ctx->buf_area = sub_area;
+    draw_ctx->clip_area = sub_area;
+    draw_ctx->clip_area_original = *sub_area;
+
+    if(flush_list_is_used(disp_refr)) {
+        /*Flush the collected areas if this one doesn't fit after them*/
+        uint32_t size = flush_list_get_area_size(disp_refr, sub_area);
+        if(disp_refr->flush_list_cnt && disp_refr->flush_list_buf_ofs + size > disp_refr->draw_buf_size) {
+            flush_list_send(disp_refr, false);
+        }
+        draw_ctx->buf = (uint8_t *)disp_refr->draw_buf_act + disp_refr->flush_list_buf_ofs;
+    }
+    else {
         draw_ctx->buf = disp_refr->draw_buf_act;
-        disp_refr->last_part = 1;
-        refr_area_part(draw_ctx);
     }
+
+    refr_area_part(draw_ctx);
 }
 
 static void refr_area_part(lv_draw_ctx_t * draw_ctx)
 {
     /* In single buffered mode wait here until the buffer is freed.
-     * Else we would draw into the buffer while it's still being transferred to the display*/
-    if(!lv_disp_is_double_buffered(disp_refr)) {
-        while(disp_refr->flushing) {
-            if(disp_refr->wait_cb) disp_refr->wait_cb(disp_refr);
-        }
+     * Else we would draw into the buffer while it's still being transferred to the display.
+     * With a buffer ring wait only if all the buffers are being flushed.*/
+    if(disp_refr->draw_buf_ring) {
+        wait_for_free_buf(disp_refr);
+    }
+    else if(!lv_disp_is_double_buffered(disp_refr)) {
+        wait_for_flushing(disp_refr);
     }
 
     if(draw_ctx->init_buf) draw_ctx->init_buf(draw_ctx);
@@ -814,13 +936,21 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
 
 static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h)
 {
-    bool has_alpha = lv_color_format_has_alpha(disp->color_format);
-    uint8_t px_size_render = has_alpha ? LV_COLOR_FORMAT_NATIVE_ALPHA_SIZE : sizeof(lv_color_t);
-    uint32_t px_size_disp =  lv_color_format_get_size(disp->color_format);
-    int32_t max_row = (uint32_t)disp->draw_buf_size / LV_MAX(px_size_render, px_size_disp) / area_w;
+    int32_t max_row = (uint32_t)disp->draw_buf_size / get_px_size(disp) / area_w;
 
     if(max_row > area_h) max_row = area_h;
 
+    /*The result depends only on the row count, so check if it was already rounded in this refresh*/
+    uint32_t i;
+    for(i = 0; i < row_cnt_cache_cnt; i++) {
+        if(row_cnt_cache[i].row_cnt == max_row) return row_cnt_cache[i].row_cnt_rounded;
+    }
+
+    row_cnt_cache_t * cache = &row_cnt_cache[row_cnt_cache_next];
+    row_cnt_cache_next = (row_cnt_cache_next + 1) % LV_REFR_ROW_CNT_CACHE_SIZE;
+    if(row_cnt_cache_cnt < LV_REFR_ROW_CNT_CACHE_SIZE) row_cnt_cache_cnt++;
+    cache->row_cnt = max_row;
+
     /*Round down the lines of draw_buf if rounding is added*/
     lv_area_t tmp;
     tmp.x1 = 0;
@@ -842,15 +972,89 @@ static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area
     if(h_tmp <= 0) {
         LV_LOG_WARN("Can't set draw_buf height using the round function. (Wrong round_cb or too "
                     "small draw_buf)");
+        cache->row_cnt_rounded = 0;
         return 0;
     }
     else {
         max_row = tmp.y2 + 1;
     }
 
+    cache->row_cnt_rounded = max_row;
     return max_row;
 }
 
+/**
+ * Get in how many columns an area should be split in PARTIAL mode.
+ * Wide areas are rendered in full width bands, but areas wider than the draw buffer
+ * or areas where the bands would waste a lot of the buffer are split into tiles.
+ * @param disp      pointer to a display
+ * @param area_w    width of the area to render
+ * @param area_h    height of the area to render
+ * @param max_row   store the number of rows of a tile here
+ * @return          number of columns or 0 on error
+ */
+static uint32_t get_tile_col_cnt(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h, int32_t * max_row)
+{
+    *max_row = 0;
+
+    uint32_t buf_px = disp->draw_buf_size / get_px_size(disp);
+    if(buf_px == 0) return 0;
+
+    /*At least this many columns are required to fit at least one row of a tile into the buffer*/
+    uint32_t col_min = (area_w + buf_px - 1) / buf_px;
+
+    /*Tiles can't be used if the rounder modifies the X coordinates*/
+    lv_area_t tmp;
+    lv_area_set(&tmp, 1, 0, area_w, 0);
+    lv_disp_send_event(disp, LV_EVENT_INVALIDATE_AREA, &tmp);
+    if(tmp.x1 != 1 || tmp.x2 != area_w) {
+        if(col_min > 1) {
+            LV_LOG_WARN("The area is wider than the draw buffer and it can't be tiled due to rounding");
+            return 0;
+        }
+        *max_row = get_max_row(disp, area_w, area_h);
+        return 1;
+    }
+
+    /*No way to use less parts than this*/
+    uint32_t part_min = ((uint32_t)area_w * area_h + buf_px - 1) / buf_px;
+
+    /*Try a few column numbers and use the one resulting in the least parts.
+     *Prefer fewer columns on tie as wider parts are more efficient to render and flush.*/
+    uint32_t col_best = 0;
+    uint32_t part_best = UINT32_MAX;
+    uint32_t col;
+    for(col = col_min; col < col_min + LV_REFR_TILE_COL_MAX_TRY; col++) {
+        lv_coord_t tile_w = (area_w + col - 1) / col;
+        uint32_t tile_max_row = get_max_row(disp, tile_w, area_h);
+        if(tile_max_row == 0) continue;
+
+        uint32_t part_cnt = col * ((area_h + tile_max_row - 1) / tile_max_row);
+        if(part_cnt < part_best) {
+            part_best = part_cnt;
+            col_best = col;
+            *max_row = tile_max_row;
+        }
+
+        if(part_best <= part_min || tile_w <= 1) break;
+    }
+
+    return col_best;
+}
+
+/**
+ * Get the size of a pixel in the draw buffer considering both the rendered and the display's color format
+ * @param disp      pointer to a display
+ * @return          the pixel size in bytes
+ */
+static uint32_t get_px_size(lv_disp_t * disp)
+{
+    bool has_alpha = lv_color_format_has_alpha(disp->color_format);
+    uint8_t px_size_render = has_alpha ? LV_COLOR_FORMAT_NATIVE_ALPHA_SIZE : sizeof(lv_color_t);
+    uint32_t px_size_disp =  lv_color_format_get_size(disp->color_format);
+    return LV_MAX(px_size_render, px_size_disp);
+}
+
 static void draw_buf_rotate_180(lv_disp_t * disp, lv_area_t * area, lv_color_t * color_p)
 {
     lv_coord_t area_w = lv_area_get_width(area);
@@ -875,22 +1079,38 @@ static void draw_buf_rotate_180(lv_disp_t * disp, lv_area_t * area, lv_color_t *
     area->x1 = disp->hor_res - tmp_coord - 1;
 }
 
-static LV_ATTRIBUTE_FAST_MEM void draw_buf_rotate_90(bool invert_i, lv_coord_t area_w, lv_coord_t area_h,
+/**
+ * Rotate an image by 90 or 270 degrees into an other buffer.
+ * The image is processed in blocks so both the source and destination lines of a block stay in the cache.
+ */
+static LV_ATTRIBUTE_FAST_MEM void draw_buf_rotate_90(bool is_270, lv_coord_t area_w, lv_coord_t area_h,
                                                      lv_color_t * orig_color_p, lv_color_t * rot_buf)
 {
-
-    uint32_t invert = (area_w * area_h) - 1;
-    uint32_t initial_i = ((area_w - 1) * area_h);
-    for(lv_coord_t y = 0; y < area_h; y++) {
-        uint32_t i = initial_i + y;
-        if(invert_i)
-            i = invert - i;
-        for(lv_coord_t x = 0; x < area_w; x++) {
-            rot_buf[i] = *(orig_color_p++);
-            if(invert_i)
-                i += area_h;
-            else
-                i -= area_h;
+    lv_coord_t bx, by, x, y;
+    for(by = 0; by < area_h; by += LV_DISP_ROT_BLOCK_SIZE) {
+        lv_coord_t y_end = LV_MIN(by + LV_DISP_ROT_BLOCK_SIZE, area_h);
+        for(bx = 0; bx < area_w; bx += LV_DISP_ROT_BLOCK_SIZE) {
+            lv_coord_t x_end = LV_MIN(bx + LV_DISP_ROT_BLOCK_SIZE, area_w);
+            for(y = by; y < y_end; y++) {
+                const lv_color_t * src = &orig_color_p[y * area_w + bx];
+                /*90: (x;y) goes to (y; w - 1 - x), 270: (x;y) goes to (h - 1 - y; x) in the `h` wide buffer*/
+                if(is_270) {
+                    lv_color_t * dest = &rot_buf[bx * area_h + (area_h - 1 - y)];
+                    for(x = bx; x < x_end; x++) {
+                        *dest = *src;
+                        src++;
+                        dest += area_h;
+                    }
+                }
+                else {
+                    lv_color_t * dest = &rot_buf[(area_w - 1 - bx) * area_h + y];
+                    for(x = bx; x < x_end; x++) {
+                        *dest = *src;
+                        src++;
+                        dest -= area_h;
+                    }
+                }
+            }
         }
     }
 }
@@ -914,27 +1134,34 @@ static inline void draw_buf_rotate4(lv_color_t * a, lv_color_t * b, lv_color_t *
  */
 static void draw_buf_rotate_90_sqr(bool is_270, lv_coord_t w, lv_color_t * color_p)
 {
-    for(lv_coord_t i = 0; i < w / 2; i++) {
-        for(lv_coord_t j = 0; j < (w + 1) / 2; j++) {
-            lv_coord_t inv_i = (w - 1) - i;
-            lv_coord_t inv_j = (w - 1) - j;
-            if(is_270) {
-                draw_buf_rotate4(
-                    &color_p[i * w + j],
-                    &color_p[inv_j * w + i],
-                    &color_p[inv_i * w + inv_j],
-                    &color_p[j * w + inv_i]
-                );
-            }
-            else {
-                draw_buf_rotate4(
-                    &color_p[i * w + j],
-                    &color_p[j * w + inv_i],
-                    &color_p[inv_i * w + inv_j],
-                    &color_p[inv_j * w + i]
-                );
+    /*Process the quarter in blocks to make the 4 accessed locations stay in the cache*/
+    lv_coord_t bi, bj;
+    for(bi = 0; bi < w / 2; bi += LV_DISP_ROT_BLOCK_SIZE) {
+        lv_coord_t i_end = LV_MIN(bi + LV_DISP_ROT_BLOCK_SIZE, w / 2);
+        for(bj = 0; bj < (w + 1) / 2; bj += LV_DISP_ROT_BLOCK_SIZE) {
+            lv_coord_t j_end = LV_MIN(bj + LV_DISP_ROT_BLOCK_SIZE, (w + 1) / 2);
+            for(lv_coord_t i = bi; i < i_end; i++) {
+                for(lv_coord_t j = bj; j < j_end; j++) {
+                    lv_coord_t inv_i = (w - 1) - i;
+                    lv_coord_t inv_j = (w - 1) - j;
+                    if(is_270) {
+                        draw_buf_rotate4(
+                            &color_p[i * w + j],
+                            &color_p[inv_j * w + i],
+                            &color_p[inv_i * w + inv_j],
+                            &color_p[j * w + inv_i]
+                        );
+                    }
+                    else {
+                        draw_buf_rotate4(
+                            &color_p[i * w + j],
+                            &color_p[j * w + inv_i],
+                            &color_p[inv_i * w + inv_j],
+                            &color_p[inv_j * w + i]
+                        );
+                    }
+                }
             }
-
         }
     }
 }
@@ -989,8 +1216,17 @@ static void draw_buf_rotate(lv_area_t * area, lv_color_t * color_p)
                 }
             }
             else {
-                /*Rotate other areas using a maximum buffer size*/
-                if(rot_buf == NULL) rot_buf = lv_malloc(LV_DISP_ROT_MAX_BUF);
+                /*Rotate other areas using a maximum buffer size.
+                 *The buffer is kept to not allocate it on every flush.*/
+                if(disp_refr->rot_buf == NULL) {
+                    disp_refr->rot_buf = lv_malloc(LV_DISP_ROT_MAX_BUF);
+                    LV_ASSERT_MALLOC(disp_refr->rot_buf);
+                    if(disp_refr->rot_buf == NULL) {
+                        disp_refr->flushing = 0;
+                        return;
+                    }
+                }
+                rot_buf = disp_refr->rot_buf;
                 draw_buf_rotate_90(disp_refr->rotation == LV_DISP_ROTATION_270, area_w, height, color_p, rot_buf);
 
                 if(disp_refr->rotation == LV_DISP_ROTATION_90) {
@@ -1012,17 +1248,16 @@ static void draw_buf_rotate(lv_area_t * area, lv_color_t * color_p)
                 disp_refr->flushing_last = 0;
             }
 
+            /*The draw buffer is handed off with the last chunk*/
+            if(row + height >= area_h) flush_queue_add(disp_refr, disp_refr->flushing_last);
+
             /*Flush the completed area to the display*/
             call_flush_cb(disp_refr, area, rot_buf == NULL ? color_p : rot_buf);
             /*FIXME: Rotation forces legacy behavior where rendering and flushing are done serially*/
-            while(disp_refr->flushing) {
-                if(disp_refr->wait_cb) disp_refr->wait_cb(disp_refr);
-            }
+            wait_for_flushing(disp_refr);
             color_p += area_w * height;
             row += height;
         }
-        /*Free the allocated buffer at the end if necessary*/
-        if(rot_buf != NULL) lv_free(rot_buf);
     }
 }
 
@@ -1035,14 +1270,19 @@ static void draw_buf_flush(lv_disp_t * disp)
     lv_draw_ctx_t * draw_ctx = disp->draw_ctx;
     if(draw_ctx->wait_for_finish) draw_ctx->wait_for_finish(draw_ctx);
 
+    /*Just collect the area if the flushing is done with a list*/
+    if(flush_list_is_used(disp)) {
+        flush_list_add(disp);
+        if(disp->last_area && disp->last_part) flush_list_send(disp, true);
+        return;
+    }
+
     /* In double buffered mode wait until the other buffer is freed
      * and driver is ready to receive the new buffer.
      * If we need to wait here it means that the content of one buffer is being sent to display
      * and other buffer already contains the new rendered image. */
     if(lv_disp_is_double_buffered(disp)) {
-        while(disp->flushing) {
-            if(disp->wait_cb) disp_refr->wait_cb(disp);
-        }
+        wait_for_flushing(disp);
     }
 
     disp->flushing = 1;
@@ -1052,16 +1292,37 @@ static void draw_buf_flush(lv_disp_t * disp)
 
     bool flushing_last = disp->flushing_last;
 
-    if(disp->flush_cb) {
+    if(disp->flush_cb || disp->flush_list_cb) {
         /*Rotate the buffer to the display's native orientation if necessary*/
         if(disp->rotation != LV_DISP_ROTATION_0 && disp->sw_rotate) {
             draw_buf_rotate(draw_ctx->buf_area, draw_ctx->buf);
         }
         else {
+            flush_queue_add(disp, flushing_last);
             call_flush_cb(disp, &draw_ctx->clip_area_original, draw_ctx->buf);
         }
     }
-    /*If there are 2 buffers swap them. With direct mode swap only on the last area*/
+
+    draw_buf_swap(disp, flushing_last);
+}
+
+/**
+ * Swap the draw buffers after flushing if there are 2 buffers. With direct mode swap only on the last area
+ * @param disp              pointer to a display
+ * @param flushing_last     true: the last area of the refresh cycle was flushed
+ */
+static void draw_buf_swap(lv_disp_t * disp, bool flushing_last)
+{
+    /*Step to the next buffer of the ring*/
+    if(disp->draw_buf_ring) {
+        if(disp->render_mode == LV_DISP_RENDER_MODE_DIRECT && !flushing_last) return;
+
+        disp->draw_buf_ring_act++;
+        if(disp->draw_buf_ring_act >= disp->draw_buf_ring_cnt) disp->draw_buf_ring_act = 0;
+        disp->draw_buf_act = disp->draw_buf_ring[disp->draw_buf_ring_act];
+        return;
+    }
+
     if(lv_disp_is_double_buffered(disp) && (disp->render_mode != LV_DISP_RENDER_MODE_DIRECT || flushing_last)) {
         if(disp->draw_buf_act == disp->draw_buf_1) {
             disp->draw_buf_act = disp->draw_buf_2;
@@ -1072,6 +1333,64 @@ static void draw_buf_flush(lv_disp_t * disp)
     }
 }
 
+/**
+ * Wait until all the started flushes are finished
+ * @param disp      pointer to a display
+ */
+static void wait_for_flushing(lv_disp_t * disp)
+{
+    if(!disp->flushing) return;
+
+    uint32_t t_start = lv_tick_get();
+    while(disp->flushing) {
+        if(disp->wait_cb) disp->wait_cb(disp);
+    }
+
+    disp->refr_stats.flush_wait_cnt++;
+    disp->refr_stats.flush_wait_time += lv_tick_elaps(t_start);
+}
+
+/**
+ * Remember that the next flush hands off the active buffer of the ring.
+ * In direct mode only the last flush of the refresh cycle hands off the buffer.
+ * @param disp      pointer to a display
+ * @param last      true: the next flush is the last one of the refresh cycle
+ */
+static void flush_queue_add(lv_disp_t * disp, bool last)
+{
+    if(disp->draw_buf_ring == NULL) return;
+    if(disp->render_mode == LV_DISP_RENDER_MODE_DIRECT && !last) return;
+
+    /*`wait_for_free_buf()` ensures that there is space for it*/
+    LV_ASSERT(disp->flush_started_cnt - disp->flush_finished_cnt < disp->draw_buf_ring_cnt);
+
+    _lv_disp_flush_entry_t * entry = &disp->flush_queue[disp->flush_started_cnt % disp->draw_buf_ring_cnt];
+    entry->flush_seq = disp->flush_seq_started + 1;
+    entry->last = last ? 1 : 0;
+    disp->flush_started_cnt++;
+}
+
+/**
+ * Wait until the next buffer of the buffer ring is not flushed anymore.
+ * In direct mode the last flushed buffer is on the screen so it's not free either.
+ * @param disp      pointer to a display
+ */
+static void wait_for_free_buf(lv_disp_t * disp)
+{
+    uint32_t free_cnt = disp->draw_buf_ring_cnt;
+    if(disp->render_mode == LV_DISP_RENDER_MODE_DIRECT) free_cnt--;
+
+    if(disp->flush_started_cnt - disp->flush_finished_cnt < free_cnt) return;
+
+    uint32_t t_start = lv_tick_get();
+    while(disp->flush_started_cnt - disp->flush_finished_cnt >= free_cnt) {
+        if(disp->wait_cb) disp->wait_cb(disp);
+    }
+
+    disp->refr_stats.flush_wait_cnt++;
+    disp->refr_stats.flush_wait_time += lv_tick_elaps(t_start);
+}
+
 static void call_flush_cb(lv_disp_t * disp, const lv_area_t * area, lv_color_t * color_p)
 {
     LV_PROFILER_BEGIN;
@@ -1088,6 +1407,110 @@ static void call_flush_cb(lv_disp_t * disp, const lv_area_t * area, lv_color_t *
 
     if(disp->draw_ctx->buffer_convert) disp->draw_ctx->buffer_convert(disp->draw_ctx);
 
-    disp->flush_cb(disp, &offset_area, color_p);
+    disp->refr_stats.flush_cnt++;
+    disp->flush_seq_started++;
+    if(disp->flush_cb) {
+        disp->flush_cb(disp, &offset_area, color_p);
+    }
+    else {
+        /*E.g. the chunks of software rotation are flushed as single element lists*/
+        lv_disp_flush_area_t flush_area;
+        flush_area.area = offset_area;
+        flush_area.buf_ofs = 0;
+        flush_area.stride = lv_area_get_width(area);
+        disp->flush_list_cb(disp, &flush_area, 1, (uint8_t *)color_p);
+    }
+    LV_PROFILER_END;
+}
+
+static bool flush_list_is_used(lv_disp_t * disp)
+{
+    if(disp->flush_list_cb == NULL || disp->flush_list == NULL) return false;
+
+    /*Software rotation flushes the rotated chunks one by one*/
+    if(disp->rotation != LV_DISP_ROTATION_0 && disp->sw_rotate) return false;
+
+    return true;
+}
+
+/**
+ * Get how many bytes an area occupies in the draw buffer when it's packed for `flush_list_cb`
+ * @param disp      pointer to a display
+ * @param area      the area
+ * @return          the size of the area in bytes, rounded up to `FLUSH_LIST_ALIGN`
+ */
+static uint32_t flush_list_get_area_size(lv_disp_t * disp, const lv_area_t * area)
+{
+    uint32_t size = lv_area_get_size(area) * get_px_size(disp);
+    return ((size + FLUSH_LIST_ALIGN - 1) / FLUSH_LIST_ALIGN) * FLUSH_LIST_ALIGN;
+}
+
+/**
+ * Add the area rendered by the draw_ctx to the flush list
+ * @param disp      pointer to a display
+ */
+static void flush_list_add(lv_disp_t * disp)
+{
+    lv_draw_ctx_t * draw_ctx = disp->draw_ctx;
+
+    /*Convert now because the draw_ctx will point to an other area when the list is sent*/
+    if(draw_ctx->buffer_convert) draw_ctx->buffer_convert(draw_ctx);
+
+    const lv_area_t * area = &draw_ctx->clip_area_original;
+    lv_disp_flush_area_t * flush_area = &disp->flush_list[disp->flush_list_cnt];
+    flush_area->area.x1 = area->x1 + disp->offset_x;
+    flush_area->area.y1 = area->y1 + disp->offset_y;
+    flush_area->area.x2 = area->x2 + disp->offset_x;
+    flush_area->area.y2 = area->y2 + disp->offset_y;
+
+    if(disp->render_mode == LV_DISP_RENDER_MODE_PARTIAL) {
+        flush_area->buf_ofs = disp->flush_list_buf_ofs;
+        flush_area->stride = lv_area_get_width(area);
+        disp->flush_list_buf_ofs += flush_list_get_area_size(disp, area);
+    }
+    else {
+        /*The buffer is screen sized, the areas are rendered to their absolute position*/
+        uint32_t px_size = lv_color_format_get_size(disp->color_format);
+        flush_area->stride = lv_disp_get_hor_res(disp);
+        flush_area->buf_ofs = (area->y1 * flush_area->stride + area->x1) * px_size;
+    }
+
+    disp->flush_list_cnt++;
+
+    /*Flush if there is no more space in the list*/
+    if(disp->flush_list_cnt >= LV_INV_BUF_SIZE && !(disp->last_area && disp->last_part)) {
+        flush_list_send(disp, false);
+    }
+}
+
+/**
+ * Call `flush_list_cb` with the collected areas
+ * @param disp      pointer to a display
+ * @param last      true: the last areas of the refresh cycle are sent
+ */
+static void flush_list_send(lv_disp_t * disp, bool last)
+{
+    if(disp->flush_list_cnt == 0) return;
+
+    LV_PROFILER_BEGIN;
+    REFR_TRACE("Calling flush_list_cb with %d areas", (int)disp->flush_list_cnt);
+
+    /*In double buffered mode wait until the other buffer is freed*/
+    if(lv_disp_is_double_buffered(disp)) {
+        wait_for_flushing(disp);
+    }
+
+    disp->flushing = 1;
+    disp->flushing_last = last ? 1 : 0;
+    flush_queue_add(disp, last);
+
+    disp->refr_stats.flush_cnt++;
+    disp->flush_seq_started++;
+    disp->flush_list_cb(disp, disp->flush_list, disp->flush_list_cnt, disp->draw_buf_act);
+
+    disp->flush_list_cnt = 0;
+    disp->flush_list_buf_ofs = 0;
+
+    draw_buf_swap(disp, last);
     LV_PROFILER_END;
 }
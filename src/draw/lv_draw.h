@@ -20,6 +20,9 @@ extern "C" {
 #include "../misc/lv_profiler.h"
 #include "lv_img_decoder.h"
 #include "lv_img_cache.h"
+#include "lv_img_mipmap.h"
+#include "lv_img_transform_cache.h"
+#include "lv_img_tile_cache.h"
 
 #include "lv_draw_rect.h"
 #include "lv_draw_label.h"
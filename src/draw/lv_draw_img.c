@@ -8,7 +8,11 @@
  *********************/
 #include "lv_draw_img.h"
 #include "lv_img_cache.h"
+#include "lv_img_mipmap.h"
+#include "lv_img_transform_cache.h"
+#include "lv_img_tile_cache.h"
 #include "../core/lv_disp.h"
+#include "../core/lv_disp_private.h"
 #include "../misc/lv_log.h"
 #include "../core/lv_refr.h"
 #include "../misc/lv_mem.h"
@@ -17,6 +21,8 @@
 /*********************
  *      DEFINES
  *********************/
+/*Max. size of the buffer to read more lines of not decoded images at once*/
+#define IMG_READ_BUF_SIZE   (16 * 1024)
 
 /**********************
  *      TYPEDEFS
@@ -30,6 +36,18 @@ LV_ATTRIBUTE_FAST_MEM static lv_res_t decode_and_draw(lv_draw_ctx_t * draw_ctx,
 
 static void show_error(lv_draw_ctx_t * draw_ctx, const lv_area_t * coords, const char * msg);
 static void draw_cleanup(_lv_img_cache_entry_t * cache);
+static void draw_img_data(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * draw_dsc, const lv_area_t * coords,
+                          const uint8_t * img_data, const lv_draw_img_sup_t * sup, const lv_img_decoder_dsc_t * dec_dsc);
+static lv_res_t draw_lines(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * draw_dsc, const lv_area_t * coords,
+                           const lv_draw_img_sup_t * sup, lv_img_decoder_dsc_t * dec_dsc);
+#if LV_USE_IMG_TILE_CACHE
+static bool draw_tiles(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * draw_dsc, const lv_area_t * coords,
+                       const lv_draw_img_sup_t * sup, lv_img_decoder_dsc_t * dec_dsc);
+static bool draw_tiles_transformed(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * draw_dsc,
+                                   const lv_area_t * coords, const lv_draw_img_sup_t * sup, lv_img_decoder_dsc_t * dec_dsc);
+static bool get_tiles_src_area(const lv_draw_img_dsc_t * draw_dsc, const lv_area_t * coords, const lv_area_t * area,
+                               lv_area_t * img_area);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -141,6 +159,19 @@ LV_ATTRIBUTE_FAST_MEM static lv_res_t decode_and_draw(lv_draw_ctx_t * draw_ctx,
 
     if(cdsc == NULL) return LV_RES_INV;
 
+    /*Draw nothing while the image is being decoded in the background, it will be redrawn when it's ready.
+     *Canvases and snapshots are drawn with their own draw_ctx and they are not redrawn, so wait for the image.*/
+    if(cdsc->decoding) {
+        lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+        if(disp && disp->rendering_in_progress && disp->draw_ctx == draw_ctx) {
+            _lv_img_cache_add_redraw_area(cdsc, draw_ctx->clip_area);
+            return LV_RES_OK;
+        }
+
+        _lv_img_cache_wait(cdsc);
+        if(cdsc->decoding) return LV_RES_OK;    /*The cache manager can't wait*/
+    }
+
     if(cdsc->dec_dsc.error_msg != NULL) {
         LV_LOG_WARN("Image draw error");
         show_error(draw_ctx, coords, cdsc->dec_dsc.error_msg);
@@ -184,54 +215,57 @@ LV_ATTRIBUTE_FAST_MEM static lv_res_t decode_and_draw(lv_draw_ctx_t * draw_ctx,
 
         const lv_area_t * clip_area_ori = draw_ctx->clip_area;
         draw_ctx->clip_area = &clip_com;
-        lv_draw_img_decoded(draw_ctx, draw_dsc, coords, cdsc->dec_dsc.img_data, &sup, cdsc->dec_dsc.header.cf);
-        draw_ctx->clip_area = clip_area_ori;
-    }
-    /*The whole uncompressed image is not available. Try to read it line-by-line*/
-    else {
-        lv_area_t mask_com; /*Common area of mask and coords*/
-        bool union_ok;
-        union_ok = _lv_area_intersect(&mask_com, draw_ctx->clip_area, coords);
-        /*Out of mask. There is nothing to draw so the image is drawn successfully.*/
-        if(union_ok == false) {
-            draw_cleanup(cdsc);
-            return LV_RES_OK;
+#if LV_USE_IMG_MIPMAP
+        /*Draw a smaller version of the image if it's zoomed out a lot*/
+        const lv_img_mipmap_t * mip = NULL;
+        if(!sup.chroma_keyed) {
+            uint32_t mip_mem_size;
+            mip = _lv_img_mipmap_get(&cdsc->dec_dsc, draw_dsc->zoom, &mip_mem_size);
+            _lv_img_cache_add_mem_size(cdsc, mip_mem_size);
         }
-
-        int32_t width = lv_area_get_width(&mask_com);
-
-        uint8_t  * buf = lv_malloc(lv_area_get_width(&mask_com) * LV_COLOR_FORMAT_NATIVE_ALPHA_SIZE);
-        const lv_area_t * clip_area_ori = draw_ctx->clip_area;
-        lv_area_t line;
-        lv_area_copy(&line, &mask_com);
-        lv_area_set_height(&line, 1);
-        int32_t x = mask_com.x1 - coords->x1;
-        int32_t y = mask_com.y1 - coords->y1;
-        int32_t row;
-        lv_res_t read_res;
-        for(row = mask_com.y1; row <= mask_com.y2; row++) {
-            lv_area_t mask_line;
-            union_ok = _lv_area_intersect(&mask_line, clip_area_ori, &line);
-            if(union_ok == false) continue;
-
-            read_res = lv_img_decoder_read_line(&cdsc->dec_dsc, x, y, width, buf);
-            if(read_res != LV_RES_OK) {
-                lv_img_decoder_close(&cdsc->dec_dsc);
-                LV_LOG_WARN("Image draw can't read the line");
-                lv_free(buf);
-                draw_cleanup(cdsc);
-                draw_ctx->clip_area = clip_area_ori;
-                return LV_RES_INV;
+        if(mip) {
+            lv_draw_img_dsc_t mip_dsc;
+            lv_memcpy(&mip_dsc, draw_dsc, sizeof(lv_draw_img_dsc_t));
+            mip_dsc.zoom = draw_dsc->zoom << mip->level;
+            mip_dsc.pivot.x = draw_dsc->pivot.x >> mip->level;
+            mip_dsc.pivot.y = draw_dsc->pivot.y >> mip->level;
+
+            /*Shift the smaller image to keep the pivot in place*/
+            lv_area_t mip_coords;
+            mip_coords.x1 = coords->x1 + draw_dsc->pivot.x - mip_dsc.pivot.x;
+            mip_coords.y1 = coords->y1 + draw_dsc->pivot.y - mip_dsc.pivot.y;
+            mip_coords.x2 = mip_coords.x1 + mip->w - 1;
+            mip_coords.y2 = mip_coords.y1 + mip->h - 1;
+
+            /*Due to rounding the smaller image's area might be a little bit different*/
+            lv_area_t mip_area_rot;
+            _lv_img_buf_get_transformed_area(&mip_area_rot, mip->w, mip->h, mip_dsc.angle, mip_dsc.zoom, &mip_dsc.pivot);
+            lv_area_move(&mip_area_rot, mip_coords.x1, mip_coords.y1);
+
+            lv_area_t mip_clip;
+            if(_lv_area_intersect(&mip_clip, &clip_com, &mip_area_rot)) {
+                draw_ctx->clip_area = &mip_clip;
+                draw_img_data(draw_ctx, &mip_dsc, &mip_coords, mip->data, &sup, &cdsc->dec_dsc);
             }
-
-            draw_ctx->clip_area = &mask_line;
-            lv_draw_img_decoded(draw_ctx, draw_dsc, &line, buf, &sup, cdsc->dec_dsc.header.cf);
-            line.y1++;
-            line.y2++;
-            y++;
+        }
+        else
+#endif
+        {
+            draw_img_data(draw_ctx, draw_dsc, coords, cdsc->dec_dsc.img_data, &sup, &cdsc->dec_dsc);
         }
         draw_ctx->clip_area = clip_area_ori;
-        lv_free(buf);
+    }
+#if LV_USE_IMG_TILE_CACHE
+    /*The whole uncompressed image is not available. Decode and draw only the visible tiles*/
+    else if(draw_tiles(draw_ctx, draw_dsc, coords, &sup, &cdsc->dec_dsc)) {
+        draw_cleanup(cdsc);
+        return LV_RES_OK;
+    }
+#endif
+    /*The whole uncompressed image is not available. Try to read it line-by-line*/
+    else if(draw_lines(draw_ctx, draw_dsc, coords, &sup, &cdsc->dec_dsc) != LV_RES_OK) {
+        draw_cleanup(cdsc);
+        return LV_RES_INV;
     }
 
     draw_cleanup(cdsc);
@@ -251,6 +285,322 @@ static void show_error(lv_draw_ctx_t * draw_ctx, const lv_area_t * coords, const
     lv_draw_label(draw_ctx, &label_dsc, coords, msg, NULL);
 }
 
+/**
+ * Draw an image whose pixels are all available.
+ * If it's transformed try to copy the already transformed image from the transform cache.
+ */
+static void draw_img_data(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * draw_dsc, const lv_area_t * coords,
+                          const uint8_t * img_data, const lv_draw_img_sup_t * sup, const lv_img_decoder_dsc_t * dec_dsc)
+{
+    lv_color_format_t cf = dec_dsc->header.cf;
+#if LV_USE_IMG_TRANSFORM_CACHE
+    bool transformed = draw_dsc->angle || draw_dsc->zoom != LV_ZOOM_NONE;
+    bool cf_ok = cf == LV_COLOR_FORMAT_NATIVE || cf == LV_COLOR_FORMAT_NATIVE_ALPHA ||
+                 cf == LV_COLOR_FORMAT_NATIVE_CHROMA_KEYED;
+    if(transformed && cf_ok && draw_dsc->transform_cache) {
+        const lv_img_transform_cache_entry_t * tr = _lv_img_transform_cache_get(draw_ctx, dec_dsc, draw_dsc, sup, img_data,
+                                                                                lv_area_get_width(coords),
+                                                                                lv_area_get_height(coords));
+        if(tr) {
+            /*Only recolor, opacity, etc. needs to be applied*/
+            lv_draw_img_dsc_t tr_dsc;
+            lv_memcpy(&tr_dsc, draw_dsc, sizeof(lv_draw_img_dsc_t));
+            tr_dsc.angle = 0;
+            tr_dsc.zoom = LV_ZOOM_NONE;
+
+            lv_draw_img_sup_t tr_sup;
+            lv_memcpy(&tr_sup, sup, sizeof(lv_draw_img_sup_t));
+            tr_sup.chroma_keyed = 0;
+
+            lv_area_t tr_coords = tr->area;
+            lv_area_move(&tr_coords, coords->x1, coords->y1);
+            lv_draw_img_decoded(draw_ctx, &tr_dsc, &tr_coords, tr->data, &tr_sup, LV_COLOR_FORMAT_NATIVE_ALPHA);
+            return;
+        }
+    }
+#endif
+
+    lv_draw_img_decoded(draw_ctx, draw_dsc, coords, img_data, sup, cf);
+}
+
+/**
+ * Draw an image which is not decoded at once by reading it in bands of a few lines.
+ * Only the lines in the clip area are read.
+ * @return LV_RES_OK: the image is drawn; LV_RES_INV: out of memory or the decoder couldn't read the lines
+ */
+static lv_res_t draw_lines(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * draw_dsc, const lv_area_t * coords,
+                           const lv_draw_img_sup_t * sup, lv_img_decoder_dsc_t * dec_dsc)
+{
+    lv_area_t mask_com; /*Common area of mask and coords*/
+    bool union_ok;
+    union_ok = _lv_area_intersect(&mask_com, draw_ctx->clip_area, coords);
+    /*Out of mask. There is nothing to draw so the image is drawn successfully.*/
+    if(union_ok == false) return LV_RES_OK;
+
+    int32_t width = lv_area_get_width(&mask_com);
+    uint32_t px_size = lv_color_format_get_size(dec_dsc->header.cf);
+    uint32_t buf_px_size = LV_MAX(px_size, LV_COLOR_FORMAT_NATIVE_ALPHA_SIZE);
+
+    /*Read more lines at once if the pixels are byte aligned, as the decoders can do it with fewer file operations*/
+    int32_t band_h = 1;
+    if(px_size) {
+        band_h = IMG_READ_BUF_SIZE / (width * buf_px_size);
+        band_h = LV_CLAMP(1, band_h, lv_area_get_height(&mask_com));
+    }
+
+    uint8_t  * buf = lv_malloc(width * band_h * buf_px_size);
+    if(buf == NULL && band_h > 1) {
+        band_h = 1;
+        buf = lv_malloc(width * buf_px_size);
+    }
+    LV_ASSERT_MALLOC(buf);
+    if(buf == NULL) {
+        LV_LOG_WARN("out of memory");
+        return LV_RES_INV;
+    }
+
+    const lv_area_t * clip_area_ori = draw_ctx->clip_area;
+    lv_area_t line;
+    lv_area_copy(&line, &mask_com);
+    lv_area_set_height(&line, band_h);
+    int32_t x = mask_com.x1 - coords->x1;
+    int32_t y = mask_com.y1 - coords->y1;
+    int32_t row;
+    lv_res_t read_res;
+    for(row = mask_com.y1; row <= mask_com.y2; row += band_h) {
+        if(line.y2 > mask_com.y2) line.y2 = mask_com.y2;
+
+        lv_area_t mask_line;
+        union_ok = _lv_area_intersect(&mask_line, clip_area_ori, &line);
+        if(union_ok == false) continue;
+
+        if(band_h == 1) {
+            read_res = lv_img_decoder_read_line(dec_dsc, x, y, width, buf);
+        }
+        else {
+            lv_area_t band;
+            lv_area_set(&band, x, y, x + width - 1, y + lv_area_get_height(&line) - 1);
+            read_res = lv_img_decoder_read_tile(dec_dsc, &band, buf);
+        }
+
+        if(read_res != LV_RES_OK) {
+            lv_img_decoder_close(dec_dsc);
+            LV_LOG_WARN("Image draw can't read the line");
+            lv_free(buf);
+            draw_ctx->clip_area = clip_area_ori;
+            return LV_RES_INV;
+        }
+
+        draw_ctx->clip_area = &mask_line;
+        lv_draw_img_decoded(draw_ctx, draw_dsc, &line, buf, sup, dec_dsc->header.cf);
+        line.y1 += band_h;
+        line.y2 = line.y1 + band_h - 1;
+        y += band_h;
+    }
+    draw_ctx->clip_area = clip_area_ori;
+    lv_free(buf);
+    return LV_RES_OK;
+}
+
+#if LV_USE_IMG_TILE_CACHE
+/**
+ * Draw an image which is not decoded at once tile by tile.
+ * Only the tiles which are visible in the clip area are decoded (or taken from the tile cache).
+ * If a tile can't be decoded after some others were drawn, its area is drawn line by line.
+ * @return true: the image is drawn; false: the image can't be drawn by tiles and nothing was drawn
+ */
+static bool draw_tiles(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * draw_dsc, const lv_area_t * coords,
+                       const lv_draw_img_sup_t * sup, lv_img_decoder_dsc_t * dec_dsc)
+{
+    lv_color_format_t cf = dec_dsc->header.cf;
+    if(lv_color_format_get_size(cf) == 0) return false;
+    if(dec_dsc->decoder->read_tile_cb == NULL && dec_dsc->decoder->read_line_cb == NULL) return false;
+
+    if(draw_dsc->angle || draw_dsc->zoom != LV_ZOOM_NONE) {
+        return draw_tiles_transformed(draw_ctx, draw_dsc, coords, sup, dec_dsc);
+    }
+
+    lv_area_t clip_com;
+    if(!_lv_area_intersect(&clip_com, draw_ctx->clip_area, coords)) return true;
+    lv_area_t img_area = clip_com;
+    lv_area_move(&img_area, -coords->x1, -coords->y1);
+
+    const lv_area_t * clip_area_ori = draw_ctx->clip_area;
+    bool drawn = false;
+    lv_coord_t row;
+    lv_coord_t col;
+    for(row = img_area.y1 / LV_IMG_TILE_SIZE; row <= img_area.y2 / LV_IMG_TILE_SIZE; row++) {
+        for(col = img_area.x1 / LV_IMG_TILE_SIZE; col <= img_area.x2 / LV_IMG_TILE_SIZE; col++) {
+            lv_area_t tile_coords;
+            tile_coords.x1 = coords->x1 + col * LV_IMG_TILE_SIZE;
+            tile_coords.y1 = coords->y1 + row * LV_IMG_TILE_SIZE;
+            tile_coords.x2 = LV_MIN(tile_coords.x1 + LV_IMG_TILE_SIZE - 1, coords->x2);
+            tile_coords.y2 = LV_MIN(tile_coords.y1 + LV_IMG_TILE_SIZE - 1, coords->y2);
+
+            lv_area_t tile_clip;
+            if(!_lv_area_intersect(&tile_clip, &clip_com, &tile_coords)) continue;
+            draw_ctx->clip_area = &tile_clip;
+
+            const lv_img_tile_t * tile = _lv_img_tile_cache_get(dec_dsc, col, row);
+            if(tile == NULL) {
+                /*E.g. the tiles don't fit into the cache. Draw the image line by line*/
+                if(!drawn) {
+                    draw_ctx->clip_area = clip_area_ori;
+                    return false;
+                }
+
+                /*Don't leave a hole in the image. The other tiles are drawn already, so draw only this one*/
+                if(draw_lines(draw_ctx, draw_dsc, coords, sup, dec_dsc) != LV_RES_OK) {
+                    draw_ctx->clip_area = clip_area_ori;
+                    return true;
+                }
+                continue;
+            }
+            drawn = true;
+
+            lv_draw_img_decoded(draw_ctx, draw_dsc, &tile_coords, tile->data, sup, cf);
+            /*The next tile might evict this one*/
+            lv_draw_wait_for_finish(draw_ctx);
+        }
+    }
+
+    draw_ctx->clip_area = clip_area_ori;
+    return true;
+}
+
+/**
+ * Draw a rotated or zoomed image from tiles. The tiles are not transformed one by one, as the interpolation
+ * and anti-aliasing on their edges would leave seams. Instead the clip area is drawn in bands and the part of
+ * the image needed for a band is copied from the tiles into one buffer which is transformed at once.
+ * @return true: the image is drawn; false: the image can't be drawn by tiles and nothing was drawn
+ */
+static bool draw_tiles_transformed(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * draw_dsc,
+                                   const lv_area_t * coords, const lv_draw_img_sup_t * sup, lv_img_decoder_dsc_t * dec_dsc)
+{
+    lv_color_format_t cf = dec_dsc->header.cf;
+    uint32_t px_size = lv_color_format_get_size(cf);
+
+    lv_area_t area_rot;
+    _lv_img_buf_get_transformed_area(&area_rot, lv_area_get_width(coords), lv_area_get_height(coords), draw_dsc->angle,
+                                     draw_dsc->zoom, &draw_dsc->pivot);
+    lv_area_move(&area_rot, coords->x1, coords->y1);
+
+    lv_area_t clip_com;
+    if(!_lv_area_intersect(&clip_com, draw_ctx->clip_area, &area_rot)) return true;
+
+    /*Use bands whose part of the image is about as large as a few tiles*/
+    lv_area_t img_area;
+    lv_coord_t band_h = lv_area_get_height(&clip_com);
+    if(get_tiles_src_area(draw_dsc, coords, &clip_com, &img_area)) {
+        uint32_t size_max = LV_IMG_TILE_SIZE * LV_IMG_TILE_SIZE * 4;
+        uint32_t size = lv_area_get_size(&img_area);
+        if(size > size_max) band_h = LV_MAX(1, (lv_coord_t)((uint64_t)band_h * size_max / size));
+    }
+
+    const lv_area_t * clip_area_ori = draw_ctx->clip_area;
+    uint8_t * buf = NULL;
+    uint32_t buf_size = 0;
+    bool drawn = false;
+    lv_area_t band = clip_com;
+    for(band.y1 = clip_com.y1; band.y1 <= clip_com.y2; band.y1 += band_h) {
+        band.y2 = LV_MIN(band.y1 + band_h - 1, clip_com.y2);
+        if(!get_tiles_src_area(draw_dsc, coords, &band, &img_area)) continue;
+
+        /*Collect the needed part of the image from the tiles*/
+        bool ok = true;
+        uint32_t size = lv_area_get_size(&img_area) * px_size;
+        if(size > buf_size) {
+            lv_free(buf);
+            buf = lv_malloc(size);
+            LV_ASSERT_MALLOC(buf);
+            buf_size = buf ? size : 0;
+            if(buf == NULL) ok = false;
+        }
+
+        lv_coord_t img_w = lv_area_get_width(&img_area);
+        lv_coord_t row;
+        lv_coord_t col;
+        for(row = img_area.y1 / LV_IMG_TILE_SIZE; ok && row <= img_area.y2 / LV_IMG_TILE_SIZE; row++) {
+            for(col = img_area.x1 / LV_IMG_TILE_SIZE; col <= img_area.x2 / LV_IMG_TILE_SIZE; col++) {
+                const lv_img_tile_t * tile = _lv_img_tile_cache_get(dec_dsc, col, row);
+                if(tile == NULL) {
+                    ok = false;
+                    break;
+                }
+
+                lv_area_t com;
+                _lv_area_intersect(&com, &img_area, &tile->area);
+                uint32_t tile_w = lv_area_get_width(&tile->area);
+                uint32_t len = lv_area_get_width(&com) * px_size;
+                lv_coord_t y;
+                for(y = com.y1; y <= com.y2; y++) {
+                    lv_memcpy(buf + ((y - img_area.y1) * img_w + com.x1 - img_area.x1) * px_size,
+                              tile->data + ((y - tile->area.y1) * tile_w + com.x1 - tile->area.x1) * px_size, len);
+                }
+            }
+        }
+
+        draw_ctx->clip_area = &band;
+        if(!ok) {
+            /*E.g. the tiles don't fit into the cache. Draw the image line by line*/
+            if(!drawn) {
+                lv_free(buf);
+                draw_ctx->clip_area = clip_area_ori;
+                return false;
+            }
+
+            /*Don't leave a hole in the image. The other bands are drawn already, so draw only this one*/
+            if(draw_lines(draw_ctx, draw_dsc, coords, sup, dec_dsc) != LV_RES_OK) break;
+            continue;
+        }
+        drawn = true;
+
+        /*Draw the part of the image with the pivot shifted accordingly*/
+        lv_draw_img_dsc_t band_dsc;
+        lv_memcpy(&band_dsc, draw_dsc, sizeof(lv_draw_img_dsc_t));
+        band_dsc.pivot.x = draw_dsc->pivot.x - img_area.x1;
+        band_dsc.pivot.y = draw_dsc->pivot.y - img_area.y1;
+
+        lv_area_t band_coords = img_area;
+        lv_area_move(&band_coords, coords->x1, coords->y1);
+        lv_draw_img_decoded(draw_ctx, &band_dsc, &band_coords, buf, sup, cf);
+        /*The buffer is reused for the next band*/
+        lv_draw_wait_for_finish(draw_ctx);
+    }
+
+    lv_free(buf);
+    draw_ctx->clip_area = clip_area_ori;
+    return true;
+}
+
+/**
+ * Get the part of a transformed image which is needed to draw an area of the screen.
+ * @param draw_dsc      the transformation
+ * @param coords        the coordinates of the not transformed image
+ * @param area          an area on the screen
+ * @param img_area      store the part of the image here, relative to the image
+ * @return              false: no part of the image is needed
+ */
+static bool get_tiles_src_area(const lv_draw_img_dsc_t * draw_dsc, const lv_area_t * coords, const lv_area_t * area,
+                               lv_area_t * img_area)
+{
+    /*Transform the area back to the image with the inverse transformation*/
+    lv_point_t pivot;
+    pivot.x = draw_dsc->pivot.x - (area->x1 - coords->x1);
+    pivot.y = draw_dsc->pivot.y - (area->y1 - coords->y1);
+    uint32_t zoom_inv = ((uint32_t)LV_ZOOM_NONE * LV_ZOOM_NONE) / LV_MAX(draw_dsc->zoom, 1);
+    _lv_img_buf_get_transformed_area(img_area, lv_area_get_width(area), lv_area_get_height(area),
+                                     -draw_dsc->angle, LV_MIN(zoom_inv, UINT16_MAX), &pivot);
+    lv_area_move(img_area, area->x1 - coords->x1, area->y1 - coords->y1);
+    /*Add the neighbor pixels used for interpolation and the rounding errors*/
+    lv_area_increase(img_area, 2, 2);
+
+    lv_area_t full;
+    lv_area_set(&full, 0, 0, lv_area_get_width(coords) - 1, lv_area_get_height(coords) - 1);
+    return _lv_area_intersect(img_area, img_area, &full);
+}
+#endif
+
 static void draw_cleanup(_lv_img_cache_entry_t * cache)
 {
     /*Automatically close images with no caching*/
@@ -52,6 +52,7 @@ typedef struct {
 
     int32_t frame_id;
     uint16_t antialias      : 1;
+    uint16_t transform_cache : 1;   /*Keep the transformed image in the transform cache (if enabled)*/
     lv_draw_img_sup_t * sup;
 } lv_draw_img_dsc_t;
 
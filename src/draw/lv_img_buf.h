@@ -53,7 +53,8 @@ typedef struct {
 
     uint32_t h : 11; /*Height of the image map*/
     uint32_t w : 11; /*Width of the image map*/
-    uint32_t reserved : 2; /*Reserved to be used later*/
+    uint32_t reserved : 1; /*Reserved to be used later*/
+    uint32_t compressed : 1; /*1: the rows are RLE compressed. See `lv_img_decoder_built_in_open()`*/
     uint32_t always_zero : 3; /*It the upper bits of the first byte. Always zero to look like a
                                  non-printable character*/
     uint32_t cf : 5;          /*Color format: See `lv_color_format_t`*/
@@ -66,8 +67,8 @@ typedef struct {
     uint32_t always_zero : 3; /*It the upper bits of the first byte. Always zero to look like a
                                  non-printable character*/
 
+    uint32_t compressed : 1; /*1: the rows are RLE compressed. See `lv_img_decoder_built_in_open()`*/
     uint32_t reserved : 1; /*Reserved to be used later*/
-    uint32_t chroma_keyed : 2; /*Reserved to be used later*/
 
     uint32_t w : 11; /*Width of the image map*/
     uint32_t h : 11; /*Height of the image map*/
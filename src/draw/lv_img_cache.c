@@ -7,6 +7,11 @@
  *      INCLUDES
  *********************/
 #include "lv_img_cache.h"
+#include "lv_draw_img.h"
+#include "lv_img_transform_cache.h"
+#include "lv_img_tile_cache.h"
+#include "../core/lv_refr.h"
+#include "../core/lv_disp.h"
 
 /*********************
  *      DEFINES
@@ -52,16 +57,111 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
     return img_cache_manager.open_cb(src, color, frame_id);
 }
 
+void _lv_img_cache_add_redraw_area(_lv_img_cache_entry_t * entry, const lv_area_t * area)
+{
+    LV_ASSERT_NULL(entry);
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    if(disp == NULL) return;
+
+    if(!entry->redraw_area_set) {
+        lv_area_copy(&entry->redraw_area, area);
+        entry->redraw_disp = disp;
+        entry->redraw_area_set = 1;
+    }
+    else if(entry->redraw_disp == disp) {
+        _lv_area_join(&entry->redraw_area, &entry->redraw_area, area);
+    }
+    else {
+        entry->redraw_all = 1;
+    }
+}
+
+void _lv_img_cache_wait(_lv_img_cache_entry_t * entry)
+{
+    LV_ASSERT_NULL(entry);
+    if(img_cache_manager.wait_cb == NULL || !entry->decoding) return;
+    img_cache_manager.wait_cb(entry);
+}
+
+void _lv_img_cache_redraw(_lv_img_cache_entry_t * entry)
+{
+    LV_ASSERT_NULL(entry);
+    if(!entry->redraw_area_set) return;
+
+    /*The display might have been removed since then, so check if it still exists*/
+    lv_disp_t * disp = lv_disp_get_next(NULL);
+    while(disp) {
+        if(entry->redraw_all) lv_obj_invalidate(lv_disp_get_scr_act(disp));
+        else if(disp == entry->redraw_disp) _lv_inv_area(disp, &entry->redraw_area);
+        disp = lv_disp_get_next(disp);
+    }
+
+    entry->redraw_area_set = 0;
+    entry->redraw_all = 0;
+    entry->redraw_disp = NULL;
+}
+
+void _lv_img_cache_add_mem_size(_lv_img_cache_entry_t * entry, uint32_t size)
+{
+    LV_ASSERT_NULL(entry);
+    if(img_cache_manager.add_mem_size_cb == NULL || size == 0) return;
+    img_cache_manager.add_mem_size_cb(entry, size);
+}
+
+void lv_img_cache_prefetch(const void * src)
+{
+    LV_ASSERT_NULL(src);
+    lv_draw_img_dsc_t dsc;
+    lv_draw_img_dsc_init(&dsc);
+    _lv_img_cache_open(src, dsc.recolor, 0);
+}
+
+void lv_img_cache_set_async(bool en)
+{
+    if(img_cache_manager.set_async_cb == NULL) {
+        LV_LOG_WARN("not supported by the image cache manager");
+        return;
+    }
+    img_cache_manager.set_async_cb(en);
+}
+
 void lv_img_cache_set_size(uint16_t new_entry_cnt)
 {
     LV_ASSERT_NULL(img_cache_manager.set_size_cb);
     img_cache_manager.set_size_cb(new_entry_cnt);
 }
 
+void lv_img_cache_set_mem_size(uint32_t mem_size)
+{
+    if(img_cache_manager.set_mem_size_cb == NULL) {
+        LV_LOG_WARN("not supported by the image cache manager");
+        return;
+    }
+    img_cache_manager.set_mem_size_cb(mem_size);
+}
+
+void lv_img_cache_get_stats(lv_img_cache_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+    if(img_cache_manager.get_stats_cb == NULL) {
+        lv_memzero(stats, sizeof(lv_img_cache_stats_t));
+        return;
+    }
+    img_cache_manager.get_stats_cb(stats);
+}
+
 void lv_img_cache_invalidate_src(const void * src)
 {
     LV_ASSERT_NULL(img_cache_manager.invalidate_src_cb);
     img_cache_manager.invalidate_src_cb(src);
+
+#if LV_USE_IMG_TRANSFORM_CACHE
+    lv_img_transform_cache_invalidate_src(src);
+#endif
+
+#if LV_USE_IMG_TILE_CACHE
+    lv_img_tile_cache_invalidate_src(src);
+#endif
 }
 
 /**********************
@@ -31,12 +31,43 @@ extern "C" {
 typedef struct {
     lv_img_decoder_dsc_t dec_dsc; /**< Image information*/
     void * user_data; /**< Image cache entry user data*/
+
+    /** 1: the image is being decoded in the background and `dec_dsc` can't be used yet.
+     * Only `dec_dsc.src`, `color` and `frame_id` are set.*/
+    uint8_t decoding : 1;
+
+    /** 1: `redraw_area` is set on `redraw_disp`*/
+    uint8_t redraw_area_set : 1;
+
+    /** 1: the image was drawn on more displays, redraw all of them when the decoding is ready*/
+    uint8_t redraw_all : 1;
+
+    /** The area where the image should have been drawn while it was being decoded*/
+    lv_area_t redraw_area;
+    struct _lv_disp_t * redraw_disp;
 } _lv_img_cache_entry_t;
 
+/**
+ * Statistics of the image cache
+ */
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of opens served from the cache*/
+    uint32_t miss_cnt;      /**< Number of opens when the image needed to be opened by a decoder*/
+    uint32_t evict_cnt;     /**< Number of images closed to make room for new ones*/
+    uint32_t entry_cnt;     /**< Number of cached images*/
+    uint32_t mem_size;      /**< Memory used by the decoded images in bytes*/
+    uint32_t decoding_cnt;  /**< Number of images being decoded in the background*/
+} lv_img_cache_stats_t;
+
 typedef struct {
     _lv_img_cache_entry_t * (*open_cb)(const void * src, lv_color_t color, int32_t frame_id);
     void (*set_size_cb)(uint16_t new_entry_cnt);
     void (*invalidate_src_cb)(const void * src);
+    void (*set_mem_size_cb)(uint32_t mem_size);                 /**< Optional*/
+    void (*get_stats_cb)(lv_img_cache_stats_t * stats);         /**< Optional*/
+    void (*set_async_cb)(bool en);                              /**< Optional*/
+    void (*add_mem_size_cb)(_lv_img_cache_entry_t * entry, uint32_t size);  /**< Optional*/
+    void (*wait_cb)(_lv_img_cache_entry_t * entry);             /**< Optional*/
 } lv_img_cache_manager_t;
 
 /**********************
@@ -62,10 +93,59 @@ void lv_img_cache_manager_apply(const lv_img_cache_manager_t * manager);
  * @param src source of the image. Path to file or pointer to an `lv_img_dsc_t` variable
  * @param color The color of the image with `LV_IMG_CF_ALPHA_...`
  * @param frame_id the index of the frame. Used only with animated images, set 0 for normal images
- * @return pointer to the cache entry or NULL if can open the image
+ * @return pointer to the cache entry or NULL if can open the image.
+ *         If `decoding` is set in the entry the image is not ready yet, see `_lv_img_cache_add_redraw_area()`.
  */
 _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, int32_t frame_id);
 
+/**
+ * Remember an area where an image being decoded should have been drawn.
+ * The area will be invalidated on the display being refreshed now when the image is decoded.
+ * Use it only while rendering a display, else see `_lv_img_cache_wait()`.
+ * @param entry     pointer to a cache entry with `decoding == 1`
+ * @param area      the area to redraw, typically the clip area of the image
+ */
+void _lv_img_cache_add_redraw_area(_lv_img_cache_entry_t * entry, const lv_area_t * area);
+
+/**
+ * Wait until an image being decoded in the background is ready.
+ * Used when the image can't be redrawn later, e.g. when it's drawn to a canvas or a snapshot.
+ * If the cache manager doesn't support it `decoding` remains set.
+ * @param entry     pointer to a cache entry with `decoding == 1`
+ */
+void _lv_img_cache_wait(_lv_img_cache_entry_t * entry);
+
+/**
+ * Invalidate the areas collected by `_lv_img_cache_add_redraw_area()`.
+ * Cache managers should call it when an image is decoded in the background.
+ * @param entry     pointer to a cache entry
+ */
+void _lv_img_cache_redraw(_lv_img_cache_entry_t * entry);
+
+/**
+ * Charge memory allocated later for a cached image (e.g. its mipmaps) to its entry.
+ * The least recently used images are closed if the memory limit is exceeded.
+ * The memory is released when the entry is closed.
+ * @param entry     pointer to a cache entry
+ * @param size      the allocated size in bytes
+ */
+void _lv_img_cache_add_mem_size(_lv_img_cache_entry_t * entry, uint32_t size);
+
+/**
+ * Open and cache an image before it's drawn, e.g. to prepare the images of the next screen.
+ * If async decoding is enabled it returns immediately and the image is decoded in the background.
+ * @param src       source of the image. Path to file or pointer to an `lv_img_dsc_t` variable
+ */
+void lv_img_cache_prefetch(const void * src);
+
+/**
+ * Enable or disable decoding the not cached images in a worker thread.
+ * While an image is being decoded nothing is drawn in its place and it's redrawn when it's ready.
+ * Works only if the cache manager supports it and worker threads are available (`LV_USE_OS`).
+ * @param en        true: decode in the background; false: decode when the image is drawn
+ */
+void lv_img_cache_set_async(bool en);
+
 /**
  * Set the number of images to be cached.
  * More cached images mean more opened image at same time which might mean more memory usage.
@@ -74,6 +154,21 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
  */
 void lv_img_cache_set_size(uint16_t new_entry_cnt);
 
+/**
+ * Limit the memory used by the decoded images in the cache.
+ * If a new image doesn't fit the least recently used images are closed.
+ * Images which are used directly from a variable (e.g. `lv_img_dsc_t` in RGB format)
+ * are not counted as they don't need extra memory.
+ * @param mem_size  the maximal size of the decoded images in bytes, 0: no limit
+ */
+void lv_img_cache_set_mem_size(uint32_t mem_size);
+
+/**
+ * Get the statistics of the image cache.
+ * @param stats     the statistics will be copied here. All zero if the cache manager doesn't support it.
+ */
+void lv_img_cache_get_stats(lv_img_cache_stats_t * stats);
+
 /**
  * Invalidate an image source in the cache.
  * Useful if the image source is updated therefore it needs to be cached again.
@@ -13,31 +13,50 @@
 #include "../hal/lv_hal_tick.h"
 #include "../misc/lv_assert.h"
 #include "../misc/lv_gc.h"
+#include "../misc/lv_worker.h"
 
 /*********************
  *      DEFINES
  *********************/
 
-/** Count the cache entries's life. Add `time_to_open` to `life` when the entry is used.
- * Decrement all lifes by one every in every ::lv_img_cache_open.
- * If life == 0 the entry can be reused*/
-#define CACHE_GET_LIFE(entry) ((lv_intptr_t)((entry)->user_data))
-#define CACHE_SET_LIFE(entry, v) ((entry)->user_data = (void*)((lv_intptr_t)(v)))
+/*Marks the end of the lists*/
+#define NODE_NONE   0xFFFF
 
-/*Decrement life with this value on every open*/
-#define LV_IMG_CACHE_AGING 1
+/*When an entry needs to be freed check this many least recently used entries
+ *and close the one which was the fastest to open*/
+#define LV_IMG_CACHE_EVICT_SCAN 4
 
-/*Boost life by this factor (multiply time_to_open with this value)*/
-#define LV_IMG_CACHE_LIFE_GAIN 1
-
-/*Don't let life to be greater than this limit because it would require a lot of time to
- * "die" from very high values*/
-#define LV_IMG_CACHE_LIFE_LIMIT 1000
+/*Try to decode an image again this long after its async decoding failed [ms]*/
+#define LV_IMG_CACHE_RETRY_TIME 1000
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+/*An image being decoded in a worker thread*/
+typedef struct {
+    lv_worker_job_t job;
+    lv_img_decoder_dsc_t dsc;       /*Opened by the worker thread*/
+    lv_img_decoder_t * decoder;     /*A thread safe decoder which recognized the image*/
+    const void * src;               /*Copy of the path or the address of the variable*/
+    lv_color_t color;
+    int32_t frame_id;
+    lv_res_t res;
+    uint16_t node_id;
+    bool cancelled;                 /*The node was closed while decoding, just drop the result*/
+} decode_job_t;
+
+typedef struct {
+    _lv_img_cache_entry_t entry;    /*Returned to the user, so it needs to be the first*/
+    decode_job_t * job;             /*Set while `entry.decoding == 1`*/
+    uint32_t hash;
+    uint32_t mem_size;              /*Size of the decoded image data in bytes*/
+    uint32_t fail_time;             /*When the async decoding failed*/
+    uint16_t prev;                  /*Previous (more recently used) node in the LRU list*/
+    uint16_t next;                  /*Next (less recently used) node in the LRU list or next free node*/
+    uint16_t hash_next;             /*Next node in the same hash bucket*/
+} cache_node_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -45,9 +64,25 @@
 static _lv_img_cache_entry_t * _lv_img_cache_open_builtin(const void * src, lv_color_t color, int32_t frame_id);
 static void lv_img_cache_set_size_builtin(uint16_t new_entry_cnt);
 static void lv_img_cache_invalidate_src_builtin(const void * src);
+static void lv_img_cache_set_mem_size_builtin(uint32_t mem_size);
+static void lv_img_cache_get_stats_builtin(lv_img_cache_stats_t * stats);
+static void lv_img_cache_set_async_builtin(bool en);
+static void lv_img_cache_add_mem_size_builtin(_lv_img_cache_entry_t * entry, uint32_t size);
+static void lv_img_cache_wait_builtin(_lv_img_cache_entry_t * entry);
 
 #if LV_IMG_CACHE_DEF_SIZE
     static bool lv_img_cache_match(const void * src1, const void * src2);
+    static uint32_t get_hash(const void * src, lv_color_t color, int32_t frame_id);
+    static uint32_t get_mem_size(const lv_img_decoder_dsc_t * dsc);
+    static void lru_unlink(cache_node_t * nodes, uint16_t id);
+    static void lru_add_head(cache_node_t * nodes, uint16_t id);
+    static void bucket_unlink(cache_node_t * nodes, uint16_t id);
+    static void node_close(cache_node_t * nodes, uint16_t id);
+    static bool evict(cache_node_t * nodes);
+    static bool decode_async_start(cache_node_t * nodes, uint16_t id, const void * src, lv_color_t color,
+                                   int32_t frame_id);
+    static void decode_exec_cb(lv_worker_job_t * job);
+    static void decode_ready_cb(lv_worker_job_t * job);
 #endif
 
 /**********************
@@ -55,12 +90,22 @@ static void lv_img_cache_invalidate_src_builtin(const void * src);
  **********************/
 #if LV_IMG_CACHE_DEF_SIZE
     static uint16_t entry_cnt;
+    static uint16_t bucket_cnt;     /*Always a power of 2*/
+    static uint16_t * buckets;      /*Stored after the nodes in `_lv_img_cache_array`*/
+    static uint16_t lru_head;       /*Most recently used node*/
+    static uint16_t lru_tail;       /*Least recently used node*/
+    static uint16_t free_head;
+    static uint32_t mem_size_max = LV_IMG_CACHE_DEF_MEM_SIZE;
+    static bool async_en = LV_IMG_CACHE_ASYNC;
+    static lv_img_cache_stats_t stats;
 #endif
 
 /**********************
  *      MACROS
  **********************/
 
+#define GET_NODES() ((cache_node_t *)LV_GC_ROOT(_lv_img_cache_array))
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -76,6 +121,11 @@ void _lv_img_cache_builtin_init(void)
     manager.open_cb = _lv_img_cache_open_builtin;
     manager.set_size_cb = lv_img_cache_set_size_builtin;
     manager.invalidate_src_cb = lv_img_cache_invalidate_src_builtin;
+    manager.set_mem_size_cb = lv_img_cache_set_mem_size_builtin;
+    manager.get_stats_cb = lv_img_cache_get_stats_builtin;
+    manager.set_async_cb = lv_img_cache_set_async_builtin;
+    manager.add_mem_size_cb = lv_img_cache_add_mem_size_builtin;
+    manager.wait_cb = lv_img_cache_wait_builtin;
     lv_img_cache_manager_apply(&manager);
 }
 
@@ -86,84 +136,116 @@ void _lv_img_cache_builtin_init(void)
 /**
  * Open an image using the image decoder interface and cache it.
  * The image will be left open meaning if the image decoder open callback allocated memory then it will remain.
- * The image is closed if a new image is opened and the new image takes its place in the cache.
+ * The least recently used images are closed if there is no free entry or
+ * the decoded images would use more memory than allowed.
+ * In async mode the image might be returned with `decoding == 1` and decoded in a worker thread.
  * @param src source of the image. Path to file or pointer to an `lv_img_dsc_t` variable
  * @param color color The color of the image with `LV_IMG_CF_ALPHA_...`
  * @return pointer to the cache entry or NULL if can open the image
  */
 static _lv_img_cache_entry_t * _lv_img_cache_open_builtin(const void * src, lv_color_t color, int32_t frame_id)
 {
-    /*Is the image cached?*/
-    _lv_img_cache_entry_t * cached_src = NULL;
-
 #if LV_IMG_CACHE_DEF_SIZE
     if(entry_cnt == 0) {
         LV_LOG_WARN("the cache size is 0");
         return NULL;
     }
 
-    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    cache_node_t * nodes = GET_NODES();
 
-    /*Decrement all lifes. Make the entries older*/
-    uint16_t i;
-    for(i = 0; i < entry_cnt; i++) {
-        int32_t life = CACHE_GET_LIFE(&cache[i]);
-        if(life > INT32_MIN + LV_IMG_CACHE_AGING) {
-            CACHE_SET_LIFE(&cache[i], life - LV_IMG_CACHE_AGING);
-        }
-    }
+    /*Is the image cached?*/
+    uint32_t hash = get_hash(src, color, frame_id);
+    uint16_t id;
+    for(id = buckets[hash & (bucket_cnt - 1)]; id != NODE_NONE; id = nodes[id].hash_next) {
+        lv_img_decoder_dsc_t * dsc = &nodes[id].entry.dec_dsc;
+        if(nodes[id].hash == hash && lv_color_eq(color, dsc->color) && frame_id == dsc->frame_id &&
+           lv_img_cache_match(src, dsc->src)) {
+            /*Drop a failed image after a while to try again (e.g. the file wasn't written completely)*/
+            if(!nodes[id].entry.decoding && dsc->decoder == NULL &&
+               lv_tick_elaps(nodes[id].fail_time) >= LV_IMG_CACHE_RETRY_TIME) {
+                node_close(nodes, id);
+                break;
+            }
 
-    for(i = 0; i < entry_cnt; i++) {
-        if(lv_color_eq(color, cache[i].dec_dsc.color) &&
-           frame_id == cache[i].dec_dsc.frame_id &&
-           lv_img_cache_match(src, cache[i].dec_dsc.src)) {
-            /*If opened increment its life.
-             *Image difficult to open should live longer to keep avoid frequent their recaching.
-             *Therefore increase `life` with `time_to_open`*/
-            cached_src = &cache[i];
-            int32_t life = CACHE_GET_LIFE(cached_src);
-            CACHE_SET_LIFE(cached_src, life + cached_src->dec_dsc.time_to_open * LV_IMG_CACHE_LIFE_GAIN);
-            if(CACHE_GET_LIFE(cached_src) > LV_IMG_CACHE_LIFE_LIMIT) CACHE_SET_LIFE(cached_src, LV_IMG_CACHE_LIFE_LIMIT);
+            /*Make it the most recently used*/
+            lru_unlink(nodes, id);
+            lru_add_head(nodes, id);
+            stats.hit_cnt++;
             LV_LOG_TRACE("image source found in the cache");
-            break;
+            return &nodes[id].entry;
         }
     }
 
-    /*The image is not cached then cache it now*/
-    if(cached_src) return cached_src;
+    stats.miss_cnt++;
 
-    /*Find an entry to reuse. Select the entry with the least life*/
-    cached_src = &cache[0];
-    for(i = 1; i < entry_cnt; i++) {
-        if(CACHE_GET_LIFE(&cache[i]) < CACHE_GET_LIFE(cached_src)) {
-            cached_src = &cache[i];
+    /*The image is not cached then cache it now*/
+    if(free_head == NODE_NONE) {
+        /*All the entries can be busy with decoding*/
+        if(!evict(nodes)) {
+            LV_LOG_WARN("no free entry in the image cache");
+            return NULL;
         }
-    }
-
-    /*Close the decoder to reuse if it was opened (has a valid source)*/
-    if(cached_src->dec_dsc.src) {
-        lv_img_decoder_close(&cached_src->dec_dsc);
         LV_LOG_INFO("image draw: cache miss, close and reuse an entry");
     }
     else {
         LV_LOG_INFO("image draw: cache miss, cached to an empty entry");
     }
-#else
-    cached_src = &LV_GC_ROOT(_lv_img_cache_single);
-#endif
+
+    id = free_head;
+    cache_node_t * node = &nodes[id];
+    free_head = node->next;
+    node->hash = hash;
+
+    if(decode_async_start(nodes, id, src, color, frame_id)) {
+        return &node->entry;
+    }
+
     /*Open the image and measure the time to open*/
     uint32_t t_start  = lv_tick_get();
+    lv_res_t open_res = lv_img_decoder_open(&node->entry.dec_dsc, src, color, frame_id);
+    if(open_res == LV_RES_INV) {
+        LV_LOG_WARN("Image draw cannot open the image resource");
+        lv_memzero(&node->entry, sizeof(_lv_img_cache_entry_t));
+        node->next = free_head;
+        free_head = id;
+        return NULL;
+    }
+
+    /*If `time_to_open` was not set in the open function set it here*/
+    if(node->entry.dec_dsc.time_to_open == 0) {
+        node->entry.dec_dsc.time_to_open = lv_tick_elaps(t_start);
+    }
+
+    if(node->entry.dec_dsc.time_to_open == 0) node->entry.dec_dsc.time_to_open = 1;
+
+    /*Make room for the decoded image. It's cached even if it's larger than the limit
+     *as it's required to draw it now.*/
+    node->mem_size = get_mem_size(&node->entry.dec_dsc);
+    if(mem_size_max) {
+        while(stats.mem_size + node->mem_size > mem_size_max) {
+            if(!evict(nodes)) break;
+        }
+    }
+
+    stats.mem_size += node->mem_size;
+    stats.entry_cnt++;
+
+    lru_add_head(nodes, id);
+    uint32_t b = hash & (bucket_cnt - 1);
+    node->hash_next = buckets[b];
+    buckets[b] = id;
+
+    return &node->entry;
+#else
+    _lv_img_cache_entry_t * cached_src = &LV_GC_ROOT(_lv_img_cache_single);
+    uint32_t t_start  = lv_tick_get();
     lv_res_t open_res = lv_img_decoder_open(&cached_src->dec_dsc, src, color, frame_id);
     if(open_res == LV_RES_INV) {
         LV_LOG_WARN("Image draw cannot open the image resource");
         lv_memzero(cached_src, sizeof(_lv_img_cache_entry_t));
-        CACHE_SET_LIFE(cached_src, INT32_MIN); /*Make the empty entry very "weak" to force its us*/
         return NULL;
     }
 
-    CACHE_SET_LIFE(cached_src, 0);
-
-    /*If `time_to_open` was not set in the open function set it here*/
     if(cached_src->dec_dsc.time_to_open == 0) {
         cached_src->dec_dsc.time_to_open = lv_tick_elaps(t_start);
     }
@@ -171,6 +253,7 @@ static _lv_img_cache_entry_t * _lv_img_cache_open_builtin(const void * src, lv_c
     if(cached_src->dec_dsc.time_to_open == 0) cached_src->dec_dsc.time_to_open = 1;
 
     return cached_src;
+#endif
 }
 
 /**
@@ -189,19 +272,43 @@ static void lv_img_cache_set_size_builtin(uint16_t new_entry_cnt)
         /*Clean the cache before free it*/
         lv_img_cache_invalidate_src_builtin(NULL);
         lv_free(LV_GC_ROOT(_lv_img_cache_array));
+        LV_GC_ROOT(_lv_img_cache_array) = NULL;
     }
 
-    /*Reallocate the cache*/
-    LV_GC_ROOT(_lv_img_cache_array) = lv_malloc(sizeof(_lv_img_cache_entry_t) * new_entry_cnt);
-    LV_ASSERT_MALLOC(LV_GC_ROOT(_lv_img_cache_array));
-    if(LV_GC_ROOT(_lv_img_cache_array) == NULL) {
-        entry_cnt = 0;
-        return;
-    }
+    entry_cnt = 0;
+    lru_head = NODE_NONE;
+    lru_tail = NODE_NONE;
+    free_head = NODE_NONE;
+
+    /*`NODE_NONE` can't be a valid index*/
+    if(new_entry_cnt == NODE_NONE) new_entry_cnt--;
+    if(new_entry_cnt == 0) return;
+
+    /*Use about 2 buckets for each entry to have short chains*/
+    uint32_t new_bucket_cnt = 1;
+    while(new_bucket_cnt < (uint32_t)new_entry_cnt * 2 && new_bucket_cnt < 0x8000) new_bucket_cnt <<= 1;
+
+    /*Reallocate the cache. The hash table is stored after the nodes.*/
+    size_t nodes_size = sizeof(cache_node_t) * new_entry_cnt;
+    uint8_t * buf = lv_malloc(nodes_size + sizeof(uint16_t) * new_bucket_cnt);
+    LV_ASSERT_MALLOC(buf);
+    if(buf == NULL) return;
+
+    LV_GC_ROOT(_lv_img_cache_array) = (_lv_img_cache_entry_t *)buf;
     entry_cnt = new_entry_cnt;
+    bucket_cnt = (uint16_t)new_bucket_cnt;
+    buckets = (uint16_t *)(buf + nodes_size);
 
     /*Clean the cache*/
-    lv_memzero(LV_GC_ROOT(_lv_img_cache_array), entry_cnt * sizeof(_lv_img_cache_entry_t));
+    cache_node_t * nodes = GET_NODES();
+    lv_memzero(nodes, nodes_size);
+    lv_memset(buckets, 0xFF, sizeof(uint16_t) * bucket_cnt);   /*All NODE_NONE*/
+
+    uint16_t i;
+    for(i = 0; i < entry_cnt; i++) {
+        nodes[i].next = i + 1 < entry_cnt ? i + 1 : NODE_NONE;
+    }
+    free_head = 0;
 #endif
 }
 
@@ -214,18 +321,118 @@ static void lv_img_cache_invalidate_src_builtin(const void * src)
 {
     LV_UNUSED(src);
 #if LV_IMG_CACHE_DEF_SIZE
-    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    cache_node_t * nodes = GET_NODES();
+    if(nodes == NULL) return;
+
+    /*The entries of a source can have any color and frame_id, so check all of them*/
+    uint16_t id = lru_head;
+    while(id != NODE_NONE) {
+        uint16_t next = nodes[id].next;
+        if(src == NULL || lv_img_cache_match(src, nodes[id].entry.dec_dsc.src)) {
+            node_close(nodes, id);
+        }
+        id = next;
+    }
+#endif
+}
 
-    uint16_t i;
-    for(i = 0; i < entry_cnt; i++) {
-        if(src == NULL || lv_img_cache_match(src, cache[i].dec_dsc.src)) {
-            if(cache[i].dec_dsc.src != NULL) {
-                lv_img_decoder_close(&cache[i].dec_dsc);
-            }
+/**
+ * Limit the memory used by the decoded images.
+ * @param mem_size  the maximal size of the decoded images in bytes or 0 for no limit
+ */
+static void lv_img_cache_set_mem_size_builtin(uint32_t mem_size)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    mem_size_max = mem_size;
+    if(mem_size_max == 0) return;
+
+    cache_node_t * nodes = GET_NODES();
+    if(nodes == NULL) return;
+
+    while(stats.mem_size > mem_size_max) {
+        if(!evict(nodes)) break;
+    }
+#else
+    LV_UNUSED(mem_size);
+#endif
+}
+
+static void lv_img_cache_get_stats_builtin(lv_img_cache_stats_t * stats_out)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    *stats_out = stats;
+#else
+    lv_memzero(stats_out, sizeof(lv_img_cache_stats_t));
+#endif
+}
 
-            lv_memzero(&cache[i], sizeof(_lv_img_cache_entry_t));
+/**
+ * Enable or disable decoding the images in a worker thread.
+ * The images being decoded now are not affected.
+ * @param en    true: enable async decoding
+ */
+static void lv_img_cache_set_async_builtin(bool en)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    if(en && !lv_worker_is_async()) {
+        LV_LOG_WARN("worker threads are not available (LV_USE_OS), the images will be decoded synchronously");
+    }
+    async_en = en;
+#else
+    LV_UNUSED(en);
+    LV_LOG_WARN("async decoding requires LV_IMG_CACHE_DEF_SIZE > 0");
+#endif
+}
+
+/**
+ * Add memory allocated for a cached image later to its node and close other images if the limit is exceeded.
+ * @param entry     pointer to a cache entry
+ * @param size      the allocated size in bytes
+ */
+static void lv_img_cache_add_mem_size_builtin(_lv_img_cache_entry_t * entry, uint32_t size)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    cache_node_t * nodes = GET_NODES();
+    if(nodes == NULL) return;
+
+    /*The entry is the first member of the node*/
+    cache_node_t * node = (cache_node_t *)entry;
+    uint16_t id = (uint16_t)(node - nodes);
+    if(node < nodes || id >= entry_cnt) return;
+
+    node->mem_size += size;
+    stats.mem_size += size;
+
+    /*Make room but don't close the image as it's being drawn*/
+    if(mem_size_max) {
+        lru_unlink(nodes, id);
+        while(stats.mem_size > mem_size_max) {
+            if(!evict(nodes)) break;
         }
+        lru_add_head(nodes, id);
     }
+#else
+    LV_UNUSED(entry);
+    LV_UNUSED(size);
+#endif
+}
+
+/**
+ * Finish decoding an image now: decode it in the LVGL thread if its job hasn't been started yet,
+ * else wait for the worker thread.
+ * @param entry     pointer to a cache entry with `decoding == 1`
+ */
+static void lv_img_cache_wait_builtin(_lv_img_cache_entry_t * entry)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    /*The entry is the first member of the node*/
+    cache_node_t * node = (cache_node_t *)entry;
+    if(!entry->decoding || node->job == NULL) return;
+
+    /*Calls `decode_ready_cb` which stores the result in the node*/
+    lv_worker_finish(&node->job->job);
+#else
+    LV_UNUSED(entry);
 #endif
 }
 
@@ -241,4 +448,274 @@ static bool lv_img_cache_match(const void * src1, const void * src2)
         return false;
     return strcmp(src1, src2) == 0;
 }
+
+/**
+ * Hash the path of files or the address of variables with the color and frame using FNV-1a
+ */
+static uint32_t get_hash(const void * src, lv_color_t color, int32_t frame_id)
+{
+    uint32_t h = 2166136261u;
+
+    if(lv_img_src_get_type(src) == LV_IMG_SRC_VARIABLE) {
+        lv_uintptr_t p = (lv_uintptr_t)src;
+        uint32_t i;
+        for(i = 0; i < sizeof(p); i++) {
+            h = (h ^ (p & 0xFF)) * 16777619u;
+            p >>= 8;
+        }
+    }
+    else {
+        const char * s = src;
+        while(*s) {
+            h = (h ^ (uint8_t) * s) * 16777619u;
+            s++;
+        }
+    }
+
+    h = (h ^ lv_color_to_int(color)) * 16777619u;
+    h = (h ^ (uint32_t)frame_id) * 16777619u;
+    return h;
+}
+
+/**
+ * Get how much memory the decoded image uses.
+ * Variables used directly by the decoder, mapped files and images decoded line by line don't use memory.
+ */
+static uint32_t get_mem_size(const lv_img_decoder_dsc_t * dsc)
+{
+    if(dsc->img_data == NULL || dsc->img_data_mapped) return 0;
+    if(dsc->src_type == LV_IMG_SRC_VARIABLE && dsc->img_data == ((const lv_img_dsc_t *)dsc->src)->data) return 0;
+
+    uint32_t px_size = lv_color_format_get_size(dsc->header.cf);
+    if(px_size == 0) px_size = 1;   /*Formats with less than 1 byte per pixel, just estimate*/
+    return (uint32_t)dsc->header.w * dsc->header.h * px_size;
+}
+
+static void lru_unlink(cache_node_t * nodes, uint16_t id)
+{
+    cache_node_t * node = &nodes[id];
+    if(node->prev != NODE_NONE) nodes[node->prev].next = node->next;
+    else lru_head = node->next;
+
+    if(node->next != NODE_NONE) nodes[node->next].prev = node->prev;
+    else lru_tail = node->prev;
+}
+
+static void lru_add_head(cache_node_t * nodes, uint16_t id)
+{
+    cache_node_t * node = &nodes[id];
+    node->prev = NODE_NONE;
+    node->next = lru_head;
+    if(lru_head != NODE_NONE) nodes[lru_head].prev = id;
+    lru_head = id;
+    if(lru_tail == NODE_NONE) lru_tail = id;
+}
+
+static void bucket_unlink(cache_node_t * nodes, uint16_t id)
+{
+    uint16_t * p = &buckets[nodes[id].hash & (bucket_cnt - 1)];
+    while(*p != NODE_NONE) {
+        if(*p == id) {
+            *p = nodes[id].hash_next;
+            return;
+        }
+        p = &nodes[*p].hash_next;
+    }
+}
+
+/**
+ * Close the image of a used node and put it to the free list
+ */
+static void node_close(cache_node_t * nodes, uint16_t id)
+{
+    cache_node_t * node = &nodes[id];
+    lru_unlink(nodes, id);
+    bucket_unlink(nodes, id);
+
+    if(node->entry.decoding) {
+        /*The worker can't be stopped, so let `decode_ready_cb` free the result*/
+        node->job->cancelled = true;
+        stats.decoding_cnt--;
+    }
+    else if(node->entry.dec_dsc.decoder) {
+        lv_img_decoder_close(&node->entry.dec_dsc);
+    }
+    else if(node->entry.dec_dsc.src_type == LV_IMG_SRC_FILE) {
+        /*Failed async decoding, only the path is stored*/
+        lv_free((void *)node->entry.dec_dsc.src);
+    }
+
+    stats.mem_size -= node->mem_size;
+    stats.entry_cnt--;
+
+    lv_memzero(node, sizeof(cache_node_t));
+    node->next = free_head;
+    free_head = id;
+}
+
+/**
+ * Close one of the least recently used images. From the last few entries
+ * close the one which was the fastest to open as it's the cheapest to open again.
+ * @return false if there was nothing to close
+ */
+static bool evict(cache_node_t * nodes)
+{
+    /*Images being decoded can't be closed*/
+    uint16_t victim = NODE_NONE;
+    uint16_t id = lru_tail;
+    uint32_t i = 0;
+    while(i < LV_IMG_CACHE_EVICT_SCAN && id != NODE_NONE) {
+        if(!nodes[id].entry.decoding) {
+            if(victim == NODE_NONE ||
+               nodes[id].entry.dec_dsc.time_to_open < nodes[victim].entry.dec_dsc.time_to_open) victim = id;
+            i++;
+        }
+        id = nodes[id].prev;
+    }
+
+    if(victim == NODE_NONE) return false;
+
+    node_close(nodes, victim);
+    stats.evict_cnt++;
+    return true;
+}
+
+/**
+ * Start to decode an image in a worker thread if async decoding is enabled.
+ * Images whose data can be used directly (e.g. RGB `lv_img_dsc_t` variables) are opened synchronously
+ * as it's fast. Images of decoders which are not thread safe are opened synchronously too.
+ * @return true: the node is added to the cache with `decoding = 1`; false: open the image synchronously
+ */
+static bool decode_async_start(cache_node_t * nodes, uint16_t id, const void * src, lv_color_t color,
+                               int32_t frame_id)
+{
+    if(!async_en) return false;
+
+    lv_img_src_t src_type = lv_img_src_get_type(src);
+    if(src_type == LV_IMG_SRC_VARIABLE) {
+        lv_color_format_t cf = ((const lv_img_dsc_t *)src)->header.cf;
+        if(cf != LV_COLOR_FORMAT_RAW && cf != LV_COLOR_FORMAT_RAW_ALPHA) return false;
+    }
+    else if(src_type != LV_IMG_SRC_FILE) {
+        return false;
+    }
+
+    if(!lv_worker_is_async()) return false;
+
+    lv_img_decoder_t * decoder = _lv_img_decoder_find(src);
+    if(decoder == NULL || !decoder->thread_safe) return false;
+
+    decode_job_t * job = lv_malloc(sizeof(decode_job_t));
+    LV_ASSERT_MALLOC(job);
+    if(job == NULL) return false;
+    lv_memzero(job, sizeof(decode_job_t));
+
+    if(src_type == LV_IMG_SRC_FILE) {
+        char * path = lv_malloc(lv_strlen(src) + 1);
+        LV_ASSERT_MALLOC(path);
+        if(path == NULL) {
+            lv_free(job);
+            return false;
+        }
+        lv_strcpy(path, src);
+        job->src = path;
+    }
+    else {
+        job->src = src;
+    }
+
+    job->decoder = decoder;
+    job->color = color;
+    job->frame_id = frame_id;
+    job->node_id = id;
+    job->job.exec_cb = decode_exec_cb;
+    job->job.ready_cb = decode_ready_cb;
+
+    /*Add the node to the cache with the keys to find it until it's decoded*/
+    cache_node_t * node = &nodes[id];
+    node->job = job;
+    node->mem_size = 0;
+    node->entry.decoding = 1;
+    node->entry.dec_dsc.src = job->src;
+    node->entry.dec_dsc.src_type = src_type;
+    node->entry.dec_dsc.color = color;
+    node->entry.dec_dsc.frame_id = frame_id;
+
+    stats.entry_cnt++;
+    stats.decoding_cnt++;
+
+    lru_add_head(nodes, id);
+    uint32_t b = node->hash & (bucket_cnt - 1);
+    node->hash_next = buckets[b];
+    buckets[b] = id;
+
+    lv_worker_add(&job->job);
+    return true;
+}
+
+/**
+ * Open the image in a worker thread
+ */
+static void decode_exec_cb(lv_worker_job_t * job)
+{
+    decode_job_t * d = (decode_job_t *)job;
+    uint32_t t_start = lv_tick_get();
+    d->res = _lv_img_decoder_open_with(d->decoder, &d->dsc, d->src, d->color, d->frame_id);
+    if(d->res == LV_RES_OK && d->dsc.time_to_open == 0) {
+        d->dsc.time_to_open = lv_tick_elaps(t_start);
+    }
+    if(d->dsc.time_to_open == 0) d->dsc.time_to_open = 1;
+}
+
+/**
+ * Store the decoded image in its node and redraw it. Called from `lv_timer_handler()`
+ */
+static void decode_ready_cb(lv_worker_job_t * job)
+{
+    decode_job_t * d = (decode_job_t *)job;
+    bool is_file = lv_img_src_get_type(d->src) == LV_IMG_SRC_FILE;
+
+    if(d->cancelled) {
+        if(d->res == LV_RES_OK) lv_img_decoder_close(&d->dsc);
+        if(is_file) lv_free((void *)d->src);
+        lv_free(d);
+        return;
+    }
+
+    cache_node_t * nodes = GET_NODES();
+    cache_node_t * node = &nodes[d->node_id];
+    _lv_img_cache_entry_t * entry = &node->entry;
+
+    entry->decoding = 0;
+    node->job = NULL;
+    stats.decoding_cnt--;
+
+    if(d->res == LV_RES_OK) {
+        /*The decoder stored its own copy of the path*/
+        if(is_file) lv_free((void *)d->src);
+        entry->dec_dsc = d->dsc;
+        node->mem_size = get_mem_size(&entry->dec_dsc);
+
+        /*Make room for it but don't close it before it's drawn*/
+        lru_unlink(nodes, d->node_id);
+        if(mem_size_max) {
+            while(stats.mem_size + node->mem_size > mem_size_max) {
+                if(!evict(nodes)) break;
+            }
+        }
+        lru_add_head(nodes, d->node_id);
+        stats.mem_size += node->mem_size;
+    }
+    else {
+        /*Keep the failed image in the cache for a while to not try to decode it again in every frame.
+         *The node owns the copy of the path.*/
+        LV_LOG_WARN("Image draw cannot open the image resource");
+        entry->dec_dsc.error_msg = "No\ndata";
+        entry->dec_dsc.time_to_open = d->dsc.time_to_open;
+        node->fail_time = lv_tick_get();
+    }
+
+    lv_free(d);
+    _lv_img_cache_redraw(entry);
+}
 #endif
@@ -11,6 +11,7 @@
 #include "../draw/lv_draw_img.h"
 #include "../misc/lv_ll.h"
 #include "../misc/lv_gc.h"
+#include "lv_img_mipmap.h"
 
 /*********************
  *      DEFINES
@@ -24,11 +25,23 @@ typedef struct {
     lv_fs_file_t f;
     lv_color_t * palette;
     lv_opa_t * opa;
+    const void * map;       /*The memory mapped file if the driver supports it*/
+    uint32_t map_size;
+    uint8_t * decompressed; /*The decompressed pixels of a compressed image*/
 } lv_img_decoder_built_in_data_t;
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static lv_res_t dsc_init(lv_img_decoder_dsc_t * dsc, const void * src, lv_color_t color, int32_t frame_id);
+static lv_res_t decoder_try_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc, const void * src);
+static uint32_t get_palette_size(lv_color_format_t cf);
+static void map_file(lv_img_decoder_dsc_t * dsc);
+static lv_res_t open_compressed(lv_img_decoder_dsc_t * dsc);
+static lv_res_t read_compressed(lv_img_decoder_dsc_t * dsc, const lv_area_t * area, uint8_t * buf);
+static lv_res_t decompress_row(const uint8_t * in, uint32_t in_size, uint32_t px_size, uint32_t x, uint32_t len,
+                               uint8_t * out);
+static uint32_t get_row_ofs(const uint8_t * data, lv_coord_t y);
 
 /**********************
  *  STATIC VARIABLES
@@ -61,7 +74,9 @@ void _lv_img_decoder_init(void)
 
     lv_img_decoder_set_info_cb(decoder, lv_img_decoder_built_in_info);
     lv_img_decoder_set_open_cb(decoder, lv_img_decoder_built_in_open);
+    lv_img_decoder_set_read_tile_cb(decoder, lv_img_decoder_built_in_read_tile);
     lv_img_decoder_set_close_cb(decoder, lv_img_decoder_built_in_close);
+    lv_img_decoder_set_thread_safe(decoder, true);
 }
 
 /**
@@ -97,56 +112,16 @@ lv_res_t lv_img_decoder_get_info(const void * src, lv_img_header_t * header)
 
 lv_res_t lv_img_decoder_open(lv_img_decoder_dsc_t * dsc, const void * src, lv_color_t color, int32_t frame_id)
 {
-    lv_memzero(dsc, sizeof(lv_img_decoder_dsc_t));
-
-    if(src == NULL) return LV_RES_INV;
-    lv_img_src_t src_type = lv_img_src_get_type(src);
-    if(src_type == LV_IMG_SRC_VARIABLE) {
-        const lv_img_dsc_t * img_dsc = src;
-        if(img_dsc->data == NULL) return LV_RES_INV;
-    }
-
-    dsc->color    = color;
-    dsc->src_type = src_type;
-    dsc->frame_id = frame_id;
-
-    if(dsc->src_type == LV_IMG_SRC_FILE) {
-        size_t fnlen = lv_strlen(src);
-        dsc->src = lv_malloc(fnlen + 1);
-        LV_ASSERT_MALLOC(dsc->src);
-        if(dsc->src == NULL) {
-            LV_LOG_WARN("out of memory");
-            return LV_RES_INV;
-        }
-        lv_strcpy((char *)dsc->src, src);
-    }
-    else {
-        dsc->src = src;
-    }
+    if(dsc_init(dsc, src, color, frame_id) != LV_RES_OK) return LV_RES_INV;
 
     lv_res_t res = LV_RES_INV;
 
     lv_img_decoder_t * decoder;
     _LV_LL_READ(&LV_GC_ROOT(_lv_img_decoder_ll), decoder) {
-        /*Info and Open callbacks are required*/
-        if(decoder->info_cb == NULL || decoder->open_cb == NULL) continue;
-
-        res = decoder->info_cb(decoder, src, &dsc->header);
-        if(res != LV_RES_OK) continue;
-
-        dsc->decoder = decoder;
-        res = decoder->open_cb(decoder, dsc);
+        res = decoder_try_open(decoder, dsc, src);
 
         /*Opened successfully. It is a good decoder for this image source*/
         if(res == LV_RES_OK) return res;
-
-        /*Prepare for the next loop*/
-        lv_memzero(&dsc->header, sizeof(lv_img_header_t));
-
-        dsc->error_msg = NULL;
-        dsc->img_data  = NULL;
-        dsc->user_data = NULL;
-        dsc->time_to_open = 0;
     }
 
     if(dsc->src_type == LV_IMG_SRC_FILE)
@@ -155,6 +130,33 @@ lv_res_t lv_img_decoder_open(lv_img_decoder_dsc_t * dsc, const void * src, lv_co
     return res;
 }
 
+lv_res_t _lv_img_decoder_open_with(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc, const void * src,
+                                   lv_color_t color, int32_t frame_id)
+{
+    if(dsc_init(dsc, src, color, frame_id) != LV_RES_OK) return LV_RES_INV;
+
+    lv_res_t res = decoder_try_open(decoder, dsc, src);
+    if(res != LV_RES_OK && dsc->src_type == LV_IMG_SRC_FILE) {
+        lv_free((void *)dsc->src);
+    }
+
+    return res;
+}
+
+lv_img_decoder_t * _lv_img_decoder_find(const void * src)
+{
+    if(src == NULL) return NULL;
+
+    lv_img_header_t header;
+    lv_img_decoder_t * decoder;
+    _LV_LL_READ(&LV_GC_ROOT(_lv_img_decoder_ll), decoder) {
+        if(decoder->info_cb == NULL || decoder->open_cb == NULL) continue;
+        if(decoder->info_cb(decoder, src, &header) == LV_RES_OK) return decoder;
+    }
+
+    return NULL;
+}
+
 /**
  * Read a line from an opened image
  * @param dsc pointer to `lv_img_decoder_dsc_t` used in `lv_img_decoder_open`
@@ -167,11 +169,44 @@ lv_res_t lv_img_decoder_open(lv_img_decoder_dsc_t * dsc, const void * src, lv_co
 lv_res_t lv_img_decoder_read_line(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t * buf)
 {
     lv_res_t res = LV_RES_INV;
-    if(dsc->decoder->read_line_cb) res = dsc->decoder->read_line_cb(dsc->decoder, dsc, x, y, len, buf);
+    if(dsc->decoder->read_line_cb) {
+        res = dsc->decoder->read_line_cb(dsc->decoder, dsc, x, y, len, buf);
+    }
+    else if(dsc->decoder->read_tile_cb) {
+        lv_area_t area;
+        lv_area_set(&area, x, y, x + len - 1, y);
+        res = dsc->decoder->read_tile_cb(dsc->decoder, dsc, &area, buf);
+    }
 
     return res;
 }
 
+/**
+ * Read a rectangular area from an opened image.
+ * @param dsc pointer to `lv_img_decoder_dsc_t` used in `lv_img_decoder_open`
+ * @param area the area to read relative to the image
+ * @param buf store the data here
+ * @return LV_RES_OK: success; LV_RES_INV: an error occurred
+ */
+lv_res_t lv_img_decoder_read_tile(lv_img_decoder_dsc_t * dsc, const lv_area_t * area, uint8_t * buf)
+{
+    if(dsc->decoder->read_tile_cb) return dsc->decoder->read_tile_cb(dsc->decoder, dsc, area, buf);
+    if(dsc->decoder->read_line_cb == NULL) return LV_RES_INV;
+
+    uint32_t px_size = lv_color_format_get_size(dsc->header.cf);
+    if(px_size == 0) return LV_RES_INV;
+
+    lv_coord_t w = lv_area_get_width(area);
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_res_t res = dsc->decoder->read_line_cb(dsc->decoder, dsc, area->x1, y, w, buf);
+        if(res != LV_RES_OK) return res;
+        buf += w * px_size;
+    }
+
+    return LV_RES_OK;
+}
+
 /**
  * Close a decoding session
  * @param dsc pointer to `lv_img_decoder_dsc_t` used in `lv_img_decoder_open`
@@ -179,6 +214,9 @@ lv_res_t lv_img_decoder_read_line(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_c
 void lv_img_decoder_close(lv_img_decoder_dsc_t * dsc)
 {
     if(dsc->decoder) {
+#if LV_USE_IMG_MIPMAP
+        _lv_img_mipmap_free(dsc);
+#endif
         if(dsc->decoder->close_cb) dsc->decoder->close_cb(dsc->decoder, dsc);
 
         if(dsc->src_type == LV_IMG_SRC_FILE) {
@@ -244,6 +282,16 @@ void lv_img_decoder_set_read_line_cb(lv_img_decoder_t * decoder, lv_img_decoder_
     decoder->read_line_cb = read_line_cb;
 }
 
+/**
+ * Set a callback to decode a rectangular area of an image
+ * @param decoder pointer to an image decoder
+ * @param read_tile_cb a function to read an area of an image
+ */
+void lv_img_decoder_set_read_tile_cb(lv_img_decoder_t * decoder, lv_img_decoder_read_tile_f_t read_tile_cb)
+{
+    decoder->read_tile_cb = read_tile_cb;
+}
+
 /**
  * Set a callback to close a decoding session. E.g. close files and free other resources.
  * @param decoder pointer to an image decoder
@@ -254,6 +302,16 @@ void lv_img_decoder_set_close_cb(lv_img_decoder_t * decoder, lv_img_decoder_clos
     decoder->close_cb = close_cb;
 }
 
+/**
+ * Tell that the decoder's `info_cb`, `open_cb` and `close_cb` can be called from a worker thread.
+ * @param decoder pointer to an image decoder
+ * @param en true: the decoder is thread safe; false: always call it from the LVGL thread (default)
+ */
+void lv_img_decoder_set_thread_safe(lv_img_decoder_t * decoder, bool en)
+{
+    decoder->thread_safe = en;
+}
+
 /**
  * Get info about a built-in image
  * @param decoder the decoder where this function belongs
@@ -270,6 +328,7 @@ lv_res_t lv_img_decoder_built_in_info(lv_img_decoder_t * decoder, const void * s
         header->w  = ((lv_img_dsc_t *)src)->header.w;
         header->h  = ((lv_img_dsc_t *)src)->header.h;
         header->cf = ((lv_img_dsc_t *)src)->header.cf;
+        header->compressed = ((lv_img_dsc_t *)src)->header.compressed;
     }
     else if(src_type == LV_IMG_SRC_FILE) {
         /*Support only "*.bin" files*/
@@ -338,6 +397,9 @@ lv_res_t lv_img_decoder_built_in_open(lv_img_decoder_t * decoder, lv_img_decoder
 
         lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
         lv_memcpy(&user_data->f, &f, sizeof(f));
+
+        /*Draw the pixels directly from the file if possible*/
+        map_file(dsc);
     }
     else if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
         /*The variables should have valid data*/
@@ -346,27 +408,15 @@ lv_res_t lv_img_decoder_built_in_open(lv_img_decoder_t * decoder, lv_img_decoder
         }
     }
 
+    if(dsc->header.compressed) {
+        return open_compressed(dsc);
+    }
+
     if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
         lv_img_dsc_t * img_dsc = (lv_img_dsc_t *)dsc->src;
         lv_color_format_t cf = img_dsc->header.cf;
         if(cf >= LV_COLOR_FORMAT_I1 && cf <= LV_COLOR_FORMAT_I8) {
-            switch(cf) {
-                case LV_COLOR_FORMAT_I1:
-                    dsc->palette_size = 2;
-                    break;
-                case LV_COLOR_FORMAT_I2:
-                    dsc->palette_size = 4;
-                    break;
-                case LV_COLOR_FORMAT_I4:
-                    dsc->palette_size = 16;
-                    break;
-                case LV_COLOR_FORMAT_I8:
-                    dsc->palette_size = 256;
-                    break;
-                default:
-                    LV_LOG_WARN("Unexpected color format");
-                    return LV_RES_INV;
-            }
+            dsc->palette_size = get_palette_size(cf);
             dsc->img_data = img_dsc->data + sizeof(lv_color32_t) * dsc->palette_size;
             dsc->palette = (const lv_color32_t *)img_dsc->data;
         }
@@ -378,8 +428,7 @@ lv_res_t lv_img_decoder_built_in_open(lv_img_decoder_t * decoder, lv_img_decoder
         return LV_RES_OK;
     }
     else {
-        /*TODO indexed formats needs to be read here*/
-        /*If it's a file it need to be read line by line later*/
+        /*If the file couldn't be mapped it needs to be read line by line later*/
         return LV_RES_OK;
     }
 }
@@ -396,16 +445,435 @@ void lv_img_decoder_built_in_close(lv_img_decoder_t * decoder, lv_img_decoder_ds
     lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
     if(user_data) {
         if(dsc->src_type == LV_IMG_SRC_FILE) {
+            if(user_data->map) lv_fs_munmap(&user_data->f, user_data->map, user_data->map_size);
             lv_fs_close(&user_data->f);
         }
         if(user_data->palette) lv_free(user_data->palette);
         if(user_data->opa) lv_free(user_data->opa);
+        if(user_data->decompressed) lv_free(user_data->decompressed);
 
         lv_free(user_data);
         dsc->user_data = NULL;
     }
 }
 
+/**
+ * Read an area of a built in image. Used for "*.bin" files which couldn't be memory mapped
+ * and for the compressed images which are not decompressed in `open`.
+ * @param decoder pointer to the decoder the function associated with
+ * @param dsc pointer to decoder descriptor
+ * @param area the area to read relative to the image
+ * @param buf store the pixels here
+ * @return LV_RES_OK: the pixels are read; LV_RES_INV: not supported color format or file error
+ */
+lv_res_t lv_img_decoder_built_in_read_tile(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc,
+                                           const lv_area_t * area, uint8_t * buf)
+{
+    LV_UNUSED(decoder);
+
+    /*Only the formats with whole bytes per pixel can be read by area*/
+    lv_color_format_t cf = dsc->header.cf;
+    uint32_t px_size = lv_color_format_get_size(cf);
+    if(px_size == 0 || cf == LV_COLOR_FORMAT_RGB565A8 || get_palette_size(cf)) return LV_RES_INV;
+
+    uint32_t stride = (uint32_t)dsc->header.w * px_size;
+    uint32_t len = (uint32_t)lv_area_get_width(area) * px_size;
+    uint32_t ofs = area->y1 * stride + area->x1 * px_size;
+    lv_coord_t y;
+
+    if(dsc->img_data) {
+        for(y = area->y1; y <= area->y2; y++) {
+            lv_memcpy(buf, dsc->img_data + ofs, len);
+            ofs += stride;
+            buf += len;
+        }
+        return LV_RES_OK;
+    }
+
+    if(dsc->header.compressed) return read_compressed(dsc, area, buf);
+
+    lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
+    if(dsc->src_type != LV_IMG_SRC_FILE || user_data == NULL) return LV_RES_INV;
+
+    ofs += sizeof(lv_img_header_t);
+
+    /*Whole rows are continuous in the file so read them at once*/
+    if(len == stride) {
+        len *= lv_area_get_height(area);
+        uint32_t br;
+        if(lv_fs_seek(&user_data->f, ofs, LV_FS_SEEK_SET) != LV_FS_RES_OK) return LV_RES_INV;
+        if(lv_fs_read(&user_data->f, buf, len, &br) != LV_FS_RES_OK || br != len) return LV_RES_INV;
+        return LV_RES_OK;
+    }
+
+    for(y = area->y1; y <= area->y2; y++) {
+        uint32_t br;
+        if(lv_fs_seek(&user_data->f, ofs, LV_FS_SEEK_SET) != LV_FS_RES_OK) return LV_RES_INV;
+        if(lv_fs_read(&user_data->f, buf, len, &br) != LV_FS_RES_OK || br != len) return LV_RES_INV;
+        ofs += stride;
+        buf += len;
+    }
+
+    return LV_RES_OK;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+/**
+ * Reset a decoder descriptor and store the source in it
+ * @return LV_RES_OK: ready to open; LV_RES_INV: invalid source or out of memory
+ */
+static lv_res_t dsc_init(lv_img_decoder_dsc_t * dsc, const void * src, lv_color_t color, int32_t frame_id)
+{
+    lv_memzero(dsc, sizeof(lv_img_decoder_dsc_t));
+
+    if(src == NULL) return LV_RES_INV;
+    lv_img_src_t src_type = lv_img_src_get_type(src);
+    if(src_type == LV_IMG_SRC_VARIABLE) {
+        const lv_img_dsc_t * img_dsc = src;
+        if(img_dsc->data == NULL) return LV_RES_INV;
+    }
+
+    dsc->color    = color;
+    dsc->src_type = src_type;
+    dsc->frame_id = frame_id;
+
+    if(dsc->src_type == LV_IMG_SRC_FILE) {
+        size_t fnlen = lv_strlen(src);
+        dsc->src = lv_malloc(fnlen + 1);
+        LV_ASSERT_MALLOC(dsc->src);
+        if(dsc->src == NULL) {
+            LV_LOG_WARN("out of memory");
+            return LV_RES_INV;
+        }
+        lv_strcpy((char *)dsc->src, src);
+    }
+    else {
+        dsc->src = src;
+    }
+
+    return LV_RES_OK;
+}
+
+/**
+ * Try to open an image with a decoder
+ * @return LV_RES_OK: opened; LV_RES_INV: the decoder can't open it and `dsc` is prepared for the next decoder
+ */
+static lv_res_t decoder_try_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc, const void * src)
+{
+    /*Info and Open callbacks are required*/
+    if(decoder->info_cb == NULL || decoder->open_cb == NULL) return LV_RES_INV;
+
+    lv_res_t res = decoder->info_cb(decoder, src, &dsc->header);
+    if(res != LV_RES_OK) return res;
+
+    dsc->decoder = decoder;
+    res = decoder->open_cb(decoder, dsc);
+    if(res == LV_RES_OK) return res;
+
+    /*Prepare for the next decoder*/
+    lv_memzero(&dsc->header, sizeof(lv_img_header_t));
+
+    dsc->error_msg = NULL;
+    dsc->img_data  = NULL;
+    dsc->img_data_mapped = false;
+    dsc->user_data = NULL;
+    dsc->time_to_open = 0;
+
+    return res;
+}
+
+static uint32_t get_palette_size(lv_color_format_t cf)
+{
+    switch(cf) {
+        case LV_COLOR_FORMAT_I1:
+            return 2;
+        case LV_COLOR_FORMAT_I2:
+            return 4;
+        case LV_COLOR_FORMAT_I4:
+            return 16;
+        case LV_COLOR_FORMAT_I8:
+            return 256;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * Map an opened "*.bin" file to the memory and point `img_data` (and `palette`) into it.
+ * The pages are read by the OS on demand, so the image is drawn without copying it and without heap usage.
+ * Nothing happens if the driver can't map files or the color format can't be drawn directly.
+ * @param dsc   decoder descriptor of an opened file
+ */
+static void map_file(lv_img_decoder_dsc_t * dsc)
+{
+    lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
+    lv_color_format_t cf = dsc->header.cf;
+    uint32_t palette_size = get_palette_size(cf);
+
+    /*Size of the pixel data*/
+    uint32_t data_size;
+    if(dsc->header.compressed) {
+        /*At least the row offsets*/
+        data_size = ((uint32_t)dsc->header.h + 1) * sizeof(uint32_t);
+    }
+    else if(palette_size) {
+        uint32_t bpp = cf == LV_COLOR_FORMAT_I1 ? 1 : cf == LV_COLOR_FORMAT_I2 ? 2 : cf == LV_COLOR_FORMAT_I4 ? 4 : 8;
+        data_size = palette_size * sizeof(lv_color32_t) + ((dsc->header.w * bpp + 7) >> 3) * dsc->header.h;
+    }
+    else {
+        uint32_t px_size = lv_color_format_get_size(cf);
+        if(px_size == 0 || cf == LV_COLOR_FORMAT_RGB565A8) return;
+        data_size = (uint32_t)dsc->header.w * dsc->header.h * px_size;
+    }
+
+    const void * map;
+    uint32_t map_size;
+    if(lv_fs_mmap(&user_data->f, &map, &map_size) != LV_FS_RES_OK) return;
+
+    if(map_size < sizeof(lv_img_header_t) + data_size) {
+        LV_LOG_WARN("The image file is shorter than expected");
+        lv_fs_munmap(&user_data->f, map, map_size);
+        return;
+    }
+
+    user_data->map = map;
+    user_data->map_size = map_size;
+
+    /*The compressed rows are read from the mapped file when they are decompressed*/
+    if(dsc->header.compressed) return;
+
+    const uint8_t * data = (const uint8_t *)map + sizeof(lv_img_header_t);
+    if(palette_size) {
+        dsc->palette = (const lv_color32_t *)data;
+        dsc->palette_size = palette_size;
+        data += palette_size * sizeof(lv_color32_t);
+    }
+    dsc->img_data = data;
+    dsc->img_data_mapped = true;
+}
+
+/**
+ * Prepare a compressed image for drawing. If images are cached, decompress the whole image as it stays
+ * in the cache, else the rows are decompressed by `lv_img_decoder_built_in_read_tile()` when drawn.
+ * @param dsc   decoder descriptor of an opened compressed image
+ * @return      LV_RES_OK: ready to use; LV_RES_INV: not supported color format or invalid data
+ */
+static lv_res_t open_compressed(lv_img_decoder_dsc_t * dsc)
+{
+    lv_color_format_t cf = dsc->header.cf;
+    uint32_t px_size = lv_color_format_get_size(cf);
+    if(px_size == 0 || cf == LV_COLOR_FORMAT_RGB565A8 || get_palette_size(cf)) {
+        LV_LOG_WARN("The color format of the image can't be compressed");
+        lv_img_decoder_built_in_close(dsc->decoder, dsc);
+        return LV_RES_INV;
+    }
+
+    /*The row offsets can be checked only if the size of the data is known*/
+    if(dsc->src_type == LV_IMG_SRC_VARIABLE &&
+       ((const lv_img_dsc_t *)dsc->src)->data_size < ((uint32_t)dsc->header.h + 1) * sizeof(uint32_t)) {
+        LV_LOG_WARN("The data_size of a compressed image must be set and include the row offsets");
+        lv_img_decoder_built_in_close(dsc->decoder, dsc);
+        return LV_RES_INV;
+    }
+
+    if(dsc->user_data == NULL) {
+        dsc->user_data = lv_malloc(sizeof(lv_img_decoder_built_in_data_t));
+        LV_ASSERT_MALLOC(dsc->user_data);
+        if(dsc->user_data == NULL) {
+            LV_LOG_WARN("out of memory");
+            return LV_RES_INV;
+        }
+        lv_memzero(dsc->user_data, sizeof(lv_img_decoder_built_in_data_t));
+    }
+
+#if LV_IMG_CACHE_DEF_SIZE
+    /*Not asserted as the image still can be drawn row by row*/
+    uint8_t * buf = lv_malloc((uint32_t)dsc->header.w * dsc->header.h * px_size);
+    if(buf == NULL) {
+        LV_LOG_WARN("Not enough memory to decompress the image, it will be decompressed row by row");
+        return LV_RES_OK;
+    }
+
+    lv_area_t area;
+    lv_area_set(&area, 0, 0, dsc->header.w - 1, dsc->header.h - 1);
+    if(read_compressed(dsc, &area, buf) != LV_RES_OK) {
+        lv_free(buf);
+        lv_img_decoder_built_in_close(dsc->decoder, dsc);
+        return LV_RES_INV;
+    }
+
+    lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
+    user_data->decompressed = buf;
+    dsc->img_data = buf;
+#endif
+
+    return LV_RES_OK;
+}
+
+/**
+ * Decompress an area of a compressed image from a variable, a mapped file or with file operations.
+ * From files the row offsets and the compressed rows of the area are read with one read each.
+ * @param dsc   decoder descriptor of an opened compressed image
+ * @param area  the area to decompress
+ * @param buf   store the pixels here
+ * @return      LV_RES_OK: the pixels are decompressed; LV_RES_INV: file error or invalid data
+ */
+static lv_res_t read_compressed(lv_img_decoder_dsc_t * dsc, const lv_area_t * area, uint8_t * buf)
+{
+    lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
+    uint32_t px_size = lv_color_format_get_size(dsc->header.cf);
+    uint32_t len = lv_area_get_width(area);
+    lv_coord_t row_cnt = lv_area_get_height(area);
+    lv_coord_t i;
+
+    const uint8_t * data = NULL;
+    uint32_t data_size = 0;
+    if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
+        const lv_img_dsc_t * img_dsc = dsc->src;
+        data = img_dsc->data;
+        data_size = img_dsc->data_size;
+    }
+    else if(user_data && user_data->map) {
+        data = (const uint8_t *)user_data->map + sizeof(lv_img_header_t);
+        data_size = user_data->map_size - sizeof(lv_img_header_t);
+    }
+
+    if(data) {
+        /*The row offsets are followed by the rows*/
+        uint32_t rows_start = ((uint32_t)dsc->header.h + 1) * sizeof(uint32_t);
+        if(data_size < rows_start) {
+            LV_LOG_WARN("The compressed image is shorter than its row offsets");
+            return LV_RES_INV;
+        }
+
+        for(i = 0; i < row_cnt; i++) {
+            uint32_t ofs = get_row_ofs(data, area->y1 + i);
+            uint32_t end = get_row_ofs(data, area->y1 + i + 1);
+            if(ofs < rows_start || end < ofs || end > data_size) {
+                LV_LOG_WARN("Invalid row offset in a compressed image");
+                return LV_RES_INV;
+            }
+
+            lv_res_t res = decompress_row(data + ofs, end - ofs, px_size, area->x1, len, buf);
+            if(res != LV_RES_OK) return res;
+            buf += len * px_size;
+        }
+        return LV_RES_OK;
+    }
+
+    if(dsc->src_type != LV_IMG_SRC_FILE || user_data == NULL) return LV_RES_INV;
+
+    lv_res_t res = LV_RES_INV;
+    uint8_t * rows = NULL;
+    uint32_t br;
+    uint32_t ofs_size = (row_cnt + 1) * sizeof(uint32_t);
+    uint8_t * row_ofs = lv_malloc(ofs_size);
+    LV_ASSERT_MALLOC(row_ofs);
+    if(row_ofs == NULL) return LV_RES_INV;
+
+    uint32_t ofs = sizeof(lv_img_header_t) + area->y1 * sizeof(uint32_t);
+    if(lv_fs_seek(&user_data->f, ofs, LV_FS_SEEK_SET) != LV_FS_RES_OK) goto exit;
+    if(lv_fs_read(&user_data->f, row_ofs, ofs_size, &br) != LV_FS_RES_OK || br != ofs_size) goto exit;
+
+    uint32_t rows_start = get_row_ofs(row_ofs, 0);
+    uint32_t rows_end = get_row_ofs(row_ofs, row_cnt);
+    if(rows_end < rows_start) {
+        LV_LOG_WARN("Invalid row offset in a compressed image");
+        goto exit;
+    }
+
+    uint32_t rows_size = rows_end - rows_start;
+    rows = lv_malloc(rows_size ? rows_size : 1);
+    LV_ASSERT_MALLOC(rows);
+    if(rows == NULL) goto exit;
+
+    if(lv_fs_seek(&user_data->f, sizeof(lv_img_header_t) + rows_start, LV_FS_SEEK_SET) != LV_FS_RES_OK) goto exit;
+    if(lv_fs_read(&user_data->f, rows, rows_size, &br) != LV_FS_RES_OK || br != rows_size) goto exit;
+
+    for(i = 0; i < row_cnt; i++) {
+        uint32_t row_start = get_row_ofs(row_ofs, i);
+        uint32_t row_end = get_row_ofs(row_ofs, i + 1);
+        if(row_start < rows_start || row_end < row_start || row_end > rows_end) {
+            LV_LOG_WARN("Invalid row offset in a compressed image");
+            goto exit;
+        }
+
+        if(decompress_row(rows + row_start - rows_start, row_end - row_start, px_size, area->x1, len,
+                          buf) != LV_RES_OK) goto exit;
+        buf += len * px_size;
+    }
+    res = LV_RES_OK;
+
+exit:
+    lv_free(row_ofs);
+    if(rows) lv_free(rows);
+    return res;
+}
+
+/**
+ * Decompress `len` pixels of an RLE compressed row from the `x`th pixel
+ * @param in        the compressed row
+ * @param in_size   size of the compressed row in bytes
+ * @param px_size   size of a pixel in bytes
+ * @param x         the first pixel to decompress
+ * @param len       number of pixels to decompress
+ * @param out       store the pixels here
+ * @return          LV_RES_OK: the pixels are decompressed; LV_RES_INV: the row is shorter than expected
+ */
+static lv_res_t decompress_row(const uint8_t * in, uint32_t in_size, uint32_t px_size, uint32_t x, uint32_t len,
+                               uint8_t * out)
+{
+    const uint8_t * in_end = in + in_size;
+    uint32_t end = x + len;
+    uint32_t px = 0;
+    while(px < end) {
+        if(in >= in_end) break;
+
+        uint8_t ctrl = *in;
+        in++;
+        uint32_t cnt = (ctrl & 0x7F) + 1;
+        bool repeat = ctrl & 0x80;
+        uint32_t packet_size = repeat ? px_size : cnt * px_size;
+        if((uint32_t)(in_end - in) < packet_size) break;
+
+        /*Copy only the part of the packet which is in the requested range*/
+        uint32_t first = LV_MAX(px, x);
+        uint32_t last = LV_MIN(px + cnt, end);
+        if(first < last) {
+            if(repeat) {
+                uint32_t i;
+                for(i = first; i < last; i++) {
+                    lv_memcpy(out, in, px_size);
+                    out += px_size;
+                }
+            }
+            else {
+                lv_memcpy(out, in + (first - px) * px_size, (last - first) * px_size);
+                out += (last - first) * px_size;
+            }
+        }
+
+        px += cnt;
+        in += packet_size;
+    }
+
+    if(px < end) {
+        LV_LOG_WARN("Corrupted row in a compressed image");
+        return LV_RES_INV;
+    }
+
+    return LV_RES_OK;
+}
+
+/**
+ * Get an element of the row offset table. Read byte by byte as the table might be not aligned.
+ */
+static uint32_t get_row_ofs(const uint8_t * data, lv_coord_t y)
+{
+    uint32_t ofs;
+    lv_memcpy(&ofs, data + y * sizeof(uint32_t), sizeof(uint32_t));
+    return ofs;
+}
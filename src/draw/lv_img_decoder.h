@@ -67,7 +67,7 @@ typedef lv_res_t (*lv_img_decoder_open_f_t)(struct _lv_img_decoder_t * decoder,
 
 /**
  * Decode `len` pixels starting from the given `x`, `y` coordinates and store them in `buf`.
- * Required only if the "open" function can't return with the whole decoded pixel array.
+ * Required only if the "open" function can't return with the whole decoded pixel array and `read_tile` is not set.
  * @param decoder pointer to the decoder the function associated with
  * @param dsc pointer to decoder descriptor
  * @param x start x coordinate
@@ -79,6 +79,20 @@ typedef lv_res_t (*lv_img_decoder_open_f_t)(struct _lv_img_decoder_t * decoder,
 typedef lv_res_t (*lv_img_decoder_read_line_f_t)(struct _lv_img_decoder_t * decoder, struct _lv_img_decoder_dsc_t * dsc,
                                                  lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t * buf);
 
+/**
+ * Decode a rectangular area of the image and store it in `buf` row by row, without padding.
+ * Optional, used only if the "open" function can't return with the whole decoded pixel array.
+ * Decoders which can seek in the image efficiently (e.g. tiled formats) should implement it,
+ * else the image is read with `read_line` row by row.
+ * @param decoder pointer to the decoder the function associated with
+ * @param dsc pointer to decoder descriptor
+ * @param area the area to decode, relative to the image. It's always inside the image.
+ * @param buf a buffer to store the decoded pixels. Its size is `area width * area height * pixel size`
+ * @return LV_RES_OK: ok; LV_RES_INV: failed
+ */
+typedef lv_res_t (*lv_img_decoder_read_tile_f_t)(struct _lv_img_decoder_t * decoder, struct _lv_img_decoder_dsc_t * dsc,
+                                                 const lv_area_t * area, uint8_t * buf);
+
 /**
  * Close the pending decoding. Free resources etc.
  * @param decoder pointer to the decoder the function associated with
@@ -91,8 +105,13 @@ typedef struct _lv_img_decoder_t {
     lv_img_decoder_info_f_t info_cb;
     lv_img_decoder_open_f_t open_cb;
     lv_img_decoder_read_line_f_t read_line_cb;
+    lv_img_decoder_read_tile_f_t read_tile_cb;
     lv_img_decoder_close_f_t close_cb;
     void * user_data;
+
+    /**true: `info_cb`, `open_cb` and `close_cb` can be called from a worker thread,
+     * so the images can be decoded in the background. See `lv_img_decoder_set_thread_safe()`*/
+    bool thread_safe;
 } lv_img_decoder_t;
 
 
@@ -120,9 +139,15 @@ typedef struct _lv_img_decoder_dsc_t {
      *  MUST be set in `open` function*/
     const uint8_t * img_data;
 
+    /** `img_data` points to a memory mapped file (or other existing memory), so it doesn't use heap memory*/
+    bool img_data_mapped;
+
     const lv_color32_t * palette;
     uint32_t palette_size;
 
+    /**Downscaled versions of `img_data` for drawing with small zoom. Managed by LVGL (see `LV_USE_IMG_MIPMAP`)*/
+    struct _lv_img_mipmap_t * mipmap;
+
     /** How much time did it take to open the image. [ms]
      *  If not set `lv_img_cache` will measure and set the time to open*/
     uint32_t time_to_open;
@@ -171,6 +196,26 @@ lv_res_t lv_img_decoder_get_info(const void * src, lv_img_header_t * header);
  */
 lv_res_t lv_img_decoder_open(lv_img_decoder_dsc_t * dsc, const void * src, lv_color_t color, int32_t frame_id);
 
+/**
+ * Open an image with a given decoder. The other decoders are not tried.
+ * @param decoder pointer to an image decoder, e.g. returned by `_lv_img_decoder_find()`
+ * @param dsc describes a decoding session. Simply a pointer to an `lv_img_decoder_dsc_t` variable.
+ * @param src the image source
+ * @param color The color of the image with `LV_IMG_CF_ALPHA_...`
+ * @param frame_id the index of the frame. Used only with animated images, set 0 for normal images
+ * @return LV_RES_OK: opened the image; LV_RES_INV: the decoder couldn't open the image
+ */
+lv_res_t _lv_img_decoder_open_with(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc, const void * src,
+                                   lv_color_t color, int32_t frame_id);
+
+/**
+ * Find the decoder which would open an image with `lv_img_decoder_open()`,
+ * i.e. the first one whose `info_cb` recognizes the image.
+ * @param src the image source
+ * @return pointer to the decoder or NULL if none of the decoders recognized the image
+ */
+lv_img_decoder_t * _lv_img_decoder_find(const void * src);
+
 /**
  * Read a line from an opened image
  * @param dsc pointer to `lv_img_decoder_dsc_t` used in `lv_img_decoder_open`
@@ -183,6 +228,16 @@ lv_res_t lv_img_decoder_open(lv_img_decoder_dsc_t * dsc, const void * src, lv_co
 lv_res_t lv_img_decoder_read_line(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y, lv_coord_t len,
                                   uint8_t * buf);
 
+/**
+ * Read a rectangular area from an opened image.
+ * Uses the decoder's `read_tile_cb` or reads the area line by line if it has only `read_line_cb`.
+ * @param dsc pointer to `lv_img_decoder_dsc_t` used in `lv_img_decoder_open`
+ * @param area the area to read relative to the image
+ * @param buf store the data here. Its size should be `area width * area height * pixel size`
+ * @return LV_RES_OK: success; LV_RES_INV: an error occurred or the decoder can't read parts of the image
+ */
+lv_res_t lv_img_decoder_read_tile(lv_img_decoder_dsc_t * dsc, const lv_area_t * area, uint8_t * buf);
+
 /**
  * Close a decoding session
  * @param dsc pointer to `lv_img_decoder_dsc_t` used in `lv_img_decoder_open`
@@ -222,6 +277,13 @@ void lv_img_decoder_set_open_cb(lv_img_decoder_t * decoder, lv_img_decoder_open_
  */
 void lv_img_decoder_set_read_line_cb(lv_img_decoder_t * decoder, lv_img_decoder_read_line_f_t read_line_cb);
 
+/**
+ * Set a callback to decode a rectangular area of an image
+ * @param decoder pointer to an image decoder
+ * @param read_tile_cb a function to read an area of an image
+ */
+void lv_img_decoder_set_read_tile_cb(lv_img_decoder_t * decoder, lv_img_decoder_read_tile_f_t read_tile_cb);
+
 /**
  * Set a callback to close a decoding session. E.g. close files and free other resources.
  * @param decoder pointer to an image decoder
@@ -229,6 +291,15 @@ void lv_img_decoder_set_read_line_cb(lv_img_decoder_t * decoder, lv_img_decoder_
  */
 void lv_img_decoder_set_close_cb(lv_img_decoder_t * decoder, lv_img_decoder_close_f_t close_cb);
 
+/**
+ * Tell that the decoder's `info_cb`, `open_cb` and `close_cb` can be called from a worker thread.
+ * Only the images of such decoders are decoded in the background, see `lv_img_cache_set_async()`.
+ * It's allowed only if the callbacks don't use widgets, timers, etc. and the file system drivers are thread safe.
+ * @param decoder pointer to an image decoder
+ * @param en true: the decoder is thread safe; false: always call it from the LVGL thread (default)
+ */
+void lv_img_decoder_set_thread_safe(lv_img_decoder_t * decoder, bool en);
+
 /**
  * Get info about a built-in image
  * @param decoder the decoder where this function belongs
@@ -239,7 +310,13 @@ void lv_img_decoder_set_close_cb(lv_img_decoder_t * decoder, lv_img_decoder_clos
 lv_res_t lv_img_decoder_built_in_info(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header);
 
 /**
- * Open a built in image
+ * Open a built in image.
+ * If `header.compressed` is set, the data is an `uint32_t` offset table with `h + 1` elements
+ * telling where each row starts from the beginning of the table, followed by the RLE compressed rows.
+ * A row is a series of packets: if bit 7 of the first byte is 1, the next pixel is repeated `(byte & 0x7F) + 1` times,
+ * else `byte + 1` not compressed pixels follow. Only the color formats with whole bytes per pixel
+ * (except RGB565A8 and the indexed formats) can be compressed.
+ * Compressed images are decompressed in `open` if image caching is enabled, else the rows are decompressed when drawn.
  * @param decoder the decoder where this function belongs
  * @param dsc pointer to decoder descriptor. `src`, `style` are already initialized in it.
  * @return LV_RES_OK: the info is successfully stored in `header`; LV_RES_INV: unknown format or other error.
@@ -253,6 +330,17 @@ lv_res_t lv_img_decoder_built_in_open(lv_img_decoder_t * decoder, lv_img_decoder
  */
 void lv_img_decoder_built_in_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
 
+/**
+ * Read an area of a built in image file which couldn't be memory mapped or of a compressed image
+ * @param decoder pointer to the decoder the function associated with
+ * @param dsc pointer to decoder descriptor
+ * @param area the area to read relative to the image
+ * @param buf store the pixels here
+ * @return LV_RES_OK: the pixels are read; LV_RES_INV: not supported color format or file error
+ */
+lv_res_t lv_img_decoder_built_in_read_tile(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc,
+                                           const lv_area_t * area, uint8_t * buf);
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,157 @@
+/**
+ * @file lv_img_mipmap.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_img_mipmap.h"
+#if LV_USE_IMG_MIPMAP
+
+#include "../misc/lv_assert.h"
+#include "../misc/lv_mem.h"
+#include "../misc/lv_style.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_img_mipmap_t * create_level(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_color_format_t cf,
+                                      uint8_t level);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+const lv_img_mipmap_t * _lv_img_mipmap_get(lv_img_decoder_dsc_t * dsc, uint16_t zoom, uint32_t * mem_size)
+{
+    *mem_size = 0;
+    lv_color_format_t cf = dsc->header.cf;
+    if(dsc->img_data == NULL) return NULL;
+    if(cf != LV_COLOR_FORMAT_NATIVE && cf != LV_COLOR_FORMAT_NATIVE_ALPHA) return NULL;
+
+    uint32_t px_size = cf == LV_COLOR_FORMAT_NATIVE_ALPHA ? LV_COLOR_FORMAT_NATIVE_ALPHA_SIZE : sizeof(lv_color_t);
+
+    /*Use the level which is zoomed out at most 2x, so the bilinear filtering is still fine*/
+    const uint8_t * src = dsc->img_data;
+    lv_coord_t src_w = dsc->header.w;
+    lv_coord_t src_h = dsc->header.h;
+    lv_img_mipmap_t ** next_p = &dsc->mipmap;
+    lv_img_mipmap_t * mip = NULL;
+    uint8_t level = 0;
+    while(zoom != 0 && zoom <= LV_ZOOM_NONE / 2 && src_w > 1 && src_h > 1) {
+        level++;
+        if(*next_p == NULL) {
+            *next_p = create_level(src, src_w, src_h, cf, level);
+            if(*next_p == NULL) break;
+            *mem_size += sizeof(lv_img_mipmap_t) + (uint32_t)(*next_p)->w * (*next_p)->h * px_size;
+        }
+
+        mip = *next_p;
+        src = mip->data;
+        src_w = mip->w;
+        src_h = mip->h;
+        next_p = &mip->next;
+        zoom *= 2;
+    }
+
+    return mip;
+}
+
+void _lv_img_mipmap_free(lv_img_decoder_dsc_t * dsc)
+{
+    lv_img_mipmap_t * mip = dsc->mipmap;
+    while(mip) {
+        lv_img_mipmap_t * next = mip->next;
+        lv_free(mip);
+        mip = next;
+    }
+    dsc->mipmap = NULL;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Create a half sized image by averaging 2x2 pixels.
+ * The colors are weighted by the opacity, so the transparent pixels don't darken the edges.
+ */
+static lv_img_mipmap_t * create_level(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_color_format_t cf,
+                                      uint8_t level)
+{
+    bool has_alpha = cf == LV_COLOR_FORMAT_NATIVE_ALPHA;
+    uint32_t px_size = has_alpha ? LV_COLOR_FORMAT_NATIVE_ALPHA_SIZE : sizeof(lv_color_t);
+    lv_coord_t w = src_w / 2;
+    lv_coord_t h = src_h / 2;
+
+    lv_img_mipmap_t * mip = lv_malloc(sizeof(lv_img_mipmap_t) + (uint32_t)w * h * px_size);
+    LV_ASSERT_MALLOC(mip);
+    if(mip == NULL) {
+        LV_LOG_WARN("out of memory");
+        return NULL;
+    }
+
+    uint8_t * dest = (uint8_t *)(mip + 1);
+    mip->next = NULL;
+    mip->data = dest;
+    mip->w = w;
+    mip->h = h;
+    mip->level = level;
+
+    uint32_t src_stride = (uint32_t)src_w * px_size;
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * src_row = src + (uint32_t)y * 2 * src_stride;
+        for(x = 0; x < w; x++) {
+            const uint8_t * px[4];
+            px[0] = src_row + (uint32_t)x * 2 * px_size;
+            px[1] = px[0] + px_size;
+            px[2] = px[0] + src_stride;
+            px[3] = px[2] + px_size;
+
+            uint32_t r = 0;
+            uint32_t g = 0;
+            uint32_t b = 0;
+            uint32_t a_sum = 0;
+            uint32_t i;
+            for(i = 0; i < 4; i++) {
+                lv_color_t c;
+                lv_memcpy(&c, px[i], sizeof(lv_color_t));
+                lv_color32_t c32 = lv_color_to32(c);
+                uint32_t a = has_alpha ? px[i][LV_COLOR_FORMAT_NATIVE_ALPHA_SIZE - 1] : 1;
+                r += c32.red * a;
+                g += c32.green * a;
+                b += c32.blue * a;
+                a_sum += a;
+            }
+
+            lv_color_t c = lv_color_black();
+            if(a_sum) c = lv_color_make(r / a_sum, g / a_sum, b / a_sum);
+            lv_memcpy(dest, &c, sizeof(lv_color_t));
+            if(has_alpha) dest[LV_COLOR_FORMAT_NATIVE_ALPHA_SIZE - 1] = a_sum / 4;
+            dest += px_size;
+        }
+    }
+
+    return mip;
+}
+
+#endif /*LV_USE_IMG_MIPMAP*/
@@ -0,0 +1,72 @@
+/**
+ * @file lv_img_mipmap.h
+ * Downscaled versions of the decoded images to draw them with small zoom.
+ */
+
+#ifndef LV_IMG_MIPMAP_H
+#define LV_IMG_MIPMAP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "lv_img_decoder.h"
+
+#if LV_USE_IMG_MIPMAP
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * A level of the mip chain. Each level is half as large as the previous one.
+ */
+typedef struct _lv_img_mipmap_t {
+    struct _lv_img_mipmap_t * next;     /**< The next, 2x smaller level or NULL*/
+    const uint8_t * data;               /**< The pixels in the color format of the original image*/
+    lv_coord_t w;
+    lv_coord_t h;
+    uint8_t level;                      /**< 1: half size, 2: quarter size, etc.*/
+} lv_img_mipmap_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Get the downscaled version of an opened image which is the best to draw it with the given zoom.
+ * The levels are created when they are needed first and they are kept until the image is closed,
+ * so the image cache keeps them too. Their size should be charged to the cache entry of the image.
+ * Only `LV_COLOR_FORMAT_NATIVE` and `LV_COLOR_FORMAT_NATIVE_ALPHA` images with `img_data` are supported.
+ * @param dsc       pointer to an opened decoder descriptor
+ * @param zoom      the zoom used for drawing (256: no zoom)
+ * @param mem_size  the size of the newly created levels in bytes will be written here (0 if no level was created)
+ * @return          the level to draw or NULL to draw the original image
+ */
+const lv_img_mipmap_t * _lv_img_mipmap_get(lv_img_decoder_dsc_t * dsc, uint16_t zoom, uint32_t * mem_size);
+
+/**
+ * Free all levels of an image. Called when the image is closed.
+ * @param dsc       pointer to a decoder descriptor
+ */
+void _lv_img_mipmap_free(lv_img_decoder_dsc_t * dsc);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_IMG_MIPMAP*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_IMG_MIPMAP_H*/
@@ -0,0 +1,196 @@
+/**
+ * @file lv_img_tile_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_img_tile_cache.h"
+#if LV_USE_IMG_TILE_CACHE
+
+#include "lv_draw_img.h"
+#include "../misc/lv_assert.h"
+#include "../misc/lv_mem.h"
+#include "../misc/lv_ll.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool src_match(const lv_img_tile_t * tile, const void * src);
+static lv_img_tile_t * tile_create(lv_img_decoder_dsc_t * dsc, const lv_area_t * area);
+static void tile_free(lv_img_tile_t * tile);
+static void evict(uint32_t mem_size);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_ll_t tile_ll;         /*The most recently used tile is the head*/
+static uint32_t mem_size_max;
+static lv_img_tile_cache_stats_t stats;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void _lv_img_tile_cache_init(void)
+{
+    _lv_ll_init(&tile_ll, sizeof(lv_img_tile_t));
+    mem_size_max = LV_IMG_TILE_CACHE_DEF_MEM_SIZE;
+    lv_memzero(&stats, sizeof(stats));
+}
+
+const lv_img_tile_t * _lv_img_tile_cache_get(lv_img_decoder_dsc_t * dsc, lv_coord_t col, lv_coord_t row)
+{
+    if(mem_size_max == 0) return NULL;
+
+    lv_area_t area;
+    area.x1 = col * LV_IMG_TILE_SIZE;
+    area.y1 = row * LV_IMG_TILE_SIZE;
+    area.x2 = LV_MIN(area.x1 + LV_IMG_TILE_SIZE, (lv_coord_t)dsc->header.w) - 1;
+    area.y2 = LV_MIN(area.y1 + LV_IMG_TILE_SIZE, (lv_coord_t)dsc->header.h) - 1;
+    if(area.x1 > area.x2 || area.y1 > area.y2) return NULL;
+
+    lv_img_tile_t * tile;
+    _LV_LL_READ(&tile_ll, tile) {
+        if(tile->area.x1 == area.x1 && tile->area.y1 == area.y1 && tile->frame_id == dsc->frame_id &&
+           tile->src_type == dsc->src_type && src_match(tile, dsc->src)) {
+            /*Move to the front of the LRU list*/
+            _lv_ll_move_before(&tile_ll, tile, _lv_ll_get_head(&tile_ll));
+            stats.hit_cnt++;
+            return tile;
+        }
+    }
+
+    stats.miss_cnt++;
+
+    tile = tile_create(dsc, &area);
+    if(tile == NULL) return NULL;
+
+    stats.entry_cnt++;
+    stats.mem_size += tile->mem_size;
+
+    return tile;
+}
+
+void lv_img_tile_cache_set_mem_size(uint32_t mem_size)
+{
+    mem_size_max = mem_size;
+    evict(mem_size_max);
+}
+
+void lv_img_tile_cache_invalidate_src(const void * src)
+{
+    lv_img_tile_t * tile = _lv_ll_get_head(&tile_ll);
+    while(tile) {
+        lv_img_tile_t * next = _lv_ll_get_next(&tile_ll, tile);
+        if(src == NULL || src_match(tile, src)) tile_free(tile);
+        tile = next;
+    }
+}
+
+void lv_img_tile_cache_get_stats(lv_img_tile_cache_stats_t * stats_out)
+{
+    lv_memcpy(stats_out, &stats, sizeof(stats));
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool src_match(const lv_img_tile_t * tile, const void * src)
+{
+    if(tile->src_type == LV_IMG_SRC_FILE) {
+        if(lv_img_src_get_type(src) != LV_IMG_SRC_FILE) return false;
+        return strcmp(tile->src, src) == 0;
+    }
+    return tile->src == src;
+}
+
+static lv_img_tile_t * tile_create(lv_img_decoder_dsc_t * dsc, const lv_area_t * area)
+{
+    uint32_t px_size = lv_color_format_get_size(dsc->header.cf);
+    uint32_t mem_size = lv_area_get_size(area) * px_size;
+    if(mem_size == 0 || mem_size > mem_size_max) return NULL;
+    evict(mem_size_max - mem_size);
+
+    uint8_t * data = lv_malloc(mem_size);
+    LV_ASSERT_MALLOC(data);
+    if(data == NULL) {
+        LV_LOG_WARN("out of memory");
+        return NULL;
+    }
+
+    if(lv_img_decoder_read_tile(dsc, area, data) != LV_RES_OK) {
+        LV_LOG_WARN("couldn't read the tile");
+        lv_free(data);
+        return NULL;
+    }
+
+    const void * src = dsc->src;
+    if(dsc->src_type == LV_IMG_SRC_FILE) {
+        char * src_copy = lv_malloc(lv_strlen(dsc->src) + 1);
+        LV_ASSERT_MALLOC(src_copy);
+        if(src_copy == NULL) {
+            lv_free(data);
+            return NULL;
+        }
+        lv_strcpy(src_copy, dsc->src);
+        src = src_copy;
+    }
+
+    lv_img_tile_t * tile = _lv_ll_ins_head(&tile_ll);
+    LV_ASSERT_MALLOC(tile);
+    if(tile == NULL) {
+        if(dsc->src_type == LV_IMG_SRC_FILE) lv_free((void *)src);
+        lv_free(data);
+        return NULL;
+    }
+
+    tile->src = src;
+    tile->src_type = dsc->src_type;
+    tile->frame_id = dsc->frame_id;
+    tile->area = *area;
+    tile->data = data;
+    tile->mem_size = mem_size;
+
+    return tile;
+}
+
+static void tile_free(lv_img_tile_t * tile)
+{
+    stats.entry_cnt--;
+    stats.mem_size -= tile->mem_size;
+
+    if(tile->src_type == LV_IMG_SRC_FILE) lv_free((void *)tile->src);
+    lv_free((void *)tile->data);
+    _lv_ll_remove(&tile_ll, tile);
+    lv_free(tile);
+}
+
+/**
+ * Free the least recently used tiles until the used memory is not larger than `mem_size`
+ */
+static void evict(uint32_t mem_size)
+{
+    while(stats.mem_size > mem_size) {
+        lv_img_tile_t * tile = _lv_ll_get_tail(&tile_ll);
+        if(tile == NULL) break;
+        tile_free(tile);
+    }
+}
+
+#endif /*LV_USE_IMG_TILE_CACHE*/
@@ -0,0 +1,102 @@
+/**
+ * @file lv_img_tile_cache.h
+ * Keep the recently used tiles of the images which can't be decoded at once,
+ * so that only the visible parts of very large images are decoded and stored.
+ */
+
+#ifndef LV_IMG_TILE_CACHE_H
+#define LV_IMG_TILE_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#if LV_USE_IMG_TILE_CACHE
+
+#include "lv_img_decoder.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * A decoded tile of an image
+ */
+typedef struct {
+    const void * src;           /**< Copy of the file name or pointer to the `lv_img_dsc_t` variable*/
+    lv_img_src_t src_type;
+    int32_t frame_id;
+
+    lv_area_t area;             /**< Area of the tile in the image. The tiles at the right and bottom can be smaller*/
+    const uint8_t * data;       /**< The pixels in the color format of the image*/
+    uint32_t mem_size;          /**< Size of `data` in bytes*/
+} lv_img_tile_t;
+
+/**
+ * Statistics of the tile cache
+ */
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of tiles found in the cache*/
+    uint32_t miss_cnt;      /**< Number of tiles which needed to be decoded*/
+    uint32_t entry_cnt;     /**< Number of cached tiles*/
+    uint32_t mem_size;      /**< Memory used by the cached tiles in bytes*/
+} lv_img_tile_cache_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the tile cache
+ */
+void _lv_img_tile_cache_init(void);
+
+/**
+ * Get a tile of an opened image from the cache or decode it with `lv_img_decoder_read_tile()`.
+ * The tile is valid only until the next call, as it can be evicted to make space for an other tile.
+ * @param dsc       an opened image. `src` and `frame_id` are used to identify the image
+ * @param col       column of the tile (x / LV_IMG_TILE_SIZE)
+ * @param row       row of the tile (y / LV_IMG_TILE_SIZE)
+ * @return          the tile or NULL if it couldn't be decoded or doesn't fit into the cache
+ */
+const lv_img_tile_t * _lv_img_tile_cache_get(lv_img_decoder_dsc_t * dsc, lv_coord_t col, lv_coord_t row);
+
+/**
+ * Set the maximal memory used by the tiles.
+ * The least recently used tiles are freed if there is not enough space.
+ * @param mem_size  the maximal memory in bytes, 0 to disable caching
+ */
+void lv_img_tile_cache_set_mem_size(uint32_t mem_size);
+
+/**
+ * Free the tiles of an image. Called by `lv_img_cache_invalidate_src()` too.
+ * @param src       an image source used in `lv_img_set_src()` or NULL to free all tiles
+ */
+void lv_img_tile_cache_invalidate_src(const void * src);
+
+/**
+ * Get the statistics of the tile cache
+ * @param stats     store the statistics here
+ */
+void lv_img_tile_cache_get_stats(lv_img_tile_cache_stats_t * stats);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_IMG_TILE_CACHE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_IMG_TILE_CACHE_H*/
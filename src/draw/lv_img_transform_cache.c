@@ -0,0 +1,244 @@
+/**
+ * @file lv_img_transform_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_img_transform_cache.h"
+#if LV_USE_IMG_TRANSFORM_CACHE
+
+#include "lv_draw.h"
+#include "lv_img_buf.h"
+#include "../misc/lv_assert.h"
+#include "../misc/lv_mem.h"
+#include "../misc/lv_ll.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool entry_match(const lv_img_transform_cache_entry_t * e, const lv_img_decoder_dsc_t * dec_dsc,
+                        const lv_draw_img_dsc_t * draw_dsc, lv_coord_t w, lv_coord_t h);
+static lv_img_transform_cache_entry_t * entry_create(lv_draw_ctx_t * draw_ctx, const lv_img_decoder_dsc_t * dec_dsc,
+                                                     const lv_draw_img_dsc_t * draw_dsc, const lv_draw_img_sup_t * sup,
+                                                     const uint8_t * img_data, lv_coord_t w, lv_coord_t h);
+static bool src_match(const lv_img_transform_cache_entry_t * e, const void * src);
+static void entry_free(lv_img_transform_cache_entry_t * e);
+static void evict(uint32_t mem_size_max);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_ll_t entry_ll;        /*The most recently used entry is the head*/
+static uint32_t mem_size_max;
+static lv_img_transform_cache_stats_t stats;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void _lv_img_transform_cache_init(void)
+{
+    _lv_ll_init(&entry_ll, sizeof(lv_img_transform_cache_entry_t));
+    mem_size_max = LV_IMG_TRANSFORM_CACHE_DEF_MEM_SIZE;
+    lv_memzero(&stats, sizeof(stats));
+}
+
+const lv_img_transform_cache_entry_t * _lv_img_transform_cache_get(lv_draw_ctx_t * draw_ctx,
+                                                                   const lv_img_decoder_dsc_t * dec_dsc,
+                                                                   const lv_draw_img_dsc_t * draw_dsc,
+                                                                   const lv_draw_img_sup_t * sup,
+                                                                   const uint8_t * img_data, lv_coord_t w, lv_coord_t h)
+{
+    if(mem_size_max == 0) return NULL;
+
+    lv_img_transform_cache_entry_t * e;
+    _LV_LL_READ(&entry_ll, e) {
+        if(entry_match(e, dec_dsc, draw_dsc, w, h)) {
+            /*Move to the front of the LRU list*/
+            _lv_ll_move_before(&entry_ll, e, _lv_ll_get_head(&entry_ll));
+            stats.hit_cnt++;
+            return e;
+        }
+    }
+
+    stats.miss_cnt++;
+
+    e = entry_create(draw_ctx, dec_dsc, draw_dsc, sup, img_data, w, h);
+    if(e == NULL) return NULL;
+
+    stats.entry_cnt++;
+    stats.mem_size += e->mem_size;
+
+    return e;
+}
+
+void lv_img_transform_cache_set_mem_size(uint32_t mem_size)
+{
+    mem_size_max = mem_size;
+    evict(mem_size_max);
+}
+
+void lv_img_transform_cache_invalidate_src(const void * src)
+{
+    lv_img_transform_cache_entry_t * e = _lv_ll_get_head(&entry_ll);
+    while(e) {
+        lv_img_transform_cache_entry_t * next = _lv_ll_get_next(&entry_ll, e);
+        if(src == NULL || src_match(e, src)) entry_free(e);
+        e = next;
+    }
+}
+
+void lv_img_transform_cache_get_stats(lv_img_transform_cache_stats_t * stats_out)
+{
+    lv_memcpy(stats_out, &stats, sizeof(stats));
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool entry_match(const lv_img_transform_cache_entry_t * e, const lv_img_decoder_dsc_t * dec_dsc,
+                        const lv_draw_img_dsc_t * draw_dsc, lv_coord_t w, lv_coord_t h)
+{
+    if(e->angle != draw_dsc->angle || e->zoom != draw_dsc->zoom) return false;
+    if(e->pivot.x != draw_dsc->pivot.x || e->pivot.y != draw_dsc->pivot.y) return false;
+    if(e->antialias != draw_dsc->antialias) return false;
+    if(e->w != w || e->h != h || e->frame_id != dec_dsc->frame_id) return false;
+    if(e->src_type != dec_dsc->src_type) return false;
+
+    return src_match(e, dec_dsc->src);
+}
+
+static bool src_match(const lv_img_transform_cache_entry_t * e, const void * src)
+{
+    if(e->src_type == LV_IMG_SRC_FILE) {
+        if(lv_img_src_get_type(src) != LV_IMG_SRC_FILE) return false;
+        return strcmp(e->src, src) == 0;
+    }
+    return e->src == src;
+}
+
+/**
+ * Transform the whole image row by row and store it in a new entry
+ */
+static lv_img_transform_cache_entry_t * entry_create(lv_draw_ctx_t * draw_ctx, const lv_img_decoder_dsc_t * dec_dsc,
+                                                     const lv_draw_img_dsc_t * draw_dsc, const lv_draw_img_sup_t * sup,
+                                                     const uint8_t * img_data, lv_coord_t w, lv_coord_t h)
+{
+    if(draw_ctx->draw_transform == NULL) return NULL;
+
+    lv_area_t area;
+    _lv_img_buf_get_transformed_area(&area, w, h, draw_dsc->angle, draw_dsc->zoom, &draw_dsc->pivot);
+    lv_coord_t area_w = lv_area_get_width(&area);
+    lv_coord_t area_h = lv_area_get_height(&area);
+    if(area_w <= 0 || area_h <= 0) return NULL;
+
+    /*Don't evict everything for an image which doesn't fit anyway*/
+    uint32_t mem_size = (uint32_t)area_w * area_h * LV_COLOR_FORMAT_NATIVE_ALPHA_SIZE;
+    if(mem_size > mem_size_max) return NULL;
+    evict(mem_size_max - mem_size);
+
+    lv_img_transform_cache_entry_t * e = _lv_ll_ins_head(&entry_ll);
+    uint8_t * data = lv_malloc(mem_size);
+    lv_color_t * cbuf = lv_malloc(area_w * sizeof(lv_color_t));
+    lv_opa_t * abuf = lv_malloc(area_w);
+    if(e == NULL || data == NULL || cbuf == NULL || abuf == NULL) {
+        LV_LOG_WARN("out of memory");
+        if(e) _lv_ll_remove(&entry_ll, e);
+        lv_free(e);
+        lv_free(data);
+        lv_free(cbuf);
+        lv_free(abuf);
+        return NULL;
+    }
+
+    lv_memzero(e, sizeof(lv_img_transform_cache_entry_t));
+    if(dec_dsc->src_type == LV_IMG_SRC_FILE) {
+        size_t len = lv_strlen(dec_dsc->src);
+        char * src_copy = lv_malloc(len + 1);
+        LV_ASSERT_MALLOC(src_copy);
+        if(src_copy == NULL) {
+            _lv_ll_remove(&entry_ll, e);
+            lv_free(e);
+            lv_free(data);
+            lv_free(cbuf);
+            lv_free(abuf);
+            return NULL;
+        }
+        lv_strcpy(src_copy, dec_dsc->src);
+        e->src = src_copy;
+    }
+    else {
+        e->src = dec_dsc->src;
+    }
+
+    e->src_type = dec_dsc->src_type;
+    e->frame_id = dec_dsc->frame_id;
+    e->w = w;
+    e->h = h;
+    e->angle = draw_dsc->angle;
+    e->zoom = draw_dsc->zoom;
+    e->pivot = draw_dsc->pivot;
+    e->antialias = draw_dsc->antialias;
+    e->area = area;
+    e->data = data;
+    e->mem_size = mem_size;
+
+    lv_area_t row = area;
+    for(row.y1 = area.y1; row.y1 <= area.y2; row.y1++) {
+        row.y2 = row.y1;
+        lv_draw_transform(draw_ctx, &row, img_data, w, h, w, draw_dsc, sup, dec_dsc->header.cf, cbuf, abuf);
+
+        lv_coord_t x;
+        for(x = 0; x < area_w; x++) {
+            lv_memcpy(data, &cbuf[x], sizeof(lv_color_t));
+            data[LV_COLOR_FORMAT_NATIVE_ALPHA_SIZE - 1] = abuf[x];
+            data += LV_COLOR_FORMAT_NATIVE_ALPHA_SIZE;
+        }
+    }
+
+    lv_free(cbuf);
+    lv_free(abuf);
+
+    return e;
+}
+
+static void entry_free(lv_img_transform_cache_entry_t * e)
+{
+    stats.entry_cnt--;
+    stats.mem_size -= e->mem_size;
+
+    if(e->src_type == LV_IMG_SRC_FILE) lv_free((void *)e->src);
+    lv_free((void *)e->data);
+    _lv_ll_remove(&entry_ll, e);
+    lv_free(e);
+}
+
+/**
+ * Free the least recently used entries until the used memory is not larger than `mem_size`
+ */
+static void evict(uint32_t mem_size)
+{
+    while(stats.mem_size > mem_size) {
+        lv_img_transform_cache_entry_t * e = _lv_ll_get_tail(&entry_ll);
+        if(e == NULL) break;
+        entry_free(e);
+    }
+}
+
+#endif /*LV_USE_IMG_TRANSFORM_CACHE*/
@@ -0,0 +1,118 @@
+/**
+ * @file lv_img_transform_cache.h
+ * Keep the rotated and zoomed images, so they can be simply copied when they are drawn again
+ * with the same transformation.
+ */
+
+#ifndef LV_IMG_TRANSFORM_CACHE_H
+#define LV_IMG_TRANSFORM_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#if LV_USE_IMG_TRANSFORM_CACHE
+
+#include "lv_img_decoder.h"
+#include "lv_draw_img.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct _lv_draw_ctx_t;
+
+/**
+ * A transformed image
+ */
+typedef struct {
+    const void * src;           /**< Copy of the file name or pointer to the `lv_img_dsc_t` variable*/
+    lv_img_src_t src_type;
+    int32_t frame_id;
+    lv_coord_t w;               /**< Width of the image before the transformation*/
+    lv_coord_t h;               /**< Height of the image before the transformation*/
+    int16_t angle;
+    uint16_t zoom;
+    lv_point_t pivot;
+    uint8_t antialias;
+
+    lv_area_t area;             /**< Area of the transformed image relative to the image's original coordinates*/
+    const uint8_t * data;       /**< The transformed pixels in `LV_COLOR_FORMAT_NATIVE_ALPHA` format*/
+    uint32_t mem_size;          /**< Size of `data` in bytes*/
+} lv_img_transform_cache_entry_t;
+
+/**
+ * Statistics of the transform cache
+ */
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of transformations found in the cache*/
+    uint32_t miss_cnt;      /**< Number of transformations which needed to be calculated*/
+    uint32_t entry_cnt;     /**< Number of cached transformed images*/
+    uint32_t mem_size;      /**< Memory used by the cached images in bytes*/
+} lv_img_transform_cache_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the transform cache
+ */
+void _lv_img_transform_cache_init(void);
+
+/**
+ * Get a transformed image from the cache or transform it and add it to the cache.
+ * @param draw_ctx      pointer to the current draw context to use for transforming
+ * @param dec_dsc       the opened image. `src` and `frame_id` are used to identify the image
+ * @param draw_dsc      describes the transformation
+ * @param sup           additional info about the image
+ * @param img_data      the pixels to transform (e.g. `dec_dsc->img_data` or a smaller mipmap)
+ * @param w             width of `img_data`
+ * @param h             height of `img_data`
+ * @return              the cached image or NULL if it couldn't be cached (e.g. it's too large)
+ */
+const lv_img_transform_cache_entry_t * _lv_img_transform_cache_get(struct _lv_draw_ctx_t * draw_ctx,
+                                                                   const lv_img_decoder_dsc_t * dec_dsc,
+                                                                   const lv_draw_img_dsc_t * draw_dsc,
+                                                                   const lv_draw_img_sup_t * sup,
+                                                                   const uint8_t * img_data, lv_coord_t w, lv_coord_t h);
+
+/**
+ * Set the maximal memory used by the transformed images.
+ * The least recently used images are freed if there is not enough space.
+ * @param mem_size  the maximal memory in bytes, 0 to disable caching
+ */
+void lv_img_transform_cache_set_mem_size(uint32_t mem_size);
+
+/**
+ * Free the transformed versions of an image. Called by `lv_img_cache_invalidate_src()` too.
+ * @param src       an image source used in `lv_img_set_src()` or NULL to free all images
+ */
+void lv_img_transform_cache_invalidate_src(const void * src);
+
+/**
+ * Get the statistics of the transform cache
+ * @param stats     store the statistics here
+ */
+void lv_img_transform_cache_get_stats(lv_img_transform_cache_stats_t * stats);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_IMG_TRANSFORM_CACHE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_IMG_TRANSFORM_CACHE_H*/
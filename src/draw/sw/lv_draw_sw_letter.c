@@ -15,6 +15,7 @@
 #include "../../misc/lv_area.h"
 #include "../../misc/lv_style.h"
 #include "../../font/lv_font.h"
+#include "../../font/lv_font_sdf.h"
 #include "../../core/lv_refr.h"
 
 /*********************
@@ -38,6 +39,11 @@ static void draw_letter_subpx(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_
                               lv_font_glyph_dsc_t * g, const uint8_t * map_p);
 #endif /*LV_DRAW_SW_FONT_SUBPX*/
 
+#if LV_USE_FONT_SDF
+static void draw_letter_sdf(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos,
+                            lv_font_glyph_dsc_t * g, const lv_font_sdf_glyph_t * glyph);
+#endif /*LV_USE_FONT_SDF*/
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -206,6 +212,13 @@ LV_ATTRIBUTE_FAST_MEM static void draw_letter_normal(lv_draw_ctx_t * draw_ctx, c
     }
 #endif
 
+#if LV_USE_FONT_SDF
+    if(bpp == LV_FONT_SDF_BPP) {
+        draw_letter_sdf(draw_ctx, dsc, pos, g, (const lv_font_sdf_glyph_t *)map_p);
+        return;
+    }
+#endif
+
     switch(bpp) {
         case 1:
             bpp_opa_table_p = _lv_bpp1_opa_table;
@@ -569,4 +582,90 @@ static void draw_letter_subpx(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_
 }
 #endif /*LV_DRAW_SW_FONT_SUBPX*/
 
+#if LV_USE_FONT_SDF
+/**
+ * Get the distance value at a point of the distance field
+ * @param glyph     the distance field
+ * @param x         X coordinate [1/256 px]
+ * @param y         Y coordinate [1/256 px]
+ * @return          the bilinear interpolation of the 4 closest pixels, 0 outside [1/256]
+ */
+static inline int32_t sdf_sample(const lv_font_sdf_glyph_t * glyph, int32_t x, int32_t y)
+{
+    int32_t x1 = x >> 8;
+    int32_t y1 = y >> 8;
+    int32_t fx = x & 0xFF;
+    int32_t fy = y & 0xFF;
+    int32_t w = glyph->w;
+    int32_t h = glyph->h;
+    const uint8_t * map = glyph->map;
+    int32_t i = y1 * w + x1;
+
+    int32_t v00 = 0, v01 = 0, v10 = 0, v11 = 0;
+    if(x1 >= 0 && y1 >= 0 && x1 + 1 < w && y1 + 1 < h) {
+        v00 = map[i];
+        v01 = map[i + 1];
+        v10 = map[i + w];
+        v11 = map[i + w + 1];
+    }
+    else {
+        /*On the border the pixels outside are considered to be far from the glyph*/
+        bool x1_in = x1 >= 0 && x1 < w;
+        bool x2_in = x1 + 1 >= 0 && x1 + 1 < w;
+        if(y1 >= 0 && y1 < h) {
+            if(x1_in) v00 = map[i];
+            if(x2_in) v01 = map[i + 1];
+        }
+        if(y1 + 1 >= 0 && y1 + 1 < h) {
+            if(x1_in) v10 = map[i + w];
+            if(x2_in) v11 = map[i + w + 1];
+        }
+    }
+
+    int32_t top = v00 * (256 - fx) + v01 * fx;
+    int32_t bottom = v10 * (256 - fx) + v11 * fx;
+    return (top * (256 - fy) + bottom * fy) >> 8;
+}
+
+/**
+ * Convert the visible part of the distance field to an 8 bpp bitmap of the scaled glyph
+ * and draw it as a normal letter
+ */
+static void draw_letter_sdf(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos,
+                            lv_font_glyph_dsc_t * g, const lv_font_sdf_glyph_t * glyph)
+{
+    int32_t box_w = g->box_w;
+    int32_t box_h = g->box_h;
+    int32_t col_start = pos->x >= draw_ctx->clip_area->x1 ? 0 : draw_ctx->clip_area->x1 - pos->x;
+    int32_t col_end   = pos->x + box_w <= draw_ctx->clip_area->x2 ? box_w : draw_ctx->clip_area->x2 - pos->x + 1;
+    int32_t row_start = pos->y >= draw_ctx->clip_area->y1 ? 0 : draw_ctx->clip_area->y1 - pos->y;
+    int32_t row_end   = pos->y + box_h <= draw_ctx->clip_area->y2 ? box_h : draw_ctx->clip_area->y2 - pos->y + 1;
+
+    /*Only the clipped area is rendered and read by `draw_letter_normal`*/
+    uint8_t * bitmap = lv_malloc(box_w * box_h);
+    LV_ASSERT_MALLOC(bitmap);
+    if(bitmap == NULL) return;
+
+    int32_t row, col;
+    for(row = row_start; row < row_end; row++) {
+        uint8_t * bitmap_row = bitmap + row * box_w;
+        int32_t y = glyph->y0 + row * glyph->step;
+        int32_t x = glyph->x0 + col_start * glyph->step;
+        for(col = col_start; col < col_end; col++) {
+            /*The edge is at 128. Linear ramp around it with 1 pixel width.*/
+            int32_t d = sdf_sample(glyph, x, y) - (128 << 8);
+            int32_t v = ((d * glyph->sharpness) >> 16) + 128;
+            bitmap_row[col] = v <= 0 ? 0 : (v >= 255 ? 255 : v);
+            x += glyph->step;
+        }
+    }
+
+    lv_font_glyph_dsc_t g_a8 = *g;
+    g_a8.bpp = 8;
+    draw_letter_normal(draw_ctx, dsc, pos, &g_a8, bitmap);
+
+    lv_free(bitmap);
+}
+#endif /*LV_USE_FONT_SDF*/
+
 #endif /*LV_USE_DRAW_SW*/
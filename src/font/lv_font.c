@@ -20,13 +20,35 @@
  *      TYPEDEFS
  **********************/
 
+#if LV_FONT_FALLBACK_CACHE_SIZE
+typedef struct {
+    const lv_font_t * font;         /*The font whose fallback chain was searched*/
+    const lv_font_t * resolved;     /*The font where the glyph was found or NULL if it's missing*/
+    uintptr_t chain_id;             /*Identifies the fallback chain of `font` at the time of the search*/
+    uint32_t chain_mask;            /*A bit of each font in the chain. Used to find the entries to invalidate*/
+    uint32_t letter;
+    uint8_t is_placeholder : 1;
+} fallback_cache_entry_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static const lv_font_t * find_glyph(const lv_font_t * font_p, lv_font_glyph_dsc_t * dsc_out, uint32_t letter,
+                                    uint32_t letter_next);
+#if LV_FONT_FALLBACK_CACHE_SIZE
+static const lv_font_t * find_glyph_cached(const lv_font_t * font_p, lv_font_glyph_dsc_t * dsc_out, uint32_t letter,
+                                           uint32_t letter_next);
+static uintptr_t get_chain_id(const lv_font_t * font_p, uint32_t * mask);
+static uint32_t get_font_bit(const lv_font_t * font_p);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_FONT_FALLBACK_CACHE_SIZE
+static fallback_cache_entry_t fallback_cache[LV_FONT_FALLBACK_CACHE_SIZE];
+#endif
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -68,37 +90,20 @@ bool lv_font_get_glyph_dsc(const lv_font_t * font_p, lv_font_glyph_dsc_t * dsc_o
     LV_ASSERT_NULL(font_p);
     LV_ASSERT_NULL(dsc_out);
 
-#if LV_USE_FONT_PLACEHOLDER
-    const lv_font_t * placeholder_font = NULL;
-#endif
-
-    const lv_font_t * f = font_p;
-
     dsc_out->resolved_font = NULL;
 
-    while(f) {
-        bool found = f->get_glyph_dsc(f, dsc_out, letter, letter_next);
-        if(found) {
-            if(!dsc_out->is_placeholder) {
-                dsc_out->resolved_font = f;
-                return true;
-            }
-#if LV_USE_FONT_PLACEHOLDER
-            else if(placeholder_font == NULL) {
-                placeholder_font = f;
-            }
+#if LV_FONT_FALLBACK_CACHE_SIZE
+    /*Without fallback fonts there is nothing to save*/
+    const lv_font_t * f = font_p->fallback ? find_glyph_cached(font_p, dsc_out, letter, letter_next) :
+                          find_glyph(font_p, dsc_out, letter, letter_next);
+#else
+    const lv_font_t * f = find_glyph(font_p, dsc_out, letter, letter_next);
 #endif
-        }
-        f = f->fallback;
-    }
 
-#if LV_USE_FONT_PLACEHOLDER
-    if(placeholder_font != NULL) {
-        placeholder_font->get_glyph_dsc(placeholder_font, dsc_out, letter, letter_next);
-        dsc_out->resolved_font = placeholder_font;
+    if(f) {
+        dsc_out->resolved_font = f;
         return true;
     }
-#endif
 
     if(letter < 0x20 ||
        letter == 0xf8ff || /*LV_SYMBOL_DUMMY*/
@@ -141,6 +146,122 @@ uint16_t lv_font_get_glyph_width(const lv_font_t * font, uint32_t letter, uint32
     return g.adv_w;
 }
 
+void lv_font_fallback_cache_invalidate(const lv_font_t * font)
+{
+#if LV_FONT_FALLBACK_CACHE_SIZE
+    uint32_t font_bit = font ? get_font_bit(font) : 0xFFFFFFFF;
+    uint32_t i;
+    for(i = 0; i < LV_FONT_FALLBACK_CACHE_SIZE; i++) {
+        fallback_cache_entry_t * entry = &fallback_cache[i];
+        if(entry->chain_mask & font_bit) {
+            entry->font = NULL;
+            entry->chain_mask = 0;
+        }
+    }
+#else
+    LV_UNUSED(font);
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+/**
+ * Search the glyph in the font and in its fallback fonts.
+ * @return the font where the glyph was found or NULL if it's missing. If found `dsc_out` is loaded.
+ */
+static const lv_font_t * find_glyph(const lv_font_t * font_p, lv_font_glyph_dsc_t * dsc_out, uint32_t letter,
+                                    uint32_t letter_next)
+{
+#if LV_USE_FONT_PLACEHOLDER
+    const lv_font_t * placeholder_font = NULL;
+#endif
+
+    const lv_font_t * f = font_p;
+
+    while(f) {
+        bool found = f->get_glyph_dsc(f, dsc_out, letter, letter_next);
+        if(found) {
+            if(!dsc_out->is_placeholder) {
+                return f;
+            }
+#if LV_USE_FONT_PLACEHOLDER
+            else if(placeholder_font == NULL) {
+                placeholder_font = f;
+            }
+#endif
+        }
+        f = f->fallback;
+    }
+
+#if LV_USE_FONT_PLACEHOLDER
+    if(placeholder_font != NULL) {
+        placeholder_font->get_glyph_dsc(placeholder_font, dsc_out, letter, letter_next);
+        return placeholder_font;
+    }
+#endif
+
+    return NULL;
+}
+
+#if LV_FONT_FALLBACK_CACHE_SIZE
+/**
+ * Like `find_glyph()` but remember which font of the fallback chain has the glyph
+ * to avoid searching all the fonts again next time.
+ */
+static const lv_font_t * find_glyph_cached(const lv_font_t * font_p, lv_font_glyph_dsc_t * dsc_out, uint32_t letter,
+                                           uint32_t letter_next)
+{
+    uint32_t chain_mask;
+    uintptr_t chain_id = get_chain_id(font_p, &chain_mask);
+    uint32_t hash = (uint32_t)((uintptr_t)font_p >> 2) ^ (letter * 2654435761U);
+    fallback_cache_entry_t * entry = &fallback_cache[hash % LV_FONT_FALLBACK_CACHE_SIZE];
+
+    if(entry->font == font_p && entry->letter == letter && entry->chain_id == chain_id) {
+        const lv_font_t * f = entry->resolved;
+        if(f == NULL) return NULL;
+
+        if(f->get_glyph_dsc(f, dsc_out, letter, letter_next) && dsc_out->is_placeholder == entry->is_placeholder) {
+            return f;
+        }
+        /*The font has changed since then, search the glyph again*/
+    }
+
+    const lv_font_t * f = find_glyph(font_p, dsc_out, letter, letter_next);
+
+    entry->font = font_p;
+    entry->letter = letter;
+    entry->chain_id = chain_id;
+    entry->chain_mask = chain_mask;
+    entry->resolved = f;
+    entry->is_placeholder = f ? dsc_out->is_placeholder : 0;
+
+    return f;
+}
+
+/**
+ * Get a value which changes if any font of the fallback chain is replaced
+ * @param font_p    the first font of the chain
+ * @param mask      store the bits of all the fonts of the chain here
+ * @return          the ID of the chain
+ */
+static uintptr_t get_chain_id(const lv_font_t * font_p, uint32_t * mask)
+{
+    uintptr_t id = 0;
+    *mask = get_font_bit(font_p);
+    const lv_font_t * f;
+    for(f = font_p->fallback; f; f = f->fallback) {
+        id = id * 31 + (uintptr_t)f;
+        *mask |= get_font_bit(f);
+    }
+
+    return id;
+}
+
+static uint32_t get_font_bit(const lv_font_t * font_p)
+{
+    uint32_t hash = (uint32_t)((uintptr_t)font_p >> 3) * 2654435761U;
+    return (uint32_t)1 << (hash >> 27);
+}
+#endif /*LV_FONT_FALLBACK_CACHE_SIZE*/
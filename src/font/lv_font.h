@@ -28,6 +28,9 @@ extern "C" {
 /* imgfont identifier */
 #define LV_IMGFONT_BPP 9
 
+/* signed distance field font identifier */
+#define LV_FONT_SDF_BPP 10
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -118,6 +121,14 @@ bool lv_font_get_glyph_dsc(const lv_font_t * font_p, lv_font_glyph_dsc_t * dsc_o
  */
 uint16_t lv_font_get_glyph_width(const lv_font_t * font, uint32_t letter, uint32_t letter_next);
 
+/**
+ * Forget where the glyphs were found in the fallback chains.
+ * Needs to be called if a font is deleted or its glyphs are changed.
+ * Changing `fallback` is detected automatically.
+ * @param font      remove the entries whose fallback chain contains this font. NULL: remove all entries.
+ */
+void lv_font_fallback_cache_invalidate(const lv_font_t * font);
+
 /**
  * Get the line height of a font. All characters fit into this height
  * @param font_p pointer to a font
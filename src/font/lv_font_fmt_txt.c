@@ -86,8 +86,15 @@ const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t * font, uint32_t unic
 
     const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
 
+    const uint8_t * bitmap;
+    if(fdsc->glyph_bitmap) bitmap = &fdsc->glyph_bitmap[gdsc->bitmap_index];
+    else if(fdsc->get_glyph_bitmap_cb) bitmap = fdsc->get_glyph_bitmap_cb(font, gid);
+    else bitmap = NULL;
+
+    if(bitmap == NULL) return NULL;
+
     if(fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN) {
-        return &fdsc->glyph_bitmap[gdsc->bitmap_index];
+        return bitmap;
     }
     /*Handle compressed bitmap*/
     else {
@@ -124,7 +131,7 @@ const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t * font, uint32_t unic
         }
 
         bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED ? true : false;
-        decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], LV_GC_ROOT(_lv_font_decompr_buf), gdsc->box_w, gdsc->box_h,
+        decompress(bitmap, LV_GC_ROOT(_lv_font_decompr_buf), gdsc->box_w, gdsc->box_h,
                    (uint8_t)fdsc->bpp, prefilter);
         return LV_GC_ROOT(_lv_font_decompr_buf);
 #else /*!LV_USE_FONT_COMPRESSED*/
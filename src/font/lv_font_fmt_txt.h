@@ -200,6 +200,10 @@ typedef struct {
 
     /*Cache the last letter and is glyph id*/
     lv_font_fmt_txt_glyph_cache_t * cache;
+
+    /*Get the bitmap of a glyph (as it's stored in `glyph_bitmap`) if `glyph_bitmap` is NULL.
+     *Used by the fonts whose bitmaps are loaded on demand, see `lv_font_load_lazy()`*/
+    const uint8_t * (*get_glyph_bitmap_cb)(const struct _lv_font_t * font, uint32_t glyph_id);
 } lv_font_fmt_txt_dsc_t;
 
 /**********************
@@ -50,6 +50,33 @@ typedef struct font_header_bin {
     uint16_t underline_thickness;
 } font_header_bin_t;
 
+/*A glyph bitmap loaded by a lazy font*/
+typedef struct _lazy_glyph_t {
+    struct _lazy_glyph_t * hash_next;   /*The next glyph in the same hash bucket*/
+    uint8_t * bmp;
+    uint32_t glyph_id;
+    uint32_t size;
+} lazy_glyph_t;
+
+/*Descriptor of the fonts loaded by `lv_font_load_lazy()`*/
+typedef struct {
+    lv_font_fmt_txt_dsc_t dsc;      /*Must be the first as it's used as `font->dsc`*/
+    lv_fs_file_t file;              /*The font file, open until the font is freed*/
+    const uint8_t * map;            /*The mapped font file or NULL*/
+    uint32_t map_size;
+    uint32_t * glyph_offset;        /*Offset of the glyphs in the `glyf` table*/
+    uint32_t glyph_cnt;
+    uint32_t glyph_start;           /*Start of the `glyf` table in the file*/
+    uint32_t glyph_length;          /*Length of the `glyf` table*/
+    uint8_t header_bits;            /*Number of bits before the bitmap of the glyphs*/
+    lv_ll_t glyph_ll;               /*The cached glyphs. The most recently used is the head.*/
+    lazy_glyph_t ** buckets;        /*Hash table of the cached glyphs by glyph ID*/
+    uint32_t bucket_cnt;            /*Always a power of 2*/
+    uint32_t glyph_cached_cnt;
+    uint32_t mem_size;
+    uint32_t mem_size_max;
+} lazy_font_dsc_t;
+
 typedef struct cmap_table_bin {
     uint32_t data_offset;
     uint32_t range_start;
@@ -64,7 +91,11 @@ typedef struct cmap_table_bin {
  *  STATIC PROTOTYPES
  **********************/
 static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp);
-static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font);
+static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font, bool lazy);
+static const uint8_t * lazy_get_glyph_bitmap(const lv_font_t * font, uint32_t glyph_id);
+static void lazy_glyph_free(lazy_font_dsc_t * lazy, lazy_glyph_t * glyph);
+static bool lazy_buckets_resize(lazy_font_dsc_t * lazy, uint32_t bucket_cnt);
+static void lazy_free(lazy_font_dsc_t * lazy);
 int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start);
 
 static int read_bits_signed(bit_iterator_t * it, int n_bits, lv_fs_res_t * res);
@@ -93,7 +124,7 @@ lv_font_t * lv_font_load(const char * font_name)
     lv_font_t * font = lv_malloc(sizeof(lv_font_t));
     if(font) {
         memset(font, 0, sizeof(lv_font_t));
-        if(!lvgl_load_font(&file, font)) {
+        if(!lvgl_load_font(&file, font, false)) {
             LV_LOG_WARN("Error loading font file: %s\n", font_name);
             /*
             * When `lvgl_load_font` fails it can leak some pointers.
@@ -110,6 +141,52 @@ lv_font_t * lv_font_load(const char * font_name)
     return font;
 }
 
+/**
+ * Loads a `lv_font_t` object from a binary font file but keeps only the glyph descriptors,
+ * character maps and kerning tables in the memory. The bitmap of a glyph is read from the file
+ * when it's drawn, or used directly from the file if it can be mapped to the memory with `lv_fs_mmap()`.
+ * The file remains open until the font is freed by `lv_font_free()`, so it must not be modified meanwhile.
+ * @param font_name filename where the font file is located
+ * @param cache_size the maximal memory in bytes used to keep the recently drawn glyph bitmaps.
+ *                   Not used if the bitmaps can be used directly from the mapped file.
+ * @return a pointer to the font or NULL in case of error
+ */
+lv_font_t * lv_font_load_lazy(const char * font_name, uint32_t cache_size)
+{
+    lv_fs_file_t file;
+    lv_fs_res_t res = lv_fs_open(&file, font_name, LV_FS_MODE_RD);
+    if(res != LV_FS_RES_OK)
+        return NULL;
+
+    lv_font_t * font = lv_malloc(sizeof(lv_font_t));
+    if(font == NULL) {
+        lv_fs_close(&file);
+        return NULL;
+    }
+
+    memset(font, 0, sizeof(lv_font_t));
+    if(!lvgl_load_font(&file, font, true)) {
+        LV_LOG_WARN("Error loading font file: %s\n", font_name);
+        lv_font_free(font);
+        lv_fs_close(&file);
+        return NULL;
+    }
+
+    /*The font owns the file from now on*/
+    lazy_font_dsc_t * lazy = (lazy_font_dsc_t *)font->dsc;
+    lazy->file = file;
+    lazy->mem_size_max = cache_size;
+
+    const void * map;
+    uint32_t map_size;
+    if(lv_fs_mmap(&lazy->file, &map, &map_size) == LV_FS_RES_OK) {
+        lazy->map = map;
+        lazy->map_size = map_size;
+    }
+
+    return font;
+}
+
 /**
  * Frees the memory allocated by the `lv_font_load()` function
  * @param font lv_font_t object created by the lv_font_load function
@@ -117,9 +194,13 @@ lv_font_t * lv_font_load(const char * font_name)
 void lv_font_free(lv_font_t * font)
 {
     if(NULL != font) {
+        lv_font_fallback_cache_invalidate(font);
         lv_font_fmt_txt_dsc_t * dsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
 
         if(NULL != dsc) {
+            if(dsc->get_glyph_bitmap_cb == lazy_get_glyph_bitmap) {
+                lazy_free((lazy_font_dsc_t *)dsc);
+            }
 
             if(dsc->kern_classes == 0) {
                 lv_font_fmt_txt_kern_pair_t * kern_dsc =
@@ -336,7 +417,8 @@ static int32_t load_cmaps(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, u
 }
 
 static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
-                          uint32_t start, uint32_t * glyph_offset, uint32_t loca_count, font_header_bin_t * header)
+                          uint32_t start, uint32_t * glyph_offset, uint32_t loca_count, font_header_bin_t * header,
+                          bool lazy)
 {
     int32_t glyph_length = read_label(fp, start, "glyf");
     if(glyph_length < 0) {
@@ -414,6 +496,9 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
         }
     }
 
+    /*The bitmaps will be read when they are needed*/
+    if(lazy) return glyph_length;
+
     uint8_t * glyph_bmp = (uint8_t *)lv_malloc(sizeof(uint8_t) * cur_bmp_size);
 
     font_dsc->glyph_bitmap = glyph_bmp;
@@ -480,15 +565,22 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
  * `lv_font_free` will assume that all non-null pointers are allocated and
  * should be freed.
  */
-static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
+static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font, bool lazy)
 {
-    lv_font_fmt_txt_dsc_t * font_dsc = (lv_font_fmt_txt_dsc_t *)
-                                       lv_malloc(sizeof(lv_font_fmt_txt_dsc_t));
+    size_t dsc_size = lazy ? sizeof(lazy_font_dsc_t) : sizeof(lv_font_fmt_txt_dsc_t);
+    lv_font_fmt_txt_dsc_t * font_dsc = (lv_font_fmt_txt_dsc_t *)lv_malloc(dsc_size);
+    LV_ASSERT_MALLOC(font_dsc);
+    if(font_dsc == NULL) return false;
 
-    memset(font_dsc, 0, sizeof(lv_font_fmt_txt_dsc_t));
+    memset(font_dsc, 0, dsc_size);
 
     font->dsc = font_dsc;
 
+    if(lazy) {
+        font_dsc->get_glyph_bitmap_cb = lazy_get_glyph_bitmap;
+        _lv_ll_init(&((lazy_font_dsc_t *)font_dsc)->glyph_ll, sizeof(lazy_glyph_t));
+    }
+
     /*header*/
     int32_t header_length = read_label(fp, 0, "head");
     if(header_length < 0) {
@@ -562,9 +654,20 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
     /*glyph*/
     uint32_t glyph_start = loca_start + loca_length;
     int32_t glyph_length = load_glyph(
-                               fp, font_dsc, glyph_start, glyph_offset, loca_count, &font_header);
-
-    lv_free(glyph_offset);
+                               fp, font_dsc, glyph_start, glyph_offset, loca_count, &font_header, lazy);
+
+    if(lazy) {
+        /*Needed to find the bitmaps later*/
+        lazy_font_dsc_t * lazy_dsc = (lazy_font_dsc_t *)font_dsc;
+        lazy_dsc->glyph_offset = glyph_offset;
+        lazy_dsc->glyph_cnt = loca_count;
+        lazy_dsc->glyph_start = glyph_start;
+        lazy_dsc->glyph_length = glyph_length;
+        lazy_dsc->header_bits = font_header.advance_width_bits + 2 * font_header.xy_bits + 2 * font_header.wh_bits;
+    }
+    else {
+        lv_free(glyph_offset);
+    }
 
     if(glyph_length < 0) {
         return false;
@@ -679,3 +782,148 @@ int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t f
 
     return kern_length;
 }
+
+/**
+ * Used as `get_glyph_bitmap_cb` of the fonts loaded by `lv_font_load_lazy()`.
+ * Return the bitmap of a glyph from the mapped file or read it to the cache.
+ */
+static const uint8_t * lazy_get_glyph_bitmap(const lv_font_t * font, uint32_t glyph_id)
+{
+    lazy_font_dsc_t * lazy = (lazy_font_dsc_t *)font->dsc;
+    if(glyph_id >= lazy->glyph_cnt) return NULL;
+
+    uint32_t next_offset = glyph_id + 1 < lazy->glyph_cnt ? lazy->glyph_offset[glyph_id + 1] : lazy->glyph_length;
+    uint32_t bmp_start = lazy->glyph_start + lazy->glyph_offset[glyph_id] + lazy->header_bits / 8;
+    uint32_t bmp_size = lazy->glyph_start + next_offset - bmp_start;
+    uint8_t shift = lazy->header_bits % 8;
+
+    if(lazy->map && bmp_start + bmp_size > lazy->map_size) return NULL;
+
+    /*Byte aligned bitmaps can be used from the mapped file directly*/
+    if(lazy->map && shift == 0) return lazy->map + bmp_start;
+
+    lazy_glyph_t * glyph;
+    if(lazy->bucket_cnt) {
+        for(glyph = lazy->buckets[glyph_id & (lazy->bucket_cnt - 1)]; glyph; glyph = glyph->hash_next) {
+            if(glyph->glyph_id == glyph_id) {
+                _lv_ll_move_before(&lazy->glyph_ll, glyph, _lv_ll_get_head(&lazy->glyph_ll));
+                return glyph->bmp;
+            }
+        }
+    }
+
+    /*Use about 1 bucket for each glyph. The glyph IDs are consecutive so they are used as hash.*/
+    if(lazy->glyph_cached_cnt + 1 > lazy->bucket_cnt) {
+        if(!lazy_buckets_resize(lazy, lazy->bucket_cnt ? lazy->bucket_cnt * 2 : 16) && lazy->bucket_cnt == 0) {
+            return NULL;
+        }
+    }
+
+    /*Free the least recently used glyphs. The new one is added even if it's larger than the cache.*/
+    uint32_t glyph_mem_size = sizeof(lazy_glyph_t) + bmp_size;
+    while(lazy->mem_size + glyph_mem_size > lazy->mem_size_max) {
+        lazy_glyph_t * tail = _lv_ll_get_tail(&lazy->glyph_ll);
+        if(tail == NULL) break;
+        lazy_glyph_free(lazy, tail);
+    }
+
+    uint8_t * bmp = lv_malloc(LV_MAX(bmp_size, 1));
+    LV_ASSERT_MALLOC(bmp);
+    if(bmp == NULL) return NULL;
+
+    if(lazy->map) {
+        lv_memcpy(bmp, lazy->map + bmp_start, bmp_size);
+    }
+    else {
+        uint32_t br = 0;
+        lv_fs_res_t res = lv_fs_seek(&lazy->file, bmp_start, LV_FS_SEEK_SET);
+        if(res == LV_FS_RES_OK) res = lv_fs_read(&lazy->file, bmp, bmp_size, &br);
+        if(res != LV_FS_RES_OK || br != bmp_size) {
+            LV_LOG_WARN("Couldn't read the bitmap of glyph %" LV_PRIu32, glyph_id);
+            lv_free(bmp);
+            return NULL;
+        }
+    }
+
+    /*The bitmap starts after the header bits. Shift it to the MSB as `load_glyph()` does.*/
+    if(shift && bmp_size) {
+        uint32_t k;
+        for(k = 0; k < bmp_size - 1; k++) {
+            bmp[k] = (uint8_t)((bmp[k] << shift) | (bmp[k + 1] >> (8 - shift)));
+        }
+        bmp[bmp_size - 1] = (uint8_t)(bmp[bmp_size - 1] << shift);
+    }
+
+    glyph = _lv_ll_ins_head(&lazy->glyph_ll);
+    LV_ASSERT_MALLOC(glyph);
+    if(glyph == NULL) {
+        lv_free(bmp);
+        return NULL;
+    }
+
+    glyph->glyph_id = glyph_id;
+    glyph->size = bmp_size;
+    glyph->bmp = bmp;
+    lazy_glyph_t ** bucket = &lazy->buckets[glyph_id & (lazy->bucket_cnt - 1)];
+    glyph->hash_next = *bucket;
+    *bucket = glyph;
+    lazy->glyph_cached_cnt++;
+    lazy->mem_size += glyph_mem_size;
+
+    return bmp;
+}
+
+/**
+ * Remove a glyph from the hash table and the LRU list of a lazy font and free it
+ */
+static void lazy_glyph_free(lazy_font_dsc_t * lazy, lazy_glyph_t * glyph)
+{
+    lazy_glyph_t ** link = &lazy->buckets[glyph->glyph_id & (lazy->bucket_cnt - 1)];
+    while(*link != glyph) link = &(*link)->hash_next;
+    *link = glyph->hash_next;
+
+    lazy->glyph_cached_cnt--;
+    lazy->mem_size -= sizeof(lazy_glyph_t) + glyph->size;
+    lv_free(glyph->bmp);
+    _lv_ll_remove(&lazy->glyph_ll, glyph);
+    lv_free(glyph);
+}
+
+/**
+ * Reallocate the hash table of a lazy font and add the cached glyphs to the new buckets
+ * @return      false if out of memory, the old hash table is kept then
+ */
+static bool lazy_buckets_resize(lazy_font_dsc_t * lazy, uint32_t bucket_cnt)
+{
+    lazy_glyph_t ** buckets = lv_malloc(bucket_cnt * sizeof(lazy_glyph_t *));
+    LV_ASSERT_MALLOC(buckets);
+    if(buckets == NULL) return false;
+
+    lv_memzero(buckets, bucket_cnt * sizeof(lazy_glyph_t *));
+    lv_free(lazy->buckets);
+    lazy->buckets = buckets;
+    lazy->bucket_cnt = bucket_cnt;
+
+    lazy_glyph_t * glyph;
+    _LV_LL_READ(&lazy->glyph_ll, glyph) {
+        lazy_glyph_t ** bucket = &buckets[glyph->glyph_id & (bucket_cnt - 1)];
+        glyph->hash_next = *bucket;
+        *bucket = glyph;
+    }
+
+    return true;
+}
+
+static void lazy_free(lazy_font_dsc_t * lazy)
+{
+    lazy_glyph_t * glyph;
+    _LV_LL_READ(&lazy->glyph_ll, glyph) {
+        lv_free(glyph->bmp);
+    }
+    _lv_ll_clear(&lazy->glyph_ll);
+    lv_free(lazy->buckets);
+
+    if(lazy->map) lv_fs_munmap(&lazy->file, lazy->map, lazy->map_size);
+    if(lazy->file.drv) lv_fs_close(&lazy->file);
+    lv_free(lazy->glyph_offset);
+}
@@ -0,0 +1,174 @@
+/**
+ * @file lv_font_sdf.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_font_sdf.h"
+#if LV_USE_FONT_SDF
+
+#include "../misc/lv_assert.h"
+#include "../misc/lv_mem.h"
+#include "../misc/lv_math.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    lv_font_t font;
+    const lv_font_sdf_src_t * src;
+    uint16_t size;
+    lv_font_sdf_glyph_t glyph;      /*The glyph returned by the last `get_glyph_bitmap` call*/
+} lv_font_sdf_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool sdf_get_glyph_dsc(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t letter,
+                              uint32_t letter_next);
+static const uint8_t * sdf_get_glyph_bitmap(const lv_font_t * font, uint32_t letter);
+static int32_t scale_floor(const lv_font_sdf_t * sdf, int32_t v);
+static int32_t scale_ceil(const lv_font_sdf_t * sdf, int32_t v);
+static int32_t scale_round(const lv_font_sdf_t * sdf, int32_t v);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_font_t * lv_font_sdf_create(const lv_font_sdf_src_t * src, uint16_t size)
+{
+    LV_ASSERT_NULL(src);
+    if(size == 0 || src->size == 0 || src->spread == 0) {
+        LV_LOG_WARN("invalid size or spread");
+        return NULL;
+    }
+
+    lv_font_sdf_t * sdf = lv_malloc(sizeof(lv_font_sdf_t));
+    LV_ASSERT_MALLOC(sdf);
+    if(sdf == NULL) return NULL;
+    lv_memzero(sdf, sizeof(lv_font_sdf_t));
+
+    sdf->src = src;
+    sdf->size = size;
+
+    const lv_font_t * src_font = src->font;
+    lv_font_t * font = &sdf->font;
+    font->get_glyph_dsc = sdf_get_glyph_dsc;
+    font->get_glyph_bitmap = sdf_get_glyph_bitmap;
+    font->line_height = scale_round(sdf, src_font->line_height);
+    font->base_line = scale_round(sdf, src_font->base_line);
+    font->subpx = LV_FONT_SUBPX_NONE;
+    font->underline_position = scale_round(sdf, src_font->underline_position);
+    font->underline_thickness = LV_MAX(scale_round(sdf, src_font->underline_thickness), 1);
+    font->dsc = sdf;
+
+    return font;
+}
+
+void lv_font_sdf_del(lv_font_t * font)
+{
+    LV_ASSERT_NULL(font);
+    lv_font_fallback_cache_invalidate(font);
+    lv_free((lv_font_sdf_t *)font->dsc);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Get the glyph from the SDF font and scale its box to cover all the touched pixels
+ */
+static bool sdf_get_glyph_dsc(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t letter,
+                              uint32_t letter_next)
+{
+    const lv_font_sdf_t * sdf = font->dsc;
+    const lv_font_t * src_font = sdf->src->font;
+    if(!src_font->get_glyph_dsc(src_font, dsc_out, letter, letter_next)) return false;
+
+    dsc_out->adv_w = scale_round(sdf, dsc_out->adv_w);
+
+    if(dsc_out->box_w && dsc_out->box_h) {
+        int32_t x1 = scale_floor(sdf, dsc_out->ofs_x);
+        int32_t x2 = scale_ceil(sdf, dsc_out->ofs_x + dsc_out->box_w);
+        int32_t y1 = scale_floor(sdf, dsc_out->ofs_y);
+        int32_t y2 = scale_ceil(sdf, dsc_out->ofs_y + dsc_out->box_h);
+        dsc_out->ofs_x = x1;
+        dsc_out->ofs_y = y1;
+        dsc_out->box_w = x2 - x1;
+        dsc_out->box_h = y2 - y1;
+    }
+
+    dsc_out->bpp = LV_FONT_SDF_BPP;
+    return true;
+}
+
+/**
+ * Return a `lv_font_sdf_glyph_t` describing how to sample the distance field
+ */
+static const uint8_t * sdf_get_glyph_bitmap(const lv_font_t * font, uint32_t letter)
+{
+    lv_font_sdf_t * sdf = (lv_font_sdf_t *)font->dsc;
+    const lv_font_t * src_font = sdf->src->font;
+
+    lv_font_glyph_dsc_t g;
+    if(!src_font->get_glyph_dsc(src_font, &g, letter, 0)) return NULL;
+    const uint8_t * map = src_font->get_glyph_bitmap(src_font, letter);
+    if(map == NULL) return NULL;
+
+    /*Top left corner of the scaled box*/
+    int32_t x1 = scale_floor(sdf, g.ofs_x);
+    int32_t y2 = scale_ceil(sdf, g.ofs_y + g.box_h);
+
+    /*Map the centers of the pixels to the distance field.
+     *X grows to the right from `ofs_x` and Y grows downward from `ofs_y + box_h`*/
+    int32_t src_size = sdf->src->size;
+    lv_font_sdf_glyph_t * glyph = &sdf->glyph;
+    glyph->map = map;
+    glyph->w = g.box_w;
+    glyph->h = g.box_h;
+    glyph->step = (src_size * 256) / sdf->size;
+    glyph->x0 = ((2 * x1 + 1) * src_size * 128) / sdf->size - g.ofs_x * 256 - 128;
+    glyph->y0 = (g.ofs_y + g.box_h) * 256 - 128 - ((2 * y2 - 1) * src_size * 128) / sdf->size;
+
+    /*A pixel far from the edge by half pixel is fully covered*/
+    int32_t sharpness = (255 * sdf->src->spread * sdf->size * 256) / (127 * src_size);
+    glyph->sharpness = LV_MIN(sharpness, 0xFFFF);
+
+    return (const uint8_t *)glyph;
+}
+
+static int32_t scale_floor(const lv_font_sdf_t * sdf, int32_t v)
+{
+    int32_t p = v * sdf->size;
+    int32_t d = sdf->src->size;
+    return p >= 0 ? p / d : -((-p + d - 1) / d);
+}
+
+static int32_t scale_ceil(const lv_font_sdf_t * sdf, int32_t v)
+{
+    return -scale_floor(sdf, -v);
+}
+
+static int32_t scale_round(const lv_font_sdf_t * sdf, int32_t v)
+{
+    int32_t p = v * sdf->size;
+    int32_t d = sdf->src->size;
+    return p >= 0 ? (p + d / 2) / d : -((-p + d / 2) / d);
+}
+
+#endif /*LV_USE_FONT_SDF*/
@@ -0,0 +1,83 @@
+/**
+ * @file lv_font_sdf.h
+ * Fonts with signed distance field glyphs. One font can be drawn in any size
+ * as the edges of the glyphs are interpolated from the distance fields.
+ */
+
+#ifndef LV_FONT_SDF_H
+#define LV_FONT_SDF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_font.h"
+
+#if LV_USE_FONT_SDF
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Describes a font created by `scripts/sdf_font_conv.py`
+ */
+typedef struct {
+    const lv_font_t * font;     /**< 8 bpp font whose glyphs are distance fields. The edges are at 128.*/
+    uint16_t size;              /**< The size of the font in px*/
+    uint8_t spread;             /**< Distance from the edges in px which belongs to a difference of 127*/
+} lv_font_sdf_src_t;
+
+/**
+ * The bitmap of the glyphs of the SDF fonts.
+ * The sizes and coordinates are in the distance field's pixels.
+ */
+typedef struct {
+    const uint8_t * map;        /**< The distance field, 1 byte per pixel*/
+    uint16_t w;                 /**< Width of the distance field*/
+    uint16_t h;                 /**< Height of the distance field*/
+    int32_t x0;                 /**< X coordinate of the top left pixel's center [1/256 px]*/
+    int32_t y0;                 /**< Y coordinate of the top left pixel's center [1/256 px]*/
+    int32_t step;               /**< Distance between the centers of two pixels [1/256 px]*/
+    int32_t sharpness;          /**< Opacity change caused by a unit change of the distance [1/256]*/
+} lv_font_sdf_glyph_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create a font with the given size from an SDF font.
+ * The glyphs are drawn with `LV_FONT_SDF_BPP` which needs a draw unit supporting it (e.g. the software renderer).
+ * @param src       pointer to an SDF font. Only its pointer is saved.
+ * @param size      the size of the new font in px
+ * @return          the new font or NULL on error
+ */
+lv_font_t * lv_font_sdf_create(const lv_font_sdf_src_t * src, uint16_t size);
+
+/**
+ * Delete a font created by `lv_font_sdf_create()`
+ * @param font      pointer to a font
+ */
+void lv_font_sdf_del(lv_font_t * font);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#define LV_FONT_SDF_DECLARE(font_name) extern const lv_font_sdf_src_t font_name;
+
+#endif /*LV_USE_FONT_SDF*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_FONT_SDF_H*/
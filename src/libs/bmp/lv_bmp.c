@@ -38,6 +38,11 @@ static lv_res_t decoder_open(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc)
 static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc,
                                   lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t * buf);
 
+static lv_res_t decoder_read_tile(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc,
+                                  const lv_area_t * area, uint8_t * buf);
+
+static void convert_line(bmp_dsc_t * b, uint8_t * buf, lv_coord_t len);
+
 static void decoder_close(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc);
 
 /**********************
@@ -57,7 +62,9 @@ void lv_bmp_init(void)
     lv_img_decoder_set_info_cb(dec, decoder_info);
     lv_img_decoder_set_open_cb(dec, decoder_open);
     lv_img_decoder_set_read_line_cb(dec, decoder_read_line);
+    lv_img_decoder_set_read_tile_cb(dec, decoder_read_tile);
     lv_img_decoder_set_close_cb(dec, decoder_close);
+    lv_img_decoder_set_thread_safe(dec, true);
 }
 
 /**********************
@@ -203,7 +210,71 @@ static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc
     lv_fs_seek(&b->f, p, LV_FS_SEEK_SET);
     lv_fs_read(&b->f, buf, len * (b->bpp / 8), NULL);
 
+    convert_line(b, buf, len);
+
+    return LV_RES_OK;
+}
+
+/**
+ * Read an area of the image. The rows are read with one file operation if possible.
+ */
+static lv_res_t decoder_read_tile(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc,
+                                  const lv_area_t * area, uint8_t * buf)
+{
+    LV_UNUSED(decoder);
+
+    bmp_dsc_t * b = dsc->user_data;
+    lv_coord_t w = lv_area_get_width(area);
+    lv_coord_t h = lv_area_get_height(area);
+    uint32_t len = w * (b->bpp / 8);
+    uint32_t buf_stride = w * lv_color_format_get_size(dsc->header.cf);
+
+    /*BMP images are stored upside down, so the last row of the area is the first in the file*/
+    uint32_t p = b->px_offset + b->row_size_bytes * ((b->px_height - 1) - area->y2);
+    p += area->x1 * (b->bpp / 8);
+
+    /*Read the rows at once if it's not much more than the pixels in the area*/
+    uint32_t span = b->row_size_bytes * (h - 1) + len;
+    uint8_t * span_buf = NULL;
+    if(h > 1 && span <= len * h * 2) span_buf = lv_malloc(span);
+
+    if(span_buf) {
+        uint32_t br = 0;
+        lv_fs_res_t res = lv_fs_seek(&b->f, p, LV_FS_SEEK_SET);
+        if(res == LV_FS_RES_OK) res = lv_fs_read(&b->f, span_buf, span, &br);
+        if(res != LV_FS_RES_OK || br != span) {
+            lv_free(span_buf);
+            return LV_RES_INV;
+        }
+
+        lv_coord_t i;
+        for(i = 0; i < h; i++) {
+            uint8_t * row_buf = buf + i * buf_stride;
+            lv_memcpy(row_buf, span_buf + (h - 1 - i) * b->row_size_bytes, len);
+            convert_line(b, row_buf, w);
+        }
+        lv_free(span_buf);
+        return LV_RES_OK;
+    }
 
+    lv_coord_t i;
+    for(i = h - 1; i >= 0; i--) {
+        uint8_t * row_buf = buf + i * buf_stride;
+        uint32_t br;
+        if(lv_fs_seek(&b->f, p, LV_FS_SEEK_SET) != LV_FS_RES_OK) return LV_RES_INV;
+        if(lv_fs_read(&b->f, row_buf, len, &br) != LV_FS_RES_OK || br != len) return LV_RES_INV;
+        convert_line(b, row_buf, w);
+        p += b->row_size_bytes;
+    }
+
+    return LV_RES_OK;
+}
+
+/**
+ * Convert the pixels read from the file to the color format of the image in place
+ */
+static void convert_line(bmp_dsc_t * b, uint8_t * buf, lv_coord_t len)
+{
 #if LV_COLOR_DEPTH == 32
     if(b->bpp == 32) {
         lv_coord_t i;
@@ -231,9 +302,11 @@ static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc
             c->alpha = 0xff;
         }
     }
+#else
+    LV_UNUSED(b);
+    LV_UNUSED(buf);
+    LV_UNUSED(len);
 #endif
-
-    return LV_RES_OK;
 }
 
 
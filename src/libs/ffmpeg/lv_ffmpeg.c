@@ -33,6 +33,18 @@
 
 #define FRAME_DEF_REFR_PERIOD   33  /*[ms]*/
 
+/*Decode and convert the frames in a separate thread*/
+#define FFMPEG_USE_THREAD       (LV_USE_OS != LV_OS_NONE && LV_FFMPEG_FRAME_QUEUE_CNT > 0)
+
+#if FFMPEG_USE_THREAD
+    /*The queued frames and the shown one*/
+    #define FRAME_BUF_CNT           (LV_FFMPEG_FRAME_QUEUE_CNT + 1)
+    #define DECODER_STACK_SIZE      (128 * 1024)
+
+    /*Convert at most this many late frames in a row to show something even if decoding is too slow*/
+    #define FRAME_DROP_MAX          5
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -50,6 +62,29 @@ struct ffmpeg_context_s {
     int video_dst_linesize[4];
     enum AVPixelFormat video_dst_pix_fmt;
     bool has_alpha;
+    int64_t frame_pts;              /*Presentation time of the last decoded frame [ms]*/
+    int frame_period;               /*[ms]*/
+    bool frame_decoded;             /*A frame was decoded by the last `ffmpeg_update_next_frame()`*/
+    bool frame_dropped;             /*The decoded frame was late so it wasn't converted*/
+#if FFMPEG_USE_THREAD
+    lv_thread_t thread;
+    lv_thread_sync_t sync;          /*Wakes up the decoder thread*/
+    lv_mutex_t lock;                /*Protects the fields below*/
+    uint8_t * frame_bufs[FRAME_BUF_CNT];    /*Ring of converted frames. [0] is `video_dst_data[0]`*/
+    int64_t frame_bufs_pts[FRAME_BUF_CNT];
+    uint32_t frame_rd;              /*The oldest not shown frame. The one before it is shown.*/
+    uint32_t frame_cnt;             /*Number of decoded but not shown frames*/
+    int64_t shown_pts;
+    uint32_t clock_start;           /*Tick when a frame with 0 presentation time should be shown*/
+    uint32_t pause_start;
+    uint32_t drop_cnt;              /*Used only by the decoder thread*/
+    bool thread_started;
+    bool exit_req;
+    bool seek_req;
+    bool eof;
+    bool clock_valid;
+    bool paused;
+#endif
 };
 
 #pragma pack(1)
@@ -81,6 +116,15 @@ static int ffmpeg_update_next_frame(struct ffmpeg_context_s * ffmpeg_ctx);
 static int ffmpeg_output_video_frame(struct ffmpeg_context_s * ffmpeg_ctx);
 static bool ffmpeg_pix_fmt_has_alpha(enum AVPixelFormat pix_fmt);
 static bool ffmpeg_pix_fmt_is_yuv(enum AVPixelFormat pix_fmt);
+static bool ffmpeg_frame_is_late(struct ffmpeg_context_s * ffmpeg_ctx);
+static void ffmpeg_seek_start(struct ffmpeg_context_s * ffmpeg_ctx);
+
+#if FFMPEG_USE_THREAD
+    static int ffmpeg_thread_start(struct ffmpeg_context_s * ffmpeg_ctx);
+    static void ffmpeg_thread_stop(struct ffmpeg_context_s * ffmpeg_ctx);
+    static void ffmpeg_decoder_thread_cb(void * user_data);
+    static void lv_ffmpeg_player_frame_present(lv_obj_t * obj);
+#endif
 
 static void lv_ffmpeg_player_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_ffmpeg_player_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
@@ -114,7 +158,7 @@ void lv_ffmpeg_init(void)
     lv_img_decoder_set_open_cb(dec, decoder_open);
     lv_img_decoder_set_close_cb(dec, decoder_close);
 
-#if LV_FFMPEG_AV_DUMP_FORMAT == 0
+#if LV_FFMPEG_DUMP_FORMAT == 0
     av_log_set_level(AV_LOG_QUIET);
 #endif
 }
@@ -163,6 +207,7 @@ lv_res_t lv_ffmpeg_player_set_src(lv_obj_t * obj, const char * path)
     if(ffmpeg_image_allocate(player->ffmpeg_ctx) < 0) {
         LV_LOG_ERROR("ffmpeg image allocate failed");
         ffmpeg_close(player->ffmpeg_ctx);
+        player->ffmpeg_ctx = NULL;
         goto failed;
     }
 
@@ -192,11 +237,25 @@ lv_res_t lv_ffmpeg_player_set_src(lv_obj_t * obj, const char * path)
     if(period > 0) {
         LV_LOG_INFO("frame refresh period = %d ms, rate = %d fps",
                     period, 1000 / period);
-        lv_timer_set_period(player->timer, period);
     }
     else {
         LV_LOG_WARN("unable to get frame refresh period");
+        period = FRAME_DEF_REFR_PERIOD;
+    }
+
+    player->ffmpeg_ctx->frame_period = period;
+
+#if FFMPEG_USE_THREAD
+    /*The frames are shown by their presentation time so check it more often than the frame rate*/
+    if(ffmpeg_thread_start(player->ffmpeg_ctx) >= 0) {
+        period = LV_MAX(period / 4, 1);
+    }
+    else {
+        LV_LOG_WARN("couldn't start the decoder thread, decoding in the timer");
     }
+#endif
+
+    lv_timer_set_period(player->timer, period);
 
     res = LV_RES_OK;
 
@@ -216,16 +275,31 @@ void lv_ffmpeg_player_set_cmd(lv_obj_t * obj, lv_ffmpeg_player_cmd_t cmd)
 
     lv_timer_t * timer = player->timer;
 
+#if FFMPEG_USE_THREAD
+    struct ffmpeg_context_s * ffmpeg_ctx = player->ffmpeg_ctx;
+    if(ffmpeg_ctx->thread_started) lv_mutex_lock(&ffmpeg_ctx->lock);
+    if(cmd == LV_FFMPEG_PLAYER_CMD_STOP || cmd == LV_FFMPEG_PLAYER_CMD_PAUSE) {
+        ffmpeg_ctx->paused = true;
+        ffmpeg_ctx->pause_start = lv_tick_get();
+    }
+    else if(cmd == LV_FFMPEG_PLAYER_CMD_START || cmd == LV_FFMPEG_PLAYER_CMD_RESUME) {
+        /*Don't count the paused time in the presentation time*/
+        if(ffmpeg_ctx->paused && ffmpeg_ctx->clock_valid) {
+            ffmpeg_ctx->clock_start += lv_tick_elaps(ffmpeg_ctx->pause_start);
+        }
+        ffmpeg_ctx->paused = false;
+    }
+    if(ffmpeg_ctx->thread_started) lv_mutex_unlock(&ffmpeg_ctx->lock);
+#endif
+
     switch(cmd) {
         case LV_FFMPEG_PLAYER_CMD_START:
-            av_seek_frame(player->ffmpeg_ctx->fmt_ctx,
-                          0, 0, AVSEEK_FLAG_BACKWARD);
+            ffmpeg_seek_start(player->ffmpeg_ctx);
             lv_timer_resume(timer);
             LV_LOG_INFO("ffmpeg player start");
             break;
         case LV_FFMPEG_PLAYER_CMD_STOP:
-            av_seek_frame(player->ffmpeg_ctx->fmt_ctx,
-                          0, 0, AVSEEK_FLAG_BACKWARD);
+            ffmpeg_seek_start(player->ffmpeg_ctx);
             lv_timer_pause(timer);
             LV_LOG_INFO("ffmpeg player stop");
             break;
@@ -256,6 +330,8 @@ void lv_ffmpeg_player_set_auto_restart(lv_obj_t * obj, bool en)
 
 static lv_res_t decoder_info(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header)
 {
+    LV_UNUSED(decoder);
+
     /* Get the source type */
     lv_img_src_t src_type = lv_img_src_get_type(src);
 
@@ -276,6 +352,8 @@ static lv_res_t decoder_info(lv_img_decoder_t * decoder, const void * src, lv_im
 
 static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
 {
+    LV_UNUSED(decoder);
+
     if(dsc->src_type == LV_IMG_SRC_FILE) {
         const char * path = dsc->src;
 
@@ -319,6 +397,7 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
 
 static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
 {
+    LV_UNUSED(decoder);
     struct ffmpeg_context_s * ffmpeg_ctx = dsc->user_data;
     ffmpeg_close(ffmpeg_ctx);
 }
@@ -389,7 +468,7 @@ static int ffmpeg_output_video_frame(struct ffmpeg_context_s * ffmpeg_ctx)
 
     if(frame->width != width
        || frame->height != height
-       || frame->format != ffmpeg_ctx->video_dec_ctx->pix_fmt) {
+       || frame->format != (int)ffmpeg_ctx->video_dec_ctx->pix_fmt) {
 
         /* To handle this change, one could call av_image_alloc again and
          * decode the following frames into another rawvideo file.
@@ -409,6 +488,23 @@ static int ffmpeg_output_video_frame(struct ffmpeg_context_s * ffmpeg_ctx)
 
     LV_LOG_TRACE("video_frame coded_n:%d", frame->coded_picture_number);
 
+    if(frame->best_effort_timestamp != AV_NOPTS_VALUE) {
+        AVRational ms_time_base = {1, 1000};
+        ffmpeg_ctx->frame_pts = av_rescale_q(frame->best_effort_timestamp,
+                                             ffmpeg_ctx->video_stream->time_base, ms_time_base);
+    }
+    else {
+        ffmpeg_ctx->frame_pts += ffmpeg_ctx->frame_period;
+    }
+
+    ffmpeg_ctx->frame_decoded = true;
+    ffmpeg_ctx->frame_dropped = ffmpeg_frame_is_late(ffmpeg_ctx);
+    if(ffmpeg_ctx->frame_dropped) {
+        /*It wouldn't be shown anyway so save the time of the conversion*/
+        LV_LOG_TRACE("dropping late frame, pts = %d ms", (int)ffmpeg_ctx->frame_pts);
+        return 0;
+    }
+
     /* copy decoded frame to destination buffer:
      * this is required since rawvideo expects non aligned data
      */
@@ -704,7 +800,7 @@ struct ffmpeg_context_s * ffmpeg_open_file(const char * path)
         ffmpeg_ctx->video_dst_pix_fmt = (ffmpeg_ctx->has_alpha ? AV_PIX_FMT_BGRA : AV_PIX_FMT_TRUE_COLOR);
     }
 
-#if LV_FFMPEG_AV_DUMP_FORMAT != 0
+#if LV_FFMPEG_DUMP_FORMAT != 0
     /* dump input information to stderr */
     av_dump_format(ffmpeg_ctx->fmt_ctx, 0, path, 0);
 #endif
@@ -789,6 +885,18 @@ static void ffmpeg_close_src_ctx(struct ffmpeg_context_s * ffmpeg_ctx)
 
 static void ffmpeg_close_dst_ctx(struct ffmpeg_context_s * ffmpeg_ctx)
 {
+#if FFMPEG_USE_THREAD
+    /*The decoder thread might have left an other frame buffer in `video_dst_data[0]`*/
+    if(ffmpeg_ctx->frame_bufs[0] != NULL) {
+        ffmpeg_ctx->video_dst_data[0] = ffmpeg_ctx->frame_bufs[0];
+    }
+
+    for(uint32_t i = 0; i < FRAME_BUF_CNT; i++) {
+        if(i > 0) av_freep(&ffmpeg_ctx->frame_bufs[i]);
+        ffmpeg_ctx->frame_bufs[i] = NULL;
+    }
+#endif
+
     if(ffmpeg_ctx->video_dst_data[0] != NULL) {
         av_free(ffmpeg_ctx->video_dst_data[0]);
         ffmpeg_ctx->video_dst_data[0] = NULL;
@@ -802,6 +910,10 @@ static void ffmpeg_close(struct ffmpeg_context_s * ffmpeg_ctx)
         return;
     }
 
+#if FFMPEG_USE_THREAD
+    ffmpeg_thread_stop(ffmpeg_ctx);
+#endif
+
     sws_freeContext(ffmpeg_ctx->sws_ctx);
     ffmpeg_close_src_ctx(ffmpeg_ctx);
     ffmpeg_close_dst_ctx(ffmpeg_ctx);
@@ -810,6 +922,243 @@ static void ffmpeg_close(struct ffmpeg_context_s * ffmpeg_ctx)
     LV_LOG_INFO("ffmpeg_ctx closed");
 }
 
+static bool ffmpeg_frame_is_late(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+#if FFMPEG_USE_THREAD
+    if(!ffmpeg_ctx->thread_started) return false;
+
+    lv_mutex_lock(&ffmpeg_ctx->lock);
+    bool late = ffmpeg_ctx->clock_valid && !ffmpeg_ctx->paused &&
+                (int64_t)lv_tick_elaps(ffmpeg_ctx->clock_start) > ffmpeg_ctx->frame_pts + ffmpeg_ctx->frame_period;
+    lv_mutex_unlock(&ffmpeg_ctx->lock);
+
+    if(late && ffmpeg_ctx->drop_cnt < FRAME_DROP_MAX) {
+        ffmpeg_ctx->drop_cnt++;
+        return true;
+    }
+
+    ffmpeg_ctx->drop_cnt = 0;
+    return false;
+#else
+    LV_UNUSED(ffmpeg_ctx);
+    return false;
+#endif
+}
+
+/**
+ * Seek to the beginning of the video. If the decoder thread runs, it's asked to do it
+ * and the queued frames are dropped.
+ */
+static void ffmpeg_seek_start(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+#if FFMPEG_USE_THREAD
+    if(ffmpeg_ctx->thread_started) {
+        lv_mutex_lock(&ffmpeg_ctx->lock);
+        ffmpeg_ctx->seek_req = true;
+        ffmpeg_ctx->eof = false;
+        ffmpeg_ctx->frame_cnt = 0;
+        ffmpeg_ctx->clock_valid = false;
+        lv_mutex_unlock(&ffmpeg_ctx->lock);
+        lv_thread_sync_signal(&ffmpeg_ctx->sync);
+        return;
+    }
+#endif
+
+    av_seek_frame(ffmpeg_ctx->fmt_ctx, 0, 0, AVSEEK_FLAG_BACKWARD);
+}
+
+#if FFMPEG_USE_THREAD
+
+/**
+ * Allocate the frame queue and start the thread which demuxes, decodes and converts the frames
+ * @return 0: success; < 0: failed, the frames need to be decoded in the timer
+ */
+static int ffmpeg_thread_start(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    int buf_size = av_image_get_buffer_size(ffmpeg_ctx->video_dst_pix_fmt,
+                                            ffmpeg_ctx->video_dec_ctx->width,
+                                            ffmpeg_ctx->video_dec_ctx->height, 4);
+    if(buf_size < 0) return buf_size;
+
+    /*The first buffer is the one allocated by `ffmpeg_image_allocate()`*/
+    ffmpeg_ctx->frame_bufs[0] = ffmpeg_ctx->video_dst_data[0];
+    for(uint32_t i = 1; i < FRAME_BUF_CNT; i++) {
+        ffmpeg_ctx->frame_bufs[i] = av_malloc(buf_size);
+        if(ffmpeg_ctx->frame_bufs[i] == NULL) {
+            LV_LOG_WARN("Could not allocate the frame queue");
+            goto failed;
+        }
+    }
+
+    /*The first buffer is shown until the first frame is decoded*/
+    ffmpeg_ctx->frame_rd = 1;
+    ffmpeg_ctx->frame_cnt = 0;
+    ffmpeg_ctx->exit_req = false;
+    ffmpeg_ctx->seek_req = false;
+    ffmpeg_ctx->eof = false;
+    ffmpeg_ctx->clock_valid = false;
+    ffmpeg_ctx->paused = true;
+
+    if(lv_mutex_init(&ffmpeg_ctx->lock) != LV_RES_OK) goto failed;
+    if(lv_thread_sync_init(&ffmpeg_ctx->sync) != LV_RES_OK) {
+        lv_mutex_delete(&ffmpeg_ctx->lock);
+        goto failed;
+    }
+
+    /*Set before the thread starts as the thread reads it*/
+    ffmpeg_ctx->thread_started = true;
+    if(lv_thread_init(&ffmpeg_ctx->thread, LV_THREAD_PRIO_MID, ffmpeg_decoder_thread_cb,
+                      DECODER_STACK_SIZE, ffmpeg_ctx) != LV_RES_OK) {
+        ffmpeg_ctx->thread_started = false;
+        lv_thread_sync_delete(&ffmpeg_ctx->sync);
+        lv_mutex_delete(&ffmpeg_ctx->lock);
+        goto failed;
+    }
+
+    return 0;
+
+failed:
+    for(uint32_t i = 1; i < FRAME_BUF_CNT; i++) {
+        av_freep(&ffmpeg_ctx->frame_bufs[i]);
+    }
+    ffmpeg_ctx->frame_bufs[0] = NULL;
+    return -1;
+}
+
+static void ffmpeg_thread_stop(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    if(!ffmpeg_ctx->thread_started) return;
+
+    lv_mutex_lock(&ffmpeg_ctx->lock);
+    ffmpeg_ctx->exit_req = true;
+    lv_mutex_unlock(&ffmpeg_ctx->lock);
+    lv_thread_sync_signal(&ffmpeg_ctx->sync);
+
+    /*Waits until the frame being decoded is finished*/
+    lv_thread_delete(&ffmpeg_ctx->thread);
+    lv_thread_sync_delete(&ffmpeg_ctx->sync);
+    lv_mutex_delete(&ffmpeg_ctx->lock);
+    ffmpeg_ctx->thread_started = false;
+}
+
+/**
+ * Demux, decode and convert the frames into the free buffers of the queue.
+ * Only this thread uses the FFmpeg contexts while it runs.
+ */
+static void ffmpeg_decoder_thread_cb(void * user_data)
+{
+    struct ffmpeg_context_s * ffmpeg_ctx = user_data;
+
+    while(1) {
+        lv_mutex_lock(&ffmpeg_ctx->lock);
+        bool exit_req = ffmpeg_ctx->exit_req;
+        bool seek_req = ffmpeg_ctx->seek_req;
+        ffmpeg_ctx->seek_req = false;
+        bool idle = ffmpeg_ctx->eof || ffmpeg_ctx->frame_cnt >= LV_FFMPEG_FRAME_QUEUE_CNT;
+        uint32_t buf_id = (ffmpeg_ctx->frame_rd + ffmpeg_ctx->frame_cnt) % FRAME_BUF_CNT;
+        lv_mutex_unlock(&ffmpeg_ctx->lock);
+
+        if(exit_req) break;
+
+        if(seek_req) {
+            av_seek_frame(ffmpeg_ctx->fmt_ctx, 0, 0, AVSEEK_FLAG_BACKWARD);
+            avcodec_flush_buffers(ffmpeg_ctx->video_dec_ctx);
+            continue;
+        }
+
+        /*Wait until a frame is shown or a command arrives*/
+        if(idle) {
+            lv_thread_sync_wait(&ffmpeg_ctx->sync);
+            continue;
+        }
+
+        ffmpeg_ctx->video_dst_data[0] = ffmpeg_ctx->frame_bufs[buf_id];
+        ffmpeg_ctx->frame_decoded = false;
+        ffmpeg_ctx->frame_dropped = false;
+        int ret = ffmpeg_update_next_frame(ffmpeg_ctx);
+        bool frame_ok = ret >= 0 && ffmpeg_ctx->frame_decoded && !ffmpeg_ctx->frame_dropped;
+
+#if LV_COLOR_DEPTH != 32
+        if(frame_ok && ffmpeg_ctx->has_alpha) {
+            convert_color_depth(ffmpeg_ctx->frame_bufs[buf_id],
+                                ffmpeg_ctx->video_dec_ctx->width * ffmpeg_ctx->video_dec_ctx->height);
+        }
+#endif
+
+        lv_mutex_lock(&ffmpeg_ctx->lock);
+        /*If seeking was requested meanwhile the frame belongs to the old position*/
+        if(!ffmpeg_ctx->seek_req) {
+            if(ret < 0) {
+                ffmpeg_ctx->eof = true;
+            }
+            else if(frame_ok) {
+                ffmpeg_ctx->frame_bufs_pts[buf_id] = ffmpeg_ctx->frame_pts;
+                ffmpeg_ctx->frame_cnt++;
+            }
+        }
+        lv_mutex_unlock(&ffmpeg_ctx->lock);
+    }
+}
+
+/**
+ * Show the latest frame whose presentation time has come and drop the older ones.
+ * Only swaps the image buffer, the frames are decoded by the decoder thread.
+ */
+static void lv_ffmpeg_player_frame_present(lv_obj_t * obj)
+{
+    lv_ffmpeg_player_t * player = (lv_ffmpeg_player_t *)obj;
+    struct ffmpeg_context_s * ffmpeg_ctx = player->ffmpeg_ctx;
+    int32_t shown_id = -1;
+    uint32_t drop_cnt = 0;
+
+    lv_mutex_lock(&ffmpeg_ctx->lock);
+    while(ffmpeg_ctx->frame_cnt > 0) {
+        uint32_t id = ffmpeg_ctx->frame_rd;
+        int64_t pts = ffmpeg_ctx->frame_bufs_pts[id];
+
+        if(!ffmpeg_ctx->clock_valid) {
+            /*Start the clock with the first frame*/
+            ffmpeg_ctx->clock_start = lv_tick_get() - (uint32_t)pts;
+            ffmpeg_ctx->clock_valid = true;
+        }
+        else if(pts > (int64_t)lv_tick_elaps(ffmpeg_ctx->clock_start)) {
+            break;
+        }
+
+        if(shown_id >= 0) drop_cnt++;
+        shown_id = id;
+        ffmpeg_ctx->shown_pts = pts;
+        ffmpeg_ctx->frame_rd = (id + 1) % FRAME_BUF_CNT;
+        ffmpeg_ctx->frame_cnt--;
+    }
+
+    if(shown_id >= 0) {
+        player->imgdsc.data = ffmpeg_ctx->frame_bufs[shown_id];
+    }
+
+    /*Finished when the last frame was shown for a frame period*/
+    bool finished = ffmpeg_ctx->eof && ffmpeg_ctx->frame_cnt == 0 &&
+                    (!ffmpeg_ctx->clock_valid ||
+                     (int64_t)lv_tick_elaps(ffmpeg_ctx->clock_start) >= ffmpeg_ctx->shown_pts + ffmpeg_ctx->frame_period);
+    lv_mutex_unlock(&ffmpeg_ctx->lock);
+
+    if(shown_id >= 0) {
+        if(drop_cnt) LV_LOG_TRACE("%d late frames dropped", (int)drop_cnt);
+
+        /*A buffer became free for the next frame*/
+        lv_thread_sync_signal(&ffmpeg_ctx->sync);
+
+        lv_img_cache_invalidate_src(lv_img_get_src(obj));
+        lv_obj_invalidate(obj);
+    }
+
+    if(finished) {
+        lv_ffmpeg_player_set_cmd(obj, player->auto_restart ? LV_FFMPEG_PLAYER_CMD_START : LV_FFMPEG_PLAYER_CMD_STOP);
+    }
+}
+
+#endif /*FFMPEG_USE_THREAD*/
+
 static void lv_ffmpeg_player_frame_update_cb(lv_timer_t * timer)
 {
     lv_obj_t * obj = (lv_obj_t *)timer->user_data;
@@ -819,6 +1168,13 @@ static void lv_ffmpeg_player_frame_update_cb(lv_timer_t * timer)
         return;
     }
 
+#if FFMPEG_USE_THREAD
+    if(player->ffmpeg_ctx->thread_started) {
+        lv_ffmpeg_player_frame_present(obj);
+        return;
+    }
+#endif
+
     int has_next = ffmpeg_update_next_frame(player->ffmpeg_ctx);
 
     if(has_next < 0) {
@@ -840,6 +1196,7 @@ static void lv_ffmpeg_player_frame_update_cb(lv_timer_t * timer)
 static void lv_ffmpeg_player_constructor(const lv_obj_class_t * class_p,
                                          lv_obj_t * obj)
 {
+    LV_UNUSED(class_p);
     LV_TRACE_OBJ_CREATE("begin");
 
     lv_ffmpeg_player_t * player = (lv_ffmpeg_player_t *)obj;
@@ -856,6 +1213,7 @@ static void lv_ffmpeg_player_constructor(const lv_obj_class_t * class_p,
 static void lv_ffmpeg_player_destructor(const lv_obj_class_t * class_p,
                                         lv_obj_t * obj)
 {
+    LV_UNUSED(class_p);
     LV_TRACE_OBJ_CREATE("begin");
 
     lv_ffmpeg_player_t * player = (lv_ffmpeg_player_t *)obj;
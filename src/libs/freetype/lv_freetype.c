@@ -16,6 +16,11 @@
 #include FT_SIZES_H
 #include FT_IMAGE_H
 #include FT_OUTLINE_H
+#include FT_MODULE_H
+
+#if !LV_FREETYPE_USE_LVGL_PORT
+    #include <stdlib.h>
+#endif
 
 /*********************
  *      DEFINES
@@ -32,6 +37,10 @@
     #error "LV_FREETYPE_CACHE_SIZE must > 0"
 #endif
 
+/*Pre-render the glyphs for at most WARM_UP_TIME_MAX ms in every WARM_UP_PERIOD ms*/
+#define WARM_UP_TIME_MAX    2
+#define WARM_UP_PERIOD      10
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -40,9 +49,16 @@ typedef struct _lv_freetype_font_dsc_t {
     char * pathname;
     uint16_t size;
     uint16_t style;
+    lv_timer_t * warm_up_timer;
+    uint32_t * warm_up_letters;     /*The letters to pre-render*/
+    uint32_t warm_up_cnt;
+    uint32_t warm_up_next;
 } lv_freetype_font_dsc_t;
 
 typedef struct _lv_freetype_context_t {
+    struct FT_MemoryRec_ memory;
+    uint32_t alloc_cnt;     /*Number of allocations by FreeType. Used to detect the cache misses.*/
+    lv_freetype_stats_t stats;
     FT_Library library;
     FTC_Manager cache_manager;
     FTC_CMapCache cmap_cache;
@@ -74,6 +90,12 @@ static bool freetype_get_glyph_dsc_cb(const lv_font_t * font,
                                       uint32_t unicode_letter_next);
 static const uint8_t * freetype_get_glyph_bitmap_cb(const lv_font_t * font,
                                                     uint32_t unicode_letter);
+static FT_Error cache_create(uint16_t max_faces, uint16_t max_sizes, uint32_t max_bytes);
+static void warm_up_timer_cb(lv_timer_t * timer);
+static void warm_up_stop(lv_freetype_font_dsc_t * dsc);
+static void * ft_mem_alloc(FT_Memory memory, long size);
+static void * ft_mem_realloc(FT_Memory memory, long cur_size, long new_size, void * block);
+static void ft_mem_free(FT_Memory memory, void * block);
 
 /**********************
 *  STATIC VARIABLES
@@ -93,56 +115,65 @@ lv_res_t lv_freetype_init(uint16_t max_faces, uint16_t max_sizes, uint32_t max_b
 {
     FT_Error error;
 
-    error = FT_Init_FreeType(&ft_ctx.library);
+    /*Use an own memory handler to count the allocations. FT_Init_FreeType() does the same
+     *but with the default memory handler.*/
+    lv_memzero(&ft_ctx.stats, sizeof(ft_ctx.stats));
+    ft_ctx.alloc_cnt = 0;
+    ft_ctx.memory.user = NULL;
+    ft_ctx.memory.alloc = ft_mem_alloc;
+    ft_ctx.memory.realloc = ft_mem_realloc;
+    ft_ctx.memory.free = ft_mem_free;
+
+    error = FT_New_Library(&ft_ctx.memory, &ft_ctx.library);
     if(error) {
-        FT_ERROR_MSG("FT_Init_FreeType", error);
+        FT_ERROR_MSG("FT_New_Library", error);
         return LV_RES_INV;
     }
+    FT_Add_Default_Modules(ft_ctx.library);
+    FT_Set_Default_Properties(ft_ctx.library);
 
-    error = FTC_Manager_New(ft_ctx.library,
-                            max_faces,
-                            max_sizes,
-                            max_bytes,
-                            freetpye_face_requester,
-                            NULL,
-                            &ft_ctx.cache_manager);
+    error = cache_create(max_faces, max_sizes, max_bytes);
     if(error) {
-        FT_Done_FreeType(ft_ctx.library);
-        FT_ERROR_MSG("FTC_Manager_New", error);
+        FT_Done_Library(ft_ctx.library);
         return LV_RES_INV;
     }
 
-    error = FTC_CMapCache_New(ft_ctx.cache_manager, &ft_ctx.cmap_cache);
-    if(error) {
-        FT_ERROR_MSG("FTC_CMapCache_New", error);
-        goto failed;
-    }
+    return LV_RES_OK;
+}
 
-#if LV_FREETYPE_SBIT_CACHE
-    error = FTC_SBitCache_New(ft_ctx.cache_manager, &ft_ctx.sbit_cache);
-    if(error) {
-        FT_ERROR_MSG("FTC_SBitCache_New", error);
-        goto failed;
-    }
-#else
-    error = FTC_ImageCache_New(ft_ctx.cache_manager, &ft_ctx.image_cache);
+void lv_freetype_uninit(void)
+{
+    if(ft_ctx.cache_manager) FTC_Manager_Done(ft_ctx.cache_manager);
+    ft_ctx.cache_manager = NULL;
+    FT_Done_Library(ft_ctx.library);
+}
+
+lv_res_t lv_freetype_set_cache_size(uint16_t max_faces, uint16_t max_sizes, uint32_t max_bytes)
+{
+    /*FreeType can't resize the caches so they are created again. The fonts store only their
+     *face ID, so the faces are opened again when they are used next time.*/
+    FTC_Manager_Done(ft_ctx.cache_manager);
+    ft_ctx.current_face = NULL;
+
+    FT_Error error = cache_create(max_faces, max_sizes, max_bytes);
     if(error) {
-        FT_ERROR_MSG("FTC_ImageCache_New", error);
-        goto failed;
+        /*Try to keep FreeType usable with the default sizes*/
+        LV_LOG_WARN("couldn't create the caches, using the default sizes");
+        error = cache_create(0, 0, 0);
+        if(error) {
+            /*`cache_manager` is NULL now so the fonts can't be created or rendered*/
+            LV_LOG_ERROR("couldn't create the caches with the default sizes either");
+        }
+        return LV_RES_INV;
     }
-#endif
 
     return LV_RES_OK;
-failed:
-    FTC_Manager_Done(ft_ctx.cache_manager);
-    FT_Done_FreeType(ft_ctx.library);
-    return LV_RES_INV;
 }
 
-void lv_freetype_uninit(void)
+void lv_freetype_get_stats(lv_freetype_stats_t * stats)
 {
-    FTC_Manager_Done(ft_ctx.cache_manager);
-    FT_Done_FreeType(ft_ctx.library);
+    LV_ASSERT_NULL(stats);
+    lv_memcpy(stats, &ft_ctx.stats, sizeof(lv_freetype_stats_t));
 }
 
 lv_font_t * lv_freetype_font_create(const char * pathname, uint16_t size, uint16_t style)
@@ -150,6 +181,11 @@ lv_font_t * lv_freetype_font_create(const char * pathname, uint16_t size, uint16
     LV_ASSERT_NULL(pathname);
     LV_ASSERT(size > 0);
 
+    if(ft_ctx.cache_manager == NULL) {
+        LV_LOG_WARN("the caches are not created");
+        return NULL;
+    }
+
     size_t pathname_len = lv_strlen(pathname);
     if(pathname_len == 0) {
         LV_LOG_ERROR("pathname is empty");
@@ -217,11 +253,55 @@ void lv_freetype_font_del(lv_font_t * font)
     LV_ASSERT_NULL(font);
     lv_freetype_font_dsc_t * dsc = (lv_freetype_font_dsc_t *)(font->dsc);
     LV_ASSERT_NULL(dsc);
-    FTC_Manager_RemoveFaceID(ft_ctx.cache_manager, (FTC_FaceID)dsc);
+    lv_font_fallback_cache_invalidate(font);
+    warm_up_stop(dsc);
+    if(ft_ctx.cache_manager) FTC_Manager_RemoveFaceID(ft_ctx.cache_manager, (FTC_FaceID)dsc);
     lv_free(dsc->pathname);
     lv_free(dsc);
 }
 
+void lv_freetype_font_warm_up(lv_font_t * font, const char * txt)
+{
+    LV_ASSERT_NULL(font);
+    LV_ASSERT_NULL(txt);
+    lv_freetype_font_dsc_t * dsc = (lv_freetype_font_dsc_t *)(font->dsc);
+    LV_ASSERT_NULL(dsc);
+
+    if(dsc->style & LV_FREETYPE_FONT_STYLE_BOLD) {
+        LV_LOG_WARN("bold glyphs are not cached");
+        return;
+    }
+
+    uint32_t len = _lv_txt_get_encoded_length(txt);
+    if(len == 0) return;
+
+    /*Append the letters to the ones which are not rendered yet*/
+    uint32_t * letters = lv_realloc(dsc->warm_up_letters, (dsc->warm_up_cnt + len) * sizeof(uint32_t));
+    LV_ASSERT_MALLOC(letters);
+    if(letters == NULL) {
+        LV_LOG_WARN("out of memory");
+        return;
+    }
+    dsc->warm_up_letters = letters;
+
+    uint32_t i = 0;
+    while(txt[i] != '\0') {
+        letters[dsc->warm_up_cnt] = _lv_txt_encoded_next(txt, &i);
+        dsc->warm_up_cnt++;
+    }
+
+    if(dsc->warm_up_timer == NULL) {
+        dsc->warm_up_timer = lv_timer_create(warm_up_timer_cb, WARM_UP_PERIOD, font);
+    }
+}
+
+bool lv_freetype_font_is_warming_up(const lv_font_t * font)
+{
+    LV_ASSERT_NULL(font);
+    lv_freetype_font_dsc_t * dsc = (lv_freetype_font_dsc_t *)(font->dsc);
+    return dsc->warm_up_timer != NULL;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -301,6 +381,7 @@ static bool freetype_get_glyph_dsc_cb(const lv_font_t * font,
     }
 
     lv_freetype_font_dsc_t * dsc = (lv_freetype_font_dsc_t *)(font->dsc);
+    if(ft_ctx.cache_manager == NULL) return false;
 
     FTC_FaceID face_id = (FTC_FaceID)dsc;
     FT_Size face_size;
@@ -331,6 +412,8 @@ static bool freetype_get_glyph_dsc_cb(const lv_font_t * font,
     }
 
     if(dsc->style & LV_FREETYPE_FONT_STYLE_BOLD) {
+        /*Bold glyphs are rendered every time*/
+        ft_ctx.stats.miss_cnt++;
         ft_ctx.current_face = face;
         error = freetype_get_bold_glyph(font, face, glyph_index, dsc_out);
         if(error) {
@@ -346,6 +429,9 @@ static bool freetype_get_glyph_dsc_cb(const lv_font_t * font,
     desc_type.height = dsc->size;
     desc_type.width = dsc->size;
 
+    /*The caches allocate only when the glyph is not found*/
+    uint32_t alloc_cnt_prev = ft_ctx.alloc_cnt;
+
 #if LV_FREETYPE_SBIT_CACHE
     error = FTC_SBitCache_Lookup(ft_ctx.sbit_cache,
                                  &desc_type,
@@ -356,6 +442,8 @@ static bool freetype_get_glyph_dsc_cb(const lv_font_t * font,
         FT_ERROR_MSG("FTC_SBitCache_Lookup", error);
         return false;
     }
+    if(ft_ctx.alloc_cnt == alloc_cnt_prev) ft_ctx.stats.hit_cnt++;
+    else ft_ctx.stats.miss_cnt++;
 
     FTC_SBit sbit = ft_ctx.sbit;
     dsc_out->adv_w = sbit->xadvance;
@@ -374,6 +462,9 @@ static bool freetype_get_glyph_dsc_cb(const lv_font_t * font,
         FT_ERROR_MSG("ImageCache_Lookup", error);
         return false;
     }
+    if(ft_ctx.alloc_cnt == alloc_cnt_prev) ft_ctx.stats.hit_cnt++;
+    else ft_ctx.stats.miss_cnt++;
+
     if(ft_ctx.image_glyph->format != FT_GLYPH_FORMAT_BITMAP) {
         LV_LOG_ERROR("image_glyph->format != FT_GLYPH_FORMAT_BITMAP");
         return false;
@@ -417,4 +508,111 @@ static const uint8_t * freetype_get_glyph_bitmap_cb(const lv_font_t * font, uint
 #endif
 }
 
+static FT_Error cache_create(uint16_t max_faces, uint16_t max_sizes, uint32_t max_bytes)
+{
+    FT_Error error = FTC_Manager_New(ft_ctx.library,
+                                     max_faces,
+                                     max_sizes,
+                                     max_bytes,
+                                     freetpye_face_requester,
+                                     NULL,
+                                     &ft_ctx.cache_manager);
+    if(error) {
+        FT_ERROR_MSG("FTC_Manager_New", error);
+        ft_ctx.cache_manager = NULL;
+        return error;
+    }
+
+    error = FTC_CMapCache_New(ft_ctx.cache_manager, &ft_ctx.cmap_cache);
+    if(error) {
+        FT_ERROR_MSG("FTC_CMapCache_New", error);
+        goto failed;
+    }
+
+#if LV_FREETYPE_SBIT_CACHE
+    error = FTC_SBitCache_New(ft_ctx.cache_manager, &ft_ctx.sbit_cache);
+    if(error) {
+        FT_ERROR_MSG("FTC_SBitCache_New", error);
+        goto failed;
+    }
+#else
+    error = FTC_ImageCache_New(ft_ctx.cache_manager, &ft_ctx.image_cache);
+    if(error) {
+        FT_ERROR_MSG("FTC_ImageCache_New", error);
+        goto failed;
+    }
+#endif
+
+    return FT_Err_Ok;
+failed:
+    FTC_Manager_Done(ft_ctx.cache_manager);
+    ft_ctx.cache_manager = NULL;
+    return error;
+}
+
+/**
+ * Render a few glyphs into the cache and stop when all letters are rendered
+ */
+static void warm_up_timer_cb(lv_timer_t * timer)
+{
+    lv_font_t * font = timer->user_data;
+    lv_freetype_font_dsc_t * dsc = (lv_freetype_font_dsc_t *)(font->dsc);
+
+    uint32_t t_start = lv_tick_get();
+    do {
+        lv_font_glyph_dsc_t g;
+        freetype_get_glyph_dsc_cb(font, &g, dsc->warm_up_letters[dsc->warm_up_next], 0);
+        dsc->warm_up_next++;
+    } while(dsc->warm_up_next < dsc->warm_up_cnt && lv_tick_elaps(t_start) < WARM_UP_TIME_MAX);
+
+    if(dsc->warm_up_next >= dsc->warm_up_cnt) warm_up_stop(dsc);
+}
+
+static void warm_up_stop(lv_freetype_font_dsc_t * dsc)
+{
+    if(dsc->warm_up_timer) lv_timer_del(dsc->warm_up_timer);
+    lv_free(dsc->warm_up_letters);
+    dsc->warm_up_timer = NULL;
+    dsc->warm_up_letters = NULL;
+    dsc->warm_up_cnt = 0;
+    dsc->warm_up_next = 0;
+}
+
+static void * ft_mem_alloc(FT_Memory memory, long size)
+{
+    LV_UNUSED(memory);
+    ft_ctx.alloc_cnt++;
+
+    /*Some FreeType versions don't initialize all fields of the cache manager*/
+#if LV_FREETYPE_USE_LVGL_PORT
+    void * p = lv_malloc((size_t)size);
+    if(p) lv_memzero(p, (size_t)size);
+    return p;
+#else
+    return calloc(1, (size_t)size);
+#endif
+}
+
+static void * ft_mem_realloc(FT_Memory memory, long cur_size, long new_size, void * block)
+{
+    LV_UNUSED(memory);
+    LV_UNUSED(cur_size);
+    ft_ctx.alloc_cnt++;
+#if LV_FREETYPE_USE_LVGL_PORT
+    return lv_realloc(block, (size_t)new_size);
+#else
+    return realloc(block, (size_t)new_size);
+#endif
+}
+
+static void ft_mem_free(FT_Memory memory, void * block)
+{
+    LV_UNUSED(memory);
+#if LV_FREETYPE_USE_LVGL_PORT
+    lv_free(block);
+#else
+    free(block);
+#endif
+}
+
 #endif /*LV_USE_FREETYPE*/
@@ -29,6 +29,14 @@ typedef enum {
     LV_FREETYPE_FONT_STYLE_BOLD   = 1 << 1
 } lv_freetype_font_style_t;
 
+/**
+ * Statistics of the glyph cache
+ */
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of glyphs found in the cache*/
+    uint32_t miss_cnt;      /**< Number of glyphs rendered when they were needed, including all bold glyphs*/
+} lv_freetype_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -48,6 +56,24 @@ lv_res_t lv_freetype_init(uint16_t max_faces, uint16_t max_sizes, uint32_t max_b
  */
 void lv_freetype_uninit(void);
 
+/**
+ * Change the size of the caches. All cached glyphs, sizes and faces are freed,
+ * so it shouldn't be called while rendering.
+ * @param max_faces Maximum number of opened FT_Face objects. Use 0 for defaults.
+ * @param max_sizes Maximum number of opened FT_Size objects. Use 0 for defaults.
+ * @param max_bytes Maximum number of bytes to use for cached data nodes. Use 0 for defaults.
+ * @return LV_RES_OK on success, LV_RES_INV if the caches were created with the default sizes instead.
+ *         If even that fails no fonts can be created or rendered until a successful call.
+ */
+lv_res_t lv_freetype_set_cache_size(uint16_t max_faces, uint16_t max_sizes, uint32_t max_bytes);
+
+/**
+ * Get the hit/miss statistics of the glyph cache. The glyphs rendered by
+ * `lv_freetype_font_warm_up()` are counted too.
+ * @param stats store the statistics here
+ */
+void lv_freetype_get_stats(lv_freetype_stats_t * stats);
+
 /**
  * Create a freetype font.
  * @param pathname font file path.
@@ -63,6 +89,22 @@ lv_font_t * lv_freetype_font_create(const char * pathname, uint16_t size, uint16
  */
 void lv_freetype_font_del(lv_font_t * font);
 
+/**
+ * Render the glyphs of a text into the cache in the background, a few glyphs in every
+ * timer period, so they are not rendered when the text is shown first time.
+ * The cache should be large enough to hold all the glyphs. Bold fonts are not cached.
+ * @param font freetype font
+ * @param txt UTF-8 text with the letters to render. It's copied and can be freed after the call.
+ */
+void lv_freetype_font_warm_up(lv_font_t * font, const char * txt);
+
+/**
+ * Check if there are letters to render by `lv_freetype_font_warm_up()`
+ * @param font freetype font
+ * @return true: the glyphs are still being rendered
+ */
+bool lv_freetype_font_is_warming_up(const lv_font_t * font);
+
 /**********************
  *      MACROS
  **********************/
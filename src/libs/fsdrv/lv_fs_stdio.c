@@ -14,6 +14,11 @@
 #ifndef WIN32
     #include <dirent.h>
     #include <unistd.h>
+    #if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
+        #include <sys/mman.h>
+        #include <sys/stat.h>
+        #define FS_HAS_MMAP 1
+    #endif
 #else
     #include <windows.h>
 #endif
@@ -44,6 +49,10 @@ static lv_fs_res_t fs_read(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_
 static lv_fs_res_t fs_write(lv_fs_drv_t * drv, void * file_p, const void * buf, uint32_t btw, uint32_t * bw);
 static lv_fs_res_t fs_seek(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence);
 static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p);
+#ifdef FS_HAS_MMAP
+    static const void * fs_mmap(lv_fs_drv_t * drv, void * file_p, uint32_t * size_p);
+    static lv_fs_res_t fs_munmap(lv_fs_drv_t * drv, void * file_p, const void * addr, uint32_t size);
+#endif
 static void * fs_dir_open(lv_fs_drv_t * drv, const char * path);
 static lv_fs_res_t fs_dir_read(lv_fs_drv_t * drv, void * dir_p, char * fn);
 static lv_fs_res_t fs_dir_close(lv_fs_drv_t * drv, void * dir_p);
@@ -83,6 +92,10 @@ void lv_fs_stdio_init(void)
     fs_drv.write_cb = fs_write;
     fs_drv.seek_cb = fs_seek;
     fs_drv.tell_cb = fs_tell;
+#ifdef FS_HAS_MMAP
+    fs_drv.mmap_cb = fs_mmap;
+    fs_drv.munmap_cb = fs_munmap;
+#endif
 
     fs_drv.dir_close_cb = fs_dir_close;
     fs_drv.dir_open_cb = fs_dir_open;
@@ -212,6 +225,47 @@ static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p)
     return LV_FS_RES_OK;
 }
 
+#ifdef FS_HAS_MMAP
+/**
+ * Map the whole file to the memory for reading
+ * @param drv pointer to a driver where this function belongs
+ * @param file_p pointer to a FILE variable.
+ * @param size_p pointer to store the size of the file
+ * @return address of the mapped file or NULL in case of fail (e.g. empty file)
+ */
+static const void * fs_mmap(lv_fs_drv_t * drv, void * file_p, uint32_t * size_p)
+{
+    LV_UNUSED(drv);
+    /*Write the buffered data to the file to see it in the mapping too*/
+    fflush(file_p);
+    int fd = fileno(file_p);
+    struct stat st;
+    if(fstat(fd, &st) != 0) return NULL;
+    if(st.st_size <= 0 || (uint64_t)st.st_size > UINT32_MAX) return NULL;
+
+    void * addr = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if(addr == MAP_FAILED) return NULL;
+
+    *size_p = st.st_size;
+    return addr;
+}
+
+/**
+ * Release a mapping created by `fs_mmap`
+ * @param drv pointer to a driver where this function belongs
+ * @param file_p pointer to a FILE variable.
+ * @param addr address returned by `fs_mmap`
+ * @param size size returned by `fs_mmap`
+ * @return LV_FS_RES_OK or any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t fs_munmap(lv_fs_drv_t * drv, void * file_p, const void * addr, uint32_t size)
+{
+    LV_UNUSED(drv);
+    LV_UNUSED(file_p);
+    return munmap((void *)addr, size) == 0 ? LV_FS_RES_OK : LV_FS_RES_FS_ERR;
+}
+#endif /*FS_HAS_MMAP*/
+
 /**
  * Initialize a 'DIR' or 'HANDLE' variable for directory reading
  * @param drv pointer to a driver where this function belongs
@@ -10,6 +10,7 @@
 #if LV_USE_GIF
 
 #include "gifdec.h"
+#include "../../misc/lv_worker.h"
 
 /*********************
  *      DEFINES
@@ -20,6 +21,19 @@
  *      TYPEDEFS
  **********************/
 
+/*Decode the next frame in a worker thread*/
+typedef struct _lv_gif_job_t {
+    lv_worker_job_t job;
+    lv_obj_t * obj;                 /*NULL if the widget was deleted or got a new source meanwhile*/
+    gd_GIF * gif;
+    uint8_t * buf;                  /*Decode the frame here*/
+    const uint8_t * shown_buf;      /*The shown frame, only read*/
+    uint8_t * alloc_buf;            /*Freed with `gif` if `obj` is NULL*/
+    lv_area_t stale_area;           /*Copy this area from `shown_buf` to `buf` first*/
+    lv_area_t frame_area;           /*The area changed by the decoded frame*/
+    uint32_t delay;
+    int has_next;
+} lv_gif_job_t;
 
 /**********************
  *  STATIC PROTOTYPES
@@ -27,6 +41,16 @@
 static void lv_gif_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_gif_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void next_frame_task_cb(lv_timer_t * t);
+static lv_res_t decode_and_show(lv_obj_t * obj);
+static lv_res_t show_back_buf(lv_obj_t * obj);
+static lv_res_t show_frame(lv_obj_t * obj, const lv_area_t * frame_area, int has_next);
+static int decode_frame(gd_GIF * gif, uint8_t * buf, lv_area_t * frame_area);
+static void invalidate_frame_area(lv_obj_t * obj, const lv_area_t * area);
+static void close_gif(lv_gif_t * gifobj);
+static void job_start(lv_obj_t * obj);
+static void job_exec_cb(lv_worker_job_t * job);
+static void job_ready_cb(lv_worker_job_t * job);
+static void job_cancel_cb(lv_worker_job_t * job);
 
 /**********************
  *  STATIC VARIABLES
@@ -62,8 +86,7 @@ void lv_gif_set_src(lv_obj_t * obj, const void * src)
     /*Close previous gif if any*/
     if(gifobj->gif) {
         lv_img_cache_invalidate_src(&gifobj->imgdsc);
-        gd_close_gif(gifobj->gif);
-        gifobj->gif = NULL;
+        close_gif(gifobj);
         gifobj->imgdsc.data = NULL;
     }
 
@@ -85,24 +108,43 @@ void lv_gif_set_src(lv_obj_t * obj, const void * src)
     gifobj->imgdsc.header.h = gifobj->gif->height;
     gifobj->imgdsc.header.w = gifobj->gif->width;
     gifobj->last_call = lv_tick_get();
+    gifobj->delay = 0;
 
     lv_img_set_src(obj, &gifobj->imgdsc);
 
     lv_timer_resume(gifobj->timer);
     lv_timer_reset(gifobj->timer);
 
-    next_frame_task_cb(gifobj->timer);
-
+    /*Show the first frame right away*/
+    if(decode_and_show(obj) != LV_RES_OK) return;
+    if(gifobj->async && !gifobj->timer->paused) job_start(obj);
 }
 
 void lv_gif_restart(lv_obj_t * obj)
 {
     lv_gif_t * gifobj = (lv_gif_t *) obj;
-    gd_rewind(gifobj->gif);
+    if(gifobj->gif == NULL) return;
+
+    if(gifobj->job) {
+        /*The decoder is used by the worker thread now*/
+        gifobj->restart_req = 1;
+    }
+    else {
+        gd_rewind(gifobj->gif);
+        gifobj->frame_ready = 0;
+        lv_area_set(&gifobj->back_stale_area, 0, 0, gifobj->imgdsc.header.w - 1, gifobj->imgdsc.header.h - 1);
+    }
+
     lv_timer_resume(gifobj->timer);
     lv_timer_reset(gifobj->timer);
 }
 
+void lv_gif_set_async(lv_obj_t * obj, bool en)
+{
+    lv_gif_t * gifobj = (lv_gif_t *) obj;
+    gifobj->async = en;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -114,6 +156,7 @@ static void lv_gif_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_gif_t * gifobj = (lv_gif_t *) obj;
 
     gifobj->gif = NULL;
+    gifobj->async = LV_GIF_ASYNC;
     gifobj->timer = lv_timer_create(next_frame_task_cb, 10, obj);
     lv_timer_pause(gifobj->timer);
 }
@@ -124,7 +167,7 @@ static void lv_gif_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_gif_t * gifobj = (lv_gif_t *) obj;
     lv_img_cache_invalidate_src(&gifobj->imgdsc);
     if(gifobj->gif)
-        gd_close_gif(gifobj->gif);
+        close_gif(gifobj);
     lv_timer_del(gifobj->timer);
 }
 
@@ -132,23 +175,284 @@ static void next_frame_task_cb(lv_timer_t * t)
 {
     lv_obj_t * obj = t->user_data;
     lv_gif_t * gifobj = (lv_gif_t *) obj;
+
+    /*Wait for the frame being decoded in the background*/
+    if(gifobj->job) return;
+
+    /*Nothing to show yet, so decode the next frame in the background now*/
+    if(gifobj->async && !gifobj->frame_ready) {
+        job_start(obj);
+        return;
+    }
+
     uint32_t elaps = lv_tick_elaps(gifobj->last_call);
-    if(elaps < gifobj->gif->gce.delay * 10) return;
+    if(elaps < gifobj->delay) return;
 
     gifobj->last_call = lv_tick_get();
 
-    int has_next = gd_get_frame(gifobj->gif);
+    lv_res_t res;
+    if(gifobj->frame_ready) res = show_back_buf(obj);
+    else res = decode_and_show(obj);
+    if(res != LV_RES_OK) return;
+
+    /*Decode the next frame while this one is shown*/
+    if(gifobj->async && !t->paused) job_start(obj);
+}
+
+/**
+ * Decode the next frame into the shown buffer in the LVGL thread and show it
+ */
+static lv_res_t decode_and_show(lv_obj_t * obj)
+{
+    lv_gif_t * gifobj = (lv_gif_t *) obj;
+
+    lv_area_t frame_area;
+    int has_next = decode_frame(gifobj->gif, (uint8_t *)gifobj->imgdsc.data, &frame_area);
+    gifobj->delay = gifobj->gif->gce.delay * 10;
+
+    /*The back buffer needs to be updated with this frame too*/
+    lv_area_set(&gifobj->back_stale_area, 0, 0, gifobj->imgdsc.header.w - 1, gifobj->imgdsc.header.h - 1);
+
+    return show_frame(obj, &frame_area, has_next);
+}
+
+/**
+ * Show the frame decoded in the background by swapping the buffers
+ */
+static lv_res_t show_back_buf(lv_obj_t * obj)
+{
+    lv_gif_t * gifobj = (lv_gif_t *) obj;
+
+    uint8_t * shown_buf = (uint8_t *)gifobj->imgdsc.data;
+    gifobj->imgdsc.data = gifobj->back_buf;
+    gifobj->back_buf = shown_buf;
+
+    /*The previously shown frame doesn't have the changes of the new frame*/
+    gifobj->back_stale_area = gifobj->frame_area;
+    gifobj->delay = gifobj->frame_delay;
+    gifobj->frame_ready = 0;
+
+    return show_frame(obj, &gifobj->frame_area, gifobj->has_next);
+}
+
+/**
+ * Redraw the changed area of the image and send `LV_EVENT_READY` after the last frame
+ * @return LV_RES_INV if the object was deleted in the event
+ */
+static lv_res_t show_frame(lv_obj_t * obj, const lv_area_t * frame_area, int has_next)
+{
+    lv_gif_t * gifobj = (lv_gif_t *) obj;
+
+    lv_img_cache_invalidate_src(lv_img_get_src(obj));
+    invalidate_frame_area(obj, frame_area);
+
     if(has_next == 0) {
         /*It was the last repeat*/
-        lv_res_t res = lv_obj_send_event(obj, LV_EVENT_READY, NULL);
-        lv_timer_pause(t);
-        if(res != LV_FS_RES_OK) return;
+        lv_timer_pause(gifobj->timer);
+        return lv_obj_send_event(obj, LV_EVENT_READY, NULL);
     }
 
-    gd_render_frame(gifobj->gif, (uint8_t *)gifobj->imgdsc.data);
+    return LV_RES_OK;
+}
 
-    lv_img_cache_invalidate_src(lv_img_get_src(obj));
-    lv_obj_invalidate(obj);
+/**
+ * Decode the next frame
+ * @param gif           the gif to decode
+ * @param buf           a buffer with the previous frame, render the new frame here
+ * @param frame_area    store the area changed in `buf` here
+ * @return              1: got a frame; 0: it was the last frame; -1: error
+ */
+static int decode_frame(gd_GIF * gif, uint8_t * buf, lv_area_t * frame_area)
+{
+    lv_area_t img_area;
+    lv_area_set(&img_area, 0, 0, gif->width - 1, gif->height - 1);
+
+    /*The area of the previous frame can be restored to the background*/
+    lv_area_t prev_area;
+    lv_area_set(&prev_area, gif->fx, gif->fy, gif->fx + gif->fw - 1, gif->fy + gif->fh - 1);
+    bool prev_valid = gif->fw && gif->fh;
+
+    gif->canvas = buf;
+    int has_next = gd_get_frame(gif);
+    gd_render_frame(gif, buf);
+
+    lv_area_set(frame_area, gif->fx, gif->fy, gif->fx + gif->fw - 1, gif->fy + gif->fh - 1);
+    bool cur_valid = gif->fw && gif->fh;
+
+    if(cur_valid && prev_valid) _lv_area_join(frame_area, frame_area, &prev_area);
+    else if(prev_valid) *frame_area = prev_area;
+    else if(!cur_valid) *frame_area = img_area;
+
+    if(!_lv_area_intersect(frame_area, frame_area, &img_area)) *frame_area = img_area;
+
+    return has_next;
+}
+
+/**
+ * Invalidate only the changed area of the frame if it can be mapped easily to the object,
+ * i.e. the image is not transformed or repeated. Else invalidate the whole object.
+ * @param obj       pointer to a gif object
+ * @param area      the changed area relative to the image
+ */
+static void invalidate_frame_area(lv_obj_t * obj, const lv_area_t * area)
+{
+    lv_img_t * img = (lv_img_t *) obj;
+    if(img->zoom != LV_ZOOM_NONE || img->angle != 0 || img->offset.x != 0 || img->offset.y != 0 ||
+       lv_obj_get_content_width(obj) != img->w || lv_obj_get_content_height(obj) != img->h) {
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    lv_area_t inv_area;
+    lv_obj_get_content_coords(obj, &inv_area);
+    lv_area_move(&inv_area, area->x1, area->y1);
+    lv_area_set_width(&inv_area, lv_area_get_width(area));
+    lv_area_set_height(&inv_area, lv_area_get_height(area));
+    lv_obj_invalidate_area(obj, &inv_area);
+}
+
+/**
+ * Close the gif. If a frame is being decoded in the background the job closes it when it's ready.
+ */
+static void close_gif(lv_gif_t * gifobj)
+{
+    if(gifobj->job) {
+        gifobj->job->obj = NULL;
+        gifobj->job->alloc_buf = gifobj->alloc_buf;
+        gifobj->job = NULL;
+    }
+    else {
+        gd_close_gif(gifobj->gif);
+        lv_free(gifobj->alloc_buf);
+    }
+
+    gifobj->gif = NULL;
+    gifobj->alloc_buf = NULL;
+    gifobj->back_buf = NULL;
+    gifobj->frame_ready = 0;
+    gifobj->restart_req = 0;
+}
+
+/**
+ * Start decoding the next frame into the back buffer in a worker thread
+ */
+static void job_start(lv_obj_t * obj)
+{
+    lv_gif_t * gifobj = (lv_gif_t *) obj;
+    uint32_t w = gifobj->imgdsc.header.w;
+    uint32_t h = gifobj->imgdsc.header.h;
+
+    if(gifobj->back_buf == NULL) {
+        gifobj->alloc_buf = lv_malloc(w * h * LV_COLOR_FORMAT_NATIVE_ALPHA_SIZE);
+        LV_ASSERT_MALLOC(gifobj->alloc_buf);
+        if(gifobj->alloc_buf == NULL) {
+            LV_LOG_WARN("Not enough memory for the back buffer, decode in the LVGL thread");
+            gifobj->async = 0;
+            return;
+        }
+        gifobj->back_buf = gifobj->alloc_buf;
+        lv_area_set(&gifobj->back_stale_area, 0, 0, w - 1, h - 1);
+    }
+
+    lv_gif_job_t * job = lv_malloc(sizeof(lv_gif_job_t));
+    LV_ASSERT_MALLOC(job);
+    if(job == NULL) return;
+    lv_memzero(job, sizeof(lv_gif_job_t));
+
+    job->obj = obj;
+    job->gif = gifobj->gif;
+    job->buf = gifobj->back_buf;
+    job->shown_buf = gifobj->imgdsc.data;
+    job->stale_area = gifobj->back_stale_area;
+    job->job.exec_cb = job_exec_cb;
+    job->job.ready_cb = job_ready_cb;
+    job->job.cancel_cb = job_cancel_cb;
+
+    gifobj->job = job;
+    lv_worker_add(&job->job);
+}
+
+/**
+ * Update the back buffer and decode the next frame into it. Called in a worker thread.
+ */
+static void job_exec_cb(lv_worker_job_t * job)
+{
+    lv_gif_job_t * j = (lv_gif_job_t *)job;
+    uint32_t w = j->gif->width;
+    uint32_t row_size = lv_area_get_width(&j->stale_area) * LV_COLOR_FORMAT_NATIVE_ALPHA_SIZE;
+    lv_coord_t y;
+    for(y = j->stale_area.y1; y <= j->stale_area.y2; y++) {
+        uint32_t ofs = (y * w + j->stale_area.x1) * LV_COLOR_FORMAT_NATIVE_ALPHA_SIZE;
+        lv_memcpy(j->buf + ofs, j->shown_buf + ofs, row_size);
+    }
+
+    j->has_next = decode_frame(j->gif, j->buf, &j->frame_area);
+    j->delay = j->gif->gce.delay * 10;
+}
+
+/**
+ * Store the decoded frame to show it when the current frame's delay has elapsed.
+ * Called from `lv_timer_handler()`.
+ */
+static void job_ready_cb(lv_worker_job_t * job)
+{
+    lv_gif_job_t * j = (lv_gif_job_t *)job;
+    lv_obj_t * obj = j->obj;
+
+    if(obj == NULL) {
+        /*The gif was closed meanwhile*/
+        gd_close_gif(j->gif);
+        lv_free(j->alloc_buf);
+        lv_free(j);
+        return;
+    }
+
+    lv_gif_t * gifobj = (lv_gif_t *) obj;
+    gifobj->job = NULL;
+
+    if(gifobj->restart_req) {
+        /*Drop the frame, the back buffer will be updated from the shown frame*/
+        gifobj->restart_req = 0;
+        gd_rewind(gifobj->gif);
+        lv_area_set(&gifobj->back_stale_area, 0, 0, gifobj->imgdsc.header.w - 1, gifobj->imgdsc.header.h - 1);
+    }
+    else {
+        gifobj->frame_ready = 1;
+        gifobj->frame_area = j->frame_area;
+        gifobj->frame_delay = j->delay;
+        gifobj->has_next = j->has_next;
+    }
+    lv_free(j);
+
+    /*Show it now if the shown frame's delay has already elapsed*/
+    if(gifobj->frame_ready && !gifobj->timer->paused) next_frame_task_cb(gifobj->timer);
+}
+
+/**
+ * Drop a not started job in `lv_deinit()`. Unlike `job_ready_cb` it doesn't start decoding the next frame.
+ */
+static void job_cancel_cb(lv_worker_job_t * job)
+{
+    lv_gif_job_t * j = (lv_gif_job_t *)job;
+    lv_obj_t * obj = j->obj;
+
+    if(obj == NULL) {
+        /*The gif was closed meanwhile*/
+        gd_close_gif(j->gif);
+        lv_free(j->alloc_buf);
+        lv_free(j);
+        return;
+    }
+
+    /*Nothing was decoded, so the gif and the back buffer are the same as before the job*/
+    lv_gif_t * gifobj = (lv_gif_t *) obj;
+    gifobj->job = NULL;
+    if(gifobj->restart_req) {
+        gifobj->restart_req = 0;
+        gd_rewind(gifobj->gif);
+        lv_area_set(&gifobj->back_stale_area, 0, 0, gifobj->imgdsc.header.w - 1, gifobj->imgdsc.header.h - 1);
+    }
+    lv_free(j);
 }
 
 #endif /*LV_USE_GIF*/
@@ -27,12 +27,25 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+struct _lv_gif_job_t;
+
 typedef struct {
     lv_img_t img;
     gd_GIF * gif;
     lv_timer_t * timer;
     lv_img_dsc_t imgdsc;
     uint32_t last_call;
+    uint32_t delay;                 /*Show the current frame for this long [ms]*/
+    uint8_t * back_buf;             /*The next frame is decoded here in the background*/
+    uint8_t * alloc_buf;            /*The allocated one from `imgdsc.data` and `back_buf`*/
+    lv_area_t back_stale_area;      /*Area where `back_buf` differs from the shown frame*/
+    lv_area_t frame_area;           /*Area changed by the decoded but not shown frame*/
+    uint32_t frame_delay;           /*Delay of the decoded but not shown frame [ms]*/
+    struct _lv_gif_job_t * job;     /*Not NULL while the next frame is being decoded in the background*/
+    int8_t has_next;                /*Result of decoding the not shown frame*/
+    uint8_t async : 1;              /*1: decode the frames in a worker thread*/
+    uint8_t frame_ready : 1;        /*1: the next frame is decoded in `back_buf` but not shown yet*/
+    uint8_t restart_req : 1;        /*1: restart when the background decoding is finished*/
 } lv_gif_t;
 
 extern const lv_obj_class_t lv_gif_class;
@@ -45,6 +58,15 @@ lv_obj_t * lv_gif_create(lv_obj_t * parent);
 void lv_gif_set_src(lv_obj_t * obj, const void * src);
 void lv_gif_restart(lv_obj_t * gif);
 
+/**
+ * Decode the frames in a worker thread into a back buffer instead of in `lv_timer_handler()`.
+ * The next frame is decoded while the current one is shown, so it's ready when it needs to be shown.
+ * Needs an other `width x height` sized buffer.
+ * @param obj       pointer to a gif object
+ * @param en        true: decode in the background; false: decode in `lv_timer_handler()`
+ */
+void lv_gif_set_async(lv_obj_t * obj, bool en);
+
 /**********************
  *      MACROS
  **********************/
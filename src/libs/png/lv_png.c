@@ -10,6 +10,7 @@
 #if LV_USE_PNG
 
 #include "lv_png.h"
+#include "lv_png_stream.h"
 #include "lodepng.h"
 #include <stdlib.h>
 
@@ -27,6 +28,9 @@
 static lv_res_t decoder_info(struct _lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header);
 static lv_res_t decoder_open(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc);
 static void decoder_close(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc);
+static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
+                                  lv_coord_t len, uint8_t * buf);
+static lv_res_t stream_open(lv_img_decoder_dsc_t * dsc, bool * supported);
 static void convert_color_depth(uint8_t ** img_p, uint32_t px_cnt);
 
 /**********************
@@ -49,7 +53,9 @@ void lv_png_init(void)
     lv_img_decoder_t * dec = lv_img_decoder_create();
     lv_img_decoder_set_info_cb(dec, decoder_info);
     lv_img_decoder_set_open_cb(dec, decoder_open);
+    lv_img_decoder_set_read_line_cb(dec, decoder_read_line);
     lv_img_decoder_set_close_cb(dec, decoder_close);
+    lv_img_decoder_set_thread_safe(dec, true);
 }
 
 /**********************
@@ -155,6 +161,11 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
     if(dsc->src_type == LV_IMG_SRC_FILE) {
         const char * fn = dsc->src;
         if(strcmp(lv_fs_get_ext(fn), "png") == 0) {              /*Check the extension*/
+            /*Non-interlaced images are decoded row by row without loading the whole file.
+             *If they are corrupted, lodepng would fail too.*/
+            bool supported;
+            if(stream_open(dsc, &supported) == LV_RES_OK) return LV_RES_OK;
+            if(supported) return LV_RES_INV;
 
             /*Load the PNG file into buffer. It's still compressed (not decoded)*/
             unsigned char * png_data = NULL;    /*Pointer to the loaded data. Same as the original file just loaded into the RAM*/
@@ -192,6 +203,10 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
     }
     /*If it's a PNG file in a  C array...*/
     else if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
+        bool supported;
+        if(stream_open(dsc, &supported) == LV_RES_OK) return LV_RES_OK;
+        if(supported) return LV_RES_INV;
+
         const lv_img_dsc_t * img_dsc = dsc->src;
         unsigned png_width;             /*Not used, just required by the decoder*/
         unsigned png_height;            /*Not used, just required by the decoder*/
@@ -226,6 +241,69 @@ static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc
         lv_free((uint8_t *)dsc->img_data);
         dsc->img_data = NULL;
     }
+
+    if(dsc->user_data) {
+        _lv_png_stream_close(dsc->user_data);
+        dsc->user_data = NULL;
+    }
+}
+
+/**
+ * Decode `len` pixels starting from the given `x`, `y` coordinates when the image isn't decoded fully.
+ * @return LV_RES_OK: ok; LV_RES_INV: failed
+ */
+static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
+                                  lv_coord_t len, uint8_t * buf)
+{
+    LV_UNUSED(decoder);
+    if(dsc->user_data == NULL) return LV_RES_INV;
+
+    return _lv_png_stream_read_line(dsc->user_data, x, y, len, buf);
+}
+
+/**
+ * Decode a non-interlaced PNG row by row. The rows are converted directly to the native color format
+ * so neither the whole compressed file nor an intermediate ARGB8888 image is kept in the memory.
+ * If `LV_PNG_USE_READ_LINE` is enabled or the decoded image doesn't fit into the memory,
+ * the rows are read only when they are drawn.
+ * @param dsc       the decoder descriptor
+ * @param supported set to false if the image can't be streamed, e.g. it's interlaced
+ * @return          LV_RES_OK: `dsc->img_data` or `dsc->user_data` is set;
+ *                  LV_RES_INV: the image is corrupted or can't be streamed
+ */
+static lv_res_t stream_open(lv_img_decoder_dsc_t * dsc, bool * supported)
+{
+    lv_png_stream_t * stream = _lv_png_stream_open(dsc, supported);
+    if(stream == NULL) return LV_RES_INV;
+
+#if LV_PNG_USE_READ_LINE == 0
+    lv_coord_t w = dsc->header.w;
+    lv_coord_t h = dsc->header.h;
+    uint32_t stride = (uint32_t)w * LV_COLOR_FORMAT_NATIVE_ALPHA_SIZE;
+
+    /*Not asserted because there is a fallback*/
+    uint8_t * img_data = lv_malloc(stride * h);
+    if(img_data) {
+        lv_coord_t y;
+        for(y = 0; y < h; y++) {
+            if(_lv_png_stream_read_line(stream, 0, y, w, img_data + y * stride) != LV_RES_OK) break;
+        }
+        _lv_png_stream_close(stream);
+
+        if(y < h) {
+            lv_free(img_data);
+            return LV_RES_INV;
+        }
+
+        dsc->img_data = img_data;
+        return LV_RES_OK;
+    }
+
+    LV_LOG_WARN("not enough memory to decode the image, its rows will be decoded while drawing");
+#endif
+
+    dsc->user_data = stream;
+    return LV_RES_OK;
 }
 
 /**
@@ -0,0 +1,992 @@
+/**
+ * @file lv_png_stream.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_png_stream.h"
+#if LV_USE_PNG
+
+#include "../../misc/lv_fs.h"
+#include "../../misc/lv_mem.h"
+#include "../../misc/lv_log.h"
+#include "../../misc/lv_assert.h"
+#include "../../misc/lv_math.h"
+#include "../../misc/lv_printf.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define WINDOW_SIZE     32768
+#define WINDOW_MASK     (WINDOW_SIZE - 1)
+#define FAST_BITS       9
+#define FILE_BUF_SIZE   512
+#define ADLER_MOD       65521
+#define ADLER_NMAX      5552    /*Max. bytes to sum before `b` might overflow*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    INFLATE_BLOCK_START,
+    INFLATE_STORED,
+    INFLATE_HUFFMAN,
+} inflate_mode_t;
+
+typedef struct {
+    uint16_t fast[1 << FAST_BITS];  /*`(symbol << 4) | length` of the codes not longer than `FAST_BITS`*/
+    uint16_t count[16];             /*Number of codes of each length*/
+    uint16_t symbol[288];           /*The symbols ordered by their codes*/
+} huffman_t;
+
+struct _lv_png_stream_t {
+    /*Source*/
+    const uint8_t * data;       /*The PNG in a variable or NULL if it's a file*/
+    uint32_t data_size;
+    lv_fs_file_t file;
+    uint8_t * file_buf;
+    uint32_t file_buf_pos;
+    uint32_t file_buf_len;
+    uint32_t pos;               /*Read position in `data` or in the file*/
+    uint32_t idat_pos;          /*Position of the first IDAT chunk*/
+    uint32_t chunk_left;        /*Remaining bytes in the current IDAT chunk*/
+    uint32_t chunk_crc;         /*CRC of the current IDAT chunk so far*/
+    bool in_idat;               /*An IDAT chunk was started so its CRC follows its data*/
+    bool idat_end;
+
+    /*Header*/
+    uint32_t w;
+    uint32_t h;
+    uint8_t depth;
+    uint8_t color_type;
+    bool interlaced;
+    uint8_t bpp;                /*Bytes per pixel for the filters (at least 1)*/
+    uint32_t row_size;
+    bool has_trns;
+    uint16_t trns[3];           /*The transparent color of gray and RGB images*/
+    uint8_t palette[256][4];    /*R, G, B, A*/
+
+    /*Rows*/
+    uint8_t * row;
+    uint8_t * prev_row;
+    int32_t row_y;              /*The row in `row` or -1 if none*/
+
+    /*Inflate*/
+    uint32_t bit_buf;
+    uint32_t bit_cnt;
+    uint8_t * window;
+    uint32_t win_pos;
+    uint32_t win_filled;
+    inflate_mode_t mode;
+    bool last_block;
+    bool stream_end;            /*The last block ended*/
+    bool error;
+    uint32_t adler;             /*Adler-32 of the inflated data so far*/
+    uint32_t stored_left;
+    uint32_t copy_len;
+    uint32_t copy_dist;
+    huffman_t lit;
+    huffman_t dist;
+};
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool src_read(lv_png_stream_t * s, uint8_t * buf, uint32_t len);
+static void src_seek(lv_png_stream_t * s, uint32_t pos);
+static uint32_t crc_update(uint32_t crc, const uint8_t * buf, uint32_t len);
+static uint32_t adler_update(uint32_t adler, const uint8_t * buf, uint32_t len);
+static bool chunk_crc_check(lv_png_stream_t * s, const uint8_t * type, uint32_t len);
+static bool parse_chunks(lv_png_stream_t * s);
+static bool restart(lv_png_stream_t * s);
+static bool idat_next_chunk(lv_png_stream_t * s);
+static bool idat_byte(lv_png_stream_t * s, uint8_t * b);
+static uint32_t get_bits(lv_png_stream_t * s, uint32_t n);
+static bool huffman_build(huffman_t * h, const uint8_t * lengths, uint32_t n);
+static int32_t huffman_decode(lv_png_stream_t * s, const huffman_t * h);
+static bool fixed_tables(lv_png_stream_t * s);
+static bool dynamic_tables(lv_png_stream_t * s);
+static bool inflate_read(lv_png_stream_t * s, uint8_t * out, uint32_t len);
+static bool inflate_end(lv_png_stream_t * s);
+static bool decode_row(lv_png_stream_t * s);
+static void convert_row(lv_png_stream_t * s, int32_t x, int32_t len, uint8_t * buf);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const uint16_t len_base[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                      35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+                                     };
+static const uint8_t len_extra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                      3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+                                     };
+static const uint16_t dist_base[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                                       257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+                                      };
+static const uint8_t dist_extra[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+                                       7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+                                      };
+static const uint8_t code_length_order[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+/*CRC-32 of the 4 bit values, to keep the table small*/
+static const uint32_t crc_table[16] = {0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4,
+                                       0x4db26158, 0x5005713c, 0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c,
+                                       0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c
+                                      };
+
+/**********************
+ *      MACROS
+ **********************/
+#define READ_BE32(p) (((uint32_t)(p)[0] << 24) | ((uint32_t)(p)[1] << 16) | ((uint32_t)(p)[2] << 8) | (uint32_t)(p)[3])
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_png_stream_t * _lv_png_stream_open(const lv_img_decoder_dsc_t * dsc, bool * supported)
+{
+    *supported = true;
+
+    lv_png_stream_t * s = lv_malloc(sizeof(lv_png_stream_t));
+    LV_ASSERT_MALLOC(s);
+    if(s == NULL) return NULL;
+    lv_memzero(s, sizeof(lv_png_stream_t));
+
+    if(dsc->src_type == LV_IMG_SRC_FILE) {
+        if(lv_fs_open(&s->file, dsc->src, LV_FS_MODE_RD) != LV_FS_RES_OK) {
+            lv_free(s);
+            return NULL;
+        }
+        s->file_buf = lv_malloc(FILE_BUF_SIZE);
+        LV_ASSERT_MALLOC(s->file_buf);
+        if(s->file_buf == NULL) {
+            _lv_png_stream_close(s);
+            return NULL;
+        }
+    }
+    else if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
+        const lv_img_dsc_t * img_dsc = dsc->src;
+        if(img_dsc->data == NULL) {
+            lv_free(s);
+            return NULL;
+        }
+        s->data = img_dsc->data;
+        s->data_size = img_dsc->data_size;
+    }
+    else {
+        lv_free(s);
+        return NULL;
+    }
+
+    if(!parse_chunks(s)) {
+        *supported = !s->interlaced;
+        _lv_png_stream_close(s);
+        return NULL;
+    }
+
+    s->window = lv_malloc(WINDOW_SIZE);
+    s->row = lv_malloc(s->row_size);
+    s->prev_row = lv_malloc(s->row_size);
+    if(s->window == NULL || s->row == NULL || s->prev_row == NULL) {
+        LV_LOG_WARN("out of memory");
+        _lv_png_stream_close(s);
+        return NULL;
+    }
+
+    if(!restart(s)) {
+        _lv_png_stream_close(s);
+        return NULL;
+    }
+
+    return s;
+}
+
+lv_res_t _lv_png_stream_read_line(lv_png_stream_t * s, int32_t x, int32_t y, int32_t len, uint8_t * buf)
+{
+    if(x < 0 || y < 0 || len <= 0 || (uint32_t)y >= s->h || (uint32_t)(x + len) > s->w) return LV_RES_INV;
+
+    if(y < s->row_y || s->error) {
+        if(!restart(s)) return LV_RES_INV;
+    }
+
+    while(s->row_y < y) {
+        if(!decode_row(s)) {
+            LV_LOG_WARN("corrupted image data in row %" LV_PRId32, s->row_y + 1);
+            s->error = true;
+            return LV_RES_INV;
+        }
+    }
+
+    convert_row(s, x, len, buf);
+    return LV_RES_OK;
+}
+
+void _lv_png_stream_close(lv_png_stream_t * s)
+{
+    if(s == NULL) return;
+
+    if(s->data == NULL) lv_fs_close(&s->file);
+    lv_free(s->file_buf);
+    lv_free(s->window);
+    lv_free(s->row);
+    lv_free(s->prev_row);
+    lv_free(s);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool src_read(lv_png_stream_t * s, uint8_t * buf, uint32_t len)
+{
+    if(s->data) {
+        if(len > s->data_size || s->pos > s->data_size - len) return false;
+        lv_memcpy(buf, s->data + s->pos, len);
+        s->pos += len;
+        return true;
+    }
+
+    while(len) {
+        if(s->file_buf_pos == s->file_buf_len) {
+            uint32_t rn = 0;
+            if(lv_fs_read(&s->file, s->file_buf, FILE_BUF_SIZE, &rn) != LV_FS_RES_OK || rn == 0) return false;
+            s->file_buf_pos = 0;
+            s->file_buf_len = rn;
+        }
+        uint32_t n = LV_MIN(len, s->file_buf_len - s->file_buf_pos);
+        lv_memcpy(buf, s->file_buf + s->file_buf_pos, n);
+        s->file_buf_pos += n;
+        s->pos += n;
+        buf += n;
+        len -= n;
+    }
+    return true;
+}
+
+static void src_seek(lv_png_stream_t * s, uint32_t pos)
+{
+    s->pos = pos;
+    if(s->data == NULL) {
+        lv_fs_seek(&s->file, pos, LV_FS_SEEK_SET);
+        s->file_buf_pos = 0;
+        s->file_buf_len = 0;
+    }
+}
+
+static uint32_t crc_update(uint32_t crc, const uint8_t * buf, uint32_t len)
+{
+    while(len--) {
+        crc ^= *buf++;
+        crc = (crc >> 4) ^ crc_table[crc & 0x0F];
+        crc = (crc >> 4) ^ crc_table[crc & 0x0F];
+    }
+    return crc;
+}
+
+static uint32_t adler_update(uint32_t adler, const uint8_t * buf, uint32_t len)
+{
+    uint32_t a = adler & 0xFFFF;
+    uint32_t b = adler >> 16;
+    while(len) {
+        uint32_t n = LV_MIN(len, ADLER_NMAX);
+        len -= n;
+        while(n--) {
+            a += *buf++;
+            b += a;
+        }
+        a %= ADLER_MOD;
+        b %= ADLER_MOD;
+    }
+    return (b << 16) | a;
+}
+
+/**
+ * Check the CRC of a chunk and go back to the start of its data
+ * @param s     the stream at the start of the chunk's data
+ * @param type  the type of the chunk
+ * @param len   length of the chunk's data
+ * @return      false if the CRC is wrong or the chunk can't be read
+ */
+static bool chunk_crc_check(lv_png_stream_t * s, const uint8_t * type, uint32_t len)
+{
+    uint32_t data_pos = s->pos;
+    uint32_t crc = crc_update(0xFFFFFFFF, type, 4);
+    uint8_t buf[64];
+    while(len) {
+        uint32_t n = LV_MIN(len, sizeof(buf));
+        if(!src_read(s, buf, n)) return false;
+        crc = crc_update(crc, buf, n);
+        len -= n;
+    }
+
+    if(!src_read(s, buf, 4) || READ_BE32(buf) != (crc ^ 0xFFFFFFFF)) {
+        LV_LOG_WARN("wrong chunk CRC");
+        return false;
+    }
+
+    src_seek(s, data_pos);
+    return true;
+}
+
+/**
+ * Process the chunks before the image data and find the first IDAT chunk
+ * @return false if the PNG is invalid or not supported
+ */
+static bool parse_chunks(lv_png_stream_t * s)
+{
+    static const uint8_t magic[] = {0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a};
+    uint8_t buf[16];
+    if(!src_read(s, buf, sizeof(magic)) || memcmp(buf, magic, sizeof(magic)) != 0) return false;
+
+    bool has_header = false;
+    while(1) {
+        uint32_t chunk_pos = s->pos;
+        if(!src_read(s, buf, 8)) return false;
+        uint32_t len = READ_BE32(buf);
+        uint32_t chunk_end = chunk_pos + 8 + len + 4;
+        if(chunk_end < chunk_pos) return false;
+        uint8_t type[4];
+        lv_memcpy(type, buf + 4, 4);
+
+        /*The CRC of the used chunks is checked. The IDAT chunks are checked while decoding*/
+        bool used = memcmp(type, "IHDR", 4) == 0 || memcmp(type, "PLTE", 4) == 0 || memcmp(type, "tRNS", 4) == 0;
+        if(used && !chunk_crc_check(s, type, len)) return false;
+
+        if(memcmp(type, "IHDR", 4) == 0) {
+            if(len != 13 || !src_read(s, buf, 13)) return false;
+            s->w = READ_BE32(buf);
+            s->h = READ_BE32(buf + 4);
+            s->depth = buf[8];
+            s->color_type = buf[9];
+            if(buf[12] != 0) {
+                LV_LOG_INFO("interlaced PNGs can't be streamed");
+                s->interlaced = true;
+                return false;
+            }
+            if(buf[10] != 0 || buf[11] != 0 || s->w == 0 || s->h == 0 || s->w > 0x7FFF || s->h > 0x7FFF) return false;
+
+            uint32_t channels;
+            switch(s->color_type) {
+                case 0:
+                    channels = 1;
+                    if(s->depth != 1 && s->depth != 2 && s->depth != 4 && s->depth != 8 && s->depth != 16) return false;
+                    break;
+                case 3:
+                    channels = 1;
+                    if(s->depth != 1 && s->depth != 2 && s->depth != 4 && s->depth != 8) return false;
+                    break;
+                case 2:
+                case 4:
+                case 6:
+                    channels = s->color_type == 2 ? 3 : (s->color_type == 4 ? 2 : 4);
+                    if(s->depth != 8 && s->depth != 16) return false;
+                    break;
+                default:
+                    return false;
+            }
+
+            uint32_t px_bits = channels * s->depth;
+            s->bpp = px_bits < 8 ? 1 : px_bits / 8;
+            s->row_size = (s->w * px_bits + 7) / 8;
+            has_header = true;
+        }
+        else if(memcmp(type, "PLTE", 4) == 0) {
+            uint32_t i;
+            for(i = 0; i < len / 3 && i < 256; i++) {
+                if(!src_read(s, s->palette[i], 3)) return false;
+                s->palette[i][3] = 0xFF;
+            }
+        }
+        else if(memcmp(type, "tRNS", 4) == 0) {
+            if(s->color_type == 3) {
+                uint32_t i;
+                for(i = 0; i < len && i < 256; i++) {
+                    if(!src_read(s, &s->palette[i][3], 1)) return false;
+                }
+            }
+            else if(len <= 6) {
+                if(!src_read(s, buf, len)) return false;
+                uint32_t i;
+                for(i = 0; i < len / 2; i++) s->trns[i] = (buf[i * 2] << 8) | buf[i * 2 + 1];
+                s->has_trns = true;
+            }
+        }
+        else if(memcmp(type, "IDAT", 4) == 0) {
+            if(!has_header) return false;
+            s->idat_pos = chunk_pos;
+            return true;
+        }
+        else if(memcmp(type, "IEND", 4) == 0) {
+            return false;
+        }
+
+        /*Skip the rest of the chunk and its CRC*/
+        src_seek(s, chunk_end);
+    }
+}
+
+/**
+ * Go to the first row and check the zlib header
+ * @return false if the image data is corrupted
+ */
+static bool restart(lv_png_stream_t * s)
+{
+    src_seek(s, s->idat_pos);
+    s->chunk_left = 0;
+    s->in_idat = false;
+    s->idat_end = false;
+    s->bit_buf = 0;
+    s->bit_cnt = 0;
+    s->win_pos = 0;
+    s->win_filled = 0;
+    s->mode = INFLATE_BLOCK_START;
+    s->last_block = false;
+    s->stream_end = false;
+    s->error = false;
+    s->adler = 1;
+    s->copy_len = 0;
+    s->row_y = -1;
+    lv_memzero(s->row, s->row_size);
+    lv_memzero(s->prev_row, s->row_size);
+
+    uint32_t cmf = get_bits(s, 8);
+    uint32_t flg = get_bits(s, 8);
+    if(s->error || (cmf & 0x0F) != 8 || (cmf >> 4) > 7 || ((cmf << 8) | flg) % 31 != 0 || (flg & 0x20)) {
+        LV_LOG_WARN("invalid zlib header");
+        s->error = true;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Check the CRC of the finished IDAT chunk and start the next one
+ * @return false if there are no more IDAT chunks. Sets `s->error` if the CRC is wrong.
+ */
+static bool idat_next_chunk(lv_png_stream_t * s)
+{
+    uint8_t buf[8];
+    if(s->in_idat) {
+        if(!src_read(s, buf, 4) || READ_BE32(buf) != (s->chunk_crc ^ 0xFFFFFFFF)) {
+            LV_LOG_WARN("wrong IDAT chunk CRC");
+            s->error = true;
+            return false;
+        }
+    }
+
+    if(!src_read(s, buf, 8) || memcmp(buf + 4, "IDAT", 4) != 0) return false;
+
+    s->chunk_left = READ_BE32(buf);
+    s->chunk_crc = crc_update(0xFFFFFFFF, buf + 4, 4);
+    s->in_idat = true;
+    return true;
+}
+
+/**
+ * Get the next byte of the compressed data which might be split into more IDAT chunks
+ */
+static bool idat_byte(lv_png_stream_t * s, uint8_t * b)
+{
+    while(s->chunk_left == 0) {
+        if(s->idat_end) return false;
+        if(!idat_next_chunk(s)) {
+            s->idat_end = true;
+            return false;
+        }
+    }
+
+    if(s->data) {
+        if(s->pos >= s->data_size) return false;
+        *b = s->data[s->pos];
+        s->pos++;
+    }
+    else if(s->file_buf_pos < s->file_buf_len) {
+        *b = s->file_buf[s->file_buf_pos];
+        s->file_buf_pos++;
+        s->pos++;
+    }
+    else if(!src_read(s, b, 1)) {
+        return false;
+    }
+
+    s->chunk_crc = crc_update(s->chunk_crc, b, 1);
+    s->chunk_left--;
+    return true;
+}
+
+/**
+ * Get `n` (max. 16) bits. Sets `s->error` if the data ended.
+ */
+static uint32_t get_bits(lv_png_stream_t * s, uint32_t n)
+{
+    while(s->bit_cnt < n) {
+        uint8_t b;
+        if(!idat_byte(s, &b)) {
+            s->error = true;
+            return 0;
+        }
+        s->bit_buf |= (uint32_t)b << s->bit_cnt;
+        s->bit_cnt += 8;
+    }
+
+    uint32_t v = s->bit_buf & ((1UL << n) - 1);
+    s->bit_buf >>= n;
+    s->bit_cnt -= n;
+    return v;
+}
+
+static bool huffman_build(huffman_t * h, const uint8_t * lengths, uint32_t n)
+{
+    uint16_t offs[16];
+    uint32_t i;
+
+    lv_memzero(h->count, sizeof(h->count));
+    lv_memzero(h->fast, sizeof(h->fast));
+    for(i = 0; i < n; i++) h->count[lengths[i]]++;
+    h->count[0] = 0;
+
+    /*Check for over-subscribed codes*/
+    int32_t left = 1;
+    for(i = 1; i < 16; i++) {
+        left <<= 1;
+        left -= h->count[i];
+        if(left < 0) return false;
+    }
+
+    offs[1] = 0;
+    for(i = 1; i < 15; i++) offs[i + 1] = offs[i] + h->count[i];
+    for(i = 0; i < n; i++) {
+        if(lengths[i]) h->symbol[offs[lengths[i]]++] = (uint16_t)i;
+    }
+
+    /*Assign the canonical codes and fill the lookup table with the short ones.
+     *The codes are stored MSB first so they need to be reversed.*/
+    uint32_t code = 0;
+    uint32_t idx = 0;
+    uint32_t len;
+    for(len = 1; len <= FAST_BITS; len++) {
+        uint32_t k;
+        for(k = 0; k < h->count[len]; k++) {
+            uint32_t rev = 0;
+            uint32_t b;
+            for(b = 0; b < len; b++) rev |= ((code >> b) & 1) << (len - 1 - b);
+
+            uint16_t e = (uint16_t)((h->symbol[idx] << 4) | len);
+            for(; rev < (1 << FAST_BITS); rev += 1 << len) h->fast[rev] = e;
+            code++;
+            idx++;
+        }
+        code <<= 1;
+    }
+
+    return true;
+}
+
+/**
+ * Decode a symbol
+ * @return the symbol or -1 on error
+ */
+static int32_t huffman_decode(lv_png_stream_t * s, const huffman_t * h)
+{
+    /*Read ahead as much as possible but it's not an error yet if the data ends*/
+    while(s->bit_cnt <= 24) {
+        uint8_t b;
+        if(!idat_byte(s, &b)) break;
+        s->bit_buf |= (uint32_t)b << s->bit_cnt;
+        s->bit_cnt += 8;
+    }
+
+    uint16_t e = h->fast[s->bit_buf & ((1 << FAST_BITS) - 1)];
+    if(e && (uint32_t)(e & 0x0F) <= s->bit_cnt) {
+        s->bit_buf >>= e & 0x0F;
+        s->bit_cnt -= e & 0x0F;
+        return e >> 4;
+    }
+
+    /*Decode the long codes bit by bit*/
+    int32_t code = 0;
+    int32_t first = 0;
+    int32_t index = 0;
+    uint32_t len;
+    for(len = 1; len < 16; len++) {
+        code |= (int32_t)get_bits(s, 1);
+        if(s->error) return -1;
+        int32_t count = h->count[len];
+        if(code - count < first) return h->symbol[index + (code - first)];
+        index += count;
+        first += count;
+        first <<= 1;
+        code <<= 1;
+    }
+
+    s->error = true;
+    return -1;
+}
+
+static bool fixed_tables(lv_png_stream_t * s)
+{
+    uint8_t lengths[288];
+    uint32_t i;
+    for(i = 0; i < 144; i++) lengths[i] = 8;
+    for(; i < 256; i++) lengths[i] = 9;
+    for(; i < 280; i++) lengths[i] = 7;
+    for(; i < 288; i++) lengths[i] = 8;
+    huffman_build(&s->lit, lengths, 288);
+
+    for(i = 0; i < 30; i++) lengths[i] = 5;
+    huffman_build(&s->dist, lengths, 30);
+    return true;
+}
+
+static bool dynamic_tables(lv_png_stream_t * s)
+{
+    uint8_t lengths[286 + 30];
+    uint32_t nlen = get_bits(s, 5) + 257;
+    uint32_t ndist = get_bits(s, 5) + 1;
+    uint32_t ncode = get_bits(s, 4) + 4;
+    if(s->error || nlen > 286 || ndist > 30) return false;
+
+    /*Read the code of the code lengths into `lit` temporarily*/
+    lv_memzero(lengths, 19);
+    uint32_t i;
+    for(i = 0; i < ncode; i++) lengths[code_length_order[i]] = (uint8_t)get_bits(s, 3);
+    if(s->error || !huffman_build(&s->lit, lengths, 19)) return false;
+
+    i = 0;
+    while(i < nlen + ndist) {
+        int32_t sym = huffman_decode(s, &s->lit);
+        if(sym < 0) return false;
+        if(sym < 16) {
+            lengths[i++] = (uint8_t)sym;
+            continue;
+        }
+
+        uint8_t len = 0;
+        uint32_t rep;
+        if(sym == 16) {
+            if(i == 0) return false;
+            len = lengths[i - 1];
+            rep = 3 + get_bits(s, 2);
+        }
+        else if(sym == 17) {
+            rep = 3 + get_bits(s, 3);
+        }
+        else {
+            rep = 11 + get_bits(s, 7);
+        }
+        if(s->error || i + rep > nlen + ndist) return false;
+        while(rep--) lengths[i++] = len;
+    }
+
+    /*The end of block code is mandatory*/
+    if(lengths[256] == 0) return false;
+
+    return huffman_build(&s->lit, lengths, nlen) && huffman_build(&s->dist, lengths + nlen, ndist);
+}
+
+/**
+ * Inflate the next `len` bytes. The state is kept between the calls so
+ * it can be continued from where the previous call stopped.
+ * @return false if the data is corrupted or ended before `len` bytes
+ */
+static bool inflate_read(lv_png_stream_t * s, uint8_t * out, uint32_t len)
+{
+    uint8_t * window = s->window;
+    uint8_t * out_start = out;
+
+    while(len > 0 && !s->error) {
+        if(s->copy_len) {
+            uint32_t n = LV_MIN(s->copy_len, len);
+            s->copy_len -= n;
+            len -= n;
+            uint32_t src_pos = (s->win_pos - s->copy_dist) & WINDOW_MASK;
+            while(n--) {
+                uint8_t b = window[src_pos];
+                src_pos = (src_pos + 1) & WINDOW_MASK;
+                window[s->win_pos] = b;
+                s->win_pos = (s->win_pos + 1) & WINDOW_MASK;
+                *out++ = b;
+            }
+            continue;
+        }
+
+        if(s->mode == INFLATE_BLOCK_START) {
+            if(s->stream_end) break;
+            s->last_block = get_bits(s, 1);
+            uint32_t type = get_bits(s, 2);
+            if(s->error) break;
+
+            if(type == 0) {
+                /*Skip the bits up to the byte boundary*/
+                get_bits(s, s->bit_cnt & 0x7);
+                uint32_t stored_len = get_bits(s, 16);
+                uint32_t stored_nlen = get_bits(s, 16);
+                if(s->error || stored_len != (~stored_nlen & 0xFFFF)) s->error = true;
+                s->stored_left = stored_len;
+                s->mode = INFLATE_STORED;
+            }
+            else if(type == 1) {
+                fixed_tables(s);
+                s->mode = INFLATE_HUFFMAN;
+            }
+            else if(type == 2) {
+                if(!dynamic_tables(s)) s->error = true;
+                s->mode = INFLATE_HUFFMAN;
+            }
+            else {
+                s->error = true;
+            }
+        }
+        else if(s->mode == INFLATE_STORED) {
+            if(s->stored_left == 0) {
+                s->mode = INFLATE_BLOCK_START;
+                s->stream_end = s->last_block;
+                continue;
+            }
+            uint8_t b = (uint8_t)get_bits(s, 8);
+            if(s->error) break;
+            window[s->win_pos] = b;
+            s->win_pos = (s->win_pos + 1) & WINDOW_MASK;
+            if(s->win_filled < WINDOW_SIZE) s->win_filled++;
+            *out++ = b;
+            len--;
+            s->stored_left--;
+        }
+        else {
+            int32_t sym = huffman_decode(s, &s->lit);
+            if(sym < 0) break;
+            if(sym < 256) {
+                window[s->win_pos] = (uint8_t)sym;
+                s->win_pos = (s->win_pos + 1) & WINDOW_MASK;
+                if(s->win_filled < WINDOW_SIZE) s->win_filled++;
+                *out++ = (uint8_t)sym;
+                len--;
+            }
+            else if(sym == 256) {
+                s->mode = INFLATE_BLOCK_START;
+                s->stream_end = s->last_block;
+            }
+            else {
+                sym -= 257;
+                if(sym >= 29) {
+                    s->error = true;
+                    break;
+                }
+                uint32_t copy_len = len_base[sym] + get_bits(s, len_extra[sym]);
+                int32_t dsym = huffman_decode(s, &s->dist);
+                if(dsym < 0 || dsym >= 30) {
+                    s->error = true;
+                    break;
+                }
+                uint32_t copy_dist = dist_base[dsym] + get_bits(s, dist_extra[dsym]);
+                if(s->error || copy_dist > s->win_filled) {
+                    s->error = true;
+                    break;
+                }
+                s->copy_len = copy_len;
+                s->copy_dist = copy_dist;
+                s->win_filled = LV_MIN(s->win_filled + copy_len, WINDOW_SIZE);
+            }
+        }
+    }
+
+    s->adler = adler_update(s->adler, out_start, (uint32_t)(out - out_start));
+    return !s->error && len == 0;
+}
+
+/**
+ * Inflate the end of the data after the last row and check the Adler-32 checksum
+ * and the CRC of the last IDAT chunk.
+ * @return false if the data is corrupted or there is more data than the rows
+ */
+static bool inflate_end(lv_png_stream_t * s)
+{
+    /*Only the end of the last block can follow*/
+    if(!s->stream_end) {
+        uint8_t b;
+        if(inflate_read(s, &b, 1) || s->error || !s->stream_end) return false;
+    }
+
+    /*The Adler-32 is stored MSB first from the next byte boundary*/
+    get_bits(s, s->bit_cnt & 0x7);
+    uint32_t adler = 0;
+    uint32_t i;
+    for(i = 0; i < 4; i++) adler = (adler << 8) | get_bits(s, 8);
+    if(s->error) return false;
+    if(adler != s->adler) {
+        LV_LOG_WARN("wrong Adler-32 checksum");
+        return false;
+    }
+
+    /*Reading further checks the CRC of the last IDAT chunk. There should be no more data.*/
+    uint8_t b;
+    if(s->bit_cnt > 0 || idat_byte(s, &b) || s->error) return false;
+
+    return true;
+}
+
+static uint8_t paeth(uint8_t a, uint8_t b, uint8_t c)
+{
+    int32_t pa = LV_ABS((int32_t)b - c);
+    int32_t pb = LV_ABS((int32_t)a - c);
+    int32_t pc = LV_ABS((int32_t)a + b - 2 * c);
+    if(pa <= pb && pa <= pc) return a;
+    if(pb <= pc) return b;
+    return c;
+}
+
+/**
+ * Inflate and unfilter the next row
+ * @return false if the data is corrupted
+ */
+static bool decode_row(lv_png_stream_t * s)
+{
+    uint8_t * tmp = s->prev_row;
+    s->prev_row = s->row;
+    s->row = tmp;
+
+    uint8_t filter;
+    if(!inflate_read(s, &filter, 1)) return false;
+    if(!inflate_read(s, s->row, s->row_size)) return false;
+
+    uint8_t * row = s->row;
+    const uint8_t * prev = s->prev_row;
+    uint32_t size = s->row_size;
+    uint32_t bpp = s->bpp;
+    uint32_t i;
+    switch(filter) {
+        case 0:
+            break;
+        case 1:
+            for(i = bpp; i < size; i++) row[i] += row[i - bpp];
+            break;
+        case 2:
+            for(i = 0; i < size; i++) row[i] += prev[i];
+            break;
+        case 3:
+            for(i = 0; i < bpp; i++) row[i] += prev[i] >> 1;
+            for(; i < size; i++) row[i] += (row[i - bpp] + prev[i]) >> 1;
+            break;
+        case 4:
+            for(i = 0; i < bpp; i++) row[i] += prev[i];
+            for(; i < size; i++) row[i] += paeth(row[i - bpp], prev[i], prev[i - bpp]);
+            break;
+        default:
+            s->error = true;
+            return false;
+    }
+
+    s->row_y++;
+
+    /*The checksums can be checked only after the last row*/
+    if((uint32_t)s->row_y == s->h - 1 && !inflate_end(s)) return false;
+
+    return true;
+}
+
+/**
+ * Get the `i`th sample of the row in its original bit depth
+ */
+static inline uint32_t get_sample(const uint8_t * row, uint32_t i, uint32_t depth)
+{
+    if(depth == 8) return row[i];
+    if(depth == 16) return ((uint32_t)row[i * 2] << 8) | row[i * 2 + 1];
+
+    uint32_t bit = i * depth;
+    return (row[bit >> 3] >> (8 - depth - (bit & 0x7))) & ((1 << depth) - 1);
+}
+
+static inline uint8_t sample_to_8bit(uint32_t v, uint32_t depth)
+{
+    switch(depth) {
+        case 1:
+            return v ? 0xFF : 0x00;
+        case 2:
+            return (uint8_t)(v * 0x55);
+        case 4:
+            return (uint8_t)(v * 0x11);
+        case 16:
+            return (uint8_t)(v >> 8);
+        default:
+            return (uint8_t)v;
+    }
+}
+
+static inline void store_px(uint8_t * buf, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+{
+#if LV_COLOR_DEPTH == 32 || LV_COLOR_DEPTH == 24
+    buf[0] = b;
+    buf[1] = g;
+    buf[2] = r;
+    buf[3] = a;
+#elif LV_COLOR_DEPTH == 16
+    uint16_t c16 = lv_color_to_int(lv_color_make(r, g, b));
+    buf[0] = c16 & 0xFF;
+    buf[1] = c16 >> 8;
+    buf[2] = a;
+#elif LV_COLOR_DEPTH == 8
+    buf[0] = lv_color_to_int(lv_color_make(r, g, b));
+    buf[1] = a;
+#endif
+}
+
+/**
+ * Convert the pixels of the current row to the native format
+ */
+static void convert_row(lv_png_stream_t * s, int32_t x, int32_t len, uint8_t * buf)
+{
+    const uint8_t * row = s->row;
+    uint32_t depth = s->depth;
+    uint32_t i;
+    uint32_t end = (uint32_t)(x + len);
+
+    for(i = (uint32_t)x; i < end; i++) {
+        uint8_t r, g, b, a = 0xFF;
+        switch(s->color_type) {
+            case 0: {
+                    uint32_t v = get_sample(row, i, depth);
+                    r = g = b = sample_to_8bit(v, depth);
+                    if(s->has_trns && v == s->trns[0]) a = 0x00;
+                    break;
+                }
+            case 2: {
+                    uint32_t vr = get_sample(row, i * 3, depth);
+                    uint32_t vg = get_sample(row, i * 3 + 1, depth);
+                    uint32_t vb = get_sample(row, i * 3 + 2, depth);
+                    r = sample_to_8bit(vr, depth);
+                    g = sample_to_8bit(vg, depth);
+                    b = sample_to_8bit(vb, depth);
+                    if(s->has_trns && vr == s->trns[0] && vg == s->trns[1] && vb == s->trns[2]) a = 0x00;
+                    break;
+                }
+            case 3: {
+                    const uint8_t * p = s->palette[get_sample(row, i, depth)];
+                    r = p[0];
+                    g = p[1];
+                    b = p[2];
+                    a = p[3];
+                    break;
+                }
+            case 4:
+                r = g = b = sample_to_8bit(get_sample(row, i * 2, depth), depth);
+                a = sample_to_8bit(get_sample(row, i * 2 + 1, depth), depth);
+                break;
+            default:
+                r = sample_to_8bit(get_sample(row, i * 4, depth), depth);
+                g = sample_to_8bit(get_sample(row, i * 4 + 1, depth), depth);
+                b = sample_to_8bit(get_sample(row, i * 4 + 2, depth), depth);
+                a = sample_to_8bit(get_sample(row, i * 4 + 3, depth), depth);
+                break;
+        }
+
+        store_px(buf, r, g, b, a);
+        buf += LV_COLOR_FORMAT_NATIVE_ALPHA_SIZE;
+    }
+}
+
+#endif /*LV_USE_PNG*/
@@ -0,0 +1,76 @@
+/**
+ * @file lv_png_stream.h
+ * Decode PNG images row by row with an incremental inflater.
+ * Only a 32 kB inflate window and two rows are kept in the memory.
+ */
+
+#ifndef LV_PNG_STREAM_H
+#define LV_PNG_STREAM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lv_conf_internal.h"
+#if LV_USE_PNG
+
+#include "../../draw/lv_img_decoder.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct _lv_png_stream_t lv_png_stream_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Open a PNG file or variable for row by row decoding.
+ * @param dsc       the decoder descriptor with the source of the image
+ * @param supported set to false if the PNG can't be streamed (e.g. it's interlaced)
+ *                  and it should be decoded in another way
+ * @return          the stream or NULL if the PNG is invalid or not supported
+ */
+lv_png_stream_t * _lv_png_stream_open(const lv_img_decoder_dsc_t * dsc, bool * supported);
+
+/**
+ * Get pixels of a row in `LV_COLOR_FORMAT_NATIVE_ALPHA` format.
+ * The rows are decoded sequentially, so reading the rows from top to bottom is the fastest.
+ * Reading a previous row restarts the decoding from the first row.
+ * The CRCs of the IDAT chunks are checked as they are read but the Adler-32 checksum
+ * of the image data only when the last row is decoded.
+ * @param stream    pointer to a stream
+ * @param x         start X coordinate
+ * @param y         the row to read
+ * @param len       number of pixels to read
+ * @param buf       store the pixels here (`len * LV_COLOR_FORMAT_NATIVE_ALPHA_SIZE` bytes)
+ * @return          LV_RES_OK: success; LV_RES_INV: the image data is corrupted
+ */
+lv_res_t _lv_png_stream_read_line(lv_png_stream_t * stream, int32_t x, int32_t y, int32_t len, uint8_t * buf);
+
+/**
+ * Close a stream and free its resources
+ * @param stream    pointer to a stream
+ */
+void _lv_png_stream_close(lv_png_stream_t * stream);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_PNG*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_PNG_STREAM_H*/
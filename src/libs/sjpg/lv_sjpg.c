@@ -86,6 +86,16 @@ typedef struct {
 } io_source_t;
 
 
+struct _prefetch_job_t;
+
+/*A decoded fragment*/
+typedef struct {
+    uint8_t * buf;                      //RGB888 pixels, allocated on first use
+    int index;                          //Index of the decoded fragment or -1 if none
+    uint32_t life;                      //When it was used last time. The oldest is reused first.
+    struct _prefetch_job_t * job;       //Not NULL while it's being decoded in a worker thread
+} frag_t;
+
 typedef struct {
     uint8_t * sjpeg_data;
     uint32_t sjpeg_data_size;
@@ -93,15 +103,36 @@ typedef struct {
     int sjpeg_y_res;
     int sjpeg_total_frames;
     int sjpeg_single_frame_height;
-    int sjpeg_cache_frame_index;
+    int last_frame_index;               //The last fragment read by `decoder_read_line` or -1
     uint8_t ** frame_base_array;        //to save base address of each split frames upto sjpeg_total_frames.
     int * frame_base_offset;            //to save base offset for fseek
-    uint8_t * frame_cache;
+    frag_t * frags;                     //Cache of the decoded fragments
+    int frag_cnt;
+    uint32_t frag_life;
     uint8_t * workb;                    //JPG work buffer for jpeg library
     JDEC * tjpeg_jd;
     io_source_t io;
 } SJPEG;
 
+/*Decode a fragment in a worker thread*/
+typedef struct _prefetch_job_t {
+    lv_worker_job_t job;
+    SJPEG * sjpeg;                      //Valid only if `frag` is not NULL
+    frag_t * frag;                      //NULL if the image was closed meanwhile
+    uint8_t * buf;                      //Decode here (`frag->buf`)
+    int index;
+    io_source_t io;                     //Decodes from `raw` if the image is a file
+    lv_fs_file_t file;                  //Own file handle to read `raw`
+    lv_fs_read_req_t read_req;
+    uint8_t * raw;                      //The compressed fragment read from the file
+    bool reading;                       //`raw` is being read, the decoding is not started yet
+    JDEC jd;
+    uint8_t workb[TJPGD_WORKBUFF_SIZE];
+    lv_thread_sync_t done;              //Signaled when decoded
+    uint32_t decode_time;
+    bool ok;
+} prefetch_job_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -109,15 +140,33 @@ static lv_res_t decoder_info(lv_img_decoder_t * decoder, const void * src, lv_im
 static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
 static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
                                   lv_coord_t len, uint8_t * buf);
+static lv_res_t decoder_read_tile(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc, const lv_area_t * area,
+                                  uint8_t * buf);
+static void convert_row(const uint8_t * cache, uint8_t * buf, lv_coord_t len);
 static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
 static size_t input_func(JDEC * jd, uint8_t * buff, size_t ndata);
 static int is_jpg(const uint8_t * raw_data, size_t len);
 static void lv_sjpg_cleanup(SJPEG * sjpeg);
 static void lv_sjpg_free(SJPEG * sjpeg);
+static bool frags_init(SJPEG * sjpeg);
+static frag_t * frag_get(SJPEG * sjpeg, lv_img_decoder_dsc_t * dsc, int index);
+static frag_t * frag_find(SJPEG * sjpeg, int index);
+static frag_t * frag_reuse(SJPEG * sjpeg, const frag_t * keep);
+static void io_set_frag(SJPEG * sjpeg, io_source_t * io, int index, uint8_t * buf);
+static bool frag_decode(JDEC * jd, uint8_t * workb, io_source_t * io);
+#if LV_SJPG_PREFETCH_CNT
+    static void prefetch(SJPEG * sjpeg, lv_img_decoder_dsc_t * dsc, const frag_t * cur, int index, int dir);
+    static frag_t * prefetch_wait(SJPEG * sjpeg, int index);
+    static bool prefetch_read_start(SJPEG * sjpeg, prefetch_job_t * job, const char * src);
+    static void prefetch_read_ready_cb(lv_fs_read_req_t * req);
+    static void prefetch_exec_cb(lv_worker_job_t * job);
+    static void prefetch_ready_cb(lv_worker_job_t * job);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+static lv_split_jpeg_stats_t stats;
 
 /**********************
  *      MACROS
@@ -133,6 +182,18 @@ void lv_split_jpeg_init(void)
     lv_img_decoder_set_open_cb(dec, decoder_open);
     lv_img_decoder_set_close_cb(dec, decoder_close);
     lv_img_decoder_set_read_line_cb(dec, decoder_read_line);
+    lv_img_decoder_set_read_tile_cb(dec, decoder_read_tile);
+    lv_img_decoder_set_thread_safe(dec, true);
+}
+
+void lv_split_jpeg_get_stats(lv_split_jpeg_stats_t * stats_out)
+{
+    *stats_out = stats;
+}
+
+void lv_split_jpeg_reset_stats(void)
+{
+    lv_memzero(&stats, sizeof(stats));
 }
 
 /**********************
@@ -395,15 +456,11 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
                 offset |= *data++ << 8;
                 sjpeg->frame_base_array[i] = sjpeg->frame_base_array[i - 1] + offset;
             }
-            sjpeg->sjpeg_cache_frame_index = -1;
-            sjpeg->frame_cache = (void *)lv_malloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3/*2*/);
-            if(! sjpeg->frame_cache) {
+            if(!frags_init(sjpeg)) {
                 lv_sjpg_cleanup(sjpeg);
                 sjpeg = NULL;
                 return LV_RES_INV;
             }
-            sjpeg->io.img_cache_buff = sjpeg->frame_cache;
-            sjpeg->io.img_cache_x_res = sjpeg->sjpeg_x_res;
             sjpeg->workb =   lv_malloc(TJPGD_WORKBUFF_SIZE);
             if(! sjpeg->workb) {
                 lv_sjpg_cleanup(sjpeg);
@@ -458,16 +515,12 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
                 uint8_t * img_frame_base = sjpeg->sjpeg_data;
                 sjpeg->frame_base_array[0] = img_frame_base;
 
-                sjpeg->sjpeg_cache_frame_index = -1;
-                sjpeg->frame_cache = (void *)lv_malloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3);
-                if(! sjpeg->frame_cache) {
+                if(!frags_init(sjpeg)) {
                     lv_sjpg_cleanup(sjpeg);
                     sjpeg = NULL;
                     return LV_RES_INV;
                 }
 
-                sjpeg->io.img_cache_buff = sjpeg->frame_cache;
-                sjpeg->io.img_cache_x_res = sjpeg->sjpeg_x_res;
                 sjpeg->workb =   lv_malloc(TJPGD_WORKBUFF_SIZE);
                 if(! sjpeg->workb) {
                     lv_sjpg_cleanup(sjpeg);
@@ -577,15 +630,11 @@ end:
                     sjpeg->frame_base_offset[i] = sjpeg->frame_base_offset[i - 1] + offset;
                 }
 
-                sjpeg->sjpeg_cache_frame_index = -1; //INVALID AT BEGINNING for a forced compare mismatch at first time.
-                sjpeg->frame_cache = (void *)lv_malloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3);
-                if(! sjpeg->frame_cache) {
+                if(!frags_init(sjpeg)) {
                     lv_fs_close(&lv_file);
                     lv_sjpg_cleanup(sjpeg);
                     return LV_RES_INV;
                 }
-                sjpeg->io.img_cache_buff = sjpeg->frame_cache;
-                sjpeg->io.img_cache_x_res = sjpeg->sjpeg_x_res;
                 sjpeg->workb =   lv_malloc(TJPGD_WORKBUFF_SIZE);
                 if(! sjpeg->workb) {
                     lv_fs_close(&lv_file);
@@ -665,16 +714,12 @@ end:
                 int img_frame_start_offset = 0;
                 sjpeg->frame_base_offset[0] = img_frame_start_offset;
 
-                sjpeg->sjpeg_cache_frame_index = -1;
-                sjpeg->frame_cache = (void *)lv_malloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3);
-                if(! sjpeg->frame_cache) {
+                if(!frags_init(sjpeg)) {
                     lv_fs_close(&lv_file);
                     lv_sjpg_cleanup(sjpeg);
                     return LV_RES_INV;
                 }
 
-                sjpeg->io.img_cache_buff = sjpeg->frame_cache;
-                sjpeg->io.img_cache_x_res = sjpeg->sjpeg_x_res;
                 sjpeg->workb =   lv_malloc(TJPGD_WORKBUFF_SIZE);
                 if(! sjpeg->workb) {
                     lv_fs_close(&lv_file);
@@ -722,151 +767,98 @@ static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc
                                   lv_coord_t len, uint8_t * buf)
 {
     LV_UNUSED(decoder);
-    if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
-        SJPEG * sjpeg = (SJPEG *) dsc->user_data;
-        JRESULT rc;
+    SJPEG * sjpeg = (SJPEG *) dsc->user_data;
+    if(sjpeg == NULL) return LV_RES_INV;
 
-        int sjpeg_req_frame_index = y / sjpeg->sjpeg_single_frame_height;
+    int sjpeg_req_frame_index = y / sjpeg->sjpeg_single_frame_height;
+    frag_t * frag = frag_get(sjpeg, dsc, sjpeg_req_frame_index);
+    if(frag == NULL) return LV_RES_INV;
 
-        /*If line not from cache, refresh cache */
-        if(sjpeg_req_frame_index != sjpeg->sjpeg_cache_frame_index) {
-            sjpeg->io.raw_sjpg_data = sjpeg->frame_base_array[ sjpeg_req_frame_index ];
-            if(sjpeg_req_frame_index == (sjpeg->sjpeg_total_frames - 1)) {
-                /*This is the last frame. */
-                const uint32_t frame_offset = (uint32_t)(sjpeg->io.raw_sjpg_data - sjpeg->sjpeg_data);
-                sjpeg->io.raw_sjpg_data_size = sjpeg->sjpeg_data_size - frame_offset;
-            }
-            else {
-                sjpeg->io.raw_sjpg_data_size =
-                    (uint32_t)(sjpeg->frame_base_array[sjpeg_req_frame_index + 1] - sjpeg->io.raw_sjpg_data);
-            }
-            sjpeg->io.raw_sjpg_data_next_read_pos = 0;
-            rc = jd_prepare(sjpeg->tjpeg_jd, input_func, sjpeg->workb, (size_t)TJPGD_WORKBUFF_SIZE, &(sjpeg->io));
-            if(rc != JDR_OK) return LV_RES_INV;
-            rc = jd_decomp(sjpeg->tjpeg_jd, img_data_cb, 0);
-            if(rc != JDR_OK) return LV_RES_INV;
-            sjpeg->sjpeg_cache_frame_index = sjpeg_req_frame_index;
-        }
+    const uint8_t * cache = frag->buf + x * 3 + (y % sjpeg->sjpeg_single_frame_height) * sjpeg->sjpeg_x_res * 3;
+    convert_row(cache, buf, len);
 
-        int offset = 0;
-        uint8_t * cache = (uint8_t *)sjpeg->frame_cache + x * 3 + (y % sjpeg->sjpeg_single_frame_height) * sjpeg->sjpeg_x_res *
-                          3;
+    return LV_RES_OK;
+}
 
-#if  LV_COLOR_DEPTH == 32
-        for(int i = 0; i < len; i++) {
-            buf[offset + 3] = 0xff;
-            buf[offset + 2] = *cache++;
-            buf[offset + 1] = *cache++;
-            buf[offset + 0] = *cache++;
-            offset += 4;
-        }
-#elif  LV_COLOR_DEPTH == 24
-        for(int i = 0; i < len; i++) {
-            buf[offset + 2] = *cache++;
-            buf[offset + 1] = *cache++;
-            buf[offset + 0] = *cache++;
-            offset += 3;
-        }
-#elif  LV_COLOR_DEPTH == 16
-        for(int i = 0; i < len; i++) {
-            uint16_t col_16bit = (*cache++ & 0xf8) << 8;
-            col_16bit |= (*cache++ & 0xFC) << 3;
-            col_16bit |= (*cache++ >> 3);
-#if  LV_BIG_ENDIAN_SYSTEM == 1
-            buf[offset++] = col_16bit >> 8;
-            buf[offset++] = col_16bit & 0xff;
-#else
-            buf[offset++] = col_16bit & 0xff;
-            buf[offset++] = col_16bit >> 8;
-#endif // LV_BIG_ENDIAN_SYSTEM
-        }
-#elif  LV_COLOR_DEPTH == 8
-        for(int i = 0; i < len; i++) {
-            uint8_t col_8bit = (*cache++ & 0xC0);
-            col_8bit |= (*cache++ & 0xe0) >> 2;
-            col_8bit |= (*cache++ & 0xe0) >> 5;
-            buf[offset++] = col_8bit;
+/**
+ * Read an area of the image. The rows in the same fragment are copied from the fragment without looking it up again.
+ * @param decoder pointer to the decoder where this function belongs
+ * @param dsc pointer to a descriptor which describes this decoding session
+ * @param area the area to read
+ * @param buf store the pixels here
+ * @return LV_RES_OK: the area is read; LV_RES_INV: a fragment couldn't be decoded
+ */
+static lv_res_t decoder_read_tile(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc, const lv_area_t * area,
+                                  uint8_t * buf)
+{
+    LV_UNUSED(decoder);
+    SJPEG * sjpeg = (SJPEG *) dsc->user_data;
+    if(sjpeg == NULL) return LV_RES_INV;
+
+    lv_coord_t len = lv_area_get_width(area);
+    uint32_t buf_stride = len * lv_color_format_get_size(dsc->header.cf);
+    frag_t * frag = NULL;
+    int frag_index = -1;
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        if(y / sjpeg->sjpeg_single_frame_height != frag_index) {
+            frag_index = y / sjpeg->sjpeg_single_frame_height;
+            frag = frag_get(sjpeg, dsc, frag_index);
+            if(frag == NULL) return LV_RES_INV;
         }
-#else
-#error Unsupported LV_COLOR_DEPTH
-#endif // LV_COLOR_DEPTH
-        return LV_RES_OK;
-    }
-    else if(dsc->src_type == LV_IMG_SRC_FILE) {
-        SJPEG * sjpeg = (SJPEG *) dsc->user_data;
-        JRESULT rc;
-        int sjpeg_req_frame_index = y / sjpeg->sjpeg_single_frame_height;
-
-        lv_fs_file_t * lv_file_p = &(sjpeg->io.lv_file);
-        if(!lv_file_p) goto end;
 
-        /*If line not from cache, refresh cache */
-        if(sjpeg_req_frame_index != sjpeg->sjpeg_cache_frame_index) {
-            sjpeg->io.raw_sjpg_data_next_read_pos = (int)(sjpeg->frame_base_offset [ sjpeg_req_frame_index ]);
-            lv_fs_seek(&(sjpeg->io.lv_file), sjpeg->io.raw_sjpg_data_next_read_pos, LV_FS_SEEK_SET);
-
-            rc = jd_prepare(sjpeg->tjpeg_jd, input_func, sjpeg->workb, (size_t)TJPGD_WORKBUFF_SIZE, &(sjpeg->io));
-            if(rc != JDR_OK) return LV_RES_INV;
-
-            rc = jd_decomp(sjpeg->tjpeg_jd, img_data_cb, 0);
-            if(rc != JDR_OK) return LV_RES_INV;
+        const uint8_t * cache = frag->buf + area->x1 * 3 + (y % sjpeg->sjpeg_single_frame_height) * sjpeg->sjpeg_x_res * 3;
+        convert_row(cache, buf, len);
+        buf += buf_stride;
+    }
 
-            sjpeg->sjpeg_cache_frame_index = sjpeg_req_frame_index;
-        }
+    return LV_RES_OK;
+}
 
-        int offset = 0;
-        uint8_t * cache = (uint8_t *)sjpeg->frame_cache + x * 3 + (y % sjpeg->sjpeg_single_frame_height) * sjpeg->sjpeg_x_res *
-                          3;
-
-#if LV_COLOR_DEPTH == 32
-        for(int i = 0; i < len; i++) {
-            buf[offset + 3] = 0xff;
-            buf[offset + 2] = *cache++;
-            buf[offset + 1] = *cache++;
-            buf[offset + 0] = *cache++;
-            offset += 4;
-        }
-#elif LV_COLOR_DEPTH == 24
-        for(int i = 0; i < len; i++) {
-            buf[offset + 2] = *cache++;
-            buf[offset + 1] = *cache++;
-            buf[offset + 0] = *cache++;
-            offset += 3;
-        }
+/**
+ * Convert RGB888 pixels of a fragment to the native color format
+ */
+static void convert_row(const uint8_t * cache, uint8_t * buf, lv_coord_t len)
+{
+    int offset = 0;
+#if  LV_COLOR_DEPTH == 32
+    for(int i = 0; i < len; i++) {
+        buf[offset + 3] = 0xff;
+        buf[offset + 2] = *cache++;
+        buf[offset + 1] = *cache++;
+        buf[offset + 0] = *cache++;
+        offset += 4;
+    }
+#elif  LV_COLOR_DEPTH == 24
+    for(int i = 0; i < len; i++) {
+        buf[offset + 2] = *cache++;
+        buf[offset + 1] = *cache++;
+        buf[offset + 0] = *cache++;
+        offset += 3;
+    }
 #elif  LV_COLOR_DEPTH == 16
-
-        for(int i = 0; i < len; i++) {
-            uint16_t col_8bit = (*cache++ & 0xf8) << 8;
-            col_8bit |= (*cache++ & 0xFC) << 3;
-            col_8bit |= (*cache++ >> 3);
+    for(int i = 0; i < len; i++) {
+        uint16_t col_16bit = (*cache++ & 0xf8) << 8;
+        col_16bit |= (*cache++ & 0xFC) << 3;
+        col_16bit |= (*cache++ >> 3);
 #if  LV_BIG_ENDIAN_SYSTEM == 1
-            buf[offset++] = col_8bit >> 8;
-            buf[offset++] = col_8bit & 0xff;
+        buf[offset++] = col_16bit >> 8;
+        buf[offset++] = col_16bit & 0xff;
 #else
-            buf[offset++] = col_8bit & 0xff;
-            buf[offset++] = col_8bit >> 8;
+        buf[offset++] = col_16bit & 0xff;
+        buf[offset++] = col_16bit >> 8;
 #endif // LV_BIG_ENDIAN_SYSTEM
-        }
-
+    }
 #elif  LV_COLOR_DEPTH == 8
-
-        for(int i = 0; i < len; i++) {
-            uint8_t col_8bit = (*cache++ & 0xC0);
-            col_8bit |= (*cache++ & 0xe0) >> 2;
-            col_8bit |= (*cache++ & 0xe0) >> 5;
-            buf[offset++] = col_8bit;
-        }
-
+    for(int i = 0; i < len; i++) {
+        uint8_t col_8bit = (*cache++ & 0xC0);
+        col_8bit |= (*cache++ & 0xe0) >> 2;
+        col_8bit |= (*cache++ & 0xe0) >> 5;
+        buf[offset++] = col_8bit;
+    }
 #else
 #error Unsupported LV_COLOR_DEPTH
-
-
 #endif // LV_COLOR_DEPTH
-
-        return LV_RES_OK;
-    }
-end:
-    return LV_RES_INV;
 }
 
 /**
@@ -907,7 +899,19 @@ static int is_jpg(const uint8_t * raw_data, size_t len)
 
 static void lv_sjpg_free(SJPEG * sjpeg)
 {
-    if(sjpeg->frame_cache) lv_free(sjpeg->frame_cache);
+    if(sjpeg->frags) {
+        for(int i = 0; i < sjpeg->frag_cnt; i++) {
+            frag_t * frag = &sjpeg->frags[i];
+            if(frag->job) {
+                /*The worker can't be stopped, so let `prefetch_ready_cb` free the buffer*/
+                frag->job->frag = NULL;
+            }
+            else if(frag->buf) {
+                lv_free(frag->buf);
+            }
+        }
+        lv_free(sjpeg->frags);
+    }
     if(sjpeg->frame_base_array) lv_free(sjpeg->frame_base_array);
     if(sjpeg->frame_base_offset) lv_free(sjpeg->frame_base_offset);
     if(sjpeg->tjpeg_jd) lv_free(sjpeg->tjpeg_jd);
@@ -922,4 +926,337 @@ static void lv_sjpg_cleanup(SJPEG * sjpeg)
     lv_free(sjpeg);
 }
 
+/**
+ * Allocate the fragment cache. Only the first fragment's buffer is allocated now,
+ * the others when more fragments need to be cached.
+ */
+static bool frags_init(SJPEG * sjpeg)
+{
+    sjpeg->frag_cnt = LV_MIN(LV_SJPG_FRAG_CACHE_CNT, sjpeg->sjpeg_total_frames);
+    if(sjpeg->frag_cnt < 1) sjpeg->frag_cnt = 1;
+
+    sjpeg->frags = lv_malloc(sizeof(frag_t) * sjpeg->frag_cnt);
+    if(! sjpeg->frags) return false;
+    lv_memzero(sjpeg->frags, sizeof(frag_t) * sjpeg->frag_cnt);
+    for(int i = 0; i < sjpeg->frag_cnt; i++) {
+        sjpeg->frags[i].index = -1;
+    }
+
+    sjpeg->frags[0].buf = lv_malloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3);
+    if(! sjpeg->frags[0].buf) return false;
+
+    sjpeg->last_frame_index = -1;
+    sjpeg->io.img_cache_x_res = sjpeg->sjpeg_x_res;
+    return true;
+}
+
+/**
+ * Get a decoded fragment from the cache or decode it now
+ * @return the fragment or NULL on error
+ */
+static frag_t * frag_get(SJPEG * sjpeg, lv_img_decoder_dsc_t * dsc, int index)
+{
+    bool changed = index != sjpeg->last_frame_index;
+    frag_t * frag = frag_find(sjpeg, index);
+
+#if LV_SJPG_PREFETCH_CNT
+    if(frag == NULL) {
+        uint32_t t_start = lv_tick_get();
+        frag = prefetch_wait(sjpeg, index);
+        stats.decode_time += lv_tick_elaps(t_start);
+    }
+#endif
+
+    if(frag) {
+        if(changed) stats.frag_hit_cnt++;
+    }
+    else {
+        frag = frag_reuse(sjpeg, NULL);
+        if(frag == NULL) return NULL;
+
+        uint32_t t_start = lv_tick_get();
+        frag->index = -1;
+        io_set_frag(sjpeg, &sjpeg->io, index, frag->buf);
+        bool ok = frag_decode(sjpeg->tjpeg_jd, sjpeg->workb, &sjpeg->io);
+        stats.frag_miss_cnt++;
+        stats.decode_time += lv_tick_elaps(t_start);
+        if(!ok) return NULL;
+
+        frag->index = index;
+    }
+
+    frag->life = ++sjpeg->frag_life;
+
+    if(changed) {
+#if LV_SJPG_PREFETCH_CNT
+        /*Guess the direction of scrolling from the previous fragment*/
+        int dir = index < sjpeg->last_frame_index ? -1 : 1;
+        prefetch(sjpeg, dsc, frag, index, dir);
+#else
+        LV_UNUSED(dsc);
+#endif
+        sjpeg->last_frame_index = index;
+    }
+
+    return frag;
+}
+
+static frag_t * frag_find(SJPEG * sjpeg, int index)
+{
+    for(int i = 0; i < sjpeg->frag_cnt; i++) {
+        frag_t * frag = &sjpeg->frags[i];
+        if(frag->job == NULL && frag->index == index) return frag;
+    }
+
+    return NULL;
+}
+
+/**
+ * Get a fragment to decode into. Use an empty one, allocate a new one or reuse the least recently used one.
+ * @param keep      don't return this fragment
+ * @return          the fragment or NULL if all are being decoded
+ */
+static frag_t * frag_reuse(SJPEG * sjpeg, const frag_t * keep)
+{
+    frag_t * lru = NULL;
+    frag_t * unallocated = NULL;
+    for(int i = 0; i < sjpeg->frag_cnt; i++) {
+        frag_t * frag = &sjpeg->frags[i];
+        if(frag->job || frag == keep) continue;
+
+        if(frag->buf == NULL) {
+            if(unallocated == NULL) unallocated = frag;
+        }
+        else if(frag->index == -1) {
+            return frag;
+        }
+        else if(lru == NULL || frag->life < lru->life) {
+            lru = frag;
+        }
+    }
+
+    if(unallocated) {
+        /*Not asserted because the already allocated fragments can be reused too*/
+        unallocated->buf = lv_malloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3);
+        if(unallocated->buf) return unallocated;
+    }
+
+    return lru;
+}
+
+/**
+ * Prepare an IO source to decode a given fragment
+ */
+static void io_set_frag(SJPEG * sjpeg, io_source_t * io, int index, uint8_t * buf)
+{
+    io->img_cache_buff = buf;
+    io->img_cache_x_res = sjpeg->sjpeg_x_res;
+
+    if(io->type == SJPEG_IO_SOURCE_C_ARRAY) {
+        io->raw_sjpg_data = sjpeg->frame_base_array[index];
+        if(index == (sjpeg->sjpeg_total_frames - 1)) {
+            /*This is the last frame. */
+            const uint32_t frame_offset = (uint32_t)(io->raw_sjpg_data - sjpeg->sjpeg_data);
+            io->raw_sjpg_data_size = sjpeg->sjpeg_data_size - frame_offset;
+        }
+        else {
+            io->raw_sjpg_data_size = (uint32_t)(sjpeg->frame_base_array[index + 1] - io->raw_sjpg_data);
+        }
+        io->raw_sjpg_data_next_read_pos = 0;
+    }
+    else {
+        io->raw_sjpg_data_next_read_pos = (int)(sjpeg->frame_base_offset[index]);
+        lv_fs_seek(&io->lv_file, io->raw_sjpg_data_next_read_pos, LV_FS_SEEK_SET);
+    }
+}
+
+static bool frag_decode(JDEC * jd, uint8_t * workb, io_source_t * io)
+{
+    JRESULT rc = jd_prepare(jd, input_func, workb, (size_t)TJPGD_WORKBUFF_SIZE, io);
+    if(rc != JDR_OK) return false;
+
+    rc = jd_decomp(jd, img_data_cb, 0);
+    return rc == JDR_OK;
+}
+
+#if LV_SJPG_PREFETCH_CNT
+
+/**
+ * Start decoding the next fragments in the direction of scrolling in worker threads
+ * @param cur       the fragment being read, don't reuse it
+ * @param index     index of `cur`
+ * @param dir       1: prefetch the fragments below, -1: above
+ */
+static void prefetch(SJPEG * sjpeg, lv_img_decoder_dsc_t * dsc, const frag_t * cur, int index, int dir)
+{
+    if(sjpeg->frag_cnt < 2 || !lv_worker_is_async()) return;
+
+    for(int i = 1; i <= LV_SJPG_PREFETCH_CNT; i++) {
+        int next = index + i * dir;
+        if(next < 0 || next >= sjpeg->sjpeg_total_frames) break;
+
+        /*Skip it if it's already decoded or being decoded*/
+        bool known = false;
+        for(int j = 0; j < sjpeg->frag_cnt; j++) {
+            frag_t * f = &sjpeg->frags[j];
+            if(f->job ? f->job->index == next : f->index == next) known = true;
+        }
+        if(known) continue;
+
+        frag_t * frag = frag_reuse(sjpeg, cur);
+        if(frag == NULL) break;
+
+        prefetch_job_t * job = lv_malloc(sizeof(prefetch_job_t));
+        LV_ASSERT_MALLOC(job);
+        if(job == NULL) break;
+        lv_memzero(job, sizeof(prefetch_job_t));
+
+        if(lv_thread_sync_init(&job->done) != LV_RES_OK) {
+            lv_free(job);
+            break;
+        }
+
+        job->sjpeg = sjpeg;
+        job->frag = frag;
+        job->buf = frag->buf;
+        job->index = next;
+        job->job.exec_cb = prefetch_exec_cb;
+        job->job.ready_cb = prefetch_ready_cb;
+
+        if(sjpeg->io.type == SJPEG_IO_SOURCE_DISK) {
+            /*Read the compressed fragment first, the decoding is started when it's read*/
+            if(!prefetch_read_start(sjpeg, job, dsc->src)) {
+                lv_thread_sync_delete(&job->done);
+                lv_free(job);
+                break;
+            }
+        }
+        else {
+            job->io.type = SJPEG_IO_SOURCE_C_ARRAY;
+            io_set_frag(sjpeg, &job->io, next, frag->buf);
+            lv_worker_add(&job->job);
+        }
+
+        frag->index = -1;
+        frag->job = job;
+        frag->life = ++sjpeg->frag_life;
+    }
+}
+
+/**
+ * Read the compressed data of a fragment from the file in a worker thread.
+ * The file of the image is used by `decoder_read_line` so it's opened again.
+ * @return      true: `prefetch_read_ready_cb` will be called
+ */
+static bool prefetch_read_start(SJPEG * sjpeg, prefetch_job_t * job, const char * src)
+{
+    if(lv_fs_open(&job->file, src, LV_FS_MODE_RD) != LV_FS_RES_OK) return false;
+
+    uint32_t start = (uint32_t)sjpeg->frame_base_offset[job->index];
+    uint32_t end = 0;
+    if(job->index + 1 < sjpeg->sjpeg_total_frames) {
+        end = (uint32_t)sjpeg->frame_base_offset[job->index + 1];
+    }
+    else if(lv_fs_seek(&job->file, 0, LV_FS_SEEK_END) == LV_FS_RES_OK) {
+        lv_fs_tell(&job->file, &end);
+    }
+
+    if(end > start) job->raw = lv_malloc(end - start);
+    if(job->raw == NULL ||
+       lv_fs_read_async(&job->file, &job->read_req, start, job->raw, end - start,
+                        prefetch_read_ready_cb, job) != LV_FS_RES_OK) {
+        lv_free(job->raw);
+        lv_fs_close(&job->file);
+        return false;
+    }
+
+    job->io.type = SJPEG_IO_SOURCE_C_ARRAY;
+    job->io.raw_sjpg_data = job->raw;
+    job->io.raw_sjpg_data_next_read_pos = 0;
+    job->io.img_cache_buff = job->buf;
+    job->io.img_cache_x_res = sjpeg->sjpeg_x_res;
+    job->reading = true;
+    return true;
+}
+
+/**
+ * Start decoding the fragment when its data was read. Called from `lv_timer_handler()`
+ */
+static void prefetch_read_ready_cb(lv_fs_read_req_t * req)
+{
+    prefetch_job_t * job = req->user_data;
+    lv_fs_close(&job->file);
+    job->reading = false;
+
+    /*Let the decoding fail quickly if the read failed or the image was closed meanwhile*/
+    job->io.raw_sjpg_data_size = req->res == LV_FS_RES_OK && job->frag ? req->br : 0;
+    lv_worker_add(&job->job);
+}
+
+/**
+ * Decode a fragment in a worker thread
+ */
+static void prefetch_exec_cb(lv_worker_job_t * job)
+{
+    prefetch_job_t * p = (prefetch_job_t *)job;
+    uint32_t t_start = lv_tick_get();
+    p->ok = frag_decode(&p->jd, p->workb, &p->io);
+    p->decode_time = lv_tick_elaps(t_start);
+    lv_thread_sync_signal(&p->done);
+}
+
+/**
+ * If a fragment is being prefetched wait for it instead of decoding it again
+ * @return the decoded fragment or NULL if it's not being prefetched or it failed
+ */
+static frag_t * prefetch_wait(SJPEG * sjpeg, int index)
+{
+    for(int i = 0; i < sjpeg->frag_cnt; i++) {
+        frag_t * frag = &sjpeg->frags[i];
+        prefetch_job_t * job = frag->job;
+        if(job == NULL || job->index != index) continue;
+
+        /*Finish the read now and start decoding*/
+        if(job->reading) lv_worker_finish(&job->read_req.job);
+        lv_thread_sync_wait(&job->done);
+
+        /*Take the result now, `prefetch_ready_cb` will only free the job*/
+        frag->job = NULL;
+        frag->index = job->ok ? index : -1;
+        job->frag = NULL;
+        job->buf = NULL;
+        return job->ok ? frag : NULL;
+    }
+
+    return NULL;
+}
+
+/**
+ * Make the prefetched fragment available. Called from `lv_timer_handler()`
+ */
+static void prefetch_ready_cb(lv_worker_job_t * job)
+{
+    prefetch_job_t * p = (prefetch_job_t *)job;
+    lv_free(p->raw);
+    lv_thread_sync_delete(&p->done);
+
+    stats.prefetch_cnt++;
+    stats.prefetch_time += p->decode_time;
+
+    frag_t * frag = p->frag;
+    if(frag == NULL) {
+        /*The image was closed meanwhile or `prefetch_wait` has already taken the result*/
+        lv_free(p->buf);
+    }
+    else {
+        frag->job = NULL;
+        /*Drop it if it was needed earlier and decoded in the LVGL thread too*/
+        if(p->ok && frag_find(p->sjpeg, p->index) == NULL) frag->index = p->index;
+    }
+
+    lv_free(p);
+}
+
+#endif /*LV_SJPG_PREFETCH_CNT*/
+
 #endif /*LV_USE_SJPG*/
@@ -24,12 +24,34 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/**
+ * Statistics of the fragment cache of all JPG and SJPG images
+ */
+typedef struct {
+    uint32_t frag_hit_cnt;      /**< Number of times a fragment was drawn which was decoded in advance*/
+    uint32_t frag_miss_cnt;     /**< Number of fragments decoded in the LVGL thread*/
+    uint32_t decode_time;       /**< Time spent in the LVGL thread with decoding or waiting for prefetched fragments [ms]*/
+    uint32_t prefetch_cnt;      /**< Number of fragments decoded ahead in worker threads*/
+    uint32_t prefetch_time;     /**< Time spent with decoding in worker threads [ms]*/
+} lv_split_jpeg_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
 void lv_split_jpeg_init(void);
 
+/**
+ * Get the statistics of the fragment cache.
+ * @param stats     the statistics will be copied here
+ */
+void lv_split_jpeg_get_stats(lv_split_jpeg_stats_t * stats);
+
+/**
+ * Clear the statistics of the fragment cache.
+ */
+void lv_split_jpeg_reset_stats(void);
+
 /**********************
  *      MACROS
  **********************/
@@ -5,8 +5,8 @@
 #ifndef LV_TINY_TTF_DEFAULT_CACHE_SIZE
     #define LV_TINY_TTF_DEFAULT_CACHE_SIZE 4096
 #endif
-#ifndef LV_TINY_TTF_CACHE_BUCKETS
-    #define LV_TINY_TTF_CACHE_BUCKETS 16
+#ifndef LV_TINY_TTF_CACHE_PAGES
+    #define LV_TINY_TTF_CACHE_PAGES 4
 #endif
 
 #define STB_RECT_PACK_IMPLEMENTATION
@@ -23,197 +23,206 @@
 #define TTF_CACHE_FREE(x)    (lv_free(x))
 #define TTF_MALLOC(x)  (lv_malloc(x))
 #define TTF_FREE(x)    (lv_free(x))
-typedef void * ttf_cache_handle_t;
+
+/* The glyph bitmaps are stored one after the other in a few large pages.
+ * If there is no free space the least recently used page is cleared, so
+ * there is no allocation per glyph and the eviction doesn't scan the glyphs.
+ * A hash table maps the letters to the bitmaps. The entries of a cleared page
+ * are recognized by the generation counter of the page. Glyphs larger than a
+ * page are not cached but rendered to a separate buffer every time. */
+typedef struct ttf_cache_page {
+    uint8_t * buf;
+    uint32_t size;
+    uint32_t used;
+    uint32_t gen;       // incremented when the page is cleared
+    uint32_t last_use;
+} ttf_cache_page_t;
+
 typedef struct ttf_cache_entry {
-    int key;
-    unsigned long long age;
-    int size;
-    void * data;
+    uint32_t letter;
+    uint32_t gen;       // generation of the page when the glyph was added, 0: empty slot
+    uint32_t ofs;       // offset of the bitmap in the page
+    uint32_t page;
 } ttf_cache_entry_t;
-typedef struct ttf_cache_bucket {
-    int capacity;
-    ttf_cache_entry_t * entries;
-} ttf_cache_bucket_t;
 
 typedef struct ttf_cache {
-    int max_size;
-    int bucket_size;
-    int total_size;
-    unsigned long long age;
-    ttf_cache_bucket_t * buckets;
+    ttf_cache_page_t pages[LV_TINY_TTF_CACHE_PAGES];
+    uint32_t page_size;
+    uint32_t use_cnt;
+    ttf_cache_entry_t * entries;    // open addressing hash table
+    uint32_t entry_cap;             // power of 2
+    uint32_t entry_cnt;             // used slots, including the ones of cleared pages
+    uint8_t * oversized_buf;        // the last glyph larger than a page, valid until the next one
+    uint32_t oversized_size;
 } ttf_cache_t;
 
-static unsigned long long ttf_cache_get_oldest_age(ttf_cache_handle_t * handle)
+static inline uint32_t ttf_cache_hash(uint32_t letter)
 {
-    ttf_cache_t * cache = (ttf_cache_t *)handle;
-    unsigned long long result = (unsigned long long) - 1;
-    for(int i = 0; i < cache->bucket_size; ++i) {
-        ttf_cache_bucket_t * bucket = &cache->buckets[i];
-        if(bucket->entries != NULL) {
-            for(int j = 0; j < bucket->capacity; ++j) {
-                ttf_cache_entry_t * entry = &bucket->entries[j];
-                if(entry->age != 0 && entry->age < result) {
-                    result = entry->age;
-                }
-            }
-        }
-    }
-    if(result == (unsigned long long) - 1) {
-        return 0;
-    }
-    return result;
+    return letter * 2654435761u;
 }
-static ttf_cache_handle_t ttf_cache_create(int max_size, int buckets)
+
+static ttf_cache_t * ttf_cache_create(size_t max_size)
 {
-    ttf_cache_t * result = (ttf_cache_t *)TTF_CACHE_MALLOC(sizeof(ttf_cache_t));
-    if(result == NULL) {
+    ttf_cache_t * cache = (ttf_cache_t *)TTF_CACHE_MALLOC(sizeof(ttf_cache_t));
+    if(cache == NULL) {
         return NULL;
     }
-    result->age = 1;
-    result->max_size = max_size;
-    result->total_size = 0;
-    result->bucket_size = buckets;
-    result->buckets = (ttf_cache_bucket_t *)TTF_CACHE_MALLOC(buckets * sizeof(ttf_cache_bucket_t));
-    if(result->buckets == NULL) {
-        TTF_CACHE_FREE(result);
-        return NULL;
+    lv_memzero(cache, sizeof(ttf_cache_t));
+    cache->page_size = LV_MAX(max_size / LV_TINY_TTF_CACHE_PAGES, 256);
+    for(int i = 0; i < LV_TINY_TTF_CACHE_PAGES; ++i) {
+        cache->pages[i].gen = 1;
     }
-    for(int i = 0; i < buckets; ++i) {
-        result->buckets[i].capacity = 0;
-        result->buckets[i].entries = NULL;
-    }
-    return result;
+    return cache;
 }
-static void * ttf_cache_get(ttf_cache_handle_t handle, int key)
+
+static uint8_t * ttf_cache_get(ttf_cache_t * cache, uint32_t letter)
 {
-    if(handle == NULL) {
+    if(cache->entries == NULL) {
         return NULL;
     }
-    ttf_cache_t * cache = (ttf_cache_t *)handle;
-    int ci = key % cache->bucket_size;
-    ttf_cache_bucket_t * bucket = &cache->buckets[ci];
-    for(int i = 0; i < bucket->capacity; ++i) {
-        ttf_cache_entry_t * entry = &bucket->entries[i];
-        if(entry->age != 0 && entry->key == key) {
-            entry->age = ++cache->age;
-            return entry->data;
+    uint32_t mask = cache->entry_cap - 1;
+    uint32_t i = ttf_cache_hash(letter) & mask;
+    while(cache->entries[i].gen != 0) {
+        ttf_cache_entry_t * entry = &cache->entries[i];
+        if(entry->letter == letter) {
+            ttf_cache_page_t * page = &cache->pages[entry->page];
+            // a newer entry of the same letter can follow a stale one
+            if(entry->gen == page->gen) {
+                page->last_use = ++cache->use_cnt;
+                return page->buf + entry->ofs;
+            }
         }
+        i = (i + 1) & mask;
     }
     return NULL;
 }
-static void * ttf_cache_add(ttf_cache_handle_t handle, int key, int size)
+
+static bool ttf_cache_rehash(ttf_cache_t * cache)
 {
-    if(handle == NULL) {
-        return NULL;
-    }
-    ttf_cache_t * cache = (ttf_cache_t *)handle;
-    int ci = key % cache->bucket_size;
-    ttf_cache_bucket_t * bucket = &cache->buckets[ci];
-    for(int i = 0; i < bucket->capacity; ++i) {
-        ttf_cache_entry_t * entry = &bucket->entries[i];
-        if(entry->age != 0 && entry->key == key) {
-            TTF_CACHE_FREE(entry->data);
-            cache->total_size -= entry->size;
-            entry->age = 0;
-            break;
+    // keep only the entries of the not cleared pages
+    uint32_t live_cnt = 0;
+    for(uint32_t i = 0; i < cache->entry_cap; ++i) {
+        ttf_cache_entry_t * entry = &cache->entries[i];
+        if(entry->gen != 0 && entry->gen == cache->pages[entry->page].gen) {
+            live_cnt++;
         }
     }
-    while(cache->total_size > 0 && (cache->max_size < cache->total_size + size)) {
-        // expire entries
-        unsigned long long oldest = ttf_cache_get_oldest_age(handle);
-        if(oldest == 0) {
-            break;
+    uint32_t new_cap = 64;
+    while(new_cap < live_cnt * 4) {
+        new_cap *= 2;
+    }
+    ttf_cache_entry_t * new_entries = (ttf_cache_entry_t *)TTF_CACHE_MALLOC(new_cap * sizeof(ttf_cache_entry_t));
+    if(new_entries == NULL) {
+        return false;
+    }
+    lv_memzero(new_entries, new_cap * sizeof(ttf_cache_entry_t));
+    for(uint32_t i = 0; i < cache->entry_cap; ++i) {
+        ttf_cache_entry_t * entry = &cache->entries[i];
+        if(entry->gen != 0 && entry->gen == cache->pages[entry->page].gen) {
+            uint32_t j = ttf_cache_hash(entry->letter) & (new_cap - 1);
+            while(new_entries[j].gen != 0) {
+                j = (j + 1) & (new_cap - 1);
+            }
+            new_entries[j] = *entry;
         }
-        for(int i = 0; i < cache->bucket_size; ++i) {
-            ttf_cache_bucket_t * bucket2 = &cache->buckets[i];
-            for(int j = 0; j < bucket2->capacity; ++j) {
-                ttf_cache_entry_t * entry = &bucket2->entries[j];
-                if(entry->age == oldest) {
-                    if(entry->data != NULL) {
-                        TTF_CACHE_FREE(entry->data);
-                        entry->data = NULL;
-                        entry->age = 0;
-                        cache->total_size -= entry->size;
-                        entry->size = 0;
-                        i = cache->bucket_size;
-                        break;
-                    }
-                }
+    }
+    TTF_CACHE_FREE(cache->entries);
+    cache->entries = new_entries;
+    cache->entry_cap = new_cap;
+    cache->entry_cnt = live_cnt;
+    return true;
+}
+
+static uint8_t * ttf_cache_add(ttf_cache_t * cache, uint32_t letter, uint32_t size)
+{
+    // growing a page would exceed the size of the cache
+    if(size > cache->page_size) {
+        if(cache->oversized_size < size) {
+            uint8_t * buf = (uint8_t *)TTF_CACHE_REALLOC(cache->oversized_buf, size);
+            if(buf == NULL) {
+                return NULL;
             }
+            cache->oversized_buf = buf;
+            cache->oversized_size = size;
         }
+        return cache->oversized_buf;
     }
-    if(bucket->entries == NULL) {
-        bucket->capacity = 4;
-        bucket->entries = (ttf_cache_entry_t *)TTF_CACHE_MALLOC(sizeof(ttf_cache_entry_t) * bucket->capacity);
-        if(bucket->entries == NULL) {
+
+    // keep the load factor below 3/4
+    if((cache->entry_cnt + 1) * 4 > cache->entry_cap * 3) {
+        if(!ttf_cache_rehash(cache)) {
             return NULL;
         }
-        for(int i = 0; i < bucket->capacity; ++i) {
-            bucket->entries[i].age = 0;
-            bucket->entries[i].data = NULL;
-            bucket->entries[i].size = 0;
+    }
+
+    // append to a page with enough free space or clear the least recently used one
+    ttf_cache_page_t * page = NULL;
+    ttf_cache_page_t * lru = &cache->pages[0];
+    for(int i = 0; i < LV_TINY_TTF_CACHE_PAGES; ++i) {
+        ttf_cache_page_t * p = &cache->pages[i];
+        if(p->buf != NULL && p->size - p->used >= size) {
+            page = p;
+            break;
+        }
+        if(p->buf == NULL || (lru->buf != NULL && p->last_use < lru->last_use)) {
+            lru = p;
         }
     }
-    for(int i = 0; i < bucket->capacity; ++i) {
-        ttf_cache_entry_t * entry = &bucket->entries[i];
-        if(entry->age == 0) {
-            entry->data = TTF_CACHE_MALLOC(size);
-            if(entry->data == NULL) {
+    if(page == NULL) {
+        page = lru;
+        if(++page->gen == 0) {
+            page->gen = 1;
+        }
+        page->used = 0;
+        if(page->buf == NULL) {
+            page->buf = (uint8_t *)TTF_CACHE_MALLOC(cache->page_size);
+            if(page->buf == NULL) {
                 return NULL;
             }
-            entry->size = size;
-            entry->age = cache->age;
-            entry->key = key;
-            cache->total_size += size;
-            return entry->data;
+            page->size = cache->page_size;
         }
     }
-    int newcap = bucket->capacity * 2;
-    ttf_cache_entry_t * te = (ttf_cache_entry_t *)TTF_CACHE_REALLOC(bucket->entries, sizeof(ttf_cache_entry_t) * newcap);
-    if(te == NULL) {
-        return NULL;
-    }
-    bucket->entries = te;
-    for(int i = bucket->capacity; i < newcap; ++i) {
-        bucket->entries[i].age = 0;
-        bucket->entries[i].data = NULL;
-        bucket->entries[i].size = 0;
-    }
-    void * result = TTF_CACHE_MALLOC(size);
-    bucket->entries[bucket->capacity].data = result;
-    if(result == NULL) {
-        return NULL;
-    }
-    bucket->entries[bucket->capacity].size = size;
-    bucket->entries[bucket->capacity].age = cache->age;
-    bucket->entries[bucket->capacity].key = key;
-    bucket->capacity = newcap;
-    return result;
+
+    uint32_t mask = cache->entry_cap - 1;
+    uint32_t i = ttf_cache_hash(letter) & mask;
+    while(cache->entries[i].gen != 0) {
+        i = (i + 1) & mask;
+    }
+    ttf_cache_entry_t * entry = &cache->entries[i];
+    entry->letter = letter;
+    entry->gen = page->gen;
+    entry->ofs = page->used;
+    entry->page = (uint32_t)(page - cache->pages);
+    cache->entry_cnt++;
+
+    uint8_t * buf = page->buf + page->used;
+    page->used += size;
+    page->last_use = ++cache->use_cnt;
+    return buf;
 }
 
-static void ttf_cache_clear(ttf_cache_handle_t handle)
+static void ttf_cache_clear(ttf_cache_t * cache)
 {
-    if(handle == NULL) {
-        return;
-    }
-    ttf_cache_t * cache = (ttf_cache_t *)handle;
-    for(int i = 0; i < cache->bucket_size; ++i) {
-        ttf_cache_bucket_t * bucket = &cache->buckets[i];
-        if(bucket->entries != NULL) {
-            for(int j = 0; j < bucket->capacity; ++j) {
-                ttf_cache_entry_t * entry = &bucket->entries[j];
-                if(entry->age != 0 && entry->data != NULL) {
-                    TTF_CACHE_FREE(entry->data);
-                }
-            }
-            TTF_CACHE_FREE(cache->buckets[i].entries);
+    for(int i = 0; i < LV_TINY_TTF_CACHE_PAGES; ++i) {
+        if(++cache->pages[i].gen == 0) {
+            cache->pages[i].gen = 1;
         }
+        cache->pages[i].used = 0;
     }
+    TTF_CACHE_FREE(cache->entries);
+    cache->entries = NULL;
+    cache->entry_cap = 0;
+    cache->entry_cnt = 0;
 }
-static void ttf_cache_destroy(ttf_cache_handle_t handle)
+
+static void ttf_cache_destroy(ttf_cache_t * cache)
 {
-    ttf_cache_clear(handle);
-    TTF_CACHE_FREE((ttf_cache_t *)handle);
+    ttf_cache_clear(cache);
+    for(int i = 0; i < LV_TINY_TTF_CACHE_PAGES; ++i) {
+        TTF_CACHE_FREE(cache->pages[i].buf);
+    }
+    TTF_CACHE_FREE(cache->oversized_buf);
+    TTF_CACHE_FREE(cache);
 }
 #if LV_TINY_TTF_FILE_SUPPORT !=0
 // a hydra stream that can be in memory or from a file
@@ -269,7 +278,7 @@ typedef struct ttf_font_desc {
     const uint8_t * stream;
 #endif
     stbtt_fontinfo info;
-    ttf_cache_handle_t cache;
+    ttf_cache_t * cache;
     float scale;
     int ascent;
     int descent;
@@ -320,7 +329,7 @@ static const uint8_t * ttf_get_glyph_bitmap_cb(const lv_font_t * font, uint32_t
 {
     ttf_font_desc_t * dsc = (ttf_font_desc_t *)font->dsc;
     const stbtt_fontinfo * info = (const stbtt_fontinfo *)&dsc->info;
-    uint8_t * buffer = (uint8_t *)ttf_cache_get(dsc->cache, unicode_letter);
+    uint8_t * buffer = ttf_cache_get(dsc->cache, unicode_letter);
     if(buffer == NULL) {
         int g1 = stbtt_FindGlyphIndex(info, (int)unicode_letter);
         int x1, y1, x2, y2;
@@ -355,7 +364,7 @@ static lv_font_t * lv_tiny_ttf_create(const char * path, const void * data, size
         LV_LOG_ERROR("tiny_ttf: out of memory\n");
         return NULL;
     }
-    dsc->cache = ttf_cache_create(cache_size, LV_TINY_TTF_CACHE_BUCKETS);
+    dsc->cache = ttf_cache_create(cache_size);
     if(dsc->cache == NULL) {
         LV_LOG_ERROR("tiny_ttf: out of memory\n");
         TTF_FREE(dsc);
@@ -450,6 +459,7 @@ void lv_tiny_ttf_set_size(lv_font_t * font, lv_coord_t line_height)
 void lv_tiny_ttf_destroy(lv_font_t * font)
 {
     if(font != NULL) {
+        lv_font_fallback_cache_invalidate(font);
         if(font->dsc != NULL) {
             ttf_font_desc_t * ttf = (ttf_font_desc_t *)font->dsc;
             ttf_cache_destroy(ttf->cache);
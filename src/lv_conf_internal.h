@@ -10,6 +10,9 @@
 
 #include <stdint.h>
 
+#define LV_OS_NONE      0
+#define LV_OS_PTHREAD   1
+
 /* Handle special Kconfig options */
 #ifndef LV_KCONFIG_IGNORE
     #include "lv_conf_kconfig.h"
@@ -296,6 +299,45 @@
     #endif
 #endif
 
+/*====================
+   OPERATING SYSTEM
+ *====================*/
+
+/*Select an operating system to use. Possible options:
+ * - LV_OS_NONE
+ * - LV_OS_PTHREAD
+ *With an operating system slow jobs (e.g. decoding images) can run in worker threads.*/
+#ifndef LV_USE_OS
+    #ifdef CONFIG_LV_USE_OS
+        #define LV_USE_OS CONFIG_LV_USE_OS
+    #else
+        #define LV_USE_OS   LV_OS_NONE
+    #endif
+#endif
+#if LV_USE_OS != LV_OS_NONE
+    /*Number of threads running the background jobs (see `lv_worker.h`)*/
+    #ifndef LV_WORKER_THREAD_CNT
+        #ifdef _LV_KCONFIG_PRESENT
+            #ifdef CONFIG_LV_WORKER_THREAD_CNT
+                #define LV_WORKER_THREAD_CNT CONFIG_LV_WORKER_THREAD_CNT
+            #else
+                #define LV_WORKER_THREAD_CNT 0
+            #endif
+        #else
+            #define LV_WORKER_THREAD_CNT 1
+        #endif
+    #endif
+
+    /*Stack size of the worker threads [bytes]*/
+    #ifndef LV_WORKER_STACK_SIZE
+        #ifdef CONFIG_LV_WORKER_STACK_SIZE
+            #define LV_WORKER_STACK_SIZE CONFIG_LV_WORKER_STACK_SIZE
+        #else
+            #define LV_WORKER_STACK_SIZE (32 * 1024)
+        #endif
+    #endif
+#endif
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -955,6 +997,87 @@
     #endif
 #endif
 
+/*Limit the memory used by the decoded images in the image cache [bytes].
+ *The least recently used images are closed if a new image doesn't fit.
+ *0: no limit, only the number of images is limited by LV_IMG_CACHE_DEF_SIZE*/
+#ifndef LV_IMG_CACHE_DEF_MEM_SIZE
+    #ifdef CONFIG_LV_IMG_CACHE_DEF_MEM_SIZE
+        #define LV_IMG_CACHE_DEF_MEM_SIZE CONFIG_LV_IMG_CACHE_DEF_MEM_SIZE
+    #else
+        #define LV_IMG_CACHE_DEF_MEM_SIZE 0
+    #endif
+#endif
+
+/*1: Decode the images which are not cached yet in a worker thread by default.
+ *Nothing is drawn in place of them until they are decoded, but the frames are not blocked by slow decoders.
+ *Requires LV_USE_OS and LV_IMG_CACHE_DEF_SIZE > 0. Can be changed by `lv_img_cache_set_async()`*/
+#ifndef LV_IMG_CACHE_ASYNC
+    #ifdef CONFIG_LV_IMG_CACHE_ASYNC
+        #define LV_IMG_CACHE_ASYNC CONFIG_LV_IMG_CACHE_ASYNC
+    #else
+        #define LV_IMG_CACHE_ASYNC 0
+    #endif
+#endif
+
+/*1: Create downscaled versions (mipmaps) of the images drawn with `zoom <= 128` and draw the best fitting one.
+ *It's faster and nicer with large zoomed out images (e.g. thumbnails) but uses at most 1/3 more memory per image.
+ *The mipmaps are freed when the image is closed, so use it with the image cache. They count in its memory limit.
+ *Only LV_COLOR_FORMAT_NATIVE and LV_COLOR_FORMAT_NATIVE_ALPHA images are supported.*/
+#ifndef LV_USE_IMG_MIPMAP
+    #ifdef CONFIG_LV_USE_IMG_MIPMAP
+        #define LV_USE_IMG_MIPMAP CONFIG_LV_USE_IMG_MIPMAP
+    #else
+        #define LV_USE_IMG_MIPMAP 0
+    #endif
+#endif
+
+/*Keep the rotated/zoomed images, so that redrawing them with the same transformation is only a copy.
+ *The transformed images are stored with alpha channel. Set the memory limit in bytes (0: disable caching).
+ *Only LV_COLOR_FORMAT_NATIVE(_ALPHA/_CHROMA_KEYED) images are cached.*/
+#ifndef LV_USE_IMG_TRANSFORM_CACHE
+    #ifdef CONFIG_LV_USE_IMG_TRANSFORM_CACHE
+        #define LV_USE_IMG_TRANSFORM_CACHE CONFIG_LV_USE_IMG_TRANSFORM_CACHE
+    #else
+        #define LV_USE_IMG_TRANSFORM_CACHE 0
+    #endif
+#endif
+#if LV_USE_IMG_TRANSFORM_CACHE
+    #ifndef LV_IMG_TRANSFORM_CACHE_DEF_MEM_SIZE
+        #ifdef CONFIG_LV_IMG_TRANSFORM_CACHE_DEF_MEM_SIZE
+            #define LV_IMG_TRANSFORM_CACHE_DEF_MEM_SIZE CONFIG_LV_IMG_TRANSFORM_CACHE_DEF_MEM_SIZE
+        #else
+            #define LV_IMG_TRANSFORM_CACHE_DEF_MEM_SIZE (256 * 1024)
+        #endif
+    #endif
+#endif
+
+/*Draw the images which can't be decoded at once (e.g. huge images) by decoding only the visible tiles.
+ *The recently used tiles are kept in the memory, limited to LV_IMG_TILE_CACHE_DEF_MEM_SIZE bytes.
+ *Decoders can read the tiles with `read_tile_cb` or with `read_line_cb` line by line.*/
+#ifndef LV_USE_IMG_TILE_CACHE
+    #ifdef CONFIG_LV_USE_IMG_TILE_CACHE
+        #define LV_USE_IMG_TILE_CACHE CONFIG_LV_USE_IMG_TILE_CACHE
+    #else
+        #define LV_USE_IMG_TILE_CACHE 0
+    #endif
+#endif
+#if LV_USE_IMG_TILE_CACHE
+    #ifndef LV_IMG_TILE_SIZE
+        #ifdef CONFIG_LV_IMG_TILE_SIZE
+            #define LV_IMG_TILE_SIZE CONFIG_LV_IMG_TILE_SIZE
+        #else
+            #define LV_IMG_TILE_SIZE 64
+        #endif
+    #endif
+    #ifndef LV_IMG_TILE_CACHE_DEF_MEM_SIZE
+        #ifdef CONFIG_LV_IMG_TILE_CACHE_DEF_MEM_SIZE
+            #define LV_IMG_TILE_CACHE_DEF_MEM_SIZE CONFIG_LV_IMG_TILE_CACHE_DEF_MEM_SIZE
+        #else
+            #define LV_IMG_TILE_CACHE_DEF_MEM_SIZE (256 * 1024)
+        #endif
+    #endif
+#endif
+
 
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
@@ -1343,6 +1466,25 @@
     #endif
 #endif
 
+/*Number of letters whose font is remembered when searching the `fallback` fonts. 0: disable*/
+#ifndef LV_FONT_FALLBACK_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_FALLBACK_CACHE_SIZE
+        #define LV_FONT_FALLBACK_CACHE_SIZE CONFIG_LV_FONT_FALLBACK_CACHE_SIZE
+    #else
+        #define LV_FONT_FALLBACK_CACHE_SIZE 0
+    #endif
+#endif
+
+/*Enable fonts with signed distance field glyphs which can be drawn in any size.
+ *See lv_font_sdf.h and scripts/sdf_font_conv.py*/
+#ifndef LV_USE_FONT_SDF
+    #ifdef CONFIG_LV_USE_FONT_SDF
+        #define LV_USE_FONT_SDF CONFIG_LV_USE_FONT_SDF
+    #else
+        #define LV_USE_FONT_SDF 0
+    #endif
+#endif
+
 /*=================
  *  TEXT SETTINGS
  *=================*/
@@ -1431,6 +1573,16 @@
             #define LV_BIDI_BASE_DIR_DEF LV_BASE_DIR_AUTO
         #endif
     #endif
+
+    /*Number of processed lines to remember. Drawing, measuring and the cursor handling
+     *of the same line reuse the result instead of running the algorithm again. 0: disable*/
+    #ifndef LV_BIDI_CACHE_SIZE
+        #ifdef CONFIG_LV_BIDI_CACHE_SIZE
+            #define LV_BIDI_CACHE_SIZE CONFIG_LV_BIDI_CACHE_SIZE
+        #else
+            #define LV_BIDI_CACHE_SIZE 0
+        #endif
+    #endif
 #endif
 
 /*Enable Arabic/Persian processing
@@ -2044,6 +2196,38 @@
 
 /*File system interfaces for common APIs */
 
+/*Keep the recently read blocks of the files in a cache shared by all opened files and drivers*/
+#ifndef LV_USE_FS_CACHE
+    #ifdef CONFIG_LV_USE_FS_CACHE
+        #define LV_USE_FS_CACHE CONFIG_LV_USE_FS_CACHE
+    #else
+        #define LV_USE_FS_CACHE 0
+    #endif
+#endif
+#if LV_USE_FS_CACHE
+    #ifndef LV_FS_CACHE_BLOCK_SIZE
+        #ifdef CONFIG_LV_FS_CACHE_BLOCK_SIZE
+            #define LV_FS_CACHE_BLOCK_SIZE CONFIG_LV_FS_CACHE_BLOCK_SIZE
+        #else
+            #define LV_FS_CACHE_BLOCK_SIZE 4096             /*Size of a cached block in bytes*/
+        #endif
+    #endif
+    #ifndef LV_FS_CACHE_DEF_MEM_SIZE
+        #ifdef CONFIG_LV_FS_CACHE_DEF_MEM_SIZE
+            #define LV_FS_CACHE_DEF_MEM_SIZE CONFIG_LV_FS_CACHE_DEF_MEM_SIZE
+        #else
+            #define LV_FS_CACHE_DEF_MEM_SIZE (64 * 1024)    /*Default memory size of the cache in bytes. Can be changed with `lv_fs_cache_set_mem_size()`*/
+        #endif
+    #endif
+    #ifndef LV_FS_CACHE_READ_AHEAD
+        #ifdef CONFIG_LV_FS_CACHE_READ_AHEAD
+            #define LV_FS_CACHE_READ_AHEAD CONFIG_LV_FS_CACHE_READ_AHEAD
+        #else
+            #define LV_FS_CACHE_READ_AHEAD 2                /*Read this number of extra blocks if a file is read sequentially*/
+        #endif
+    #endif
+#endif
+
 /*API for fopen, fread, etc*/
 #ifndef LV_USE_FS_STDIO
     #ifdef CONFIG_LV_USE_FS_STDIO
@@ -2173,6 +2357,18 @@
         #define LV_USE_PNG 0
     #endif
 #endif
+#if LV_USE_PNG
+    /*1: Don't decode the whole image but read the rows on demand while drawing.
+     *   Uses only ~40 kB RAM regardless of the image size but redrawing is slower.
+     *0: Decode the whole image at once (falls back to reading the rows if there is not enough memory)*/
+    #ifndef LV_PNG_USE_READ_LINE
+        #ifdef CONFIG_LV_PNG_USE_READ_LINE
+            #define LV_PNG_USE_READ_LINE CONFIG_LV_PNG_USE_READ_LINE
+        #else
+            #define LV_PNG_USE_READ_LINE 0
+        #endif
+    #endif
+#endif
 
 /*BMP decoder library*/
 #ifndef LV_USE_BMP
@@ -2192,6 +2388,31 @@
         #define LV_USE_SJPG 0
     #endif
 #endif
+#if LV_USE_SJPG
+    /*Number of decoded fragments to keep per image. Each needs `image width x fragment height x 3` bytes.
+     *More fragments make scrolling back and forth faster.*/
+    #ifndef LV_SJPG_FRAG_CACHE_CNT
+        #ifdef _LV_KCONFIG_PRESENT
+            #ifdef CONFIG_LV_SJPG_FRAG_CACHE_CNT
+                #define LV_SJPG_FRAG_CACHE_CNT CONFIG_LV_SJPG_FRAG_CACHE_CNT
+            #else
+                #define LV_SJPG_FRAG_CACHE_CNT 0
+            #endif
+        #else
+            #define LV_SJPG_FRAG_CACHE_CNT 1
+        #endif
+    #endif
+
+    /*Decode this many fragments ahead of the drawn one in worker threads (requires LV_USE_OS).
+     *Should be less than LV_SJPG_FRAG_CACHE_CNT. 0: disable*/
+    #ifndef LV_SJPG_PREFETCH_CNT
+        #ifdef CONFIG_LV_SJPG_PREFETCH_CNT
+            #define LV_SJPG_PREFETCH_CNT CONFIG_LV_SJPG_PREFETCH_CNT
+        #else
+            #define LV_SJPG_PREFETCH_CNT 0
+        #endif
+    #endif
+#endif
 
 /*GIF decoder library*/
 #ifndef LV_USE_GIF
@@ -2201,6 +2422,17 @@
         #define LV_USE_GIF 0
     #endif
 #endif
+#if LV_USE_GIF
+    /*Decode the next frame in a worker thread while the current one is shown (requires LV_USE_OS).
+     *Needs an other `width x height x pixel size` buffer per GIF. Can be changed with `lv_gif_set_async()`*/
+    #ifndef LV_GIF_ASYNC
+        #ifdef CONFIG_LV_GIF_ASYNC
+            #define LV_GIF_ASYNC CONFIG_LV_GIF_ASYNC
+        #else
+            #define LV_GIF_ASYNC 0
+        #endif
+    #endif
+#endif
 
 /*QR code library*/
 #ifndef LV_USE_QRCODE
@@ -2322,6 +2554,16 @@
             #define LV_FFMPEG_DUMP_FORMAT 0
         #endif
     #endif
+
+    /*Decode the video in a separate thread (requires LV_USE_OS) and queue this many converted frames.
+     *Each needs `width x height x pixel size` bytes. 0: decode in the LVGL thread*/
+    #ifndef LV_FFMPEG_FRAME_QUEUE_CNT
+        #ifdef CONFIG_LV_FFMPEG_FRAME_QUEUE_CNT
+            #define LV_FFMPEG_FRAME_QUEUE_CNT CONFIG_LV_FFMPEG_FRAME_QUEUE_CNT
+        #else
+            #define LV_FFMPEG_FRAME_QUEUE_CNT 2
+        #endif
+    #endif
 #endif
 
 /*==================
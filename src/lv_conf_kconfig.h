@@ -49,6 +49,16 @@ extern "C" {
 #  define CONFIG_LV_MEM_POOL_EXPAND_SIZE (CONFIG_LV_MEM_POOL_EXPAND_SIZE_KILOBYTES * 1024U)
 #endif
 
+/*******************
+ * OPERATING SYSTEM
+ *******************/
+
+#ifdef CONFIG_LV_OS_NONE
+#  define CONFIG_LV_USE_OS LV_OS_NONE
+#elif defined(CONFIG_LV_OS_PTHREAD)
+#  define CONFIG_LV_USE_OS LV_OS_PTHREAD
+#endif
+
 /*------------------
  * MONITOR POSITION
  *-----------------*/
@@ -10,6 +10,7 @@
 #include "lv_bidi.h"
 #include "lv_txt.h"
 #include "../misc/lv_mem.h"
+#include "../misc/lv_log.h"
 
 #if LV_USE_BIDI
 
@@ -23,6 +24,8 @@
 #define IS_RTL_POS(x) (((x) & 0x8000) != 0)
 #define SET_RTL_POS(x, is_rtl) (GET_POS(x) | ((is_rtl)? 0x8000: 0))
 
+#define POS_CONV_LEN_ANY UINT32_MAX
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -31,6 +34,19 @@ typedef struct {
     lv_base_dir_t dir;
 } bracket_stack_t;
 
+#if LV_BIDI_CACHE_SIZE
+typedef struct {
+    uint16_t * pos_conv;        /*Logical position of each visual character. The texts are allocated after it*/
+    char * txt_out;             /*The processed text*/
+    char * txt_in;              /*Copy of the original text*/
+    uint32_t len;
+    uint32_t hash;
+    uint32_t last_used;
+    uint16_t pos_conv_len;
+    lv_base_dir_t base_dir;
+} bidi_cache_entry_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -50,12 +66,22 @@ static lv_base_dir_t bracket_process(const char * txt, uint32_t next_pos, uint32
                                      lv_base_dir_t base_dir);
 static void fill_pos_conv(uint16_t * out, uint16_t len, uint16_t index);
 static uint32_t get_txt_len(const char * txt, uint32_t max_len);
+static void process_paragraph(const char * str_in, char * str_out, uint32_t len, lv_base_dir_t base_dir,
+                              uint16_t * pos_conv_out, uint16_t pos_conv_len);
+#if LV_BIDI_CACHE_SIZE
+static const bidi_cache_entry_t * cache_get(const char * str_in, uint32_t len, lv_base_dir_t base_dir,
+                                            uint32_t pos_conv_len_req);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static const uint8_t bracket_left[] = {"<({["};
 static const uint8_t bracket_right[] = {">)}]"};
+#if LV_BIDI_CACHE_SIZE
+static bidi_cache_entry_t bidi_cache[LV_BIDI_CACHE_SIZE];
+static uint32_t bidi_cache_time;
+#endif
 static bracket_stack_t br_stack[LV_BIDI_BRACKLET_DEPTH];
 static uint8_t br_stack_p;
 
@@ -67,6 +93,26 @@ static uint8_t br_stack_p;
  *   GLOBAL FUNCTIONS
  **********************/
 
+void _lv_bidi_init(void)
+{
+#if LV_BIDI_CACHE_SIZE
+    /*The entries were allocated in the previous heap (if any), just forget them*/
+    lv_memzero(bidi_cache, sizeof(bidi_cache));
+    bidi_cache_time = 0;
+#endif
+}
+
+void _lv_bidi_deinit(void)
+{
+#if LV_BIDI_CACHE_SIZE
+    uint32_t i;
+    for(i = 0; i < LV_BIDI_CACHE_SIZE; i++) {
+        lv_free(bidi_cache[i].pos_conv);
+    }
+    lv_memzero(bidi_cache, sizeof(bidi_cache));
+#endif
+}
+
 /**
  * Convert a text to get the characters in the correct visual order according to
  * Unicode Bidirectional Algorithm
@@ -137,6 +183,21 @@ lv_base_dir_t _lv_bidi_detect_base_dir(const char * txt)
 uint16_t _lv_bidi_get_logical_pos(const char * str_in, char ** bidi_txt, uint32_t len, lv_base_dir_t base_dir,
                                   uint32_t visual_pos, bool * is_rtl)
 {
+#if LV_BIDI_CACHE_SIZE
+    if(base_dir == LV_BASE_DIR_AUTO) base_dir = _lv_bidi_detect_base_dir(str_in);
+    const bidi_cache_entry_t * entry = cache_get(str_in, len, base_dir, POS_CONV_LEN_ANY);
+    if(entry) {
+        if(bidi_txt) {
+            *bidi_txt = lv_malloc(len + 1);
+            if(*bidi_txt == NULL) return (uint16_t) -1;
+            lv_memcpy(*bidi_txt, entry->txt_out, len + 1);
+        }
+
+        if(is_rtl) *is_rtl = IS_RTL_POS(entry->pos_conv[visual_pos]);
+        return GET_POS(entry->pos_conv[visual_pos]);
+    }
+#endif
+
     uint32_t pos_conv_len = get_txt_len(str_in, len);
     char * buf = lv_malloc(len + 1);
     if(buf == NULL) return (uint16_t) -1;
@@ -174,6 +235,26 @@ uint16_t _lv_bidi_get_logical_pos(const char * str_in, char ** bidi_txt, uint32_
 uint16_t _lv_bidi_get_visual_pos(const char * str_in, char ** bidi_txt, uint16_t len, lv_base_dir_t base_dir,
                                  uint32_t logical_pos, bool * is_rtl)
 {
+#if LV_BIDI_CACHE_SIZE
+    if(base_dir == LV_BASE_DIR_AUTO) base_dir = _lv_bidi_detect_base_dir(str_in);
+    const bidi_cache_entry_t * entry = cache_get(str_in, len, base_dir, POS_CONV_LEN_ANY);
+    if(entry) {
+        if(bidi_txt) {
+            *bidi_txt = lv_malloc(len + 1);
+            if(*bidi_txt == NULL) return (uint16_t) -1;
+            lv_memcpy(*bidi_txt, entry->txt_out, len + 1);
+        }
+
+        for(uint16_t i = 0; i < entry->pos_conv_len; i++) {
+            if(GET_POS(entry->pos_conv[i]) == logical_pos) {
+                if(is_rtl) *is_rtl = IS_RTL_POS(entry->pos_conv[i]);
+                return i;
+            }
+        }
+        return (uint16_t) -1;
+    }
+#endif
+
     uint32_t pos_conv_len = get_txt_len(str_in, len);
     char * buf = lv_malloc(len + 1);
     if(buf == NULL) return (uint16_t) -1;
@@ -216,93 +297,18 @@ uint16_t _lv_bidi_get_visual_pos(const char * str_in, char ** bidi_txt, uint16_t
 void _lv_bidi_process_paragraph(const char * str_in, char * str_out, uint32_t len, lv_base_dir_t base_dir,
                                 uint16_t * pos_conv_out, uint16_t pos_conv_len)
 {
-    uint32_t run_len = 0;
-    lv_base_dir_t run_dir;
-    uint32_t rd = 0;
-    uint32_t wr;
-    uint16_t pos_conv_run_len = 0;
-    uint16_t pos_conv_rd = 0;
-    uint16_t pos_conv_wr;
-
     if(base_dir == LV_BASE_DIR_AUTO) base_dir = _lv_bidi_detect_base_dir(str_in);
-    if(base_dir == LV_BASE_DIR_RTL) {
-        wr = len;
-        pos_conv_wr = pos_conv_len;
-    }
-    else {
-        wr = 0;
-        pos_conv_wr = 0;
-    }
 
-    if(str_out) str_out[len] = '\0';
-
-    lv_base_dir_t dir = base_dir;
-
-    /*Empty the bracket stack*/
-    br_stack_p = 0;
-
-    /*Process neutral chars in the beginning*/
-    while(rd < len) {
-        uint32_t letter = _lv_txt_encoded_next(str_in, &rd);
-        pos_conv_rd++;
-        dir = lv_bidi_get_letter_dir(letter);
-        if(dir == LV_BASE_DIR_NEUTRAL)  dir = bracket_process(str_in, rd, len, letter, base_dir);
-        if(dir != LV_BASE_DIR_NEUTRAL && dir != LV_BASE_DIR_WEAK) break;
+#if LV_BIDI_CACHE_SIZE
+    const bidi_cache_entry_t * entry = cache_get(str_in, len, base_dir, pos_conv_out ? pos_conv_len : POS_CONV_LEN_ANY);
+    if(entry && (pos_conv_out == NULL || pos_conv_len == entry->pos_conv_len)) {
+        if(str_out) lv_memcpy(str_out, entry->txt_out, len + 1);
+        if(pos_conv_out) lv_memcpy(pos_conv_out, entry->pos_conv, pos_conv_len * sizeof(uint16_t));
+        return;
     }
+#endif
 
-    if(rd && str_in[rd] != '\0') {
-        _lv_txt_encoded_prev(str_in, &rd);
-        pos_conv_rd--;
-    }
-
-    if(rd) {
-        if(base_dir == LV_BASE_DIR_LTR) {
-            if(str_out) {
-                lv_memcpy(&str_out[wr], str_in, rd);
-                wr += rd;
-            }
-            if(pos_conv_out) {
-                fill_pos_conv(&pos_conv_out[pos_conv_wr], pos_conv_rd, 0);
-                pos_conv_wr += pos_conv_rd;
-            }
-        }
-        else {
-            wr -= rd;
-            pos_conv_wr -= pos_conv_rd;
-            rtl_reverse(str_out ? &str_out[wr] : NULL, str_in, rd, pos_conv_out ? &pos_conv_out[pos_conv_wr] : NULL, 0,
-                        pos_conv_rd);
-        }
-    }
-
-    /*Get and process the runs*/
-
-    while(rd < len && str_in[rd]) {
-        run_dir = get_next_run(&str_in[rd], base_dir, len - rd, &run_len, &pos_conv_run_len);
-
-        if(base_dir == LV_BASE_DIR_LTR) {
-            if(run_dir == LV_BASE_DIR_LTR) {
-                if(str_out) lv_memcpy(&str_out[wr], &str_in[rd], run_len);
-                if(pos_conv_out) fill_pos_conv(&pos_conv_out[pos_conv_wr], pos_conv_run_len, pos_conv_rd);
-            }
-            else rtl_reverse(str_out ? &str_out[wr] : NULL, &str_in[rd], run_len, pos_conv_out ? &pos_conv_out[pos_conv_wr] : NULL,
-                                 pos_conv_rd, pos_conv_run_len);
-            wr += run_len;
-            pos_conv_wr += pos_conv_run_len;
-        }
-        else {
-            wr -= run_len;
-            pos_conv_wr -= pos_conv_run_len;
-            if(run_dir == LV_BASE_DIR_LTR) {
-                if(str_out) lv_memcpy(&str_out[wr], &str_in[rd], run_len);
-                if(pos_conv_out) fill_pos_conv(&pos_conv_out[pos_conv_wr], pos_conv_run_len, pos_conv_rd);
-            }
-            else rtl_reverse(str_out ? &str_out[wr] : NULL, &str_in[rd], run_len, pos_conv_out ? &pos_conv_out[pos_conv_wr] : NULL,
-                                 pos_conv_rd, pos_conv_run_len);
-        }
-
-        rd += run_len;
-        pos_conv_rd += pos_conv_run_len;
-    }
+    process_paragraph(str_in, str_out, len, base_dir, pos_conv_out, pos_conv_len);
 }
 
 void lv_bidi_calculate_align(lv_text_align_t * align, lv_base_dir_t * base_dir, const char * txt)
@@ -682,4 +688,165 @@ static lv_base_dir_t bracket_process(const char * txt, uint32_t next_pos, uint32
     return LV_BASE_DIR_NEUTRAL;
 }
 
+/**
+ * Run the Unicode Bidirectional Algorithm on a paragraph.
+ * The parameters are the same as `_lv_bidi_process_paragraph()` but `base_dir` can't be `LV_BASE_DIR_AUTO`.
+ */
+static void process_paragraph(const char * str_in, char * str_out, uint32_t len, lv_base_dir_t base_dir,
+                              uint16_t * pos_conv_out, uint16_t pos_conv_len)
+{
+    uint32_t run_len = 0;
+
+    lv_base_dir_t run_dir;
+    uint32_t rd = 0;
+    uint32_t wr;
+    uint16_t pos_conv_run_len = 0;
+    uint16_t pos_conv_rd = 0;
+    uint16_t pos_conv_wr;
+
+    if(base_dir == LV_BASE_DIR_RTL) {
+        wr = len;
+        pos_conv_wr = pos_conv_len;
+    }
+    else {
+        wr = 0;
+        pos_conv_wr = 0;
+    }
+
+    if(str_out) str_out[len] = '\0';
+
+    lv_base_dir_t dir = base_dir;
+
+    /*Empty the bracket stack*/
+    br_stack_p = 0;
+
+    /*Process neutral chars in the beginning*/
+    while(rd < len) {
+        uint32_t letter = _lv_txt_encoded_next(str_in, &rd);
+        pos_conv_rd++;
+        dir = lv_bidi_get_letter_dir(letter);
+        if(dir == LV_BASE_DIR_NEUTRAL)  dir = bracket_process(str_in, rd, len, letter, base_dir);
+        if(dir != LV_BASE_DIR_NEUTRAL && dir != LV_BASE_DIR_WEAK) break;
+    }
+
+    if(rd && str_in[rd] != '\0') {
+        _lv_txt_encoded_prev(str_in, &rd);
+        pos_conv_rd--;
+    }
+
+    if(rd) {
+        if(base_dir == LV_BASE_DIR_LTR) {
+            if(str_out) {
+                lv_memcpy(&str_out[wr], str_in, rd);
+                wr += rd;
+            }
+            if(pos_conv_out) {
+                fill_pos_conv(&pos_conv_out[pos_conv_wr], pos_conv_rd, 0);
+                pos_conv_wr += pos_conv_rd;
+            }
+        }
+        else {
+            wr -= rd;
+            pos_conv_wr -= pos_conv_rd;
+            rtl_reverse(str_out ? &str_out[wr] : NULL, str_in, rd, pos_conv_out ? &pos_conv_out[pos_conv_wr] : NULL, 0,
+                        pos_conv_rd);
+        }
+    }
+
+    /*Get and process the runs*/
+
+    while(rd < len && str_in[rd]) {
+        run_dir = get_next_run(&str_in[rd], base_dir, len - rd, &run_len, &pos_conv_run_len);
+
+        if(base_dir == LV_BASE_DIR_LTR) {
+            if(run_dir == LV_BASE_DIR_LTR) {
+                if(str_out) lv_memcpy(&str_out[wr], &str_in[rd], run_len);
+                if(pos_conv_out) fill_pos_conv(&pos_conv_out[pos_conv_wr], pos_conv_run_len, pos_conv_rd);
+            }
+            else rtl_reverse(str_out ? &str_out[wr] : NULL, &str_in[rd], run_len, pos_conv_out ? &pos_conv_out[pos_conv_wr] : NULL,
+                                 pos_conv_rd, pos_conv_run_len);
+            wr += run_len;
+            pos_conv_wr += pos_conv_run_len;
+        }
+        else {
+            wr -= run_len;
+            pos_conv_wr -= pos_conv_run_len;
+            if(run_dir == LV_BASE_DIR_LTR) {
+                if(str_out) lv_memcpy(&str_out[wr], &str_in[rd], run_len);
+                if(pos_conv_out) fill_pos_conv(&pos_conv_out[pos_conv_wr], pos_conv_run_len, pos_conv_rd);
+            }
+            else rtl_reverse(str_out ? &str_out[wr] : NULL, &str_in[rd], run_len, pos_conv_out ? &pos_conv_out[pos_conv_wr] : NULL,
+                                 pos_conv_rd, pos_conv_run_len);
+        }
+
+        rd += run_len;
+        pos_conv_rd += pos_conv_run_len;
+    }
+}
+
+#if LV_BIDI_CACHE_SIZE
+/**
+ * Get the processed text and position conversion of a line from the cache or process and add it.
+ * The entries are identified by the content of the text, not its address.
+ * @param str_in    the text to process
+ * @param len       length of the text in bytes
+ * @param base_dir  `LV_BASE_DIR_LTR` or `LV_BASE_DIR_RTL`
+ * @param pos_conv_len_req  don't add the text if it has another number of letters, as the caller would process
+ *                          it again anyway. `POS_CONV_LEN_ANY` to add it regardless.
+ * @return          the cached entry, valid until the next call, or NULL if it can't be cached
+ */
+static const bidi_cache_entry_t * cache_get(const char * str_in, uint32_t len, lv_base_dir_t base_dir,
+                                            uint32_t pos_conv_len_req)
+{
+    /*FNV-1a hash of the text. Texts ending before `len` are not cached as their end is undefined.*/
+    uint32_t hash = 2166136261U ^ base_dir;
+    uint32_t i;
+    for(i = 0; i < len; i++) {
+        if(str_in[i] == '\0') return NULL;
+        hash = (hash ^ (uint8_t)str_in[i]) * 16777619U;
+    }
+
+    bidi_cache_time++;
+
+    bidi_cache_entry_t * entry = &bidi_cache[0];
+    for(i = 0; i < LV_BIDI_CACHE_SIZE; i++) {
+        bidi_cache_entry_t * e = &bidi_cache[i];
+        if(e->pos_conv && e->hash == hash && e->len == len && e->base_dir == base_dir &&
+           memcmp(e->txt_in, str_in, len) == 0) {
+            e->last_used = bidi_cache_time;
+            return e;
+        }
+
+        /*Replace the least recently used or a free entry*/
+        if(entry->pos_conv && (e->pos_conv == NULL || e->last_used < entry->last_used)) entry = e;
+    }
+
+    uint32_t pos_conv_len = get_txt_len(str_in, len);
+    if(pos_conv_len > UINT16_MAX) return NULL;
+    if(pos_conv_len_req != POS_CONV_LEN_ANY && pos_conv_len != pos_conv_len_req) return NULL;
+
+    lv_free(entry->pos_conv);
+    lv_memzero(entry, sizeof(bidi_cache_entry_t));
+
+    entry->pos_conv = lv_malloc(pos_conv_len * sizeof(uint16_t) + 2 * len + 1);
+    if(entry->pos_conv == NULL) {
+        LV_LOG_WARN("couldn't allocate memory for the bidi cache");
+        return NULL;
+    }
+
+    entry->txt_out = (char *)&entry->pos_conv[pos_conv_len];
+    entry->txt_in = &entry->txt_out[len + 1];
+    lv_memcpy(entry->txt_in, str_in, len);
+    entry->len = len;
+    entry->hash = hash;
+    entry->base_dir = base_dir;
+    entry->pos_conv_len = pos_conv_len;
+    entry->last_used = bidi_cache_time;
+
+    process_paragraph(str_in, entry->txt_out, len, base_dir, entry->pos_conv, pos_conv_len);
+
+    return entry;
+}
+#endif /*LV_BIDI_CACHE_SIZE*/
+
 #endif /*LV_USE_BIDI*/
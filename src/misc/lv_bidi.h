@@ -51,6 +51,16 @@ typedef uint8_t lv_base_dir_t;
  **********************/
 #if LV_USE_BIDI
 
+/**
+ * Initialize the cache of the processed lines
+ */
+void _lv_bidi_init(void);
+
+/**
+ * Free the cache of the processed lines
+ */
+void _lv_bidi_deinit(void);
+
 /**
  * Convert a text to get the characters in the correct visual order according to
  * Unicode Bidirectional Algorithm
@@ -106,6 +116,7 @@ uint16_t _lv_bidi_get_visual_pos(const char * str_in, char ** bidi_txt, uint16_t
  * @param pos_conv_out an `uint16_t` array to store the related logical position of the character.
  * Can be `NULL` is unused
  * @param pos_conv_len length of `pos_conv_out` in element count
+ * @note the results of the last `LV_BIDI_CACHE_SIZE` lines are cached
  */
 void _lv_bidi_process_paragraph(const char * str_in, char * str_out, uint32_t len, lv_base_dir_t base_dir,
                                 uint16_t * pos_conv_out, uint16_t pos_conv_len);
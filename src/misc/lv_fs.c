@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include "lv_fs.h"
+#include "lv_fs_cache.h"
 
 #include "../misc/lv_assert.h"
 #include "lv_ll.h"
@@ -25,6 +26,8 @@
  *  STATIC PROTOTYPES
  **********************/
 static const char * lv_fs_get_real_path(const char * path);
+static void read_async_exec_cb(lv_worker_job_t * job);
+static void read_async_ready_cb(lv_worker_job_t * job);
 
 /**********************
  *  STATIC VARIABLES
@@ -41,6 +44,10 @@ static const char * lv_fs_get_real_path(const char * path);
 void _lv_fs_init(void)
 {
     _lv_ll_init(&LV_GC_ROOT(_lv_fsdrv_ll), sizeof(lv_fs_drv_t *));
+
+#if LV_USE_FS_CACHE
+    _lv_fs_cache_init();
+#endif
 }
 
 bool lv_fs_is_ready(char letter)
@@ -90,6 +97,12 @@ lv_fs_res_t lv_fs_open(lv_fs_file_t * file_p, const char * path, lv_fs_mode_t mo
 
     file_p->drv = drv;
     file_p->file_d = file_d;
+    file_p->cache = NULL;
+
+#if LV_USE_FS_CACHE
+    /*The shared block cache replaces the per-file cache*/
+    if(_lv_fs_cache_open(file_p, path, mode)) return LV_FS_RES_OK;
+#endif
 
     if(drv->cache_size) {
         file_p->cache = lv_malloc(sizeof(lv_fs_file_cache_t));
@@ -114,6 +127,10 @@ lv_fs_res_t lv_fs_close(lv_fs_file_t * file_p)
 
     lv_fs_res_t res = file_p->drv->close_cb(file_p->drv, file_p->file_d);
 
+#if LV_USE_FS_CACHE
+    _lv_fs_cache_close(file_p);
+#endif
+
     if(file_p->drv->cache_size && file_p->cache) {
         if(file_p->cache->buffer) {
             lv_free(file_p->cache->buffer);
@@ -219,6 +236,12 @@ lv_fs_res_t lv_fs_read(lv_fs_file_t * file_p, void * buf, uint32_t btr, uint32_t
     uint32_t br_tmp = 0;
     lv_fs_res_t res;
 
+#if LV_USE_FS_CACHE
+    if(file_p->cache_path && !file_p->cache_write) {
+        res = _lv_fs_cache_read(file_p, buf, btr, &br_tmp);
+    }
+    else
+#endif
     if(file_p->drv->cache_size) {
         res = lv_fs_read_cached(file_p, (char *)buf, btr, &br_tmp);
     }
@@ -261,6 +284,29 @@ lv_fs_res_t lv_fs_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whenc
     }
 
     lv_fs_res_t res = LV_FS_RES_OK;
+#if LV_USE_FS_CACHE
+    if(file_p->cache_path && !file_p->cache_write) {
+        switch(whence) {
+            case LV_FS_SEEK_SET:
+                file_p->cache_pos = pos;
+                break;
+            case LV_FS_SEEK_CUR:
+                file_p->cache_pos += pos;
+                break;
+            case LV_FS_SEEK_END: {
+                    /*The file size is not known so let the driver seek and tell the position*/
+                    res = file_p->drv->seek_cb(file_p->drv, file_p->file_d, pos, whence);
+                    if(res == LV_FS_RES_OK) {
+                        uint32_t tmp_position;
+                        res = file_p->drv->tell_cb(file_p->drv, file_p->file_d, &tmp_position);
+                        if(res == LV_FS_RES_OK) file_p->cache_pos = tmp_position;
+                    }
+                    break;
+                }
+        }
+    }
+    else
+#endif
     if(file_p->drv->cache_size) {
         switch(whence) {
             case LV_FS_SEEK_SET: {
@@ -318,6 +364,13 @@ lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos)
     }
 
     lv_fs_res_t res;
+#if LV_USE_FS_CACHE
+    if(file_p->cache_path && !file_p->cache_write) {
+        *pos = file_p->cache_pos;
+        res = LV_FS_RES_OK;
+    }
+    else
+#endif
     if(file_p->drv->cache_size) {
         *pos = file_p->cache->file_position;
         res = LV_FS_RES_OK;
@@ -329,6 +382,71 @@ lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos)
     return res;
 }
 
+lv_fs_res_t lv_fs_mmap(lv_fs_file_t * file_p, const void ** addr, uint32_t * size)
+{
+    *addr = NULL;
+    *size = 0;
+
+    if(file_p->drv == NULL) {
+        return LV_FS_RES_INV_PARAM;
+    }
+
+    if(file_p->drv->mmap_cb == NULL || file_p->drv->munmap_cb == NULL) {
+        return LV_FS_RES_NOT_IMP;
+    }
+
+    uint32_t size_tmp = 0;
+    const void * addr_tmp = file_p->drv->mmap_cb(file_p->drv, file_p->file_d, &size_tmp);
+    if(addr_tmp == NULL) {
+        return LV_FS_RES_UNKNOWN;
+    }
+
+    *addr = addr_tmp;
+    *size = size_tmp;
+
+    return LV_FS_RES_OK;
+}
+
+lv_fs_res_t lv_fs_munmap(lv_fs_file_t * file_p, const void * addr, uint32_t size)
+{
+    if(file_p->drv == NULL || addr == NULL) {
+        return LV_FS_RES_INV_PARAM;
+    }
+
+    if(file_p->drv->munmap_cb == NULL) {
+        return LV_FS_RES_NOT_IMP;
+    }
+
+    return file_p->drv->munmap_cb(file_p->drv, file_p->file_d, addr, size);
+}
+
+lv_fs_res_t lv_fs_read_async(lv_fs_file_t * file_p, lv_fs_read_req_t * req, uint32_t pos, void * buf, uint32_t btr,
+                             lv_fs_read_cb_t ready_cb, void * user_data)
+{
+    if(file_p->drv == NULL || ready_cb == NULL) {
+        return LV_FS_RES_INV_PARAM;
+    }
+
+    if(file_p->drv->read_cb == NULL || file_p->drv->seek_cb == NULL) {
+        return LV_FS_RES_NOT_IMP;
+    }
+
+    lv_memzero(req, sizeof(lv_fs_read_req_t));
+    req->file_p = file_p;
+    req->buf = buf;
+    req->pos = pos;
+    req->btr = btr;
+    req->ready_cb = ready_cb;
+    req->user_data = user_data;
+
+    req->job.exec_cb = read_async_exec_cb;
+    req->job.ready_cb = read_async_ready_cb;
+    req->job.user_data = req;
+    lv_worker_add(&req->job);
+
+    return LV_FS_RES_OK;
+}
+
 lv_fs_res_t lv_fs_dir_open(lv_fs_dir_t * rddir_p, const char * path)
 {
     if(path == NULL) return LV_FS_RES_INV_PARAM;
@@ -512,6 +630,24 @@ const char * lv_fs_get_last(const char * path)
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Called in a worker thread. The file is not used by others until the request is ready.
+ */
+static void read_async_exec_cb(lv_worker_job_t * job)
+{
+    lv_fs_read_req_t * req = job->user_data;
+    req->res = lv_fs_seek(req->file_p, req->pos, LV_FS_SEEK_SET);
+    if(req->res == LV_FS_RES_OK) {
+        req->res = lv_fs_read(req->file_p, req->buf, req->btr, &req->br);
+    }
+}
+
+static void read_async_ready_cb(lv_worker_job_t * job)
+{
+    lv_fs_read_req_t * req = job->user_data;
+    req->ready_cb(req);
+}
+
 /**
  * Skip the driver letter and the possible : after the letter
  * @param path path string (E.g. S:/folder/file.txt)
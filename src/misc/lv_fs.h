@@ -17,6 +17,7 @@ extern "C" {
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "lv_worker.h"
 
 /*********************
  *      DEFINES
@@ -90,6 +91,10 @@ typedef struct _lv_fs_drv_t {
     lv_fs_res_t (*seek_cb)(struct _lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence);
     lv_fs_res_t (*tell_cb)(struct _lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p);
 
+    /*Optional: map the whole file to the memory for reading. Return NULL if not possible.*/
+    const void * (*mmap_cb)(struct _lv_fs_drv_t * drv, void * file_p, uint32_t * size_p);
+    lv_fs_res_t (*munmap_cb)(struct _lv_fs_drv_t * drv, void * file_p, const void * addr, uint32_t size);
+
     void * (*dir_open_cb)(struct _lv_fs_drv_t * drv, const char * path);
     lv_fs_res_t (*dir_read_cb)(struct _lv_fs_drv_t * drv, void * rddir_p, char * fn);
     lv_fs_res_t (*dir_close_cb)(struct _lv_fs_drv_t * drv, void * rddir_p);
@@ -108,6 +113,12 @@ typedef struct {
     void * file_d;
     lv_fs_drv_t * drv;
     lv_fs_file_cache_t * cache;
+#if LV_USE_FS_CACHE
+    char * cache_path;          /**< Copy of the path if the file is read through or modifies the block cache*/
+    uint32_t cache_pos;         /**< Read position if the block cache is used*/
+    uint32_t cache_next_block;  /**< The block following the last read one to detect sequential reading*/
+    bool cache_write;           /**< The file is written so its blocks are freed on close*/
+#endif
 } lv_fs_file_t;
 
 typedef struct {
@@ -115,6 +126,26 @@ typedef struct {
     lv_fs_drv_t * drv;
 } lv_fs_dir_t;
 
+struct _lv_fs_read_req_t;
+
+typedef void (*lv_fs_read_cb_t)(struct _lv_fs_read_req_t * req);
+
+/**
+ * Describes an asynchronous read started by `lv_fs_read_async()`.
+ * The memory of the request is managed by its owner and it needs to be valid until `ready_cb` is called.
+ */
+typedef struct _lv_fs_read_req_t {
+    lv_fs_file_t * file_p;      /**< The file to read*/
+    void * buf;                 /**< Store the read bytes here*/
+    uint32_t pos;               /**< Read from this position of the file*/
+    uint32_t btr;               /**< Bytes To Read*/
+    uint32_t br;                /**< Number of the read bytes. Valid in `ready_cb`*/
+    lv_fs_res_t res;            /**< Result of the read. Valid in `ready_cb`*/
+    lv_fs_read_cb_t ready_cb;   /**< Called from `lv_timer_handler()` when the read has finished*/
+    void * user_data;
+    lv_worker_job_t job;        /**< Internal, the job of the worker threads*/
+} lv_fs_read_req_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -208,6 +239,43 @@ lv_fs_res_t lv_fs_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whenc
  */
 lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos);
 
+/**
+ * Map the whole content of a file to the memory, so it can be read without copying it.
+ * The mapping is read-only and it needs to be released by `lv_fs_munmap()` before closing the file.
+ * @param file_p    pointer to a lv_fs_file_t variable
+ * @param addr      store the address of the mapped content here
+ * @param size      store the size of the file (and the mapped content) here
+ * @return          LV_FS_RES_OK, LV_FS_RES_NOT_IMP if the driver doesn't support it,
+ *                  or any error from lv_fs_res_t enum
+ */
+lv_fs_res_t lv_fs_mmap(lv_fs_file_t * file_p, const void ** addr, uint32_t * size);
+
+/**
+ * Release a mapping created by `lv_fs_mmap()`
+ * @param file_p    pointer to a lv_fs_file_t variable
+ * @param addr      the address returned by `lv_fs_mmap()`
+ * @param size      the size returned by `lv_fs_mmap()`
+ * @return          LV_FS_RES_OK or any error from lv_fs_res_t enum
+ */
+lv_fs_res_t lv_fs_munmap(lv_fs_file_t * file_p, const void * addr, uint32_t size);
+
+/**
+ * Read from a file in a worker thread. `ready_cb` is called from `lv_timer_handler()` with the result.
+ * The file must not be used (or closed) until `ready_cb` is called. Use a separately opened file
+ * to read the same file meanwhile. The position of the file after the read is undefined.
+ * @param file_p    pointer to a lv_fs_file_t variable
+ * @param req       pointer to a request. It's initialized by this function.
+ * @param pos       read from this position (from the start of the file)
+ * @param buf       pointer to a buffer where the read bytes are stored
+ * @param btr       Bytes To Read
+ * @param ready_cb  called when the read has finished. `req->res` and `req->br` tell the result.
+ * @param user_data custom data, available as `req->user_data` in `ready_cb`
+ * @return          LV_FS_RES_OK if the read was started (`ready_cb` will be called),
+ *                  or any error from lv_fs_res_t enum
+ */
+lv_fs_res_t lv_fs_read_async(lv_fs_file_t * file_p, lv_fs_read_req_t * req, uint32_t pos, void * buf, uint32_t btr,
+                             lv_fs_read_cb_t ready_cb, void * user_data);
+
 /**
  * Initialize a 'fs_dir_t' variable for directory reading
  * @param rddir_p   pointer to a 'lv_fs_dir_t' variable
@@ -0,0 +1,459 @@
+/**
+ * @file lv_fs_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_fs_cache.h"
+#if LV_USE_FS_CACHE
+
+#include "lv_assert.h"
+#include "lv_mem.h"
+#include "lv_math.h"
+#include "lv_ll.h"
+#include "../osal/lv_os.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define BLOCK_SIZE  LV_FS_CACHE_BLOCK_SIZE
+#define BUCKET_CNT_MIN  16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * A block of a file. The data is stored after it in the same list node.
+ */
+typedef struct _lv_fs_cache_block_t {
+    char * path;            /*The path without the driver letter*/
+    uint32_t path_hash;
+    uint32_t index;         /*Position in the file / BLOCK_SIZE*/
+    uint32_t size;          /*Number of valid bytes. Less than BLOCK_SIZE at the end of the file*/
+    struct _lv_fs_cache_block_t * bucket_next;  /*The next block in the same hash bucket*/
+    char letter;
+    uint8_t loading : 1;    /*Being read by the driver without holding the lock. Only its reader can free it.*/
+    uint8_t invalid : 1;    /*Invalidated while loading, so free it when it's loaded*/
+    uint8_t * data;
+} lv_fs_cache_block_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_fs_cache_block_t * block_find(char letter, const char * path, uint32_t path_hash, uint32_t index);
+static lv_fs_res_t blocks_read(lv_fs_file_t * file_p, uint32_t index, uint32_t cnt);
+static void block_free(lv_fs_cache_block_t * block);
+static lv_fs_cache_block_t ** bucket_get(char letter, uint32_t path_hash, uint32_t index);
+static void bucket_remove(lv_fs_cache_block_t * block);
+static void buckets_resize(void);
+static void evict(uint32_t mem_size);
+static uint32_t path_hash_calc(const char * path);
+static const char * path_skip_letter(const char * path);
+static void cache_lock(void);
+static void cache_unlock(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_ll_t block_ll;            /*The most recently used block is the head*/
+static lv_fs_cache_block_t ** buckets;  /*Hash table of the blocks by letter, path and index*/
+static uint32_t bucket_cnt;         /*Always a power of 2*/
+static uint32_t mem_size_max;
+static lv_fs_cache_stats_t stats;
+
+#if LV_USE_OS != LV_OS_NONE
+    /*Files can be read by the worker threads too*/
+    static lv_mutex_t lock;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void _lv_fs_cache_init(void)
+{
+    _lv_ll_init(&block_ll, sizeof(lv_fs_cache_block_t) + BLOCK_SIZE);
+    mem_size_max = LV_FS_CACHE_DEF_MEM_SIZE;
+    lv_memzero(&stats, sizeof(stats));
+    buckets = NULL;
+    bucket_cnt = 0;
+    buckets_resize();
+
+#if LV_USE_OS != LV_OS_NONE
+    lv_mutex_init(&lock);
+#endif
+}
+
+bool _lv_fs_cache_open(lv_fs_file_t * file_p, const char * path, lv_fs_mode_t mode)
+{
+    file_p->cache_path = NULL;
+    file_p->cache_pos = 0;
+    file_p->cache_next_block = 0;
+    file_p->cache_write = (mode & LV_FS_MODE_WR) ? true : false;
+
+    /*The file will be modified so its blocks become invalid.
+     *They are freed on close too in case they were read meanwhile.*/
+    if(file_p->cache_write) lv_fs_cache_invalidate(path);
+    else if(mem_size_max < BLOCK_SIZE || buckets == NULL) return false;
+
+    /*The path is the key of the blocks so a copy is stored*/
+    file_p->cache_path = lv_malloc(lv_strlen(path) + 1);
+    LV_ASSERT_MALLOC(file_p->cache_path);
+    if(file_p->cache_path == NULL) return false;
+    lv_strcpy(file_p->cache_path, path);
+
+    return !file_p->cache_write;
+}
+
+void _lv_fs_cache_close(lv_fs_file_t * file_p)
+{
+    if(file_p->cache_path && file_p->cache_write) lv_fs_cache_invalidate(file_p->cache_path);
+
+    lv_free(file_p->cache_path);
+    file_p->cache_path = NULL;
+}
+
+lv_fs_res_t _lv_fs_cache_read(lv_fs_file_t * file_p, void * buf, uint32_t btr, uint32_t * br)
+{
+    *br = 0;
+
+    char letter = file_p->cache_path[0];
+    const char * path = path_skip_letter(file_p->cache_path);
+    uint32_t path_hash = path_hash_calc(path);
+    uint8_t * buf_u8 = buf;
+    lv_fs_res_t res = LV_FS_RES_OK;
+
+    cache_lock();
+    while(btr > 0) {
+        uint32_t index = file_p->cache_pos / BLOCK_SIZE;
+        uint32_t ofs = file_p->cache_pos % BLOCK_SIZE;
+
+        lv_fs_cache_block_t * block = block_find(letter, path, path_hash, index);
+        if(block && !block->loading) {
+            stats.hit_cnt++;
+        }
+        else {
+            if(block == NULL) {
+                /*Read the next blocks too if the file is read sequentially.
+                 *Keep at least half of the cache for the other files.*/
+                uint32_t cnt = 1;
+                if(index == file_p->cache_next_block) {
+                    uint32_t cnt_max = LV_MAX(mem_size_max / BLOCK_SIZE / 2, 1);
+                    cnt = LV_MIN(1 + LV_FS_CACHE_READ_AHEAD, cnt_max);
+                }
+
+                res = blocks_read(file_p, index, cnt);
+                if(res != LV_FS_RES_OK) break;
+
+                block = block_find(letter, path, path_hash, index);
+            }
+
+            if(block == NULL || block->loading) {
+                /*An other thread is reading the block or the cache was made smaller meanwhile.
+                 *Read the rest directly.*/
+                cache_unlock();
+                uint32_t br_tmp = 0;
+                res = file_p->drv->seek_cb(file_p->drv, file_p->file_d, file_p->cache_pos, LV_FS_SEEK_SET);
+                if(res == LV_FS_RES_OK) res = file_p->drv->read_cb(file_p->drv, file_p->file_d, buf_u8, btr, &br_tmp);
+                file_p->cache_pos += br_tmp;
+                *br += br_tmp;
+                cache_lock();
+                break;
+            }
+        }
+
+        /*End of the file*/
+        if(ofs >= block->size) break;
+
+        uint32_t len = LV_MIN(btr, block->size - ofs);
+        lv_memcpy(buf_u8, block->data + ofs, len);
+        buf_u8 += len;
+        btr -= len;
+        *br += len;
+        file_p->cache_pos += len;
+        file_p->cache_next_block = index + 1;
+
+        if(block->size < BLOCK_SIZE && ofs + len == block->size) break;
+    }
+    cache_unlock();
+
+    return res;
+}
+
+void lv_fs_cache_set_mem_size(uint32_t mem_size)
+{
+    cache_lock();
+    mem_size_max = mem_size;
+    evict(mem_size_max);
+    buckets_resize();
+    cache_unlock();
+}
+
+void lv_fs_cache_invalidate(const char * path)
+{
+    /*0: the blocks of all drivers*/
+    char letter = 0;
+    if(path) {
+        const char * path_no_letter = path_skip_letter(path);
+        if(path_no_letter != path) letter = path[0];
+        path = path_no_letter;
+    }
+
+    cache_lock();
+    lv_fs_cache_block_t * block = _lv_ll_get_head(&block_ll);
+    while(block) {
+        lv_fs_cache_block_t * next = _lv_ll_get_next(&block_ll, block);
+        if(path == NULL || ((letter == 0 || block->letter == letter) && strcmp(block->path, path) == 0)) {
+            if(block->loading) block->invalid = 1;
+            else block_free(block);
+        }
+        block = next;
+    }
+    cache_unlock();
+}
+
+void lv_fs_cache_get_stats(lv_fs_cache_stats_t * stats_out)
+{
+    cache_lock();
+    lv_memcpy(stats_out, &stats, sizeof(stats));
+    cache_unlock();
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Find a block and move it to the front of the LRU list
+ */
+static lv_fs_cache_block_t * block_find(char letter, const char * path, uint32_t path_hash, uint32_t index)
+{
+    lv_fs_cache_block_t * block = *bucket_get(letter, path_hash, index);
+    while(block) {
+        if(block->index == index && block->path_hash == path_hash && block->letter == letter &&
+           strcmp(block->path, path) == 0) {
+            _lv_ll_move_before(&block_ll, block, _lv_ll_get_head(&block_ll));
+            return block;
+        }
+        block = block->bucket_next;
+    }
+
+    return NULL;
+}
+
+/**
+ * Read `cnt` blocks starting from `index` with one seek. Stop at an already cached block
+ * or at the end of the file. The first block is counted as a miss, the others as read ahead.
+ * Called with the lock held. The blocks are added as loading and the lock is released
+ * while the driver reads them, so the other threads can use the cache meanwhile.
+ */
+static lv_fs_res_t blocks_read(lv_fs_file_t * file_p, uint32_t index, uint32_t cnt)
+{
+    char letter = file_p->cache_path[0];
+    const char * path = path_skip_letter(file_p->cache_path);
+    uint32_t path_hash = path_hash_calc(path);
+    uint32_t mem_size = sizeof(lv_fs_cache_block_t) + BLOCK_SIZE;
+
+    lv_fs_cache_block_t * blocks[1 + LV_FS_CACHE_READ_AHEAD];
+    uint32_t block_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < cnt && i < 1 + LV_FS_CACHE_READ_AHEAD; i++) {
+        if(i > 0 && block_find(letter, path, path_hash, index + i)) break;
+        if(mem_size > mem_size_max) break;
+        evict(mem_size_max - mem_size);
+        /*The rest of the cache is being loaded by other threads*/
+        if(stats.mem_size + mem_size > mem_size_max) break;
+
+        /*Read ahead blocks are less recently used than the needed one, so add them after the head*/
+        lv_fs_cache_block_t * block;
+        lv_fs_cache_block_t * head = _lv_ll_get_head(&block_ll);
+        lv_fs_cache_block_t * second = head ? _lv_ll_get_next(&block_ll, head) : NULL;
+        if(i == 0 || head == NULL) block = _lv_ll_ins_head(&block_ll);
+        else if(second) block = _lv_ll_ins_prev(&block_ll, second);
+        else block = _lv_ll_ins_tail(&block_ll);
+        LV_ASSERT_MALLOC(block);
+        if(block == NULL) {
+            LV_LOG_WARN("out of memory");
+            break;
+        }
+
+        block->path = lv_malloc(lv_strlen(path) + 1);
+        LV_ASSERT_MALLOC(block->path);
+        if(block->path == NULL) {
+            _lv_ll_remove(&block_ll, block);
+            lv_free(block);
+            break;
+        }
+        lv_strcpy(block->path, path);
+        block->path_hash = path_hash;
+        block->letter = letter;
+        block->index = index + i;
+        block->size = 0;
+        block->loading = 1;
+        block->invalid = 0;
+        block->data = (uint8_t *)(block + 1);
+
+        lv_fs_cache_block_t ** bucket = bucket_get(letter, path_hash, block->index);
+        block->bucket_next = *bucket;
+        *bucket = block;
+
+        stats.entry_cnt++;
+        stats.mem_size += mem_size;
+        blocks[block_cnt] = block;
+        block_cnt++;
+    }
+
+    if(block_cnt == 0) return LV_FS_RES_OK;
+
+    /*Only this thread uses `file_p` and the loading blocks can't be freed by the others*/
+    cache_unlock();
+    uint32_t read_cnt = 0;
+    lv_fs_res_t res = file_p->drv->seek_cb(file_p->drv, file_p->file_d, index * BLOCK_SIZE, LV_FS_SEEK_SET);
+    if(res == LV_FS_RES_OK) {
+        for(i = 0; i < block_cnt; i++) {
+            uint32_t br = 0;
+            res = file_p->drv->read_cb(file_p->drv, file_p->file_d, blocks[i]->data, BLOCK_SIZE, &br);
+            if(res != LV_FS_RES_OK || (br == 0 && i > 0)) break;
+            blocks[i]->size = br;
+            read_cnt++;
+            if(br < BLOCK_SIZE) break;
+        }
+    }
+    cache_lock();
+
+    for(i = 0; i < block_cnt; i++) {
+        lv_fs_cache_block_t * block = blocks[i];
+        block->loading = 0;
+        if(i >= read_cnt || block->invalid) {
+            block_free(block);
+        }
+        else if(i == 0) stats.miss_cnt++;
+        else stats.read_ahead_cnt++;
+    }
+
+    /*The cache might have been made smaller meanwhile*/
+    evict(mem_size_max);
+
+    /*Only the error of the needed block matters*/
+    return read_cnt > 0 ? LV_FS_RES_OK : res;
+}
+
+static void block_free(lv_fs_cache_block_t * block)
+{
+    stats.entry_cnt--;
+    stats.mem_size -= sizeof(lv_fs_cache_block_t) + BLOCK_SIZE;
+
+    bucket_remove(block);
+    lv_free(block->path);
+    _lv_ll_remove(&block_ll, block);
+    lv_free(block);
+}
+
+/**
+ * Get the head of the hash bucket in which a block is stored
+ */
+static lv_fs_cache_block_t ** bucket_get(char letter, uint32_t path_hash, uint32_t index)
+{
+    /*The consecutive blocks of a file go to different buckets*/
+    uint32_t hash = (path_hash ^ (uint8_t)letter) + index * 2654435761u;
+    hash ^= hash >> 16;
+    return &buckets[hash & (bucket_cnt - 1)];
+}
+
+static void bucket_remove(lv_fs_cache_block_t * block)
+{
+    lv_fs_cache_block_t ** link = bucket_get(block->letter, block->path_hash, block->index);
+    while(*link != block) link = &(*link)->bucket_next;
+    *link = block->bucket_next;
+}
+
+/**
+ * Make the hash table about as large as the number of blocks fitting into the cache
+ * and add the blocks to the new buckets
+ */
+static void buckets_resize(void)
+{
+    uint32_t cnt = BUCKET_CNT_MIN;
+    while(cnt < mem_size_max / BLOCK_SIZE) cnt <<= 1;
+    if(cnt == bucket_cnt) return;
+
+    lv_fs_cache_block_t ** buckets_new = lv_malloc(cnt * sizeof(lv_fs_cache_block_t *));
+    LV_ASSERT_MALLOC(buckets_new);
+    if(buckets_new == NULL) {
+        /*Keep the old buckets, only the chains are longer*/
+        LV_LOG_WARN("out of memory");
+        return;
+    }
+
+    lv_memzero(buckets_new, cnt * sizeof(lv_fs_cache_block_t *));
+    lv_free(buckets);
+    buckets = buckets_new;
+    bucket_cnt = cnt;
+
+    lv_fs_cache_block_t * block;
+    _LV_LL_READ(&block_ll, block) {
+        lv_fs_cache_block_t ** bucket = bucket_get(block->letter, block->path_hash, block->index);
+        block->bucket_next = *bucket;
+        *bucket = block;
+    }
+}
+
+/**
+ * Free the least recently used blocks until the used memory is not larger than `mem_size`.
+ * The blocks being loaded are skipped.
+ */
+static void evict(uint32_t mem_size)
+{
+    lv_fs_cache_block_t * block = _lv_ll_get_tail(&block_ll);
+    while(block && stats.mem_size > mem_size) {
+        lv_fs_cache_block_t * prev = _lv_ll_get_prev(&block_ll, block);
+        /*The loading blocks are freed by their readers*/
+        if(!block->loading) block_free(block);
+        block = prev;
+    }
+}
+
+/**
+ * FNV-1a hash to compare the paths quickly
+ */
+static uint32_t path_hash_calc(const char * path)
+{
+    uint32_t hash = 2166136261u;
+    while(*path) {
+        hash ^= (uint8_t) * path;
+        hash *= 16777619u;
+        path++;
+    }
+
+    return hash;
+}
+
+static const char * path_skip_letter(const char * path)
+{
+    if(path[0] != '\0' && path[1] == ':') return path + 2;
+    return path;
+}
+
+static void cache_lock(void)
+{
+#if LV_USE_OS != LV_OS_NONE
+    lv_mutex_lock(&lock);
+#endif
+}
+
+static void cache_unlock(void)
+{
+#if LV_USE_OS != LV_OS_NONE
+    lv_mutex_unlock(&lock);
+#endif
+}
+
+#endif /*LV_USE_FS_CACHE*/
@@ -0,0 +1,108 @@
+/**
+ * @file lv_fs_cache.h
+ * Keep the recently read blocks of the files in the memory.
+ * The cache is shared by all opened files and drivers, so the blocks remain available
+ * after closing a file and opening it again.
+ */
+
+#ifndef LV_FS_CACHE_H
+#define LV_FS_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#if LV_USE_FS_CACHE
+
+#include "lv_fs.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Statistics of the block cache
+ */
+typedef struct {
+    uint32_t hit_cnt;           /**< Number of blocks found in the cache*/
+    uint32_t miss_cnt;          /**< Number of blocks read from the driver when they were needed*/
+    uint32_t read_ahead_cnt;    /**< Number of blocks read in advance as the file was read sequentially*/
+    uint32_t entry_cnt;         /**< Number of cached blocks*/
+    uint32_t mem_size;          /**< Memory used by the cached blocks in bytes*/
+} lv_fs_cache_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the block cache
+ */
+void _lv_fs_cache_init(void);
+
+/**
+ * Prepare a file for reading through the cache. Called by `lv_fs_open()`.
+ * If the file is opened for writing its cached blocks are freed on open and close.
+ * @param file_p    pointer to a just opened file
+ * @param path      path to the file beginning with the driver letter
+ * @param mode      the mode in which the file was opened
+ * @return          true: the file is read through the cache
+ */
+bool _lv_fs_cache_open(lv_fs_file_t * file_p, const char * path, lv_fs_mode_t mode);
+
+/**
+ * Release the data of a file opened by `_lv_fs_cache_open()`. Called by `lv_fs_close()`.
+ * @param file_p    pointer to a file
+ */
+void _lv_fs_cache_close(lv_fs_file_t * file_p);
+
+/**
+ * Read from a file through the cache, starting at `file_p->cache_pos`. Called by `lv_fs_read()`.
+ * @param file_p    pointer to a file for which `_lv_fs_cache_open()` returned true
+ * @param buf       pointer to a buffer where the read bytes are stored
+ * @param btr       Bytes To Read
+ * @param br        store the number of the read bytes here
+ * @return          LV_FS_RES_OK or any error from lv_fs_res_t enum
+ */
+lv_fs_res_t _lv_fs_cache_read(lv_fs_file_t * file_p, void * buf, uint32_t btr, uint32_t * br);
+
+/**
+ * Set the maximal memory used by the blocks.
+ * The least recently used blocks are freed if there is not enough space.
+ * @param mem_size  the maximal memory in bytes, 0 to disable caching
+ */
+void lv_fs_cache_set_mem_size(uint32_t mem_size);
+
+/**
+ * Free the cached blocks of a file, e.g. if it was modified without `lv_fs_write()`.
+ * @param path      path to the file with the driver letter, or without it to free the file's blocks of all drivers,
+ *                  or NULL to free all blocks
+ */
+void lv_fs_cache_invalidate(const char * path);
+
+/**
+ * Get the statistics of the block cache
+ * @param stats     store the statistics here
+ */
+void lv_fs_cache_get_stats(lv_fs_cache_stats_t * stats);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_FS_CACHE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_FS_CACHE_H*/
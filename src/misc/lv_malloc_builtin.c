@@ -13,6 +13,7 @@
 #include "lv_log.h"
 #include "lv_ll.h"
 #include "lv_math.h"
+#include "../osal/lv_os.h"
 
 #ifdef LV_MEM_POOL_INCLUDE
     #include LV_MEM_POOL_INCLUDE
@@ -50,6 +51,7 @@ static lv_tlsf_t tlsf;
 static uint32_t cur_used;
 static uint32_t max_used;
 static lv_ll_t pool_ll;
+static lv_mutex_t lock;    /*Worker threads can allocate memory too*/
 
 /**********************
  *      MACROS
@@ -73,6 +75,8 @@ static lv_ll_t pool_ll;
  */
 void lv_mem_init_builtin(void)
 {
+    lv_mutex_init(&lock);
+
 #if LV_MEM_ADR == 0
 #ifdef LV_MEM_POOL_ALLOC
     tlsf = lv_tlsf_create_with_pool((void *)LV_MEM_POOL_ALLOC(LV_MEM_SIZE), LV_MEM_SIZE);
@@ -98,6 +102,7 @@ void lv_mem_init_builtin(void)
 
 void lv_mem_deinit_builtin(void)
 {
+    lv_mutex_delete(&lock);
     _lv_ll_clear(&pool_ll);
     lv_tlsf_destroy(tlsf);
     lv_mem_init_builtin();
@@ -105,7 +110,9 @@ void lv_mem_deinit_builtin(void)
 
 lv_mem_builtin_pool_t lv_mem_builtin_add_pool(void * mem, size_t bytes)
 {
+    lv_mutex_lock(&lock);
     lv_mem_builtin_pool_t new_pool = lv_tlsf_add_pool(tlsf, mem, bytes);
+    lv_mutex_unlock(&lock);
     if(!new_pool) {
         LV_LOG_WARN("failed to add memory pool, address: %p, size: %zu", mem, bytes);
         return NULL;
@@ -125,7 +132,9 @@ void lv_mem_builtin_remove_pool(lv_mem_builtin_pool_t pool)
         if(*pool_p == pool) {
             _lv_ll_remove(&pool_ll, pool_p);
             lv_free(pool_p);
+            lv_mutex_lock(&lock);
             lv_tlsf_remove_pool(tlsf, pool);
+            lv_mutex_unlock(&lock);
             return;
         }
     }
@@ -159,14 +168,20 @@ void lv_mem_monitor_builtin(lv_mem_monitor_t * mon_p)
 
 void * lv_malloc_builtin(size_t size)
 {
+    lv_mutex_lock(&lock);
     cur_used += size;
     max_used = LV_MAX(cur_used, max_used);
-    return lv_tlsf_malloc(tlsf, size);
+    void * p = lv_tlsf_malloc(tlsf, size);
+    lv_mutex_unlock(&lock);
+    return p;
 }
 
 void * lv_realloc_builtin(void * p, size_t new_size)
 {
-    return lv_tlsf_realloc(tlsf, p, new_size);
+    lv_mutex_lock(&lock);
+    void * new_p = lv_tlsf_realloc(tlsf, p, new_size);
+    lv_mutex_unlock(&lock);
+    return new_p;
 }
 
 void lv_free_builtin(void * p)
@@ -174,9 +189,11 @@ void lv_free_builtin(void * p)
 #if LV_MEM_ADD_JUNK
     lv_memset(p, 0xbb, lv_tlsf_block_size(data));
 #endif
+    lv_mutex_lock(&lock);
     size_t size = lv_tlsf_free(tlsf, p);
     if(cur_used > size) cur_used -= size;
     else cur_used = 0;
+    lv_mutex_unlock(&lock);
 }
 
 lv_res_t lv_mem_test_builtin(void)
@@ -0,0 +1,357 @@
+/**
+ * @file lv_worker.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_worker.h"
+#include "lv_timer.h"
+#include "lv_assert.h"
+#include "../osal/lv_os.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Check the finished jobs this often while there are pending jobs [ms]*/
+#define READY_CHECK_PERIOD  5
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool worker_init(void);
+static void ready_timer_cb(lv_timer_t * t);
+static void queue_add(lv_worker_job_t ** head, lv_worker_job_t ** tail, lv_worker_job_t * job);
+static bool queue_remove(lv_worker_job_t ** head, lv_worker_job_t ** tail, lv_worker_job_t * job);
+static void drain(void);
+#if LV_USE_OS != LV_OS_NONE
+    static void worker_thread_cb(void * user_data);
+    static bool threads_start(void);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_timer_t * ready_timer;
+static uint32_t pending_cnt;
+static bool deinit_in_progress;
+
+/*Protected by `lock`. `todo` is processed by the workers, `done` by `ready_timer`*/
+static lv_mutex_t lock;
+static lv_worker_job_t * todo_head;
+static lv_worker_job_t * todo_tail;
+static lv_worker_job_t * done_head;
+static lv_worker_job_t * done_tail;
+
+#if LV_USE_OS != LV_OS_NONE
+    static lv_thread_t threads[LV_WORKER_THREAD_CNT];
+    static lv_thread_sync_t sync;
+    static lv_thread_sync_t done_sync;      /*Signaled when a job is finished*/
+    static uint32_t thread_cnt;
+    static bool threads_failed;
+    static volatile bool exiting;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void _lv_worker_deinit(void)
+{
+    if(ready_timer == NULL) return;
+
+#if LV_USE_OS != LV_OS_NONE
+    if(thread_cnt) {
+        lv_mutex_lock(&lock);
+        exiting = true;
+        lv_mutex_unlock(&lock);
+
+        /*A thread wakes up the next one when it exits*/
+        lv_thread_sync_signal(&sync);
+        uint32_t i;
+        for(i = 0; i < thread_cnt; i++) {
+            lv_thread_delete(&threads[i]);
+        }
+        lv_thread_sync_delete(&sync);
+        lv_thread_sync_delete(&done_sync);
+        thread_cnt = 0;
+        exiting = false;
+    }
+    threads_failed = false;
+#endif
+
+    /*The threads are stopped, so the queues can be used without locking*/
+    drain();
+
+    lv_mutex_delete(&lock);
+    lv_timer_del(ready_timer);
+    ready_timer = NULL;
+    todo_head = NULL;
+    todo_tail = NULL;
+    done_head = NULL;
+    done_tail = NULL;
+    pending_cnt = 0;
+}
+
+void lv_worker_add(lv_worker_job_t * job)
+{
+    LV_ASSERT_NULL(job);
+    LV_ASSERT_NULL(job->exec_cb);
+    LV_ASSERT_NULL(job->ready_cb);
+
+    if(!worker_init()) return;
+
+    job->next = NULL;
+    pending_cnt++;
+    lv_timer_resume(ready_timer);
+
+    /*Added by a `ready_cb` called from `_lv_worker_deinit()`. Let `drain()` handle it.*/
+    if(deinit_in_progress) {
+        queue_add(&todo_head, &todo_tail, job);
+        return;
+    }
+
+    if(!lv_worker_is_async()) {
+        job->exec_cb(job);
+        queue_add(&done_head, &done_tail, job);
+        return;
+    }
+
+#if LV_USE_OS != LV_OS_NONE
+    lv_mutex_lock(&lock);
+    queue_add(&todo_head, &todo_tail, job);
+    lv_mutex_unlock(&lock);
+    lv_thread_sync_signal(&sync);
+#endif
+}
+
+void lv_worker_finish(lv_worker_job_t * job)
+{
+    LV_ASSERT_NULL(job);
+
+    lv_mutex_lock(&lock);
+    bool not_started = queue_remove(&todo_head, &todo_tail, job);
+    lv_mutex_unlock(&lock);
+
+    if(not_started) {
+        job->exec_cb(job);
+    }
+    else {
+        /*It's finished or being executed by a worker thread*/
+        while(1) {
+            lv_mutex_lock(&lock);
+            bool done = queue_remove(&done_head, &done_tail, job);
+            lv_mutex_unlock(&lock);
+            if(done) break;
+#if LV_USE_OS != LV_OS_NONE
+            lv_thread_sync_wait(&done_sync);
+#endif
+        }
+    }
+
+    pending_cnt--;
+    job->ready_cb(job);
+}
+
+uint32_t lv_worker_get_pending_cnt(void)
+{
+    return pending_cnt;
+}
+
+bool lv_worker_is_async(void)
+{
+#if LV_USE_OS != LV_OS_NONE
+    if(!worker_init()) return false;
+    if(thread_cnt == 0 && !threads_failed) threads_failed = !threads_start();
+    return thread_cnt > 0;
+#else
+    return false;
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Create the timer and the lock on first use
+ * @return false if out of memory
+ */
+static bool worker_init(void)
+{
+    if(ready_timer) return true;
+
+    ready_timer = lv_timer_create(ready_timer_cb, READY_CHECK_PERIOD, NULL);
+    LV_ASSERT_MALLOC(ready_timer);
+    if(ready_timer == NULL) return false;
+
+    lv_timer_pause(ready_timer);
+    lv_mutex_init(&lock);
+    return true;
+}
+
+/**
+ * Call `ready_cb` of the finished jobs in the LVGL thread
+ */
+static void ready_timer_cb(lv_timer_t * t)
+{
+    lv_mutex_lock(&lock);
+    lv_worker_job_t * job = done_head;
+    done_head = NULL;
+    done_tail = NULL;
+    lv_mutex_unlock(&lock);
+
+    while(job) {
+        /*`ready_cb` might free the job*/
+        lv_worker_job_t * next = job->next;
+        pending_cnt--;
+        job->ready_cb(job);
+        job = next;
+    }
+
+    if(pending_cnt == 0) lv_timer_pause(t);
+}
+
+static void queue_add(lv_worker_job_t ** head, lv_worker_job_t ** tail, lv_worker_job_t * job)
+{
+    if(*tail) (*tail)->next = job;
+    else *head = job;
+    *tail = job;
+}
+
+/**
+ * Remove a job from a queue
+ * @return true: the job was in the queue
+ */
+static bool queue_remove(lv_worker_job_t ** head, lv_worker_job_t ** tail, lv_worker_job_t * job)
+{
+    lv_worker_job_t * prev = NULL;
+    lv_worker_job_t * j = *head;
+    while(j && j != job) {
+        prev = j;
+        j = j->next;
+    }
+
+    if(j == NULL) return false;
+
+    if(prev) prev->next = job->next;
+    else *head = job->next;
+    if(*tail == job) *tail = prev;
+    job->next = NULL;
+    return true;
+}
+
+/**
+ * Call `ready_cb` of the finished jobs and cancel or finish the not started ones
+ * to let their owners free them. The worker threads need to be stopped.
+ */
+static void drain(void)
+{
+    deinit_in_progress = true;
+
+    /*`ready_cb` can add new jobs (e.g. to decode the next frame), so repeat until the queues are empty*/
+    while(todo_head || done_head) {
+        lv_worker_job_t * job = done_head;
+        done_head = NULL;
+        done_tail = NULL;
+        while(job) {
+            lv_worker_job_t * next = job->next;
+            job->ready_cb(job);
+            job = next;
+        }
+
+        job = todo_head;
+        todo_head = NULL;
+        todo_tail = NULL;
+        while(job) {
+            lv_worker_job_t * next = job->next;
+            if(job->cancel_cb) {
+                job->cancel_cb(job);
+            }
+            else {
+                job->exec_cb(job);
+                job->ready_cb(job);
+            }
+            job = next;
+        }
+    }
+
+    deinit_in_progress = false;
+}
+
+#if LV_USE_OS != LV_OS_NONE
+
+static bool threads_start(void)
+{
+    if(lv_thread_sync_init(&sync) != LV_RES_OK) return false;
+    if(lv_thread_sync_init(&done_sync) != LV_RES_OK) {
+        lv_thread_sync_delete(&sync);
+        return false;
+    }
+
+    uint32_t i;
+    for(i = 0; i < LV_WORKER_THREAD_CNT; i++) {
+        if(lv_thread_init(&threads[i], LV_THREAD_PRIO_LOW, worker_thread_cb, LV_WORKER_STACK_SIZE, NULL) != LV_RES_OK) break;
+        thread_cnt++;
+    }
+
+    if(thread_cnt == 0) {
+        LV_LOG_WARN("couldn't start the worker threads, the jobs will run in the LVGL thread");
+        lv_thread_sync_delete(&sync);
+        lv_thread_sync_delete(&done_sync);
+        return false;
+    }
+
+    return true;
+}
+
+static void worker_thread_cb(void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    while(1) {
+        lv_mutex_lock(&lock);
+        bool quit = exiting;
+        lv_worker_job_t * job = todo_head;
+        if(job && !quit) {
+            todo_head = job->next;
+            if(todo_head == NULL) todo_tail = NULL;
+        }
+        bool more = todo_head != NULL;
+        lv_mutex_unlock(&lock);
+
+        if(quit) {
+            /*Let the other threads exit too*/
+            lv_thread_sync_signal(&sync);
+            break;
+        }
+
+        if(job == NULL) {
+            lv_thread_sync_wait(&sync);
+            continue;
+        }
+
+        /*Wake up an other thread for the remaining jobs*/
+        if(more) lv_thread_sync_signal(&sync);
+
+        job->next = NULL;
+        job->exec_cb(job);
+
+        lv_mutex_lock(&lock);
+        queue_add(&done_head, &done_tail, job);
+        lv_mutex_unlock(&lock);
+        lv_thread_sync_signal(&done_sync);
+    }
+}
+
+#endif /*LV_USE_OS != LV_OS_NONE*/
@@ -0,0 +1,101 @@
+/**
+ * @file lv_worker.h
+ * Run slow jobs (e.g. decoding images) in background threads and
+ * get notified about the result in the LVGL thread.
+ */
+
+#ifndef LV_WORKER_H
+#define LV_WORKER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include <stdbool.h>
+#include "lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct _lv_worker_job_t;
+
+typedef void (*lv_worker_job_cb_t)(struct _lv_worker_job_t * job);
+
+/**
+ * Describes a job. The memory of the job is managed by its owner and
+ * it needs to be valid until `ready_cb` is called.
+ */
+typedef struct _lv_worker_job_t {
+    /** Do the work. Called in a worker thread, so it must not call LVGL functions
+     * which are not thread safe (e.g. it must not modify widgets)*/
+    lv_worker_job_cb_t exec_cb;
+
+    /** Called from `lv_timer_handler()` when `exec_cb` has finished. The job can be freed here.*/
+    lv_worker_job_cb_t ready_cb;
+
+    /** Optional. Called by `_lv_worker_deinit()` instead of `exec_cb` and `ready_cb` if the job
+     * hasn't been started. The job can be freed here. If not set the job is executed in the LVGL thread.*/
+    lv_worker_job_cb_t cancel_cb;
+
+    void * user_data;
+
+    struct _lv_worker_job_t * next;     /**< Internal, used to queue the jobs*/
+} lv_worker_job_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Stop the worker threads and call `ready_cb` of the finished jobs.
+ * The not started jobs are cancelled with `cancel_cb` or executed and finished in the calling thread.
+ */
+void _lv_worker_deinit(void);
+
+/**
+ * Add a job to the queue of the worker threads. The threads are started on the first call.
+ * If there is no operating system (`LV_USE_OS == LV_OS_NONE`) `exec_cb` is called immediately.
+ * In both cases `ready_cb` is called later from `lv_timer_handler()`.
+ * Should be called only from the LVGL thread.
+ * @param job       pointer to an initialized job. `exec_cb` and `ready_cb` are mandatory.
+ */
+void lv_worker_add(lv_worker_job_t * job);
+
+/**
+ * Finish a job now if its result is needed immediately: execute it in the calling thread
+ * if it hasn't been started yet, else wait for the worker thread. `ready_cb` is called before returning.
+ * Should be called only from the LVGL thread.
+ * @param job       pointer to a job added by `lv_worker_add()` whose `ready_cb` hasn't been called yet
+ */
+void lv_worker_finish(lv_worker_job_t * job);
+
+/**
+ * Get the number of jobs whose `ready_cb` hasn't been called yet.
+ * @return          number of the added but not ready jobs
+ */
+uint32_t lv_worker_get_pending_cnt(void);
+
+/**
+ * Tell if the jobs really run in the background, i.e. there is an operating system.
+ * @return          true: `exec_cb` is called in a worker thread; false: it's called by `lv_worker_add()`
+ */
+bool lv_worker_is_async(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_WORKER_H*/
@@ -0,0 +1,129 @@
+/**
+ * @file lv_os.h
+ *
+ */
+
+#ifndef LV_OS_H
+#define LV_OS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "../misc/lv_types.h"
+
+#if LV_USE_OS == LV_OS_NONE
+#include "lv_os_none.h"
+#elif LV_USE_OS == LV_OS_PTHREAD
+#include "lv_pthread.h"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    LV_THREAD_PRIO_LOWEST,
+    LV_THREAD_PRIO_LOW,
+    LV_THREAD_PRIO_MID,
+    LV_THREAD_PRIO_HIGH,
+    LV_THREAD_PRIO_HIGHEST,
+} lv_thread_prio_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create a new thread
+ * @param thread        a variable in which the thread will be stored
+ * @param prio          priority of the thread
+ * @param callback      function of the thread
+ * @param stack_size    stack size in bytes
+ * @param user_data     arbitrary data, will be available in the callback
+ * @return              LV_RES_OK: success; LV_RES_INV: failure
+ */
+lv_res_t lv_thread_init(lv_thread_t * thread, lv_thread_prio_t prio, void (*callback)(void *), size_t stack_size,
+                        void * user_data);
+
+/**
+ * Wait until a thread returns from its callback and free its resources
+ * @param thread        pointer to a thread
+ * @return              LV_RES_OK: success; LV_RES_INV: failure
+ */
+lv_res_t lv_thread_delete(lv_thread_t * thread);
+
+/**
+ * Create a mutex
+ * @param mutex         pointer to a mutex variable
+ * @return              LV_RES_OK: success; LV_RES_INV: failure
+ */
+lv_res_t lv_mutex_init(lv_mutex_t * mutex);
+
+/**
+ * Lock a mutex
+ * @param mutex         pointer to a mutex
+ * @return              LV_RES_OK: success; LV_RES_INV: failure
+ */
+lv_res_t lv_mutex_lock(lv_mutex_t * mutex);
+
+/**
+ * Unlock a mutex
+ * @param mutex         pointer to a mutex
+ * @return              LV_RES_OK: success; LV_RES_INV: failure
+ */
+lv_res_t lv_mutex_unlock(lv_mutex_t * mutex);
+
+/**
+ * Delete a mutex
+ * @param mutex         pointer to a mutex
+ * @return              LV_RES_OK: success; LV_RES_INV: failure
+ */
+lv_res_t lv_mutex_delete(lv_mutex_t * mutex);
+
+/**
+ * Create a thread synchronization object. It works like a binary semaphore:
+ * a signal is remembered until a wait consumes it.
+ * @param sync          pointer to a sync variable
+ * @return              LV_RES_OK: success; LV_RES_INV: failure
+ */
+lv_res_t lv_thread_sync_init(lv_thread_sync_t * sync);
+
+/**
+ * Wait for a signal on a sync object
+ * @param sync          pointer to a sync object
+ * @return              LV_RES_OK: success; LV_RES_INV: failure
+ */
+lv_res_t lv_thread_sync_wait(lv_thread_sync_t * sync);
+
+/**
+ * Send a wake-up signal to a sync object
+ * @param sync          pointer to a sync object
+ * @return              LV_RES_OK: success; LV_RES_INV: failure
+ */
+lv_res_t lv_thread_sync_signal(lv_thread_sync_t * sync);
+
+/**
+ * Delete a sync object
+ * @param sync          pointer to a sync object
+ * @return              LV_RES_OK: success; LV_RES_INV: failure
+ */
+lv_res_t lv_thread_sync_delete(lv_thread_sync_t * sync);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_OS_H*/
@@ -676,6 +676,10 @@ static void lv_canvas_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj
 
     lv_img_set_src(obj, &canvas->dsc);
 
+    /*The buffer can be changed any time without invalidating the image cache,
+     *so a transformed version of it could be outdated*/
+    lv_img_set_transform_cache(obj, false);
+
     LV_TRACE_OBJ_CREATE("finished");
 }
 
@@ -50,6 +50,7 @@ typedef struct {
     uint8_t cf : 5;        /*Color format from `lv_color_format_t`*/
     uint8_t antialias : 1; /*Apply anti-aliasing in transformations (rotate, zoom)*/
     uint8_t obj_size_mode: 2; /*Image size mode when image size and object size is different.*/
+    uint8_t transform_cache : 1; /*Keep the rotated/zoomed image in the transform cache*/
 } lv_img_t;
 
 extern const lv_obj_class_t lv_img_class;
@@ -155,6 +156,16 @@ void lv_img_set_zoom(lv_obj_t * obj, uint16_t zoom);
  */
 void lv_img_set_antialias(lv_obj_t * obj, bool antialias);
 
+/**
+ * Enable/disable keeping the rotated/zoomed image in the transform cache.
+ * It's enabled by default but it's worth disabling for images whose angle or zoom changes
+ * continuously (e.g. animated), as the cached versions would never be used again.
+ * Has effect only if `LV_USE_IMG_TRANSFORM_CACHE` is enabled.
+ * @param obj       pointer to an image object
+ * @param en        true: use the transform cache; false: transform the image in every redraw
+ */
+void lv_img_set_transform_cache(lv_obj_t * obj, bool en);
+
 /**
  * Set the image object size mode.
  *
@@ -215,6 +226,13 @@ uint16_t lv_img_get_zoom(lv_obj_t * obj);
  */
 bool lv_img_get_antialias(lv_obj_t * obj);
 
+/**
+ * Get whether the rotated/zoomed image is kept in the transform cache
+ * @param obj       pointer to an image object
+ * @return          true: the transform cache is used; false: not used
+ */
+bool lv_img_get_transform_cache(lv_obj_t * obj);
+
 /**
  * Get the size mode of the image
  * @param obj       pointer to an image object
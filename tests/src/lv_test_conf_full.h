@@ -2,6 +2,10 @@
 #define LV_USE_DRAW_MASKS       1
 #define LV_SHADOW_CACHE_SIZE    10240
 #define LV_IMG_CACHE_DEF_SIZE   32
+#define LV_USE_IMG_MIPMAP       1
+#define LV_USE_IMG_TRANSFORM_CACHE  1
+#define LV_USE_IMG_TILE_CACHE   1
+#define LV_USE_OS               LV_OS_PTHREAD
 #define LV_USE_LOG              1
 #define LV_LOG_LEVEL            LV_LOG_LEVEL_TRACE
 #define LV_LOG_PRINTF           1
@@ -53,6 +57,11 @@
 #define LV_USE_FLEX 1
 #define LV_USE_GRID 1
 
+#define LV_USE_FS_CACHE     1
+#define LV_FS_CACHE_BLOCK_SIZE  64
+#define LV_FS_CACHE_DEF_MEM_SIZE 0      /*Enabled only in test_fs_cache to keep testing the per-file cache*/
+#define LV_FS_CACHE_READ_AHEAD  2
+
 #define LV_USE_FS_STDIO     1
 #define LV_FS_STDIO_LETTER  'A'
 #define LV_FS_STDIO_CACHE_SIZE 512
@@ -62,6 +71,8 @@
 #define LV_USE_PNG      1
 #define LV_USE_BMP      1
 #define LV_USE_SJPG     1
+#define LV_SJPG_FRAG_CACHE_CNT  4
+#define LV_SJPG_PREFETCH_CNT    2
 #define LV_USE_GIF      1
 #define LV_USE_QRCODE   1
 #define LV_USE_BARCODE  1
@@ -71,6 +82,14 @@
 #define LV_USE_MSG          1
 #define LV_USE_FILE_EXPLORER    1
 #define LV_USE_TINY_TTF 1
+#ifdef LV_TEST_USE_FREETYPE
+#define LV_USE_FREETYPE 1
+#endif
+#ifdef LV_TEST_USE_FFMPEG
+#define LV_USE_FFMPEG   1
+#endif
+#define LV_USE_FONT_SDF 1
+#define LV_FONT_FALLBACK_CACHE_SIZE 64
 #define LV_USE_SYSMON   1
 
 #define LV_BUILD_EXAMPLES       1
@@ -10,6 +10,7 @@ typedef void (* lv_free_stub_cb)(void * p);
 void lv_test_malloc_init(void);
 void lv_test_malloc_set_cb(lv_malloc_stub_cb stub_malloc);
 void * lv_test_malloc(size_t s);
+void * lv_test_malloc_normal(size_t size);
 
 void lv_test_realloc_set_cb(lv_realloc_stub_cb stub_realloc);
 void * lv_test_realloc(void * p, size_t new_size);
@@ -0,0 +1,72 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+/*ASCII only, so the built-in font has every letter too*/
+#define TXT     "The quick brown fox jumps over the lazy dog. 0123456789"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+/**
+ * Get the bitmap of every letter of `txt` `cnt` times. The glyph descriptors are not
+ * cached so they are not measured.
+ * @return the elapsed CPU time in ms
+ */
+static uint32_t glyph_lookup_time(const lv_font_t * font, const char * txt, uint32_t cnt)
+{
+    uint32_t found_cnt = 0;
+    clock_t start = clock();
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        uint32_t ofs = 0;
+        uint32_t letter;
+        while((letter = _lv_txt_encoded_next(txt, &ofs)) != 0) {
+            if(lv_font_get_glyph_bitmap(font, letter)) found_cnt++;
+        }
+    }
+    uint32_t time = (uint32_t)((clock() - start) * 1000 / CLOCKS_PER_SEC);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, found_cnt);
+
+    return time;
+}
+
+void test_tiny_ttf_glyph_lookup(void)
+{
+#if LV_USE_TINY_TTF && LV_FONT_MONTSERRAT_30
+    extern const uint8_t ubuntu_font[];
+    extern size_t ubuntu_font_size;
+
+    /*The bitmaps of the built-in font are in the flash, it's the lower limit*/
+    uint32_t builtin_time = glyph_lookup_time(&lv_font_montserrat_30, TXT, 20000);
+
+    /*Only cache hits after the first round*/
+    lv_font_t * font_warm = lv_tiny_ttf_create_data_ex(ubuntu_font, ubuntu_font_size, 30, 1024 * 1024);
+    uint32_t warm_time = glyph_lookup_time(font_warm, TXT, 20000);
+
+    /*The text doesn't fit into the cache, so the glyphs are evicted and rendered again continuously*/
+    lv_font_t * font_thrash = lv_tiny_ttf_create_data_ex(ubuntu_font, ubuntu_font_size, 30, 2048);
+    uint32_t thrash_time = glyph_lookup_time(font_thrash, TXT, 100);
+
+    TEST_PRINTF("20000 rounds with Montserrat 30 (built-in): %u ms", builtin_time);
+    TEST_PRINTF("20000 rounds with the warm 1 MB cache: %u ms", warm_time);
+    TEST_PRINTF("100 rounds with the thrashed 2 kB cache: %u ms", thrash_time);
+
+    lv_tiny_ttf_destroy(font_warm);
+    lv_tiny_ttf_destroy(font_thrash);
+#else
+    TEST_IGNORE();
+#endif
+}
+
+#endif
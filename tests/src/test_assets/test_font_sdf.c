@@ -0,0 +1,3254 @@
+/*******************************************************************************
+ * Size: 32 px
+ * Bpp: 8, signed distance field, spread: 4 px
+ * Opts: --font Montserrat-Medium.ttf --size 32 --spread 4 -r 0x20-0x7E --name test_font_sdf
+ ******************************************************************************/
+
+#if LV_BUILD_TEST
+#include "../../../lvgl.h"
+
+#if LV_USE_FONT_SDF
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the distance fields of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0021 "!" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x17, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x13, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x23, 0x35, 0x3c, 0x3d, 0x3d, 0x3d, 0x3b, 0x2f, 0x1a, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1a, 0x36, 0x4f, 0x5c, 0x5c, 0x5c, 0x5c, 0x5a, 0x47, 0x2c, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x21, 0x40, 0x60, 0x7b, 0x7c, 0x7c, 0x7c, 0x73, 0x54, 0x34, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0x9c, 0x9c, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x21, 0x40, 0x60, 0x7d, 0x9c, 0xb0, 0x90, 0x70, 0x50, 0x32, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9c, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9c, 0xaf, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9a, 0xac, 0x8c, 0x6c, 0x4d, 0x2f, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1a, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xa8, 0x88, 0x69, 0x4b, 0x2c, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x36, 0x55, 0x74, 0x94, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xa4, 0x84, 0x66, 0x48, 0x28, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x34, 0x54, 0x73, 0x90, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xa0, 0x81, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x8c, 0x8c, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x2b, 0x48, 0x63, 0x6c, 0x6c, 0x6c, 0x5a, 0x3d, 0x1e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x1d, 0x36, 0x48, 0x4e, 0x4e, 0x4d, 0x43, 0x2d, 0x14, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x16, 0x30, 0x47, 0x5d, 0x6b, 0x6c, 0x66, 0x55, 0x3f, 0x26, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x23, 0x41, 0x5d, 0x74, 0x86, 0x8c, 0x81, 0x6b, 0x51, 0x34, 0x16, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x85, 0xa0, 0xab, 0x96, 0x7a, 0x5c, 0x3c, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa5, 0xb3, 0x99, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x25, 0x43, 0x61, 0x7b, 0x8f, 0x94, 0x87, 0x71, 0x55, 0x37, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1a, 0x35, 0x4f, 0x65, 0x74, 0x76, 0x6f, 0x5b, 0x44, 0x2a, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x23, 0x39, 0x4a, 0x54, 0x58, 0x51, 0x44, 0x2e, 0x17, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x1e, 0x2e, 0x35, 0x38, 0x33, 0x28, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x10, 0x16, 0x19, 0x13, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0022 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x1b, 0x1d, 0x1d, 0x1d, 0x1a, 0x15, 0x1c, 0x1d, 0x1d, 0x1d, 0x17, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x2d, 0x3a, 0x3d, 0x3d, 0x3d, 0x38, 0x31, 0x3c, 0x3d, 0x3d, 0x3c, 0x35, 0x23, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x28, 0x44, 0x58, 0x5c, 0x5c, 0x5c, 0x54, 0x4a, 0x5b, 0x5c, 0x5c, 0x5c, 0x4f, 0x36, 0x1a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x30, 0x50, 0x6f, 0x7c, 0x7c, 0x7c, 0x67, 0x58, 0x76, 0x7c, 0x7c, 0x7b, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0x9c, 0x84, 0x66, 0x54, 0x74, 0x94, 0x9c, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x8f, 0xa4, 0x84, 0x64, 0x54, 0x74, 0x94, 0x9f, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x2d, 0x4c, 0x6c, 0x8c, 0xa4, 0x84, 0x64, 0x54, 0x74, 0x94, 0x9c, 0x7c, 0x5c, 0x3d, 0x1e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xa4, 0x84, 0x64, 0x54, 0x74, 0x94, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xa4, 0x84, 0x64, 0x54, 0x74, 0x94, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xa0, 0x80, 0x60, 0x54, 0x73, 0x90, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xa0, 0x80, 0x60, 0x50, 0x70, 0x90, 0x9a, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2c, 0x4c, 0x6b, 0x88, 0x98, 0x80, 0x60, 0x50, 0x70, 0x90, 0x97, 0x78, 0x58, 0x39, 0x1a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x28, 0x48, 0x66, 0x78, 0x78, 0x78, 0x5f, 0x4f, 0x6d, 0x78, 0x78, 0x74, 0x57, 0x38, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x1f, 0x3b, 0x51, 0x58, 0x58, 0x58, 0x4c, 0x41, 0x55, 0x58, 0x58, 0x57, 0x47, 0x2e, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0e, 0x25, 0x34, 0x39, 0x39, 0x39, 0x31, 0x29, 0x36, 0x39, 0x39, 0x38, 0x2e, 0x1a, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x16, 0x19, 0x19, 0x19, 0x14, 0x0e, 0x17, 0x19, 0x19, 0x18, 0x11, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0023 "#" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x1d, 0x1d, 0x1d, 0x18, 0x0c, 0x00, 0x07, 0x16, 0x1d, 0x1d, 0x1d, 0x1a, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x25, 0x36, 0x3d, 0x3d, 0x3d, 0x36, 0x25, 0x0e, 0x20, 0x33, 0x3c, 0x3d, 0x3d, 0x39, 0x2a, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3a, 0x52, 0x5c, 0x5c, 0x5c, 0x52, 0x3a, 0x1d, 0x33, 0x4d, 0x5c, 0x5c, 0x5c, 0x56, 0x40, 0x25, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x27, 0x46, 0x64, 0x7c, 0x7c, 0x7c, 0x64, 0x44, 0x25, 0x3c, 0x5c, 0x79, 0x7c, 0x7c, 0x6b, 0x4c, 0x2c, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2b, 0x49, 0x68, 0x88, 0x9c, 0x80, 0x61, 0x43, 0x24, 0x40, 0x60, 0x80, 0x9b, 0x88, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x0f, 0x2f, 0x4d, 0x6c, 0x8c, 0x9c, 0x7c, 0x5f, 0x40, 0x25, 0x44, 0x64, 0x83, 0xa0, 0x85, 0x68, 0x48, 0x29, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x1a, 0x24, 0x25, 0x25, 0x33, 0x51, 0x70, 0x90, 0x98, 0x78, 0x5b, 0x3c, 0x29, 0x48, 0x68, 0x86, 0xa0, 0x81, 0x64, 0x44, 0x26, 0x25, 0x20, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x1f, 0x35, 0x43, 0x44, 0x44, 0x44, 0x54, 0x74, 0x94, 0x94, 0x75, 0x57, 0x44, 0x44, 0x4c, 0x6c, 0x8a, 0x9c, 0x7f, 0x60, 0x44, 0x44, 0x44, 0x3e, 0x2b, 0x12, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x2f, 0x4b, 0x61, 0x64, 0x64, 0x64, 0x64, 0x78, 0x97, 0x90, 0x71, 0x64, 0x64, 0x64, 0x64, 0x70, 0x8d, 0x99, 0x7c, 0x64, 0x64, 0x64, 0x64, 0x58, 0x3e, 0x20, 0x01, 0x00,
+    0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x84, 0x84, 0x84, 0x84, 0x84, 0x9b, 0x91, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x91, 0x99, 0x84, 0x84, 0x84, 0x84, 0x83, 0x64, 0x44, 0x25, 0x05, 0x00,
+    0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xa4, 0xa4, 0xa4, 0xa4, 0xae, 0xa6, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa8, 0xa9, 0xa4, 0xa4, 0xa4, 0xa3, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00,
+    0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x88, 0x88, 0x88, 0x88, 0x8a, 0xa3, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x9d, 0x8f, 0x88, 0x88, 0x88, 0x88, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00,
+    0x00, 0x00, 0x12, 0x30, 0x4e, 0x65, 0x68, 0x68, 0x68, 0x69, 0x88, 0xa0, 0x80, 0x68, 0x68, 0x68, 0x68, 0x68, 0x7f, 0x9c, 0x8a, 0x6c, 0x68, 0x68, 0x68, 0x68, 0x5b, 0x3f, 0x21, 0x02, 0x00,
+    0x00, 0x00, 0x07, 0x22, 0x39, 0x47, 0x48, 0x48, 0x4d, 0x6c, 0x8c, 0x9c, 0x7c, 0x5f, 0x48, 0x48, 0x48, 0x64, 0x81, 0xa0, 0x86, 0x68, 0x49, 0x48, 0x48, 0x48, 0x41, 0x2e, 0x14, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x1e, 0x28, 0x29, 0x33, 0x51, 0x70, 0x90, 0x98, 0x78, 0x5b, 0x3c, 0x2a, 0x48, 0x68, 0x85, 0xa0, 0x83, 0x64, 0x44, 0x29, 0x29, 0x29, 0x24, 0x16, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x28, 0x33, 0x35, 0x35, 0x37, 0x55, 0x74, 0x94, 0x94, 0x75, 0x57, 0x38, 0x35, 0x4c, 0x6c, 0x88, 0x9c, 0x80, 0x60, 0x40, 0x35, 0x35, 0x2f, 0x1f, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x0c, 0x28, 0x41, 0x52, 0x54, 0x54, 0x54, 0x59, 0x78, 0x98, 0x90, 0x70, 0x55, 0x54, 0x54, 0x54, 0x70, 0x8c, 0x99, 0x7c, 0x5c, 0x54, 0x54, 0x54, 0x4b, 0x35, 0x1a, 0x00, 0x00, 0x00,
+    0x00, 0x14, 0x33, 0x52, 0x6e, 0x74, 0x74, 0x74, 0x74, 0x7c, 0x9c, 0x8c, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x90, 0x95, 0x78, 0x74, 0x74, 0x74, 0x74, 0x61, 0x43, 0x24, 0x04, 0x00, 0x00,
+    0x00, 0x15, 0x35, 0x54, 0x74, 0x93, 0x94, 0x94, 0x94, 0x94, 0xa3, 0x98, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x9d, 0x9d, 0x94, 0x94, 0x94, 0x94, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00,
+    0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0x98, 0x98, 0x98, 0x9a, 0xa9, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0xa5, 0x9b, 0x98, 0x98, 0x98, 0x98, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00,
+    0x00, 0x14, 0x34, 0x53, 0x71, 0x78, 0x78, 0x78, 0x78, 0x88, 0xa0, 0x80, 0x78, 0x78, 0x78, 0x78, 0x78, 0x7f, 0x9c, 0x8b, 0x78, 0x78, 0x78, 0x78, 0x78, 0x63, 0x44, 0x24, 0x05, 0x00, 0x00,
+    0x00, 0x0d, 0x2a, 0x44, 0x56, 0x58, 0x58, 0x58, 0x6c, 0x8c, 0x9c, 0x7c, 0x5d, 0x58, 0x58, 0x58, 0x64, 0x80, 0xa0, 0x88, 0x68, 0x58, 0x58, 0x58, 0x58, 0x4f, 0x38, 0x1c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x2c, 0x37, 0x39, 0x39, 0x51, 0x70, 0x90, 0x98, 0x78, 0x5b, 0x3c, 0x39, 0x48, 0x67, 0x84, 0xa1, 0x84, 0x64, 0x44, 0x39, 0x39, 0x39, 0x33, 0x22, 0x0b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x18, 0x1a, 0x36, 0x55, 0x74, 0x94, 0x94, 0x75, 0x57, 0x38, 0x2c, 0x4c, 0x6b, 0x88, 0x9d, 0x80, 0x60, 0x40, 0x21, 0x19, 0x19, 0x15, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x39, 0x58, 0x78, 0x98, 0x90, 0x71, 0x53, 0x34, 0x30, 0x50, 0x6f, 0x8c, 0x9b, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x90, 0x8c, 0x6d, 0x4f, 0x30, 0x34, 0x54, 0x73, 0x8f, 0x90, 0x78, 0x58, 0x39, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x3a, 0x58, 0x6f, 0x70, 0x70, 0x66, 0x49, 0x2b, 0x33, 0x51, 0x6b, 0x70, 0x70, 0x6b, 0x53, 0x35, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x2d, 0x44, 0x50, 0x50, 0x50, 0x4c, 0x39, 0x1f, 0x26, 0x3f, 0x4e, 0x50, 0x50, 0x4e, 0x3f, 0x27, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x28, 0x30, 0x31, 0x31, 0x2e, 0x21, 0x0c, 0x12, 0x25, 0x2f, 0x31, 0x31, 0x2f, 0x25, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x11, 0x11, 0x11, 0x0f, 0x05, 0x00, 0x00, 0x08, 0x10, 0x11, 0x11, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0024 "$" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x17, 0x19, 0x19, 0x18, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x27, 0x35, 0x39, 0x39, 0x37, 0x2c, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x23, 0x3e, 0x53, 0x58, 0x58, 0x56, 0x44, 0x2a, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2c, 0x4b, 0x6a, 0x78, 0x78, 0x71, 0x53, 0x34, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 0x2d, 0x4c, 0x6c, 0x8c, 0x94, 0x74, 0x54, 0x35, 0x18, 0x11, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x17, 0x25, 0x2f, 0x38, 0x4c, 0x6c, 0x8c, 0x94, 0x74, 0x54, 0x3e, 0x37, 0x2f, 0x25, 0x18, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x21, 0x32, 0x41, 0x4d, 0x57, 0x5d, 0x6c, 0x8c, 0x94, 0x74, 0x60, 0x5c, 0x56, 0x4d, 0x43, 0x35, 0x27, 0x16, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x23, 0x39, 0x4c, 0x5e, 0x6b, 0x75, 0x7c, 0x80, 0x8d, 0x95, 0x84, 0x80, 0x7c, 0x74, 0x6b, 0x5f, 0x51, 0x41, 0x2e, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x21, 0x39, 0x4f, 0x66, 0x78, 0x86, 0x91, 0x9a, 0xa0, 0xa6, 0xaa, 0xa4, 0xa0, 0x99, 0x91, 0x88, 0x7b, 0x6d, 0x5b, 0x3f, 0x21, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x32, 0x4c, 0x66, 0x7c, 0x91, 0xa2, 0xa8, 0x9c, 0x96, 0x98, 0x9d, 0x94, 0x98, 0x9d, 0xa6, 0xa4, 0x96, 0x81, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x24, 0x41, 0x5e, 0x78, 0x91, 0xa8, 0x9d, 0x8c, 0x80, 0x78, 0x8c, 0x94, 0x75, 0x78, 0x80, 0x8a, 0x96, 0x93, 0x76, 0x5a, 0x3c, 0x1f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x2e, 0x4c, 0x6a, 0x86, 0xa2, 0xa1, 0x87, 0x73, 0x63, 0x6c, 0x8c, 0x94, 0x74, 0x5b, 0x63, 0x6d, 0x7b, 0x86, 0x6b, 0x4e, 0x30, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x14, 0x34, 0x53, 0x71, 0x90, 0xae, 0x94, 0x78, 0x5d, 0x4c, 0x6c, 0x8c, 0x94, 0x74, 0x54, 0x45, 0x51, 0x5f, 0x6c, 0x5d, 0x41, 0x25, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x51, 0x4c, 0x6c, 0x8c, 0x94, 0x74, 0x54, 0x35, 0x35, 0x43, 0x4c, 0x45, 0x30, 0x16, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xaf, 0x93, 0x76, 0x5b, 0x4c, 0x6c, 0x8c, 0x94, 0x74, 0x54, 0x35, 0x19, 0x26, 0x2d, 0x28, 0x19, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x13, 0x32, 0x50, 0x6f, 0x8b, 0xa9, 0x9d, 0x85, 0x71, 0x63, 0x6c, 0x8c, 0x94, 0x74, 0x54, 0x35, 0x25, 0x1b, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x29, 0x47, 0x65, 0x80, 0x9a, 0xaf, 0x9d, 0x8c, 0x80, 0x75, 0x8c, 0x94, 0x74, 0x56, 0x4d, 0x43, 0x38, 0x2c, 0x1d, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x1e, 0x3a, 0x55, 0x6e, 0x84, 0x97, 0xa9, 0xa8, 0x9b, 0x93, 0x95, 0x94, 0x7c, 0x74, 0x6b, 0x61, 0x56, 0x48, 0x38, 0x25, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x29, 0x41, 0x58, 0x6d, 0x7f, 0x8c, 0x98, 0xa1, 0xab, 0xb0, 0xa5, 0x99, 0x91, 0x88, 0x7f, 0x73, 0x63, 0x52, 0x3c, 0x25, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x2b, 0x41, 0x54, 0x65, 0x71, 0x7b, 0x84, 0x8c, 0x97, 0xaa, 0xa4, 0xac, 0xa5, 0x9a, 0x8d, 0x7d, 0x69, 0x52, 0x3a, 0x1f, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x28, 0x39, 0x48, 0x53, 0x5f, 0x67, 0x70, 0x8c, 0x95, 0x85, 0x8f, 0x9a, 0xa8, 0xa8, 0x95, 0x7f, 0x66, 0x4a, 0x2e, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x11, 0x1e, 0x2a, 0x35, 0x40, 0x4c, 0x6c, 0x8c, 0x94, 0x74, 0x73, 0x7f, 0x8d, 0xa3, 0xaa, 0x8f, 0x74, 0x57, 0x39, 0x1a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x1a, 0x2a, 0x31, 0x2b, 0x1c, 0x18, 0x2d, 0x4c, 0x6c, 0x8c, 0x94, 0x74, 0x57, 0x63, 0x77, 0x8f, 0xaa, 0x9b, 0x7d, 0x60, 0x40, 0x21, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x16, 0x30, 0x46, 0x50, 0x48, 0x35, 0x25, 0x2d, 0x4c, 0x6c, 0x8c, 0x94, 0x74, 0x54, 0x4a, 0x66, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00,
+    0x00, 0x00, 0x08, 0x25, 0x41, 0x5d, 0x70, 0x61, 0x50, 0x41, 0x34, 0x4c, 0x6c, 0x8c, 0x94, 0x74, 0x54, 0x47, 0x65, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00,
+    0x00, 0x00, 0x17, 0x33, 0x4f, 0x6c, 0x86, 0x7b, 0x6b, 0x5e, 0x52, 0x4d, 0x6c, 0x8c, 0x94, 0x74, 0x54, 0x5b, 0x71, 0x8c, 0xa9, 0x99, 0x7c, 0x5d, 0x3f, 0x20, 0x00, 0x00,
+    0x00, 0x03, 0x22, 0x41, 0x5e, 0x7a, 0x94, 0x94, 0x85, 0x7a, 0x70, 0x68, 0x6c, 0x8c, 0x94, 0x74, 0x6a, 0x76, 0x87, 0x9d, 0xa5, 0x8c, 0x71, 0x55, 0x37, 0x18, 0x00, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x81, 0x95, 0xa6, 0xa2, 0x96, 0x8c, 0x86, 0x80, 0x8c, 0x94, 0x81, 0x88, 0x91, 0x9f, 0xa8, 0x92, 0x7b, 0x63, 0x46, 0x2a, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x1f, 0x3c, 0x55, 0x6b, 0x7c, 0x8a, 0x96, 0xa0, 0xa8, 0xa4, 0xa0, 0xa3, 0xa6, 0xa0, 0xa5, 0xa7, 0x9b, 0x8d, 0x7c, 0x66, 0x4f, 0x36, 0x1c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x28, 0x3f, 0x51, 0x61, 0x6f, 0x7a, 0x83, 0x8b, 0x90, 0x94, 0x9b, 0xa0, 0x94, 0x90, 0x88, 0x80, 0x73, 0x63, 0x4f, 0x39, 0x23, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x12, 0x25, 0x36, 0x45, 0x51, 0x5d, 0x66, 0x6d, 0x74, 0x76, 0x8c, 0x94, 0x78, 0x73, 0x6c, 0x64, 0x56, 0x48, 0x38, 0x23, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x1a, 0x28, 0x34, 0x3f, 0x48, 0x4f, 0x54, 0x6c, 0x8c, 0x94, 0x74, 0x55, 0x4d, 0x46, 0x3a, 0x2c, 0x1d, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x17, 0x20, 0x29, 0x30, 0x4c, 0x6c, 0x8c, 0x94, 0x74, 0x54, 0x35, 0x27, 0x1d, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x2d, 0x4c, 0x6c, 0x8b, 0x8c, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x2a, 0x48, 0x63, 0x6c, 0x6c, 0x68, 0x4f, 0x32, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1d, 0x36, 0x48, 0x4c, 0x4c, 0x4b, 0x3c, 0x24, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1d, 0x2a, 0x2d, 0x2d, 0x2c, 0x21, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0b, 0x0d, 0x0d, 0x0c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0025 "%" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x16, 0x1e, 0x24, 0x25, 0x23, 0x1d, 0x14, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x13, 0x1c, 0x1d, 0x1d, 0x1c, 0x15, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x25, 0x33, 0x3d, 0x43, 0x44, 0x42, 0x3c, 0x31, 0x23, 0x11, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1a, 0x2f, 0x3b, 0x3d, 0x3d, 0x3c, 0x31, 0x1d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x17, 0x2d, 0x40, 0x4f, 0x5c, 0x61, 0x64, 0x60, 0x5a, 0x4e, 0x3d, 0x28, 0x12, 0x00, 0x00, 0x00, 0x14, 0x2f, 0x47, 0x5a, 0x5c, 0x5c, 0x5b, 0x4a, 0x2f, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x2d, 0x44, 0x5a, 0x6c, 0x7a, 0x80, 0x84, 0x80, 0x78, 0x69, 0x55, 0x3f, 0x28, 0x0e, 0x00, 0x0c, 0x26, 0x40, 0x5b, 0x74, 0x7c, 0x7c, 0x76, 0x58, 0x38, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x25, 0x3f, 0x5a, 0x71, 0x84, 0x94, 0x9a, 0x98, 0x9a, 0x93, 0x81, 0x6b, 0x54, 0x3a, 0x1f, 0x05, 0x1e, 0x39, 0x52, 0x6c, 0x85, 0x9c, 0x86, 0x6d, 0x53, 0x35, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x33, 0x4f, 0x6b, 0x84, 0x9c, 0x8a, 0x7c, 0x78, 0x7f, 0x8d, 0x97, 0x7f, 0x66, 0x49, 0x2c, 0x16, 0x30, 0x4a, 0x65, 0x7d, 0x96, 0x8f, 0x76, 0x5c, 0x41, 0x27, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x20, 0x3e, 0x5c, 0x7a, 0x94, 0x8d, 0x74, 0x60, 0x58, 0x63, 0x79, 0x93, 0x8d, 0x73, 0x56, 0x37, 0x28, 0x41, 0x5c, 0x76, 0x8f, 0x96, 0x7d, 0x63, 0x4a, 0x30, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x27, 0x46, 0x64, 0x83, 0x9e, 0x81, 0x65, 0x49, 0x39, 0x4e, 0x6a, 0x86, 0x99, 0x7c, 0x5d, 0x3f, 0x3a, 0x54, 0x6d, 0x86, 0x9e, 0x85, 0x6c, 0x52, 0x38, 0x1e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0x99, 0x7c, 0x5c, 0x3d, 0x24, 0x44, 0x63, 0x80, 0x9e, 0x80, 0x61, 0x43, 0x4b, 0x66, 0x7f, 0x97, 0x8c, 0x74, 0x5b, 0x40, 0x26, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x89, 0x98, 0x78, 0x58, 0x39, 0x21, 0x40, 0x60, 0x80, 0xa0, 0x84, 0x64, 0x45, 0x5d, 0x77, 0x8f, 0x95, 0x7c, 0x63, 0x49, 0x2f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0x99, 0x7c, 0x5c, 0x3d, 0x24, 0x44, 0x63, 0x80, 0x9e, 0x80, 0x61, 0x55, 0x6e, 0x87, 0x9d, 0x84, 0x6b, 0x51, 0x36, 0x1d, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x27, 0x46, 0x64, 0x83, 0x9e, 0x80, 0x65, 0x48, 0x39, 0x4e, 0x6a, 0x86, 0x9a, 0x7c, 0x5d, 0x66, 0x80, 0x9a, 0x8c, 0x73, 0x5a, 0x3f, 0x31, 0x31, 0x2c, 0x23, 0x15, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x20, 0x3e, 0x5c, 0x7a, 0x94, 0x8d, 0x74, 0x5f, 0x58, 0x63, 0x78, 0x93, 0x8f, 0x74, 0x5e, 0x78, 0x91, 0x94, 0x7b, 0x61, 0x4a, 0x50, 0x50, 0x50, 0x4b, 0x3f, 0x31, 0x1f, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x33, 0x4f, 0x6c, 0x85, 0x9c, 0x89, 0x7b, 0x78, 0x7d, 0x8c, 0x97, 0x80, 0x66, 0x71, 0x89, 0x9b, 0x83, 0x6a, 0x5a, 0x67, 0x70, 0x70, 0x70, 0x68, 0x5c, 0x4b, 0x36, 0x20, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x25, 0x40, 0x5b, 0x71, 0x86, 0x96, 0x98, 0x98, 0x9a, 0x93, 0x81, 0x6d, 0x68, 0x81, 0x9a, 0x8a, 0x71, 0x60, 0x74, 0x83, 0x8c, 0x90, 0x8d, 0x85, 0x77, 0x63, 0x4d, 0x34, 0x1b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x14, 0x2e, 0x44, 0x5b, 0x6d, 0x7b, 0x81, 0x84, 0x80, 0x78, 0x6a, 0x60, 0x79, 0x92, 0x93, 0x7a, 0x61, 0x76, 0x8c, 0x9b, 0x8d, 0x88, 0x8c, 0x9a, 0x8f, 0x79, 0x60, 0x46, 0x2a, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x17, 0x2e, 0x41, 0x51, 0x5c, 0x64, 0x64, 0x63, 0x5b, 0x57, 0x71, 0x8a, 0x9a, 0x81, 0x69, 0x6c, 0x86, 0x9a, 0x84, 0x71, 0x6a, 0x70, 0x81, 0x97, 0x8c, 0x71, 0x55, 0x38, 0x1a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x27, 0x35, 0x3e, 0x44, 0x44, 0x44, 0x4f, 0x69, 0x81, 0x9b, 0x89, 0x71, 0x5a, 0x78, 0x94, 0x8c, 0x71, 0x58, 0x4b, 0x55, 0x6d, 0x88, 0x9a, 0x7d, 0x60, 0x41, 0x22, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x17, 0x1f, 0x25, 0x2d, 0x47, 0x61, 0x7b, 0x93, 0x92, 0x79, 0x5f, 0x60, 0x80, 0x9c, 0x83, 0x65, 0x47, 0x2c, 0x43, 0x61, 0x80, 0x9c, 0x84, 0x66, 0x48, 0x28, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x25, 0x3e, 0x58, 0x73, 0x8c, 0x9a, 0x80, 0x66, 0x4e, 0x64, 0x84, 0x9f, 0x80, 0x60, 0x40, 0x21, 0x3c, 0x5c, 0x7b, 0x98, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1c, 0x36, 0x51, 0x6a, 0x83, 0x9d, 0x88, 0x6f, 0x55, 0x44, 0x64, 0x84, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x3c, 0x5b, 0x78, 0x98, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x2e, 0x48, 0x63, 0x7c, 0x95, 0x8f, 0x77, 0x5e, 0x44, 0x42, 0x60, 0x80, 0x9d, 0x81, 0x64, 0x46, 0x29, 0x42, 0x60, 0x7d, 0x9c, 0x85, 0x68, 0x48, 0x29, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x26, 0x40, 0x5a, 0x74, 0x8c, 0x98, 0x7f, 0x66, 0x4b, 0x32, 0x3d, 0x5c, 0x7a, 0x96, 0x8a, 0x6f, 0x55, 0x46, 0x52, 0x6c, 0x86, 0x9b, 0x7f, 0x61, 0x43, 0x24, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1d, 0x38, 0x52, 0x6c, 0x84, 0x9d, 0x87, 0x6e, 0x54, 0x3a, 0x1f, 0x34, 0x52, 0x6f, 0x89, 0x98, 0x80, 0x6d, 0x64, 0x6c, 0x7d, 0x95, 0x8d, 0x73, 0x56, 0x39, 0x1b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x2f, 0x49, 0x63, 0x7d, 0x96, 0x8f, 0x76, 0x5d, 0x43, 0x28, 0x0e, 0x28, 0x45, 0x5f, 0x79, 0x8f, 0x97, 0x88, 0x84, 0x88, 0x95, 0x92, 0x7c, 0x63, 0x48, 0x2c, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3b, 0x5a, 0x74, 0x8d, 0x90, 0x7f, 0x65, 0x4a, 0x30, 0x17, 0x00, 0x19, 0x33, 0x4d, 0x63, 0x79, 0x88, 0x91, 0x94, 0x93, 0x8a, 0x7b, 0x66, 0x4f, 0x38, 0x1d, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x3a, 0x58, 0x6f, 0x70, 0x70, 0x6b, 0x53, 0x39, 0x1e, 0x04, 0x00, 0x07, 0x20, 0x36, 0x4d, 0x5e, 0x6c, 0x74, 0x78, 0x74, 0x6d, 0x61, 0x4f, 0x39, 0x23, 0x0b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x2d, 0x44, 0x50, 0x50, 0x50, 0x4e, 0x3f, 0x27, 0x0d, 0x00, 0x00, 0x00, 0x09, 0x20, 0x33, 0x43, 0x4e, 0x54, 0x58, 0x54, 0x4f, 0x45, 0x35, 0x23, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x28, 0x30, 0x31, 0x31, 0x2f, 0x25, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x18, 0x25, 0x2f, 0x35, 0x39, 0x35, 0x30, 0x28, 0x1a, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x11, 0x11, 0x11, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x11, 0x15, 0x19, 0x15, 0x12, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0026 "&" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x12, 0x1b, 0x21, 0x25, 0x25, 0x23, 0x1e, 0x16, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x14, 0x23, 0x30, 0x3a, 0x40, 0x44, 0x44, 0x42, 0x3d, 0x34, 0x28, 0x1a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1a, 0x2e, 0x3f, 0x4e, 0x58, 0x60, 0x64, 0x64, 0x60, 0x5c, 0x52, 0x45, 0x33, 0x20, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x31, 0x47, 0x5b, 0x6a, 0x76, 0x7f, 0x81, 0x84, 0x80, 0x7a, 0x6f, 0x60, 0x4d, 0x36, 0x1e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2a, 0x44, 0x5d, 0x74, 0x85, 0x93, 0x9c, 0xa0, 0xa2, 0x9f, 0x96, 0x8a, 0x79, 0x63, 0x4a, 0x2f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x38, 0x55, 0x71, 0x88, 0x9d, 0x9d, 0x8d, 0x86, 0x84, 0x88, 0x96, 0xa3, 0x8f, 0x76, 0x5a, 0x3d, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x25, 0x43, 0x61, 0x7f, 0x9a, 0x9f, 0x87, 0x73, 0x68, 0x65, 0x6d, 0x7f, 0x96, 0x9f, 0x81, 0x64, 0x46, 0x27, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa5, 0x94, 0x78, 0x5b, 0x49, 0x47, 0x52, 0x6d, 0x8b, 0xa6, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0x90, 0x71, 0x53, 0x34, 0x34, 0x4e, 0x6c, 0x88, 0xa6, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x85, 0xa4, 0x96, 0x7a, 0x5e, 0x44, 0x4d, 0x60, 0x79, 0x93, 0x9f, 0x83, 0x65, 0x47, 0x28, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x23, 0x42, 0x60, 0x7d, 0x98, 0xa2, 0x87, 0x6f, 0x58, 0x66, 0x79, 0x8c, 0xa3, 0x8f, 0x76, 0x5a, 0x3e, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x36, 0x53, 0x6f, 0x88, 0xa2, 0x9a, 0x84, 0x71, 0x80, 0x91, 0xa2, 0x92, 0x7c, 0x66, 0x4b, 0x2f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x28, 0x44, 0x5e, 0x77, 0x8d, 0xa5, 0x97, 0x8c, 0x9a, 0x9f, 0x8c, 0x7b, 0x66, 0x4f, 0x39, 0x23, 0x24, 0x1b, 0x11, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x32, 0x46, 0x57, 0x69, 0x7b, 0x94, 0xb0, 0xac, 0x98, 0x84, 0x74, 0x63, 0x4f, 0x39, 0x33, 0x42, 0x43, 0x39, 0x2f, 0x25, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x1d, 0x33, 0x4a, 0x5e, 0x71, 0x81, 0x93, 0xa2, 0x98, 0xa5, 0x98, 0x81, 0x6b, 0x55, 0x3f, 0x2e, 0x49, 0x5f, 0x61, 0x57, 0x4e, 0x40, 0x2a, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x30, 0x4a, 0x60, 0x77, 0x89, 0x9b, 0x9a, 0x8a, 0x7b, 0x8f, 0xa5, 0x97, 0x81, 0x6b, 0x55, 0x3f, 0x55, 0x74, 0x7f, 0x75, 0x6c, 0x56, 0x39, 0x1a, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x27, 0x43, 0x5d, 0x76, 0x8c, 0xa2, 0x95, 0x81, 0x71, 0x63, 0x79, 0x8f, 0xa5, 0x97, 0x81, 0x6b, 0x57, 0x5c, 0x7b, 0x98, 0x91, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x33, 0x51, 0x6d, 0x87, 0xa0, 0x97, 0x7f, 0x6a, 0x56, 0x4d, 0x63, 0x79, 0x8f, 0xa5, 0x97, 0x81, 0x6e, 0x66, 0x83, 0xa0, 0x91, 0x74, 0x56, 0x37, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x1d, 0x3c, 0x5b, 0x78, 0x95, 0xa5, 0x88, 0x6d, 0x54, 0x3e, 0x36, 0x4d, 0x63, 0x79, 0x8f, 0xa5, 0x9a, 0x84, 0x73, 0x8d, 0xa5, 0x88, 0x6c, 0x4d, 0x2f, 0x11, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0x9d, 0xa0, 0x80, 0x61, 0x43, 0x28, 0x20, 0x36, 0x4d, 0x63, 0x79, 0x8f, 0xa5, 0x9a, 0x85, 0x9a, 0x9a, 0x7d, 0x61, 0x43, 0x26, 0x08, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0xa0, 0xa0, 0x80, 0x60, 0x42, 0x2a, 0x1f, 0x20, 0x36, 0x4d, 0x63, 0x79, 0x8f, 0xa5, 0xa4, 0xa6, 0x8c, 0x71, 0x55, 0x38, 0x1a, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x7f, 0x9c, 0xa4, 0x86, 0x6d, 0x56, 0x46, 0x3e, 0x3c, 0x3d, 0x45, 0x51, 0x64, 0x79, 0x94, 0xb4, 0xa0, 0x84, 0x6e, 0x58, 0x41, 0x2b, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x1b, 0x3a, 0x58, 0x76, 0x91, 0xac, 0x97, 0x81, 0x71, 0x64, 0x5c, 0x5a, 0x5c, 0x64, 0x6d, 0x7b, 0x8c, 0xa0, 0x9d, 0xa3, 0x9a, 0x84, 0x6e, 0x58, 0x41, 0x2b, 0x11, 0x00,
+    0x00, 0x00, 0x12, 0x2f, 0x4c, 0x68, 0x81, 0x97, 0xab, 0x9a, 0x8c, 0x80, 0x7c, 0x78, 0x7c, 0x80, 0x88, 0x96, 0xa5, 0x97, 0x83, 0x8c, 0xa3, 0x9a, 0x84, 0x6e, 0x57, 0x3c, 0x1d, 0x00,
+    0x00, 0x00, 0x05, 0x21, 0x3c, 0x55, 0x6b, 0x81, 0x92, 0xa0, 0xa7, 0xa0, 0x9c, 0x98, 0x9c, 0x9f, 0xa5, 0x9c, 0x8d, 0x7f, 0x6b, 0x77, 0x8c, 0xa3, 0x93, 0x7c, 0x60, 0x40, 0x21, 0x01,
+    0x00, 0x00, 0x00, 0x10, 0x28, 0x3f, 0x55, 0x68, 0x78, 0x83, 0x8c, 0x94, 0x98, 0x98, 0x95, 0x90, 0x8a, 0x80, 0x74, 0x65, 0x53, 0x60, 0x77, 0x8c, 0x7f, 0x69, 0x4f, 0x36, 0x1a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x28, 0x3c, 0x4e, 0x5c, 0x66, 0x70, 0x74, 0x78, 0x78, 0x78, 0x74, 0x6c, 0x64, 0x58, 0x49, 0x39, 0x4a, 0x60, 0x76, 0x6b, 0x53, 0x3c, 0x23, 0x0a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x31, 0x3e, 0x48, 0x50, 0x55, 0x58, 0x58, 0x58, 0x54, 0x4e, 0x46, 0x3a, 0x2e, 0x1e, 0x33, 0x4a, 0x58, 0x53, 0x3f, 0x27, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x15, 0x20, 0x2a, 0x32, 0x36, 0x39, 0x39, 0x39, 0x35, 0x2f, 0x28, 0x1d, 0x11, 0x06, 0x1d, 0x2f, 0x38, 0x35, 0x27, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x13, 0x17, 0x19, 0x19, 0x19, 0x15, 0x10, 0x09, 0x00, 0x00, 0x00, 0x04, 0x12, 0x19, 0x17, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0027 "'" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x1b, 0x1d, 0x1d, 0x1d, 0x1a, 0x0e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x2d, 0x3a, 0x3d, 0x3d, 0x3d, 0x38, 0x28, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x28, 0x44, 0x58, 0x5c, 0x5c, 0x5c, 0x54, 0x3d, 0x21, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x30, 0x50, 0x6f, 0x7c, 0x7c, 0x7c, 0x67, 0x48, 0x28, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0x9c, 0x84, 0x66, 0x48, 0x28, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x8f, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x2d, 0x4c, 0x6c, 0x8c, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xa0, 0x80, 0x60, 0x42, 0x23, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2c, 0x4c, 0x6b, 0x88, 0x98, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x28, 0x48, 0x66, 0x78, 0x78, 0x78, 0x5f, 0x40, 0x20, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x1f, 0x3b, 0x51, 0x58, 0x58, 0x58, 0x4c, 0x34, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0e, 0x25, 0x34, 0x39, 0x39, 0x39, 0x31, 0x20, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x16, 0x19, 0x19, 0x19, 0x14, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0028 "(" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1e, 0x28, 0x29, 0x29, 0x29, 0x25, 0x18, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x23, 0x39, 0x47, 0x48, 0x48, 0x48, 0x43, 0x31, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x35, 0x4f, 0x65, 0x68, 0x68, 0x68, 0x5d, 0x43, 0x25, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x28, 0x45, 0x61, 0x7b, 0x88, 0x88, 0x83, 0x67, 0x48, 0x28, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x36, 0x53, 0x6f, 0x8a, 0xa5, 0x8f, 0x76, 0x5a, 0x3e, 0x21, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x27, 0x43, 0x61, 0x7d, 0x98, 0x9f, 0x83, 0x68, 0x4b, 0x2f, 0x13, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x32, 0x50, 0x6d, 0x88, 0xa5, 0x93, 0x78, 0x5a, 0x3e, 0x21, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x3d, 0x5a, 0x78, 0x94, 0xa5, 0x88, 0x6c, 0x4e, 0x31, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x28, 0x46, 0x64, 0x80, 0x9f, 0x9c, 0x7f, 0x61, 0x43, 0x26, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x2f, 0x4e, 0x6c, 0x8a, 0xa8, 0x94, 0x76, 0x58, 0x3a, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x37, 0x56, 0x74, 0x91, 0xaa, 0x8c, 0x6f, 0x50, 0x32, 0x13, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1e, 0x3d, 0x5c, 0x7b, 0x98, 0xa4, 0x85, 0x68, 0x49, 0x2a, 0x0b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x24, 0x43, 0x61, 0x80, 0x9f, 0x9f, 0x80, 0x61, 0x43, 0x24, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x28, 0x48, 0x66, 0x84, 0xa4, 0x9a, 0x7c, 0x5c, 0x3d, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0c, 0x2c, 0x4b, 0x69, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x55, 0x36, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x2f, 0x4d, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xad, 0x90, 0x71, 0x53, 0x34, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xae, 0x90, 0x70, 0x50, 0x31, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x8c, 0xac, 0x93, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x88, 0xa8, 0x94, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x86, 0xa4, 0x98, 0x7a, 0x5c, 0x3c, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x81, 0xa0, 0x9c, 0x7d, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x20, 0x40, 0x5f, 0x7c, 0x9b, 0xa0, 0x83, 0x64, 0x46, 0x27, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1a, 0x39, 0x58, 0x78, 0x94, 0xa7, 0x88, 0x6b, 0x4c, 0x2e, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x14, 0x33, 0x51, 0x70, 0x8c, 0xab, 0x90, 0x73, 0x54, 0x35, 0x17, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x2b, 0x49, 0x68, 0x85, 0xa3, 0x98, 0x7b, 0x5d, 0x3f, 0x21, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x23, 0x41, 0x5f, 0x7c, 0x99, 0xa1, 0x84, 0x67, 0x49, 0x2c, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x37, 0x55, 0x71, 0x8d, 0xa9, 0x8d, 0x73, 0x55, 0x38, 0x1a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2b, 0x48, 0x66, 0x81, 0x9d, 0x9a, 0x7d, 0x61, 0x45, 0x28, 0x0c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x3c, 0x5a, 0x76, 0x91, 0xa6, 0x8a, 0x6f, 0x53, 0x36, 0x1a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x2f, 0x4c, 0x66, 0x81, 0x98, 0x96, 0x7d, 0x61, 0x44, 0x26, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x21, 0x3c, 0x57, 0x71, 0x78, 0x78, 0x78, 0x66, 0x48, 0x28, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x2c, 0x44, 0x56, 0x58, 0x58, 0x58, 0x51, 0x3b, 0x1f, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x2c, 0x37, 0x39, 0x39, 0x39, 0x34, 0x25, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x18, 0x19, 0x19, 0x19, 0x16, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0029 ")" */
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x09, 0x09, 0x09, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x1c, 0x27, 0x29, 0x29, 0x29, 0x27, 0x1c, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x1e, 0x36, 0x46, 0x48, 0x48, 0x48, 0x46, 0x36, 0x1e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0e, 0x2d, 0x4a, 0x63, 0x68, 0x68, 0x68, 0x63, 0x4a, 0x2f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x30, 0x50, 0x6f, 0x87, 0x88, 0x88, 0x76, 0x5b, 0x3f, 0x23, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0b, 0x28, 0x44, 0x5f, 0x7b, 0x96, 0x9f, 0x85, 0x6a, 0x4e, 0x31, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x35, 0x51, 0x6d, 0x88, 0xa5, 0x93, 0x78, 0x5b, 0x3e, 0x21, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x27, 0x43, 0x61, 0x7d, 0x9a, 0x9f, 0x83, 0x67, 0x4a, 0x2d, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1a, 0x38, 0x55, 0x73, 0x8d, 0xaa, 0x8f, 0x73, 0x55, 0x37, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0e, 0x2c, 0x49, 0x67, 0x84, 0xa1, 0x99, 0x7c, 0x5f, 0x41, 0x22, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x21, 0x40, 0x5f, 0x7c, 0x99, 0xa3, 0x84, 0x67, 0x48, 0x2a, 0x0b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x37, 0x56, 0x74, 0x91, 0xaa, 0x8c, 0x6f, 0x50, 0x32, 0x13, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x30, 0x4f, 0x6d, 0x8c, 0xaa, 0x94, 0x75, 0x57, 0x38, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0b, 0x2a, 0x49, 0x68, 0x85, 0xa4, 0x98, 0x7b, 0x5c, 0x3c, 0x1d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x80, 0xa0, 0x9d, 0x80, 0x60, 0x40, 0x21, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x40, 0x60, 0x7d, 0x9c, 0xa1, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9b, 0xa4, 0x84, 0x66, 0x48, 0x28, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x39, 0x58, 0x78, 0x98, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3c, 0x5c, 0x7a, 0x98, 0xa5, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x3d, 0x5c, 0x7c, 0x9c, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x22, 0x41, 0x60, 0x80, 0x9f, 0xa0, 0x80, 0x61, 0x43, 0x24, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x28, 0x47, 0x65, 0x84, 0xa3, 0x9c, 0x7c, 0x5d, 0x3f, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x2d, 0x4c, 0x6b, 0x88, 0xa8, 0x95, 0x78, 0x59, 0x3a, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x34, 0x53, 0x71, 0x8f, 0xab, 0x90, 0x71, 0x53, 0x34, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1d, 0x3c, 0x5b, 0x78, 0x95, 0xa5, 0x88, 0x6b, 0x4c, 0x2e, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x28, 0x46, 0x64, 0x80, 0x9d, 0x9c, 0x80, 0x63, 0x44, 0x25, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x32, 0x50, 0x6d, 0x8a, 0xa8, 0x93, 0x78, 0x5a, 0x3b, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x21, 0x3e, 0x5b, 0x78, 0x94, 0xa5, 0x88, 0x6c, 0x4e, 0x31, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x2e, 0x4b, 0x68, 0x83, 0x9f, 0x98, 0x7d, 0x61, 0x43, 0x26, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x21, 0x3d, 0x58, 0x74, 0x8f, 0xa6, 0x8a, 0x6f, 0x53, 0x36, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0c, 0x2c, 0x4b, 0x68, 0x81, 0x98, 0x96, 0x7d, 0x61, 0x45, 0x28, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0c, 0x2c, 0x4b, 0x6a, 0x78, 0x78, 0x78, 0x6b, 0x52, 0x36, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x23, 0x3e, 0x53, 0x58, 0x58, 0x58, 0x53, 0x3f, 0x26, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x27, 0x35, 0x39, 0x39, 0x39, 0x35, 0x27, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0c, 0x17, 0x19, 0x19, 0x19, 0x17, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+002A "*" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x09, 0x09, 0x09, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x23, 0x29, 0x29, 0x28, 0x21, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x11, 0x2b, 0x3f, 0x48, 0x48, 0x48, 0x3d, 0x28, 0x0e, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x1f, 0x25, 0x22, 0x3c, 0x57, 0x68, 0x68, 0x67, 0x54, 0x38, 0x23, 0x24, 0x1c, 0x0b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x28, 0x3c, 0x44, 0x41, 0x40, 0x60, 0x80, 0x88, 0x7c, 0x5c, 0x3d, 0x42, 0x44, 0x38, 0x23, 0x09, 0x00, 0x00,
+    0x00, 0x03, 0x1f, 0x3a, 0x55, 0x64, 0x5d, 0x4c, 0x60, 0x80, 0x9c, 0x7c, 0x5c, 0x50, 0x5f, 0x63, 0x4f, 0x35, 0x1a, 0x00, 0x00,
+    0x00, 0x11, 0x2e, 0x4a, 0x66, 0x80, 0x78, 0x68, 0x60, 0x80, 0x9c, 0x7c, 0x5d, 0x6b, 0x7b, 0x7b, 0x60, 0x45, 0x28, 0x0c, 0x00,
+    0x00, 0x1b, 0x3a, 0x58, 0x74, 0x8f, 0x91, 0x81, 0x73, 0x80, 0x9c, 0x7c, 0x76, 0x85, 0x94, 0x8a, 0x6f, 0x52, 0x33, 0x14, 0x00,
+    0x00, 0x1c, 0x3b, 0x5a, 0x74, 0x81, 0x91, 0x9c, 0x8c, 0x81, 0x9c, 0x80, 0x8f, 0x9c, 0x8d, 0x80, 0x6e, 0x52, 0x33, 0x14, 0x00,
+    0x00, 0x13, 0x2f, 0x47, 0x58, 0x68, 0x76, 0x85, 0x94, 0xa0, 0xab, 0xa0, 0x91, 0x81, 0x74, 0x65, 0x55, 0x41, 0x28, 0x0c, 0x00,
+    0x00, 0x0e, 0x28, 0x3d, 0x4c, 0x5c, 0x6b, 0x7a, 0x89, 0xa5, 0xb5, 0xa1, 0x87, 0x78, 0x68, 0x58, 0x49, 0x39, 0x22, 0x07, 0x00,
+    0x00, 0x1a, 0x38, 0x54, 0x68, 0x77, 0x85, 0x94, 0x98, 0x8c, 0x9f, 0x8c, 0x9b, 0x91, 0x83, 0x74, 0x65, 0x4e, 0x30, 0x12, 0x00,
+    0x00, 0x1d, 0x3c, 0x5c, 0x7b, 0x91, 0x9c, 0x8d, 0x7f, 0x80, 0x9c, 0x7c, 0x81, 0x8f, 0x9c, 0x8d, 0x74, 0x54, 0x35, 0x15, 0x00,
+    0x00, 0x17, 0x35, 0x51, 0x6c, 0x86, 0x81, 0x73, 0x64, 0x80, 0x9c, 0x7c, 0x66, 0x76, 0x85, 0x81, 0x66, 0x4b, 0x2f, 0x11, 0x00,
+    0x00, 0x0a, 0x26, 0x41, 0x5d, 0x70, 0x68, 0x58, 0x60, 0x80, 0x9c, 0x7c, 0x5c, 0x5c, 0x6b, 0x71, 0x57, 0x3c, 0x20, 0x05, 0x00,
+    0x00, 0x00, 0x16, 0x30, 0x46, 0x50, 0x4c, 0x41, 0x60, 0x80, 0x98, 0x7c, 0x5c, 0x40, 0x4f, 0x53, 0x44, 0x2c, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x1a, 0x2a, 0x31, 0x2e, 0x40, 0x5f, 0x78, 0x78, 0x74, 0x5a, 0x3b, 0x32, 0x34, 0x2a, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x11, 0x18, 0x34, 0x4c, 0x58, 0x58, 0x57, 0x47, 0x2f, 0x14, 0x14, 0x0d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x20, 0x31, 0x39, 0x39, 0x38, 0x2e, 0x1a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x14, 0x19, 0x19, 0x18, 0x11, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+002B "+" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x17, 0x19, 0x19, 0x19, 0x15, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x29, 0x36, 0x39, 0x39, 0x39, 0x33, 0x22, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x27, 0x41, 0x55, 0x58, 0x58, 0x58, 0x4f, 0x38, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x30, 0x4f, 0x6d, 0x78, 0x78, 0x78, 0x63, 0x44, 0x24, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0x98, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x11, 0x31, 0x50, 0x70, 0x90, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x1d, 0x21, 0x21, 0x21, 0x31, 0x50, 0x70, 0x90, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x21, 0x21, 0x21, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x14, 0x2b, 0x3c, 0x40, 0x40, 0x40, 0x40, 0x50, 0x70, 0x90, 0xa4, 0x84, 0x64, 0x44, 0x40, 0x40, 0x40, 0x40, 0x36, 0x23, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x25, 0x40, 0x57, 0x60, 0x60, 0x60, 0x60, 0x60, 0x70, 0x90, 0xa4, 0x84, 0x64, 0x60, 0x60, 0x60, 0x60, 0x60, 0x4f, 0x36, 0x1a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2c, 0x4c, 0x6b, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x90, 0xa4, 0x85, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7c, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa4, 0xb1, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9f, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0x94, 0x94, 0x94, 0x94, 0x94, 0x9a, 0xaa, 0x95, 0x94, 0x94, 0x94, 0x94, 0x94, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x2c, 0x4b, 0x68, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x90, 0xa4, 0x84, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x5d, 0x3f, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x21, 0x3c, 0x4f, 0x54, 0x54, 0x54, 0x54, 0x54, 0x70, 0x90, 0xa4, 0x84, 0x64, 0x54, 0x54, 0x54, 0x54, 0x54, 0x49, 0x32, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x24, 0x32, 0x35, 0x35, 0x35, 0x35, 0x50, 0x70, 0x90, 0xa4, 0x84, 0x64, 0x44, 0x35, 0x35, 0x35, 0x35, 0x2e, 0x1d, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x13, 0x15, 0x15, 0x15, 0x31, 0x50, 0x70, 0x90, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x15, 0x15, 0x15, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x88, 0x88, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2d, 0x4a, 0x63, 0x68, 0x68, 0x68, 0x5b, 0x3f, 0x21, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1e, 0x36, 0x46, 0x48, 0x48, 0x48, 0x41, 0x2e, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1c, 0x27, 0x29, 0x29, 0x29, 0x24, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x09, 0x09, 0x09, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+002C "," */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x14, 0x19, 0x16, 0x0e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x19, 0x28, 0x33, 0x38, 0x34, 0x2d, 0x1e, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x1a, 0x31, 0x45, 0x52, 0x58, 0x54, 0x4a, 0x36, 0x20, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x2c, 0x47, 0x5d, 0x6f, 0x76, 0x73, 0x63, 0x4d, 0x34, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1a, 0x39, 0x56, 0x73, 0x89, 0x94, 0x8f, 0x79, 0x5f, 0x42, 0x24, 0x05, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x7d, 0x9b, 0xb3, 0xa4, 0x86, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x7d, 0x9a, 0xb2, 0xa5, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x1a, 0x38, 0x56, 0x71, 0x87, 0x9a, 0x9c, 0x80, 0x63, 0x44, 0x25, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x2c, 0x44, 0x5c, 0x78, 0x96, 0x93, 0x76, 0x58, 0x3a, 0x1c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x25, 0x44, 0x63, 0x80, 0x9d, 0x88, 0x6c, 0x4e, 0x30, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x2d, 0x4b, 0x6a, 0x88, 0x9c, 0x80, 0x63, 0x44, 0x26, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x34, 0x53, 0x71, 0x8f, 0x93, 0x76, 0x58, 0x3a, 0x1c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x88, 0x87, 0x6c, 0x4e, 0x30, 0x12, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x34, 0x51, 0x66, 0x68, 0x68, 0x5d, 0x43, 0x26, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x25, 0x3b, 0x48, 0x48, 0x48, 0x43, 0x31, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0e, 0x1f, 0x28, 0x29, 0x29, 0x25, 0x18, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+002D "-" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x14, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0e, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x28, 0x33, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x34, 0x2c, 0x1a, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x28, 0x41, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x47, 0x2f, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x14, 0x33, 0x52, 0x6e, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x73, 0x5a, 0x3b, 0x1c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x93, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7b, 0x5c, 0x3c, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x2e, 0x49, 0x5d, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x4f, 0x35, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x1d, 0x32, 0x3f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x36, 0x23, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x17, 0x20, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+002E "." */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x14, 0x19, 0x16, 0x0e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x19, 0x28, 0x33, 0x38, 0x34, 0x2c, 0x1d, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x1a, 0x31, 0x45, 0x52, 0x58, 0x54, 0x48, 0x36, 0x20, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x2e, 0x47, 0x5d, 0x6f, 0x76, 0x73, 0x63, 0x4d, 0x34, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3a, 0x58, 0x74, 0x89, 0x94, 0x8d, 0x79, 0x5f, 0x42, 0x24, 0x05, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0x9c, 0xb3, 0xa4, 0x86, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0x9c, 0xb4, 0xa3, 0x86, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3a, 0x58, 0x74, 0x89, 0x94, 0x8d, 0x79, 0x5f, 0x42, 0x24, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x2e, 0x47, 0x5d, 0x6f, 0x78, 0x73, 0x63, 0x4d, 0x33, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x1a, 0x31, 0x45, 0x52, 0x58, 0x54, 0x48, 0x36, 0x20, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x19, 0x28, 0x33, 0x39, 0x34, 0x2c, 0x1d, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x14, 0x19, 0x16, 0x0e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+002F "/" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x11, 0x11, 0x11, 0x0b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x27, 0x30, 0x31, 0x31, 0x30, 0x28, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x2a, 0x41, 0x4f, 0x50, 0x50, 0x50, 0x44, 0x2d, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3a, 0x56, 0x6d, 0x70, 0x70, 0x6f, 0x58, 0x3a, 0x1b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x28, 0x46, 0x63, 0x80, 0x90, 0x90, 0x7b, 0x5c, 0x3c, 0x1d, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x32, 0x50, 0x6d, 0x8a, 0xa7, 0x8c, 0x70, 0x52, 0x35, 0x17, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x3c, 0x5a, 0x78, 0x94, 0xa0, 0x83, 0x66, 0x48, 0x2a, 0x0c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x29, 0x47, 0x65, 0x81, 0x9d, 0x95, 0x78, 0x5c, 0x3e, 0x20, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x33, 0x51, 0x6f, 0x8b, 0xa7, 0x8b, 0x6f, 0x51, 0x33, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x3e, 0x5c, 0x78, 0x95, 0x9d, 0x80, 0x65, 0x47, 0x29, 0x0b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2a, 0x48, 0x66, 0x83, 0xa0, 0x94, 0x78, 0x5a, 0x3c, 0x1e, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x35, 0x52, 0x70, 0x8c, 0xa6, 0x8a, 0x6d, 0x50, 0x32, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x3f, 0x5d, 0x7b, 0x96, 0x9c, 0x80, 0x63, 0x45, 0x28, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2b, 0x49, 0x67, 0x84, 0xa1, 0x93, 0x76, 0x58, 0x3a, 0x1c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x37, 0x55, 0x71, 0x8d, 0xa5, 0x88, 0x6c, 0x4e, 0x30, 0x12, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x23, 0x41, 0x5f, 0x7c, 0x99, 0x9b, 0x7f, 0x61, 0x43, 0x25, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2e, 0x4b, 0x68, 0x85, 0xa3, 0x91, 0x75, 0x57, 0x39, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x38, 0x56, 0x74, 0x8f, 0xa4, 0x86, 0x6a, 0x4c, 0x2f, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x25, 0x42, 0x60, 0x7d, 0x9a, 0x9a, 0x7d, 0x60, 0x42, 0x24, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x2f, 0x4d, 0x6b, 0x86, 0xa4, 0x8f, 0x73, 0x56, 0x38, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x39, 0x57, 0x75, 0x91, 0xa3, 0x85, 0x68, 0x4b, 0x2d, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x26, 0x44, 0x61, 0x7f, 0x9b, 0x98, 0x7c, 0x5f, 0x41, 0x23, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x30, 0x4e, 0x6c, 0x88, 0xa6, 0x8d, 0x71, 0x53, 0x36, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1d, 0x3a, 0x58, 0x76, 0x93, 0xa1, 0x84, 0x67, 0x49, 0x2b, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x28, 0x46, 0x64, 0x80, 0x9c, 0x96, 0x7a, 0x5d, 0x3f, 0x21, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x14, 0x32, 0x50, 0x6d, 0x8a, 0xa7, 0x8c, 0x70, 0x52, 0x34, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x1f, 0x3d, 0x5a, 0x78, 0x94, 0x9f, 0x83, 0x66, 0x48, 0x2a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x29, 0x47, 0x65, 0x81, 0x9f, 0x95, 0x78, 0x5b, 0x3e, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x33, 0x51, 0x6f, 0x8b, 0xa7, 0x8b, 0x6f, 0x51, 0x33, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x20, 0x3e, 0x5c, 0x7a, 0x95, 0x9d, 0x80, 0x65, 0x47, 0x29, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0c, 0x2a, 0x48, 0x66, 0x83, 0xa0, 0x94, 0x78, 0x5a, 0x3c, 0x1e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x17, 0x35, 0x53, 0x70, 0x8c, 0xa6, 0x88, 0x6d, 0x50, 0x32, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x21, 0x3f, 0x5d, 0x7b, 0x98, 0x9c, 0x80, 0x63, 0x44, 0x27, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0x2b, 0x49, 0x67, 0x84, 0x98, 0x93, 0x76, 0x58, 0x3a, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0x2c, 0x4b, 0x6a, 0x78, 0x78, 0x78, 0x6a, 0x4e, 0x30, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x23, 0x3e, 0x53, 0x58, 0x58, 0x58, 0x53, 0x3e, 0x23, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x27, 0x35, 0x39, 0x39, 0x39, 0x35, 0x27, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x17, 0x19, 0x19, 0x19, 0x17, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0030 "0" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x05, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x11, 0x1a, 0x21, 0x25, 0x25, 0x25, 0x23, 0x1c, 0x14, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x21, 0x2e, 0x39, 0x40, 0x44, 0x44, 0x44, 0x42, 0x3b, 0x32, 0x27, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1a, 0x2d, 0x3e, 0x4c, 0x57, 0x60, 0x64, 0x64, 0x64, 0x60, 0x5a, 0x50, 0x43, 0x33, 0x22, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x33, 0x47, 0x58, 0x68, 0x74, 0x7d, 0x83, 0x84, 0x84, 0x80, 0x78, 0x6d, 0x5e, 0x4e, 0x3a, 0x25, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x1b, 0x33, 0x4a, 0x60, 0x73, 0x83, 0x90, 0x9b, 0xa0, 0xa4, 0xa4, 0x9c, 0x94, 0x88, 0x79, 0x66, 0x52, 0x3c, 0x23, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x2e, 0x47, 0x60, 0x77, 0x8a, 0x9d, 0xab, 0xa0, 0x98, 0x98, 0x98, 0x9c, 0xa8, 0xa2, 0x92, 0x7f, 0x69, 0x4f, 0x36, 0x1c, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x23, 0x3f, 0x5a, 0x74, 0x8c, 0xa3, 0xa5, 0x92, 0x83, 0x7b, 0x78, 0x78, 0x80, 0x8c, 0x9d, 0xaa, 0x93, 0x7c, 0x63, 0x48, 0x2e, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x31, 0x4e, 0x6a, 0x84, 0x9d, 0xa5, 0x8f, 0x79, 0x68, 0x5c, 0x58, 0x5a, 0x63, 0x74, 0x87, 0x9d, 0xa6, 0x8c, 0x74, 0x58, 0x3c, 0x1f, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x20, 0x3e, 0x5c, 0x78, 0x93, 0xad, 0x94, 0x7b, 0x63, 0x4e, 0x3e, 0x39, 0x3b, 0x47, 0x5b, 0x73, 0x8c, 0xa6, 0x9d, 0x81, 0x66, 0x48, 0x2b, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x2b, 0x49, 0x66, 0x83, 0xa0, 0xa2, 0x85, 0x6a, 0x50, 0x36, 0x22, 0x19, 0x1c, 0x2e, 0x47, 0x61, 0x7d, 0x98, 0xaa, 0x8d, 0x71, 0x53, 0x35, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x13, 0x33, 0x51, 0x70, 0x8c, 0xab, 0x98, 0x7b, 0x5e, 0x41, 0x24, 0x0a, 0x00, 0x02, 0x1b, 0x36, 0x53, 0x71, 0x8d, 0xab, 0x97, 0x7a, 0x5c, 0x3d, 0x1e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0x38, 0x58, 0x76, 0x94, 0xaf, 0x90, 0x74, 0x55, 0x36, 0x17, 0x00, 0x00, 0x00, 0x0d, 0x2b, 0x49, 0x68, 0x86, 0xa4, 0x9f, 0x80, 0x63, 0x44, 0x24, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x99, 0xac, 0x8c, 0x6c, 0x4e, 0x2f, 0x10, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x80, 0xa0, 0xa4, 0x84, 0x67, 0x48, 0x28, 0x09, 0x00, 0x00,
+    0x00, 0x01, 0x20, 0x40, 0x5f, 0x7c, 0x9c, 0xa8, 0x88, 0x69, 0x4b, 0x2c, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x21, 0x40, 0x60, 0x7f, 0x9c, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0xa0, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9c, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0x9f, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x3e, 0x5c, 0x7c, 0x9c, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x1e, 0x3d, 0x5c, 0x7c, 0x9c, 0xa8, 0x88, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x21, 0x40, 0x60, 0x80, 0xa0, 0xa6, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3c, 0x5b, 0x78, 0x98, 0xac, 0x8c, 0x70, 0x50, 0x32, 0x13, 0x00, 0x00, 0x00, 0x08, 0x27, 0x46, 0x64, 0x84, 0xa1, 0xa1, 0x84, 0x64, 0x45, 0x26, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x36, 0x55, 0x74, 0x91, 0xaf, 0x94, 0x76, 0x58, 0x39, 0x1c, 0x00, 0x00, 0x00, 0x12, 0x2f, 0x4d, 0x6c, 0x88, 0xa7, 0x9c, 0x7f, 0x60, 0x40, 0x21, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x2f, 0x4e, 0x6c, 0x88, 0xa6, 0x9b, 0x7f, 0x63, 0x46, 0x2a, 0x12, 0x05, 0x0c, 0x22, 0x3c, 0x58, 0x76, 0x91, 0xae, 0x94, 0x76, 0x58, 0x3a, 0x1b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x26, 0x44, 0x63, 0x80, 0x9b, 0xa8, 0x8c, 0x71, 0x56, 0x3f, 0x2d, 0x25, 0x29, 0x38, 0x4f, 0x68, 0x81, 0x9d, 0xa5, 0x88, 0x6c, 0x4f, 0x32, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1c, 0x3a, 0x56, 0x73, 0x8d, 0xa9, 0x9a, 0x81, 0x6b, 0x58, 0x4b, 0x44, 0x48, 0x52, 0x63, 0x7a, 0x92, 0xac, 0x96, 0x7d, 0x61, 0x43, 0x26, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x2c, 0x48, 0x65, 0x7f, 0x97, 0xad, 0x97, 0x83, 0x73, 0x69, 0x64, 0x66, 0x6f, 0x7d, 0x8f, 0xa5, 0xa0, 0x86, 0x6d, 0x52, 0x36, 0x1a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x1e, 0x39, 0x53, 0x6b, 0x84, 0x9a, 0xac, 0x9d, 0x8f, 0x86, 0x84, 0x84, 0x8b, 0x96, 0xa8, 0xa0, 0x89, 0x74, 0x5c, 0x41, 0x27, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0d, 0x27, 0x3f, 0x58, 0x6e, 0x81, 0x93, 0xa1, 0xab, 0xa4, 0xa4, 0xa4, 0xa9, 0xa6, 0x98, 0x87, 0x74, 0x5d, 0x47, 0x30, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x2b, 0x41, 0x55, 0x69, 0x79, 0x85, 0x8f, 0x94, 0x98, 0x96, 0x91, 0x88, 0x7d, 0x6e, 0x5d, 0x47, 0x31, 0x1a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x29, 0x3d, 0x4e, 0x5d, 0x68, 0x71, 0x78, 0x78, 0x78, 0x74, 0x6c, 0x61, 0x53, 0x43, 0x30, 0x1a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x23, 0x33, 0x3f, 0x4b, 0x53, 0x58, 0x58, 0x58, 0x54, 0x4e, 0x44, 0x36, 0x28, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x17, 0x23, 0x2d, 0x34, 0x39, 0x39, 0x39, 0x35, 0x2f, 0x26, 0x1a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x14, 0x19, 0x19, 0x19, 0x16, 0x11, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0031 "1" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x1a, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x17, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x28, 0x38, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x35, 0x23, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x21, 0x3d, 0x54, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x4f, 0x36, 0x1a, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0x28, 0x48, 0x67, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x09, 0x29, 0x48, 0x68, 0x88, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x09, 0x29, 0x48, 0x68, 0x88, 0x9c, 0x9c, 0x9c, 0x9c, 0x9d, 0xb1, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x09, 0x28, 0x48, 0x67, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x88, 0xa8, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x03, 0x21, 0x3d, 0x54, 0x5c, 0x5c, 0x5c, 0x5c, 0x68, 0x88, 0xa8, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x28, 0x38, 0x3d, 0x3d, 0x3d, 0x48, 0x68, 0x88, 0xa8, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x1a, 0x1d, 0x1d, 0x29, 0x48, 0x68, 0x88, 0xa8, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0x90, 0x90, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x27, 0x46, 0x63, 0x70, 0x70, 0x70, 0x70, 0x5c, 0x3e, 0x1f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x36, 0x4a, 0x50, 0x50, 0x50, 0x50, 0x46, 0x30, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1e, 0x2d, 0x31, 0x31, 0x31, 0x31, 0x2a, 0x1a, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0032 "2" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0d, 0x17, 0x1e, 0x23, 0x25, 0x25, 0x25, 0x24, 0x1f, 0x17, 0x0e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x1f, 0x2b, 0x35, 0x3d, 0x42, 0x44, 0x44, 0x44, 0x44, 0x3e, 0x36, 0x2b, 0x1e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0b, 0x1d, 0x2e, 0x3c, 0x49, 0x53, 0x5c, 0x60, 0x64, 0x64, 0x64, 0x63, 0x5c, 0x55, 0x48, 0x3a, 0x29, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x23, 0x38, 0x49, 0x58, 0x66, 0x71, 0x7a, 0x80, 0x84, 0x84, 0x84, 0x80, 0x7b, 0x71, 0x65, 0x55, 0x42, 0x2e, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x23, 0x39, 0x4f, 0x63, 0x74, 0x81, 0x8d, 0x97, 0x9f, 0xa4, 0xa4, 0xa4, 0xa0, 0x98, 0x8d, 0x80, 0x6e, 0x5b, 0x44, 0x2a, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1a, 0x36, 0x4f, 0x66, 0x7c, 0x8d, 0x9d, 0xaa, 0xa1, 0x9a, 0x98, 0x98, 0x98, 0x9c, 0xa6, 0xaa, 0x9a, 0x86, 0x6f, 0x56, 0x3c, 0x1f, 0x03, 0x00, 0x00, 0x00,
+    0x01, 0x21, 0x40, 0x60, 0x7c, 0x92, 0xa8, 0x9f, 0x8f, 0x84, 0x7c, 0x78, 0x78, 0x78, 0x80, 0x8a, 0x9d, 0xb0, 0x9a, 0x81, 0x66, 0x49, 0x2b, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x1e, 0x3d, 0x5a, 0x6f, 0x84, 0x97, 0x86, 0x74, 0x67, 0x5d, 0x58, 0x58, 0x5a, 0x63, 0x71, 0x87, 0x9f, 0xab, 0x8d, 0x71, 0x53, 0x34, 0x16, 0x00, 0x00, 0x00,
+    0x00, 0x13, 0x2d, 0x44, 0x58, 0x6b, 0x81, 0x6e, 0x5b, 0x4a, 0x3f, 0x39, 0x39, 0x3b, 0x46, 0x5b, 0x76, 0x91, 0xb0, 0x96, 0x78, 0x58, 0x39, 0x1a, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x17, 0x2b, 0x3f, 0x55, 0x64, 0x58, 0x42, 0x2f, 0x21, 0x1a, 0x19, 0x1c, 0x30, 0x4f, 0x6d, 0x8c, 0xac, 0x9a, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x28, 0x3c, 0x44, 0x3e, 0x2b, 0x16, 0x03, 0x00, 0x00, 0x12, 0x31, 0x50, 0x6f, 0x8c, 0xac, 0x98, 0x78, 0x58, 0x39, 0x1a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x25, 0x20, 0x12, 0x00, 0x00, 0x00, 0x0a, 0x23, 0x3d, 0x58, 0x76, 0x93, 0xae, 0x91, 0x74, 0x55, 0x36, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x09, 0x20, 0x36, 0x4f, 0x69, 0x81, 0x9d, 0xa4, 0x86, 0x6b, 0x4d, 0x2f, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x36, 0x4d, 0x63, 0x7b, 0x93, 0xac, 0x94, 0x7a, 0x5f, 0x42, 0x25, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x20, 0x36, 0x4d, 0x63, 0x79, 0x8f, 0xa5, 0x9a, 0x81, 0x6a, 0x4f, 0x34, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x23, 0x39, 0x4d, 0x63, 0x79, 0x8f, 0xa5, 0x9d, 0x85, 0x6e, 0x57, 0x3e, 0x24, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x23, 0x39, 0x4f, 0x66, 0x79, 0x8f, 0xa5, 0x9a, 0x87, 0x71, 0x5b, 0x41, 0x2b, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x23, 0x39, 0x4f, 0x66, 0x7c, 0x8f, 0xa5, 0x9a, 0x84, 0x6f, 0x5b, 0x44, 0x2e, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x25, 0x39, 0x4f, 0x66, 0x7c, 0x92, 0xa8, 0x9a, 0x84, 0x6e, 0x58, 0x44, 0x2e, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x25, 0x3c, 0x52, 0x66, 0x7c, 0x92, 0xa8, 0x9a, 0x84, 0x6e, 0x58, 0x41, 0x2b, 0x17, 0x09, 0x09, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x25, 0x3c, 0x52, 0x69, 0x7d, 0x92, 0xa8, 0x97, 0x81, 0x6e, 0x58, 0x41, 0x2c, 0x29, 0x29, 0x29, 0x29, 0x28, 0x1f, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x25, 0x3c, 0x52, 0x69, 0x7f, 0x95, 0xa8, 0x97, 0x81, 0x6b, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x3b, 0x25, 0x0a, 0x00, 0x00,
+    0x00, 0x04, 0x21, 0x3c, 0x52, 0x69, 0x7f, 0x95, 0xab, 0x97, 0x81, 0x6c, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x66, 0x51, 0x34, 0x16, 0x00, 0x00,
+    0x00, 0x0c, 0x2c, 0x4b, 0x68, 0x7f, 0x95, 0xab, 0xad, 0x8f, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00,
+    0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xab, 0xb0, 0xb0, 0xaa, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00,
+    0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00,
+    0x00, 0x0c, 0x2b, 0x49, 0x66, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x6d, 0x55, 0x36, 0x17, 0x00, 0x00,
+    0x00, 0x03, 0x1f, 0x39, 0x4c, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4f, 0x41, 0x29, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x21, 0x2e, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x27, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x0f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0033 "3" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x1a, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x14, 0x2a, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x2d, 0x17, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x25, 0x40, 0x56, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x58, 0x44, 0x28, 0x0b, 0x00, 0x00, 0x00,
+    0x00, 0x0d, 0x2c, 0x4c, 0x6b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x6f, 0x50, 0x30, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa3, 0xba, 0xa8, 0x8f, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x0d, 0x2c, 0x4c, 0x6b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x94, 0xae, 0x95, 0x7d, 0x66, 0x4a, 0x2d, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x25, 0x40, 0x56, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5d, 0x74, 0x89, 0xa3, 0x9a, 0x81, 0x6a, 0x52, 0x39, 0x1f, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x14, 0x2a, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3f, 0x56, 0x6e, 0x86, 0x9d, 0x9d, 0x87, 0x6e, 0x56, 0x3e, 0x25, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x1a, 0x1d, 0x1d, 0x1d, 0x1d, 0x21, 0x39, 0x52, 0x6a, 0x81, 0x9a, 0xa3, 0x8a, 0x74, 0x5b, 0x43, 0x2a, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1d, 0x34, 0x4d, 0x66, 0x7d, 0x95, 0xa8, 0x8f, 0x78, 0x60, 0x47, 0x2e, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x30, 0x49, 0x60, 0x79, 0x91, 0xa8, 0x94, 0x7c, 0x63, 0x4c, 0x33, 0x20, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x22, 0x41, 0x5d, 0x74, 0x8c, 0xa4, 0x98, 0x81, 0x6b, 0x64, 0x58, 0x4b, 0x3b, 0x28, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa0, 0xb6, 0x9a, 0x8c, 0x88, 0x80, 0x76, 0x66, 0x55, 0x3f, 0x28, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa0, 0xa0, 0xa4, 0xa7, 0xa6, 0x9d, 0x8f, 0x80, 0x6b, 0x55, 0x3d, 0x23, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x80, 0x80, 0x80, 0x84, 0x88, 0x91, 0x9f, 0xab, 0x97, 0x81, 0x69, 0x4e, 0x31, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x3c, 0x55, 0x60, 0x60, 0x60, 0x64, 0x6b, 0x76, 0x85, 0x9a, 0xad, 0x93, 0x78, 0x5c, 0x3e, 0x20, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0b, 0x11, 0x0e, 0x10, 0x28, 0x3a, 0x40, 0x40, 0x42, 0x46, 0x4d, 0x5b, 0x71, 0x88, 0xa5, 0xa0, 0x83, 0x65, 0x47, 0x28, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x17, 0x28, 0x30, 0x2d, 0x1e, 0x0f, 0x1c, 0x21, 0x21, 0x23, 0x27, 0x2f, 0x44, 0x61, 0x7f, 0x9c, 0xa8, 0x88, 0x6b, 0x4c, 0x2c, 0x0d, 0x00, 0x00,
+    0x00, 0x00, 0x13, 0x2d, 0x44, 0x50, 0x4a, 0x36, 0x25, 0x17, 0x0d, 0x07, 0x06, 0x0a, 0x1d, 0x3d, 0x5c, 0x7c, 0x9c, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00,
+    0x00, 0x08, 0x23, 0x3f, 0x5a, 0x6f, 0x63, 0x50, 0x3f, 0x34, 0x2c, 0x26, 0x25, 0x28, 0x31, 0x46, 0x63, 0x80, 0x9c, 0xa7, 0x88, 0x6a, 0x4b, 0x2c, 0x0c, 0x00, 0x00,
+    0x00, 0x18, 0x33, 0x4f, 0x6a, 0x84, 0x7b, 0x6b, 0x5d, 0x52, 0x4b, 0x45, 0x44, 0x48, 0x4e, 0x5d, 0x71, 0x8a, 0xa6, 0x9d, 0x80, 0x64, 0x46, 0x27, 0x08, 0x00, 0x00,
+    0x06, 0x25, 0x43, 0x5f, 0x7a, 0x93, 0x94, 0x85, 0x7a, 0x70, 0x69, 0x64, 0x64, 0x66, 0x6c, 0x78, 0x87, 0x9d, 0xab, 0x91, 0x76, 0x5a, 0x3c, 0x1d, 0x00, 0x00, 0x00,
+    0x09, 0x29, 0x48, 0x68, 0x86, 0x9a, 0xab, 0xa1, 0x96, 0x8d, 0x88, 0x84, 0x84, 0x84, 0x8a, 0x93, 0xa1, 0xaa, 0x95, 0x7f, 0x66, 0x4c, 0x2f, 0x13, 0x00, 0x00, 0x00,
+    0x05, 0x24, 0x41, 0x5b, 0x71, 0x80, 0x8f, 0x9b, 0xa5, 0xaa, 0xa6, 0xa4, 0xa4, 0xa4, 0xa8, 0xa9, 0x9f, 0x8f, 0x7f, 0x6b, 0x52, 0x3b, 0x21, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x16, 0x2e, 0x44, 0x56, 0x66, 0x74, 0x7f, 0x88, 0x8f, 0x94, 0x98, 0x98, 0x97, 0x93, 0x8b, 0x81, 0x76, 0x66, 0x52, 0x3f, 0x26, 0x0e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x17, 0x2a, 0x3b, 0x4a, 0x56, 0x61, 0x6a, 0x70, 0x74, 0x78, 0x78, 0x78, 0x74, 0x6f, 0x66, 0x5a, 0x4b, 0x3a, 0x25, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x1f, 0x2e, 0x39, 0x43, 0x4b, 0x51, 0x55, 0x58, 0x58, 0x58, 0x54, 0x50, 0x48, 0x3d, 0x2f, 0x1f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x10, 0x1b, 0x25, 0x2d, 0x33, 0x36, 0x39, 0x39, 0x39, 0x35, 0x31, 0x29, 0x1f, 0x13, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0e, 0x13, 0x17, 0x19, 0x19, 0x19, 0x17, 0x12, 0x0b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0034 "4" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x16, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x33, 0x3c, 0x3d, 0x3d, 0x3d, 0x3a, 0x2d, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1d, 0x36, 0x4d, 0x5c, 0x5c, 0x5c, 0x5c, 0x58, 0x44, 0x28, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x49, 0x63, 0x79, 0x7c, 0x7c, 0x7c, 0x6f, 0x50, 0x30, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x2b, 0x44, 0x5d, 0x74, 0x8c, 0x9c, 0x97, 0x7f, 0x66, 0x4c, 0x2e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x25, 0x3e, 0x57, 0x6f, 0x87, 0xa0, 0x9d, 0x84, 0x6b, 0x53, 0x3a, 0x21, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x20, 0x39, 0x52, 0x6a, 0x81, 0x9a, 0xa2, 0x89, 0x71, 0x58, 0x3f, 0x27, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1a, 0x33, 0x4c, 0x66, 0x7d, 0x95, 0xa8, 0x8f, 0x77, 0x5e, 0x45, 0x2d, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x2e, 0x47, 0x60, 0x78, 0x8f, 0xa8, 0x94, 0x7c, 0x63, 0x4a, 0x32, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x28, 0x41, 0x5b, 0x73, 0x8a, 0xa3, 0x9a, 0x81, 0x69, 0x50, 0x38, 0x1e, 0x15, 0x12, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x23, 0x3c, 0x55, 0x6e, 0x85, 0x9d, 0x9f, 0x87, 0x6e, 0x55, 0x3d, 0x35, 0x35, 0x35, 0x30, 0x22, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1d, 0x36, 0x4f, 0x69, 0x80, 0x98, 0xa4, 0x8c, 0x74, 0x5b, 0x45, 0x53, 0x54, 0x54, 0x54, 0x4e, 0x39, 0x1e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x31, 0x4a, 0x63, 0x7b, 0x93, 0xa9, 0x92, 0x79, 0x60, 0x48, 0x56, 0x71, 0x74, 0x74, 0x74, 0x65, 0x47, 0x28, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x2c, 0x44, 0x5d, 0x76, 0x8d, 0xa5, 0x97, 0x7f, 0x66, 0x4e, 0x39, 0x58, 0x78, 0x94, 0x94, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x26, 0x3f, 0x58, 0x71, 0x88, 0xa0, 0x9d, 0x84, 0x6c, 0x53, 0x3b, 0x39, 0x58, 0x78, 0x98, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x19, 0x17, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x21, 0x39, 0x52, 0x6b, 0x83, 0x9b, 0xa2, 0x89, 0x71, 0x58, 0x40, 0x39, 0x3a, 0x58, 0x78, 0x98, 0xa8, 0x88, 0x68, 0x48, 0x39, 0x39, 0x36, 0x29, 0x14, 0x00, 0x00,
+    0x00, 0x00, 0x1a, 0x33, 0x4d, 0x66, 0x7f, 0x96, 0xa8, 0x8f, 0x77, 0x5e, 0x58, 0x58, 0x58, 0x58, 0x59, 0x78, 0x98, 0xa8, 0x88, 0x68, 0x58, 0x58, 0x58, 0x55, 0x41, 0x27, 0x09, 0x00,
+    0x00, 0x07, 0x26, 0x44, 0x60, 0x79, 0x91, 0xa9, 0x98, 0x7c, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x79, 0x98, 0xa8, 0x88, 0x78, 0x78, 0x78, 0x78, 0x6d, 0x4f, 0x30, 0x10, 0x00,
+    0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa3, 0xbb, 0xa3, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0xa3, 0xaf, 0x9a, 0x98, 0x98, 0x98, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00,
+    0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xab, 0xb4, 0xa1, 0xa0, 0xa0, 0xa0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00,
+    0x00, 0x09, 0x29, 0x48, 0x68, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x9c, 0xa8, 0x88, 0x80, 0x80, 0x80, 0x80, 0x70, 0x50, 0x31, 0x11, 0x00,
+    0x00, 0x04, 0x23, 0x3f, 0x57, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x7c, 0x9c, 0xa8, 0x88, 0x68, 0x60, 0x60, 0x60, 0x5c, 0x46, 0x2a, 0x0c, 0x00,
+    0x00, 0x00, 0x13, 0x2b, 0x3c, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x5c, 0x7c, 0x9c, 0xa8, 0x88, 0x68, 0x48, 0x40, 0x40, 0x3e, 0x30, 0x1a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x1d, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x3d, 0x5c, 0x7c, 0x9c, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x21, 0x1f, 0x15, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1d, 0x3d, 0x5c, 0x7c, 0x9c, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x90, 0x90, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x3a, 0x58, 0x6f, 0x70, 0x70, 0x70, 0x63, 0x46, 0x27, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x2d, 0x44, 0x50, 0x50, 0x50, 0x50, 0x4a, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x28, 0x30, 0x31, 0x31, 0x31, 0x2d, 0x1e, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0035 "5" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x25, 0x36, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x2d, 0x17, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1d, 0x3a, 0x52, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x58, 0x44, 0x28, 0x0b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x27, 0x46, 0x64, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x6f, 0x50, 0x30, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x29, 0x48, 0x68, 0x88, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8b, 0xa9, 0xa1, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x8c, 0xac, 0x90, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x6f, 0x50, 0x30, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x14, 0x34, 0x53, 0x71, 0x90, 0xac, 0x8c, 0x70, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x58, 0x44, 0x28, 0x0b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x36, 0x55, 0x74, 0x94, 0xa9, 0x8b, 0x6c, 0x4c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x2d, 0x17, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1a, 0x39, 0x58, 0x78, 0x98, 0xa7, 0x88, 0x68, 0x48, 0x29, 0x20, 0x1f, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9a, 0xa4, 0x84, 0x64, 0x46, 0x40, 0x40, 0x3c, 0x38, 0x32, 0x29, 0x1f, 0x11, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x21, 0x40, 0x60, 0x7f, 0x9c, 0xa0, 0x80, 0x63, 0x60, 0x60, 0x5f, 0x5c, 0x58, 0x50, 0x47, 0x3c, 0x2e, 0x1c, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x24, 0x44, 0x63, 0x80, 0xa0, 0xa0, 0x81, 0x80, 0x80, 0x80, 0x7c, 0x7b, 0x76, 0x6f, 0x65, 0x58, 0x48, 0x36, 0x20, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x27, 0x46, 0x64, 0x84, 0xa4, 0xae, 0xa0, 0xa0, 0xa0, 0xa0, 0x9c, 0x98, 0x94, 0x8b, 0x81, 0x74, 0x63, 0x4d, 0x36, 0x1f, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa0, 0xa8, 0xa9, 0x9d, 0x8c, 0x79, 0x63, 0x4b, 0x31, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x28, 0x48, 0x67, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7f, 0x83, 0x8a, 0x96, 0xa8, 0xa5, 0x8f, 0x77, 0x5c, 0x3f, 0x23, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x21, 0x3d, 0x54, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x60, 0x65, 0x6d, 0x7c, 0x92, 0xa9, 0xa1, 0x85, 0x6a, 0x4c, 0x2e, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x28, 0x38, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x47, 0x51, 0x66, 0x7f, 0x9a, 0xae, 0x90, 0x73, 0x54, 0x34, 0x16, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x23, 0x2f, 0x2f, 0x25, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x21, 0x28, 0x39, 0x55, 0x73, 0x90, 0xb0, 0x96, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x24, 0x3c, 0x4d, 0x4e, 0x3f, 0x2a, 0x1c, 0x10, 0x09, 0x05, 0x07, 0x12, 0x31, 0x50, 0x70, 0x90, 0xb0, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0x34, 0x4f, 0x69, 0x6b, 0x56, 0x46, 0x38, 0x2f, 0x28, 0x25, 0x26, 0x2d, 0x3d, 0x57, 0x75, 0x91, 0xaf, 0x94, 0x75, 0x57, 0x38, 0x18, 0x00, 0x00,
+    0x00, 0x0e, 0x28, 0x45, 0x5f, 0x7a, 0x81, 0x71, 0x63, 0x56, 0x4d, 0x48, 0x44, 0x45, 0x4b, 0x56, 0x69, 0x81, 0x9b, 0xa9, 0x8b, 0x6f, 0x51, 0x33, 0x13, 0x00, 0x00,
+    0x00, 0x1a, 0x38, 0x54, 0x6f, 0x89, 0x9a, 0x8a, 0x7f, 0x74, 0x6c, 0x66, 0x64, 0x64, 0x6a, 0x73, 0x81, 0x95, 0xad, 0x9a, 0x80, 0x65, 0x47, 0x29, 0x0b, 0x00, 0x00,
+    0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x93, 0xa4, 0xa6, 0x9a, 0x90, 0x88, 0x84, 0x84, 0x84, 0x88, 0x8f, 0x9b, 0xad, 0x9d, 0x88, 0x71, 0x56, 0x3a, 0x1e, 0x01, 0x00, 0x00,
+    0x00, 0x18, 0x36, 0x52, 0x69, 0x7a, 0x88, 0x96, 0xa1, 0xaa, 0xa8, 0xa4, 0xa4, 0xa4, 0xa6, 0xab, 0xa4, 0x96, 0x86, 0x74, 0x5d, 0x44, 0x2a, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x0c, 0x25, 0x3c, 0x4f, 0x5f, 0x6f, 0x7b, 0x84, 0x8c, 0x91, 0x95, 0x98, 0x98, 0x94, 0x8f, 0x86, 0x7b, 0x6d, 0x5b, 0x47, 0x31, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x23, 0x34, 0x44, 0x51, 0x5d, 0x67, 0x6d, 0x74, 0x78, 0x78, 0x78, 0x75, 0x70, 0x6a, 0x5f, 0x51, 0x41, 0x2e, 0x1a, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x18, 0x28, 0x35, 0x3f, 0x48, 0x4f, 0x54, 0x58, 0x58, 0x58, 0x57, 0x52, 0x4b, 0x42, 0x35, 0x27, 0x16, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x17, 0x21, 0x2a, 0x30, 0x35, 0x39, 0x39, 0x39, 0x38, 0x33, 0x2d, 0x24, 0x18, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0b, 0x11, 0x15, 0x19, 0x19, 0x19, 0x18, 0x14, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0036 "6" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x05, 0x05, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x12, 0x1a, 0x20, 0x25, 0x25, 0x25, 0x25, 0x21, 0x1c, 0x16, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x25, 0x30, 0x39, 0x40, 0x44, 0x44, 0x44, 0x44, 0x40, 0x3c, 0x34, 0x2a, 0x1c, 0x0d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x23, 0x33, 0x41, 0x4e, 0x57, 0x5f, 0x64, 0x64, 0x64, 0x64, 0x60, 0x5b, 0x52, 0x46, 0x38, 0x25, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x29, 0x3d, 0x4f, 0x5e, 0x6b, 0x75, 0x7c, 0x81, 0x84, 0x84, 0x84, 0x80, 0x78, 0x70, 0x63, 0x52, 0x3a, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x2b, 0x41, 0x55, 0x69, 0x7a, 0x86, 0x93, 0x9b, 0xa0, 0xa4, 0xa4, 0xa1, 0x9c, 0x96, 0x8c, 0x7f, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0d, 0x27, 0x3f, 0x58, 0x6e, 0x81, 0x93, 0xa2, 0xa8, 0x9c, 0x97, 0x94, 0x94, 0x94, 0x99, 0xa1, 0x96, 0x7b, 0x5e, 0x41, 0x22, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x1e, 0x39, 0x53, 0x6b, 0x84, 0x9a, 0xab, 0x9a, 0x8a, 0x80, 0x78, 0x74, 0x74, 0x76, 0x7c, 0x84, 0x88, 0x6d, 0x51, 0x35, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x2c, 0x48, 0x65, 0x7f, 0x97, 0xab, 0x95, 0x81, 0x71, 0x63, 0x5a, 0x54, 0x54, 0x58, 0x5d, 0x68, 0x74, 0x5f, 0x43, 0x27, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1d, 0x3a, 0x56, 0x73, 0x8d, 0xa9, 0x98, 0x81, 0x69, 0x55, 0x46, 0x3b, 0x35, 0x35, 0x38, 0x3f, 0x4c, 0x54, 0x49, 0x33, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x28, 0x46, 0x64, 0x80, 0x9b, 0xa4, 0x88, 0x6f, 0x55, 0x3d, 0x2a, 0x25, 0x25, 0x24, 0x1f, 0x21, 0x2f, 0x35, 0x2e, 0x1d, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x30, 0x4f, 0x6d, 0x8a, 0xa8, 0x9a, 0x7d, 0x60, 0x44, 0x3c, 0x40, 0x44, 0x44, 0x43, 0x3e, 0x37, 0x2d, 0x1f, 0x12, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x37, 0x56, 0x74, 0x91, 0xae, 0x90, 0x74, 0x56, 0x51, 0x5b, 0x60, 0x64, 0x64, 0x61, 0x5c, 0x56, 0x4a, 0x3c, 0x2d, 0x1a, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3c, 0x5b, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x61, 0x6f, 0x78, 0x80, 0x83, 0x84, 0x80, 0x7c, 0x73, 0x66, 0x58, 0x47, 0x31, 0x1a, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1e, 0x3d, 0x5c, 0x7c, 0x9c, 0xa8, 0x88, 0x6c, 0x7c, 0x8a, 0x95, 0x9c, 0xa0, 0xa4, 0xa0, 0x99, 0x8f, 0x81, 0x73, 0x5d, 0x47, 0x30, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0x9f, 0xa8, 0x88, 0x81, 0x95, 0xa3, 0x99, 0x91, 0x90, 0x90, 0x95, 0x9f, 0xaa, 0x9d, 0x89, 0x74, 0x5d, 0x43, 0x28, 0x0c, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0xa0, 0xa9, 0x8c, 0x95, 0x9a, 0x88, 0x7c, 0x74, 0x70, 0x71, 0x78, 0x81, 0x92, 0xa8, 0xa0, 0x87, 0x6e, 0x53, 0x36, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x3f, 0x5d, 0x7c, 0x9c, 0xb8, 0xa9, 0x9b, 0x84, 0x6f, 0x5f, 0x55, 0x50, 0x53, 0x5a, 0x68, 0x7c, 0x92, 0xac, 0x98, 0x7c, 0x5f, 0x41, 0x23, 0x04, 0x00,
+    0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x99, 0xb8, 0xa9, 0x8c, 0x71, 0x58, 0x44, 0x37, 0x31, 0x34, 0x3d, 0x4f, 0x68, 0x81, 0x9f, 0xa3, 0x85, 0x68, 0x49, 0x2a, 0x0b, 0x00,
+    0x00, 0x00, 0x19, 0x38, 0x58, 0x76, 0x94, 0xb3, 0xa0, 0x83, 0x65, 0x47, 0x2c, 0x19, 0x11, 0x15, 0x23, 0x3d, 0x5c, 0x7a, 0x98, 0xaa, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00,
+    0x00, 0x00, 0x13, 0x33, 0x51, 0x70, 0x8c, 0xab, 0xa0, 0x80, 0x60, 0x42, 0x23, 0x07, 0x00, 0x00, 0x1a, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00,
+    0x00, 0x00, 0x0c, 0x2b, 0x49, 0x67, 0x83, 0xa0, 0xa4, 0x85, 0x68, 0x4c, 0x33, 0x23, 0x1d, 0x1f, 0x2b, 0x43, 0x5f, 0x7c, 0x9a, 0xa6, 0x88, 0x6a, 0x4b, 0x2c, 0x0c, 0x00,
+    0x00, 0x00, 0x03, 0x21, 0x3e, 0x5c, 0x78, 0x93, 0xac, 0x91, 0x77, 0x60, 0x4e, 0x41, 0x3d, 0x3e, 0x46, 0x57, 0x6e, 0x87, 0xa3, 0x9d, 0x80, 0x64, 0x45, 0x26, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x31, 0x4e, 0x6a, 0x83, 0x9d, 0xa3, 0x8a, 0x78, 0x6a, 0x60, 0x5c, 0x5c, 0x64, 0x71, 0x81, 0x98, 0xa9, 0x8f, 0x74, 0x58, 0x3c, 0x1d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x23, 0x3e, 0x58, 0x71, 0x89, 0x9d, 0xa3, 0x92, 0x85, 0x7f, 0x7c, 0x7c, 0x80, 0x8c, 0x9a, 0xa8, 0x95, 0x7f, 0x65, 0x4a, 0x2e, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x2d, 0x45, 0x5d, 0x74, 0x86, 0x96, 0xa4, 0xa3, 0x9c, 0x9c, 0x9c, 0xa0, 0xa7, 0x9f, 0x8f, 0x7f, 0x69, 0x52, 0x39, 0x1e, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x31, 0x47, 0x5b, 0x6d, 0x7b, 0x86, 0x8f, 0x94, 0x98, 0x98, 0x94, 0x8c, 0x83, 0x76, 0x66, 0x52, 0x3c, 0x25, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1a, 0x2e, 0x41, 0x51, 0x5f, 0x6a, 0x71, 0x76, 0x78, 0x78, 0x74, 0x70, 0x66, 0x5a, 0x4b, 0x39, 0x25, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x16, 0x27, 0x35, 0x42, 0x4b, 0x53, 0x58, 0x58, 0x58, 0x56, 0x51, 0x48, 0x3e, 0x2f, 0x1f, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x18, 0x24, 0x2d, 0x34, 0x38, 0x39, 0x39, 0x37, 0x33, 0x2a, 0x20, 0x13, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0e, 0x14, 0x19, 0x19, 0x19, 0x18, 0x13, 0x0c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0037 "7" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x1b, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1a, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x2d, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x2a, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x0b, 0x28, 0x44, 0x58, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x56, 0x40, 0x25, 0x07, 0x00, 0x00,
+    0x00, 0x11, 0x30, 0x50, 0x6f, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x6b, 0x4c, 0x2c, 0x0d, 0x00, 0x00,
+    0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00,
+    0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xb0, 0xa1, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9d, 0xb1, 0xaa, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00,
+    0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xae, 0x90, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x88, 0xa8, 0x9d, 0x80, 0x65, 0x48, 0x2a, 0x0b, 0x00, 0x00,
+    0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xae, 0x90, 0x70, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5d, 0x7a, 0x94, 0xad, 0x90, 0x74, 0x58, 0x3c, 0x1e, 0x01, 0x00, 0x00,
+    0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xae, 0x90, 0x70, 0x50, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x4d, 0x6a, 0x85, 0xa1, 0xa0, 0x83, 0x68, 0x4c, 0x2e, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0x9c, 0x90, 0x70, 0x50, 0x31, 0x1d, 0x1d, 0x20, 0x3d, 0x5a, 0x76, 0x91, 0xad, 0x93, 0x78, 0x5c, 0x3e, 0x21, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x30, 0x50, 0x6f, 0x7c, 0x7c, 0x7c, 0x6f, 0x50, 0x30, 0x11, 0x10, 0x2e, 0x4a, 0x66, 0x81, 0x9f, 0xa2, 0x86, 0x6b, 0x4e, 0x31, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0b, 0x28, 0x44, 0x58, 0x5c, 0x5c, 0x5c, 0x58, 0x44, 0x28, 0x0b, 0x1e, 0x3a, 0x56, 0x74, 0x8f, 0xab, 0x96, 0x7b, 0x5e, 0x41, 0x25, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x2d, 0x3a, 0x3d, 0x3d, 0x3d, 0x3a, 0x2d, 0x17, 0x0e, 0x2a, 0x47, 0x65, 0x80, 0x9b, 0xa6, 0x8a, 0x6d, 0x51, 0x35, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x1b, 0x1d, 0x1d, 0x1d, 0x1b, 0x11, 0x01, 0x1a, 0x37, 0x55, 0x71, 0x8c, 0xa9, 0x9a, 0x7d, 0x61, 0x45, 0x28, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x28, 0x45, 0x61, 0x7d, 0x99, 0xa9, 0x8c, 0x71, 0x55, 0x38, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x35, 0x51, 0x6d, 0x8a, 0xa6, 0x9b, 0x80, 0x65, 0x47, 0x2a, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x25, 0x41, 0x5f, 0x7b, 0x96, 0xab, 0x8f, 0x74, 0x57, 0x3a, 0x1e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x31, 0x4e, 0x6c, 0x86, 0xa3, 0x9f, 0x83, 0x67, 0x4a, 0x2e, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x21, 0x3f, 0x5c, 0x78, 0x93, 0xae, 0x93, 0x76, 0x5a, 0x3e, 0x21, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2f, 0x4c, 0x68, 0x84, 0xa1, 0xa2, 0x85, 0x6a, 0x4e, 0x30, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1f, 0x3c, 0x58, 0x76, 0x91, 0xad, 0x95, 0x7a, 0x5e, 0x41, 0x23, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x2c, 0x49, 0x66, 0x81, 0x9d, 0xa5, 0x88, 0x6d, 0x51, 0x33, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x39, 0x56, 0x73, 0x8d, 0xab, 0x98, 0x7d, 0x61, 0x43, 0x27, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2a, 0x46, 0x63, 0x7f, 0x9b, 0xa8, 0x8c, 0x70, 0x53, 0x36, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x36, 0x53, 0x70, 0x8c, 0xa8, 0x9b, 0x80, 0x63, 0x46, 0x2a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x24, 0x43, 0x61, 0x7d, 0x90, 0x90, 0x8e, 0x73, 0x56, 0x3a, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x23, 0x42, 0x5f, 0x70, 0x70, 0x70, 0x70, 0x66, 0x4a, 0x2d, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x48, 0x50, 0x50, 0x50, 0x50, 0x4c, 0x39, 0x1f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1c, 0x2b, 0x31, 0x31, 0x31, 0x31, 0x2e, 0x21, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x0f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0038 "8" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x11, 0x1a, 0x20, 0x25, 0x25, 0x25, 0x25, 0x22, 0x1d, 0x16, 0x0c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x14, 0x23, 0x2f, 0x38, 0x3f, 0x44, 0x44, 0x44, 0x44, 0x41, 0x3c, 0x34, 0x2a, 0x1e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1d, 0x2f, 0x3f, 0x4c, 0x56, 0x5d, 0x64, 0x64, 0x64, 0x64, 0x60, 0x5b, 0x52, 0x47, 0x39, 0x28, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x36, 0x4a, 0x5b, 0x6a, 0x74, 0x7c, 0x80, 0x84, 0x84, 0x84, 0x80, 0x78, 0x70, 0x65, 0x54, 0x43, 0x2e, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x1c, 0x35, 0x4d, 0x63, 0x76, 0x85, 0x91, 0x9a, 0xa0, 0xa4, 0xa4, 0xa3, 0x9d, 0x96, 0x8c, 0x7f, 0x6e, 0x5b, 0x44, 0x2c, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x2c, 0x48, 0x61, 0x79, 0x8d, 0x9f, 0xa8, 0x9b, 0x93, 0x90, 0x8d, 0x90, 0x95, 0xa0, 0xa8, 0x98, 0x87, 0x71, 0x57, 0x3d, 0x21, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1c, 0x3a, 0x56, 0x73, 0x8c, 0xa5, 0xa3, 0x8d, 0x7f, 0x75, 0x70, 0x70, 0x71, 0x78, 0x84, 0x95, 0xab, 0x9b, 0x81, 0x68, 0x4c, 0x2e, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x25, 0x44, 0x63, 0x80, 0x9b, 0xaa, 0x8d, 0x77, 0x63, 0x57, 0x50, 0x50, 0x53, 0x5c, 0x6b, 0x7f, 0x98, 0xad, 0x90, 0x74, 0x56, 0x37, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa5, 0x9f, 0x80, 0x65, 0x4a, 0x39, 0x31, 0x31, 0x34, 0x3f, 0x53, 0x6f, 0x8c, 0xaa, 0x99, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0x9c, 0x7c, 0x5c, 0x3d, 0x1f, 0x13, 0x11, 0x16, 0x2a, 0x49, 0x68, 0x88, 0xa8, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x86, 0xa4, 0x9d, 0x80, 0x63, 0x48, 0x37, 0x2f, 0x2d, 0x32, 0x3c, 0x52, 0x6d, 0x8b, 0xa9, 0x98, 0x7a, 0x5c, 0x3c, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x24, 0x43, 0x61, 0x7d, 0x9a, 0xa8, 0x8c, 0x74, 0x61, 0x55, 0x4e, 0x4c, 0x50, 0x58, 0x68, 0x7d, 0x96, 0xaa, 0x8d, 0x73, 0x55, 0x36, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1a, 0x38, 0x55, 0x71, 0x88, 0xa0, 0xa0, 0x8c, 0x7d, 0x73, 0x6c, 0x6c, 0x70, 0x76, 0x81, 0x92, 0xa7, 0x96, 0x7f, 0x65, 0x48, 0x2c, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0e, 0x2a, 0x44, 0x5d, 0x74, 0x87, 0x96, 0xa6, 0x99, 0x90, 0x8c, 0x8c, 0x8c, 0x94, 0x9d, 0xa3, 0x91, 0x7f, 0x6b, 0x52, 0x3a, 0x1e, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x2d, 0x44, 0x5b, 0x6d, 0x7d, 0x8a, 0xa8, 0xab, 0xa4, 0xa4, 0xa4, 0xa4, 0xa8, 0xaf, 0x9c, 0x83, 0x76, 0x66, 0x52, 0x3c, 0x22, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x25, 0x3f, 0x5a, 0x71, 0x85, 0x97, 0xa4, 0x98, 0x8d, 0x86, 0x84, 0x84, 0x84, 0x88, 0x91, 0x9f, 0x9f, 0x8f, 0x7d, 0x68, 0x4f, 0x34, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x32, 0x4f, 0x6b, 0x84, 0x9d, 0xa5, 0x8f, 0x7d, 0x71, 0x68, 0x64, 0x64, 0x65, 0x6c, 0x76, 0x84, 0x97, 0xa8, 0x92, 0x7a, 0x5f, 0x43, 0x26, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x1d, 0x3c, 0x5b, 0x78, 0x94, 0xad, 0x93, 0x7a, 0x63, 0x53, 0x49, 0x44, 0x44, 0x47, 0x4d, 0x5a, 0x6c, 0x84, 0x9f, 0xa4, 0x88, 0x6c, 0x4e, 0x2f, 0x11, 0x00, 0x00,
+    0x00, 0x04, 0x23, 0x42, 0x60, 0x80, 0x9d, 0xa5, 0x88, 0x6a, 0x4f, 0x38, 0x2b, 0x25, 0x25, 0x28, 0x2f, 0x40, 0x5a, 0x76, 0x94, 0xaf, 0x91, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x0d, 0x05, 0x05, 0x08, 0x14, 0x32, 0x50, 0x70, 0x90, 0xb0, 0x95, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00,
+    0x00, 0x05, 0x24, 0x44, 0x63, 0x80, 0xa0, 0xa4, 0x86, 0x69, 0x4c, 0x33, 0x24, 0x1d, 0x1d, 0x20, 0x29, 0x3c, 0x57, 0x75, 0x93, 0xb0, 0x94, 0x74, 0x55, 0x36, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x3f, 0x5d, 0x7c, 0x98, 0xad, 0x91, 0x77, 0x5f, 0x4e, 0x43, 0x3d, 0x3d, 0x40, 0x47, 0x54, 0x69, 0x81, 0x9b, 0xaa, 0x8c, 0x70, 0x51, 0x33, 0x13, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x36, 0x53, 0x71, 0x8c, 0xa5, 0xa2, 0x89, 0x78, 0x6a, 0x61, 0x5c, 0x5c, 0x5f, 0x65, 0x6f, 0x7f, 0x95, 0xac, 0x9a, 0x80, 0x65, 0x48, 0x2a, 0x0c, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2a, 0x46, 0x61, 0x79, 0x92, 0xa5, 0xa3, 0x93, 0x86, 0x80, 0x7c, 0x7c, 0x7c, 0x83, 0x8b, 0x98, 0xab, 0x9d, 0x87, 0x71, 0x56, 0x3a, 0x1e, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1b, 0x35, 0x4e, 0x66, 0x79, 0x8c, 0x9a, 0xa5, 0xa4, 0x9d, 0x9c, 0x9c, 0x9c, 0xa0, 0xa8, 0xa1, 0x94, 0x84, 0x71, 0x5b, 0x44, 0x2a, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x22, 0x39, 0x4e, 0x61, 0x71, 0x7f, 0x88, 0x90, 0x94, 0x98, 0x98, 0x96, 0x93, 0x8c, 0x84, 0x7a, 0x6b, 0x5a, 0x44, 0x2e, 0x17, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x22, 0x35, 0x46, 0x55, 0x61, 0x6b, 0x71, 0x75, 0x78, 0x78, 0x78, 0x74, 0x6f, 0x67, 0x5c, 0x4f, 0x3f, 0x2d, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1b, 0x2a, 0x38, 0x43, 0x4c, 0x53, 0x57, 0x58, 0x58, 0x58, 0x54, 0x50, 0x48, 0x3f, 0x33, 0x25, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1b, 0x25, 0x2e, 0x34, 0x38, 0x39, 0x39, 0x39, 0x35, 0x31, 0x2a, 0x21, 0x16, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0f, 0x14, 0x18, 0x19, 0x19, 0x19, 0x16, 0x12, 0x0b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0039 "9" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x11, 0x1a, 0x21, 0x25, 0x25, 0x25, 0x25, 0x20, 0x18, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x13, 0x21, 0x2f, 0x39, 0x40, 0x44, 0x44, 0x44, 0x44, 0x3f, 0x37, 0x2e, 0x1f, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x1c, 0x2e, 0x3e, 0x4c, 0x57, 0x60, 0x64, 0x64, 0x64, 0x64, 0x5d, 0x56, 0x4a, 0x3c, 0x2d, 0x1a, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x1d, 0x33, 0x48, 0x5a, 0x68, 0x75, 0x7d, 0x83, 0x84, 0x84, 0x80, 0x7c, 0x74, 0x66, 0x58, 0x47, 0x33, 0x1d, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1a, 0x33, 0x4a, 0x60, 0x74, 0x83, 0x91, 0x9b, 0xa0, 0xa4, 0xa4, 0xa0, 0x99, 0x8f, 0x81, 0x73, 0x60, 0x4a, 0x33, 0x1a, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x2c, 0x46, 0x60, 0x77, 0x8c, 0x9d, 0xa6, 0x9a, 0x91, 0x90, 0x90, 0x91, 0x9a, 0xa6, 0x9d, 0x8a, 0x77, 0x60, 0x47, 0x2d, 0x12, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1d, 0x3a, 0x56, 0x71, 0x8a, 0xa3, 0xa0, 0x8c, 0x7d, 0x74, 0x70, 0x70, 0x74, 0x7d, 0x8a, 0x9d, 0xa3, 0x8a, 0x73, 0x58, 0x3e, 0x21, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0x28, 0x46, 0x64, 0x80, 0x9b, 0xa5, 0x8c, 0x74, 0x63, 0x56, 0x50, 0x50, 0x56, 0x61, 0x71, 0x87, 0xa0, 0x9d, 0x83, 0x68, 0x4c, 0x2f, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x2f, 0x4e, 0x6c, 0x8a, 0xa8, 0x98, 0x7c, 0x61, 0x48, 0x38, 0x31, 0x31, 0x38, 0x46, 0x5c, 0x76, 0x91, 0xac, 0x91, 0x76, 0x58, 0x3c, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x15, 0x34, 0x54, 0x73, 0x90, 0xae, 0x90, 0x74, 0x54, 0x36, 0x1c, 0x11, 0x11, 0x1a, 0x30, 0x4d, 0x6b, 0x88, 0xa8, 0x9d, 0x80, 0x64, 0x45, 0x26, 0x07, 0x00, 0x00,
+    0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x51, 0x33, 0x13, 0x01, 0x00, 0x0d, 0x2a, 0x49, 0x68, 0x88, 0xa8, 0xa6, 0x88, 0x6b, 0x4c, 0x2d, 0x0e, 0x00, 0x00,
+    0x00, 0x14, 0x34, 0x53, 0x71, 0x90, 0xaf, 0x94, 0x76, 0x58, 0x3d, 0x28, 0x20, 0x20, 0x28, 0x39, 0x53, 0x70, 0x8c, 0xaa, 0xad, 0x8f, 0x70, 0x50, 0x32, 0x13, 0x00, 0x00,
+    0x00, 0x0f, 0x2f, 0x4d, 0x6c, 0x88, 0xa6, 0x9d, 0x81, 0x69, 0x54, 0x46, 0x40, 0x3f, 0x45, 0x53, 0x66, 0x7f, 0x98, 0xb4, 0xb2, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00,
+    0x00, 0x08, 0x26, 0x44, 0x61, 0x7d, 0x98, 0xad, 0x95, 0x7f, 0x6f, 0x64, 0x5f, 0x5d, 0x64, 0x6d, 0x7f, 0x92, 0x9f, 0xa1, 0xb3, 0x94, 0x76, 0x58, 0x38, 0x19, 0x00, 0x00,
+    0x00, 0x00, 0x1a, 0x36, 0x53, 0x6e, 0x87, 0x9d, 0xab, 0x98, 0x8a, 0x81, 0x7c, 0x7c, 0x80, 0x8a, 0x97, 0xa0, 0x87, 0x90, 0xb0, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x28, 0x43, 0x5b, 0x71, 0x85, 0x96, 0xa4, 0xa8, 0xa0, 0x9c, 0x9c, 0xa0, 0xa4, 0x98, 0x87, 0x74, 0x90, 0xb0, 0x94, 0x76, 0x58, 0x38, 0x19, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x16, 0x2e, 0x44, 0x5b, 0x6c, 0x7b, 0x86, 0x8f, 0x94, 0x98, 0x94, 0x90, 0x88, 0x7d, 0x6e, 0x74, 0x90, 0xaf, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x17, 0x2e, 0x40, 0x51, 0x5f, 0x6a, 0x70, 0x74, 0x78, 0x74, 0x71, 0x6b, 0x61, 0x59, 0x78, 0x95, 0xac, 0x8d, 0x70, 0x50, 0x32, 0x13, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x26, 0x35, 0x42, 0x4b, 0x52, 0x55, 0x58, 0x55, 0x53, 0x4c, 0x44, 0x61, 0x7f, 0x9c, 0xa5, 0x88, 0x6a, 0x4b, 0x2c, 0x0d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1d, 0x21, 0x24, 0x2d, 0x33, 0x36, 0x39, 0x36, 0x34, 0x37, 0x51, 0x6d, 0x88, 0xa5, 0x9b, 0x80, 0x61, 0x43, 0x25, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x14, 0x2b, 0x3c, 0x40, 0x38, 0x2b, 0x24, 0x21, 0x24, 0x2b, 0x39, 0x4b, 0x63, 0x7c, 0x95, 0xab, 0x8f, 0x74, 0x57, 0x3a, 0x1c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x25, 0x40, 0x57, 0x60, 0x55, 0x49, 0x44, 0x40, 0x44, 0x49, 0x55, 0x65, 0x77, 0x8d, 0xa6, 0x9b, 0x81, 0x66, 0x4a, 0x2e, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x33, 0x4f, 0x6c, 0x7f, 0x71, 0x68, 0x63, 0x60, 0x63, 0x68, 0x71, 0x7f, 0x8f, 0xa3, 0xa0, 0x89, 0x71, 0x56, 0x3c, 0x1f, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x25, 0x41, 0x5e, 0x7a, 0x94, 0x8c, 0x85, 0x80, 0x80, 0x80, 0x85, 0x8d, 0x9a, 0xa9, 0x9d, 0x8a, 0x76, 0x5d, 0x45, 0x2c, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2c, 0x4c, 0x6b, 0x86, 0xa0, 0xa9, 0xa4, 0xa0, 0xa0, 0xa0, 0xa4, 0xa9, 0xa1, 0x94, 0x85, 0x74, 0x60, 0x4a, 0x31, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x2b, 0x49, 0x66, 0x78, 0x83, 0x8c, 0x93, 0x96, 0x98, 0x98, 0x94, 0x8c, 0x84, 0x7a, 0x6b, 0x5b, 0x47, 0x33, 0x1d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x1f, 0x39, 0x4e, 0x5c, 0x66, 0x6f, 0x74, 0x78, 0x78, 0x78, 0x74, 0x70, 0x67, 0x5c, 0x4f, 0x3f, 0x2e, 0x1a, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0c, 0x22, 0x31, 0x3e, 0x48, 0x50, 0x54, 0x58, 0x58, 0x58, 0x55, 0x50, 0x49, 0x3f, 0x33, 0x25, 0x14, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x15, 0x20, 0x2a, 0x31, 0x35, 0x39, 0x39, 0x39, 0x36, 0x32, 0x2b, 0x21, 0x16, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x12, 0x16, 0x19, 0x19, 0x19, 0x17, 0x13, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+003A ":" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x13, 0x15, 0x14, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x16, 0x27, 0x32, 0x35, 0x33, 0x2a, 0x1c, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1a, 0x30, 0x43, 0x50, 0x54, 0x52, 0x46, 0x36, 0x20, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x2c, 0x46, 0x5c, 0x6d, 0x74, 0x70, 0x63, 0x4d, 0x33, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3a, 0x56, 0x71, 0x87, 0x94, 0x8c, 0x79, 0x5e, 0x41, 0x23, 0x04, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0x9b, 0xb2, 0xa2, 0x85, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0x9d, 0xb6, 0xa4, 0x86, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x1d, 0x3c, 0x58, 0x74, 0x8c, 0x98, 0x8f, 0x7a, 0x5f, 0x42, 0x24, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x2e, 0x49, 0x60, 0x71, 0x78, 0x74, 0x66, 0x4f, 0x34, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x1d, 0x33, 0x46, 0x55, 0x58, 0x57, 0x4a, 0x39, 0x22, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x1b, 0x2a, 0x36, 0x39, 0x38, 0x2e, 0x1f, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x17, 0x19, 0x18, 0x11, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x14, 0x19, 0x16, 0x0e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x19, 0x28, 0x33, 0x38, 0x34, 0x2c, 0x1d, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x1a, 0x31, 0x45, 0x52, 0x58, 0x54, 0x48, 0x36, 0x20, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x2e, 0x47, 0x5d, 0x6f, 0x76, 0x73, 0x63, 0x4d, 0x34, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3a, 0x58, 0x74, 0x89, 0x94, 0x8d, 0x79, 0x5f, 0x42, 0x24, 0x05, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0x9c, 0xb3, 0xa4, 0x86, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0x9c, 0xb4, 0xa3, 0x86, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3a, 0x58, 0x74, 0x89, 0x94, 0x8d, 0x79, 0x5f, 0x42, 0x24, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x2e, 0x47, 0x5d, 0x6f, 0x78, 0x73, 0x63, 0x4d, 0x33, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x1a, 0x31, 0x45, 0x52, 0x58, 0x54, 0x48, 0x36, 0x20, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x19, 0x28, 0x33, 0x39, 0x34, 0x2c, 0x1d, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x14, 0x19, 0x16, 0x0e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+003B ";" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x13, 0x15, 0x14, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x16, 0x27, 0x32, 0x35, 0x33, 0x2a, 0x1c, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1a, 0x30, 0x43, 0x50, 0x54, 0x52, 0x46, 0x36, 0x20, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x2c, 0x46, 0x5c, 0x6d, 0x74, 0x70, 0x63, 0x4d, 0x33, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3a, 0x56, 0x71, 0x87, 0x94, 0x8c, 0x79, 0x5e, 0x41, 0x23, 0x04, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0x9b, 0xb2, 0xa2, 0x85, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0x9d, 0xb6, 0xa4, 0x86, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x1d, 0x3c, 0x58, 0x74, 0x8c, 0x98, 0x8f, 0x7a, 0x5f, 0x42, 0x24, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x2e, 0x49, 0x60, 0x71, 0x78, 0x74, 0x66, 0x4f, 0x34, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x1d, 0x33, 0x46, 0x55, 0x58, 0x57, 0x4a, 0x39, 0x22, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x1b, 0x2a, 0x36, 0x39, 0x38, 0x2e, 0x1f, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x17, 0x19, 0x18, 0x11, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x14, 0x19, 0x16, 0x0e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x19, 0x28, 0x33, 0x38, 0x34, 0x2d, 0x1e, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x1a, 0x31, 0x45, 0x52, 0x58, 0x54, 0x4a, 0x36, 0x20, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x2c, 0x47, 0x5d, 0x6f, 0x76, 0x73, 0x63, 0x4d, 0x34, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1a, 0x39, 0x56, 0x73, 0x89, 0x94, 0x8f, 0x79, 0x5f, 0x42, 0x24, 0x05, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x7d, 0x9b, 0xb3, 0xa4, 0x86, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x7d, 0x9a, 0xb2, 0xa5, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x1a, 0x38, 0x56, 0x71, 0x87, 0x9a, 0x9c, 0x80, 0x63, 0x44, 0x25, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x2c, 0x44, 0x5c, 0x78, 0x96, 0x93, 0x76, 0x58, 0x3a, 0x1c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x25, 0x44, 0x63, 0x80, 0x9d, 0x88, 0x6c, 0x4e, 0x30, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x2d, 0x4b, 0x6a, 0x88, 0x9c, 0x80, 0x63, 0x44, 0x26, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x34, 0x53, 0x71, 0x8f, 0x93, 0x76, 0x58, 0x3a, 0x1c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x88, 0x87, 0x6c, 0x4e, 0x30, 0x12, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x34, 0x51, 0x66, 0x68, 0x68, 0x5d, 0x43, 0x26, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x25, 0x3b, 0x48, 0x48, 0x48, 0x43, 0x31, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0e, 0x1f, 0x28, 0x29, 0x29, 0x25, 0x18, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+003C "<" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x15, 0x19, 0x14, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x10, 0x1c, 0x28, 0x33, 0x39, 0x31, 0x20, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x17, 0x23, 0x2e, 0x39, 0x45, 0x51, 0x58, 0x4c, 0x34, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x11, 0x1c, 0x28, 0x34, 0x3f, 0x4c, 0x56, 0x63, 0x6d, 0x78, 0x5f, 0x40, 0x20, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x17, 0x23, 0x2e, 0x3a, 0x46, 0x51, 0x5d, 0x68, 0x74, 0x7f, 0x8a, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x11, 0x1d, 0x29, 0x35, 0x41, 0x4c, 0x57, 0x63, 0x6f, 0x7a, 0x85, 0x90, 0x9b, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x16, 0x24, 0x2f, 0x3a, 0x46, 0x52, 0x5e, 0x6a, 0x74, 0x80, 0x8a, 0x96, 0xa1, 0x9f, 0x93, 0x88, 0x7c, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0x30, 0x41, 0x4d, 0x58, 0x64, 0x6f, 0x7b, 0x85, 0x90, 0x9b, 0xa3, 0x98, 0x8c, 0x81, 0x78, 0x6c, 0x61, 0x4f, 0x36, 0x1a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x28, 0x45, 0x5d, 0x6a, 0x75, 0x80, 0x8b, 0x96, 0xa2, 0x9c, 0x91, 0x86, 0x7c, 0x71, 0x65, 0x5a, 0x4e, 0x43, 0x36, 0x23, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x86, 0x91, 0x9c, 0xa1, 0x96, 0x8a, 0x80, 0x75, 0x6a, 0x5f, 0x53, 0x48, 0x3d, 0x31, 0x26, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x9a, 0x84, 0x7a, 0x6f, 0x64, 0x58, 0x4d, 0x41, 0x36, 0x2a, 0x1f, 0x14, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xa3, 0xa0, 0x8f, 0x85, 0x7a, 0x6f, 0x64, 0x58, 0x4d, 0x42, 0x36, 0x2b, 0x1f, 0x15, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x2c, 0x4b, 0x68, 0x7b, 0x85, 0x91, 0x9c, 0xa1, 0x96, 0x8b, 0x80, 0x76, 0x6a, 0x5f, 0x53, 0x48, 0x3d, 0x32, 0x26, 0x16, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x21, 0x3c, 0x51, 0x5f, 0x6a, 0x75, 0x80, 0x8b, 0x96, 0xa2, 0x9c, 0x91, 0x86, 0x7c, 0x71, 0x66, 0x5b, 0x4f, 0x43, 0x2d, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x25, 0x35, 0x41, 0x4c, 0x58, 0x64, 0x6f, 0x7b, 0x85, 0x90, 0x9b, 0xa4, 0x98, 0x8d, 0x81, 0x78, 0x6c, 0x5a, 0x3d, 0x1e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x18, 0x23, 0x2f, 0x3a, 0x46, 0x52, 0x5e, 0x68, 0x74, 0x80, 0x8a, 0x96, 0xa1, 0x9f, 0x94, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x11, 0x1d, 0x29, 0x35, 0x41, 0x4c, 0x57, 0x63, 0x6f, 0x7a, 0x84, 0x8f, 0x9b, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x17, 0x23, 0x2e, 0x3a, 0x46, 0x51, 0x5d, 0x68, 0x74, 0x7f, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x11, 0x1c, 0x28, 0x34, 0x3f, 0x4b, 0x56, 0x63, 0x68, 0x57, 0x3c, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x17, 0x21, 0x2e, 0x39, 0x44, 0x48, 0x3f, 0x2b, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x1c, 0x26, 0x29, 0x23, 0x13, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+003D "=" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x17, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x14, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x27, 0x35, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x31, 0x20, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x23, 0x3e, 0x53, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x4c, 0x34, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x2c, 0x4b, 0x6a, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x5f, 0x40, 0x20, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x2c, 0x4b, 0x6a, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x5f, 0x40, 0x20, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x23, 0x3e, 0x53, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x4c, 0x34, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x27, 0x35, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x31, 0x20, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0x30, 0x41, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3c, 0x28, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x28, 0x45, 0x5d, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x55, 0x3a, 0x1c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8b, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x2a, 0x48, 0x63, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x5a, 0x3d, 0x1e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x1d, 0x36, 0x48, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x43, 0x2d, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x1d, 0x2a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x26, 0x16, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x0b, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+003E ">" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x17, 0x18, 0x11, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x27, 0x35, 0x38, 0x2f, 0x23, 0x17, 0x0c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x23, 0x3e, 0x53, 0x57, 0x4c, 0x41, 0x35, 0x2a, 0x1e, 0x12, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x2c, 0x4b, 0x6a, 0x75, 0x6a, 0x5e, 0x52, 0x47, 0x3c, 0x2f, 0x24, 0x18, 0x0c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0x85, 0x7b, 0x70, 0x65, 0x58, 0x4d, 0x41, 0x35, 0x2a, 0x1f, 0x13, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xa2, 0x96, 0x8c, 0x80, 0x76, 0x6a, 0x5f, 0x53, 0x48, 0x3c, 0x30, 0x25, 0x19, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2c, 0x4c, 0x6b, 0x81, 0x8c, 0x98, 0xa3, 0x9d, 0x91, 0x86, 0x7b, 0x70, 0x65, 0x5a, 0x4e, 0x42, 0x36, 0x2b, 0x1f, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x25, 0x40, 0x57, 0x65, 0x70, 0x7b, 0x85, 0x91, 0x9b, 0xa3, 0x98, 0x8c, 0x81, 0x76, 0x6b, 0x5f, 0x53, 0x48, 0x3c, 0x28, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x14, 0x2b, 0x3c, 0x48, 0x53, 0x5f, 0x6a, 0x75, 0x80, 0x8a, 0x95, 0xa0, 0x9d, 0x93, 0x86, 0x7c, 0x71, 0x66, 0x55, 0x3a, 0x1c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x1f, 0x2a, 0x35, 0x41, 0x4c, 0x57, 0x63, 0x6d, 0x7a, 0x83, 0x8f, 0x9a, 0xa3, 0x98, 0x8d, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0c, 0x18, 0x23, 0x2f, 0x3a, 0x46, 0x51, 0x5c, 0x67, 0x73, 0x7d, 0x88, 0xa1, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x18, 0x24, 0x2f, 0x3a, 0x46, 0x51, 0x5c, 0x68, 0x73, 0x7f, 0x88, 0x94, 0xa6, 0x9e, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x1d, 0x2a, 0x36, 0x41, 0x4d, 0x58, 0x64, 0x6f, 0x7a, 0x84, 0x8f, 0x9a, 0xa3, 0x98, 0x8c, 0x81, 0x76, 0x5d, 0x3f, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x1d, 0x36, 0x48, 0x53, 0x5f, 0x6a, 0x75, 0x80, 0x8a, 0x96, 0xa1, 0x9d, 0x93, 0x86, 0x7c, 0x71, 0x65, 0x5a, 0x4a, 0x32, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x2a, 0x48, 0x63, 0x71, 0x7c, 0x86, 0x91, 0x9c, 0xa3, 0x98, 0x8c, 0x81, 0x76, 0x6b, 0x5f, 0x53, 0x48, 0x3d, 0x2f, 0x1d, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8b, 0x98, 0xa3, 0x9d, 0x91, 0x86, 0x7b, 0x70, 0x65, 0x5a, 0x4e, 0x42, 0x36, 0x2a, 0x1f, 0x13, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0x96, 0x8b, 0x80, 0x76, 0x6a, 0x5f, 0x53, 0x47, 0x3c, 0x30, 0x25, 0x19, 0x0d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x85, 0x7b, 0x6f, 0x64, 0x58, 0x4d, 0x41, 0x35, 0x2a, 0x1f, 0x13, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x29, 0x46, 0x60, 0x68, 0x5e, 0x52, 0x46, 0x3c, 0x2f, 0x24, 0x18, 0x0c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1b, 0x33, 0x44, 0x48, 0x41, 0x35, 0x29, 0x1d, 0x12, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x1a, 0x26, 0x29, 0x23, 0x17, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+003F "?" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x17, 0x1e, 0x24, 0x25, 0x25, 0x25, 0x24, 0x1f, 0x17, 0x0e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x13, 0x21, 0x2d, 0x36, 0x3d, 0x43, 0x44, 0x44, 0x44, 0x44, 0x3e, 0x36, 0x2c, 0x1f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0b, 0x1e, 0x2f, 0x3e, 0x4b, 0x55, 0x5c, 0x61, 0x64, 0x64, 0x64, 0x63, 0x5c, 0x55, 0x49, 0x3c, 0x2a, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x23, 0x38, 0x4a, 0x5a, 0x68, 0x73, 0x7b, 0x80, 0x84, 0x84, 0x84, 0x80, 0x7b, 0x73, 0x66, 0x56, 0x44, 0x2e, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0b, 0x24, 0x3c, 0x4f, 0x63, 0x76, 0x83, 0x8f, 0x98, 0x9f, 0xa4, 0xa4, 0xa4, 0xa0, 0x98, 0x8d, 0x81, 0x71, 0x5b, 0x44, 0x2c, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1c, 0x38, 0x50, 0x69, 0x7c, 0x8f, 0x9f, 0xa9, 0x9d, 0x96, 0x94, 0x94, 0x94, 0x9a, 0xa4, 0xab, 0x9a, 0x87, 0x71, 0x57, 0x3c, 0x1f, 0x03, 0x00, 0x00, 0x00,
+    0x05, 0x24, 0x44, 0x63, 0x7c, 0x93, 0xa8, 0x9d, 0x8c, 0x80, 0x78, 0x74, 0x74, 0x75, 0x7d, 0x89, 0x9d, 0xb2, 0x9b, 0x81, 0x66, 0x49, 0x2b, 0x0d, 0x00, 0x00, 0x00,
+    0x04, 0x23, 0x42, 0x5f, 0x76, 0x87, 0x99, 0x84, 0x73, 0x65, 0x5a, 0x54, 0x54, 0x57, 0x60, 0x71, 0x87, 0xa1, 0xab, 0x8d, 0x70, 0x51, 0x33, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0x33, 0x4a, 0x5d, 0x6e, 0x80, 0x6e, 0x58, 0x48, 0x3c, 0x35, 0x35, 0x38, 0x45, 0x5c, 0x78, 0x95, 0xb1, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x1d, 0x30, 0x43, 0x55, 0x60, 0x57, 0x41, 0x2d, 0x1e, 0x16, 0x15, 0x1a, 0x35, 0x54, 0x74, 0x94, 0xb2, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x17, 0x29, 0x3a, 0x40, 0x3c, 0x2b, 0x15, 0x01, 0x00, 0x13, 0x28, 0x41, 0x5a, 0x78, 0x94, 0xad, 0x8f, 0x71, 0x53, 0x34, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x1c, 0x21, 0x1d, 0x11, 0x00, 0x00, 0x15, 0x2b, 0x3f, 0x55, 0x6d, 0x84, 0x9f, 0xa0, 0x85, 0x68, 0x4b, 0x2d, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x2b, 0x41, 0x58, 0x6b, 0x81, 0x97, 0xa5, 0x8f, 0x76, 0x5c, 0x3f, 0x23, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x2b, 0x41, 0x58, 0x6e, 0x84, 0x97, 0xa5, 0x8f, 0x7b, 0x63, 0x4b, 0x30, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x23, 0x3e, 0x57, 0x6e, 0x84, 0x9a, 0xa5, 0x8f, 0x79, 0x66, 0x4f, 0x36, 0x1f, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x31, 0x4e, 0x6a, 0x81, 0x9a, 0xa5, 0x8f, 0x79, 0x63, 0x4d, 0x39, 0x23, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x3d, 0x5b, 0x78, 0x93, 0xad, 0x93, 0x7b, 0x63, 0x4d, 0x36, 0x20, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x80, 0x9f, 0xa4, 0x86, 0x6a, 0x4f, 0x36, 0x20, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x85, 0x8c, 0x8c, 0x80, 0x61, 0x43, 0x24, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x26, 0x44, 0x60, 0x6c, 0x6c, 0x6c, 0x6c, 0x5a, 0x3d, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x33, 0x46, 0x4c, 0x4e, 0x4e, 0x4c, 0x43, 0x2d, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1f, 0x39, 0x4f, 0x63, 0x6c, 0x6c, 0x61, 0x4d, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2e, 0x4a, 0x66, 0x7c, 0x8b, 0x8a, 0x79, 0x63, 0x46, 0x29, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x8f, 0xa8, 0xa5, 0x8b, 0x6d, 0x4f, 0x30, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x93, 0xaf, 0xab, 0x8c, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x30, 0x4e, 0x6b, 0x84, 0x94, 0x91, 0x7f, 0x66, 0x49, 0x2b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x25, 0x3f, 0x58, 0x6b, 0x74, 0x74, 0x69, 0x52, 0x3b, 0x1f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x2b, 0x3f, 0x4f, 0x56, 0x55, 0x4d, 0x3c, 0x25, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x25, 0x32, 0x37, 0x36, 0x2f, 0x23, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x13, 0x18, 0x17, 0x11, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0040 "@" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x05, 0x05, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0b, 0x13, 0x1a, 0x1f, 0x22, 0x25, 0x25, 0x25, 0x24, 0x20, 0x1b, 0x15, 0x0d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x13, 0x1f, 0x29, 0x32, 0x38, 0x3e, 0x41, 0x44, 0x44, 0x44, 0x43, 0x40, 0x3a, 0x33, 0x2b, 0x21, 0x16, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x21, 0x2f, 0x3c, 0x47, 0x50, 0x58, 0x5c, 0x60, 0x64, 0x64, 0x64, 0x61, 0x5f, 0x59, 0x52, 0x49, 0x3f, 0x33, 0x25, 0x17, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1b, 0x2e, 0x3e, 0x4c, 0x5a, 0x65, 0x6f, 0x76, 0x7c, 0x80, 0x84, 0x84, 0x84, 0x80, 0x7c, 0x78, 0x70, 0x67, 0x5c, 0x4f, 0x41, 0x32, 0x21, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x22, 0x35, 0x47, 0x58, 0x68, 0x76, 0x81, 0x8b, 0x94, 0x9a, 0xa0, 0x9f, 0xa0, 0xa0, 0x9f, 0x9c, 0x95, 0x8d, 0x84, 0x7a, 0x6c, 0x5e, 0x4c, 0x3b, 0x28, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x23, 0x39, 0x4e, 0x61, 0x74, 0x83, 0x91, 0x9d, 0x99, 0x90, 0x88, 0x84, 0x80, 0x80, 0x80, 0x84, 0x88, 0x8c, 0x95, 0x9f, 0x94, 0x86, 0x78, 0x66, 0x54, 0x3f, 0x28, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x22, 0x39, 0x4f, 0x66, 0x79, 0x8c, 0x9d, 0x96, 0x88, 0x7c, 0x73, 0x6b, 0x65, 0x61, 0x60, 0x60, 0x64, 0x69, 0x70, 0x78, 0x83, 0x91, 0x9f, 0x91, 0x7f, 0x6b, 0x55, 0x3f, 0x28, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x1c, 0x35, 0x4e, 0x66, 0x7c, 0x92, 0xa0, 0x8c, 0x7c, 0x6d, 0x5f, 0x55, 0x4c, 0x47, 0x43, 0x40, 0x40, 0x44, 0x4b, 0x52, 0x5c, 0x68, 0x76, 0x85, 0x97, 0x97, 0x81, 0x6b, 0x55, 0x3c, 0x22, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x2e, 0x48, 0x61, 0x79, 0x92, 0x9d, 0x87, 0x74, 0x63, 0x51, 0x43, 0x46, 0x4e, 0x54, 0x57, 0x56, 0x54, 0x4d, 0x44, 0x41, 0x52, 0x54, 0x5c, 0x6d, 0x7f, 0x95, 0x97, 0x80, 0x68, 0x4f, 0x34, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x21, 0x3e, 0x5a, 0x74, 0x8c, 0xa0, 0x88, 0x71, 0x5c, 0x48, 0x45, 0x55, 0x63, 0x6c, 0x74, 0x75, 0x74, 0x74, 0x6c, 0x61, 0x55, 0x6e, 0x74, 0x74, 0x74, 0x69, 0x7f, 0x97, 0x92, 0x7a, 0x5f, 0x45, 0x28, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x2f, 0x4c, 0x68, 0x83, 0x9d, 0x8f, 0x76, 0x5d, 0x44, 0x4a, 0x5f, 0x71, 0x7f, 0x8a, 0x91, 0x94, 0x94, 0x90, 0x88, 0x7d, 0x6e, 0x78, 0x94, 0x94, 0x84, 0x64, 0x6c, 0x84, 0x9f, 0x89, 0x6f, 0x53, 0x36, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x1f, 0x3c, 0x5a, 0x76, 0x91, 0x9a, 0x7f, 0x65, 0x4a, 0x4a, 0x60, 0x77, 0x89, 0x9a, 0xa7, 0x9f, 0x99, 0x98, 0x9b, 0xa1, 0x98, 0x87, 0x78, 0x98, 0xa4, 0x84, 0x64, 0x5a, 0x74, 0x8f, 0x98, 0x7c, 0x5f, 0x42, 0x25, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x29, 0x47, 0x65, 0x81, 0x9d, 0x8c, 0x71, 0x55, 0x41, 0x5c, 0x76, 0x8c, 0xa3, 0x9d, 0x8d, 0x81, 0x7c, 0x78, 0x7c, 0x84, 0x91, 0x9d, 0x87, 0x99, 0xa4, 0x84, 0x64, 0x4a, 0x66, 0x81, 0x9f, 0x86, 0x6b, 0x4c, 0x2e, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x12, 0x30, 0x4f, 0x6d, 0x8b, 0x9f, 0x81, 0x65, 0x47, 0x4f, 0x6c, 0x86, 0xa0, 0x9d, 0x87, 0x74, 0x65, 0x5c, 0x58, 0x5d, 0x68, 0x78, 0x8c, 0xa2, 0xac, 0xa4, 0x84, 0x64, 0x44, 0x5a, 0x78, 0x94, 0x90, 0x74, 0x55, 0x36, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x38, 0x57, 0x75, 0x93, 0x97, 0x78, 0x5b, 0x3f, 0x5c, 0x7a, 0x94, 0xa6, 0x8a, 0x71, 0x5b, 0x48, 0x3d, 0x39, 0x3f, 0x4c, 0x60, 0x77, 0x91, 0xab, 0xa4, 0x84, 0x64, 0x44, 0x51, 0x70, 0x8c, 0x98, 0x7a, 0x5c, 0x3c, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1d, 0x3c, 0x5c, 0x7a, 0x98, 0x90, 0x74, 0x54, 0x47, 0x65, 0x83, 0xa0, 0x99, 0x7d, 0x61, 0x46, 0x2e, 0x1f, 0x1a, 0x21, 0x33, 0x4c, 0x66, 0x83, 0xa0, 0xa4, 0x84, 0x64, 0x44, 0x4b, 0x69, 0x88, 0x9c, 0x7f, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x3f, 0x5d, 0x7c, 0x9c, 0x8c, 0x70, 0x50, 0x4c, 0x6b, 0x88, 0xa8, 0x91, 0x74, 0x56, 0x37, 0x1a, 0x02, 0x00, 0x07, 0x21, 0x3e, 0x5c, 0x7a, 0x98, 0xa4, 0x84, 0x64, 0x44, 0x47, 0x65, 0x84, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0xa0, 0x8c, 0x6c, 0x4c, 0x4c, 0x6c, 0x8c, 0xac, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x18, 0x37, 0x56, 0x74, 0x94, 0xa4, 0x84, 0x64, 0x44, 0x44, 0x64, 0x84, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0x9f, 0x8c, 0x6c, 0x4c, 0x4c, 0x6c, 0x8c, 0xac, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x18, 0x38, 0x57, 0x75, 0x94, 0xa4, 0x84, 0x64, 0x44, 0x46, 0x64, 0x84, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x1e, 0x3d, 0x5c, 0x7c, 0x9c, 0x8f, 0x70, 0x50, 0x4c, 0x6b, 0x88, 0xa7, 0x91, 0x74, 0x56, 0x38, 0x1b, 0x03, 0x00, 0x07, 0x21, 0x3e, 0x5c, 0x7b, 0x98, 0xa4, 0x84, 0x64, 0x44, 0x49, 0x68, 0x88, 0x9c, 0x7f, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3b, 0x5a, 0x78, 0x98, 0x93, 0x74, 0x56, 0x46, 0x64, 0x81, 0xa0, 0x9a, 0x7d, 0x61, 0x47, 0x30, 0x20, 0x1d, 0x23, 0x34, 0x4d, 0x68, 0x83, 0xa0, 0xa4, 0x84, 0x64, 0x44, 0x4f, 0x6d, 0x8c, 0x98, 0x7a, 0x5c, 0x3c, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x36, 0x55, 0x74, 0x90, 0x98, 0x7b, 0x5d, 0x40, 0x5c, 0x78, 0x94, 0xa6, 0x8c, 0x73, 0x5c, 0x4a, 0x3f, 0x3c, 0x41, 0x4e, 0x60, 0x79, 0x91, 0xad, 0xa4, 0x84, 0x64, 0x44, 0x5a, 0x76, 0x93, 0x90, 0x74, 0x55, 0x36, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x2f, 0x4d, 0x6c, 0x88, 0xa0, 0x83, 0x67, 0x4a, 0x4f, 0x6c, 0x86, 0xa0, 0x9d, 0x87, 0x74, 0x66, 0x5d, 0x5c, 0x60, 0x6a, 0x79, 0x8c, 0x9b, 0x9d, 0xa4, 0x86, 0x6a, 0x59, 0x6a, 0x83, 0x9f, 0x86, 0x6a, 0x4c, 0x2e, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x26, 0x44, 0x63, 0x80, 0x9b, 0x8f, 0x73, 0x58, 0x41, 0x5c, 0x74, 0x8c, 0xa2, 0xa0, 0x8f, 0x83, 0x7c, 0x7a, 0x7d, 0x85, 0x93, 0x9d, 0x87, 0x8b, 0xa9, 0x95, 0x7f, 0x78, 0x81, 0x95, 0x94, 0x7a, 0x5e, 0x41, 0x24, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1c, 0x3a, 0x56, 0x74, 0x8f, 0x9d, 0x81, 0x68, 0x4e, 0x49, 0x60, 0x77, 0x89, 0x9a, 0xa6, 0xa0, 0x9c, 0x98, 0x9c, 0xa2, 0x98, 0x87, 0x71, 0x80, 0x97, 0xaa, 0x9b, 0x98, 0x9d, 0x97, 0x81, 0x6a, 0x4f, 0x33, 0x17, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x2e, 0x4a, 0x66, 0x80, 0x9a, 0x92, 0x79, 0x60, 0x4a, 0x4a, 0x5e, 0x71, 0x7f, 0x8a, 0x91, 0x94, 0x94, 0x90, 0x88, 0x7f, 0x6e, 0x5b, 0x6d, 0x81, 0x8f, 0x94, 0x94, 0x8c, 0x7f, 0x6b, 0x55, 0x3e, 0x24, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x1f, 0x3a, 0x56, 0x71, 0x89, 0xa1, 0x8c, 0x77, 0x60, 0x4d, 0x45, 0x55, 0x63, 0x6c, 0x74, 0x75, 0x74, 0x74, 0x6c, 0x61, 0x53, 0x43, 0x55, 0x66, 0x71, 0x75, 0x74, 0x70, 0x65, 0x54, 0x3f, 0x28, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x2a, 0x45, 0x5e, 0x77, 0x8f, 0xa2, 0x8c, 0x79, 0x66, 0x56, 0x48, 0x45, 0x4e, 0x54, 0x57, 0x56, 0x54, 0x4e, 0x44, 0x3d, 0x48, 0x50, 0x4c, 0x53, 0x57, 0x55, 0x51, 0x48, 0x3a, 0x28, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x32, 0x4a, 0x63, 0x79, 0x8c, 0xa0, 0x91, 0x80, 0x71, 0x65, 0x5a, 0x51, 0x4c, 0x48, 0x48, 0x48, 0x4c, 0x52, 0x5b, 0x65, 0x70, 0x63, 0x46, 0x38, 0x36, 0x33, 0x2a, 0x1e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x36, 0x4d, 0x63, 0x77, 0x88, 0x9a, 0x9a, 0x8c, 0x80, 0x78, 0x70, 0x6c, 0x68, 0x67, 0x68, 0x6c, 0x70, 0x78, 0x81, 0x8b, 0x6f, 0x51, 0x33, 0x18, 0x13, 0x0c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x36, 0x4a, 0x5d, 0x6f, 0x7f, 0x8d, 0x9a, 0x9d, 0x95, 0x8d, 0x88, 0x88, 0x84, 0x88, 0x8a, 0x8f, 0x95, 0x9f, 0x95, 0x78, 0x5b, 0x3c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1d, 0x31, 0x44, 0x55, 0x65, 0x73, 0x7f, 0x88, 0x90, 0x96, 0x9b, 0x9c, 0xa0, 0x9c, 0x9a, 0x94, 0x8f, 0x86, 0x7d, 0x6f, 0x58, 0x3a, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x18, 0x29, 0x3a, 0x48, 0x55, 0x61, 0x6a, 0x73, 0x78, 0x7c, 0x7f, 0x80, 0x7f, 0x7c, 0x78, 0x71, 0x6a, 0x60, 0x53, 0x44, 0x2d, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1e, 0x2c, 0x38, 0x43, 0x4c, 0x54, 0x58, 0x5c, 0x60, 0x60, 0x60, 0x5c, 0x58, 0x53, 0x4b, 0x42, 0x36, 0x28, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0e, 0x1b, 0x25, 0x2e, 0x34, 0x39, 0x3d, 0x40, 0x40, 0x40, 0x3d, 0x39, 0x34, 0x2d, 0x24, 0x1a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x16, 0x1a, 0x1d, 0x21, 0x21, 0x21, 0x1d, 0x1a, 0x14, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0041 "A" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1a, 0x1d, 0x1d, 0x1d, 0x1d, 0x16, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x2a, 0x39, 0x3d, 0x3d, 0x3d, 0x3c, 0x33, 0x20, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x27, 0x41, 0x56, 0x5c, 0x5c, 0x5c, 0x5c, 0x4d, 0x33, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x35, 0x51, 0x6d, 0x7c, 0x7c, 0x7c, 0x79, 0x5c, 0x3f, 0x23, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x25, 0x41, 0x5f, 0x7b, 0x96, 0x9c, 0x9c, 0x85, 0x6a, 0x4d, 0x2f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x31, 0x4e, 0x6c, 0x86, 0xa3, 0xac, 0xae, 0x91, 0x76, 0x5a, 0x3e, 0x20, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x21, 0x3f, 0x5c, 0x78, 0x93, 0xa6, 0x8d, 0x9b, 0x9f, 0x83, 0x66, 0x4a, 0x2e, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2f, 0x4c, 0x68, 0x84, 0xa1, 0x9a, 0x7d, 0x8f, 0xaa, 0x8f, 0x74, 0x57, 0x3a, 0x1e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1f, 0x3c, 0x58, 0x76, 0x91, 0xa9, 0x8c, 0x71, 0x83, 0x9f, 0x9b, 0x80, 0x65, 0x48, 0x2a, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x2c, 0x49, 0x66, 0x81, 0x9d, 0x9c, 0x80, 0x65, 0x76, 0x93, 0xaa, 0x8c, 0x71, 0x55, 0x38, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3a, 0x56, 0x73, 0x8d, 0xaa, 0x90, 0x74, 0x58, 0x6a, 0x86, 0xa2, 0x9a, 0x7f, 0x61, 0x45, 0x28, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2a, 0x46, 0x63, 0x80, 0x9b, 0xa0, 0x83, 0x68, 0x4c, 0x5e, 0x7a, 0x96, 0xa6, 0x8a, 0x6f, 0x52, 0x35, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x36, 0x53, 0x70, 0x8c, 0xa8, 0x93, 0x78, 0x5c, 0x3e, 0x51, 0x6d, 0x88, 0xa6, 0x96, 0x7b, 0x5f, 0x43, 0x25, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x27, 0x43, 0x61, 0x7d, 0x98, 0xa4, 0x86, 0x6c, 0x4e, 0x31, 0x44, 0x61, 0x7d, 0x9a, 0xa4, 0x88, 0x6c, 0x4f, 0x33, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x34, 0x51, 0x6d, 0x88, 0xa5, 0x96, 0x7b, 0x5f, 0x42, 0x25, 0x38, 0x55, 0x71, 0x8c, 0xaa, 0x94, 0x7a, 0x5c, 0x3f, 0x23, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x25, 0x41, 0x5e, 0x7a, 0x96, 0xa6, 0x8a, 0x6f, 0x52, 0x36, 0x35, 0x35, 0x48, 0x65, 0x80, 0x9c, 0xa1, 0x85, 0x6a, 0x4d, 0x2f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x31, 0x4e, 0x6b, 0x86, 0xa2, 0x9a, 0x7f, 0x63, 0x54, 0x54, 0x54, 0x54, 0x54, 0x58, 0x74, 0x90, 0xac, 0x91, 0x76, 0x5a, 0x3e, 0x20, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x21, 0x3e, 0x5c, 0x78, 0x93, 0xac, 0x8d, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x83, 0xa0, 0x9f, 0x83, 0x66, 0x4a, 0x2e, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x2e, 0x4c, 0x68, 0x83, 0xa0, 0xb1, 0x98, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0xa6, 0xab, 0x8f, 0x74, 0x57, 0x3a, 0x1e, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x1f, 0x3c, 0x58, 0x74, 0x90, 0xad, 0x9d, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa8, 0x9b, 0x80, 0x65, 0x48, 0x2a, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x2c, 0x48, 0x65, 0x81, 0x9d, 0xa1, 0x85, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x96, 0xaa, 0x8c, 0x71, 0x55, 0x38, 0x1b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1c, 0x38, 0x56, 0x73, 0x8d, 0xaa, 0x94, 0x7a, 0x5d, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x6f, 0x8a, 0xa8, 0x9a, 0x7f, 0x61, 0x45, 0x28, 0x0c, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x29, 0x46, 0x63, 0x7f, 0x9a, 0xa4, 0x88, 0x6d, 0x50, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x46, 0x63, 0x7f, 0x9a, 0xa6, 0x8a, 0x6f, 0x52, 0x35, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0x36, 0x53, 0x6f, 0x8b, 0xa8, 0x98, 0x7d, 0x60, 0x43, 0x27, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x38, 0x56, 0x73, 0x8d, 0xaa, 0x96, 0x7b, 0x5f, 0x43, 0x25, 0x08, 0x00,
+    0x00, 0x09, 0x27, 0x43, 0x5f, 0x7c, 0x98, 0xa8, 0x8c, 0x70, 0x53, 0x36, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x2c, 0x48, 0x66, 0x81, 0x9d, 0xa4, 0x88, 0x6c, 0x4f, 0x33, 0x16, 0x00,
+    0x00, 0x10, 0x30, 0x4f, 0x6d, 0x88, 0x90, 0x90, 0x80, 0x64, 0x46, 0x2a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x3c, 0x5a, 0x76, 0x8f, 0x90, 0x90, 0x7a, 0x5c, 0x3c, 0x1d, 0x00,
+    0x00, 0x0f, 0x2f, 0x4d, 0x69, 0x70, 0x70, 0x70, 0x6d, 0x56, 0x3a, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x2f, 0x4c, 0x66, 0x70, 0x70, 0x70, 0x6f, 0x58, 0x3a, 0x1b, 0x00,
+    0x00, 0x06, 0x23, 0x3c, 0x4d, 0x50, 0x50, 0x50, 0x4f, 0x41, 0x2a, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x21, 0x39, 0x4c, 0x50, 0x50, 0x50, 0x50, 0x44, 0x2d, 0x11, 0x00,
+    0x00, 0x00, 0x0f, 0x23, 0x2f, 0x31, 0x31, 0x31, 0x30, 0x27, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x21, 0x2e, 0x31, 0x31, 0x31, 0x30, 0x28, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x0f, 0x11, 0x11, 0x11, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0f, 0x11, 0x11, 0x11, 0x11, 0x0b, 0x00, 0x00, 0x00,
+
+    /* U+0042 "B" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x17, 0x11, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x25, 0x36, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3b, 0x36, 0x2f, 0x26, 0x1a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1d, 0x3a, 0x52, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5a, 0x55, 0x4e, 0x43, 0x36, 0x27, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x78, 0x74, 0x6c, 0x61, 0x53, 0x41, 0x2e, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x98, 0x91, 0x88, 0x7d, 0x6d, 0x5b, 0x44, 0x2d, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa9, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9c, 0xa6, 0xa5, 0x97, 0x86, 0x71, 0x58, 0x3e, 0x23, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x80, 0x8a, 0x9a, 0xad, 0x9d, 0x83, 0x6a, 0x4e, 0x30, 0x12, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x5b, 0x63, 0x6f, 0x81, 0x9b, 0xae, 0x93, 0x76, 0x58, 0x39, 0x1a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3c, 0x45, 0x57, 0x71, 0x8d, 0xac, 0x9b, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x19, 0x19, 0x19, 0x19, 0x1c, 0x2c, 0x4b, 0x69, 0x88, 0xa8, 0x9c, 0x7f, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x25, 0x25, 0x25, 0x25, 0x26, 0x2b, 0x35, 0x4e, 0x6c, 0x8a, 0xa8, 0x9a, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x49, 0x52, 0x61, 0x79, 0x93, 0xac, 0x90, 0x74, 0x56, 0x38, 0x1a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x68, 0x70, 0x7b, 0x8c, 0xa3, 0x9a, 0x81, 0x68, 0x4c, 0x2e, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa1, 0x87, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x88, 0x8c, 0x96, 0xa5, 0x96, 0x84, 0x6e, 0x57, 0x3d, 0x21, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xb3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa6, 0xab, 0xb2, 0xa4, 0x85, 0x78, 0x6a, 0x58, 0x41, 0x2b, 0x12, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x95, 0x9f, 0xa0, 0x94, 0x83, 0x6e, 0x58, 0x3e, 0x23, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x73, 0x78, 0x83, 0x92, 0xa8, 0x9a, 0x83, 0x6a, 0x4e, 0x31, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x54, 0x5b, 0x68, 0x7c, 0x94, 0xad, 0x93, 0x78, 0x5a, 0x3b, 0x1c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x34, 0x3e, 0x50, 0x6c, 0x88, 0xa6, 0x9c, 0x80, 0x60, 0x42, 0x23, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x26, 0x45, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x29, 0x32, 0x4a, 0x68, 0x85, 0xa4, 0xa3, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x50, 0x5e, 0x74, 0x8d, 0xab, 0x9c, 0x7f, 0x60, 0x41, 0x22, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x68, 0x6d, 0x78, 0x89, 0xa0, 0xaa, 0x8f, 0x74, 0x58, 0x3a, 0x1b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x85, 0x8b, 0x94, 0xa2, 0xa8, 0x95, 0x7f, 0x66, 0x4a, 0x2e, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xae, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa7, 0xa3, 0x9a, 0x8d, 0x7d, 0x69, 0x52, 0x3a, 0x1f, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8d, 0x8a, 0x84, 0x7d, 0x73, 0x63, 0x52, 0x3c, 0x25, 0x0e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x23, 0x42, 0x5f, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x6c, 0x67, 0x60, 0x55, 0x48, 0x38, 0x25, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x48, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4c, 0x48, 0x41, 0x38, 0x2c, 0x1d, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x1c, 0x2b, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2d, 0x28, 0x22, 0x1a, 0x0e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0d, 0x09, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0043 "C" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x11, 0x18, 0x20, 0x24, 0x25, 0x25, 0x25, 0x23, 0x1e, 0x17, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x24, 0x2f, 0x37, 0x3f, 0x44, 0x44, 0x44, 0x44, 0x42, 0x3d, 0x36, 0x2d, 0x21, 0x15, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x13, 0x25, 0x33, 0x41, 0x4c, 0x56, 0x5d, 0x63, 0x64, 0x64, 0x64, 0x60, 0x5c, 0x55, 0x4b, 0x3f, 0x31, 0x21, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1a, 0x2d, 0x3f, 0x4f, 0x5e, 0x6a, 0x74, 0x7c, 0x80, 0x84, 0x84, 0x84, 0x80, 0x7b, 0x73, 0x68, 0x5c, 0x4c, 0x3b, 0x28, 0x12, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1a, 0x31, 0x47, 0x5a, 0x6b, 0x7a, 0x86, 0x91, 0x99, 0xa0, 0xa4, 0xa4, 0xa4, 0x9f, 0x98, 0x8f, 0x84, 0x77, 0x66, 0x54, 0x3f, 0x28, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x1a, 0x31, 0x47, 0x5d, 0x73, 0x84, 0x94, 0xa2, 0xab, 0xa3, 0x9c, 0x98, 0x98, 0x98, 0x9b, 0xa3, 0xab, 0xa1, 0x91, 0x7f, 0x6b, 0x55, 0x3e, 0x23, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x2d, 0x47, 0x5d, 0x74, 0x89, 0x9d, 0xad, 0x9d, 0x8f, 0x85, 0x7d, 0x78, 0x78, 0x78, 0x7c, 0x85, 0x90, 0x9f, 0xab, 0x97, 0x81, 0x6a, 0x4b, 0x2c, 0x0c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x24, 0x3f, 0x5a, 0x73, 0x89, 0xa0, 0xaa, 0x95, 0x83, 0x74, 0x68, 0x60, 0x59, 0x58, 0x58, 0x5f, 0x68, 0x74, 0x85, 0x97, 0x8f, 0x79, 0x63, 0x48, 0x2a, 0x0b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x33, 0x4f, 0x6a, 0x84, 0x9d, 0xab, 0x94, 0x7f, 0x6a, 0x5a, 0x4b, 0x41, 0x3a, 0x39, 0x39, 0x41, 0x4c, 0x5b, 0x6c, 0x81, 0x79, 0x63, 0x4d, 0x36, 0x1d, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x23, 0x41, 0x5e, 0x7a, 0x94, 0xae, 0x98, 0x7f, 0x69, 0x52, 0x3e, 0x2e, 0x23, 0x1b, 0x19, 0x1a, 0x23, 0x2f, 0x40, 0x55, 0x67, 0x63, 0x4d, 0x36, 0x20, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x2d, 0x4b, 0x68, 0x85, 0xa2, 0xa4, 0x88, 0x6e, 0x54, 0x3c, 0x25, 0x13, 0x04, 0x00, 0x00, 0x00, 0x05, 0x14, 0x28, 0x3d, 0x48, 0x46, 0x36, 0x20, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x35, 0x54, 0x73, 0x8f, 0xad, 0x98, 0x7c, 0x5f, 0x43, 0x28, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x21, 0x28, 0x27, 0x1c, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3b, 0x5a, 0x78, 0x97, 0xae, 0x90, 0x73, 0x54, 0x36, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x09, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1f, 0x3e, 0x5c, 0x7c, 0x9c, 0xa8, 0x8a, 0x6c, 0x4c, 0x2e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0xa0, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0x9c, 0xa8, 0x88, 0x68, 0x49, 0x2b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9a, 0xab, 0x8c, 0x6d, 0x4f, 0x30, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1a, 0x38, 0x58, 0x76, 0x94, 0xb0, 0x93, 0x76, 0x58, 0x3a, 0x1e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x18, 0x17, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x13, 0x33, 0x51, 0x6f, 0x8b, 0xa9, 0x9c, 0x80, 0x65, 0x4a, 0x30, 0x17, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1a, 0x2e, 0x38, 0x35, 0x28, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x29, 0x47, 0x65, 0x80, 0x9c, 0xaa, 0x8f, 0x74, 0x5c, 0x44, 0x2f, 0x1e, 0x10, 0x08, 0x05, 0x08, 0x11, 0x1f, 0x32, 0x47, 0x57, 0x53, 0x41, 0x2b, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x1e, 0x3a, 0x58, 0x74, 0x8d, 0xa8, 0xa0, 0x87, 0x71, 0x5b, 0x49, 0x39, 0x2e, 0x28, 0x25, 0x28, 0x2f, 0x3a, 0x4b, 0x5e, 0x74, 0x6e, 0x58, 0x41, 0x2b, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x2e, 0x48, 0x63, 0x7d, 0x95, 0xae, 0x9d, 0x87, 0x74, 0x65, 0x56, 0x4c, 0x47, 0x44, 0x47, 0x4d, 0x57, 0x66, 0x77, 0x89, 0x84, 0x6e, 0x58, 0x40, 0x25, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x1d, 0x38, 0x52, 0x6b, 0x81, 0x97, 0xac, 0x9f, 0x8d, 0x7f, 0x74, 0x6b, 0x65, 0x64, 0x65, 0x6b, 0x74, 0x80, 0x8f, 0xa2, 0x9a, 0x84, 0x6b, 0x4c, 0x2c, 0x0d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x25, 0x3f, 0x55, 0x6b, 0x81, 0x93, 0xa4, 0xa9, 0x9b, 0x90, 0x88, 0x84, 0x84, 0x84, 0x88, 0x90, 0x9b, 0xaa, 0xa0, 0x8c, 0x79, 0x63, 0x48, 0x2a, 0x0b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x28, 0x3f, 0x55, 0x69, 0x7b, 0x8a, 0x98, 0xa3, 0xab, 0xa8, 0xa4, 0xa4, 0xa4, 0xa8, 0xaa, 0xa0, 0x94, 0x85, 0x76, 0x63, 0x4d, 0x36, 0x1d, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x28, 0x3c, 0x4f, 0x60, 0x6f, 0x7b, 0x85, 0x8d, 0x94, 0x98, 0x98, 0x96, 0x93, 0x8c, 0x83, 0x78, 0x6c, 0x5c, 0x4a, 0x36, 0x20, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x23, 0x35, 0x45, 0x53, 0x5f, 0x68, 0x70, 0x74, 0x78, 0x78, 0x78, 0x74, 0x6f, 0x66, 0x5c, 0x4f, 0x40, 0x30, 0x1d, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1a, 0x28, 0x35, 0x41, 0x4b, 0x51, 0x55, 0x58, 0x58, 0x58, 0x54, 0x50, 0x48, 0x3e, 0x33, 0x25, 0x15, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x23, 0x2c, 0x33, 0x36, 0x39, 0x39, 0x39, 0x35, 0x31, 0x2a, 0x20, 0x15, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0d, 0x13, 0x17, 0x19, 0x19, 0x19, 0x16, 0x12, 0x0b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0044 "D" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x19, 0x14, 0x0d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x25, 0x36, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x38, 0x33, 0x2b, 0x21, 0x17, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1d, 0x3a, 0x52, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x58, 0x52, 0x49, 0x3f, 0x34, 0x27, 0x16, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x76, 0x70, 0x67, 0x5d, 0x51, 0x41, 0x31, 0x20, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x98, 0x94, 0x8d, 0x84, 0x7a, 0x6d, 0x5d, 0x4c, 0x39, 0x23, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xae, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa0, 0xa4, 0xab, 0xa1, 0x96, 0x86, 0x78, 0x66, 0x4f, 0x39, 0x23, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x81, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x80, 0x86, 0x90, 0x9b, 0xaa, 0xa1, 0x8f, 0x7c, 0x66, 0x4f, 0x38, 0x1e, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5f, 0x63, 0x6a, 0x74, 0x80, 0x8f, 0xa3, 0xa8, 0x92, 0x7c, 0x63, 0x4a, 0x2f, 0x14, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x44, 0x4c, 0x56, 0x66, 0x77, 0x89, 0xa1, 0xa8, 0x8f, 0x76, 0x5b, 0x3f, 0x23, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x1d, 0x1d, 0x1d, 0x20, 0x24, 0x2e, 0x3a, 0x4b, 0x5f, 0x77, 0x8d, 0xa6, 0x9f, 0x85, 0x6a, 0x4d, 0x2f, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x01, 0x06, 0x10, 0x1f, 0x33, 0x4a, 0x63, 0x7d, 0x98, 0xaf, 0x91, 0x76, 0x58, 0x3a, 0x1c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x37, 0x53, 0x6f, 0x8b, 0xa9, 0x9c, 0x80, 0x61, 0x43, 0x24, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x29, 0x47, 0x65, 0x81, 0xa0, 0xa4, 0x85, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x3f, 0x5d, 0x7c, 0x9c, 0xa8, 0x8a, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3c, 0x5c, 0x7b, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9b, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x23, 0x42, 0x60, 0x80, 0x9c, 0xa8, 0x88, 0x6a, 0x4b, 0x2c, 0x0c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2e, 0x4b, 0x68, 0x85, 0xa4, 0xa1, 0x84, 0x65, 0x47, 0x28, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x25, 0x3e, 0x58, 0x74, 0x8f, 0xad, 0x98, 0x7c, 0x5d, 0x3f, 0x21, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x09, 0x09, 0x09, 0x0d, 0x12, 0x1c, 0x2a, 0x3c, 0x52, 0x6a, 0x83, 0x9d, 0xa9, 0x8c, 0x71, 0x53, 0x36, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x29, 0x29, 0x29, 0x29, 0x2d, 0x31, 0x39, 0x45, 0x55, 0x69, 0x7f, 0x95, 0xae, 0x98, 0x7f, 0x65, 0x48, 0x2a, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x50, 0x57, 0x63, 0x71, 0x81, 0x95, 0xab, 0xa0, 0x87, 0x6e, 0x54, 0x39, 0x1e, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6c, 0x6f, 0x75, 0x7f, 0x8a, 0x9a, 0xac, 0x9f, 0x89, 0x74, 0x5c, 0x43, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa3, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8c, 0x93, 0x9b, 0xa6, 0xa6, 0x97, 0x86, 0x74, 0x5d, 0x47, 0x30, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xb0, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xa7, 0xa0, 0x96, 0x8a, 0x7d, 0x6d, 0x5b, 0x47, 0x31, 0x1a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8c, 0x88, 0x81, 0x7a, 0x6f, 0x61, 0x53, 0x41, 0x2f, 0x1a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x23, 0x42, 0x5f, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x6d, 0x6a, 0x64, 0x5c, 0x51, 0x45, 0x36, 0x27, 0x16, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x48, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4f, 0x4b, 0x46, 0x3e, 0x34, 0x28, 0x1a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x1c, 0x2b, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x2c, 0x27, 0x1f, 0x16, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0045 "E" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x13, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x25, 0x36, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3b, 0x2f, 0x1a, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1d, 0x3a, 0x52, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5a, 0x47, 0x2c, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x73, 0x54, 0x34, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xae, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x81, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x73, 0x54, 0x34, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5a, 0x47, 0x2c, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3b, 0x2f, 0x1a, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x13, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x25, 0x18, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x43, 0x31, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x5d, 0x43, 0x25, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa1, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xb4, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa7, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x63, 0x46, 0x27, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4a, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2d, 0x1e, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x09, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x24, 0x16, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x41, 0x2e, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x5b, 0x3f, 0x21, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa3, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xb0, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x23, 0x42, 0x5f, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x5f, 0x42, 0x23, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x48, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x48, 0x33, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x1c, 0x2b, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2b, 0x1c, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0d, 0x01, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0046 "F" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x13, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x25, 0x36, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3b, 0x2f, 0x1a, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1d, 0x3a, 0x52, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5a, 0x47, 0x2c, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x73, 0x54, 0x34, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xae, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x81, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x73, 0x54, 0x34, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5a, 0x47, 0x2c, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3b, 0x2f, 0x1a, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x13, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x25, 0x18, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x43, 0x31, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x5d, 0x43, 0x25, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa3, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xb6, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa7, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x63, 0x46, 0x27, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4a, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2d, 0x1e, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x90, 0x90, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x23, 0x42, 0x5f, 0x70, 0x70, 0x70, 0x70, 0x5c, 0x3e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x48, 0x50, 0x50, 0x50, 0x50, 0x46, 0x30, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x1c, 0x2b, 0x31, 0x31, 0x31, 0x31, 0x2a, 0x1a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0047 "G" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x10, 0x18, 0x1f, 0x24, 0x25, 0x25, 0x25, 0x24, 0x20, 0x1a, 0x11, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x23, 0x2e, 0x37, 0x3e, 0x43, 0x44, 0x44, 0x44, 0x44, 0x3f, 0x38, 0x2f, 0x25, 0x17, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x13, 0x24, 0x33, 0x41, 0x4c, 0x56, 0x5c, 0x61, 0x64, 0x64, 0x64, 0x63, 0x5d, 0x56, 0x4d, 0x41, 0x33, 0x25, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1a, 0x2d, 0x3f, 0x4f, 0x5e, 0x6a, 0x74, 0x7c, 0x80, 0x84, 0x84, 0x84, 0x80, 0x7c, 0x74, 0x6b, 0x5e, 0x4f, 0x3f, 0x2d, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1a, 0x31, 0x47, 0x5a, 0x6a, 0x7a, 0x85, 0x90, 0x99, 0xa0, 0xa4, 0xa4, 0xa4, 0xa0, 0x9a, 0x91, 0x86, 0x7a, 0x6b, 0x58, 0x44, 0x2e, 0x17, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x1a, 0x31, 0x47, 0x5d, 0x73, 0x84, 0x94, 0xa2, 0xac, 0xa3, 0x9c, 0x98, 0x98, 0x98, 0x9a, 0xa0, 0xaa, 0xa2, 0x94, 0x84, 0x71, 0x5b, 0x44, 0x2a, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x2d, 0x47, 0x5d, 0x74, 0x89, 0x9d, 0xad, 0x9d, 0x90, 0x85, 0x7d, 0x78, 0x78, 0x78, 0x7c, 0x83, 0x8d, 0x9a, 0xab, 0x9d, 0x87, 0x71, 0x53, 0x34, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x24, 0x3f, 0x5a, 0x73, 0x89, 0xa0, 0xab, 0x95, 0x83, 0x74, 0x68, 0x60, 0x59, 0x58, 0x58, 0x5d, 0x66, 0x71, 0x80, 0x91, 0x95, 0x7f, 0x69, 0x4f, 0x32, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x33, 0x4f, 0x6a, 0x84, 0x9d, 0xab, 0x95, 0x7f, 0x6b, 0x5a, 0x4c, 0x41, 0x3a, 0x39, 0x39, 0x3f, 0x48, 0x56, 0x66, 0x79, 0x7f, 0x69, 0x52, 0x3c, 0x24, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x23, 0x3f, 0x5d, 0x7a, 0x94, 0xae, 0x98, 0x7f, 0x69, 0x52, 0x3f, 0x2e, 0x23, 0x1b, 0x19, 0x1a, 0x20, 0x2b, 0x3b, 0x4d, 0x63, 0x66, 0x52, 0x3c, 0x25, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x2d, 0x4b, 0x68, 0x85, 0xa1, 0xa4, 0x88, 0x6e, 0x54, 0x3c, 0x25, 0x13, 0x05, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x21, 0x36, 0x46, 0x48, 0x3b, 0x25, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x35, 0x54, 0x73, 0x8f, 0xad, 0x98, 0x7c, 0x5f, 0x43, 0x28, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x13, 0x1e, 0x27, 0x28, 0x20, 0x1a, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3b, 0x5a, 0x78, 0x97, 0xae, 0x90, 0x73, 0x54, 0x36, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1a, 0x2f, 0x3b, 0x3d, 0x3d, 0x3d, 0x39, 0x2a, 0x14, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1f, 0x3e, 0x5c, 0x7c, 0x9c, 0xa8, 0x8a, 0x6c, 0x4c, 0x2e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2c, 0x47, 0x5a, 0x5c, 0x5c, 0x5c, 0x56, 0x41, 0x27, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0xa0, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x34, 0x54, 0x73, 0x7c, 0x7c, 0x7c, 0x6d, 0x4f, 0x30, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0x9c, 0xa8, 0x88, 0x68, 0x49, 0x2b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0x9c, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9a, 0xab, 0x8c, 0x6d, 0x4f, 0x30, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1a, 0x38, 0x58, 0x76, 0x94, 0xb0, 0x93, 0x76, 0x58, 0x3c, 0x1e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x13, 0x33, 0x51, 0x6f, 0x8b, 0xa9, 0x9d, 0x80, 0x65, 0x4a, 0x30, 0x17, 0x03, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x29, 0x47, 0x65, 0x80, 0x9b, 0xaa, 0x8f, 0x76, 0x5d, 0x44, 0x30, 0x1e, 0x11, 0x09, 0x05, 0x07, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x1e, 0x3a, 0x56, 0x73, 0x8d, 0xa8, 0xa0, 0x87, 0x71, 0x5c, 0x4a, 0x3a, 0x2f, 0x28, 0x25, 0x26, 0x2c, 0x36, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x2c, 0x48, 0x63, 0x7d, 0x95, 0xae, 0x9d, 0x87, 0x74, 0x65, 0x57, 0x4d, 0x48, 0x44, 0x45, 0x4b, 0x53, 0x5f, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x1d, 0x38, 0x52, 0x6a, 0x81, 0x97, 0xab, 0xa0, 0x8f, 0x80, 0x75, 0x6c, 0x66, 0x64, 0x64, 0x69, 0x71, 0x7b, 0x88, 0x9a, 0xaf, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x25, 0x3e, 0x55, 0x6b, 0x80, 0x93, 0xa4, 0xaa, 0x9b, 0x91, 0x88, 0x84, 0x84, 0x84, 0x88, 0x8d, 0x98, 0xa4, 0xa8, 0x98, 0x86, 0x6f, 0x50, 0x30, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x28, 0x3f, 0x55, 0x69, 0x7a, 0x88, 0x96, 0xa2, 0xab, 0xa8, 0xa4, 0xa4, 0xa4, 0xa6, 0xaa, 0xa4, 0x99, 0x8c, 0x7f, 0x6e, 0x5b, 0x44, 0x28, 0x0b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x28, 0x3c, 0x4f, 0x5f, 0x6d, 0x7b, 0x85, 0x8c, 0x94, 0x97, 0x98, 0x97, 0x94, 0x8c, 0x85, 0x7c, 0x71, 0x63, 0x53, 0x42, 0x2e, 0x17, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x23, 0x34, 0x43, 0x51, 0x5e, 0x68, 0x70, 0x74, 0x78, 0x78, 0x78, 0x74, 0x70, 0x68, 0x5f, 0x55, 0x46, 0x38, 0x28, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x27, 0x35, 0x41, 0x49, 0x50, 0x54, 0x58, 0x58, 0x58, 0x54, 0x50, 0x4b, 0x42, 0x37, 0x2a, 0x1c, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x17, 0x23, 0x2b, 0x32, 0x35, 0x39, 0x39, 0x39, 0x35, 0x32, 0x2c, 0x23, 0x19, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x13, 0x17, 0x19, 0x19, 0x19, 0x17, 0x13, 0x0c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0048 "H" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x1d, 0x1d, 0x1d, 0x1d, 0x17, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x1d, 0x1d, 0x1d, 0x1d, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x25, 0x36, 0x3d, 0x3d, 0x3d, 0x3c, 0x35, 0x23, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x25, 0x36, 0x3d, 0x3d, 0x3d, 0x3d, 0x36, 0x25, 0x0e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1d, 0x3a, 0x52, 0x5c, 0x5c, 0x5c, 0x5c, 0x4f, 0x36, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3a, 0x52, 0x5c, 0x5c, 0x5c, 0x5c, 0x52, 0x3a, 0x1d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x7c, 0x7c, 0x7c, 0x7b, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x7c, 0x7c, 0x7c, 0x7c, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x9c, 0x9c, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x9c, 0x9c, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa3, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8a, 0xa5, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xb6, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xb6, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa6, 0x91, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x91, 0xa8, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x90, 0x90, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x90, 0x90, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x23, 0x42, 0x5f, 0x70, 0x70, 0x70, 0x70, 0x5c, 0x3e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x23, 0x42, 0x5f, 0x70, 0x70, 0x70, 0x70, 0x5f, 0x42, 0x23, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x48, 0x50, 0x50, 0x50, 0x50, 0x46, 0x30, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x48, 0x50, 0x50, 0x50, 0x50, 0x48, 0x33, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x1c, 0x2b, 0x31, 0x31, 0x31, 0x31, 0x2a, 0x1a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1c, 0x2b, 0x31, 0x31, 0x31, 0x31, 0x2b, 0x1c, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x0d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0049 "I" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x1d, 0x1d, 0x1d, 0x1d, 0x17, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x25, 0x36, 0x3d, 0x3d, 0x3d, 0x3c, 0x35, 0x23, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1d, 0x3a, 0x52, 0x5c, 0x5c, 0x5c, 0x5c, 0x4f, 0x36, 0x1a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x7c, 0x7c, 0x7c, 0x7b, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x9c, 0x9c, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x90, 0x90, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x23, 0x42, 0x5f, 0x70, 0x70, 0x70, 0x70, 0x5c, 0x3e, 0x1f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x48, 0x50, 0x50, 0x50, 0x50, 0x46, 0x30, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x1c, 0x2b, 0x31, 0x31, 0x31, 0x31, 0x2a, 0x1a, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+004A "J" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1b, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x15, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x2d, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x31, 0x1d, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0b, 0x28, 0x44, 0x58, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5b, 0x4a, 0x2f, 0x12, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x30, 0x50, 0x6f, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x76, 0x58, 0x38, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0xb4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x30, 0x50, 0x6f, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x8c, 0xac, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0b, 0x28, 0x44, 0x58, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x6c, 0x8c, 0xac, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x2d, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x4c, 0x6c, 0x8c, 0xac, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1b, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x10, 0x15, 0x11, 0x05, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x1d, 0x2e, 0x35, 0x2f, 0x1f, 0x09, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x1b, 0x33, 0x49, 0x54, 0x4b, 0x36, 0x1d, 0x08, 0x11, 0x31, 0x50, 0x70, 0x8c, 0xac, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x30, 0x47, 0x60, 0x74, 0x63, 0x4a, 0x34, 0x25, 0x22, 0x37, 0x55, 0x74, 0x90, 0xaf, 0x94, 0x74, 0x55, 0x36, 0x17, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x2c, 0x44, 0x5d, 0x74, 0x8b, 0x77, 0x60, 0x4f, 0x44, 0x41, 0x4b, 0x61, 0x7d, 0x99, 0xab, 0x8c, 0x70, 0x51, 0x33, 0x13, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0x37, 0x56, 0x71, 0x87, 0xa0, 0x8c, 0x7a, 0x6c, 0x64, 0x60, 0x67, 0x77, 0x8c, 0xa6, 0xa1, 0x84, 0x67, 0x49, 0x2b, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0x37, 0x56, 0x73, 0x89, 0xa0, 0xa4, 0x94, 0x88, 0x80, 0x80, 0x84, 0x8f, 0xa3, 0xa8, 0x8f, 0x77, 0x5c, 0x3f, 0x21, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x2c, 0x47, 0x5d, 0x74, 0x88, 0x98, 0xa6, 0xa5, 0xa0, 0xa0, 0xa3, 0xaa, 0xa1, 0x91, 0x7c, 0x66, 0x4b, 0x31, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x1a, 0x31, 0x47, 0x5d, 0x6f, 0x7f, 0x88, 0x91, 0x97, 0x98, 0x94, 0x8f, 0x85, 0x78, 0x66, 0x4f, 0x39, 0x1f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x1a, 0x31, 0x44, 0x53, 0x61, 0x6c, 0x74, 0x78, 0x78, 0x76, 0x71, 0x6a, 0x5d, 0x4c, 0x39, 0x23, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x18, 0x28, 0x38, 0x44, 0x4e, 0x54, 0x58, 0x58, 0x58, 0x53, 0x4b, 0x41, 0x31, 0x21, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x1b, 0x26, 0x2f, 0x35, 0x39, 0x39, 0x38, 0x34, 0x2d, 0x23, 0x16, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x11, 0x17, 0x19, 0x19, 0x19, 0x14, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+004B "K" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x1d, 0x1d, 0x1d, 0x1d, 0x17, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x16, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x15, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x25, 0x36, 0x3d, 0x3d, 0x3d, 0x3c, 0x35, 0x23, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x33, 0x3c, 0x3d, 0x3d, 0x3d, 0x3c, 0x31, 0x1d, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1d, 0x3a, 0x52, 0x5c, 0x5c, 0x5c, 0x5c, 0x4f, 0x36, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x36, 0x4d, 0x5c, 0x5c, 0x5c, 0x5c, 0x5b, 0x4a, 0x2f, 0x12, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x7c, 0x7c, 0x7c, 0x7b, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x06, 0x1f, 0x36, 0x4d, 0x63, 0x79, 0x7c, 0x7c, 0x7c, 0x76, 0x58, 0x38, 0x19, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x9c, 0x9c, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x06, 0x1d, 0x33, 0x4b, 0x63, 0x79, 0x8f, 0x9c, 0x97, 0x81, 0x69, 0x51, 0x34, 0x16, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x06, 0x1d, 0x33, 0x4a, 0x60, 0x77, 0x8f, 0xa5, 0x97, 0x81, 0x6b, 0x55, 0x3d, 0x25, 0x0a, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x06, 0x1d, 0x33, 0x4a, 0x60, 0x77, 0x8c, 0xa3, 0x9a, 0x81, 0x6b, 0x55, 0x3f, 0x28, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x1d, 0x33, 0x4a, 0x60, 0x77, 0x8c, 0xa3, 0x9a, 0x84, 0x6e, 0x56, 0x3f, 0x28, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x32, 0x4a, 0x60, 0x77, 0x8c, 0xa3, 0x9a, 0x84, 0x6e, 0x58, 0x41, 0x2a, 0x12, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x31, 0x47, 0x5e, 0x77, 0x8c, 0xa3, 0x9d, 0x87, 0x71, 0x58, 0x41, 0x2b, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x47, 0x5d, 0x74, 0x89, 0xa2, 0x9d, 0x87, 0x71, 0x5b, 0x44, 0x2b, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x47, 0x5d, 0x74, 0x89, 0xa0, 0xa0, 0x88, 0x71, 0x5b, 0x44, 0x2e, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x5d, 0x74, 0x89, 0xa0, 0xa0, 0x89, 0x74, 0x5d, 0x44, 0x2e, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x61, 0x74, 0x89, 0xa0, 0xac, 0x8c, 0x74, 0x5d, 0x47, 0x31, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x71, 0x89, 0xa0, 0xb3, 0xb1, 0x97, 0x7f, 0x69, 0x4f, 0x37, 0x1f, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x87, 0x9d, 0xa5, 0x94, 0xa0, 0xab, 0x93, 0x7c, 0x63, 0x4b, 0x33, 0x1a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x90, 0x9d, 0xa5, 0x8f, 0x79, 0x89, 0xa3, 0xa6, 0x8f, 0x77, 0x60, 0x47, 0x2f, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xba, 0xb0, 0xa5, 0x8f, 0x79, 0x63, 0x77, 0x8d, 0xa5, 0xa3, 0x8a, 0x74, 0x5b, 0x43, 0x2b, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xbf, 0xa8, 0x8f, 0x79, 0x63, 0x4d, 0x63, 0x79, 0x92, 0xa8, 0x9f, 0x87, 0x6e, 0x57, 0x3f, 0x26, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa9, 0x92, 0x7c, 0x65, 0x4d, 0x38, 0x4e, 0x66, 0x7d, 0x95, 0xab, 0x9a, 0x81, 0x6b, 0x52, 0x3b, 0x22, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x66, 0x4f, 0x39, 0x22, 0x39, 0x52, 0x69, 0x80, 0x97, 0xad, 0x96, 0x7f, 0x66, 0x4f, 0x36, 0x1d, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x23, 0x0d, 0x25, 0x3c, 0x55, 0x6b, 0x84, 0x9a, 0xab, 0x92, 0x7a, 0x63, 0x4a, 0x32, 0x1a, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x0f, 0x28, 0x3f, 0x58, 0x6f, 0x87, 0x9d, 0xa5, 0x8d, 0x77, 0x5e, 0x47, 0x2e, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x13, 0x2b, 0x44, 0x5b, 0x74, 0x89, 0xa2, 0xa2, 0x89, 0x73, 0x5b, 0x41, 0x29, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x17, 0x2e, 0x47, 0x5e, 0x77, 0x8c, 0xa5, 0x9d, 0x85, 0x6e, 0x55, 0x3e, 0x23, 0x06,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x90, 0x90, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x02, 0x1a, 0x32, 0x4a, 0x61, 0x79, 0x8f, 0x90, 0x90, 0x81, 0x6a, 0x4b, 0x2c, 0x0c,
+    0x00, 0x00, 0x00, 0x04, 0x23, 0x42, 0x5f, 0x70, 0x70, 0x70, 0x70, 0x5c, 0x3e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x35, 0x4d, 0x66, 0x70, 0x70, 0x70, 0x70, 0x66, 0x49, 0x2b, 0x0c,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x48, 0x50, 0x50, 0x50, 0x50, 0x46, 0x30, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x39, 0x4c, 0x50, 0x50, 0x50, 0x50, 0x4c, 0x39, 0x1f, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x1c, 0x2b, 0x31, 0x31, 0x31, 0x31, 0x2a, 0x1a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x21, 0x2e, 0x31, 0x31, 0x31, 0x31, 0x2e, 0x21, 0x0c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0f, 0x11, 0x11, 0x11, 0x11, 0x0f, 0x05, 0x00, 0x00,
+
+    /* U+004C "L" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x1d, 0x1d, 0x1d, 0x1d, 0x17, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x25, 0x36, 0x3d, 0x3d, 0x3d, 0x3c, 0x35, 0x23, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1d, 0x3a, 0x52, 0x5c, 0x5c, 0x5c, 0x5c, 0x4f, 0x36, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x7c, 0x7c, 0x7c, 0x7b, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x9c, 0x9c, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x25, 0x18, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x43, 0x31, 0x18, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x5d, 0x43, 0x25, 0x06,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa3, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x68, 0x48, 0x29, 0x09,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xb0, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa7, 0x88, 0x68, 0x48, 0x29, 0x09,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x88, 0x68, 0x48, 0x29, 0x09,
+    0x00, 0x00, 0x00, 0x04, 0x23, 0x42, 0x5f, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x63, 0x46, 0x27, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x48, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4a, 0x36, 0x1c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x1c, 0x2b, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2d, 0x1e, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x03, 0x00, 0x00,
+
+    /* U+004D "M" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x1d, 0x1d, 0x1d, 0x1b, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x17, 0x1d, 0x1d, 0x1d, 0x1c, 0x13, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x25, 0x36, 0x3d, 0x3d, 0x3d, 0x3a, 0x2d, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x23, 0x35, 0x3c, 0x3d, 0x3d, 0x3b, 0x2f, 0x1a, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1d, 0x3a, 0x52, 0x5c, 0x5c, 0x5c, 0x58, 0x44, 0x2a, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1c, 0x38, 0x4f, 0x5c, 0x5c, 0x5c, 0x5a, 0x47, 0x2c, 0x0e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x7c, 0x7c, 0x7c, 0x71, 0x56, 0x3b, 0x20, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x2c, 0x48, 0x63, 0x7b, 0x7c, 0x7c, 0x73, 0x54, 0x34, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x9c, 0x9a, 0x80, 0x66, 0x4b, 0x30, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x21, 0x3c, 0x57, 0x73, 0x8c, 0x9c, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xab, 0x8f, 0x76, 0x5c, 0x40, 0x25, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x31, 0x4c, 0x68, 0x81, 0x9b, 0xb3, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xbb, 0xa0, 0x85, 0x6c, 0x51, 0x35, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x26, 0x41, 0x5c, 0x78, 0x91, 0xac, 0xb4, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xc3, 0xb0, 0x95, 0x7b, 0x60, 0x45, 0x2a, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x35, 0x51, 0x6c, 0x86, 0xa1, 0xbc, 0xb4, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xb5, 0xac, 0xa4, 0x8a, 0x71, 0x55, 0x3a, 0x1f, 0x04, 0x00, 0x00, 0x00, 0x0f, 0x2a, 0x46, 0x61, 0x7b, 0x96, 0xab, 0xaa, 0xb4, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9f, 0x8c, 0xa1, 0x9a, 0x80, 0x66, 0x4a, 0x2f, 0x13, 0x00, 0x00, 0x04, 0x1f, 0x3a, 0x55, 0x71, 0x8a, 0xa5, 0x93, 0x8f, 0xad, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x91, 0xa9, 0x8f, 0x76, 0x5a, 0x3f, 0x24, 0x08, 0x00, 0x13, 0x2f, 0x4a, 0x66, 0x80, 0x9a, 0x9d, 0x83, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x81, 0x9b, 0x9f, 0x84, 0x6a, 0x4f, 0x34, 0x19, 0x08, 0x24, 0x3f, 0x5a, 0x76, 0x8f, 0xa7, 0x8d, 0x74, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x71, 0x8c, 0xa6, 0x94, 0x7a, 0x5f, 0x45, 0x29, 0x18, 0x33, 0x4f, 0x6a, 0x84, 0x9f, 0x98, 0x7f, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x61, 0x7c, 0x96, 0xa4, 0x89, 0x6f, 0x55, 0x3a, 0x28, 0x44, 0x5f, 0x7a, 0x94, 0xa2, 0x88, 0x6e, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x6c, 0x86, 0xa1, 0x9a, 0x7f, 0x65, 0x49, 0x38, 0x53, 0x6f, 0x88, 0xa3, 0x93, 0x7a, 0x5e, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x5c, 0x77, 0x91, 0xa9, 0x8d, 0x74, 0x5a, 0x48, 0x63, 0x7f, 0x98, 0x9d, 0x83, 0x6a, 0x4f, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x4c, 0x66, 0x81, 0x9b, 0x9d, 0x83, 0x6a, 0x58, 0x74, 0x8d, 0xa6, 0x8d, 0x74, 0x5a, 0x4c, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3e, 0x56, 0x71, 0x8c, 0xa6, 0x93, 0x7a, 0x68, 0x81, 0x9d, 0x98, 0x7f, 0x65, 0x49, 0x4c, 0x6c, 0x8c, 0xac, 0x94, 0x76, 0x58, 0x38, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x46, 0x61, 0x7c, 0x96, 0xa3, 0x88, 0x78, 0x92, 0xa3, 0x88, 0x6f, 0x54, 0x39, 0x4c, 0x6c, 0x8c, 0xac, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x36, 0x51, 0x6c, 0x86, 0xa1, 0x98, 0x8a, 0xa1, 0x94, 0x7a, 0x5f, 0x44, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x26, 0x41, 0x5c, 0x77, 0x91, 0xab, 0xa8, 0x9f, 0x84, 0x6a, 0x4f, 0x33, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x31, 0x4c, 0x66, 0x81, 0x9b, 0xaa, 0x8f, 0x74, 0x5a, 0x3f, 0x24, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x21, 0x3c, 0x56, 0x71, 0x8c, 0x98, 0x7f, 0x65, 0x4a, 0x2f, 0x13, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x10, 0x2c, 0x46, 0x61, 0x78, 0x78, 0x6e, 0x55, 0x3a, 0x1e, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x1b, 0x35, 0x4c, 0x58, 0x58, 0x55, 0x41, 0x29, 0x0e, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x90, 0x90, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x09, 0x20, 0x31, 0x39, 0x39, 0x36, 0x29, 0x15, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0x90, 0x90, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x23, 0x42, 0x5f, 0x70, 0x70, 0x70, 0x6f, 0x58, 0x3a, 0x1b, 0x00, 0x00, 0x06, 0x14, 0x19, 0x19, 0x17, 0x0e, 0x00, 0x00, 0x0c, 0x2b, 0x49, 0x66, 0x70, 0x70, 0x70, 0x6d, 0x55, 0x36, 0x17, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x48, 0x50, 0x50, 0x50, 0x50, 0x44, 0x2d, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1f, 0x39, 0x4c, 0x50, 0x50, 0x50, 0x4f, 0x41, 0x29, 0x0e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x1c, 0x2b, 0x31, 0x31, 0x31, 0x30, 0x28, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x21, 0x2e, 0x31, 0x31, 0x31, 0x30, 0x27, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0f, 0x11, 0x11, 0x11, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+004E "N" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x1d, 0x1d, 0x1d, 0x1b, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x1d, 0x1d, 0x1d, 0x1d, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x25, 0x36, 0x3d, 0x3d, 0x3d, 0x3a, 0x2d, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x25, 0x36, 0x3d, 0x3d, 0x3d, 0x3d, 0x36, 0x25, 0x0e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1d, 0x3a, 0x52, 0x5c, 0x5c, 0x5c, 0x58, 0x44, 0x2d, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3a, 0x52, 0x5c, 0x5c, 0x5c, 0x5c, 0x52, 0x3a, 0x1d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x7c, 0x7c, 0x7c, 0x71, 0x5a, 0x41, 0x28, 0x10, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x7c, 0x7c, 0x7c, 0x7c, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x9c, 0x9c, 0x84, 0x6d, 0x55, 0x3c, 0x24, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x9c, 0x9c, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xb1, 0x97, 0x81, 0x69, 0x50, 0x38, 0x1f, 0x06, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xc2, 0xac, 0x94, 0x7c, 0x63, 0x4b, 0x33, 0x1a, 0x01, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xc2, 0xbb, 0xa8, 0x8f, 0x77, 0x5f, 0x47, 0x2e, 0x15, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xab, 0x9c, 0xa8, 0xa3, 0x89, 0x73, 0x5b, 0x41, 0x28, 0x10, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x92, 0xab, 0x9d, 0x85, 0x6e, 0x55, 0x3c, 0x25, 0x0c, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x7f, 0x97, 0xaf, 0x98, 0x81, 0x69, 0x51, 0x39, 0x20, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x6c, 0x84, 0x9d, 0xac, 0x95, 0x7c, 0x65, 0x4c, 0x33, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x71, 0x88, 0xa0, 0xa8, 0x8f, 0x78, 0x60, 0x47, 0x2e, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x5d, 0x76, 0x8c, 0xa5, 0xa3, 0x8a, 0x74, 0x5b, 0x42, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x4a, 0x63, 0x7a, 0x92, 0xab, 0x9d, 0x86, 0x6e, 0x55, 0x44, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x4f, 0x66, 0x7f, 0x97, 0xae, 0x9a, 0x81, 0x69, 0x52, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x3b, 0x53, 0x6b, 0x84, 0x9b, 0xad, 0x95, 0x7d, 0x66, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x27, 0x3f, 0x58, 0x71, 0x88, 0xa0, 0xa8, 0x8f, 0x79, 0x64, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x2c, 0x44, 0x5d, 0x74, 0x8c, 0xa5, 0xa3, 0x8c, 0x74, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x18, 0x31, 0x49, 0x61, 0x79, 0x92, 0xaa, 0x9f, 0x87, 0x84, 0xa4, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x04, 0x1d, 0x35, 0x4e, 0x66, 0x7f, 0x96, 0xae, 0x9a, 0x8d, 0xa6, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x09, 0x22, 0x3a, 0x52, 0x6b, 0x83, 0x9a, 0xb1, 0xac, 0xb9, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x0e, 0x26, 0x3f, 0x58, 0x71, 0x87, 0xa0, 0xb8, 0xc3, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x12, 0x2b, 0x44, 0x5d, 0x74, 0x8c, 0xa4, 0xbc, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x17, 0x30, 0x48, 0x60, 0x79, 0x91, 0xa9, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x90, 0x90, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x04, 0x1c, 0x34, 0x4d, 0x66, 0x7f, 0x90, 0x90, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x23, 0x42, 0x5f, 0x70, 0x70, 0x70, 0x70, 0x5c, 0x3e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x39, 0x52, 0x69, 0x70, 0x70, 0x70, 0x5f, 0x42, 0x23, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x48, 0x50, 0x50, 0x50, 0x50, 0x46, 0x30, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x25, 0x3c, 0x4d, 0x50, 0x50, 0x50, 0x48, 0x33, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x1c, 0x2b, 0x31, 0x31, 0x31, 0x31, 0x2a, 0x1a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x23, 0x2f, 0x31, 0x31, 0x31, 0x2b, 0x1c, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x11, 0x11, 0x11, 0x0d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+004F "O" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x10, 0x18, 0x1f, 0x24, 0x25, 0x25, 0x25, 0x24, 0x1f, 0x17, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x23, 0x2e, 0x37, 0x3e, 0x43, 0x44, 0x44, 0x44, 0x43, 0x3e, 0x36, 0x2e, 0x23, 0x15, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x24, 0x33, 0x41, 0x4c, 0x56, 0x5c, 0x61, 0x64, 0x64, 0x64, 0x61, 0x5c, 0x55, 0x4c, 0x3f, 0x31, 0x23, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1a, 0x2d, 0x3e, 0x4f, 0x5e, 0x6a, 0x74, 0x7c, 0x80, 0x84, 0x84, 0x84, 0x80, 0x7b, 0x74, 0x68, 0x5c, 0x4e, 0x3d, 0x2b, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1a, 0x31, 0x46, 0x58, 0x6a, 0x7a, 0x85, 0x90, 0x99, 0xa0, 0xa4, 0xa4, 0xa4, 0xa0, 0x98, 0x90, 0x85, 0x78, 0x69, 0x57, 0x44, 0x2e, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x31, 0x47, 0x5d, 0x71, 0x83, 0x94, 0xa2, 0xab, 0xa1, 0x9b, 0x98, 0x98, 0x98, 0x9c, 0xa3, 0xab, 0xa1, 0x93, 0x81, 0x71, 0x5b, 0x44, 0x2e, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x2d, 0x46, 0x5d, 0x74, 0x89, 0x9d, 0xad, 0x9d, 0x8f, 0x84, 0x7c, 0x78, 0x78, 0x78, 0x7d, 0x85, 0x91, 0x9f, 0xad, 0x9a, 0x87, 0x71, 0x5b, 0x44, 0x2a, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x23, 0x3e, 0x58, 0x71, 0x89, 0xa0, 0xaa, 0x95, 0x83, 0x74, 0x68, 0x5f, 0x58, 0x58, 0x59, 0x60, 0x68, 0x76, 0x85, 0x97, 0xab, 0x9d, 0x87, 0x6f, 0x56, 0x3c, 0x21, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x31, 0x4e, 0x6a, 0x83, 0x9d, 0xab, 0x94, 0x7f, 0x6a, 0x58, 0x4b, 0x40, 0x39, 0x39, 0x3a, 0x41, 0x4c, 0x5b, 0x6c, 0x7f, 0x95, 0xae, 0x9a, 0x81, 0x66, 0x4c, 0x2f, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x23, 0x3f, 0x5c, 0x78, 0x93, 0xae, 0x98, 0x7f, 0x69, 0x52, 0x3e, 0x2e, 0x21, 0x1a, 0x19, 0x1b, 0x23, 0x2f, 0x40, 0x54, 0x6b, 0x81, 0x9b, 0xab, 0x91, 0x76, 0x5a, 0x3d, 0x1f, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x2d, 0x4b, 0x68, 0x85, 0xa1, 0xa4, 0x88, 0x6e, 0x54, 0x3c, 0x25, 0x12, 0x04, 0x00, 0x00, 0x00, 0x05, 0x14, 0x28, 0x3f, 0x57, 0x71, 0x8c, 0xa8, 0x9f, 0x81, 0x65, 0x47, 0x29, 0x0b, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x34, 0x54, 0x73, 0x8f, 0xad, 0x98, 0x7c, 0x5f, 0x43, 0x28, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2c, 0x46, 0x63, 0x80, 0x9b, 0xa9, 0x8b, 0x6f, 0x50, 0x32, 0x13, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3b, 0x5a, 0x78, 0x96, 0xae, 0x90, 0x73, 0x54, 0x36, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3a, 0x58, 0x76, 0x94, 0xb0, 0x94, 0x74, 0x56, 0x37, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x1f, 0x3e, 0x5c, 0x7c, 0x9c, 0xa8, 0x8a, 0x6c, 0x4c, 0x2e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x32, 0x50, 0x70, 0x8c, 0xac, 0x98, 0x78, 0x5a, 0x3b, 0x1c, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0xa0, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0x9c, 0xa8, 0x88, 0x68, 0x49, 0x2b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x2f, 0x4d, 0x6c, 0x8c, 0xac, 0x99, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00,
+    0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9a, 0xab, 0x8c, 0x6d, 0x4f, 0x30, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x34, 0x53, 0x71, 0x90, 0xaf, 0x96, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00,
+    0x00, 0x00, 0x1a, 0x38, 0x58, 0x76, 0x94, 0xaf, 0x93, 0x76, 0x58, 0x3a, 0x1e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x21, 0x3e, 0x5c, 0x78, 0x96, 0xaf, 0x90, 0x74, 0x54, 0x35, 0x16, 0x00, 0x00,
+    0x00, 0x00, 0x13, 0x32, 0x50, 0x6f, 0x8b, 0xa8, 0x9c, 0x80, 0x65, 0x4a, 0x30, 0x17, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1a, 0x33, 0x4c, 0x68, 0x83, 0xa0, 0xa5, 0x88, 0x6b, 0x4d, 0x2f, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x29, 0x46, 0x64, 0x80, 0x9b, 0xaa, 0x8f, 0x74, 0x5c, 0x44, 0x2f, 0x1d, 0x10, 0x08, 0x05, 0x08, 0x11, 0x1e, 0x31, 0x47, 0x5f, 0x78, 0x91, 0xad, 0x9a, 0x7d, 0x61, 0x43, 0x25, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1d, 0x3a, 0x56, 0x73, 0x8d, 0xa8, 0xa0, 0x87, 0x71, 0x5b, 0x48, 0x39, 0x2e, 0x28, 0x25, 0x28, 0x2f, 0x3a, 0x4a, 0x5d, 0x74, 0x89, 0xa3, 0xa4, 0x8a, 0x71, 0x55, 0x38, 0x1a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x2c, 0x48, 0x63, 0x7c, 0x95, 0xae, 0x9d, 0x87, 0x74, 0x63, 0x56, 0x4c, 0x47, 0x44, 0x47, 0x4d, 0x57, 0x65, 0x76, 0x89, 0xa0, 0xab, 0x93, 0x7a, 0x60, 0x45, 0x2a, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x1d, 0x38, 0x51, 0x6a, 0x81, 0x97, 0xab, 0x9f, 0x8d, 0x7f, 0x74, 0x6b, 0x65, 0x64, 0x65, 0x6c, 0x74, 0x80, 0x8f, 0xa0, 0xaa, 0x95, 0x7f, 0x69, 0x4f, 0x34, 0x1a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0b, 0x25, 0x3e, 0x55, 0x6b, 0x80, 0x93, 0xa4, 0xa8, 0x9b, 0x90, 0x88, 0x84, 0x84, 0x84, 0x88, 0x90, 0x9b, 0xaa, 0xa2, 0x91, 0x7f, 0x69, 0x52, 0x3c, 0x23, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x28, 0x3f, 0x55, 0x69, 0x7a, 0x88, 0x96, 0xa2, 0xab, 0xa8, 0xa4, 0xa4, 0xa4, 0xa8, 0xaa, 0xa1, 0x96, 0x88, 0x78, 0x66, 0x52, 0x3c, 0x25, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x28, 0x3c, 0x4f, 0x5f, 0x6d, 0x7b, 0x85, 0x8c, 0x94, 0x97, 0x98, 0x97, 0x93, 0x8c, 0x84, 0x7a, 0x6d, 0x5e, 0x4c, 0x3a, 0x25, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x23, 0x34, 0x43, 0x51, 0x5e, 0x68, 0x70, 0x74, 0x78, 0x78, 0x78, 0x74, 0x6f, 0x67, 0x5d, 0x51, 0x43, 0x32, 0x21, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x27, 0x35, 0x41, 0x49, 0x50, 0x54, 0x58, 0x58, 0x58, 0x54, 0x50, 0x48, 0x3f, 0x34, 0x27, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x17, 0x23, 0x2b, 0x32, 0x35, 0x39, 0x39, 0x39, 0x35, 0x31, 0x2a, 0x21, 0x17, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x13, 0x17, 0x19, 0x19, 0x19, 0x17, 0x12, 0x0b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0050 "P" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1a, 0x15, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x25, 0x36, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x34, 0x2d, 0x23, 0x17, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1d, 0x3a, 0x52, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x58, 0x53, 0x4b, 0x41, 0x33, 0x25, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x78, 0x71, 0x6a, 0x5e, 0x4f, 0x3f, 0x2d, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9a, 0x95, 0x8f, 0x85, 0x7a, 0x6b, 0x58, 0x44, 0x2e, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xae, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0xa4, 0xaa, 0xa2, 0x94, 0x84, 0x71, 0x5b, 0x43, 0x29, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x81, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x80, 0x84, 0x8d, 0x9b, 0xad, 0x9d, 0x87, 0x6e, 0x55, 0x3a, 0x1e, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x60, 0x67, 0x73, 0x81, 0x97, 0xae, 0x9a, 0x80, 0x65, 0x48, 0x2a, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x42, 0x49, 0x57, 0x6b, 0x81, 0x9d, 0xaa, 0x8c, 0x70, 0x52, 0x34, 0x16, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x1d, 0x1d, 0x1e, 0x23, 0x2c, 0x3f, 0x58, 0x74, 0x90, 0xaf, 0x96, 0x78, 0x5a, 0x3b, 0x1c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x04, 0x12, 0x2f, 0x4d, 0x6c, 0x8a, 0xa8, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x29, 0x48, 0x68, 0x88, 0xa8, 0x9c, 0x7f, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x05, 0x05, 0x05, 0x09, 0x16, 0x30, 0x4e, 0x6c, 0x8b, 0xa9, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x25, 0x25, 0x25, 0x25, 0x28, 0x31, 0x42, 0x5b, 0x76, 0x93, 0xb0, 0x95, 0x78, 0x59, 0x3a, 0x1b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x4e, 0x5c, 0x6e, 0x85, 0x9f, 0xa6, 0x8a, 0x6f, 0x51, 0x33, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x67, 0x6c, 0x78, 0x86, 0x9a, 0xad, 0x96, 0x7d, 0x61, 0x45, 0x28, 0x0b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x8a, 0x93, 0xa1, 0xab, 0x97, 0x81, 0x6b, 0x52, 0x36, 0x1a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xb1, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa8, 0xa8, 0x9d, 0x8f, 0x7f, 0x6b, 0x55, 0x3f, 0x26, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa9, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x94, 0x90, 0x8a, 0x80, 0x74, 0x66, 0x54, 0x3f, 0x28, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x74, 0x73, 0x6c, 0x64, 0x58, 0x4a, 0x3b, 0x28, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x58, 0x58, 0x58, 0x58, 0x58, 0x56, 0x54, 0x4d, 0x46, 0x3c, 0x2e, 0x1f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x39, 0x39, 0x39, 0x39, 0x37, 0x34, 0x2f, 0x28, 0x1d, 0x11, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x19, 0x19, 0x19, 0x18, 0x15, 0x0f, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x90, 0x90, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x23, 0x42, 0x5f, 0x70, 0x70, 0x70, 0x70, 0x5c, 0x3e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x48, 0x50, 0x50, 0x50, 0x50, 0x46, 0x30, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x1c, 0x2b, 0x31, 0x31, 0x31, 0x31, 0x2a, 0x1a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0051 "Q" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x10, 0x18, 0x1f, 0x24, 0x25, 0x25, 0x25, 0x24, 0x1f, 0x17, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x23, 0x2e, 0x37, 0x3e, 0x43, 0x44, 0x44, 0x44, 0x43, 0x3e, 0x36, 0x2e, 0x23, 0x15, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x24, 0x33, 0x41, 0x4c, 0x56, 0x5c, 0x61, 0x64, 0x64, 0x64, 0x61, 0x5c, 0x55, 0x4c, 0x3f, 0x31, 0x23, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1a, 0x2d, 0x3e, 0x4f, 0x5e, 0x6a, 0x74, 0x7c, 0x80, 0x84, 0x84, 0x84, 0x80, 0x7b, 0x74, 0x68, 0x5c, 0x4e, 0x3d, 0x2b, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1a, 0x31, 0x46, 0x58, 0x6a, 0x7a, 0x85, 0x90, 0x99, 0xa0, 0xa4, 0xa4, 0xa4, 0xa0, 0x98, 0x90, 0x85, 0x78, 0x69, 0x57, 0x44, 0x2e, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x31, 0x47, 0x5d, 0x71, 0x83, 0x94, 0xa2, 0xab, 0xa1, 0x9b, 0x98, 0x98, 0x98, 0x9c, 0xa3, 0xab, 0xa1, 0x93, 0x81, 0x71, 0x5b, 0x44, 0x2e, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x2d, 0x46, 0x5d, 0x74, 0x89, 0x9d, 0xad, 0x9d, 0x8f, 0x84, 0x7c, 0x78, 0x78, 0x78, 0x7d, 0x85, 0x91, 0x9f, 0xad, 0x9a, 0x87, 0x71, 0x5b, 0x44, 0x2a, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x23, 0x3e, 0x58, 0x71, 0x89, 0xa0, 0xaa, 0x95, 0x83, 0x74, 0x68, 0x5f, 0x58, 0x58, 0x59, 0x60, 0x68, 0x76, 0x85, 0x97, 0xab, 0x9d, 0x87, 0x6f, 0x56, 0x3c, 0x21, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x31, 0x4e, 0x6a, 0x83, 0x9d, 0xab, 0x94, 0x7f, 0x6a, 0x58, 0x4b, 0x40, 0x39, 0x39, 0x3a, 0x41, 0x4c, 0x5b, 0x6c, 0x80, 0x96, 0xae, 0x9a, 0x81, 0x66, 0x4c, 0x2f, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x23, 0x3f, 0x5c, 0x78, 0x93, 0xae, 0x98, 0x7f, 0x69, 0x52, 0x3e, 0x2e, 0x21, 0x1a, 0x19, 0x1b, 0x23, 0x2f, 0x40, 0x55, 0x6b, 0x81, 0x9b, 0xab, 0x91, 0x76, 0x5a, 0x3d, 0x1f, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x2d, 0x4b, 0x68, 0x85, 0xa1, 0xa4, 0x88, 0x6e, 0x54, 0x3c, 0x25, 0x12, 0x04, 0x00, 0x00, 0x00, 0x05, 0x14, 0x28, 0x3f, 0x57, 0x71, 0x8c, 0xa8, 0x9f, 0x81, 0x65, 0x47, 0x29, 0x0b, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x34, 0x54, 0x73, 0x8f, 0xad, 0x98, 0x7c, 0x5f, 0x43, 0x28, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2c, 0x46, 0x63, 0x80, 0x9b, 0xa9, 0x8b, 0x6f, 0x50, 0x32, 0x13, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3b, 0x5a, 0x78, 0x96, 0xae, 0x90, 0x73, 0x54, 0x36, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3a, 0x58, 0x76, 0x94, 0xb0, 0x94, 0x74, 0x56, 0x37, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x1f, 0x3e, 0x5c, 0x7c, 0x9c, 0xa8, 0x8a, 0x6c, 0x4c, 0x2e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x32, 0x50, 0x70, 0x8c, 0xac, 0x98, 0x78, 0x5a, 0x3b, 0x1c, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0xa0, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0x9c, 0xa8, 0x88, 0x68, 0x49, 0x2b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x2f, 0x4d, 0x6c, 0x8c, 0xac, 0x99, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00,
+    0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9a, 0xab, 0x8c, 0x6d, 0x4f, 0x30, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x34, 0x53, 0x71, 0x90, 0xaf, 0x96, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00,
+    0x00, 0x00, 0x1a, 0x38, 0x58, 0x76, 0x94, 0xaf, 0x93, 0x76, 0x58, 0x3a, 0x1e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x21, 0x3e, 0x5c, 0x78, 0x96, 0xaf, 0x90, 0x74, 0x54, 0x35, 0x16, 0x00, 0x00,
+    0x00, 0x00, 0x13, 0x32, 0x50, 0x6f, 0x8b, 0xa9, 0x9c, 0x80, 0x65, 0x4a, 0x30, 0x17, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1a, 0x33, 0x4c, 0x68, 0x83, 0xa0, 0xa5, 0x88, 0x6b, 0x4d, 0x2f, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x29, 0x47, 0x65, 0x80, 0x9b, 0xaa, 0x8f, 0x74, 0x5c, 0x44, 0x2f, 0x1d, 0x10, 0x08, 0x05, 0x08, 0x11, 0x1f, 0x31, 0x47, 0x5f, 0x78, 0x91, 0xad, 0x9a, 0x7d, 0x61, 0x43, 0x25, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x1e, 0x3a, 0x56, 0x73, 0x8d, 0xa8, 0xa0, 0x87, 0x71, 0x5b, 0x48, 0x39, 0x2e, 0x28, 0x25, 0x28, 0x2f, 0x3a, 0x4a, 0x5d, 0x74, 0x89, 0xa3, 0xa5, 0x8a, 0x71, 0x55, 0x38, 0x1a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x2c, 0x48, 0x63, 0x7d, 0x95, 0xae, 0x9d, 0x87, 0x74, 0x63, 0x56, 0x4c, 0x47, 0x44, 0x47, 0x4d, 0x57, 0x66, 0x77, 0x89, 0xa0, 0xab, 0x93, 0x7b, 0x61, 0x46, 0x2a, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x1d, 0x38, 0x52, 0x6a, 0x81, 0x97, 0xab, 0x9f, 0x8d, 0x7f, 0x74, 0x6b, 0x65, 0x64, 0x65, 0x6c, 0x75, 0x80, 0x8f, 0xa1, 0xaa, 0x95, 0x7f, 0x69, 0x4f, 0x35, 0x1a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x25, 0x3e, 0x55, 0x6b, 0x80, 0x93, 0xa4, 0xa8, 0x9b, 0x90, 0x88, 0x84, 0x84, 0x84, 0x88, 0x91, 0x9b, 0xaa, 0xa2, 0x91, 0x7f, 0x69, 0x52, 0x3c, 0x27, 0x1c, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x28, 0x3f, 0x55, 0x69, 0x7a, 0x89, 0x96, 0xa3, 0xab, 0xa8, 0xa4, 0xa4, 0xa4, 0xa8, 0xaa, 0xa1, 0x96, 0x88, 0x79, 0x66, 0x52, 0x3c, 0x47, 0x46, 0x36, 0x20, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x28, 0x3c, 0x4f, 0x5f, 0x6f, 0x7b, 0x85, 0x8c, 0x94, 0x97, 0xa3, 0xb9, 0xa6, 0x8d, 0x84, 0x7a, 0x6d, 0x5e, 0x4d, 0x3e, 0x50, 0x65, 0x63, 0x4c, 0x33, 0x1b, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x23, 0x34, 0x45, 0x52, 0x5f, 0x68, 0x70, 0x74, 0x78, 0x8c, 0xa3, 0xa8, 0x8f, 0x79, 0x66, 0x56, 0x4d, 0x4f, 0x58, 0x69, 0x7c, 0x78, 0x60, 0x47, 0x2f, 0x13, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x19, 0x28, 0x35, 0x41, 0x49, 0x50, 0x54, 0x60, 0x77, 0x8c, 0xa0, 0xa5, 0x91, 0x80, 0x74, 0x6c, 0x6d, 0x76, 0x81, 0x94, 0x8c, 0x74, 0x5a, 0x3b, 0x1c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x23, 0x2b, 0x32, 0x35, 0x4a, 0x60, 0x74, 0x87, 0x98, 0xa8, 0x9b, 0x90, 0x8c, 0x8c, 0x93, 0x9d, 0x9f, 0x8c, 0x76, 0x5a, 0x3b, 0x1c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x13, 0x1d, 0x33, 0x47, 0x5c, 0x6e, 0x7f, 0x8d, 0x99, 0xa0, 0xa4, 0xa4, 0x9c, 0x93, 0x85, 0x74, 0x60, 0x4a, 0x2f, 0x13, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1b, 0x30, 0x43, 0x54, 0x65, 0x73, 0x7c, 0x81, 0x84, 0x84, 0x80, 0x78, 0x6a, 0x5b, 0x47, 0x33, 0x1d, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x16, 0x28, 0x3a, 0x48, 0x55, 0x5d, 0x64, 0x64, 0x64, 0x61, 0x5a, 0x4e, 0x3f, 0x2f, 0x1b, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1e, 0x2c, 0x37, 0x3f, 0x44, 0x44, 0x44, 0x43, 0x3b, 0x31, 0x23, 0x14, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0e, 0x18, 0x20, 0x25, 0x25, 0x25, 0x24, 0x1c, 0x14, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x05, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0052 "R" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1a, 0x15, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x25, 0x36, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x34, 0x2d, 0x23, 0x17, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1d, 0x3a, 0x52, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x58, 0x53, 0x4b, 0x41, 0x33, 0x25, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x78, 0x71, 0x6a, 0x5e, 0x4f, 0x3f, 0x2d, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9a, 0x95, 0x8f, 0x85, 0x7a, 0x6b, 0x58, 0x44, 0x2e, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xae, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0xa4, 0xaa, 0xa2, 0x94, 0x84, 0x71, 0x5b, 0x43, 0x29, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x81, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x80, 0x84, 0x8d, 0x9b, 0xad, 0x9d, 0x87, 0x6e, 0x55, 0x3a, 0x1e, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x60, 0x67, 0x73, 0x81, 0x97, 0xae, 0x9a, 0x80, 0x65, 0x48, 0x2a, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x42, 0x49, 0x57, 0x6b, 0x81, 0x9d, 0xaa, 0x8c, 0x70, 0x52, 0x34, 0x16, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x1d, 0x1d, 0x1e, 0x23, 0x2c, 0x3f, 0x58, 0x74, 0x90, 0xaf, 0x96, 0x78, 0x5a, 0x3b, 0x1c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x04, 0x12, 0x2f, 0x4d, 0x6c, 0x8a, 0xa8, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x29, 0x48, 0x68, 0x88, 0xa8, 0x9c, 0x7f, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x02, 0x01, 0x04, 0x08, 0x16, 0x30, 0x4e, 0x6c, 0x8b, 0xa9, 0x9b, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x22, 0x21, 0x21, 0x24, 0x28, 0x31, 0x42, 0x5b, 0x76, 0x93, 0xb0, 0x94, 0x78, 0x58, 0x39, 0x1a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x41, 0x40, 0x40, 0x40, 0x43, 0x47, 0x4e, 0x5c, 0x6e, 0x85, 0x9f, 0xa6, 0x8a, 0x6f, 0x51, 0x33, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x61, 0x60, 0x60, 0x60, 0x60, 0x61, 0x65, 0x6c, 0x78, 0x86, 0x9a, 0xad, 0x96, 0x7d, 0x61, 0x45, 0x28, 0x0b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x84, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x84, 0x88, 0x93, 0xa0, 0xaa, 0x97, 0x81, 0x6b, 0x52, 0x36, 0x1a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xb1, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa4, 0xa8, 0xad, 0x9c, 0x8f, 0x7f, 0x6b, 0x55, 0x3f, 0x26, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa9, 0x95, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0xa5, 0xa4, 0x84, 0x74, 0x66, 0x54, 0x3f, 0x28, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x79, 0x92, 0xaa, 0x92, 0x7a, 0x60, 0x47, 0x2d, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x54, 0x54, 0x54, 0x54, 0x54, 0x68, 0x81, 0x9a, 0xa4, 0x8a, 0x73, 0x58, 0x3f, 0x25, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x35, 0x35, 0x35, 0x3c, 0x55, 0x6f, 0x88, 0xa1, 0x9d, 0x84, 0x6b, 0x51, 0x38, 0x1d, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x15, 0x15, 0x29, 0x44, 0x5d, 0x77, 0x8f, 0xa9, 0x95, 0x7c, 0x63, 0x4a, 0x30, 0x16, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x18, 0x31, 0x4b, 0x66, 0x7f, 0x97, 0xa8, 0x8d, 0x76, 0x5c, 0x42, 0x28, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x05, 0x1f, 0x39, 0x53, 0x6c, 0x85, 0x9f, 0xa0, 0x86, 0x6e, 0x54, 0x3b, 0x1f, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x90, 0x90, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x0d, 0x27, 0x40, 0x5b, 0x74, 0x8c, 0x90, 0x90, 0x7f, 0x66, 0x48, 0x28, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x23, 0x42, 0x5f, 0x70, 0x70, 0x70, 0x70, 0x5c, 0x3e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x14, 0x2f, 0x48, 0x63, 0x70, 0x70, 0x70, 0x70, 0x63, 0x46, 0x27, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x48, 0x50, 0x50, 0x50, 0x50, 0x46, 0x30, 0x15, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1c, 0x36, 0x4a, 0x50, 0x50, 0x50, 0x50, 0x4a, 0x36, 0x1c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x1c, 0x2b, 0x31, 0x31, 0x31, 0x31, 0x2a, 0x1a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1e, 0x2d, 0x31, 0x31, 0x31, 0x31, 0x2d, 0x1e, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x03, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0053 "S" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x05, 0x05, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x11, 0x1a, 0x20, 0x24, 0x25, 0x25, 0x25, 0x24, 0x1f, 0x18, 0x11, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x15, 0x23, 0x2f, 0x38, 0x40, 0x44, 0x44, 0x44, 0x44, 0x43, 0x3e, 0x37, 0x2f, 0x25, 0x18, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x20, 0x31, 0x3f, 0x4d, 0x57, 0x5f, 0x63, 0x64, 0x64, 0x64, 0x61, 0x5c, 0x56, 0x4d, 0x43, 0x35, 0x27, 0x16, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x23, 0x39, 0x4c, 0x5c, 0x6a, 0x75, 0x7c, 0x80, 0x84, 0x84, 0x84, 0x80, 0x7c, 0x74, 0x6b, 0x5f, 0x51, 0x41, 0x2e, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x21, 0x39, 0x4f, 0x66, 0x78, 0x85, 0x91, 0x9a, 0xa0, 0xa4, 0xa4, 0xa4, 0xa0, 0x99, 0x91, 0x88, 0x7b, 0x6d, 0x5b, 0x3f, 0x21, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x32, 0x4c, 0x66, 0x7c, 0x8f, 0xa1, 0xa8, 0x9c, 0x96, 0x94, 0x94, 0x94, 0x98, 0x9d, 0xa8, 0xa4, 0x96, 0x81, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x24, 0x41, 0x5e, 0x78, 0x91, 0xa8, 0x9d, 0x8c, 0x80, 0x78, 0x74, 0x74, 0x74, 0x78, 0x80, 0x8a, 0x96, 0x93, 0x76, 0x5a, 0x3c, 0x1f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x2e, 0x4c, 0x6a, 0x86, 0xa2, 0xa1, 0x87, 0x74, 0x63, 0x59, 0x54, 0x54, 0x55, 0x5b, 0x64, 0x6d, 0x7b, 0x86, 0x6b, 0x4e, 0x30, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x14, 0x34, 0x53, 0x71, 0x90, 0xae, 0x94, 0x78, 0x5d, 0x47, 0x3a, 0x35, 0x35, 0x36, 0x3c, 0x46, 0x51, 0x5f, 0x6c, 0x5d, 0x41, 0x25, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x51, 0x33, 0x1e, 0x16, 0x15, 0x17, 0x1d, 0x28, 0x35, 0x43, 0x4c, 0x45, 0x30, 0x16, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xaf, 0x93, 0x76, 0x5b, 0x47, 0x39, 0x30, 0x28, 0x20, 0x18, 0x11, 0x18, 0x26, 0x2d, 0x28, 0x19, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x13, 0x32, 0x50, 0x6f, 0x8c, 0xaa, 0x9f, 0x87, 0x73, 0x63, 0x57, 0x4e, 0x47, 0x3f, 0x37, 0x2f, 0x26, 0x1b, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x2a, 0x48, 0x65, 0x80, 0x9a, 0xb0, 0x9d, 0x8c, 0x7f, 0x75, 0x6c, 0x65, 0x5d, 0x56, 0x4d, 0x44, 0x39, 0x2c, 0x1d, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x1e, 0x3a, 0x55, 0x6e, 0x84, 0x98, 0xaa, 0xa8, 0x9b, 0x93, 0x8a, 0x83, 0x7c, 0x74, 0x6b, 0x61, 0x56, 0x48, 0x38, 0x25, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x29, 0x41, 0x58, 0x6e, 0x7f, 0x8d, 0x99, 0xa3, 0xab, 0xa8, 0xa0, 0x99, 0x91, 0x88, 0x7f, 0x73, 0x63, 0x52, 0x3c, 0x25, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x2b, 0x41, 0x54, 0x65, 0x71, 0x7c, 0x84, 0x8c, 0x94, 0x9c, 0xa4, 0xac, 0xa6, 0x9b, 0x8d, 0x7d, 0x69, 0x52, 0x3a, 0x1f, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x28, 0x3a, 0x48, 0x55, 0x5f, 0x67, 0x70, 0x78, 0x7f, 0x85, 0x8f, 0x99, 0xa8, 0xa8, 0x95, 0x7f, 0x66, 0x4a, 0x2e, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x11, 0x1e, 0x2b, 0x37, 0x41, 0x49, 0x51, 0x59, 0x60, 0x68, 0x73, 0x7d, 0x8c, 0xa3, 0xaa, 0x8f, 0x74, 0x57, 0x39, 0x1a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x1a, 0x2a, 0x31, 0x2b, 0x1c, 0x18, 0x22, 0x2b, 0x33, 0x3a, 0x42, 0x4b, 0x55, 0x63, 0x77, 0x8f, 0xaa, 0x9b, 0x7d, 0x60, 0x40, 0x21, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x16, 0x30, 0x46, 0x50, 0x48, 0x36, 0x25, 0x17, 0x0e, 0x14, 0x1b, 0x23, 0x2d, 0x38, 0x4a, 0x66, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00,
+    0x00, 0x00, 0x08, 0x25, 0x41, 0x5d, 0x70, 0x63, 0x50, 0x41, 0x34, 0x2b, 0x25, 0x21, 0x21, 0x25, 0x2f, 0x47, 0x65, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00,
+    0x00, 0x00, 0x17, 0x33, 0x4f, 0x6c, 0x86, 0x7b, 0x6c, 0x5e, 0x52, 0x49, 0x44, 0x40, 0x40, 0x44, 0x4c, 0x5b, 0x71, 0x8c, 0xa9, 0x99, 0x7c, 0x5d, 0x3f, 0x20, 0x00, 0x00,
+    0x00, 0x03, 0x22, 0x41, 0x5e, 0x7a, 0x94, 0x94, 0x86, 0x7a, 0x70, 0x68, 0x64, 0x60, 0x60, 0x64, 0x6a, 0x76, 0x87, 0x9d, 0xa6, 0x8c, 0x71, 0x55, 0x37, 0x18, 0x00, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x81, 0x95, 0xa6, 0xa2, 0x96, 0x8c, 0x86, 0x80, 0x80, 0x80, 0x81, 0x88, 0x91, 0x9f, 0xa6, 0x92, 0x7c, 0x63, 0x46, 0x2a, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x1f, 0x3c, 0x55, 0x6b, 0x7c, 0x8a, 0x96, 0xa1, 0xa9, 0xa4, 0xa0, 0xa0, 0xa0, 0xa0, 0xa5, 0xa7, 0x9b, 0x8d, 0x7c, 0x66, 0x4f, 0x36, 0x1c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x28, 0x3f, 0x51, 0x61, 0x6f, 0x7b, 0x84, 0x8c, 0x91, 0x95, 0x98, 0x98, 0x94, 0x90, 0x88, 0x80, 0x73, 0x63, 0x4f, 0x39, 0x23, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x12, 0x25, 0x36, 0x45, 0x52, 0x5d, 0x66, 0x6d, 0x74, 0x78, 0x78, 0x78, 0x76, 0x73, 0x6c, 0x63, 0x56, 0x48, 0x37, 0x23, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x1a, 0x28, 0x35, 0x3f, 0x48, 0x4f, 0x54, 0x58, 0x58, 0x58, 0x58, 0x54, 0x4d, 0x46, 0x3a, 0x2c, 0x1d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x17, 0x21, 0x2a, 0x30, 0x35, 0x39, 0x39, 0x39, 0x38, 0x34, 0x2f, 0x27, 0x1c, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x11, 0x15, 0x19, 0x19, 0x19, 0x19, 0x15, 0x0f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0054 "T" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x1a, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x18, 0x0c, 0x00, 0x00,
+    0x00, 0x14, 0x2a, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x36, 0x25, 0x0e, 0x00,
+    0x07, 0x25, 0x40, 0x56, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x52, 0x3a, 0x1d, 0x00,
+    0x0d, 0x2c, 0x4c, 0x6b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x64, 0x44, 0x25, 0x05,
+    0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x84, 0x64, 0x44, 0x25, 0x05,
+    0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa5, 0xb8, 0xa1, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x84, 0x64, 0x44, 0x25, 0x05,
+    0x0d, 0x2c, 0x4c, 0x6b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x98, 0xb0, 0x90, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x64, 0x44, 0x25, 0x05,
+    0x07, 0x25, 0x40, 0x56, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x78, 0x98, 0xb0, 0x90, 0x70, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x52, 0x3a, 0x1d, 0x00,
+    0x00, 0x14, 0x2a, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x58, 0x78, 0x98, 0xb0, 0x90, 0x70, 0x50, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x36, 0x25, 0x0e, 0x00,
+    0x00, 0x00, 0x0f, 0x1a, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x39, 0x58, 0x78, 0x98, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x18, 0x0c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xaf, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x90, 0x90, 0x8f, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x36, 0x55, 0x6d, 0x70, 0x70, 0x70, 0x69, 0x4d, 0x2f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x29, 0x41, 0x4f, 0x50, 0x50, 0x50, 0x4d, 0x3c, 0x23, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x27, 0x30, 0x31, 0x31, 0x31, 0x2f, 0x23, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x11, 0x11, 0x11, 0x0f, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0055 "U" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1a, 0x1d, 0x1d, 0x1d, 0x1d, 0x16, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1b, 0x1d, 0x1d, 0x1d, 0x1c, 0x13, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x14, 0x2a, 0x39, 0x3d, 0x3d, 0x3d, 0x3c, 0x33, 0x20, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x2d, 0x3a, 0x3d, 0x3d, 0x3d, 0x3b, 0x2f, 0x1a, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x25, 0x40, 0x56, 0x5c, 0x5c, 0x5c, 0x5c, 0x4d, 0x33, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x28, 0x44, 0x58, 0x5c, 0x5c, 0x5c, 0x5a, 0x47, 0x2c, 0x0e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x2c, 0x4c, 0x6b, 0x7c, 0x7c, 0x7c, 0x79, 0x5c, 0x3c, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x30, 0x50, 0x6f, 0x7c, 0x7c, 0x7c, 0x73, 0x54, 0x34, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0x9c, 0x9b, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0x9c, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xb0, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xb0, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xb0, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xb0, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xb0, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xb0, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xb0, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xb0, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xb0, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xb0, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xb0, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xb0, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0c, 0x2c, 0x4b, 0x69, 0x88, 0xa8, 0x9c, 0x7d, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x15, 0x34, 0x54, 0x73, 0x90, 0xae, 0x91, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x85, 0xa4, 0xa0, 0x81, 0x64, 0x46, 0x27, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x3a, 0x59, 0x78, 0x94, 0xad, 0x8f, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x24, 0x44, 0x63, 0x80, 0x9d, 0xa7, 0x88, 0x6c, 0x4f, 0x32, 0x19, 0x09, 0x05, 0x08, 0x12, 0x29, 0x45, 0x61, 0x7f, 0x9c, 0xa6, 0x88, 0x6b, 0x4c, 0x2d, 0x0e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1d, 0x3c, 0x5b, 0x78, 0x95, 0xb0, 0x94, 0x78, 0x5e, 0x45, 0x33, 0x28, 0x25, 0x27, 0x2e, 0x3f, 0x55, 0x6f, 0x8a, 0xa6, 0x9d, 0x80, 0x64, 0x45, 0x26, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x33, 0x51, 0x6d, 0x88, 0xa4, 0xa2, 0x88, 0x71, 0x5e, 0x50, 0x48, 0x44, 0x46, 0x4c, 0x58, 0x6b, 0x81, 0x98, 0xad, 0x91, 0x76, 0x5a, 0x3c, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x27, 0x43, 0x5f, 0x7b, 0x94, 0xac, 0x9d, 0x89, 0x7a, 0x6d, 0x67, 0x64, 0x64, 0x6b, 0x74, 0x83, 0x96, 0xac, 0x9a, 0x81, 0x68, 0x4c, 0x2f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x35, 0x50, 0x69, 0x81, 0x96, 0xaa, 0xa2, 0x94, 0x8a, 0x84, 0x84, 0x84, 0x88, 0x90, 0x9d, 0xad, 0x9d, 0x87, 0x71, 0x57, 0x3d, 0x21, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x24, 0x3c, 0x55, 0x6b, 0x7f, 0x8f, 0x9d, 0xa9, 0xa8, 0xa4, 0xa4, 0xa4, 0xa7, 0xab, 0xa1, 0x94, 0x84, 0x71, 0x5b, 0x44, 0x2b, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0x3f, 0x52, 0x66, 0x76, 0x81, 0x8b, 0x91, 0x96, 0x98, 0x98, 0x94, 0x8c, 0x84, 0x7a, 0x6a, 0x58, 0x44, 0x2e, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x26, 0x3a, 0x4a, 0x5a, 0x65, 0x6d, 0x74, 0x78, 0x78, 0x78, 0x74, 0x70, 0x67, 0x5d, 0x4f, 0x3f, 0x2d, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x2f, 0x3c, 0x47, 0x4f, 0x54, 0x58, 0x58, 0x58, 0x55, 0x51, 0x49, 0x3f, 0x33, 0x24, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x13, 0x1f, 0x29, 0x30, 0x35, 0x39, 0x39, 0x39, 0x36, 0x33, 0x2b, 0x21, 0x17, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x11, 0x16, 0x19, 0x19, 0x19, 0x17, 0x13, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0056 "V" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x1b, 0x1d, 0x1d, 0x1d, 0x1d, 0x17, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x16, 0x1d, 0x1d, 0x1d, 0x1d, 0x1a, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x2d, 0x3a, 0x3d, 0x3d, 0x3d, 0x3c, 0x35, 0x23, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x20, 0x33, 0x3c, 0x3d, 0x3d, 0x3d, 0x38, 0x28, 0x11, 0x00,
+    0x00, 0x0b, 0x28, 0x44, 0x58, 0x5c, 0x5c, 0x5c, 0x5c, 0x4f, 0x36, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x34, 0x4d, 0x5c, 0x5c, 0x5c, 0x5c, 0x54, 0x3d, 0x21, 0x03,
+    0x00, 0x11, 0x30, 0x50, 0x6f, 0x7c, 0x7c, 0x7c, 0x7b, 0x61, 0x43, 0x27, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x25, 0x43, 0x5f, 0x79, 0x7c, 0x7c, 0x7c, 0x67, 0x48, 0x28, 0x09,
+    0x00, 0x0f, 0x2e, 0x4c, 0x68, 0x83, 0x9c, 0x9c, 0x88, 0x6d, 0x51, 0x33, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x33, 0x4f, 0x6c, 0x88, 0x9c, 0x99, 0x7f, 0x61, 0x44, 0x26, 0x07,
+    0x00, 0x05, 0x21, 0x3e, 0x5c, 0x78, 0x93, 0xb0, 0x95, 0x7a, 0x5d, 0x3f, 0x23, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x23, 0x3f, 0x5c, 0x78, 0x94, 0xaa, 0x8d, 0x73, 0x55, 0x38, 0x1b, 0x00,
+    0x00, 0x00, 0x15, 0x31, 0x4e, 0x6c, 0x86, 0xa4, 0xa1, 0x85, 0x6a, 0x4d, 0x2f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2f, 0x4c, 0x68, 0x85, 0xa1, 0x9d, 0x81, 0x65, 0x48, 0x2c, 0x0e, 0x00,
+    0x00, 0x00, 0x08, 0x25, 0x42, 0x5f, 0x7b, 0x96, 0xaf, 0x91, 0x76, 0x5a, 0x3c, 0x1f, 0x03, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x3c, 0x58, 0x76, 0x91, 0xab, 0x91, 0x76, 0x58, 0x3c, 0x1f, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x35, 0x52, 0x6f, 0x8a, 0xa6, 0x9d, 0x81, 0x66, 0x49, 0x2c, 0x0f, 0x00, 0x00, 0x00, 0x0e, 0x2c, 0x48, 0x65, 0x81, 0x9d, 0xa1, 0x85, 0x68, 0x4c, 0x2f, 0x12, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0c, 0x28, 0x45, 0x63, 0x7f, 0x9a, 0xab, 0x8d, 0x73, 0x56, 0x38, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x38, 0x55, 0x73, 0x8d, 0xaa, 0x94, 0x78, 0x5c, 0x3f, 0x23, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1c, 0x38, 0x56, 0x73, 0x8d, 0xaa, 0x9a, 0x7f, 0x63, 0x46, 0x28, 0x0c, 0x00, 0x0c, 0x28, 0x45, 0x63, 0x7f, 0x9a, 0xa4, 0x88, 0x6c, 0x4f, 0x33, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x2c, 0x48, 0x66, 0x81, 0x9d, 0xa8, 0x8a, 0x6f, 0x53, 0x35, 0x18, 0x00, 0x18, 0x35, 0x52, 0x6f, 0x8a, 0xa6, 0x98, 0x7c, 0x5f, 0x43, 0x26, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x3c, 0x58, 0x76, 0x91, 0xae, 0x98, 0x7b, 0x5f, 0x42, 0x25, 0x0a, 0x25, 0x42, 0x5f, 0x7b, 0x96, 0xa8, 0x8c, 0x70, 0x53, 0x36, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2f, 0x4c, 0x6a, 0x85, 0xa1, 0xa4, 0x86, 0x6c, 0x4f, 0x32, 0x17, 0x31, 0x4e, 0x6c, 0x86, 0xa4, 0x9b, 0x80, 0x63, 0x46, 0x2a, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x23, 0x3f, 0x5c, 0x7a, 0x94, 0xaf, 0x94, 0x78, 0x5c, 0x3e, 0x23, 0x3e, 0x5c, 0x78, 0x93, 0xab, 0x8f, 0x74, 0x56, 0x3a, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x33, 0x4f, 0x6c, 0x88, 0xa4, 0xa0, 0x83, 0x68, 0x4c, 0x30, 0x4c, 0x68, 0x83, 0xa0, 0x9f, 0x83, 0x66, 0x4a, 0x2e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x26, 0x43, 0x60, 0x7d, 0x98, 0xad, 0x90, 0x74, 0x58, 0x3d, 0x58, 0x74, 0x90, 0xac, 0x93, 0x76, 0x5a, 0x3e, 0x20, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x36, 0x53, 0x70, 0x8c, 0xa8, 0x9c, 0x80, 0x65, 0x4a, 0x65, 0x80, 0x9d, 0xa2, 0x86, 0x6a, 0x4e, 0x30, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2a, 0x46, 0x63, 0x80, 0x9b, 0xaa, 0x8c, 0x71, 0x56, 0x71, 0x8d, 0xaa, 0x96, 0x7a, 0x5e, 0x41, 0x24, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3a, 0x56, 0x74, 0x8f, 0xab, 0x99, 0x7d, 0x63, 0x7d, 0x9a, 0xa6, 0x8a, 0x6d, 0x51, 0x34, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2e, 0x4a, 0x66, 0x83, 0x9f, 0xa6, 0x88, 0x6f, 0x8a, 0xa6, 0x9a, 0x7d, 0x61, 0x45, 0x28, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x20, 0x3e, 0x5a, 0x76, 0x93, 0xae, 0x95, 0x7c, 0x96, 0xaa, 0x8d, 0x71, 0x55, 0x38, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x30, 0x4e, 0x6a, 0x86, 0xa2, 0xa3, 0x94, 0xa3, 0x9d, 0x80, 0x65, 0x48, 0x2b, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x24, 0x41, 0x5e, 0x7a, 0x96, 0xb2, 0xb4, 0xad, 0x90, 0x74, 0x58, 0x3c, 0x1e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x34, 0x51, 0x6d, 0x88, 0xa6, 0xb0, 0xa1, 0x84, 0x68, 0x4c, 0x2e, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x27, 0x44, 0x61, 0x7d, 0x90, 0x90, 0x90, 0x78, 0x5c, 0x3f, 0x21, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x38, 0x55, 0x6d, 0x70, 0x70, 0x70, 0x69, 0x4f, 0x32, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x29, 0x41, 0x4f, 0x50, 0x50, 0x50, 0x4d, 0x3c, 0x24, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x27, 0x30, 0x31, 0x31, 0x31, 0x2f, 0x23, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x11, 0x11, 0x11, 0x0f, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0057 "W" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x1b, 0x1d, 0x1d, 0x1d, 0x1d, 0x16, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x16, 0x1d, 0x1d, 0x1d, 0x1d, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1b, 0x1d, 0x1d, 0x1d, 0x1b, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x2d, 0x3a, 0x3d, 0x3d, 0x3d, 0x3c, 0x33, 0x20, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x20, 0x33, 0x3c, 0x3d, 0x3d, 0x3d, 0x36, 0x25, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x2d, 0x3a, 0x3d, 0x3d, 0x3d, 0x3a, 0x2d, 0x17, 0x00, 0x00,
+    0x00, 0x0b, 0x28, 0x44, 0x58, 0x5c, 0x5c, 0x5c, 0x5c, 0x4d, 0x33, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x33, 0x4d, 0x5c, 0x5c, 0x5c, 0x5c, 0x52, 0x3a, 0x1e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2a, 0x44, 0x58, 0x5c, 0x5c, 0x5c, 0x58, 0x44, 0x28, 0x0b, 0x00,
+    0x00, 0x11, 0x30, 0x50, 0x6f, 0x7c, 0x7c, 0x7c, 0x79, 0x5c, 0x3e, 0x20, 0x02, 0x00, 0x00, 0x00, 0x03, 0x21, 0x3f, 0x5d, 0x79, 0x7c, 0x7c, 0x7c, 0x65, 0x48, 0x2a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x18, 0x37, 0x55, 0x71, 0x7c, 0x7c, 0x7c, 0x6f, 0x50, 0x30, 0x11, 0x00,
+    0x00, 0x0e, 0x2d, 0x4b, 0x68, 0x85, 0x9c, 0x9c, 0x83, 0x66, 0x48, 0x2a, 0x0c, 0x00, 0x00, 0x00, 0x0d, 0x2b, 0x49, 0x67, 0x84, 0x9c, 0x9c, 0x8c, 0x70, 0x52, 0x34, 0x16, 0x00, 0x00, 0x00, 0x04, 0x23, 0x41, 0x5f, 0x7c, 0x98, 0x9c, 0x85, 0x68, 0x4b, 0x2d, 0x0e, 0x00,
+    0x00, 0x04, 0x23, 0x41, 0x5f, 0x7c, 0x99, 0xaa, 0x8c, 0x70, 0x52, 0x34, 0x16, 0x00, 0x00, 0x00, 0x18, 0x35, 0x53, 0x71, 0x8d, 0xab, 0xb4, 0x96, 0x7a, 0x5c, 0x3e, 0x20, 0x02, 0x00, 0x00, 0x0e, 0x2d, 0x4b, 0x68, 0x85, 0xa3, 0x99, 0x7c, 0x5f, 0x41, 0x23, 0x04, 0x00,
+    0x00, 0x00, 0x18, 0x37, 0x55, 0x73, 0x8f, 0xad, 0x96, 0x7a, 0x5c, 0x3e, 0x20, 0x02, 0x00, 0x04, 0x23, 0x41, 0x5f, 0x7b, 0x98, 0xb5, 0xb9, 0xa0, 0x83, 0x66, 0x48, 0x2a, 0x0c, 0x00, 0x00, 0x18, 0x37, 0x55, 0x73, 0x8f, 0xab, 0x8f, 0x73, 0x55, 0x37, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x2d, 0x4b, 0x68, 0x85, 0xa3, 0xa0, 0x83, 0x66, 0x48, 0x2a, 0x0c, 0x00, 0x0e, 0x2d, 0x4b, 0x68, 0x85, 0xa3, 0x9d, 0x9b, 0xaa, 0x8c, 0x70, 0x52, 0x34, 0x16, 0x00, 0x04, 0x23, 0x41, 0x5f, 0x7c, 0x99, 0xa3, 0x85, 0x68, 0x4b, 0x2d, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x23, 0x41, 0x5f, 0x7c, 0x99, 0xaa, 0x8c, 0x70, 0x52, 0x34, 0x16, 0x00, 0x19, 0x37, 0x55, 0x73, 0x8f, 0xa9, 0x8b, 0x88, 0xa6, 0x96, 0x7a, 0x5c, 0x3e, 0x20, 0x02, 0x0e, 0x2d, 0x4b, 0x68, 0x85, 0xa3, 0x99, 0x7c, 0x5f, 0x41, 0x23, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x37, 0x55, 0x73, 0x8f, 0xad, 0x96, 0x7a, 0x5c, 0x3e, 0x20, 0x06, 0x24, 0x42, 0x5f, 0x7c, 0x99, 0x9f, 0x81, 0x80, 0x9c, 0xa0, 0x83, 0x66, 0x48, 0x2a, 0x0c, 0x18, 0x37, 0x55, 0x73, 0x8f, 0xab, 0x8f, 0x73, 0x55, 0x37, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0e, 0x2d, 0x4b, 0x68, 0x85, 0xa3, 0xa0, 0x83, 0x66, 0x48, 0x2a, 0x10, 0x2e, 0x4c, 0x6a, 0x86, 0xa4, 0x95, 0x78, 0x76, 0x93, 0xaa, 0x8c, 0x70, 0x52, 0x34, 0x16, 0x23, 0x41, 0x5f, 0x7c, 0x99, 0xa3, 0x85, 0x68, 0x4b, 0x2d, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x23, 0x41, 0x5f, 0x7c, 0x99, 0xaa, 0x8c, 0x70, 0x52, 0x34, 0x1a, 0x38, 0x56, 0x74, 0x90, 0xa9, 0x8b, 0x6f, 0x6c, 0x88, 0xa5, 0x96, 0x7a, 0x5c, 0x3e, 0x20, 0x2d, 0x4b, 0x68, 0x85, 0xa3, 0x99, 0x7c, 0x5f, 0x41, 0x23, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x37, 0x55, 0x73, 0x8f, 0xad, 0x96, 0x7a, 0x5c, 0x3e, 0x25, 0x43, 0x60, 0x7d, 0x9a, 0x9f, 0x81, 0x65, 0x61, 0x7f, 0x9b, 0xa0, 0x83, 0x66, 0x48, 0x2a, 0x37, 0x55, 0x73, 0x8f, 0xab, 0x8f, 0x73, 0x55, 0x37, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x2d, 0x4b, 0x68, 0x85, 0xa2, 0xa0, 0x83, 0x66, 0x48, 0x2f, 0x4d, 0x6b, 0x88, 0xa4, 0x94, 0x78, 0x5b, 0x57, 0x75, 0x91, 0xaa, 0x8c, 0x70, 0x53, 0x35, 0x41, 0x5f, 0x7c, 0x99, 0xa3, 0x85, 0x68, 0x4b, 0x2d, 0x0e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x23, 0x41, 0x5e, 0x7b, 0x98, 0xaa, 0x8c, 0x70, 0x52, 0x39, 0x57, 0x75, 0x91, 0xa8, 0x8a, 0x6d, 0x50, 0x4d, 0x6b, 0x88, 0xa5, 0x98, 0x7b, 0x5d, 0x3f, 0x4c, 0x6a, 0x86, 0xa3, 0x99, 0x7c, 0x5f, 0x41, 0x23, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x35, 0x53, 0x71, 0x8d, 0xab, 0x96, 0x7a, 0x5c, 0x43, 0x61, 0x7f, 0x9b, 0x9d, 0x80, 0x64, 0x46, 0x43, 0x61, 0x7f, 0x9b, 0xa1, 0x84, 0x67, 0x49, 0x56, 0x74, 0x90, 0xab, 0x8f, 0x73, 0x55, 0x37, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2b, 0x49, 0x67, 0x84, 0xa1, 0xa0, 0x83, 0x66, 0x4e, 0x6c, 0x88, 0xa5, 0x94, 0x78, 0x5a, 0x3c, 0x39, 0x57, 0x75, 0x91, 0xab, 0x8d, 0x71, 0x53, 0x60, 0x7d, 0x9a, 0xa3, 0x85, 0x68, 0x4b, 0x2d, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x3f, 0x5d, 0x7b, 0x98, 0xaa, 0x8c, 0x70, 0x58, 0x76, 0x93, 0xa8, 0x8a, 0x6d, 0x50, 0x32, 0x2f, 0x4c, 0x6a, 0x86, 0xa4, 0x98, 0x7b, 0x5d, 0x6a, 0x86, 0xa4, 0x99, 0x7c, 0x5f, 0x41, 0x23, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x35, 0x53, 0x71, 0x8d, 0xab, 0x96, 0x7a, 0x63, 0x80, 0x9c, 0x9c, 0x80, 0x64, 0x46, 0x28, 0x24, 0x42, 0x60, 0x7d, 0x9a, 0xa1, 0x84, 0x67, 0x74, 0x90, 0xab, 0x8f, 0x73, 0x55, 0x37, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2b, 0x49, 0x67, 0x84, 0xa1, 0xa0, 0x83, 0x6d, 0x88, 0xa6, 0x93, 0x76, 0x58, 0x3a, 0x1d, 0x1a, 0x38, 0x56, 0x74, 0x90, 0xab, 0x8d, 0x71, 0x7d, 0x9a, 0xa3, 0x85, 0x68, 0x4b, 0x2d, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x3f, 0x5d, 0x7b, 0x98, 0xaa, 0x8c, 0x78, 0x94, 0xa6, 0x88, 0x6c, 0x4e, 0x30, 0x12, 0x10, 0x2e, 0x4c, 0x6a, 0x86, 0xa4, 0x98, 0x7b, 0x86, 0xa4, 0x99, 0x7c, 0x5f, 0x41, 0x23, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x35, 0x53, 0x71, 0x8d, 0xab, 0x96, 0x80, 0x9d, 0x9c, 0x80, 0x63, 0x44, 0x26, 0x08, 0x06, 0x24, 0x42, 0x60, 0x7d, 0x9a, 0xa1, 0x84, 0x90, 0xab, 0x8f, 0x73, 0x55, 0x37, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2b, 0x49, 0x67, 0x84, 0xa1, 0xa5, 0x9c, 0xab, 0x93, 0x76, 0x58, 0x3a, 0x1c, 0x00, 0x00, 0x1a, 0x38, 0x55, 0x73, 0x8f, 0xac, 0x9a, 0xa0, 0xa3, 0x85, 0x68, 0x4b, 0x2d, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x3f, 0x5d, 0x7b, 0x98, 0xb5, 0xbc, 0xa5, 0x88, 0x6c, 0x4e, 0x30, 0x12, 0x00, 0x00, 0x0e, 0x2d, 0x4b, 0x68, 0x85, 0xa3, 0xb8, 0xb7, 0x99, 0x7c, 0x5f, 0x41, 0x23, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x35, 0x53, 0x71, 0x8d, 0xab, 0xb0, 0x9b, 0x7f, 0x61, 0x43, 0x25, 0x08, 0x00, 0x00, 0x04, 0x23, 0x41, 0x5f, 0x7c, 0x99, 0xb0, 0xad, 0x8f, 0x73, 0x55, 0x37, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2b, 0x49, 0x67, 0x84, 0x90, 0x90, 0x8f, 0x75, 0x57, 0x39, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x18, 0x37, 0x55, 0x73, 0x8e, 0x90, 0x90, 0x85, 0x68, 0x4b, 0x2d, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x3f, 0x5c, 0x70, 0x70, 0x70, 0x70, 0x69, 0x4d, 0x2f, 0x11, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2d, 0x4a, 0x66, 0x70, 0x70, 0x70, 0x70, 0x5d, 0x41, 0x23, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x30, 0x46, 0x50, 0x50, 0x50, 0x50, 0x4d, 0x3c, 0x23, 0x06, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1f, 0x39, 0x4c, 0x50, 0x50, 0x50, 0x50, 0x46, 0x30, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1a, 0x2a, 0x31, 0x31, 0x31, 0x31, 0x2f, 0x23, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x21, 0x2e, 0x31, 0x31, 0x31, 0x31, 0x2a, 0x1a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x0f, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0f, 0x11, 0x11, 0x11, 0x11, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0058 "X" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x1b, 0x1d, 0x1d, 0x1d, 0x1d, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1b, 0x1d, 0x1d, 0x1d, 0x1d, 0x17, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x2d, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x36, 0x25, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x2d, 0x3a, 0x3d, 0x3d, 0x3d, 0x3c, 0x35, 0x23, 0x0a, 0x00, 0x00,
+    0x00, 0x0b, 0x28, 0x44, 0x58, 0x5c, 0x5c, 0x5c, 0x5c, 0x52, 0x3c, 0x22, 0x08, 0x00, 0x00, 0x00, 0x00, 0x11, 0x2b, 0x44, 0x58, 0x5c, 0x5c, 0x5c, 0x5c, 0x4f, 0x36, 0x1a, 0x00, 0x00,
+    0x00, 0x11, 0x30, 0x50, 0x6f, 0x7c, 0x7c, 0x7c, 0x7c, 0x68, 0x4e, 0x34, 0x1b, 0x02, 0x00, 0x00, 0x0a, 0x24, 0x3e, 0x57, 0x71, 0x7c, 0x7c, 0x7c, 0x7b, 0x60, 0x40, 0x21, 0x01, 0x00,
+    0x00, 0x0e, 0x2d, 0x4a, 0x66, 0x7f, 0x97, 0x9c, 0x92, 0x79, 0x60, 0x47, 0x2e, 0x14, 0x00, 0x03, 0x1d, 0x36, 0x50, 0x6a, 0x81, 0x9a, 0x9c, 0x89, 0x71, 0x57, 0x3c, 0x1d, 0x00, 0x00,
+    0x00, 0x03, 0x1f, 0x39, 0x53, 0x6c, 0x84, 0x9d, 0xa4, 0x8c, 0x74, 0x5a, 0x40, 0x27, 0x0d, 0x16, 0x30, 0x49, 0x63, 0x7c, 0x94, 0xa8, 0x8f, 0x78, 0x5f, 0x45, 0x2c, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x27, 0x40, 0x5a, 0x74, 0x8c, 0xa5, 0x9d, 0x84, 0x6c, 0x53, 0x39, 0x20, 0x28, 0x42, 0x5c, 0x74, 0x8c, 0xa6, 0x97, 0x7f, 0x66, 0x4c, 0x33, 0x19, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x14, 0x2e, 0x47, 0x61, 0x7a, 0x92, 0xac, 0x97, 0x7f, 0x66, 0x4c, 0x32, 0x3b, 0x54, 0x6e, 0x86, 0xa0, 0x9d, 0x84, 0x6c, 0x53, 0x39, 0x20, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x1b, 0x35, 0x4f, 0x68, 0x81, 0x9a, 0xa9, 0x8f, 0x78, 0x5e, 0x45, 0x4e, 0x66, 0x7f, 0x98, 0xa4, 0x8c, 0x74, 0x5a, 0x40, 0x27, 0x0d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x22, 0x3c, 0x55, 0x6e, 0x87, 0xa0, 0xa2, 0x89, 0x71, 0x57, 0x60, 0x79, 0x92, 0xa9, 0x92, 0x79, 0x60, 0x47, 0x2e, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x29, 0x43, 0x5d, 0x76, 0x8f, 0xa8, 0x9b, 0x81, 0x6a, 0x71, 0x8a, 0xa3, 0x98, 0x80, 0x68, 0x4e, 0x34, 0x1b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x4a, 0x63, 0x7c, 0x95, 0xac, 0x95, 0x7c, 0x84, 0x9d, 0xa0, 0x87, 0x6e, 0x55, 0x3c, 0x22, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1e, 0x38, 0x51, 0x6b, 0x83, 0x9b, 0xa6, 0x8f, 0x95, 0xa6, 0x8c, 0x74, 0x5c, 0x43, 0x28, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x25, 0x3f, 0x58, 0x71, 0x89, 0xa3, 0xad, 0xac, 0x94, 0x7c, 0x63, 0x49, 0x30, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x2d, 0x47, 0x60, 0x7a, 0x98, 0xb8, 0xa4, 0x85, 0x6c, 0x53, 0x3a, 0x20, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x25, 0x3f, 0x58, 0x71, 0x89, 0xa3, 0xa8, 0xae, 0x97, 0x7f, 0x66, 0x4c, 0x33, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1e, 0x38, 0x51, 0x6b, 0x83, 0x9b, 0xa3, 0x8a, 0x97, 0xaa, 0x8f, 0x78, 0x5f, 0x46, 0x2c, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x31, 0x4a, 0x63, 0x7c, 0x95, 0xaa, 0x91, 0x79, 0x86, 0x9f, 0xa3, 0x89, 0x71, 0x58, 0x3f, 0x25, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x2a, 0x44, 0x5d, 0x77, 0x8f, 0xa8, 0x98, 0x7f, 0x66, 0x74, 0x8c, 0xa5, 0x9b, 0x83, 0x6b, 0x52, 0x38, 0x1e, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x23, 0x3d, 0x56, 0x6f, 0x87, 0xa1, 0xa0, 0x86, 0x6e, 0x54, 0x63, 0x7b, 0x93, 0xac, 0x95, 0x7d, 0x63, 0x4a, 0x31, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x1d, 0x36, 0x4f, 0x69, 0x81, 0x9a, 0xa6, 0x8c, 0x74, 0x5c, 0x42, 0x4f, 0x69, 0x81, 0x9a, 0xa8, 0x8f, 0x77, 0x5d, 0x44, 0x2a, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x16, 0x2f, 0x49, 0x63, 0x7b, 0x93, 0xac, 0x94, 0x7c, 0x63, 0x49, 0x30, 0x3d, 0x56, 0x6f, 0x88, 0xa1, 0xa1, 0x88, 0x6f, 0x56, 0x3d, 0x23, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x28, 0x42, 0x5b, 0x74, 0x8c, 0xa5, 0x9b, 0x81, 0x6a, 0x50, 0x36, 0x1d, 0x2a, 0x44, 0x5d, 0x77, 0x8f, 0xa8, 0x9a, 0x81, 0x69, 0x4f, 0x36, 0x1d, 0x03, 0x00, 0x00,
+    0x00, 0x08, 0x22, 0x3b, 0x55, 0x6e, 0x86, 0x9f, 0xa3, 0x89, 0x71, 0x57, 0x3e, 0x24, 0x0a, 0x18, 0x31, 0x4a, 0x65, 0x7d, 0x95, 0xac, 0x93, 0x7b, 0x63, 0x49, 0x2f, 0x16, 0x00, 0x00,
+    0x00, 0x18, 0x34, 0x4e, 0x66, 0x80, 0x98, 0xaa, 0x91, 0x78, 0x5f, 0x45, 0x2c, 0x11, 0x00, 0x05, 0x1e, 0x39, 0x52, 0x6b, 0x84, 0x9d, 0xa5, 0x8c, 0x74, 0x5b, 0x42, 0x28, 0x0c, 0x00,
+    0x01, 0x20, 0x40, 0x5f, 0x79, 0x8f, 0x90, 0x90, 0x7f, 0x66, 0x4c, 0x33, 0x19, 0x00, 0x00, 0x00, 0x0c, 0x25, 0x3f, 0x58, 0x71, 0x8a, 0x90, 0x90, 0x86, 0x6e, 0x52, 0x33, 0x14, 0x00,
+    0x00, 0x1f, 0x3e, 0x5c, 0x70, 0x70, 0x70, 0x70, 0x6b, 0x54, 0x3a, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0x13, 0x2d, 0x46, 0x60, 0x70, 0x70, 0x70, 0x70, 0x6b, 0x51, 0x33, 0x13, 0x00,
+    0x00, 0x15, 0x30, 0x46, 0x50, 0x50, 0x50, 0x50, 0x4e, 0x3f, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x33, 0x48, 0x50, 0x50, 0x50, 0x50, 0x4e, 0x3f, 0x26, 0x0a, 0x00,
+    0x00, 0x03, 0x1a, 0x2a, 0x31, 0x31, 0x31, 0x31, 0x2f, 0x25, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1c, 0x2b, 0x31, 0x31, 0x31, 0x31, 0x2f, 0x25, 0x12, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x10, 0x08, 0x00, 0x00, 0x00,
+
+    /* U+0059 "Y" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x13, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x16, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x16, 0x1d, 0x1d, 0x1d, 0x1d, 0x1a, 0x0e, 0x00, 0x00,
+    0x00, 0x01, 0x1a, 0x2f, 0x3b, 0x3d, 0x3d, 0x3d, 0x3c, 0x33, 0x20, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x20, 0x33, 0x3c, 0x3d, 0x3d, 0x3d, 0x38, 0x28, 0x11, 0x00,
+    0x00, 0x0e, 0x2c, 0x47, 0x5a, 0x5c, 0x5c, 0x5c, 0x5c, 0x4d, 0x33, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x34, 0x4d, 0x5c, 0x5c, 0x5c, 0x5c, 0x54, 0x3d, 0x21, 0x03,
+    0x00, 0x15, 0x34, 0x54, 0x73, 0x7c, 0x7c, 0x7c, 0x79, 0x5f, 0x44, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x2a, 0x45, 0x60, 0x79, 0x7c, 0x7c, 0x7c, 0x67, 0x48, 0x28, 0x09,
+    0x00, 0x12, 0x30, 0x4e, 0x68, 0x81, 0x9b, 0x9c, 0x88, 0x6f, 0x54, 0x3a, 0x1e, 0x03, 0x00, 0x00, 0x00, 0x05, 0x1f, 0x3a, 0x55, 0x71, 0x8a, 0x9c, 0x94, 0x7b, 0x60, 0x44, 0x26, 0x07,
+    0x00, 0x07, 0x22, 0x3d, 0x58, 0x73, 0x8c, 0xa6, 0x98, 0x7f, 0x65, 0x4a, 0x2f, 0x13, 0x00, 0x00, 0x00, 0x15, 0x30, 0x4b, 0x66, 0x80, 0x9a, 0x9f, 0x85, 0x6b, 0x50, 0x35, 0x1a, 0x00,
+    0x00, 0x00, 0x11, 0x2d, 0x47, 0x63, 0x7d, 0x96, 0xaa, 0x8f, 0x74, 0x5a, 0x3f, 0x24, 0x08, 0x00, 0x0a, 0x25, 0x40, 0x5c, 0x76, 0x8f, 0xa8, 0x8f, 0x74, 0x5b, 0x3f, 0x25, 0x09, 0x00,
+    0x00, 0x00, 0x01, 0x1c, 0x37, 0x52, 0x6d, 0x86, 0xa1, 0x9f, 0x84, 0x6a, 0x4f, 0x34, 0x1a, 0x01, 0x1b, 0x36, 0x51, 0x6c, 0x85, 0xa0, 0x9a, 0x7f, 0x65, 0x4a, 0x2f, 0x14, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0c, 0x27, 0x41, 0x5c, 0x77, 0x91, 0xab, 0x94, 0x7a, 0x60, 0x45, 0x2a, 0x11, 0x2c, 0x46, 0x61, 0x7c, 0x95, 0xa4, 0x89, 0x6f, 0x55, 0x3a, 0x1e, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x31, 0x4c, 0x66, 0x81, 0x9b, 0xa4, 0x8a, 0x71, 0x55, 0x3a, 0x22, 0x3c, 0x56, 0x71, 0x8c, 0xa6, 0x93, 0x7a, 0x5f, 0x45, 0x29, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x21, 0x3c, 0x56, 0x71, 0x8a, 0xa5, 0x9a, 0x80, 0x66, 0x4a, 0x32, 0x4c, 0x66, 0x81, 0x9b, 0x9d, 0x83, 0x6a, 0x4f, 0x34, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2c, 0x46, 0x61, 0x7b, 0x95, 0xaa, 0x8f, 0x76, 0x5b, 0x43, 0x5d, 0x78, 0x91, 0xa8, 0x8d, 0x74, 0x5a, 0x3e, 0x23, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x35, 0x51, 0x6c, 0x85, 0x9f, 0x9f, 0x85, 0x6c, 0x53, 0x6d, 0x86, 0xa1, 0x98, 0x7f, 0x65, 0x49, 0x2e, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x25, 0x40, 0x5b, 0x76, 0x8f, 0xaa, 0x95, 0x7b, 0x64, 0x7d, 0x96, 0xa2, 0x88, 0x6e, 0x54, 0x39, 0x1e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x2f, 0x4a, 0x66, 0x80, 0x9a, 0xa5, 0x8a, 0x74, 0x8c, 0xa8, 0x93, 0x79, 0x5e, 0x43, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1f, 0x3a, 0x55, 0x71, 0x89, 0xa4, 0x9a, 0x85, 0x9d, 0x9d, 0x83, 0x69, 0x4e, 0x33, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x2a, 0x45, 0x5f, 0x7a, 0x94, 0xad, 0xa4, 0xa8, 0x8c, 0x74, 0x58, 0x3e, 0x23, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x34, 0x4f, 0x6a, 0x84, 0x9d, 0xb2, 0x97, 0x7d, 0x63, 0x48, 0x2e, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x24, 0x3f, 0x5a, 0x78, 0x98, 0xac, 0x8c, 0x6d, 0x53, 0x38, 0x1c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x90, 0x90, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x36, 0x55, 0x6d, 0x70, 0x70, 0x70, 0x66, 0x49, 0x2b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x29, 0x41, 0x4f, 0x50, 0x50, 0x50, 0x4c, 0x39, 0x1f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x27, 0x30, 0x31, 0x31, 0x31, 0x2e, 0x21, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x11, 0x11, 0x11, 0x0f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+005A "Z" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x16, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x18, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x20, 0x33, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x36, 0x25, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x33, 0x4d, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x52, 0x3a, 0x1d, 0x00, 0x00,
+    0x00, 0x00, 0x1d, 0x3c, 0x5c, 0x79, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x64, 0x44, 0x25, 0x05, 0x00,
+    0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9b, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00,
+    0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9b, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xae, 0xb9, 0xa2, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00,
+    0x00, 0x00, 0x1d, 0x3c, 0x5c, 0x79, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x85, 0xa4, 0xa6, 0x8f, 0x77, 0x5e, 0x41, 0x22, 0x03, 0x00,
+    0x00, 0x00, 0x16, 0x33, 0x4d, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x66, 0x7f, 0x97, 0xab, 0x93, 0x7c, 0x63, 0x4a, 0x32, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x20, 0x33, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x4a, 0x63, 0x7a, 0x92, 0xab, 0x97, 0x80, 0x69, 0x4f, 0x37, 0x1e, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x16, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x2d, 0x45, 0x5d, 0x76, 0x8c, 0xa5, 0x9d, 0x84, 0x6d, 0x55, 0x3c, 0x23, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x28, 0x40, 0x58, 0x71, 0x89, 0xa0, 0xa1, 0x89, 0x71, 0x58, 0x41, 0x28, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x23, 0x3c, 0x54, 0x6c, 0x84, 0x9d, 0xa5, 0x8d, 0x77, 0x5d, 0x45, 0x2d, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x37, 0x4f, 0x68, 0x7f, 0x97, 0xab, 0x92, 0x7b, 0x63, 0x4a, 0x31, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1a, 0x32, 0x4a, 0x63, 0x7c, 0x92, 0xab, 0x97, 0x7f, 0x68, 0x4f, 0x36, 0x1d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x2d, 0x46, 0x5e, 0x77, 0x8f, 0xa6, 0x9d, 0x84, 0x6c, 0x54, 0x3c, 0x23, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0x41, 0x5a, 0x71, 0x89, 0xa2, 0xa1, 0x89, 0x71, 0x58, 0x40, 0x28, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x24, 0x3c, 0x55, 0x6e, 0x84, 0x9d, 0xa5, 0x8c, 0x77, 0x5d, 0x45, 0x2d, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1f, 0x38, 0x50, 0x69, 0x81, 0x98, 0xab, 0x92, 0x7a, 0x63, 0x4a, 0x31, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x1a, 0x33, 0x4b, 0x63, 0x7c, 0x94, 0xab, 0x97, 0x7f, 0x66, 0x4f, 0x36, 0x1d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x2e, 0x47, 0x60, 0x77, 0x8f, 0xa8, 0x9b, 0x84, 0x6b, 0x53, 0x3b, 0x22, 0x0b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x08, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x29, 0x42, 0x5b, 0x74, 0x8a, 0xa3, 0xa0, 0x88, 0x71, 0x58, 0x3f, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x28, 0x1e, 0x0c, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x25, 0x3d, 0x55, 0x6e, 0x86, 0x9d, 0xa5, 0x8c, 0x76, 0x5d, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x47, 0x39, 0x22, 0x07, 0x00,
+    0x00, 0x00, 0x1c, 0x38, 0x51, 0x69, 0x81, 0x9a, 0xab, 0x92, 0x7a, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x65, 0x4e, 0x30, 0x12, 0x00,
+    0x00, 0x05, 0x24, 0x44, 0x63, 0x7c, 0x95, 0xad, 0xa9, 0x8c, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x74, 0x54, 0x35, 0x15, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xb0, 0xb0, 0xa9, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x74, 0x54, 0x35, 0x15, 0x00,
+    0x00, 0x04, 0x23, 0x42, 0x5f, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x6b, 0x51, 0x33, 0x13, 0x00,
+    0x00, 0x00, 0x18, 0x33, 0x48, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4e, 0x3f, 0x26, 0x0a, 0x00,
+    0x00, 0x00, 0x06, 0x1c, 0x2b, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2f, 0x25, 0x12, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x08, 0x00, 0x00, 0x00,
+
+    /* U+005B "[" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x24, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x27, 0x1c, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x14, 0x2e, 0x41, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x46, 0x36, 0x1e, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x21, 0x3f, 0x5b, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x63, 0x4a, 0x2d, 0x0e, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x50, 0x31, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa8, 0xa6, 0xa6, 0xa6, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9f, 0x88, 0x88, 0x88, 0x88, 0x70, 0x50, 0x31, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x68, 0x68, 0x68, 0x63, 0x4a, 0x2d, 0x0e, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x48, 0x48, 0x46, 0x36, 0x1e, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x29, 0x27, 0x1c, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1e, 0x1b, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3e, 0x3d, 0x3a, 0x2d, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5d, 0x5c, 0x5c, 0x58, 0x44, 0x28, 0x0b, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7d, 0x7c, 0x7c, 0x7c, 0x6f, 0x50, 0x30, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa8, 0x9c, 0x9c, 0x9c, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x98, 0x98, 0x98, 0x98, 0x98, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x24, 0x44, 0x63, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x6d, 0x4f, 0x30, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1c, 0x38, 0x4f, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x55, 0x41, 0x27, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0b, 0x22, 0x33, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x36, 0x29, 0x14, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x15, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+005C */
+    0x00, 0x00, 0x00, 0x08, 0x10, 0x11, 0x11, 0x11, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x12, 0x25, 0x2f, 0x31, 0x31, 0x31, 0x2a, 0x1a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x26, 0x3f, 0x4e, 0x50, 0x50, 0x50, 0x46, 0x30, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x13, 0x33, 0x51, 0x6b, 0x70, 0x70, 0x70, 0x5d, 0x41, 0x24, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x15, 0x35, 0x54, 0x74, 0x8f, 0x90, 0x86, 0x6a, 0x4c, 0x2e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x2e, 0x4c, 0x6a, 0x86, 0xa3, 0x90, 0x74, 0x56, 0x39, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x24, 0x41, 0x5f, 0x7c, 0x99, 0x9b, 0x7f, 0x61, 0x43, 0x25, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x37, 0x55, 0x73, 0x8f, 0xa5, 0x88, 0x6b, 0x4d, 0x2f, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x2d, 0x4b, 0x68, 0x84, 0xa1, 0x91, 0x76, 0x58, 0x3a, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x21, 0x3f, 0x5d, 0x7b, 0x98, 0x9c, 0x80, 0x63, 0x44, 0x26, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x35, 0x53, 0x71, 0x8d, 0xa6, 0x88, 0x6c, 0x4f, 0x32, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x2b, 0x48, 0x66, 0x83, 0xa0, 0x94, 0x78, 0x5a, 0x3c, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x20, 0x3e, 0x5c, 0x7a, 0x96, 0x9d, 0x80, 0x64, 0x46, 0x28, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x34, 0x51, 0x6f, 0x8b, 0xa6, 0x8a, 0x6f, 0x51, 0x33, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0b, 0x29, 0x47, 0x65, 0x81, 0x9f, 0x95, 0x78, 0x5b, 0x3d, 0x1f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x3d, 0x5b, 0x78, 0x94, 0x9f, 0x81, 0x65, 0x48, 0x2a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x32, 0x50, 0x6d, 0x8a, 0xa7, 0x8c, 0x70, 0x52, 0x34, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x28, 0x46, 0x64, 0x80, 0x9d, 0x96, 0x7a, 0x5c, 0x3f, 0x21, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3c, 0x58, 0x76, 0x93, 0xa1, 0x84, 0x67, 0x49, 0x2b, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x30, 0x4e, 0x6c, 0x88, 0xa6, 0x8d, 0x71, 0x53, 0x35, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x26, 0x44, 0x63, 0x7f, 0x9b, 0x98, 0x7b, 0x5f, 0x41, 0x23, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x39, 0x57, 0x75, 0x91, 0xa3, 0x85, 0x68, 0x4b, 0x2d, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x2f, 0x4d, 0x6b, 0x88, 0xa4, 0x8f, 0x73, 0x55, 0x38, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x25, 0x43, 0x60, 0x7d, 0x9a, 0x9a, 0x7d, 0x60, 0x42, 0x24, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x38, 0x56, 0x74, 0x90, 0xa4, 0x86, 0x6a, 0x4c, 0x2e, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2e, 0x4c, 0x6a, 0x85, 0xa3, 0x90, 0x74, 0x57, 0x39, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x23, 0x41, 0x5f, 0x7c, 0x99, 0x9b, 0x7f, 0x61, 0x43, 0x25, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x37, 0x55, 0x73, 0x8f, 0xa5, 0x88, 0x6b, 0x4e, 0x30, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2d, 0x4a, 0x67, 0x84, 0xa1, 0x93, 0x76, 0x58, 0x3a, 0x1c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x3f, 0x5d, 0x7b, 0x98, 0x9c, 0x80, 0x63, 0x44, 0x27, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x35, 0x53, 0x70, 0x8c, 0xa6, 0x88, 0x6d, 0x50, 0x32, 0x14, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2a, 0x48, 0x66, 0x83, 0xa0, 0x94, 0x78, 0x5a, 0x3c, 0x1d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x3e, 0x5c, 0x7a, 0x95, 0x9d, 0x80, 0x64, 0x46, 0x29, 0x0b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x33, 0x51, 0x6f, 0x8b, 0x98, 0x8b, 0x6f, 0x51, 0x33, 0x13, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x29, 0x47, 0x65, 0x78, 0x78, 0x78, 0x71, 0x53, 0x34, 0x14, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1e, 0x39, 0x4f, 0x58, 0x58, 0x58, 0x56, 0x44, 0x2a, 0x0d, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x22, 0x33, 0x39, 0x39, 0x39, 0x37, 0x2c, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x15, 0x19, 0x19, 0x19, 0x18, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+005D "]" */
+    0x00, 0x00, 0x00, 0x03, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x21, 0x28, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x28, 0x1f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0e, 0x28, 0x3d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x3b, 0x25, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1a, 0x38, 0x54, 0x67, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x66, 0x51, 0x34, 0x16, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9c, 0xa6, 0xa6, 0xa6, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x88, 0x88, 0x88, 0x8c, 0xa9, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1a, 0x38, 0x54, 0x67, 0x68, 0x68, 0x69, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0e, 0x28, 0x3d, 0x48, 0x48, 0x49, 0x68, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x21, 0x28, 0x2a, 0x48, 0x68, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x0a, 0x29, 0x48, 0x68, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x16, 0x1d, 0x29, 0x48, 0x68, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x20, 0x33, 0x3c, 0x3d, 0x48, 0x68, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x16, 0x33, 0x4d, 0x5c, 0x5c, 0x5c, 0x68, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1d, 0x3c, 0x5c, 0x79, 0x7c, 0x7c, 0x7c, 0x88, 0xa8, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9b, 0x9c, 0x9c, 0x9d, 0xb1, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1c, 0x3c, 0x5b, 0x76, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x74, 0x57, 0x38, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x15, 0x31, 0x4a, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x57, 0x47, 0x2e, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x1d, 0x2f, 0x38, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x38, 0x2e, 0x1a, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x12, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x11, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+005E "^" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x0d, 0x0d, 0x0d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1f, 0x2b, 0x2d, 0x2d, 0x2d, 0x28, 0x19, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x21, 0x39, 0x49, 0x4c, 0x4c, 0x4c, 0x45, 0x31, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x2e, 0x4c, 0x66, 0x6c, 0x6c, 0x6c, 0x5d, 0x43, 0x25, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1e, 0x3a, 0x58, 0x74, 0x8c, 0x8c, 0x88, 0x6c, 0x4f, 0x32, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2a, 0x47, 0x65, 0x80, 0x9c, 0xa8, 0x94, 0x78, 0x5b, 0x3e, 0x21, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x36, 0x53, 0x71, 0x8c, 0x9a, 0x8a, 0x9f, 0x83, 0x67, 0x4a, 0x2e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x26, 0x43, 0x60, 0x7d, 0x98, 0x8d, 0x7b, 0x96, 0x8f, 0x74, 0x56, 0x3a, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x33, 0x4f, 0x6c, 0x88, 0x9f, 0x81, 0x6f, 0x8b, 0x9b, 0x80, 0x63, 0x46, 0x28, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x21, 0x3e, 0x5c, 0x78, 0x94, 0x93, 0x78, 0x64, 0x80, 0x9b, 0x8a, 0x6f, 0x52, 0x35, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x2e, 0x4b, 0x68, 0x83, 0xa0, 0x86, 0x6b, 0x57, 0x74, 0x90, 0x96, 0x7b, 0x5f, 0x41, 0x25, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3a, 0x57, 0x74, 0x8f, 0x98, 0x7b, 0x5f, 0x4c, 0x68, 0x85, 0xa0, 0x86, 0x6b, 0x4e, 0x30, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x2a, 0x46, 0x64, 0x80, 0x9b, 0x8c, 0x70, 0x53, 0x3f, 0x5c, 0x7a, 0x95, 0x93, 0x76, 0x5a, 0x3d, 0x1f, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x36, 0x53, 0x70, 0x8c, 0x9c, 0x80, 0x65, 0x47, 0x33, 0x51, 0x6d, 0x8a, 0x9f, 0x81, 0x66, 0x49, 0x2c, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x25, 0x43, 0x5f, 0x7c, 0x98, 0x91, 0x75, 0x58, 0x3a, 0x28, 0x45, 0x61, 0x7f, 0x9a, 0x8d, 0x73, 0x56, 0x38, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x31, 0x4e, 0x6c, 0x88, 0xa1, 0x85, 0x68, 0x4c, 0x2f, 0x1b, 0x38, 0x56, 0x73, 0x8d, 0x9a, 0x7f, 0x61, 0x45, 0x28, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1e, 0x3d, 0x5b, 0x78, 0x93, 0x95, 0x7a, 0x5d, 0x3f, 0x23, 0x0f, 0x2c, 0x49, 0x66, 0x83, 0x9e, 0x8a, 0x6d, 0x51, 0x34, 0x16, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x21, 0x40, 0x60, 0x7f, 0x80, 0x80, 0x6d, 0x51, 0x33, 0x17, 0x03, 0x20, 0x3e, 0x5b, 0x78, 0x80, 0x80, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1b, 0x38, 0x52, 0x60, 0x60, 0x60, 0x5a, 0x43, 0x27, 0x0a, 0x00, 0x15, 0x31, 0x4c, 0x5f, 0x60, 0x60, 0x5f, 0x4c, 0x31, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x25, 0x38, 0x40, 0x40, 0x40, 0x3d, 0x2d, 0x16, 0x00, 0x00, 0x06, 0x20, 0x34, 0x40, 0x40, 0x40, 0x40, 0x34, 0x20, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0d, 0x1b, 0x21, 0x21, 0x21, 0x1e, 0x13, 0x01, 0x00, 0x00, 0x00, 0x08, 0x18, 0x20, 0x21, 0x21, 0x20, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+005F "_" */
+    0x00, 0x00, 0x06, 0x0f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0f, 0x06, 0x00, 0x00,
+    0x00, 0x0f, 0x23, 0x2f, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2f, 0x23, 0x0f, 0x00,
+    0x06, 0x23, 0x3c, 0x4d, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4d, 0x3c, 0x23, 0x06,
+    0x0f, 0x2f, 0x4d, 0x69, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x69, 0x4d, 0x2f, 0x0f,
+    0x11, 0x31, 0x50, 0x70, 0x8f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8f, 0x70, 0x50, 0x31, 0x11,
+    0x11, 0x31, 0x50, 0x70, 0x8f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8f, 0x70, 0x50, 0x31, 0x11,
+    0x0f, 0x2f, 0x4d, 0x69, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x69, 0x4d, 0x2f, 0x0f,
+    0x06, 0x23, 0x3c, 0x4d, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4d, 0x3c, 0x23, 0x06,
+    0x00, 0x0f, 0x23, 0x2f, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2f, 0x23, 0x0f, 0x00,
+    0x00, 0x00, 0x06, 0x0f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0f, 0x06, 0x00, 0x00,
+
+    /* U+0060 "`" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x05, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1a, 0x24, 0x25, 0x25, 0x25, 0x25, 0x20, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x1f, 0x35, 0x43, 0x44, 0x44, 0x44, 0x44, 0x3e, 0x2b, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x2f, 0x4b, 0x61, 0x64, 0x64, 0x64, 0x64, 0x58, 0x44, 0x2e, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x84, 0x84, 0x84, 0x83, 0x71, 0x5b, 0x44, 0x2e, 0x17, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x2f, 0x4b, 0x61, 0x74, 0x87, 0x9a, 0x9a, 0x87, 0x71, 0x5b, 0x44, 0x30, 0x1a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x1f, 0x35, 0x48, 0x5b, 0x6e, 0x81, 0x94, 0x9d, 0x87, 0x71, 0x5c, 0x47, 0x31, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1c, 0x2f, 0x43, 0x55, 0x69, 0x7c, 0x8f, 0x9d, 0x87, 0x74, 0x5d, 0x45, 0x28, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x16, 0x29, 0x3d, 0x50, 0x63, 0x77, 0x84, 0x84, 0x84, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x24, 0x38, 0x4a, 0x5d, 0x64, 0x64, 0x64, 0x5d, 0x45, 0x28, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x1e, 0x31, 0x41, 0x44, 0x44, 0x44, 0x41, 0x30, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x16, 0x22, 0x25, 0x25, 0x25, 0x22, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x05, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0061 "a" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0b, 0x10, 0x14, 0x15, 0x15, 0x14, 0x10, 0x0a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x17, 0x21, 0x2a, 0x2f, 0x33, 0x35, 0x35, 0x34, 0x2f, 0x29, 0x1f, 0x13, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x1a, 0x28, 0x35, 0x3f, 0x48, 0x4e, 0x52, 0x54, 0x54, 0x53, 0x4e, 0x48, 0x3d, 0x2f, 0x1f, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0c, 0x22, 0x34, 0x45, 0x52, 0x5d, 0x67, 0x6c, 0x70, 0x74, 0x74, 0x71, 0x6c, 0x66, 0x5a, 0x4b, 0x39, 0x23, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x1f, 0x39, 0x4f, 0x60, 0x6f, 0x7b, 0x84, 0x8c, 0x90, 0x94, 0x94, 0x90, 0x8b, 0x81, 0x76, 0x66, 0x4f, 0x39, 0x22, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x2b, 0x49, 0x66, 0x7a, 0x8a, 0x96, 0xa1, 0xa7, 0xa4, 0xa0, 0xa0, 0xa5, 0xa9, 0x9f, 0x8f, 0x7c, 0x66, 0x4f, 0x33, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x2c, 0x4b, 0x6a, 0x85, 0x9f, 0x9f, 0x93, 0x88, 0x84, 0x80, 0x83, 0x88, 0x91, 0xa2, 0xa8, 0x92, 0x7a, 0x5f, 0x43, 0x25, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x23, 0x3f, 0x5b, 0x76, 0x90, 0x83, 0x76, 0x6c, 0x65, 0x61, 0x64, 0x6a, 0x77, 0x89, 0xa2, 0xa3, 0x88, 0x6b, 0x4d, 0x2f, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x14, 0x2f, 0x4c, 0x66, 0x78, 0x68, 0x5a, 0x4e, 0x47, 0x43, 0x44, 0x4c, 0x5e, 0x78, 0x93, 0xae, 0x91, 0x74, 0x56, 0x37, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x21, 0x3b, 0x51, 0x58, 0x4f, 0x42, 0x47, 0x48, 0x48, 0x48, 0x48, 0x4e, 0x6c, 0x8a, 0xa8, 0x98, 0x78, 0x5a, 0x3b, 0x1c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x2b, 0x3d, 0x4c, 0x58, 0x60, 0x65, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x88, 0xa8, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x2b, 0x41, 0x57, 0x68, 0x76, 0x80, 0x84, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8c, 0xa9, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x21, 0x3d, 0x57, 0x6e, 0x81, 0x91, 0x9c, 0xa2, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa1, 0xb4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x2f, 0x4c, 0x68, 0x81, 0x9a, 0xa5, 0x91, 0x85, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x88, 0xa8, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1a, 0x38, 0x57, 0x75, 0x91, 0xab, 0x91, 0x79, 0x68, 0x61, 0x60, 0x60, 0x60, 0x60, 0x68, 0x88, 0xa8, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9a, 0xa4, 0x85, 0x68, 0x4d, 0x43, 0x40, 0x40, 0x40, 0x4a, 0x68, 0x88, 0xa8, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9c, 0xa4, 0x84, 0x67, 0x4a, 0x3a, 0x38, 0x3c, 0x48, 0x5c, 0x74, 0x8f, 0xab, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3b, 0x5a, 0x78, 0x95, 0xab, 0x8f, 0x77, 0x63, 0x59, 0x57, 0x5b, 0x65, 0x74, 0x87, 0xa0, 0xb7, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x33, 0x51, 0x6d, 0x88, 0xa2, 0xa3, 0x8c, 0x80, 0x78, 0x75, 0x78, 0x80, 0x8d, 0x9c, 0x8c, 0xa3, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x27, 0x43, 0x5e, 0x77, 0x8c, 0x9d, 0xa6, 0x9c, 0x98, 0x94, 0x98, 0x9d, 0x9a, 0x87, 0x80, 0xa0, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x32, 0x4a, 0x60, 0x73, 0x81, 0x8b, 0x93, 0x94, 0x94, 0x90, 0x8a, 0x7f, 0x6f, 0x80, 0x90, 0x90, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x1d, 0x33, 0x47, 0x58, 0x65, 0x6f, 0x74, 0x75, 0x74, 0x74, 0x6c, 0x63, 0x5c, 0x70, 0x70, 0x70, 0x6f, 0x58, 0x3a, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x1b, 0x2d, 0x3c, 0x47, 0x50, 0x54, 0x57, 0x56, 0x54, 0x4e, 0x46, 0x46, 0x50, 0x50, 0x50, 0x50, 0x44, 0x2d, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x1f, 0x29, 0x31, 0x35, 0x38, 0x37, 0x35, 0x2f, 0x28, 0x2a, 0x31, 0x31, 0x31, 0x30, 0x28, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0b, 0x12, 0x15, 0x18, 0x18, 0x15, 0x10, 0x09, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0062 "b" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x09, 0x09, 0x09, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x1e, 0x28, 0x29, 0x29, 0x29, 0x27, 0x1c, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x22, 0x39, 0x47, 0x48, 0x48, 0x48, 0x46, 0x36, 0x1e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x12, 0x30, 0x4e, 0x65, 0x68, 0x68, 0x68, 0x63, 0x4a, 0x2d, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x88, 0x88, 0x88, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xa8, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x14, 0x15, 0x15, 0x13, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x2e, 0x33, 0x35, 0x35, 0x33, 0x2e, 0x25, 0x1b, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x43, 0x4c, 0x52, 0x54, 0x54, 0x51, 0x4c, 0x43, 0x38, 0x2a, 0x1a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x55, 0x61, 0x6b, 0x70, 0x74, 0x74, 0x70, 0x6b, 0x61, 0x55, 0x46, 0x34, 0x22, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x6f, 0x7f, 0x88, 0x90, 0x94, 0x94, 0x90, 0x88, 0x7f, 0x71, 0x60, 0x4e, 0x39, 0x23, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x74, 0x88, 0x9a, 0xa5, 0xa4, 0xa4, 0xa4, 0xa8, 0xa5, 0x9a, 0x8a, 0x79, 0x66, 0x4f, 0x37, 0x1d, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x89, 0xa0, 0x9a, 0x8c, 0x84, 0x84, 0x84, 0x8a, 0x94, 0xa4, 0xa4, 0x92, 0x7c, 0x63, 0x49, 0x2f, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb4, 0xa4, 0xa3, 0x92, 0x7f, 0x71, 0x67, 0x64, 0x65, 0x6d, 0x7a, 0x8c, 0xa0, 0xa6, 0x8d, 0x74, 0x5a, 0x3e, 0x21, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb4, 0xad, 0x93, 0x7c, 0x66, 0x55, 0x48, 0x44, 0x47, 0x50, 0x60, 0x74, 0x8c, 0xa5, 0x9f, 0x83, 0x68, 0x4b, 0x2d, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb4, 0x9f, 0x83, 0x69, 0x4f, 0x3a, 0x2a, 0x25, 0x28, 0x34, 0x48, 0x61, 0x7b, 0x96, 0xad, 0x8f, 0x73, 0x55, 0x36, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb2, 0x95, 0x78, 0x5b, 0x3e, 0x23, 0x0e, 0x05, 0x09, 0x1c, 0x35, 0x52, 0x6f, 0x8c, 0xaa, 0x98, 0x7a, 0x5c, 0x3c, 0x1d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x71, 0x53, 0x34, 0x15, 0x00, 0x00, 0x00, 0x0c, 0x2a, 0x49, 0x68, 0x85, 0xa4, 0x9c, 0x7d, 0x60, 0x40, 0x21, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x52, 0x33, 0x15, 0x00, 0x00, 0x00, 0x0b, 0x2a, 0x49, 0x68, 0x85, 0xa4, 0x9c, 0x7f, 0x60, 0x40, 0x21, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb2, 0x95, 0x78, 0x5b, 0x3e, 0x23, 0x0c, 0x02, 0x07, 0x1a, 0x35, 0x51, 0x6f, 0x8c, 0xaa, 0x98, 0x7a, 0x5c, 0x3c, 0x1d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb4, 0x9f, 0x83, 0x69, 0x4f, 0x39, 0x29, 0x21, 0x25, 0x33, 0x47, 0x60, 0x7b, 0x96, 0xad, 0x8f, 0x74, 0x55, 0x36, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb4, 0xad, 0x93, 0x7a, 0x65, 0x53, 0x47, 0x40, 0x44, 0x4e, 0x5f, 0x74, 0x8a, 0xa4, 0x9f, 0x83, 0x68, 0x4b, 0x2e, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb2, 0x9f, 0xa1, 0x8f, 0x7d, 0x6f, 0x65, 0x60, 0x64, 0x6b, 0x79, 0x89, 0xa0, 0xa8, 0x8f, 0x76, 0x5a, 0x3e, 0x21, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xac, 0x8c, 0x8c, 0xa3, 0x98, 0x8b, 0x84, 0x80, 0x80, 0x88, 0x93, 0xa3, 0xa6, 0x92, 0x7c, 0x65, 0x4a, 0x2f, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xac, 0x8c, 0x77, 0x89, 0x9b, 0xa6, 0xa1, 0xa0, 0xa0, 0xa5, 0xa8, 0x9b, 0x8c, 0x7c, 0x66, 0x4f, 0x39, 0x1e, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x90, 0x90, 0x8c, 0x6c, 0x71, 0x80, 0x8a, 0x91, 0x94, 0x94, 0x90, 0x8a, 0x80, 0x73, 0x63, 0x4f, 0x39, 0x23, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x33, 0x51, 0x6b, 0x70, 0x70, 0x70, 0x66, 0x56, 0x63, 0x6d, 0x74, 0x75, 0x74, 0x74, 0x6c, 0x64, 0x56, 0x48, 0x36, 0x23, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x26, 0x3f, 0x4e, 0x50, 0x50, 0x50, 0x4c, 0x3b, 0x46, 0x4f, 0x54, 0x57, 0x55, 0x54, 0x4e, 0x46, 0x3a, 0x2c, 0x1c, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x25, 0x2f, 0x31, 0x31, 0x31, 0x2e, 0x21, 0x28, 0x30, 0x35, 0x38, 0x36, 0x35, 0x2f, 0x28, 0x1d, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x11, 0x11, 0x11, 0x0f, 0x05, 0x09, 0x11, 0x15, 0x18, 0x17, 0x15, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0063 "c" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0e, 0x12, 0x15, 0x15, 0x15, 0x10, 0x0a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1a, 0x25, 0x2d, 0x31, 0x35, 0x35, 0x34, 0x30, 0x29, 0x20, 0x13, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1a, 0x2a, 0x38, 0x43, 0x4b, 0x50, 0x54, 0x54, 0x54, 0x4f, 0x48, 0x3e, 0x2f, 0x21, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x22, 0x34, 0x46, 0x55, 0x61, 0x6a, 0x70, 0x74, 0x74, 0x73, 0x6d, 0x66, 0x5a, 0x4c, 0x3b, 0x28, 0x12, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x23, 0x39, 0x4f, 0x60, 0x71, 0x7d, 0x88, 0x8f, 0x93, 0x94, 0x90, 0x8b, 0x83, 0x76, 0x66, 0x55, 0x3f, 0x28, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x20, 0x39, 0x4f, 0x66, 0x7a, 0x8a, 0x9a, 0xa5, 0xa7, 0xa4, 0xa4, 0xa4, 0xa8, 0x9f, 0x91, 0x80, 0x6b, 0x55, 0x3c, 0x23, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x16, 0x31, 0x4c, 0x66, 0x7c, 0x92, 0xa4, 0xa1, 0x93, 0x88, 0x84, 0x84, 0x85, 0x8d, 0x9b, 0xaa, 0x97, 0x81, 0x69, 0x4e, 0x30, 0x12, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x25, 0x41, 0x5d, 0x78, 0x8f, 0xa8, 0x9d, 0x87, 0x78, 0x6c, 0x64, 0x64, 0x68, 0x73, 0x81, 0x95, 0x9d, 0x8c, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x14, 0x31, 0x4e, 0x6c, 0x86, 0xa1, 0xa1, 0x87, 0x71, 0x5d, 0x4e, 0x46, 0x44, 0x49, 0x56, 0x69, 0x80, 0x81, 0x73, 0x61, 0x4b, 0x2f, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x1b, 0x3a, 0x59, 0x78, 0x93, 0xae, 0x91, 0x77, 0x5d, 0x44, 0x31, 0x27, 0x25, 0x2c, 0x3c, 0x55, 0x6b, 0x69, 0x58, 0x47, 0x35, 0x1f, 0x05, 0x00, 0x00,
+    0x00, 0x03, 0x22, 0x41, 0x60, 0x7f, 0x9c, 0xa4, 0x86, 0x6a, 0x4d, 0x31, 0x17, 0x08, 0x05, 0x10, 0x28, 0x3f, 0x4e, 0x4d, 0x3d, 0x2d, 0x1b, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa3, 0xa0, 0x80, 0x63, 0x44, 0x24, 0x06, 0x00, 0x00, 0x00, 0x12, 0x25, 0x2f, 0x2f, 0x23, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa3, 0xa0, 0x80, 0x61, 0x43, 0x24, 0x06, 0x00, 0x00, 0x00, 0x11, 0x23, 0x2c, 0x2c, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x22, 0x41, 0x60, 0x80, 0x9c, 0xa4, 0x86, 0x6a, 0x4c, 0x2f, 0x16, 0x06, 0x03, 0x0f, 0x27, 0x3e, 0x4b, 0x4b, 0x3c, 0x2a, 0x1a, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3b, 0x5a, 0x78, 0x94, 0xad, 0x91, 0x76, 0x5b, 0x42, 0x30, 0x25, 0x22, 0x2a, 0x3c, 0x53, 0x6a, 0x68, 0x56, 0x46, 0x34, 0x20, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x14, 0x32, 0x4f, 0x6c, 0x86, 0xa2, 0x9f, 0x86, 0x6e, 0x5c, 0x4c, 0x44, 0x41, 0x48, 0x55, 0x69, 0x7f, 0x81, 0x71, 0x60, 0x4c, 0x31, 0x14, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x25, 0x41, 0x5e, 0x78, 0x91, 0xa8, 0x9a, 0x86, 0x76, 0x6a, 0x64, 0x60, 0x66, 0x71, 0x7f, 0x95, 0x9a, 0x8a, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x32, 0x4c, 0x66, 0x7c, 0x92, 0xa5, 0xa0, 0x91, 0x86, 0x80, 0x80, 0x84, 0x8c, 0x9a, 0xaa, 0x97, 0x81, 0x69, 0x4f, 0x33, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x21, 0x39, 0x4f, 0x66, 0x7b, 0x8c, 0x9b, 0xa6, 0xa4, 0xa0, 0xa0, 0xa3, 0xa8, 0xa1, 0x93, 0x81, 0x6b, 0x55, 0x3d, 0x23, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x23, 0x39, 0x4f, 0x63, 0x73, 0x80, 0x88, 0x90, 0x94, 0x94, 0x94, 0x8c, 0x84, 0x78, 0x69, 0x55, 0x3f, 0x28, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x23, 0x36, 0x47, 0x56, 0x63, 0x6c, 0x73, 0x74, 0x78, 0x74, 0x70, 0x67, 0x5c, 0x4e, 0x3d, 0x28, 0x12, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1c, 0x2c, 0x3a, 0x44, 0x4d, 0x54, 0x54, 0x58, 0x54, 0x50, 0x49, 0x3f, 0x31, 0x23, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x1c, 0x26, 0x2f, 0x34, 0x35, 0x39, 0x35, 0x32, 0x2b, 0x21, 0x15, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0f, 0x15, 0x17, 0x19, 0x15, 0x13, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0064 "d" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1e, 0x28, 0x29, 0x29, 0x29, 0x26, 0x1a, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x22, 0x39, 0x47, 0x48, 0x48, 0x48, 0x44, 0x33, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x30, 0x4e, 0x65, 0x68, 0x68, 0x68, 0x60, 0x46, 0x29, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x88, 0x88, 0x88, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xa8, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0f, 0x14, 0x15, 0x15, 0x13, 0x15, 0x35, 0x54, 0x74, 0x94, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x1d, 0x27, 0x2f, 0x33, 0x35, 0x35, 0x32, 0x2d, 0x35, 0x54, 0x74, 0x94, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1d, 0x2e, 0x3a, 0x46, 0x4d, 0x52, 0x54, 0x54, 0x50, 0x4b, 0x42, 0x54, 0x74, 0x94, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x25, 0x38, 0x48, 0x58, 0x64, 0x6c, 0x70, 0x74, 0x74, 0x70, 0x6a, 0x5f, 0x55, 0x74, 0x94, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x25, 0x3c, 0x52, 0x63, 0x74, 0x80, 0x88, 0x90, 0x94, 0x94, 0x8f, 0x86, 0x7b, 0x6c, 0x74, 0x94, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x22, 0x3c, 0x52, 0x69, 0x7d, 0x8d, 0x9c, 0xa7, 0xa6, 0xa4, 0xa4, 0xa4, 0xa4, 0x96, 0x85, 0x74, 0x94, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x33, 0x4f, 0x68, 0x7f, 0x95, 0xa8, 0xa1, 0x93, 0x88, 0x84, 0x84, 0x86, 0x8f, 0x9b, 0x9d, 0x87, 0x94, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x27, 0x43, 0x5f, 0x7a, 0x92, 0xab, 0x9d, 0x87, 0x78, 0x6b, 0x64, 0x64, 0x69, 0x73, 0x81, 0x95, 0xa1, 0xa6, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x14, 0x32, 0x50, 0x6d, 0x88, 0xa3, 0xa1, 0x87, 0x71, 0x5d, 0x4e, 0x45, 0x44, 0x4b, 0x57, 0x69, 0x7f, 0x98, 0xb2, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3b, 0x5a, 0x78, 0x94, 0xae, 0x91, 0x77, 0x5d, 0x44, 0x31, 0x26, 0x25, 0x2d, 0x3d, 0x54, 0x6e, 0x88, 0xa4, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x22, 0x41, 0x60, 0x80, 0x9c, 0xa4, 0x86, 0x6a, 0x4d, 0x31, 0x17, 0x07, 0x05, 0x11, 0x28, 0x43, 0x60, 0x7d, 0x9b, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa3, 0xa0, 0x80, 0x63, 0x44, 0x24, 0x06, 0x00, 0x00, 0x00, 0x1a, 0x39, 0x58, 0x78, 0x95, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa3, 0xa0, 0x80, 0x61, 0x43, 0x24, 0x06, 0x00, 0x00, 0x00, 0x1a, 0x39, 0x58, 0x78, 0x94, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x22, 0x41, 0x60, 0x80, 0x9c, 0xa4, 0x86, 0x6a, 0x4c, 0x30, 0x17, 0x06, 0x03, 0x0f, 0x27, 0x43, 0x60, 0x7d, 0x9b, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3b, 0x5a, 0x78, 0x95, 0xae, 0x91, 0x76, 0x5c, 0x44, 0x30, 0x24, 0x22, 0x2a, 0x3c, 0x53, 0x6d, 0x88, 0xa4, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x33, 0x51, 0x6d, 0x88, 0xa4, 0xa0, 0x87, 0x6f, 0x5c, 0x4c, 0x44, 0x41, 0x48, 0x55, 0x69, 0x7f, 0x97, 0xb2, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x27, 0x43, 0x5f, 0x7b, 0x94, 0xac, 0x9a, 0x87, 0x76, 0x6a, 0x63, 0x60, 0x66, 0x71, 0x80, 0x95, 0x9f, 0xa1, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x35, 0x50, 0x69, 0x81, 0x96, 0xaa, 0xa0, 0x91, 0x86, 0x80, 0x80, 0x84, 0x8c, 0x9a, 0xa0, 0x87, 0x90, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x24, 0x3c, 0x55, 0x6b, 0x7f, 0x8f, 0x9f, 0xa9, 0xa4, 0xa0, 0xa0, 0xa3, 0xa6, 0x98, 0x87, 0x74, 0x90, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0x3f, 0x52, 0x66, 0x76, 0x81, 0x8b, 0x93, 0x94, 0x94, 0x90, 0x88, 0x7d, 0x6e, 0x70, 0x8f, 0x90, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x26, 0x3a, 0x4b, 0x5a, 0x65, 0x6f, 0x74, 0x75, 0x74, 0x73, 0x6c, 0x61, 0x53, 0x69, 0x70, 0x70, 0x70, 0x66, 0x49, 0x2b, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x2f, 0x3d, 0x47, 0x50, 0x54, 0x57, 0x56, 0x54, 0x4d, 0x44, 0x3c, 0x4d, 0x50, 0x50, 0x50, 0x4c, 0x39, 0x1f, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x13, 0x1f, 0x29, 0x31, 0x35, 0x38, 0x37, 0x34, 0x2f, 0x26, 0x23, 0x2f, 0x31, 0x31, 0x31, 0x2e, 0x21, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0b, 0x12, 0x15, 0x18, 0x18, 0x15, 0x0f, 0x08, 0x06, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0065 "e" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0f, 0x14, 0x15, 0x15, 0x13, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x1d, 0x27, 0x2f, 0x33, 0x35, 0x35, 0x32, 0x2d, 0x24, 0x1a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x1d, 0x2c, 0x3a, 0x46, 0x4d, 0x52, 0x54, 0x54, 0x50, 0x4b, 0x42, 0x36, 0x28, 0x18, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x25, 0x38, 0x48, 0x56, 0x64, 0x6c, 0x70, 0x74, 0x74, 0x70, 0x6a, 0x60, 0x53, 0x44, 0x31, 0x1d, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x25, 0x3c, 0x51, 0x63, 0x73, 0x80, 0x88, 0x90, 0x94, 0x94, 0x8f, 0x86, 0x7d, 0x6f, 0x5d, 0x4a, 0x33, 0x1d, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x22, 0x3b, 0x52, 0x69, 0x7c, 0x8d, 0x9b, 0xa7, 0xa1, 0xa0, 0xa0, 0xa4, 0xa4, 0x98, 0x88, 0x77, 0x60, 0x4a, 0x31, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x33, 0x4e, 0x66, 0x7f, 0x95, 0xa8, 0x9a, 0x8c, 0x84, 0x80, 0x80, 0x85, 0x90, 0xa0, 0xa1, 0x8c, 0x77, 0x5d, 0x44, 0x28, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x25, 0x41, 0x5e, 0x79, 0x92, 0xaa, 0x95, 0x81, 0x71, 0x66, 0x60, 0x61, 0x68, 0x76, 0x87, 0x9d, 0xa1, 0x88, 0x6f, 0x53, 0x36, 0x1a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x14, 0x32, 0x4f, 0x6c, 0x86, 0xa2, 0x9a, 0x81, 0x69, 0x56, 0x48, 0x40, 0x43, 0x4c, 0x5c, 0x71, 0x88, 0xa2, 0x98, 0x7d, 0x61, 0x43, 0x25, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3b, 0x5a, 0x78, 0x94, 0xa9, 0x8c, 0x71, 0x55, 0x44, 0x44, 0x44, 0x44, 0x44, 0x46, 0x5e, 0x78, 0x94, 0xa5, 0x88, 0x6b, 0x4c, 0x2e, 0x0f, 0x00, 0x00,
+    0x00, 0x03, 0x22, 0x41, 0x60, 0x7f, 0x9c, 0xa0, 0x81, 0x66, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x6d, 0x8b, 0xa9, 0x90, 0x73, 0x54, 0x34, 0x15, 0x00, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa3, 0xa0, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x8a, 0xa8, 0x94, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xae, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa3, 0xa0, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x76, 0x58, 0x38, 0x19, 0x00, 0x00,
+    0x00, 0x03, 0x22, 0x41, 0x60, 0x80, 0x9c, 0xa1, 0x84, 0x66, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5d, 0x4a, 0x2f, 0x12, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3b, 0x5a, 0x78, 0x94, 0xab, 0x8d, 0x74, 0x5a, 0x43, 0x40, 0x40, 0x40, 0x40, 0x40, 0x42, 0x55, 0x60, 0x52, 0x41, 0x3f, 0x32, 0x1d, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x14, 0x32, 0x4f, 0x6c, 0x87, 0xa2, 0x9d, 0x84, 0x6e, 0x5c, 0x4d, 0x44, 0x40, 0x44, 0x4c, 0x5a, 0x6c, 0x7f, 0x69, 0x51, 0x39, 0x1f, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x26, 0x43, 0x5e, 0x79, 0x92, 0xaa, 0x9a, 0x87, 0x77, 0x6b, 0x64, 0x60, 0x64, 0x6a, 0x75, 0x84, 0x95, 0x7c, 0x66, 0x4b, 0x2f, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x33, 0x4e, 0x66, 0x7f, 0x94, 0xa6, 0xa1, 0x91, 0x88, 0x81, 0x80, 0x80, 0x88, 0x91, 0x9f, 0xa3, 0x8c, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x22, 0x3a, 0x52, 0x69, 0x7c, 0x8c, 0x9b, 0xa6, 0xa5, 0xa0, 0xa0, 0xa0, 0xa5, 0xa5, 0x98, 0x89, 0x77, 0x60, 0x49, 0x2e, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x25, 0x3c, 0x50, 0x63, 0x73, 0x7f, 0x88, 0x90, 0x94, 0x95, 0x94, 0x90, 0x88, 0x7d, 0x6f, 0x5f, 0x4a, 0x33, 0x1d, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x24, 0x36, 0x48, 0x56, 0x63, 0x6c, 0x71, 0x74, 0x78, 0x74, 0x70, 0x6b, 0x61, 0x53, 0x45, 0x33, 0x1d, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1c, 0x2c, 0x39, 0x44, 0x4d, 0x53, 0x54, 0x58, 0x54, 0x52, 0x4c, 0x43, 0x36, 0x28, 0x19, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x1c, 0x26, 0x2f, 0x34, 0x35, 0x39, 0x35, 0x33, 0x2e, 0x25, 0x1a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0f, 0x14, 0x16, 0x19, 0x15, 0x14, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0066 "f" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0d, 0x0d, 0x0d, 0x0c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x1d, 0x27, 0x2d, 0x2d, 0x2d, 0x2c, 0x26, 0x1c, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x2e, 0x3c, 0x46, 0x4c, 0x4c, 0x4c, 0x4b, 0x44, 0x39, 0x2a, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x20, 0x34, 0x48, 0x58, 0x64, 0x6c, 0x6c, 0x6c, 0x6a, 0x63, 0x56, 0x44, 0x2d, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x33, 0x4c, 0x60, 0x74, 0x80, 0x88, 0x8c, 0x8c, 0x88, 0x7f, 0x71, 0x58, 0x3a, 0x1b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0d, 0x2a, 0x46, 0x60, 0x78, 0x8c, 0x9d, 0xa7, 0xa4, 0xa4, 0xa5, 0x95, 0x7a, 0x5c, 0x3c, 0x1d, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x36, 0x53, 0x71, 0x8a, 0xa3, 0xa0, 0x8d, 0x84, 0x84, 0x8a, 0x8a, 0x6d, 0x51, 0x33, 0x16, 0x00,
+    0x00, 0x00, 0x00, 0x0c, 0x20, 0x40, 0x5f, 0x7c, 0x98, 0xa6, 0x8a, 0x74, 0x66, 0x64, 0x6d, 0x7b, 0x63, 0x45, 0x28, 0x0a, 0x00,
+    0x00, 0x03, 0x1a, 0x2a, 0x31, 0x44, 0x64, 0x81, 0xa0, 0x9d, 0x80, 0x63, 0x48, 0x46, 0x52, 0x5c, 0x4f, 0x38, 0x1c, 0x00, 0x00,
+    0x00, 0x15, 0x30, 0x46, 0x50, 0x50, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x50, 0x50, 0x50, 0x4f, 0x41, 0x29, 0x0e, 0x00, 0x00,
+    0x00, 0x1f, 0x3e, 0x5c, 0x70, 0x70, 0x70, 0x84, 0xa4, 0x9c, 0x7c, 0x70, 0x70, 0x70, 0x70, 0x6d, 0x55, 0x36, 0x17, 0x00, 0x00,
+    0x01, 0x21, 0x40, 0x60, 0x80, 0x90, 0x90, 0x91, 0xa8, 0xa1, 0x90, 0x90, 0x90, 0x90, 0x90, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00,
+    0x01, 0x21, 0x40, 0x60, 0x80, 0xa0, 0xa4, 0xa4, 0xb3, 0xae, 0xa4, 0xa4, 0xa4, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00,
+    0x01, 0x21, 0x40, 0x60, 0x80, 0x84, 0x84, 0x87, 0xa4, 0x9c, 0x84, 0x84, 0x84, 0x84, 0x84, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00,
+    0x00, 0x1c, 0x3a, 0x55, 0x64, 0x64, 0x65, 0x84, 0xa4, 0x9c, 0x7c, 0x64, 0x64, 0x64, 0x64, 0x63, 0x4f, 0x33, 0x15, 0x00, 0x00,
+    0x00, 0x0f, 0x28, 0x3c, 0x44, 0x45, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x44, 0x44, 0x44, 0x44, 0x38, 0x22, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x1f, 0x26, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x25, 0x25, 0x24, 0x1c, 0x0b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x90, 0x90, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x23, 0x42, 0x5f, 0x70, 0x70, 0x70, 0x6f, 0x58, 0x3a, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x48, 0x50, 0x50, 0x50, 0x50, 0x44, 0x2d, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x1c, 0x2b, 0x31, 0x31, 0x31, 0x30, 0x28, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0067 "g" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0f, 0x14, 0x15, 0x15, 0x13, 0x0f, 0x07, 0x03, 0x0e, 0x11, 0x11, 0x11, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x1d, 0x27, 0x2f, 0x33, 0x35, 0x35, 0x33, 0x2e, 0x25, 0x1e, 0x2d, 0x31, 0x31, 0x31, 0x2f, 0x25, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x2e, 0x3c, 0x46, 0x4d, 0x52, 0x54, 0x54, 0x51, 0x4c, 0x43, 0x38, 0x4a, 0x50, 0x50, 0x50, 0x4e, 0x3f, 0x26, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x27, 0x3a, 0x4a, 0x58, 0x64, 0x6c, 0x70, 0x74, 0x74, 0x70, 0x6b, 0x61, 0x55, 0x63, 0x70, 0x70, 0x70, 0x6b, 0x51, 0x33, 0x13, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x28, 0x3f, 0x53, 0x66, 0x74, 0x80, 0x88, 0x90, 0x94, 0x94, 0x90, 0x88, 0x7f, 0x71, 0x68, 0x88, 0x90, 0x90, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x25, 0x3f, 0x55, 0x6b, 0x7f, 0x8f, 0x9d, 0xa7, 0xa7, 0xa4, 0xa4, 0xa4, 0xa5, 0x9a, 0x8a, 0x78, 0x88, 0xa8, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1b, 0x36, 0x51, 0x6b, 0x81, 0x97, 0xaa, 0x9f, 0x91, 0x88, 0x84, 0x84, 0x84, 0x8b, 0x98, 0xa2, 0x8d, 0x88, 0xa8, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x29, 0x46, 0x61, 0x7c, 0x95, 0xad, 0x9a, 0x86, 0x76, 0x6b, 0x64, 0x64, 0x67, 0x6f, 0x7d, 0x8d, 0xa1, 0x9d, 0xb1, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x34, 0x52, 0x6f, 0x8b, 0xa6, 0x9d, 0x84, 0x6e, 0x5b, 0x4d, 0x46, 0x44, 0x48, 0x53, 0x63, 0x77, 0x8f, 0xa9, 0xb4, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1e, 0x3d, 0x5c, 0x7a, 0x96, 0xab, 0x8d, 0x74, 0x5a, 0x42, 0x2f, 0x27, 0x25, 0x29, 0x37, 0x4a, 0x65, 0x7f, 0x9a, 0xb4, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x24, 0x44, 0x63, 0x80, 0x9f, 0xa3, 0x84, 0x67, 0x49, 0x2e, 0x16, 0x08, 0x05, 0x0c, 0x1e, 0x39, 0x56, 0x74, 0x90, 0xb0, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x41, 0x22, 0x03, 0x00, 0x00, 0x00, 0x10, 0x2f, 0x4e, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x02, 0x00, 0x00, 0x00, 0x0f, 0x2f, 0x4d, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x80, 0xa0, 0xa1, 0x84, 0x66, 0x48, 0x2c, 0x12, 0x02, 0x00, 0x07, 0x1d, 0x37, 0x55, 0x73, 0x90, 0xaf, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x3f, 0x5d, 0x7b, 0x98, 0xaa, 0x8d, 0x73, 0x57, 0x3f, 0x2c, 0x21, 0x1e, 0x25, 0x33, 0x49, 0x63, 0x7d, 0x99, 0xb3, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x36, 0x55, 0x71, 0x8d, 0xa9, 0x9b, 0x81, 0x6b, 0x57, 0x48, 0x40, 0x3d, 0x43, 0x4e, 0x5f, 0x74, 0x8c, 0xa6, 0xb4, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x2b, 0x48, 0x65, 0x7f, 0x97, 0xad, 0x97, 0x81, 0x73, 0x66, 0x60, 0x5c, 0x61, 0x6b, 0x79, 0x89, 0xa0, 0xaa, 0xb4, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x1e, 0x39, 0x54, 0x6d, 0x84, 0x9a, 0xac, 0x9b, 0x8d, 0x84, 0x7f, 0x7c, 0x80, 0x86, 0x93, 0xa2, 0x92, 0x8f, 0xad, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0e, 0x28, 0x41, 0x58, 0x6e, 0x81, 0x93, 0xa1, 0xa9, 0xa1, 0x9c, 0x9c, 0x9f, 0xa4, 0x9f, 0x8d, 0x7c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x14, 0x2b, 0x41, 0x57, 0x6a, 0x7a, 0x85, 0x8f, 0x94, 0x98, 0x98, 0x94, 0x8c, 0x83, 0x74, 0x70, 0x90, 0xae, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x23, 0x36, 0x41, 0x4f, 0x5d, 0x68, 0x71, 0x78, 0x78, 0x78, 0x76, 0x70, 0x66, 0x5a, 0x73, 0x90, 0xae, 0x90, 0x71, 0x53, 0x34, 0x14, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1a, 0x35, 0x4f, 0x60, 0x57, 0x46, 0x4b, 0x53, 0x58, 0x58, 0x58, 0x58, 0x52, 0x48, 0x5e, 0x7a, 0x97, 0xa9, 0x8b, 0x6c, 0x4e, 0x2f, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x2a, 0x46, 0x60, 0x7b, 0x71, 0x61, 0x53, 0x48, 0x40, 0x3d, 0x3b, 0x3e, 0x46, 0x56, 0x6d, 0x86, 0xa2, 0xa0, 0x83, 0x66, 0x48, 0x29, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x1f, 0x3c, 0x56, 0x71, 0x8a, 0x8a, 0x7c, 0x70, 0x66, 0x60, 0x5c, 0x59, 0x5c, 0x64, 0x71, 0x81, 0x97, 0xad, 0x93, 0x78, 0x5c, 0x3e, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x28, 0x48, 0x66, 0x81, 0x9a, 0xa5, 0x98, 0x8c, 0x84, 0x7d, 0x7b, 0x78, 0x7c, 0x81, 0x8c, 0x9a, 0xad, 0x9a, 0x81, 0x6a, 0x4e, 0x31, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x26, 0x44, 0x60, 0x77, 0x87, 0x96, 0xa1, 0xa9, 0xa1, 0x9c, 0x98, 0x98, 0x9c, 0xa0, 0xa8, 0xa4, 0x95, 0x84, 0x6e, 0x57, 0x3e, 0x23, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1a, 0x33, 0x4a, 0x5d, 0x6d, 0x7a, 0x84, 0x8c, 0x94, 0x98, 0x9c, 0x9c, 0x9c, 0x97, 0x90, 0x86, 0x7b, 0x6b, 0x58, 0x41, 0x2b, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x1d, 0x31, 0x43, 0x51, 0x5d, 0x67, 0x70, 0x75, 0x7a, 0x7c, 0x7c, 0x7c, 0x78, 0x74, 0x6b, 0x5f, 0x51, 0x3f, 0x2b, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x17, 0x27, 0x34, 0x3f, 0x49, 0x51, 0x57, 0x5c, 0x5c, 0x5c, 0x5c, 0x59, 0x54, 0x4d, 0x42, 0x35, 0x25, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x17, 0x21, 0x2b, 0x33, 0x38, 0x3c, 0x3d, 0x3d, 0x3d, 0x3a, 0x35, 0x2f, 0x25, 0x18, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x13, 0x18, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x17, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0068 "h" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x09, 0x09, 0x09, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x1e, 0x28, 0x29, 0x29, 0x29, 0x27, 0x1c, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x22, 0x39, 0x47, 0x48, 0x48, 0x48, 0x46, 0x36, 0x1e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x12, 0x30, 0x4e, 0x65, 0x68, 0x68, 0x68, 0x63, 0x4a, 0x2d, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x88, 0x88, 0x88, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xa8, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x14, 0x15, 0x15, 0x13, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x2e, 0x33, 0x35, 0x35, 0x33, 0x2d, 0x25, 0x1a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x44, 0x4c, 0x52, 0x54, 0x54, 0x51, 0x4c, 0x43, 0x36, 0x28, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x55, 0x63, 0x6c, 0x70, 0x74, 0x74, 0x70, 0x6b, 0x61, 0x53, 0x42, 0x2e, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x71, 0x7f, 0x88, 0x90, 0x94, 0x94, 0x8f, 0x88, 0x7d, 0x6e, 0x5b, 0x44, 0x2e, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x78, 0x8a, 0x9a, 0xa6, 0xa4, 0xa4, 0xa5, 0xab, 0xa5, 0x98, 0x86, 0x71, 0x5b, 0x41, 0x27, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x91, 0x8c, 0xa2, 0x95, 0x8b, 0x85, 0x84, 0x88, 0x8f, 0x9d, 0xaf, 0x9d, 0x85, 0x6d, 0x51, 0x35, 0x17, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb4, 0xa8, 0xa2, 0x8c, 0x7b, 0x6f, 0x68, 0x64, 0x69, 0x73, 0x84, 0x9a, 0xb0, 0x96, 0x7b, 0x5e, 0x41, 0x22, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb4, 0xaa, 0x8f, 0x77, 0x60, 0x51, 0x48, 0x44, 0x4b, 0x58, 0x6e, 0x87, 0xa3, 0xa2, 0x84, 0x67, 0x48, 0x2a, 0x0b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb4, 0x9c, 0x80, 0x65, 0x4a, 0x35, 0x29, 0x25, 0x2d, 0x43, 0x5f, 0x7c, 0x99, 0xaa, 0x8c, 0x6c, 0x4d, 0x2f, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb2, 0x94, 0x76, 0x58, 0x3a, 0x1e, 0x0b, 0x06, 0x18, 0x37, 0x56, 0x74, 0x94, 0xaf, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x52, 0x33, 0x14, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xaf, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xaf, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x90, 0x90, 0x8f, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x90, 0x90, 0x8f, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x33, 0x51, 0x6b, 0x70, 0x70, 0x70, 0x69, 0x4d, 0x2f, 0x0f, 0x00, 0x00, 0x13, 0x33, 0x51, 0x6b, 0x70, 0x70, 0x70, 0x69, 0x4d, 0x2f, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x26, 0x3f, 0x4e, 0x50, 0x50, 0x50, 0x4d, 0x3c, 0x23, 0x06, 0x00, 0x00, 0x0a, 0x26, 0x3f, 0x4e, 0x50, 0x50, 0x50, 0x4d, 0x3c, 0x23, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x25, 0x2f, 0x31, 0x31, 0x31, 0x2f, 0x23, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x12, 0x25, 0x2f, 0x31, 0x31, 0x31, 0x2f, 0x23, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x11, 0x11, 0x11, 0x0f, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x11, 0x11, 0x11, 0x0f, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0069 "i" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0e, 0x17, 0x19, 0x17, 0x0e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x1d, 0x2c, 0x36, 0x39, 0x35, 0x2c, 0x1c, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x20, 0x36, 0x48, 0x55, 0x58, 0x54, 0x48, 0x33, 0x1d, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x32, 0x4c, 0x63, 0x73, 0x78, 0x73, 0x60, 0x4a, 0x2f, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x21, 0x3f, 0x5d, 0x78, 0x8d, 0x97, 0x8c, 0x76, 0x5a, 0x3d, 0x1e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa1, 0xb5, 0x9f, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x80, 0x9a, 0xa8, 0x97, 0x7d, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1d, 0x3a, 0x56, 0x6e, 0x81, 0x88, 0x80, 0x6b, 0x53, 0x36, 0x1a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x2a, 0x41, 0x57, 0x66, 0x68, 0x65, 0x55, 0x3f, 0x27, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x24, 0x3c, 0x4d, 0x50, 0x50, 0x50, 0x4d, 0x3c, 0x23, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x32, 0x4f, 0x69, 0x70, 0x70, 0x70, 0x69, 0x4d, 0x2f, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x90, 0x90, 0x8f, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xaf, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xaf, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x90, 0x90, 0x8f, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x33, 0x51, 0x6b, 0x70, 0x70, 0x70, 0x69, 0x4d, 0x2f, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x26, 0x3f, 0x4e, 0x50, 0x50, 0x50, 0x4d, 0x3c, 0x23, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x25, 0x2f, 0x31, 0x31, 0x31, 0x2f, 0x23, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x11, 0x11, 0x11, 0x0f, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+006A "j" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x19, 0x17, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1a, 0x2a, 0x34, 0x39, 0x36, 0x2e, 0x1e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1c, 0x33, 0x46, 0x53, 0x58, 0x55, 0x4a, 0x39, 0x22, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x2e, 0x48, 0x60, 0x71, 0x78, 0x74, 0x65, 0x4f, 0x34, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3a, 0x58, 0x74, 0x8a, 0x96, 0x8f, 0x7a, 0x5f, 0x42, 0x23, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0x9c, 0xb5, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3f, 0x5d, 0x7c, 0x97, 0xa7, 0x9b, 0x81, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x36, 0x53, 0x6b, 0x80, 0x88, 0x83, 0x71, 0x57, 0x3c, 0x1f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x27, 0x3f, 0x55, 0x64, 0x68, 0x66, 0x58, 0x44, 0x2c, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1f, 0x39, 0x4c, 0x50, 0x50, 0x50, 0x4e, 0x3f, 0x26, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2b, 0x49, 0x66, 0x70, 0x70, 0x70, 0x6b, 0x51, 0x33, 0x13, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0x90, 0x90, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x0f, 0x10, 0x0d, 0x2d, 0x4c, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x23, 0x2f, 0x2f, 0x25, 0x2e, 0x4c, 0x6c, 0x8c, 0xac, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x23, 0x3c, 0x4d, 0x4e, 0x3f, 0x39, 0x51, 0x70, 0x90, 0xae, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x13, 0x30, 0x4e, 0x69, 0x6b, 0x5c, 0x58, 0x60, 0x7a, 0x95, 0xab, 0x8d, 0x70, 0x51, 0x33, 0x13, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x1f, 0x3d, 0x5a, 0x76, 0x85, 0x7b, 0x78, 0x7c, 0x8c, 0xa3, 0x9f, 0x83, 0x67, 0x49, 0x2b, 0x0d, 0x00, 0x00, 0x00, 0x00,
+    0x0b, 0x2a, 0x48, 0x66, 0x81, 0x9e, 0x98, 0x98, 0x99, 0xa4, 0xa3, 0x8c, 0x76, 0x5a, 0x3e, 0x21, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x0d, 0x2d, 0x4c, 0x6c, 0x84, 0x91, 0x98, 0x9c, 0x9b, 0x94, 0x88, 0x77, 0x63, 0x4a, 0x2f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x26, 0x43, 0x5a, 0x6a, 0x74, 0x7b, 0x7c, 0x7c, 0x78, 0x6d, 0x5f, 0x4a, 0x36, 0x1d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x16, 0x2d, 0x3f, 0x4d, 0x56, 0x5c, 0x5c, 0x5c, 0x58, 0x50, 0x43, 0x33, 0x1e, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x13, 0x23, 0x2f, 0x37, 0x3c, 0x3d, 0x3d, 0x39, 0x32, 0x27, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x11, 0x18, 0x1d, 0x1d, 0x1d, 0x1a, 0x14, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+006B "k" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x09, 0x09, 0x09, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x1e, 0x28, 0x29, 0x29, 0x29, 0x27, 0x1c, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x22, 0x39, 0x47, 0x48, 0x48, 0x48, 0x46, 0x36, 0x1e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x12, 0x30, 0x4e, 0x65, 0x68, 0x68, 0x68, 0x63, 0x4a, 0x2d, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x88, 0x88, 0x88, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xa8, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x03, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0f, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x0c, 0x1e, 0x2d, 0x31, 0x31, 0x31, 0x31, 0x2e, 0x21, 0x0c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x0c, 0x23, 0x39, 0x4a, 0x50, 0x50, 0x50, 0x50, 0x4c, 0x39, 0x1f, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x0f, 0x25, 0x39, 0x4f, 0x65, 0x70, 0x70, 0x70, 0x70, 0x66, 0x49, 0x2b, 0x0c, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x13, 0x26, 0x3c, 0x52, 0x66, 0x7c, 0x8f, 0x90, 0x90, 0x7f, 0x68, 0x4b, 0x2c, 0x0c, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x28, 0x3f, 0x52, 0x69, 0x7d, 0x92, 0xa7, 0x95, 0x7f, 0x69, 0x52, 0x3c, 0x21, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x3f, 0x55, 0x6b, 0x7f, 0x95, 0xa7, 0x95, 0x7f, 0x69, 0x52, 0x3c, 0x25, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x41, 0x58, 0x6b, 0x81, 0x96, 0xaa, 0x95, 0x7f, 0x69, 0x52, 0x3c, 0x25, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x5a, 0x6e, 0x84, 0x97, 0xaa, 0x95, 0x7f, 0x69, 0x52, 0x3c, 0x25, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x5b, 0x71, 0x84, 0x9a, 0xa8, 0x94, 0x7f, 0x69, 0x52, 0x3c, 0x25, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x73, 0x87, 0x9d, 0xad, 0x92, 0x7c, 0x69, 0x52, 0x3c, 0x25, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x74, 0x89, 0x9d, 0xb2, 0xad, 0x8f, 0x78, 0x60, 0x47, 0x2e, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x91, 0x8a, 0xa0, 0xa3, 0x94, 0xa3, 0xa3, 0x8a, 0x74, 0x5b, 0x42, 0x28, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb4, 0xa8, 0xa6, 0xa1, 0x8c, 0x79, 0x8f, 0xa8, 0x9d, 0x86, 0x6e, 0x55, 0x3c, 0x24, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb4, 0xb6, 0xa0, 0x89, 0x77, 0x66, 0x7d, 0x95, 0xad, 0x98, 0x81, 0x69, 0x50, 0x37, 0x1e, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb3, 0x9d, 0x89, 0x74, 0x5d, 0x52, 0x69, 0x81, 0x9a, 0xac, 0x94, 0x7c, 0x63, 0x4a, 0x32, 0x1a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x71, 0x5d, 0x47, 0x3d, 0x55, 0x6e, 0x86, 0x9d, 0xa6, 0x8f, 0x77, 0x5e, 0x46, 0x2d, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x29, 0x42, 0x5b, 0x74, 0x8a, 0xa3, 0xa2, 0x89, 0x71, 0x58, 0x40, 0x28, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x16, 0x2e, 0x47, 0x60, 0x78, 0x8f, 0xa8, 0x9d, 0x84, 0x6c, 0x54, 0x3b, 0x22, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xaf, 0x90, 0x70, 0x50, 0x31, 0x11, 0x1a, 0x33, 0x4c, 0x65, 0x7c, 0x94, 0xac, 0x97, 0x7f, 0x66, 0x4f, 0x35, 0x1a, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x90, 0x90, 0x8f, 0x70, 0x50, 0x31, 0x11, 0x07, 0x20, 0x39, 0x50, 0x69, 0x81, 0x90, 0x90, 0x8f, 0x7a, 0x61, 0x43, 0x24, 0x04,
+    0x00, 0x00, 0x00, 0x13, 0x33, 0x51, 0x6b, 0x70, 0x70, 0x70, 0x69, 0x4d, 0x2f, 0x0f, 0x00, 0x0c, 0x24, 0x3c, 0x55, 0x6b, 0x70, 0x70, 0x70, 0x70, 0x5f, 0x42, 0x23, 0x04,
+    0x00, 0x00, 0x00, 0x0a, 0x26, 0x3f, 0x4e, 0x50, 0x50, 0x50, 0x4d, 0x3c, 0x23, 0x06, 0x00, 0x00, 0x10, 0x28, 0x3f, 0x4e, 0x50, 0x50, 0x50, 0x50, 0x48, 0x33, 0x18, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x25, 0x2f, 0x31, 0x31, 0x31, 0x2f, 0x23, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x12, 0x25, 0x2f, 0x31, 0x31, 0x31, 0x31, 0x2b, 0x1c, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x11, 0x11, 0x11, 0x0f, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x11, 0x11, 0x11, 0x11, 0x0d, 0x01, 0x00, 0x00,
+
+    /* U+006C "l" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x09, 0x09, 0x09, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x1e, 0x28, 0x29, 0x29, 0x29, 0x27, 0x1c, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x22, 0x39, 0x47, 0x48, 0x48, 0x48, 0x46, 0x36, 0x1e, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x12, 0x30, 0x4e, 0x65, 0x68, 0x68, 0x68, 0x63, 0x4a, 0x2d, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x88, 0x88, 0x88, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xa8, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xaf, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x90, 0x90, 0x8f, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x33, 0x51, 0x6b, 0x70, 0x70, 0x70, 0x69, 0x4d, 0x2f, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x26, 0x3f, 0x4e, 0x50, 0x50, 0x50, 0x4d, 0x3c, 0x23, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x25, 0x2f, 0x31, 0x31, 0x31, 0x2f, 0x23, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x11, 0x11, 0x11, 0x0f, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+006D "m" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x05, 0x09, 0x10, 0x15, 0x15, 0x15, 0x12, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0e, 0x13, 0x15, 0x15, 0x14, 0x0f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x23, 0x2f, 0x31, 0x31, 0x31, 0x2e, 0x21, 0x28, 0x2f, 0x34, 0x35, 0x35, 0x31, 0x2b, 0x21, 0x15, 0x06, 0x0c, 0x1a, 0x25, 0x2d, 0x33, 0x35, 0x35, 0x33, 0x2f, 0x26, 0x1c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x24, 0x3c, 0x4d, 0x50, 0x50, 0x50, 0x4c, 0x3c, 0x46, 0x4e, 0x54, 0x54, 0x54, 0x50, 0x49, 0x3f, 0x31, 0x21, 0x28, 0x36, 0x43, 0x4b, 0x51, 0x54, 0x54, 0x52, 0x4d, 0x44, 0x38, 0x2a, 0x18, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x32, 0x4f, 0x69, 0x70, 0x70, 0x70, 0x66, 0x58, 0x64, 0x6c, 0x73, 0x74, 0x74, 0x70, 0x67, 0x5c, 0x4c, 0x3b, 0x45, 0x53, 0x61, 0x6a, 0x70, 0x74, 0x74, 0x70, 0x6c, 0x63, 0x55, 0x44, 0x31, 0x1a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x90, 0x90, 0x8c, 0x6c, 0x74, 0x80, 0x8a, 0x90, 0x94, 0x93, 0x8c, 0x84, 0x78, 0x66, 0x52, 0x5e, 0x6f, 0x7d, 0x88, 0x8f, 0x94, 0x94, 0x90, 0x88, 0x7f, 0x71, 0x5d, 0x47, 0x31, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xac, 0x8c, 0x79, 0x8c, 0x9d, 0xa6, 0xa4, 0xa4, 0xa8, 0xab, 0xa1, 0x91, 0x7f, 0x69, 0x77, 0x89, 0x98, 0xa5, 0xa5, 0xa4, 0xa4, 0xaa, 0xa6, 0x9a, 0x88, 0x74, 0x5d, 0x44, 0x28, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xac, 0x8c, 0x8f, 0xa2, 0x94, 0x8a, 0x84, 0x84, 0x88, 0x93, 0xa3, 0xab, 0x93, 0x7b, 0x8c, 0xa2, 0x9b, 0x8f, 0x88, 0x84, 0x86, 0x8c, 0x9a, 0xae, 0xa0, 0x88, 0x6f, 0x53, 0x36, 0x1a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb3, 0xa3, 0x9f, 0x89, 0x79, 0x6c, 0x66, 0x65, 0x6c, 0x79, 0x8c, 0xa3, 0xa4, 0x90, 0xa0, 0x95, 0x81, 0x73, 0x69, 0x64, 0x68, 0x71, 0x81, 0x97, 0xaf, 0x98, 0x7d, 0x61, 0x43, 0x24, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb4, 0xa8, 0x8d, 0x74, 0x5f, 0x4f, 0x48, 0x47, 0x4e, 0x60, 0x7a, 0x94, 0xb1, 0xb0, 0x9b, 0x81, 0x6b, 0x56, 0x4b, 0x44, 0x49, 0x55, 0x6b, 0x85, 0xa1, 0xa4, 0x86, 0x6a, 0x4b, 0x2c, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb4, 0x9b, 0x80, 0x63, 0x49, 0x33, 0x28, 0x28, 0x34, 0x4f, 0x6c, 0x88, 0xa7, 0xad, 0x8f, 0x73, 0x57, 0x3f, 0x2d, 0x25, 0x2a, 0x3f, 0x5c, 0x7a, 0x96, 0xac, 0x8d, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb1, 0x94, 0x76, 0x58, 0x3a, 0x1d, 0x09, 0x09, 0x27, 0x46, 0x64, 0x84, 0xa4, 0xa4, 0x86, 0x69, 0x4b, 0x2d, 0x12, 0x06, 0x16, 0x35, 0x54, 0x74, 0x90, 0xae, 0x90, 0x70, 0x51, 0x33, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x51, 0x33, 0x13, 0x00, 0x04, 0x23, 0x42, 0x60, 0x80, 0xa0, 0xa0, 0x81, 0x64, 0x44, 0x25, 0x05, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xaf, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0xa0, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xb0, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0xa0, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xb0, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0xa0, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xb0, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0xa0, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xb0, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0xa0, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xb0, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0xa0, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xb0, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0xa0, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xb0, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xaf, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0xa0, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xaf, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x90, 0x90, 0x8f, 0x70, 0x50, 0x31, 0x11, 0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0x90, 0x90, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x11, 0x31, 0x50, 0x70, 0x8f, 0x90, 0x90, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x33, 0x51, 0x6b, 0x70, 0x70, 0x70, 0x69, 0x4d, 0x2f, 0x0f, 0x00, 0x00, 0x1f, 0x3e, 0x5c, 0x70, 0x70, 0x70, 0x70, 0x5c, 0x3e, 0x1f, 0x00, 0x00, 0x0f, 0x2f, 0x4d, 0x69, 0x70, 0x70, 0x70, 0x6b, 0x51, 0x33, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x26, 0x3f, 0x4e, 0x50, 0x50, 0x50, 0x4d, 0x3c, 0x23, 0x06, 0x00, 0x00, 0x15, 0x30, 0x46, 0x50, 0x50, 0x50, 0x50, 0x46, 0x30, 0x15, 0x00, 0x00, 0x06, 0x23, 0x3c, 0x4d, 0x50, 0x50, 0x50, 0x4e, 0x3f, 0x26, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x25, 0x2f, 0x31, 0x31, 0x31, 0x2f, 0x23, 0x0f, 0x00, 0x00, 0x00, 0x03, 0x1a, 0x2a, 0x31, 0x31, 0x31, 0x31, 0x2a, 0x1a, 0x03, 0x00, 0x00, 0x00, 0x0f, 0x23, 0x2f, 0x31, 0x31, 0x31, 0x2f, 0x25, 0x12, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x11, 0x11, 0x11, 0x0f, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x11, 0x11, 0x11, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+006E "n" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x05, 0x08, 0x0f, 0x14, 0x15, 0x15, 0x13, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x23, 0x2f, 0x31, 0x31, 0x31, 0x2e, 0x21, 0x26, 0x2f, 0x33, 0x35, 0x35, 0x33, 0x2d, 0x25, 0x1a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x24, 0x3c, 0x4d, 0x50, 0x50, 0x50, 0x4c, 0x3b, 0x44, 0x4d, 0x52, 0x54, 0x54, 0x51, 0x4c, 0x43, 0x36, 0x28, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x32, 0x4f, 0x69, 0x70, 0x70, 0x70, 0x66, 0x56, 0x63, 0x6c, 0x70, 0x74, 0x74, 0x70, 0x6b, 0x61, 0x53, 0x42, 0x2e, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x90, 0x90, 0x8c, 0x6c, 0x73, 0x80, 0x88, 0x90, 0x94, 0x94, 0x8f, 0x88, 0x7d, 0x6e, 0x5b, 0x44, 0x2e, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xac, 0x8c, 0x79, 0x8c, 0x9b, 0xa6, 0xa4, 0xa4, 0xa5, 0xab, 0xa5, 0x98, 0x86, 0x71, 0x5b, 0x41, 0x27, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xac, 0x8c, 0x8d, 0xa2, 0x95, 0x8b, 0x85, 0x84, 0x88, 0x8f, 0x9d, 0xaf, 0x9d, 0x85, 0x6d, 0x51, 0x35, 0x17, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb3, 0xa3, 0xa2, 0x8c, 0x7b, 0x6f, 0x68, 0x64, 0x69, 0x73, 0x84, 0x9a, 0xb0, 0x96, 0x7b, 0x5e, 0x41, 0x22, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb4, 0xaa, 0x8f, 0x77, 0x60, 0x51, 0x48, 0x44, 0x4b, 0x58, 0x6e, 0x87, 0xa3, 0xa2, 0x84, 0x67, 0x48, 0x2a, 0x0b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb4, 0x9c, 0x80, 0x65, 0x4a, 0x35, 0x29, 0x25, 0x2d, 0x43, 0x5f, 0x7c, 0x99, 0xaa, 0x8c, 0x6c, 0x4d, 0x2f, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb2, 0x94, 0x76, 0x58, 0x3a, 0x1e, 0x0b, 0x06, 0x18, 0x37, 0x56, 0x74, 0x94, 0xaf, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x52, 0x33, 0x14, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xaf, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xaf, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x90, 0x90, 0x8f, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x90, 0x90, 0x8f, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x33, 0x51, 0x6b, 0x70, 0x70, 0x70, 0x69, 0x4d, 0x2f, 0x0f, 0x00, 0x00, 0x13, 0x33, 0x51, 0x6b, 0x70, 0x70, 0x70, 0x69, 0x4d, 0x2f, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x26, 0x3f, 0x4e, 0x50, 0x50, 0x50, 0x4d, 0x3c, 0x23, 0x06, 0x00, 0x00, 0x0a, 0x26, 0x3f, 0x4e, 0x50, 0x50, 0x50, 0x4d, 0x3c, 0x23, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x25, 0x2f, 0x31, 0x31, 0x31, 0x2f, 0x23, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x12, 0x25, 0x2f, 0x31, 0x31, 0x31, 0x2f, 0x23, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x11, 0x11, 0x11, 0x0f, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x11, 0x11, 0x11, 0x0f, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+006F "o" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x13, 0x15, 0x15, 0x14, 0x10, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1b, 0x25, 0x2d, 0x32, 0x35, 0x35, 0x34, 0x2f, 0x28, 0x1f, 0x13, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1b, 0x2a, 0x38, 0x43, 0x4c, 0x50, 0x54, 0x54, 0x53, 0x4e, 0x47, 0x3c, 0x2f, 0x21, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x23, 0x35, 0x46, 0x55, 0x61, 0x6b, 0x70, 0x74, 0x74, 0x71, 0x6c, 0x65, 0x5a, 0x4c, 0x3b, 0x28, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x23, 0x39, 0x4f, 0x61, 0x71, 0x7f, 0x88, 0x8f, 0x94, 0x94, 0x90, 0x8a, 0x81, 0x76, 0x66, 0x55, 0x41, 0x2b, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x21, 0x39, 0x4f, 0x66, 0x7b, 0x8c, 0x9a, 0xa5, 0xa6, 0xa4, 0xa4, 0xa4, 0xa8, 0x9d, 0x91, 0x80, 0x6e, 0x58, 0x41, 0x28, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x32, 0x4c, 0x66, 0x7c, 0x92, 0xa5, 0xa1, 0x93, 0x88, 0x84, 0x84, 0x86, 0x8f, 0x9b, 0xaa, 0x98, 0x84, 0x6d, 0x55, 0x3b, 0x1f, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x25, 0x41, 0x5e, 0x78, 0x91, 0xa8, 0x9d, 0x87, 0x78, 0x6b, 0x64, 0x64, 0x69, 0x73, 0x81, 0x95, 0xab, 0x97, 0x80, 0x66, 0x4a, 0x2e, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x14, 0x31, 0x4e, 0x6c, 0x86, 0xa2, 0xa1, 0x87, 0x71, 0x5d, 0x4e, 0x45, 0x44, 0x4b, 0x56, 0x69, 0x7f, 0x98, 0xab, 0x8f, 0x74, 0x58, 0x3a, 0x1c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1b, 0x3a, 0x59, 0x78, 0x93, 0xae, 0x91, 0x77, 0x5d, 0x44, 0x31, 0x26, 0x25, 0x2d, 0x3d, 0x54, 0x6e, 0x88, 0xa4, 0x9c, 0x80, 0x63, 0x44, 0x26, 0x07, 0x00, 0x00,
+    0x00, 0x03, 0x22, 0x41, 0x60, 0x7f, 0x9c, 0xa4, 0x86, 0x6a, 0x4d, 0x31, 0x17, 0x07, 0x05, 0x11, 0x28, 0x43, 0x60, 0x7d, 0x9b, 0xa6, 0x88, 0x6a, 0x4b, 0x2c, 0x0c, 0x00, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa3, 0xa0, 0x80, 0x63, 0x44, 0x24, 0x06, 0x00, 0x00, 0x00, 0x1a, 0x39, 0x58, 0x78, 0x95, 0xac, 0x8c, 0x6f, 0x50, 0x30, 0x11, 0x00, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa3, 0xa0, 0x80, 0x61, 0x43, 0x24, 0x06, 0x00, 0x00, 0x00, 0x1a, 0x39, 0x58, 0x78, 0x94, 0xac, 0x8c, 0x6f, 0x50, 0x30, 0x11, 0x00, 0x00,
+    0x00, 0x03, 0x22, 0x41, 0x60, 0x80, 0x9c, 0xa4, 0x86, 0x6a, 0x4c, 0x30, 0x17, 0x06, 0x03, 0x0f, 0x27, 0x43, 0x60, 0x7d, 0x9b, 0xa6, 0x88, 0x6b, 0x4c, 0x2c, 0x0d, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3b, 0x5a, 0x78, 0x94, 0xad, 0x91, 0x76, 0x5c, 0x44, 0x30, 0x24, 0x22, 0x2a, 0x3c, 0x53, 0x6d, 0x88, 0xa4, 0x9d, 0x80, 0x64, 0x45, 0x26, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x14, 0x32, 0x4f, 0x6c, 0x86, 0xa2, 0xa0, 0x87, 0x6f, 0x5c, 0x4c, 0x44, 0x41, 0x48, 0x55, 0x69, 0x7f, 0x97, 0xab, 0x8f, 0x75, 0x58, 0x3c, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x25, 0x41, 0x5e, 0x79, 0x92, 0xaa, 0x9a, 0x87, 0x76, 0x6a, 0x63, 0x60, 0x66, 0x71, 0x80, 0x95, 0xab, 0x9a, 0x80, 0x66, 0x4b, 0x2f, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x33, 0x4e, 0x66, 0x7f, 0x93, 0xa6, 0xa0, 0x91, 0x86, 0x80, 0x80, 0x84, 0x8c, 0x9a, 0xaa, 0x9a, 0x84, 0x6e, 0x55, 0x3b, 0x20, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x22, 0x3a, 0x52, 0x69, 0x7c, 0x8c, 0x9b, 0xa8, 0xa4, 0xa0, 0xa0, 0xa3, 0xa8, 0xa0, 0x92, 0x81, 0x6e, 0x58, 0x41, 0x29, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x25, 0x3c, 0x4f, 0x63, 0x73, 0x80, 0x8a, 0x90, 0x94, 0x94, 0x93, 0x8c, 0x83, 0x78, 0x68, 0x56, 0x41, 0x2b, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x23, 0x36, 0x48, 0x56, 0x64, 0x6c, 0x74, 0x74, 0x76, 0x74, 0x70, 0x67, 0x5c, 0x4e, 0x3d, 0x2a, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1c, 0x2c, 0x3a, 0x46, 0x4e, 0x54, 0x55, 0x58, 0x54, 0x50, 0x48, 0x3e, 0x31, 0x22, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x1d, 0x28, 0x2f, 0x35, 0x36, 0x38, 0x35, 0x31, 0x2a, 0x21, 0x15, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x15, 0x17, 0x19, 0x15, 0x12, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0070 "p" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x05, 0x07, 0x0f, 0x14, 0x15, 0x15, 0x13, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x23, 0x2f, 0x31, 0x31, 0x31, 0x2e, 0x21, 0x26, 0x2e, 0x33, 0x35, 0x35, 0x33, 0x2e, 0x25, 0x1b, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x24, 0x3c, 0x4d, 0x50, 0x50, 0x50, 0x4c, 0x3a, 0x44, 0x4c, 0x52, 0x54, 0x54, 0x51, 0x4c, 0x43, 0x38, 0x2a, 0x1a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x32, 0x4f, 0x69, 0x70, 0x70, 0x70, 0x66, 0x55, 0x61, 0x6b, 0x70, 0x74, 0x74, 0x70, 0x6b, 0x61, 0x55, 0x46, 0x34, 0x22, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x90, 0x90, 0x8c, 0x6c, 0x6f, 0x7f, 0x88, 0x90, 0x94, 0x94, 0x90, 0x88, 0x7f, 0x71, 0x60, 0x4e, 0x39, 0x23, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xac, 0x8c, 0x77, 0x89, 0x9a, 0xa6, 0xa4, 0xa4, 0xa4, 0xa8, 0xa5, 0x9a, 0x8a, 0x79, 0x66, 0x4f, 0x37, 0x1d, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xac, 0x8c, 0x8c, 0xa2, 0x9a, 0x8d, 0x84, 0x84, 0x84, 0x8a, 0x94, 0xa4, 0xa4, 0x92, 0x7c, 0x63, 0x49, 0x2f, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb2, 0x9f, 0xa1, 0x92, 0x80, 0x71, 0x67, 0x64, 0x65, 0x6d, 0x7a, 0x8c, 0xa0, 0xa6, 0x8d, 0x74, 0x5a, 0x3e, 0x21, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb4, 0xaf, 0x94, 0x7c, 0x66, 0x55, 0x49, 0x44, 0x47, 0x50, 0x60, 0x74, 0x8c, 0xa5, 0x9f, 0x83, 0x68, 0x4b, 0x2d, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb4, 0xa1, 0x85, 0x6a, 0x50, 0x3b, 0x2b, 0x25, 0x28, 0x34, 0x48, 0x61, 0x7b, 0x96, 0xad, 0x8f, 0x73, 0x55, 0x36, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb2, 0x96, 0x78, 0x5c, 0x3f, 0x24, 0x0f, 0x05, 0x09, 0x1c, 0x35, 0x52, 0x6f, 0x8c, 0xaa, 0x98, 0x7a, 0x5c, 0x3c, 0x1d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x71, 0x53, 0x34, 0x16, 0x00, 0x00, 0x00, 0x0c, 0x2a, 0x49, 0x68, 0x85, 0xa4, 0x9c, 0x7d, 0x60, 0x40, 0x21, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x52, 0x33, 0x15, 0x00, 0x00, 0x00, 0x0b, 0x2a, 0x49, 0x68, 0x85, 0xa4, 0x9c, 0x7f, 0x60, 0x40, 0x21, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb2, 0x95, 0x78, 0x5b, 0x3e, 0x23, 0x0c, 0x02, 0x07, 0x1a, 0x35, 0x51, 0x6f, 0x8c, 0xaa, 0x98, 0x7a, 0x5c, 0x3c, 0x1d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb4, 0x9f, 0x83, 0x69, 0x4f, 0x39, 0x29, 0x21, 0x25, 0x33, 0x47, 0x60, 0x7b, 0x96, 0xad, 0x8f, 0x74, 0x55, 0x36, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb4, 0xad, 0x93, 0x7a, 0x65, 0x53, 0x47, 0x40, 0x44, 0x4e, 0x5f, 0x74, 0x8a, 0xa4, 0x9f, 0x83, 0x68, 0x4b, 0x2e, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb4, 0xa4, 0xa2, 0x8f, 0x7d, 0x6f, 0x65, 0x60, 0x64, 0x6b, 0x79, 0x89, 0xa0, 0xa8, 0x8f, 0x76, 0x5a, 0x3e, 0x21, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x8a, 0xa2, 0x98, 0x8b, 0x84, 0x80, 0x80, 0x88, 0x93, 0xa3, 0xa6, 0x92, 0x7c, 0x65, 0x4a, 0x2f, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x77, 0x89, 0x9a, 0xa6, 0xa1, 0xa0, 0xa0, 0xa5, 0xa8, 0x9b, 0x8c, 0x7c, 0x66, 0x4f, 0x39, 0x1e, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x71, 0x7f, 0x8a, 0x91, 0x94, 0x94, 0x90, 0x8a, 0x80, 0x73, 0x63, 0x4f, 0x39, 0x23, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x55, 0x63, 0x6c, 0x74, 0x75, 0x74, 0x74, 0x6c, 0x64, 0x56, 0x48, 0x36, 0x23, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x46, 0x4e, 0x54, 0x57, 0x55, 0x54, 0x4e, 0x46, 0x3a, 0x2c, 0x1c, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x2f, 0x35, 0x38, 0x36, 0x35, 0x2f, 0x28, 0x1d, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x12, 0x15, 0x18, 0x17, 0x15, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0x98, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x14, 0x33, 0x52, 0x6e, 0x78, 0x78, 0x78, 0x6d, 0x4f, 0x30, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0c, 0x28, 0x41, 0x55, 0x58, 0x58, 0x58, 0x55, 0x41, 0x27, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x29, 0x36, 0x39, 0x39, 0x39, 0x36, 0x29, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x17, 0x19, 0x19, 0x19, 0x17, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0071 "q" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0f, 0x14, 0x15, 0x15, 0x13, 0x0e, 0x06, 0x06, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x1d, 0x27, 0x2f, 0x33, 0x35, 0x35, 0x32, 0x2d, 0x24, 0x23, 0x2f, 0x31, 0x31, 0x31, 0x2e, 0x21, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1d, 0x2e, 0x3a, 0x46, 0x4d, 0x52, 0x54, 0x54, 0x50, 0x4b, 0x42, 0x3c, 0x4d, 0x50, 0x50, 0x50, 0x4c, 0x39, 0x1f, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x25, 0x38, 0x48, 0x58, 0x64, 0x6c, 0x70, 0x74, 0x74, 0x70, 0x6a, 0x5f, 0x51, 0x69, 0x70, 0x70, 0x70, 0x66, 0x49, 0x2b, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x25, 0x3c, 0x52, 0x63, 0x74, 0x80, 0x88, 0x90, 0x94, 0x94, 0x8f, 0x86, 0x7b, 0x6d, 0x70, 0x8f, 0x90, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x22, 0x3c, 0x52, 0x69, 0x7d, 0x8d, 0x9c, 0xa7, 0xa6, 0xa4, 0xa4, 0xa4, 0xa4, 0x96, 0x86, 0x72, 0x90, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x33, 0x4f, 0x68, 0x7f, 0x95, 0xa8, 0xa1, 0x93, 0x88, 0x84, 0x84, 0x86, 0x8f, 0x9d, 0x9d, 0x87, 0x90, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x27, 0x43, 0x5f, 0x7a, 0x92, 0xab, 0x9d, 0x87, 0x78, 0x6b, 0x64, 0x64, 0x69, 0x74, 0x81, 0x95, 0x9f, 0xa1, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x14, 0x32, 0x50, 0x6d, 0x88, 0xa3, 0xa1, 0x87, 0x71, 0x5d, 0x4e, 0x45, 0x44, 0x4b, 0x58, 0x6b, 0x81, 0x98, 0xb4, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3b, 0x5a, 0x78, 0x94, 0xae, 0x91, 0x77, 0x5d, 0x44, 0x31, 0x26, 0x25, 0x2e, 0x3f, 0x55, 0x6f, 0x88, 0xa5, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x22, 0x41, 0x60, 0x80, 0x9c, 0xa4, 0x86, 0x6a, 0x4d, 0x31, 0x17, 0x07, 0x05, 0x12, 0x29, 0x44, 0x61, 0x7f, 0x9b, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa3, 0xa0, 0x80, 0x63, 0x44, 0x24, 0x06, 0x00, 0x00, 0x00, 0x1b, 0x39, 0x58, 0x78, 0x95, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa3, 0xa0, 0x80, 0x61, 0x43, 0x24, 0x06, 0x00, 0x00, 0x00, 0x1a, 0x39, 0x58, 0x78, 0x94, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x22, 0x41, 0x60, 0x80, 0x9c, 0xa4, 0x86, 0x6a, 0x4c, 0x30, 0x17, 0x06, 0x03, 0x0f, 0x27, 0x43, 0x60, 0x7d, 0x9b, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3b, 0x5a, 0x78, 0x95, 0xae, 0x91, 0x76, 0x5c, 0x44, 0x30, 0x24, 0x22, 0x2a, 0x3c, 0x53, 0x6d, 0x88, 0xa4, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x33, 0x51, 0x6d, 0x88, 0xa4, 0xa0, 0x87, 0x6f, 0x5c, 0x4c, 0x44, 0x41, 0x48, 0x55, 0x69, 0x7f, 0x97, 0xb2, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x27, 0x43, 0x5f, 0x7b, 0x94, 0xac, 0x9a, 0x87, 0x76, 0x6a, 0x63, 0x60, 0x66, 0x71, 0x80, 0x95, 0xa1, 0xa6, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x35, 0x50, 0x69, 0x81, 0x96, 0xaa, 0xa0, 0x91, 0x86, 0x80, 0x80, 0x84, 0x8c, 0x9a, 0x9d, 0x87, 0x94, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x24, 0x3c, 0x55, 0x6b, 0x7f, 0x8f, 0x9f, 0xa9, 0xa4, 0xa0, 0xa0, 0xa3, 0xa5, 0x97, 0x86, 0x74, 0x94, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0x3f, 0x52, 0x66, 0x76, 0x81, 0x8b, 0x93, 0x94, 0x94, 0x90, 0x88, 0x7d, 0x6d, 0x74, 0x94, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x26, 0x3a, 0x4b, 0x5a, 0x65, 0x6f, 0x74, 0x75, 0x74, 0x73, 0x6b, 0x61, 0x55, 0x74, 0x94, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x2f, 0x3d, 0x47, 0x50, 0x54, 0x57, 0x56, 0x54, 0x4d, 0x43, 0x54, 0x74, 0x94, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x13, 0x1f, 0x29, 0x31, 0x35, 0x38, 0x37, 0x34, 0x2f, 0x35, 0x54, 0x74, 0x94, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0b, 0x12, 0x15, 0x18, 0x18, 0x15, 0x15, 0x35, 0x54, 0x74, 0x94, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0x98, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x34, 0x53, 0x71, 0x78, 0x78, 0x78, 0x6a, 0x4b, 0x2c, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2a, 0x44, 0x56, 0x58, 0x58, 0x58, 0x53, 0x3e, 0x23, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x2c, 0x37, 0x39, 0x39, 0x39, 0x35, 0x27, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x18, 0x19, 0x19, 0x19, 0x17, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0072 "r" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x05, 0x08, 0x0f, 0x14, 0x15, 0x13, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x23, 0x2f, 0x31, 0x31, 0x31, 0x2e, 0x21, 0x27, 0x2f, 0x33, 0x35, 0x33, 0x26, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x24, 0x3c, 0x4d, 0x50, 0x50, 0x50, 0x4c, 0x3b, 0x46, 0x4d, 0x52, 0x54, 0x51, 0x3f, 0x25, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x32, 0x4f, 0x69, 0x70, 0x70, 0x70, 0x66, 0x56, 0x63, 0x6c, 0x70, 0x74, 0x6b, 0x4e, 0x2f, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x90, 0x90, 0x8c, 0x6c, 0x71, 0x80, 0x88, 0x90, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xac, 0x8c, 0x77, 0x8a, 0x9b, 0xa7, 0xab, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xac, 0x8c, 0x89, 0xa3, 0x9b, 0x90, 0x8c, 0x8c, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb1, 0x9b, 0x9d, 0x91, 0x80, 0x74, 0x6c, 0x6c, 0x66, 0x4c, 0x2e, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb4, 0xad, 0x92, 0x7a, 0x66, 0x56, 0x4d, 0x4c, 0x49, 0x39, 0x21, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb4, 0x9f, 0x83, 0x68, 0x4f, 0x3a, 0x2f, 0x2d, 0x2b, 0x1f, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb2, 0x95, 0x78, 0x5b, 0x3e, 0x22, 0x10, 0x0d, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x73, 0x54, 0x34, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xaf, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x90, 0x90, 0x8f, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x33, 0x51, 0x6b, 0x70, 0x70, 0x70, 0x69, 0x4d, 0x2f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x26, 0x3f, 0x4e, 0x50, 0x50, 0x50, 0x4d, 0x3c, 0x23, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x25, 0x2f, 0x31, 0x31, 0x31, 0x2f, 0x23, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x11, 0x11, 0x11, 0x0f, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0073 "s" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x12, 0x15, 0x15, 0x15, 0x11, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1b, 0x25, 0x2d, 0x31, 0x35, 0x35, 0x35, 0x31, 0x2c, 0x26, 0x1d, 0x13, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x1a, 0x2a, 0x38, 0x43, 0x4c, 0x50, 0x54, 0x54, 0x54, 0x50, 0x4b, 0x44, 0x3c, 0x2f, 0x21, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x1d, 0x33, 0x46, 0x55, 0x61, 0x6b, 0x70, 0x74, 0x74, 0x74, 0x70, 0x6a, 0x63, 0x5a, 0x4c, 0x3d, 0x28, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x1b, 0x33, 0x4a, 0x60, 0x71, 0x7f, 0x88, 0x8f, 0x93, 0x94, 0x90, 0x8d, 0x88, 0x80, 0x76, 0x68, 0x55, 0x3a, 0x1c, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x2c, 0x47, 0x60, 0x77, 0x8a, 0x9a, 0xa5, 0xa4, 0xa0, 0xa0, 0xa0, 0xa4, 0xa6, 0x9d, 0x91, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00,
+    0x00, 0x00, 0x1c, 0x3a, 0x56, 0x73, 0x8c, 0xa3, 0xa0, 0x8f, 0x85, 0x80, 0x80, 0x81, 0x86, 0x8f, 0x9a, 0x8c, 0x73, 0x56, 0x3a, 0x1c, 0x00, 0x00,
+    0x00, 0x04, 0x24, 0x43, 0x61, 0x80, 0x9b, 0xa4, 0x89, 0x76, 0x68, 0x63, 0x60, 0x64, 0x69, 0x73, 0x7f, 0x7f, 0x63, 0x48, 0x2c, 0x0f, 0x00, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5f, 0x4b, 0x44, 0x40, 0x44, 0x4b, 0x55, 0x63, 0x67, 0x54, 0x38, 0x1c, 0x01, 0x00, 0x00,
+    0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x80, 0x66, 0x57, 0x4f, 0x48, 0x43, 0x3c, 0x39, 0x46, 0x48, 0x3d, 0x28, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x24, 0x43, 0x61, 0x80, 0x9b, 0xa9, 0x92, 0x80, 0x75, 0x6d, 0x68, 0x61, 0x5c, 0x54, 0x4c, 0x41, 0x31, 0x20, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3a, 0x56, 0x73, 0x8c, 0xa0, 0xaa, 0x9b, 0x91, 0x8b, 0x85, 0x80, 0x7a, 0x73, 0x6a, 0x5d, 0x4c, 0x36, 0x20, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x2c, 0x47, 0x60, 0x74, 0x86, 0x94, 0x9c, 0xa4, 0xa7, 0xa4, 0x9d, 0x97, 0x90, 0x85, 0x78, 0x63, 0x4d, 0x34, 0x1a, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x1b, 0x33, 0x49, 0x5c, 0x6c, 0x78, 0x7f, 0x84, 0x8b, 0x90, 0x95, 0x9c, 0xa8, 0xa1, 0x8f, 0x79, 0x60, 0x44, 0x26, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x14, 0x29, 0x36, 0x41, 0x4f, 0x59, 0x60, 0x67, 0x6c, 0x71, 0x78, 0x80, 0x8c, 0xa3, 0xa4, 0x88, 0x6c, 0x4e, 0x2f, 0x10, 0x00,
+    0x00, 0x00, 0x0a, 0x27, 0x41, 0x55, 0x56, 0x46, 0x3b, 0x42, 0x48, 0x4d, 0x53, 0x5a, 0x63, 0x77, 0x91, 0xae, 0x90, 0x74, 0x54, 0x35, 0x15, 0x00,
+    0x00, 0x00, 0x1a, 0x35, 0x51, 0x6d, 0x71, 0x61, 0x55, 0x4b, 0x45, 0x40, 0x40, 0x45, 0x53, 0x70, 0x90, 0xae, 0x93, 0x74, 0x54, 0x35, 0x15, 0x00,
+    0x00, 0x0c, 0x28, 0x45, 0x61, 0x7b, 0x8c, 0x7f, 0x73, 0x6a, 0x64, 0x60, 0x60, 0x64, 0x6c, 0x7f, 0x98, 0xa9, 0x8b, 0x6f, 0x50, 0x31, 0x12, 0x00,
+    0x00, 0x17, 0x35, 0x53, 0x6f, 0x8a, 0xa5, 0x9a, 0x8f, 0x88, 0x83, 0x80, 0x80, 0x81, 0x88, 0x96, 0xaa, 0x97, 0x7f, 0x65, 0x47, 0x29, 0x0b, 0x00,
+    0x00, 0x18, 0x38, 0x57, 0x74, 0x85, 0x93, 0x9f, 0xa7, 0xa6, 0xa0, 0xa0, 0xa0, 0xa0, 0xa6, 0xa1, 0x93, 0x81, 0x6b, 0x54, 0x3a, 0x1e, 0x01, 0x00,
+    0x00, 0x11, 0x2e, 0x47, 0x5b, 0x6a, 0x78, 0x81, 0x88, 0x90, 0x94, 0x94, 0x94, 0x93, 0x8c, 0x84, 0x78, 0x69, 0x55, 0x3f, 0x28, 0x0e, 0x00, 0x00,
+    0x00, 0x02, 0x1a, 0x2f, 0x3f, 0x4e, 0x5a, 0x64, 0x6c, 0x70, 0x74, 0x78, 0x74, 0x74, 0x6f, 0x67, 0x5c, 0x4e, 0x3d, 0x28, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x14, 0x23, 0x31, 0x3d, 0x46, 0x4d, 0x52, 0x54, 0x58, 0x55, 0x54, 0x50, 0x49, 0x3f, 0x31, 0x23, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x14, 0x1f, 0x27, 0x2f, 0x33, 0x35, 0x39, 0x36, 0x35, 0x31, 0x2b, 0x21, 0x15, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0f, 0x14, 0x15, 0x19, 0x17, 0x15, 0x12, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0074 "t" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x20, 0x25, 0x25, 0x25, 0x25, 0x1d, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x2b, 0x3e, 0x44, 0x44, 0x44, 0x44, 0x3a, 0x25, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x20, 0x3e, 0x58, 0x64, 0x64, 0x64, 0x64, 0x52, 0x36, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0c, 0x25, 0x44, 0x64, 0x83, 0x84, 0x84, 0x7c, 0x5c, 0x3d, 0x1d, 0x11, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x1a, 0x2a, 0x31, 0x44, 0x64, 0x84, 0xa3, 0x9c, 0x7c, 0x5c, 0x3d, 0x31, 0x31, 0x30, 0x27, 0x14, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x15, 0x30, 0x46, 0x50, 0x50, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x50, 0x50, 0x50, 0x4f, 0x41, 0x29, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x1f, 0x3e, 0x5c, 0x70, 0x70, 0x70, 0x84, 0xa4, 0x9c, 0x7c, 0x70, 0x70, 0x70, 0x70, 0x6d, 0x55, 0x36, 0x17, 0x00, 0x00, 0x00,
+    0x01, 0x21, 0x40, 0x60, 0x80, 0x90, 0x90, 0x91, 0xa8, 0xa1, 0x90, 0x90, 0x90, 0x90, 0x90, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00,
+    0x01, 0x21, 0x40, 0x60, 0x80, 0xa0, 0xa4, 0xa4, 0xb3, 0xae, 0xa4, 0xa4, 0xa4, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00,
+    0x01, 0x21, 0x40, 0x60, 0x80, 0x84, 0x84, 0x87, 0xa4, 0x9c, 0x84, 0x84, 0x84, 0x84, 0x84, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00,
+    0x00, 0x1c, 0x3a, 0x55, 0x64, 0x64, 0x65, 0x84, 0xa4, 0x9c, 0x7c, 0x64, 0x64, 0x64, 0x64, 0x63, 0x4f, 0x33, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x28, 0x3c, 0x44, 0x45, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x44, 0x44, 0x44, 0x44, 0x38, 0x22, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x1f, 0x26, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x25, 0x25, 0x24, 0x1c, 0x0b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x12, 0x15, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x9c, 0x7c, 0x5d, 0x3f, 0x22, 0x30, 0x35, 0x2e, 0x1d, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x61, 0x44, 0x40, 0x4e, 0x54, 0x49, 0x33, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x23, 0x42, 0x60, 0x80, 0x9c, 0xa5, 0x88, 0x71, 0x60, 0x60, 0x68, 0x74, 0x5f, 0x43, 0x26, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1c, 0x3b, 0x5a, 0x76, 0x91, 0xac, 0x9d, 0x88, 0x7f, 0x7d, 0x84, 0x88, 0x6c, 0x4f, 0x33, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x2f, 0x4c, 0x68, 0x81, 0x96, 0xa6, 0xa4, 0x9c, 0x9c, 0xa1, 0x94, 0x78, 0x5b, 0x3c, 0x1c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x21, 0x3c, 0x55, 0x6b, 0x7d, 0x8a, 0x93, 0x94, 0x94, 0x8d, 0x83, 0x74, 0x5a, 0x3b, 0x1c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0x3f, 0x52, 0x61, 0x6d, 0x74, 0x76, 0x74, 0x70, 0x67, 0x5a, 0x47, 0x2f, 0x13, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x26, 0x36, 0x45, 0x4f, 0x54, 0x58, 0x54, 0x52, 0x49, 0x3e, 0x2e, 0x1a, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1a, 0x28, 0x30, 0x35, 0x38, 0x35, 0x33, 0x2b, 0x21, 0x13, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x12, 0x15, 0x19, 0x17, 0x14, 0x0d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0075 "u" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x11, 0x11, 0x11, 0x0e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x14, 0x27, 0x30, 0x31, 0x31, 0x31, 0x2d, 0x1e, 0x09, 0x00, 0x00, 0x00, 0x00, 0x17, 0x28, 0x30, 0x31, 0x31, 0x31, 0x2d, 0x1e, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0e, 0x29, 0x41, 0x4f, 0x50, 0x50, 0x50, 0x4a, 0x36, 0x1d, 0x01, 0x00, 0x00, 0x11, 0x2d, 0x44, 0x50, 0x50, 0x50, 0x50, 0x4a, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x36, 0x55, 0x6d, 0x70, 0x70, 0x70, 0x63, 0x48, 0x2a, 0x0b, 0x00, 0x00, 0x1b, 0x3a, 0x58, 0x6f, 0x70, 0x70, 0x70, 0x63, 0x46, 0x27, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x90, 0x90, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x90, 0x90, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9c, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9c, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9c, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9c, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9c, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9c, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9c, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9c, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x1f, 0x3e, 0x5c, 0x7c, 0x9c, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4e, 0x2f, 0x11, 0x05, 0x0d, 0x27, 0x44, 0x63, 0x80, 0xa0, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x36, 0x55, 0x74, 0x94, 0xaf, 0x91, 0x75, 0x57, 0x3b, 0x28, 0x25, 0x29, 0x39, 0x52, 0x6d, 0x88, 0xa6, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x32, 0x50, 0x6f, 0x8c, 0xaa, 0x9b, 0x80, 0x66, 0x52, 0x47, 0x44, 0x48, 0x53, 0x66, 0x7d, 0x96, 0xb2, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0b, 0x2a, 0x48, 0x65, 0x81, 0x9d, 0xab, 0x92, 0x7f, 0x6d, 0x65, 0x64, 0x66, 0x6f, 0x7f, 0x92, 0xa4, 0xac, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x1f, 0x3c, 0x58, 0x74, 0x8c, 0xa3, 0xa9, 0x96, 0x8a, 0x84, 0x81, 0x84, 0x8b, 0x98, 0x9d, 0x87, 0x99, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x2e, 0x48, 0x60, 0x77, 0x8c, 0x9b, 0xa8, 0xa8, 0xa4, 0xa0, 0xa4, 0xa5, 0x98, 0x87, 0x78, 0x98, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x1c, 0x33, 0x4a, 0x60, 0x73, 0x80, 0x8a, 0x91, 0x94, 0x94, 0x90, 0x88, 0x7d, 0x6e, 0x78, 0x90, 0x90, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x33, 0x47, 0x56, 0x65, 0x6d, 0x74, 0x74, 0x75, 0x74, 0x6c, 0x61, 0x55, 0x6d, 0x70, 0x70, 0x70, 0x63, 0x46, 0x27, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1b, 0x2c, 0x3a, 0x47, 0x4f, 0x54, 0x56, 0x57, 0x54, 0x4e, 0x44, 0x41, 0x4f, 0x50, 0x50, 0x50, 0x4a, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x1e, 0x28, 0x30, 0x35, 0x37, 0x38, 0x35, 0x2f, 0x26, 0x27, 0x30, 0x31, 0x31, 0x31, 0x2d, 0x1e, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x09, 0x11, 0x15, 0x18, 0x18, 0x15, 0x10, 0x08, 0x09, 0x10, 0x11, 0x11, 0x11, 0x0e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0076 "v" */
+    0x00, 0x00, 0x00, 0x06, 0x0f, 0x11, 0x11, 0x11, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x11, 0x11, 0x11, 0x0f, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x23, 0x2f, 0x31, 0x31, 0x31, 0x2f, 0x25, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x25, 0x2f, 0x31, 0x31, 0x31, 0x2e, 0x21, 0x0c, 0x00,
+    0x00, 0x06, 0x23, 0x3c, 0x4d, 0x50, 0x50, 0x50, 0x4e, 0x3f, 0x27, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x26, 0x3f, 0x4e, 0x50, 0x50, 0x50, 0x4c, 0x39, 0x1f, 0x03,
+    0x00, 0x0f, 0x2f, 0x4d, 0x69, 0x70, 0x70, 0x70, 0x6b, 0x53, 0x35, 0x18, 0x00, 0x00, 0x00, 0x00, 0x17, 0x35, 0x51, 0x6b, 0x70, 0x70, 0x70, 0x66, 0x49, 0x2b, 0x0c,
+    0x00, 0x11, 0x30, 0x50, 0x6f, 0x8a, 0x90, 0x90, 0x7b, 0x5f, 0x42, 0x25, 0x08, 0x00, 0x00, 0x07, 0x24, 0x41, 0x5e, 0x7b, 0x90, 0x90, 0x86, 0x6a, 0x4b, 0x2c, 0x0c,
+    0x00, 0x0b, 0x28, 0x45, 0x61, 0x7f, 0x9a, 0xa4, 0x86, 0x6c, 0x4e, 0x31, 0x15, 0x00, 0x00, 0x14, 0x31, 0x4e, 0x6a, 0x86, 0xa2, 0x96, 0x7a, 0x5e, 0x41, 0x24, 0x06,
+    0x00, 0x00, 0x1b, 0x38, 0x55, 0x73, 0x8d, 0xaa, 0x93, 0x78, 0x5b, 0x3e, 0x21, 0x03, 0x03, 0x20, 0x3e, 0x5a, 0x78, 0x93, 0xa6, 0x8a, 0x6d, 0x51, 0x34, 0x17, 0x00,
+    0x00, 0x00, 0x0e, 0x2c, 0x48, 0x65, 0x81, 0x9d, 0x9f, 0x83, 0x67, 0x4a, 0x2e, 0x10, 0x10, 0x2e, 0x4a, 0x66, 0x83, 0x9f, 0x9a, 0x7d, 0x61, 0x45, 0x28, 0x0a, 0x00,
+    0x00, 0x00, 0x01, 0x1f, 0x3c, 0x58, 0x76, 0x91, 0xaa, 0x8f, 0x74, 0x56, 0x3a, 0x1c, 0x1c, 0x3a, 0x56, 0x74, 0x8f, 0xa9, 0x8d, 0x71, 0x55, 0x38, 0x1a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x12, 0x2f, 0x4c, 0x68, 0x85, 0xa1, 0x9b, 0x80, 0x63, 0x46, 0x29, 0x2a, 0x46, 0x63, 0x80, 0x9b, 0x9d, 0x80, 0x65, 0x48, 0x2b, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x23, 0x3f, 0x5c, 0x7a, 0x94, 0xa8, 0x8b, 0x6f, 0x53, 0x35, 0x36, 0x53, 0x70, 0x8c, 0xa8, 0x91, 0x75, 0x58, 0x3c, 0x1e, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x33, 0x4f, 0x6c, 0x88, 0xa4, 0x98, 0x7b, 0x5f, 0x42, 0x43, 0x5f, 0x7c, 0x98, 0xa1, 0x84, 0x68, 0x4c, 0x2f, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x26, 0x43, 0x60, 0x7d, 0x98, 0xa4, 0x86, 0x6c, 0x4e, 0x4f, 0x6c, 0x88, 0xa4, 0x94, 0x78, 0x5c, 0x3f, 0x21, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x36, 0x53, 0x70, 0x8c, 0xa8, 0x93, 0x78, 0x5b, 0x5c, 0x78, 0x94, 0xa4, 0x88, 0x6c, 0x4f, 0x33, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2a, 0x46, 0x64, 0x80, 0x9b, 0x9f, 0x83, 0x67, 0x68, 0x85, 0xa1, 0x98, 0x7c, 0x5f, 0x43, 0x25, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3a, 0x56, 0x74, 0x8f, 0xaa, 0x8f, 0x74, 0x75, 0x91, 0xa8, 0x8b, 0x6f, 0x53, 0x36, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2e, 0x4a, 0x67, 0x83, 0x9f, 0x9b, 0x80, 0x81, 0x9d, 0x9b, 0x80, 0x63, 0x46, 0x29, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x3e, 0x5a, 0x78, 0x93, 0xa8, 0x8b, 0x8d, 0xa9, 0x8f, 0x73, 0x56, 0x3a, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x31, 0x4e, 0x6b, 0x86, 0xa2, 0x9f, 0xa1, 0x9f, 0x83, 0x66, 0x4a, 0x2d, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x25, 0x41, 0x5e, 0x7b, 0x96, 0xb0, 0xae, 0x93, 0x76, 0x5a, 0x3e, 0x20, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x35, 0x51, 0x6f, 0x8a, 0x90, 0x90, 0x86, 0x6a, 0x4e, 0x30, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x28, 0x45, 0x60, 0x70, 0x70, 0x70, 0x70, 0x5d, 0x41, 0x24, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x33, 0x48, 0x50, 0x50, 0x50, 0x50, 0x46, 0x30, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1c, 0x2b, 0x31, 0x31, 0x31, 0x31, 0x2a, 0x1a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0077 "w" */
+    0x00, 0x00, 0x03, 0x0e, 0x11, 0x11, 0x11, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0f, 0x11, 0x11, 0x11, 0x0e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x11, 0x11, 0x11, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0x1e, 0x2d, 0x31, 0x31, 0x31, 0x2f, 0x25, 0x12, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x21, 0x2e, 0x31, 0x31, 0x31, 0x2d, 0x1e, 0x09, 0x00, 0x00, 0x00, 0x00, 0x12, 0x25, 0x2f, 0x31, 0x31, 0x31, 0x2a, 0x1a, 0x03, 0x00,
+    0x00, 0x1c, 0x36, 0x4a, 0x50, 0x50, 0x50, 0x4e, 0x3f, 0x26, 0x0a, 0x00, 0x00, 0x03, 0x1f, 0x39, 0x4c, 0x50, 0x50, 0x50, 0x4a, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x0c, 0x27, 0x3f, 0x4e, 0x50, 0x50, 0x50, 0x46, 0x30, 0x15, 0x00,
+    0x08, 0x27, 0x46, 0x63, 0x70, 0x70, 0x70, 0x6b, 0x51, 0x34, 0x16, 0x00, 0x00, 0x0f, 0x2d, 0x4a, 0x66, 0x70, 0x70, 0x70, 0x63, 0x46, 0x2a, 0x0c, 0x00, 0x00, 0x18, 0x36, 0x53, 0x6b, 0x70, 0x70, 0x70, 0x5c, 0x3e, 0x1f, 0x00,
+    0x09, 0x28, 0x48, 0x67, 0x84, 0x90, 0x90, 0x7a, 0x5c, 0x3f, 0x21, 0x03, 0x00, 0x1a, 0x38, 0x56, 0x73, 0x8e, 0x90, 0x8c, 0x70, 0x52, 0x34, 0x17, 0x00, 0x06, 0x24, 0x41, 0x5f, 0x7c, 0x90, 0x90, 0x7d, 0x60, 0x40, 0x21, 0x01,
+    0x03, 0x21, 0x3f, 0x5c, 0x7a, 0x96, 0xa1, 0x84, 0x67, 0x49, 0x2c, 0x0e, 0x08, 0x25, 0x43, 0x61, 0x7d, 0x9a, 0xb0, 0x96, 0x7a, 0x5d, 0x3f, 0x21, 0x04, 0x11, 0x2f, 0x4c, 0x6a, 0x86, 0xa3, 0x8f, 0x73, 0x56, 0x38, 0x1a, 0x00,
+    0x00, 0x16, 0x34, 0x51, 0x6f, 0x8b, 0xa7, 0x8d, 0x73, 0x55, 0x37, 0x19, 0x13, 0x30, 0x4e, 0x6c, 0x88, 0xa5, 0xb8, 0xa1, 0x84, 0x68, 0x4b, 0x2d, 0x0e, 0x1c, 0x3a, 0x57, 0x75, 0x91, 0xa1, 0x84, 0x68, 0x4b, 0x2d, 0x0f, 0x00,
+    0x00, 0x0b, 0x29, 0x46, 0x64, 0x80, 0x9d, 0x99, 0x7c, 0x5f, 0x42, 0x24, 0x1f, 0x3c, 0x5a, 0x76, 0x93, 0xa5, 0x98, 0xa8, 0x8f, 0x73, 0x55, 0x38, 0x1a, 0x28, 0x45, 0x63, 0x80, 0x9b, 0x96, 0x7a, 0x5d, 0x3f, 0x21, 0x04, 0x00,
+    0x00, 0x00, 0x1d, 0x3c, 0x5a, 0x76, 0x93, 0xa4, 0x86, 0x6a, 0x4c, 0x2f, 0x2a, 0x47, 0x65, 0x81, 0x9d, 0x96, 0x80, 0x9b, 0x9a, 0x7d, 0x60, 0x43, 0x25, 0x33, 0x50, 0x6d, 0x8a, 0xa6, 0x8b, 0x6f, 0x52, 0x34, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x13, 0x30, 0x4e, 0x6c, 0x88, 0xa5, 0x91, 0x75, 0x57, 0x3a, 0x35, 0x52, 0x70, 0x8c, 0xa6, 0x8a, 0x74, 0x90, 0xa4, 0x88, 0x6b, 0x4e, 0x30, 0x3d, 0x5b, 0x78, 0x94, 0x9d, 0x80, 0x65, 0x47, 0x29, 0x0c, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x25, 0x43, 0x61, 0x7d, 0x9a, 0x9b, 0x80, 0x63, 0x44, 0x3f, 0x5d, 0x7b, 0x96, 0x9c, 0x80, 0x6a, 0x85, 0xa3, 0x93, 0x76, 0x58, 0x3a, 0x48, 0x66, 0x81, 0x9f, 0x93, 0x76, 0x5a, 0x3c, 0x1e, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1a, 0x38, 0x56, 0x73, 0x8f, 0xa6, 0x88, 0x6d, 0x50, 0x4c, 0x68, 0x85, 0xa1, 0x91, 0x75, 0x5f, 0x7b, 0x98, 0x9c, 0x80, 0x64, 0x46, 0x53, 0x71, 0x8c, 0xa5, 0x88, 0x6c, 0x4e, 0x30, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x2d, 0x4b, 0x68, 0x84, 0xa1, 0x94, 0x78, 0x5a, 0x56, 0x74, 0x90, 0xa3, 0x86, 0x6a, 0x53, 0x70, 0x8c, 0xa7, 0x8a, 0x6f, 0x51, 0x5f, 0x7b, 0x98, 0x9a, 0x7f, 0x61, 0x43, 0x25, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x21, 0x3f, 0x5d, 0x7b, 0x96, 0x9f, 0x81, 0x65, 0x61, 0x7f, 0x9b, 0x98, 0x7b, 0x5f, 0x48, 0x65, 0x81, 0x9f, 0x95, 0x7a, 0x5c, 0x6a, 0x85, 0xa3, 0x8f, 0x74, 0x56, 0x38, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x35, 0x52, 0x70, 0x8c, 0xa7, 0x8c, 0x70, 0x6c, 0x88, 0xa6, 0x8c, 0x71, 0x53, 0x3d, 0x5a, 0x78, 0x93, 0xa0, 0x83, 0x66, 0x74, 0x90, 0xa1, 0x85, 0x68, 0x4b, 0x2e, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x2a, 0x47, 0x65, 0x81, 0x9d, 0x96, 0x7a, 0x78, 0x94, 0x9f, 0x81, 0x65, 0x48, 0x31, 0x4e, 0x6c, 0x88, 0xa5, 0x8d, 0x71, 0x7f, 0x9b, 0x96, 0x7b, 0x5d, 0x3f, 0x23, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x3c, 0x5a, 0x78, 0x93, 0xa1, 0x84, 0x81, 0x9f, 0x93, 0x78, 0x5a, 0x3d, 0x26, 0x43, 0x61, 0x7f, 0x9a, 0x99, 0x7c, 0x88, 0xa6, 0x8c, 0x70, 0x52, 0x35, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x31, 0x4e, 0x6c, 0x88, 0xa6, 0x8f, 0x8c, 0xa5, 0x88, 0x6c, 0x4e, 0x31, 0x1b, 0x38, 0x56, 0x73, 0x8f, 0xa4, 0x87, 0x94, 0x9d, 0x81, 0x65, 0x47, 0x2a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x26, 0x44, 0x61, 0x7f, 0x9b, 0xa4, 0xa3, 0x9a, 0x7d, 0x61, 0x43, 0x26, 0x0f, 0x2d, 0x4b, 0x68, 0x84, 0xa1, 0xa1, 0xa6, 0x93, 0x78, 0x5a, 0x3c, 0x1f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x39, 0x56, 0x74, 0x90, 0xad, 0xab, 0x8f, 0x73, 0x55, 0x38, 0x1a, 0x04, 0x21, 0x3f, 0x5d, 0x7a, 0x96, 0xb0, 0xa5, 0x88, 0x6c, 0x4e, 0x31, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2e, 0x4c, 0x68, 0x85, 0x90, 0x90, 0x83, 0x67, 0x4a, 0x2d, 0x0e, 0x00, 0x17, 0x34, 0x51, 0x6f, 0x8b, 0x90, 0x90, 0x7f, 0x61, 0x43, 0x26, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x23, 0x41, 0x5d, 0x70, 0x70, 0x70, 0x70, 0x5c, 0x3e, 0x21, 0x03, 0x00, 0x0b, 0x29, 0x46, 0x63, 0x70, 0x70, 0x70, 0x6d, 0x55, 0x38, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x30, 0x46, 0x50, 0x50, 0x50, 0x50, 0x46, 0x30, 0x15, 0x00, 0x00, 0x00, 0x1c, 0x36, 0x4a, 0x50, 0x50, 0x50, 0x4f, 0x41, 0x29, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1a, 0x2a, 0x31, 0x31, 0x31, 0x31, 0x2a, 0x1a, 0x03, 0x00, 0x00, 0x00, 0x09, 0x1e, 0x2d, 0x31, 0x31, 0x31, 0x30, 0x27, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0e, 0x11, 0x11, 0x11, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0078 "x" */
+    0x00, 0x00, 0x00, 0x08, 0x10, 0x11, 0x11, 0x11, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x12, 0x25, 0x2f, 0x31, 0x31, 0x31, 0x30, 0x27, 0x14, 0x00, 0x00, 0x00, 0x04, 0x1a, 0x2a, 0x31, 0x31, 0x31, 0x31, 0x2d, 0x1e, 0x09, 0x00, 0x00,
+    0x00, 0x0a, 0x26, 0x3f, 0x4e, 0x50, 0x50, 0x50, 0x4f, 0x41, 0x29, 0x10, 0x00, 0x00, 0x18, 0x31, 0x46, 0x50, 0x50, 0x50, 0x50, 0x4a, 0x36, 0x1c, 0x00, 0x00,
+    0x00, 0x13, 0x33, 0x51, 0x6b, 0x70, 0x70, 0x70, 0x6d, 0x55, 0x3c, 0x24, 0x0a, 0x12, 0x2b, 0x44, 0x5d, 0x70, 0x70, 0x70, 0x70, 0x63, 0x46, 0x27, 0x08, 0x00,
+    0x00, 0x14, 0x34, 0x53, 0x71, 0x89, 0x90, 0x90, 0x81, 0x69, 0x50, 0x37, 0x1d, 0x25, 0x3f, 0x57, 0x71, 0x88, 0x90, 0x90, 0x80, 0x66, 0x48, 0x28, 0x09, 0x00,
+    0x00, 0x0d, 0x2a, 0x45, 0x5e, 0x77, 0x8f, 0xa7, 0x94, 0x7c, 0x63, 0x4a, 0x31, 0x39, 0x52, 0x6b, 0x81, 0x9a, 0x9d, 0x85, 0x6e, 0x55, 0x3b, 0x1f, 0x02, 0x00,
+    0x00, 0x00, 0x19, 0x32, 0x4a, 0x63, 0x7c, 0x95, 0xa6, 0x8d, 0x76, 0x5d, 0x44, 0x4b, 0x65, 0x7d, 0x95, 0xa3, 0x8c, 0x74, 0x5b, 0x41, 0x28, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x1e, 0x38, 0x51, 0x6a, 0x81, 0x9a, 0xa0, 0x88, 0x71, 0x57, 0x5e, 0x77, 0x8f, 0xa7, 0x91, 0x79, 0x60, 0x47, 0x2e, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0b, 0x25, 0x3e, 0x56, 0x6f, 0x87, 0xa0, 0x9a, 0x81, 0x6a, 0x71, 0x89, 0xa2, 0x96, 0x7f, 0x66, 0x4d, 0x33, 0x1b, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x2a, 0x44, 0x5d, 0x74, 0x8c, 0xa5, 0x95, 0x7d, 0x84, 0x9b, 0x9b, 0x84, 0x6b, 0x52, 0x3a, 0x21, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x49, 0x63, 0x7b, 0x92, 0xa7, 0x8f, 0x97, 0xa2, 0x89, 0x71, 0x58, 0x3f, 0x26, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1d, 0x36, 0x4f, 0x68, 0x80, 0x98, 0xad, 0xa8, 0x8f, 0x77, 0x5e, 0x45, 0x2c, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x29, 0x43, 0x5b, 0x74, 0x8d, 0xac, 0xa0, 0x81, 0x6b, 0x52, 0x39, 0x20, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x24, 0x3c, 0x55, 0x6e, 0x87, 0x9f, 0xa1, 0xa6, 0x95, 0x7d, 0x66, 0x4c, 0x33, 0x1a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x1d, 0x37, 0x50, 0x69, 0x81, 0x9a, 0xa0, 0x88, 0x8f, 0xa7, 0x8f, 0x78, 0x60, 0x47, 0x2e, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x31, 0x4a, 0x63, 0x7c, 0x94, 0xa6, 0x8d, 0x76, 0x7f, 0x96, 0xa3, 0x8a, 0x73, 0x5b, 0x41, 0x28, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x12, 0x2c, 0x44, 0x5d, 0x77, 0x8d, 0xa6, 0x94, 0x7c, 0x63, 0x6b, 0x84, 0x9d, 0x9d, 0x85, 0x6d, 0x55, 0x3c, 0x23, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x25, 0x3f, 0x58, 0x71, 0x88, 0xa1, 0x9a, 0x81, 0x69, 0x50, 0x58, 0x71, 0x89, 0xa3, 0x97, 0x80, 0x68, 0x4f, 0x36, 0x1d, 0x04, 0x00, 0x00,
+    0x00, 0x06, 0x20, 0x39, 0x52, 0x6b, 0x83, 0x9b, 0xa0, 0x87, 0x6e, 0x55, 0x3c, 0x46, 0x5f, 0x78, 0x8f, 0xa8, 0x92, 0x7b, 0x63, 0x4a, 0x30, 0x17, 0x00, 0x00,
+    0x00, 0x17, 0x32, 0x4c, 0x66, 0x7f, 0x95, 0xa5, 0x8c, 0x74, 0x5c, 0x43, 0x29, 0x33, 0x4c, 0x66, 0x7f, 0x96, 0xa5, 0x8c, 0x76, 0x5d, 0x44, 0x2a, 0x0d, 0x00,
+    0x00, 0x20, 0x3f, 0x5d, 0x78, 0x8e, 0x90, 0x90, 0x7a, 0x61, 0x49, 0x30, 0x16, 0x20, 0x39, 0x52, 0x6b, 0x84, 0x90, 0x90, 0x87, 0x71, 0x53, 0x34, 0x14, 0x00,
+    0x00, 0x1f, 0x3e, 0x5c, 0x70, 0x70, 0x70, 0x70, 0x66, 0x4f, 0x35, 0x1d, 0x03, 0x0d, 0x26, 0x3f, 0x58, 0x6f, 0x70, 0x70, 0x70, 0x6b, 0x51, 0x33, 0x13, 0x00,
+    0x00, 0x15, 0x30, 0x46, 0x50, 0x50, 0x50, 0x50, 0x4c, 0x39, 0x22, 0x09, 0x00, 0x00, 0x13, 0x2d, 0x44, 0x50, 0x50, 0x50, 0x50, 0x4e, 0x3f, 0x26, 0x0a, 0x00,
+    0x00, 0x03, 0x1a, 0x2a, 0x31, 0x31, 0x31, 0x31, 0x2e, 0x21, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x17, 0x28, 0x30, 0x31, 0x31, 0x31, 0x2f, 0x25, 0x12, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x0f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x11, 0x11, 0x11, 0x11, 0x10, 0x08, 0x00, 0x00, 0x00,
+
+    /* U+0079 "y" */
+    0x00, 0x00, 0x00, 0x06, 0x0f, 0x11, 0x11, 0x11, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x11, 0x11, 0x11, 0x0f, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x23, 0x2f, 0x31, 0x31, 0x31, 0x2f, 0x25, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x25, 0x2f, 0x31, 0x31, 0x31, 0x2e, 0x21, 0x0c, 0x00,
+    0x00, 0x06, 0x23, 0x3c, 0x4d, 0x50, 0x50, 0x50, 0x4e, 0x3f, 0x27, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x26, 0x3f, 0x4e, 0x50, 0x50, 0x50, 0x4c, 0x39, 0x1f, 0x03,
+    0x00, 0x0f, 0x2f, 0x4d, 0x69, 0x70, 0x70, 0x70, 0x6b, 0x53, 0x35, 0x18, 0x00, 0x00, 0x00, 0x00, 0x17, 0x35, 0x51, 0x6b, 0x70, 0x70, 0x70, 0x66, 0x49, 0x2b, 0x0c,
+    0x00, 0x11, 0x30, 0x50, 0x6f, 0x8a, 0x90, 0x90, 0x7b, 0x5f, 0x43, 0x25, 0x08, 0x00, 0x00, 0x07, 0x24, 0x41, 0x5e, 0x7b, 0x90, 0x90, 0x86, 0x6a, 0x4b, 0x2c, 0x0c,
+    0x00, 0x0b, 0x28, 0x45, 0x61, 0x7f, 0x9a, 0xa4, 0x88, 0x6c, 0x4f, 0x32, 0x15, 0x00, 0x00, 0x13, 0x30, 0x4e, 0x6a, 0x86, 0xa2, 0x96, 0x7a, 0x5e, 0x41, 0x24, 0x06,
+    0x00, 0x00, 0x1b, 0x38, 0x55, 0x71, 0x8d, 0xaa, 0x94, 0x78, 0x5c, 0x3f, 0x21, 0x05, 0x03, 0x1f, 0x3d, 0x5a, 0x76, 0x93, 0xa6, 0x88, 0x6d, 0x51, 0x34, 0x17, 0x00,
+    0x00, 0x00, 0x0e, 0x2b, 0x48, 0x65, 0x80, 0x9d, 0xa1, 0x84, 0x68, 0x4c, 0x2e, 0x11, 0x0f, 0x2c, 0x49, 0x66, 0x81, 0x9f, 0x99, 0x7d, 0x61, 0x44, 0x27, 0x0a, 0x00,
+    0x00, 0x00, 0x01, 0x1e, 0x3c, 0x58, 0x75, 0x91, 0xab, 0x90, 0x74, 0x58, 0x3a, 0x1e, 0x1c, 0x38, 0x56, 0x73, 0x8d, 0xa9, 0x8c, 0x71, 0x55, 0x37, 0x1a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x2f, 0x4c, 0x68, 0x84, 0xa1, 0x9c, 0x80, 0x65, 0x48, 0x2a, 0x28, 0x46, 0x63, 0x7f, 0x9a, 0x9c, 0x80, 0x65, 0x48, 0x2a, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x21, 0x3f, 0x5c, 0x78, 0x94, 0xaa, 0x8c, 0x71, 0x55, 0x37, 0x35, 0x52, 0x6f, 0x8a, 0xa8, 0x8f, 0x74, 0x58, 0x3a, 0x1e, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x32, 0x4f, 0x6c, 0x86, 0xa4, 0x99, 0x7d, 0x61, 0x44, 0x41, 0x5f, 0x7b, 0x96, 0xa0, 0x83, 0x68, 0x4b, 0x2e, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x25, 0x42, 0x5f, 0x7b, 0x96, 0xa6, 0x88, 0x6d, 0x51, 0x4e, 0x6b, 0x86, 0xa3, 0x93, 0x78, 0x5c, 0x3e, 0x21, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x35, 0x52, 0x6f, 0x8a, 0xa6, 0x95, 0x7a, 0x5e, 0x5a, 0x78, 0x93, 0xa3, 0x86, 0x6c, 0x4e, 0x31, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x28, 0x45, 0x63, 0x7f, 0x9a, 0xa2, 0x85, 0x6a, 0x66, 0x83, 0x9f, 0x96, 0x7b, 0x5f, 0x41, 0x25, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x38, 0x56, 0x73, 0x8d, 0xaa, 0x91, 0x76, 0x73, 0x8f, 0xa6, 0x8a, 0x6f, 0x51, 0x35, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x2c, 0x48, 0x66, 0x81, 0x9d, 0x9d, 0x81, 0x80, 0x9b, 0x9a, 0x7f, 0x63, 0x45, 0x28, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x3c, 0x58, 0x76, 0x91, 0xaa, 0x8d, 0x8c, 0xa7, 0x8d, 0x73, 0x55, 0x38, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2f, 0x4c, 0x68, 0x85, 0xa1, 0xa4, 0xa3, 0x9d, 0x81, 0x65, 0x48, 0x2c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x23, 0x3f, 0x5c, 0x78, 0x94, 0xb1, 0xad, 0x91, 0x75, 0x58, 0x3c, 0x1f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x17, 0x1d, 0x1a, 0x0e, 0x15, 0x33, 0x4f, 0x6c, 0x88, 0xa5, 0xa1, 0x85, 0x68, 0x4c, 0x2f, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x23, 0x35, 0x3c, 0x38, 0x28, 0x1a, 0x34, 0x51, 0x6d, 0x88, 0xa5, 0x94, 0x78, 0x5c, 0x3f, 0x23, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x36, 0x4f, 0x5c, 0x54, 0x43, 0x39, 0x44, 0x5f, 0x7a, 0x96, 0xa4, 0x88, 0x6c, 0x4f, 0x33, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x2c, 0x46, 0x63, 0x7b, 0x6e, 0x5f, 0x58, 0x5e, 0x71, 0x88, 0xa3, 0x96, 0x7b, 0x5f, 0x43, 0x25, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1d, 0x3a, 0x56, 0x71, 0x8c, 0x88, 0x7c, 0x78, 0x7b, 0x87, 0x9d, 0xa0, 0x87, 0x6d, 0x51, 0x35, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x25, 0x44, 0x64, 0x80, 0x9b, 0xa4, 0x9a, 0x98, 0x98, 0xa2, 0xa1, 0x8c, 0x76, 0x5d, 0x43, 0x27, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x23, 0x42, 0x5f, 0x74, 0x85, 0x90, 0x98, 0x9c, 0x9a, 0x93, 0x86, 0x77, 0x60, 0x4a, 0x30, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0x33, 0x49, 0x5c, 0x6a, 0x74, 0x7b, 0x7c, 0x7c, 0x76, 0x6c, 0x5d, 0x4a, 0x33, 0x1d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x1d, 0x30, 0x3f, 0x4c, 0x56, 0x5c, 0x5c, 0x5c, 0x58, 0x4e, 0x41, 0x31, 0x1d, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x15, 0x23, 0x2e, 0x37, 0x3c, 0x3d, 0x3d, 0x38, 0x30, 0x25, 0x16, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x10, 0x18, 0x1d, 0x1d, 0x1d, 0x1a, 0x12, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+007A "z" */
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x1a, 0x2a, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x27, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x30, 0x46, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4f, 0x41, 0x29, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x1f, 0x3e, 0x5c, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x6d, 0x55, 0x36, 0x17, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0xa0, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa5, 0xb0, 0xb0, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00,
+    0x00, 0x01, 0x21, 0x40, 0x60, 0x80, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x8a, 0xa8, 0xa1, 0x89, 0x71, 0x56, 0x37, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x3a, 0x55, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x67, 0x7f, 0x97, 0xa5, 0x8d, 0x77, 0x5d, 0x45, 0x2c, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x28, 0x3c, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4a, 0x63, 0x7a, 0x92, 0xa9, 0x92, 0x7a, 0x63, 0x4a, 0x31, 0x19, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x1f, 0x25, 0x25, 0x25, 0x25, 0x2d, 0x45, 0x5d, 0x77, 0x8c, 0xa5, 0x97, 0x7f, 0x66, 0x4f, 0x36, 0x1d, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x0f, 0x28, 0x40, 0x58, 0x71, 0x89, 0xa1, 0x9b, 0x84, 0x6b, 0x53, 0x3b, 0x22, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x23, 0x3c, 0x54, 0x6c, 0x84, 0x9d, 0xa0, 0x88, 0x71, 0x58, 0x3f, 0x27, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x36, 0x4f, 0x68, 0x7f, 0x97, 0xa5, 0x8c, 0x74, 0x5d, 0x44, 0x2c, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x1a, 0x32, 0x4a, 0x63, 0x7b, 0x92, 0xa9, 0x92, 0x79, 0x61, 0x49, 0x31, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x14, 0x2d, 0x46, 0x5e, 0x77, 0x8d, 0xa5, 0x96, 0x7f, 0x66, 0x4e, 0x35, 0x1d, 0x04, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x28, 0x41, 0x5a, 0x71, 0x89, 0xa2, 0x9a, 0x83, 0x6b, 0x52, 0x3a, 0x23, 0x21, 0x21, 0x21, 0x21, 0x1b, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x23, 0x3c, 0x55, 0x6d, 0x84, 0x9d, 0xa0, 0x87, 0x6f, 0x58, 0x41, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x38, 0x25, 0x0d, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x36, 0x4f, 0x69, 0x80, 0x97, 0xa4, 0x8c, 0x74, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x52, 0x38, 0x1b, 0x00, 0x00,
+    0x00, 0x08, 0x27, 0x46, 0x63, 0x7c, 0x93, 0xab, 0x98, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x60, 0x40, 0x21, 0x01, 0x00,
+    0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0xa6, 0xb0, 0xa9, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9f, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00,
+    0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00,
+    0x00, 0x08, 0x27, 0x46, 0x63, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x5c, 0x3e, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x36, 0x4a, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x46, 0x30, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x1e, 0x2d, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2a, 0x1a, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0c, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+007B "{" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x09, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x15, 0x1f, 0x25, 0x29, 0x29, 0x29, 0x24, 0x16, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x22, 0x31, 0x3d, 0x44, 0x48, 0x48, 0x48, 0x41, 0x2e, 0x14, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x25, 0x3c, 0x4e, 0x5b, 0x64, 0x68, 0x68, 0x68, 0x5b, 0x3f, 0x21, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x21, 0x3b, 0x52, 0x68, 0x78, 0x81, 0x88, 0x88, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2f, 0x4c, 0x66, 0x7f, 0x92, 0x9f, 0xa5, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3a, 0x58, 0x76, 0x91, 0xab, 0xa0, 0x8f, 0x88, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x22, 0x41, 0x60, 0x80, 0x9c, 0xa8, 0x8c, 0x74, 0x6b, 0x68, 0x5b, 0x3f, 0x21, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa3, 0xa0, 0x80, 0x64, 0x4c, 0x48, 0x41, 0x2e, 0x14, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x29, 0x24, 0x16, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x12, 0x25, 0x2f, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x26, 0x3f, 0x4e, 0x50, 0x64, 0x84, 0xa4, 0x9d, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x13, 0x33, 0x51, 0x6b, 0x70, 0x76, 0x8c, 0xa8, 0x99, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x90, 0x94, 0xa0, 0x98, 0x88, 0x71, 0x55, 0x37, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xa0, 0xaa, 0x8d, 0x7d, 0x69, 0x4e, 0x31, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x80, 0x83, 0x95, 0xa6, 0x93, 0x78, 0x5a, 0x3b, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x2e, 0x49, 0x5d, 0x60, 0x69, 0x85, 0xa4, 0x9c, 0x7c, 0x5f, 0x40, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x1d, 0x32, 0x3f, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x17, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x40, 0x21, 0x18, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xa0, 0x80, 0x60, 0x41, 0x3d, 0x36, 0x25, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x80, 0xa0, 0xa3, 0x85, 0x6b, 0x5c, 0x5c, 0x52, 0x3a, 0x1d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3f, 0x5d, 0x7b, 0x98, 0xaf, 0x95, 0x83, 0x7c, 0x7c, 0x64, 0x44, 0x25, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x35, 0x53, 0x6f, 0x87, 0x9d, 0xac, 0x9f, 0x9c, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x28, 0x44, 0x5d, 0x74, 0x83, 0x8f, 0x94, 0x98, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x47, 0x5a, 0x68, 0x71, 0x76, 0x78, 0x78, 0x63, 0x44, 0x24, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1a, 0x2e, 0x3e, 0x4b, 0x53, 0x58, 0x58, 0x58, 0x4f, 0x38, 0x1c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x13, 0x21, 0x2d, 0x34, 0x38, 0x39, 0x39, 0x33, 0x22, 0x0b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x14, 0x19, 0x19, 0x19, 0x15, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+007C "|" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x09, 0x09, 0x09, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x24, 0x29, 0x29, 0x29, 0x28, 0x1f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x14, 0x2e, 0x41, 0x48, 0x48, 0x48, 0x48, 0x3b, 0x25, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x21, 0x3f, 0x5b, 0x68, 0x68, 0x68, 0x66, 0x51, 0x34, 0x16, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x88, 0x88, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0x98, 0x97, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x24, 0x44, 0x63, 0x78, 0x78, 0x78, 0x71, 0x56, 0x37, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1c, 0x38, 0x4f, 0x58, 0x58, 0x58, 0x56, 0x44, 0x2c, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0b, 0x22, 0x33, 0x39, 0x39, 0x39, 0x37, 0x2c, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x15, 0x19, 0x19, 0x19, 0x18, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+007D "}" */
+    0x00, 0x00, 0x00, 0x03, 0x09, 0x09, 0x09, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x21, 0x28, 0x29, 0x29, 0x27, 0x21, 0x17, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0e, 0x28, 0x3d, 0x48, 0x48, 0x48, 0x46, 0x3f, 0x35, 0x26, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1a, 0x38, 0x54, 0x67, 0x68, 0x68, 0x64, 0x5d, 0x51, 0x40, 0x2b, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x88, 0x88, 0x84, 0x7b, 0x6c, 0x58, 0x41, 0x27, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9c, 0xa7, 0xa1, 0x96, 0x84, 0x6d, 0x53, 0x36, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x88, 0x8d, 0x9b, 0xaf, 0x97, 0x7d, 0x61, 0x43, 0x24, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1a, 0x38, 0x54, 0x67, 0x69, 0x71, 0x85, 0xa1, 0xa4, 0x86, 0x68, 0x49, 0x2b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0e, 0x28, 0x3d, 0x48, 0x4b, 0x5c, 0x78, 0x98, 0xab, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x21, 0x28, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x30, 0x28, 0x17, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x94, 0xac, 0x8c, 0x6c, 0x52, 0x50, 0x44, 0x2d, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x91, 0xae, 0x93, 0x7a, 0x70, 0x6f, 0x58, 0x3a, 0x1b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x2f, 0x4d, 0x6a, 0x84, 0x94, 0xa5, 0x95, 0x90, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x2a, 0x46, 0x63, 0x79, 0x89, 0xa5, 0xa3, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x14, 0x33, 0x52, 0x70, 0x8c, 0xa3, 0x9a, 0x85, 0x80, 0x7b, 0x5c, 0x3c, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x36, 0x55, 0x74, 0x94, 0xac, 0x8d, 0x70, 0x60, 0x60, 0x4f, 0x35, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x40, 0x36, 0x23, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x16, 0x1d, 0x39, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x20, 0x33, 0x3c, 0x3d, 0x58, 0x78, 0x98, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x16, 0x33, 0x4d, 0x5c, 0x5c, 0x66, 0x7f, 0x9b, 0xa8, 0x88, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1d, 0x3c, 0x5c, 0x79, 0x7c, 0x80, 0x8f, 0xa9, 0x9f, 0x81, 0x65, 0x47, 0x28, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9b, 0x9d, 0xaa, 0xa2, 0x8d, 0x76, 0x5a, 0x3d, 0x1f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x98, 0x95, 0x90, 0x86, 0x78, 0x63, 0x4a, 0x2f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1c, 0x3c, 0x5b, 0x76, 0x78, 0x78, 0x74, 0x6b, 0x5e, 0x4c, 0x36, 0x1d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x15, 0x31, 0x4a, 0x58, 0x58, 0x58, 0x54, 0x4d, 0x41, 0x32, 0x20, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x1d, 0x2f, 0x38, 0x39, 0x39, 0x35, 0x2f, 0x25, 0x17, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x12, 0x19, 0x19, 0x19, 0x15, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+007E "~" */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x10, 0x11, 0x0c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x02, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x15, 0x21, 0x2b, 0x30, 0x30, 0x2c, 0x24, 0x17, 0x08, 0x00, 0x0e, 0x1f, 0x28, 0x29, 0x29, 0x25, 0x18, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x30, 0x3f, 0x49, 0x4f, 0x50, 0x4b, 0x41, 0x33, 0x23, 0x10, 0x25, 0x3b, 0x48, 0x48, 0x48, 0x43, 0x31, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x1d, 0x33, 0x4a, 0x5c, 0x67, 0x6d, 0x6f, 0x6a, 0x5e, 0x4f, 0x3c, 0x28, 0x34, 0x51, 0x66, 0x68, 0x68, 0x5d, 0x43, 0x25, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x2f, 0x49, 0x60, 0x76, 0x84, 0x8c, 0x8c, 0x86, 0x7a, 0x69, 0x55, 0x41, 0x3b, 0x5a, 0x78, 0x88, 0x87, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x21, 0x3e, 0x5a, 0x74, 0x8c, 0xa0, 0x9f, 0x9c, 0xa2, 0x93, 0x81, 0x6e, 0x5b, 0x4d, 0x63, 0x80, 0x9c, 0x84, 0x66, 0x48, 0x28, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x2b, 0x49, 0x67, 0x83, 0x9f, 0x8f, 0x80, 0x7f, 0x89, 0x9a, 0x98, 0x85, 0x74, 0x6c, 0x77, 0x8c, 0x9b, 0x7f, 0x60, 0x42, 0x23, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x12, 0x31, 0x50, 0x70, 0x8c, 0x96, 0x7c, 0x65, 0x60, 0x71, 0x83, 0x95, 0x9f, 0x90, 0x8c, 0x91, 0xa3, 0x8d, 0x74, 0x56, 0x39, 0x1b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x93, 0x8d, 0x70, 0x52, 0x45, 0x58, 0x6b, 0x7d, 0x8d, 0x9b, 0xa0, 0x9b, 0x8f, 0x7c, 0x63, 0x49, 0x2e, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x14, 0x34, 0x53, 0x71, 0x78, 0x78, 0x6a, 0x4b, 0x2d, 0x3f, 0x52, 0x63, 0x73, 0x7d, 0x80, 0x7d, 0x74, 0x63, 0x4f, 0x38, 0x1d, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x2a, 0x44, 0x56, 0x58, 0x58, 0x53, 0x3e, 0x23, 0x25, 0x38, 0x48, 0x56, 0x60, 0x60, 0x60, 0x57, 0x4a, 0x38, 0x23, 0x0b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x2c, 0x37, 0x39, 0x39, 0x35, 0x27, 0x11, 0x0c, 0x1d, 0x2c, 0x39, 0x40, 0x40, 0x40, 0x39, 0x2e, 0x1e, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x18, 0x19, 0x19, 0x17, 0x0c, 0x00, 0x00, 0x01, 0x0f, 0x1a, 0x21, 0x21, 0x21, 0x1a, 0x11, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 138, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 138, .box_w = 17, .box_h = 32, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 544, .adv_w = 200, .box_w = 21, .box_h = 31, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 1195, .adv_w = 360, .box_w = 31, .box_h = 31, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 2156, .adv_w = 318, .box_w = 28, .box_h = 39, .ofs_x = -4, .ofs_y = -8},
+    {.bitmap_index = 3248, .adv_w = 432, .box_w = 35, .box_h = 32, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 4368, .adv_w = 352, .box_w = 30, .box_h = 32, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 5328, .adv_w = 108, .box_w = 15, .box_h = 31, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 5793, .adv_w = 172, .box_w = 19, .box_h = 39, .ofs_x = -4, .ofs_y = -11},
+    {.bitmap_index = 6534, .adv_w = 174, .box_w = 19, .box_h = 39, .ofs_x = -4, .ofs_y = -11},
+    {.bitmap_index = 7275, .adv_w = 204, .box_w = 21, .box_h = 32, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 7947, .adv_w = 298, .box_w = 27, .box_h = 27, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 8676, .adv_w = 116, .box_w = 16, .box_h = 18, .ofs_x = -4, .ofs_y = -9},
+    {.bitmap_index = 8964, .adv_w = 196, .box_w = 21, .box_h = 19, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 9363, .adv_w = 116, .box_w = 16, .box_h = 14, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 9587, .adv_w = 180, .box_w = 22, .box_h = 39, .ofs_x = -5, .ofs_y = -8},
+    {.bitmap_index = 10445, .adv_w = 342, .box_w = 30, .box_h = 32, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 11405, .adv_w = 190, .box_w = 20, .box_h = 31, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 12025, .adv_w = 294, .box_w = 27, .box_h = 31, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 12862, .adv_w = 292, .box_w = 27, .box_h = 32, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 13726, .adv_w = 342, .box_w = 30, .box_h = 31, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 14656, .adv_w = 294, .box_w = 27, .box_h = 32, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 15520, .adv_w = 316, .box_w = 28, .box_h = 32, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 16416, .adv_w = 306, .box_w = 28, .box_h = 31, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 17284, .adv_w = 330, .box_w = 29, .box_h = 32, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 18212, .adv_w = 316, .box_w = 28, .box_h = 32, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 19108, .adv_w = 116, .box_w = 16, .box_h = 27, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 19540, .adv_w = 116, .box_w = 16, .box_h = 31, .ofs_x = -4, .ofs_y = -9},
+    {.bitmap_index = 20036, .adv_w = 298, .box_w = 27, .box_h = 27, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 20765, .adv_w = 298, .box_w = 27, .box_h = 25, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 21440, .adv_w = 298, .box_w = 27, .box_h = 27, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 22169, .adv_w = 294, .box_w = 27, .box_h = 32, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 23033, .adv_w = 530, .box_w = 42, .box_h = 38, .ofs_x = -4, .ofs_y = -11},
+    {.bitmap_index = 24629, .adv_w = 374, .box_w = 33, .box_h = 31, .ofs_x = -5, .ofs_y = -4},
+    {.bitmap_index = 25652, .adv_w = 388, .box_w = 33, .box_h = 31, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 26675, .adv_w = 370, .box_w = 32, .box_h = 32, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 27699, .adv_w = 422, .box_w = 35, .box_h = 31, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 28784, .adv_w = 344, .box_w = 30, .box_h = 31, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 29714, .adv_w = 326, .box_w = 29, .box_h = 31, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 30613, .adv_w = 396, .box_w = 33, .box_h = 32, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 31669, .adv_w = 416, .box_w = 34, .box_h = 31, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 32723, .adv_w = 158, .box_w = 18, .box_h = 31, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 33281, .adv_w = 262, .box_w = 26, .box_h = 32, .ofs_x = -5, .ofs_y = -5},
+    {.bitmap_index = 34113, .adv_w = 368, .box_w = 31, .box_h = 31, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 35074, .adv_w = 304, .box_w = 27, .box_h = 31, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 35911, .adv_w = 488, .box_w = 39, .box_h = 31, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 37120, .adv_w = 416, .box_w = 34, .box_h = 31, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 38174, .adv_w = 430, .box_w = 35, .box_h = 32, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 39294, .adv_w = 370, .box_w = 32, .box_h = 31, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 40286, .adv_w = 430, .box_w = 35, .box_h = 36, .ofs_x = -4, .ofs_y = -9},
+    {.bitmap_index = 41546, .adv_w = 372, .box_w = 32, .box_h = 31, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 42538, .adv_w = 318, .box_w = 28, .box_h = 32, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 43434, .adv_w = 300, .box_w = 27, .box_h = 31, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 44271, .adv_w = 406, .box_w = 34, .box_h = 32, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 45359, .adv_w = 364, .box_w = 32, .box_h = 31, .ofs_x = -5, .ofs_y = -4},
+    {.bitmap_index = 46351, .adv_w = 576, .box_w = 44, .box_h = 31, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 47715, .adv_w = 344, .box_w = 30, .box_h = 31, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 48645, .adv_w = 332, .box_w = 30, .box_h = 31, .ofs_x = -5, .ofs_y = -4},
+    {.bitmap_index = 49575, .adv_w = 336, .box_w = 29, .box_h = 31, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 50474, .adv_w = 170, .box_w = 19, .box_h = 39, .ofs_x = -4, .ofs_y = -11},
+    {.bitmap_index = 51215, .adv_w = 180, .box_w = 23, .box_h = 39, .ofs_x = -6, .ofs_y = -8},
+    {.bitmap_index = 52112, .adv_w = 170, .box_w = 19, .box_h = 39, .ofs_x = -4, .ofs_y = -11},
+    {.bitmap_index = 52853, .adv_w = 298, .box_w = 27, .box_h = 26, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 53555, .adv_w = 256, .box_w = 24, .box_h = 10, .ofs_x = -4, .ofs_y = -6},
+    {.bitmap_index = 53795, .adv_w = 308, .box_w = 28, .box_h = 32, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 54691, .adv_w = 306, .box_w = 28, .box_h = 27, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 55447, .adv_w = 350, .box_w = 30, .box_h = 33, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 56437, .adv_w = 292, .box_w = 27, .box_h = 27, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 57166, .adv_w = 350, .box_w = 30, .box_h = 33, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 58156, .adv_w = 314, .box_w = 28, .box_h = 27, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 58912, .adv_w = 180, .box_w = 21, .box_h = 32, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 59584, .adv_w = 354, .box_w = 31, .box_h = 33, .ofs_x = -4, .ofs_y = -11},
+    {.bitmap_index = 60607, .adv_w = 348, .box_w = 30, .box_h = 32, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 61567, .adv_w = 142, .box_w = 17, .box_h = 33, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 62128, .adv_w = 146, .box_w = 21, .box_h = 40, .ofs_x = -7, .ofs_y = -11},
+    {.bitmap_index = 62968, .adv_w = 316, .box_w = 28, .box_h = 32, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 63864, .adv_w = 142, .box_w = 17, .box_h = 32, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 64408, .adv_w = 542, .box_w = 42, .box_h = 26, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 65500, .adv_w = 348, .box_w = 30, .box_h = 26, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 66280, .adv_w = 326, .box_w = 29, .box_h = 27, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 67063, .adv_w = 350, .box_w = 30, .box_h = 33, .ofs_x = -4, .ofs_y = -11},
+    {.bitmap_index = 68053, .adv_w = 350, .box_w = 30, .box_h = 33, .ofs_x = -4, .ofs_y = -11},
+    {.bitmap_index = 69043, .adv_w = 210, .box_w = 22, .box_h = 26, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 69615, .adv_w = 256, .box_w = 24, .box_h = 27, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 70263, .adv_w = 212, .box_w = 22, .box_h = 30, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 70923, .adv_w = 346, .box_w = 30, .box_h = 26, .ofs_x = -4, .ofs_y = -5},
+    {.bitmap_index = 71703, .adv_w = 286, .box_w = 27, .box_h = 25, .ofs_x = -5, .ofs_y = -4},
+    {.bitmap_index = 72378, .adv_w = 460, .box_w = 37, .box_h = 25, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 73303, .adv_w = 282, .box_w = 26, .box_h = 25, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 73953, .adv_w = 286, .box_w = 27, .box_h = 32, .ofs_x = -5, .ofs_y = -11},
+    {.bitmap_index = 74817, .adv_w = 266, .box_w = 25, .box_h = 25, .ofs_x = -4, .ofs_y = -4},
+    {.bitmap_index = 75442, .adv_w = 180, .box_w = 20, .box_h = 39, .ofs_x = -4, .ofs_y = -11},
+    {.bitmap_index = 76222, .adv_w = 154, .box_w = 18, .box_h = 39, .ofs_x = -4, .ofs_y = -11},
+    {.bitmap_index = 76924, .adv_w = 180, .box_w = 20, .box_h = 39, .ofs_x = -4, .ofs_y = -11},
+    {.bitmap_index = 77704, .adv_w = 298, .box_w = 27, .box_h = 22, .ofs_x = -4, .ofs_y = -4}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    }
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 0,
+    .cmap_num = 1,
+    .bpp = 8,
+    .kern_classes = 0,
+    .bitmap_format = 0,
+    .cache = &cache
+};
+
+static const lv_font_t font = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 34,          /*The maximum line height required by the font*/
+    .base_line = 7,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -2,
+    .underline_thickness = 2,
+    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+};
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Use it with `lv_font_sdf_create(&test_font_sdf, size)`*/
+const lv_font_sdf_src_t test_font_sdf = {
+    .font = &font,
+    .size = 32,
+    .spread = 4
+};
+
+#endif /*LV_USE_FONT_SDF*/
+
+#endif /*LV_BUILD_TEST*/
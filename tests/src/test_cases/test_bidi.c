@@ -0,0 +1,115 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define ALEF    "\xD7\x90"
+#define BET     "\xD7\x91"
+#define GIMEL   "\xD7\x92"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+static void test_process(const char * txt, lv_base_dir_t base_dir, const char * expected)
+{
+    uint32_t len = lv_strlen(txt);
+    char * out = lv_malloc(len + 1);
+    _lv_bidi_process_paragraph(txt, out, len, base_dir, NULL, 0);
+    TEST_ASSERT_EQUAL_STRING(expected, out);
+    lv_free(out);
+}
+
+void test_bidi_process_paragraph(void)
+{
+    uint32_t i;
+    /*The second round uses the cached results*/
+    for(i = 0; i < 2; i++) {
+        test_process("abc " ALEF BET GIMEL " def", LV_BASE_DIR_LTR, "abc " GIMEL BET ALEF " def");
+        test_process(ALEF BET " abc", LV_BASE_DIR_RTL, "abc " BET ALEF);
+        test_process(ALEF BET " abc", LV_BASE_DIR_AUTO, "abc " BET ALEF);
+        test_process("abc " ALEF BET, LV_BASE_DIR_AUTO, "abc " BET ALEF);
+    }
+}
+
+void test_bidi_pos_conv(void)
+{
+    const char * txt = "abc " ALEF BET GIMEL " def";
+    uint32_t len = lv_strlen(txt);
+
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        bool is_rtl;
+        TEST_ASSERT_EQUAL(6, _lv_bidi_get_logical_pos(txt, NULL, len, LV_BASE_DIR_LTR, 4, &is_rtl));
+        TEST_ASSERT_TRUE(is_rtl);
+        TEST_ASSERT_EQUAL(1, _lv_bidi_get_logical_pos(txt, NULL, len, LV_BASE_DIR_LTR, 1, &is_rtl));
+        TEST_ASSERT_FALSE(is_rtl);
+
+        char * bidi_txt = NULL;
+        TEST_ASSERT_EQUAL(4, _lv_bidi_get_visual_pos(txt, &bidi_txt, len, LV_BASE_DIR_LTR, 6, &is_rtl));
+        TEST_ASSERT_TRUE(is_rtl);
+        TEST_ASSERT_EQUAL_STRING("abc " GIMEL BET ALEF " def", bidi_txt);
+        lv_free(bidi_txt);
+
+        uint16_t pos_conv[11];
+        _lv_bidi_process_paragraph(txt, NULL, len, LV_BASE_DIR_LTR, pos_conv, 11);
+        TEST_ASSERT_EQUAL(6, pos_conv[4] & 0x7FFF);
+        TEST_ASSERT_EQUAL(4, pos_conv[6] & 0x7FFF);
+        TEST_ASSERT_EQUAL(10, pos_conv[10]);
+    }
+}
+
+void test_bidi_cache_pos_conv_len_mismatch(void)
+{
+    /*The buffer is longer than the number of letters, so the line is processed without the cache*/
+    const char * txt = "xy " ALEF BET;
+    uint16_t pos_conv[8];
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        _lv_bidi_process_paragraph(txt, NULL, lv_strlen(txt), LV_BASE_DIR_LTR, pos_conv, 8);
+        TEST_ASSERT_EQUAL(0, pos_conv[0]);
+        TEST_ASSERT_EQUAL(0x8000 | 4, pos_conv[3]);
+        TEST_ASSERT_EQUAL(0x8000 | 3, pos_conv[4]);
+    }
+
+    /*The cached lines are freed and can be added again*/
+    test_process(txt, LV_BASE_DIR_LTR, "xy " BET ALEF);
+    _lv_bidi_deinit();
+    test_process(txt, LV_BASE_DIR_LTR, "xy " BET ALEF);
+}
+
+void test_bidi_cache_content(void)
+{
+    /*The same buffer with a different text*/
+    char buf[32];
+    lv_strcpy(buf, "abc " ALEF BET);
+    test_process(buf, LV_BASE_DIR_LTR, "abc " BET ALEF);
+    lv_strcpy(buf, "abd " ALEF BET);
+    test_process(buf, LV_BASE_DIR_LTR, "abd " BET ALEF);
+    lv_strcpy(buf, "abc " ALEF BET);
+    test_process(buf, LV_BASE_DIR_LTR, "abc " BET ALEF);
+
+    /*Only a part of the text*/
+    char out[32];
+    _lv_bidi_process_paragraph(buf, out, 3, LV_BASE_DIR_LTR, NULL, 0);
+    TEST_ASSERT_EQUAL_STRING("abc", out);
+
+    /*More lines than the size of the cache*/
+    uint32_t i;
+    for(i = 0; i < 2 * LV_BIDI_CACHE_SIZE + 1; i++) {
+        lv_snprintf(buf, sizeof(buf), "%d " ALEF BET, (int)i);
+        char expected[32];
+        lv_snprintf(expected, sizeof(expected), "%d " BET ALEF, (int)i);
+        test_process(buf, LV_BASE_DIR_LTR, expected);
+    }
+
+    test_process("abc " ALEF BET GIMEL " def", LV_BASE_DIR_LTR, "abc " GIMEL BET ALEF " def");
+}
+
+#endif
@@ -0,0 +1,139 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+/*The rows of a 24 bit image with this width are padded*/
+#define IMG_W       50
+#define IMG_H       40
+#define ROW_SIZE    (((IMG_W * 24 + 31) / 32) * 4)
+#define IMG_FN      "A:test_img.bmp"
+
+extern lv_color_t test_fb[];
+
+static lv_color_t img_data[IMG_W * IMG_H];
+static lv_img_dsc_t img_dsc;
+static lv_color_t ref_fb[800 * 480];
+
+static void put_u32(uint8_t * buf, uint32_t v)
+{
+    lv_memcpy(buf, &v, 4);
+}
+
+static void create_bmp(void)
+{
+    uint8_t header[54];
+    lv_memzero(header, sizeof(header));
+    header[0] = 'B';
+    header[1] = 'M';
+    put_u32(&header[2], sizeof(header) + ROW_SIZE * IMG_H);
+    put_u32(&header[10], sizeof(header));
+    put_u32(&header[14], 40);
+    put_u32(&header[18], IMG_W);
+    put_u32(&header[22], IMG_H);
+    header[26] = 1;
+    header[28] = 24;
+
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, IMG_FN, LV_FS_MODE_WR));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, header, sizeof(header), NULL));
+
+    /*The rows are stored from the bottom*/
+    lv_coord_t x, y;
+    for(y = IMG_H - 1; y >= 0; y--) {
+        uint8_t row[ROW_SIZE];
+        lv_memzero(row, sizeof(row));
+        for(x = 0; x < IMG_W; x++) {
+            lv_color32_t c = lv_color_to32(img_data[y * IMG_W + x]);
+            row[x * 3 + 0] = c.blue;
+            row[x * 3 + 1] = c.green;
+            row[x * 3 + 2] = c.red;
+        }
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, row, sizeof(row), NULL));
+    }
+    lv_fs_close(&f);
+}
+
+void setUp(void)
+{
+    lv_coord_t x, y;
+    for(y = 0; y < IMG_H; y++) {
+        for(x = 0; x < IMG_W; x++) {
+            img_data[y * IMG_W + x] = lv_color_make(x * 5, y * 6, 255 - x * y / 8);
+        }
+    }
+
+    lv_memzero(&img_dsc, sizeof(lv_img_dsc_t));
+    img_dsc.header.cf = LV_COLOR_FORMAT_NATIVE;
+    img_dsc.header.w = IMG_W;
+    img_dsc.header.h = IMG_H;
+    img_dsc.data = (const uint8_t *)img_data;
+    img_dsc.data_size = sizeof(img_data);
+
+    create_bmp();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_img_cache_invalidate_src(NULL);
+    lv_img_tile_cache_set_mem_size(LV_IMG_TILE_CACHE_DEF_MEM_SIZE);
+}
+
+void test_bmp_read_tile(void)
+{
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, IMG_FN, lv_color_black(), 0));
+    TEST_ASSERT_NULL(dsc.img_data);
+    TEST_ASSERT_EQUAL(IMG_W, dsc.header.w);
+    TEST_ASSERT_EQUAL(IMG_H, dsc.header.h);
+
+    /*A band of whole rows and a small area*/
+    lv_area_t areas[2];
+    lv_area_set(&areas[0], 0, 5, IMG_W - 1, 20);
+    lv_area_set(&areas[1], 7, 30, 12, 39);
+
+    static lv_color_t buf[IMG_W * IMG_H];
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_tile(&dsc, &areas[i], (uint8_t *)buf));
+
+        lv_coord_t w = lv_area_get_width(&areas[i]);
+        lv_coord_t x, y;
+        for(y = areas[i].y1; y <= areas[i].y2; y++) {
+            for(x = areas[i].x1; x <= areas[i].x2; x++) {
+                lv_color_t c = buf[(y - areas[i].y1) * w + x - areas[i].x1];
+                TEST_ASSERT_TRUE(lv_color_eq(img_data[y * IMG_W + x], c));
+            }
+        }
+    }
+
+    /*The same as reading by lines*/
+    static lv_color_t line_buf[IMG_W];
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 7, 35, 6, (uint8_t *)line_buf));
+    TEST_ASSERT_EQUAL_MEMORY(&buf[5 * 6], line_buf, 6 * sizeof(lv_color_t));
+
+    lv_img_decoder_close(&dsc);
+}
+
+void test_bmp_draw(void)
+{
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_obj_set_pos(img, 20, 30);
+    lv_img_set_src(img, &img_dsc);
+    lv_refr_now(NULL);
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    /*Drawn from tiles*/
+    lv_img_set_src(img, IMG_FN);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+
+    /*Drawn from bands of rows*/
+    lv_img_tile_cache_set_mem_size(0);
+    lv_obj_invalidate(img);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+}
+
+#endif
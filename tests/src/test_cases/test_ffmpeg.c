@@ -0,0 +1,158 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+/*FFmpeg is enabled only if the library is found, see tests/CMakeLists.txt*/
+#if LV_USE_FFMPEG
+#include <unistd.h>
+
+#define VIDEO_PATH  "../examples/libs/ffmpeg/birds.mp4"
+
+static lv_obj_t * player;
+
+/*The frames are decoded in a thread so let the time pass for real too*/
+static void run_timers(uint32_t ms)
+{
+    uint32_t i;
+    for(i = 0; i < ms; i++) {
+        lv_tick_inc(1);
+        lv_timer_handler();
+        usleep(1000);
+    }
+}
+
+/*Run the timers until a new frame is shown or `ms_max` passes*/
+static bool wait_for_frame(uint32_t ms_max)
+{
+    const void * data = ((lv_ffmpeg_player_t *)player)->imgdsc.data;
+    uint32_t i;
+    for(i = 0; i < ms_max; i++) {
+        run_timers(1);
+        if(((lv_ffmpeg_player_t *)player)->imgdsc.data != data) return true;
+    }
+    return false;
+}
+#endif
+
+void setUp(void)
+{
+#if LV_USE_FFMPEG
+    player = lv_ffmpeg_player_create(lv_scr_act());
+#endif
+}
+
+void tearDown(void)
+{
+#if LV_USE_FFMPEG
+    lv_obj_clean(lv_scr_act());
+    player = NULL;
+#endif
+}
+
+void test_ffmpeg_open(void)
+{
+#if LV_USE_FFMPEG
+    TEST_ASSERT_GREATER_THAN(0, lv_ffmpeg_get_frame_num(VIDEO_PATH));
+
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_ffmpeg_player_set_src(player, VIDEO_PATH));
+    lv_ffmpeg_player_t * p = (lv_ffmpeg_player_t *)player;
+    TEST_ASSERT_GREATER_THAN(0, p->imgdsc.header.w);
+    TEST_ASSERT_GREATER_THAN(0, p->imgdsc.header.h);
+    TEST_ASSERT_NOT_NULL(p->imgdsc.data);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_ffmpeg_invalid_file(void)
+{
+#if LV_USE_FFMPEG
+    TEST_ASSERT_LESS_THAN(0, lv_ffmpeg_get_frame_num("../examples/libs/ffmpeg/not_exists.mp4"));
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_ffmpeg_player_set_src(player, "../examples/libs/ffmpeg/not_exists.mp4"));
+
+    /*The commands are ignored without a video*/
+    lv_ffmpeg_player_set_cmd(player, LV_FFMPEG_PLAYER_CMD_START);
+    run_timers(50);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_ffmpeg_play(void)
+{
+#if LV_USE_FFMPEG
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_ffmpeg_player_set_src(player, VIDEO_PATH));
+    lv_ffmpeg_player_set_cmd(player, LV_FFMPEG_PLAYER_CMD_START);
+
+    /*The frames keep changing while playing*/
+    TEST_ASSERT_TRUE(wait_for_frame(1000));
+    TEST_ASSERT_TRUE(wait_for_frame(1000));
+    lv_refr_now(NULL);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_ffmpeg_pause_and_resume(void)
+{
+#if LV_USE_FFMPEG
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_ffmpeg_player_set_src(player, VIDEO_PATH));
+    lv_ffmpeg_player_set_cmd(player, LV_FFMPEG_PLAYER_CMD_START);
+    TEST_ASSERT_TRUE(wait_for_frame(1000));
+
+    lv_ffmpeg_player_set_cmd(player, LV_FFMPEG_PLAYER_CMD_PAUSE);
+    TEST_ASSERT_FALSE(wait_for_frame(300));
+
+    lv_ffmpeg_player_set_cmd(player, LV_FFMPEG_PLAYER_CMD_RESUME);
+    TEST_ASSERT_TRUE(wait_for_frame(1000));
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_ffmpeg_seek_to_start(void)
+{
+#if LV_USE_FFMPEG
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_ffmpeg_player_set_src(player, VIDEO_PATH));
+    lv_ffmpeg_player_set_cmd(player, LV_FFMPEG_PLAYER_CMD_START);
+    run_timers(500);
+
+    /*Starting again seeks to the beginning while the decoder is running*/
+    lv_ffmpeg_player_set_cmd(player, LV_FFMPEG_PLAYER_CMD_START);
+    TEST_ASSERT_TRUE(wait_for_frame(1000));
+
+    /*Stopping seeks to the beginning and nothing is shown until it's started*/
+    lv_ffmpeg_player_set_cmd(player, LV_FFMPEG_PLAYER_CMD_STOP);
+    TEST_ASSERT_FALSE(wait_for_frame(300));
+    lv_ffmpeg_player_set_cmd(player, LV_FFMPEG_PLAYER_CMD_START);
+    TEST_ASSERT_TRUE(wait_for_frame(1000));
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_ffmpeg_del_while_playing(void)
+{
+#if LV_USE_FFMPEG
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_ffmpeg_player_set_src(player, VIDEO_PATH));
+    lv_ffmpeg_player_set_cmd(player, LV_FFMPEG_PLAYER_CMD_START);
+    run_timers(100);
+
+    /*The decoder thread is stopped and the frame queue is freed*/
+    lv_obj_del(player);
+    player = lv_ffmpeg_player_create(lv_scr_act());
+
+    /*Changing the source while playing closes the previous video too*/
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_ffmpeg_player_set_src(player, VIDEO_PATH));
+    lv_ffmpeg_player_set_cmd(player, LV_FFMPEG_PLAYER_CMD_START);
+    run_timers(100);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_ffmpeg_player_set_src(player, VIDEO_PATH));
+    lv_ffmpeg_player_set_cmd(player, LV_FFMPEG_PLAYER_CMD_START);
+    TEST_ASSERT_TRUE(wait_for_frame(1000));
+#else
+    TEST_PASS();
+#endif
+}
+
+#endif /*LV_BUILD_TEST*/
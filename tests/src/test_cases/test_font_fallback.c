@@ -0,0 +1,190 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+/*Fonts which have the letters in [first, last] and count the searches*/
+typedef struct {
+    uint32_t first;
+    uint32_t last;
+    bool placeholder;
+    uint32_t call_cnt;
+} test_font_dsc_t;
+
+static test_font_dsc_t upper_dsc = {'A', 'Z', false, 0};
+static test_font_dsc_t lower_dsc = {'a', 'z', false, 0};
+static test_font_dsc_t digit_dsc = {'0', '9', false, 0};
+static test_font_dsc_t any_dsc = {0, 0xFFFFFFFF, true, 0};
+
+static lv_font_t upper_font;
+static lv_font_t lower_font;
+static lv_font_t digit_font;
+static lv_font_t placeholder_font;
+
+static bool test_get_glyph_dsc(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t letter,
+                               uint32_t letter_next)
+{
+    LV_UNUSED(letter_next);
+    test_font_dsc_t * dsc = (test_font_dsc_t *)font->dsc;
+    dsc->call_cnt++;
+    if(letter < dsc->first || letter > dsc->last) return false;
+
+    dsc_out->adv_w = font->line_height;
+    dsc_out->box_w = 0;
+    dsc_out->box_h = 0;
+    dsc_out->ofs_x = 0;
+    dsc_out->ofs_y = 0;
+    dsc_out->bpp = 1;
+    dsc_out->is_placeholder = dsc->placeholder;
+    return true;
+}
+
+static void font_init(lv_font_t * font, test_font_dsc_t * dsc, lv_coord_t line_height)
+{
+    lv_memzero(font, sizeof(lv_font_t));
+    font->get_glyph_dsc = test_get_glyph_dsc;
+    font->line_height = line_height;
+    font->dsc = dsc;
+    dsc->call_cnt = 0;
+}
+
+void setUp(void)
+{
+    lv_font_fallback_cache_invalidate(NULL);
+    font_init(&upper_font, &upper_dsc, 10);
+    font_init(&lower_font, &lower_dsc, 11);
+    font_init(&digit_font, &digit_dsc, 12);
+    font_init(&placeholder_font, &any_dsc, 13);
+
+    upper_font.fallback = &lower_font;
+    lower_font.fallback = &digit_font;
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+static void reset_call_cnt(void)
+{
+    upper_dsc.call_cnt = 0;
+    lower_dsc.call_cnt = 0;
+    digit_dsc.call_cnt = 0;
+    any_dsc.call_cnt = 0;
+}
+
+void test_font_fallback_cache_hit(void)
+{
+    lv_font_glyph_dsc_t g;
+
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&upper_font, &g, '5', 0));
+    TEST_ASSERT_EQUAL_PTR(&digit_font, g.resolved_font);
+    TEST_ASSERT_EQUAL(12, g.adv_w);
+    TEST_ASSERT_EQUAL(1, upper_dsc.call_cnt);
+    TEST_ASSERT_EQUAL(1, lower_dsc.call_cnt);
+    TEST_ASSERT_EQUAL(1, digit_dsc.call_cnt);
+
+    /*Only the resolved font is asked again*/
+    reset_call_cnt();
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&upper_font, &g, '5', 0));
+    TEST_ASSERT_EQUAL_PTR(&digit_font, g.resolved_font);
+    TEST_ASSERT_EQUAL(12, g.adv_w);
+    TEST_ASSERT_EQUAL(0, upper_dsc.call_cnt);
+    TEST_ASSERT_EQUAL(0, lower_dsc.call_cnt);
+    TEST_ASSERT_EQUAL(1, digit_dsc.call_cnt);
+
+    /*The fallback fonts are cached independently of the root font*/
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&lower_font, &g, '5', 0));
+    TEST_ASSERT_EQUAL_PTR(&digit_font, g.resolved_font);
+    TEST_ASSERT_EQUAL(1, lower_dsc.call_cnt);
+
+    /*Missing letters are remembered too*/
+    reset_call_cnt();
+    TEST_ASSERT_FALSE(lv_font_get_glyph_dsc(&upper_font, &g, '#', 0));
+    TEST_ASSERT_FALSE(lv_font_get_glyph_dsc(&upper_font, &g, '#', 0));
+    TEST_ASSERT_NULL(g.resolved_font);
+    TEST_ASSERT_TRUE(g.is_placeholder);
+    TEST_ASSERT_EQUAL(10, g.box_h);
+    TEST_ASSERT_EQUAL(1, upper_dsc.call_cnt);
+    TEST_ASSERT_EQUAL(1, lower_dsc.call_cnt);
+    TEST_ASSERT_EQUAL(1, digit_dsc.call_cnt);
+}
+
+void test_font_fallback_cache_chain_change(void)
+{
+    lv_font_glyph_dsc_t g;
+
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&upper_font, &g, 'x', 0));
+    TEST_ASSERT_EQUAL_PTR(&lower_font, g.resolved_font);
+    TEST_ASSERT_FALSE(lv_font_get_glyph_dsc(&upper_font, &g, '#', 0));
+
+    /*Skip the lower case font*/
+    upper_font.fallback = &digit_font;
+    TEST_ASSERT_FALSE(lv_font_get_glyph_dsc(&upper_font, &g, 'x', 0));
+    TEST_ASSERT_NULL(g.resolved_font);
+
+    /*Change the end of the chain*/
+    digit_font.fallback = &placeholder_font;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&upper_font, &g, '#', 0));
+    TEST_ASSERT_EQUAL_PTR(&placeholder_font, g.resolved_font);
+    TEST_ASSERT_TRUE(g.is_placeholder);
+
+    /*Restore the original chain*/
+    upper_font.fallback = &lower_font;
+    digit_font.fallback = NULL;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&upper_font, &g, 'x', 0));
+    TEST_ASSERT_EQUAL_PTR(&lower_font, g.resolved_font);
+    TEST_ASSERT_FALSE(lv_font_get_glyph_dsc(&upper_font, &g, '#', 0));
+}
+
+void test_font_fallback_cache_placeholder(void)
+{
+    lv_font_glyph_dsc_t g;
+
+    /*A real glyph is preferred to a placeholder earlier in the chain*/
+    upper_font.fallback = &placeholder_font;
+    placeholder_font.fallback = &lower_font;
+    lower_font.fallback = NULL;
+
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        reset_call_cnt();
+        TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&upper_font, &g, 'x', 0));
+        TEST_ASSERT_EQUAL_PTR(&lower_font, g.resolved_font);
+        TEST_ASSERT_FALSE(g.is_placeholder);
+
+        TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&upper_font, &g, '#', 0));
+        TEST_ASSERT_EQUAL_PTR(&placeholder_font, g.resolved_font);
+        TEST_ASSERT_TRUE(g.is_placeholder);
+        TEST_ASSERT_EQUAL(13, g.adv_w);
+    }
+
+    /*Second round: only the resolved fonts were asked*/
+    TEST_ASSERT_EQUAL(0, upper_dsc.call_cnt);
+    TEST_ASSERT_EQUAL(1, lower_dsc.call_cnt);
+    TEST_ASSERT_EQUAL(1, any_dsc.call_cnt);
+}
+
+void test_font_fallback_cache_invalidate(void)
+{
+    lv_font_glyph_dsc_t g;
+
+    TEST_ASSERT_FALSE(lv_font_get_glyph_dsc(&upper_font, &g, 0x4E00, 0));
+
+    /*The glyph is added to a font of the chain*/
+    digit_dsc.last = 0x4E00;
+    TEST_ASSERT_FALSE(lv_font_get_glyph_dsc(&upper_font, &g, 0x4E00, 0));
+    lv_font_fallback_cache_invalidate(&digit_font);
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&upper_font, &g, 0x4E00, 0));
+    TEST_ASSERT_EQUAL_PTR(&digit_font, g.resolved_font);
+
+    /*The glyph is removed from the resolved font: found again in the chain*/
+    digit_dsc.last = '9';
+    lower_dsc.last = 0x4E00;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&upper_font, &g, 0x4E00, 0));
+    TEST_ASSERT_EQUAL_PTR(&lower_font, g.resolved_font);
+
+    lower_dsc.last = 'z';
+}
+
+#endif
@@ -11,6 +11,7 @@
 #include "../../lvgl.h"
 
 #include "unity/unity.h"
+#include "lv_test_helpers.h"
 
 /*********************
  *      DEFINES
@@ -25,7 +26,9 @@
  **********************/
 
 static int compare_fonts(lv_font_t * f1, lv_font_t * f2);
+static void compare_bitmaps(lv_font_t * f1, lv_font_t * f2);
 void test_font_loader(void);
+void test_font_loader_lazy(void);
 
 /**********************
  *  STATIC VARIABLES
@@ -72,6 +75,78 @@ void test_font_loader(void)
     lv_font_free(font_3_bin);
 }
 
+void test_font_loader_lazy(void)
+{
+    const char * fns[] = {"A:src/test_assets/font_1.fnt", "A:src/test_assets/font_2.fnt", "A:src/test_assets/font_3.fnt",
+                          "B:src/test_assets/font_1.fnt", "B:src/test_assets/font_2.fnt", "B:src/test_assets/font_3.fnt"
+                         };
+    lv_font_t * fonts[] = {&font_1, &font_2, &font_3, &font_1, &font_2, &font_3};
+
+    /*With and without mapping the file, with large and tiny glyph cache*/
+    lv_fs_drv_t * drv_a = lv_fs_get_drv('A');
+    lv_fs_drv_t * drv_b = lv_fs_get_drv('B');
+    const void * (*mmap_cb_a)(lv_fs_drv_t *, void *, uint32_t *) = drv_a->mmap_cb;
+    const void * (*mmap_cb_b)(lv_fs_drv_t *, void *, uint32_t *) = drv_b->mmap_cb;
+
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        if(i >= 2) {
+            drv_a->mmap_cb = NULL;
+            drv_b->mmap_cb = NULL;
+        }
+        uint32_t cache_size = (i % 2) ? 64 : 8 * 1024;
+
+        uint32_t f;
+        for(f = 0; f < 6; f++) {
+            uint32_t mem_before = lv_test_get_free_mem();
+            lv_font_t * font_bin = lv_font_load_lazy(fns[f], cache_size);
+            TEST_ASSERT_NOT_NULL(font_bin);
+            TEST_ASSERT_NULL(((lv_font_fmt_txt_dsc_t *)font_bin->dsc)->glyph_bitmap);
+
+            compare_fonts(fonts[f], font_bin);
+            compare_bitmaps(fonts[f], font_bin);
+            /*Again, from the cache*/
+            compare_bitmaps(fonts[f], font_bin);
+            lv_font_free(font_bin);
+
+            /*The cached glyphs are freed too. The first round allocates some global caches.*/
+            if(i > 0) TEST_ASSERT_EQUAL_UINT32(mem_before, lv_test_get_free_mem());
+        }
+    }
+
+    drv_a->mmap_cb = mmap_cb_a;
+    drv_b->mmap_cb = mmap_cb_b;
+
+    TEST_ASSERT_NULL(lv_font_load_lazy("A:src/test_assets/not_exists.fnt", 1024));
+}
+
+/*Compare the bitmaps returned for the letters, i.e. the way they are drawn*/
+static void compare_bitmaps(lv_font_t * f1, lv_font_t * f2)
+{
+    static uint8_t bmp1[64 * 64];
+    uint32_t letter;
+    for(letter = 0x20; letter < 0x3000; letter++) {
+        lv_font_glyph_dsc_t g1;
+        lv_font_glyph_dsc_t g2;
+        bool found1 = lv_font_get_glyph_dsc(f1, &g1, letter, 0);
+        bool found2 = lv_font_get_glyph_dsc(f2, &g2, letter, 0);
+        TEST_ASSERT_EQUAL(found1, found2);
+        if(!found1 || g1.is_placeholder || g1.box_w * g1.box_h == 0) continue;
+
+        uint32_t size = (g1.box_w * g1.box_h * g1.bpp + 7) / 8;
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(sizeof(bmp1), size);
+
+        /*Compressed bitmaps are returned in a shared buffer*/
+        const uint8_t * b1 = lv_font_get_glyph_bitmap(f1, letter);
+        TEST_ASSERT_NOT_NULL(b1);
+        lv_memcpy(bmp1, b1, size);
+
+        const uint8_t * b2 = lv_font_get_glyph_bitmap(f2, letter);
+        TEST_ASSERT_NOT_NULL(b2);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(bmp1, b2, size);
+    }
+}
+
 static int compare_fonts(lv_font_t * f1, lv_font_t * f2)
 {
     TEST_ASSERT_NOT_NULL_MESSAGE(f1, "font not null");
@@ -191,7 +266,8 @@ static int compare_fonts(lv_font_t * f1, lv_font_t * f2)
     lv_font_fmt_txt_glyph_dsc_t * glyph_dsc2 = (lv_font_fmt_txt_glyph_dsc_t *)dsc2->glyph_dsc;
 
     for(int i = 0; i < total_glyphs; ++i) {
-        if(i < total_glyphs - 1) {
+        /*The bitmaps of lazy fonts are compared by compare_bitmaps()*/
+        if(i < total_glyphs - 1 && dsc2->glyph_bitmap) {
             int size1 = glyph_dsc1[i + 1].bitmap_index - glyph_dsc1[i].bitmap_index;
 
             if(size1 > 0) {
@@ -0,0 +1,109 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+LV_FONT_SDF_DECLARE(test_font_sdf)
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_font_sdf_metrics(void)
+{
+    const lv_font_t * src_font = test_font_sdf.font;
+    lv_font_t * font_32 = lv_font_sdf_create(&test_font_sdf, 32);
+    lv_font_t * font_64 = lv_font_sdf_create(&test_font_sdf, 64);
+    lv_font_t * font_16 = lv_font_sdf_create(&test_font_sdf, 16);
+
+    TEST_ASSERT_EQUAL(src_font->line_height, font_32->line_height);
+    TEST_ASSERT_EQUAL(src_font->base_line, font_32->base_line);
+    TEST_ASSERT_EQUAL(2 * src_font->line_height, font_64->line_height);
+    TEST_ASSERT_EQUAL((src_font->line_height + 1) / 2, font_16->line_height);
+
+    lv_font_glyph_dsc_t g_src;
+    lv_font_glyph_dsc_t g;
+    lv_font_get_glyph_dsc(src_font, &g_src, 'A', '\0');
+    TEST_ASSERT_EQUAL(8, g_src.bpp);
+
+    /*Same size: same box*/
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font_32, &g, 'A', '\0'));
+    TEST_ASSERT_EQUAL(LV_FONT_SDF_BPP, g.bpp);
+    TEST_ASSERT_EQUAL_PTR(font_32, g.resolved_font);
+    TEST_ASSERT_EQUAL(g_src.adv_w, g.adv_w);
+    TEST_ASSERT_EQUAL(g_src.box_w, g.box_w);
+    TEST_ASSERT_EQUAL(g_src.box_h, g.box_h);
+    TEST_ASSERT_EQUAL(g_src.ofs_x, g.ofs_x);
+    TEST_ASSERT_EQUAL(g_src.ofs_y, g.ofs_y);
+
+    /*Double size: the box is scaled*/
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font_64, &g, 'A', '\0'));
+    TEST_ASSERT_EQUAL(2 * g_src.adv_w, g.adv_w);
+    TEST_ASSERT_EQUAL(2 * g_src.box_w, g.box_w);
+    TEST_ASSERT_EQUAL(2 * g_src.ofs_x, g.ofs_x);
+
+    /*Half size: the box covers all the touched pixels*/
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font_16, &g, 'A', '\0'));
+    TEST_ASSERT_LESS_OR_EQUAL(g_src.ofs_x, 2 * g.ofs_x);
+    TEST_ASSERT_GREATER_OR_EQUAL(g_src.ofs_x + g_src.box_w, 2 * (g.ofs_x + g.box_w));
+
+    /*The bitmap describes how to sample the distance field*/
+    const lv_font_sdf_glyph_t * glyph = (const lv_font_sdf_glyph_t *)lv_font_get_glyph_bitmap(font_64, 'A');
+    TEST_ASSERT_NOT_NULL(glyph);
+    TEST_ASSERT_EQUAL_PTR(lv_font_get_glyph_bitmap(src_font, 'A'), glyph->map);
+    TEST_ASSERT_EQUAL(g_src.box_w, glyph->w);
+    TEST_ASSERT_EQUAL(g_src.box_h, glyph->h);
+    TEST_ASSERT_EQUAL(128, glyph->step);
+
+    /*Missing glyph*/
+    TEST_ASSERT_FALSE(lv_font_get_glyph_dsc(font_32, &g, 0x4E00, '\0'));
+
+    lv_font_sdf_del(font_16);
+    lv_font_sdf_del(font_64);
+    lv_font_sdf_del(font_32);
+}
+
+void test_font_sdf_render(void)
+{
+    static const uint16_t sizes[] = {12, 16, 24, 32, 48, 80};
+    lv_font_t * fonts[sizeof(sizes) / sizeof(sizes[0])];
+
+    lv_obj_t * cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+    lv_obj_set_style_pad_row(cont, 0, 0);
+
+    uint32_t i;
+    for(i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        fonts[i] = lv_font_sdf_create(&test_font_sdf, sizes[i]);
+        TEST_ASSERT_NOT_NULL(fonts[i]);
+
+        lv_obj_t * label = lv_label_create(cont);
+        lv_obj_set_style_text_font(label, fonts[i], 0);
+        lv_label_set_text_fmt(label, "Quick brown fox %d px", sizes[i]);
+    }
+
+    /*Clipped and transparent letters*/
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_obj_set_style_text_font(label, fonts[4], 0);
+    lv_obj_set_style_text_opa(label, LV_OPA_50, 0);
+    lv_obj_set_style_text_color(label, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_label_set_text(label, "Clipped");
+    lv_obj_set_pos(label, 700, 440);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("font_sdf_1.png");
+
+    lv_obj_clean(lv_scr_act());
+    for(i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        lv_font_sdf_del(fonts[i]);
+    }
+}
+
+#endif
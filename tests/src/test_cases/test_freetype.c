@@ -0,0 +1,178 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+/*FreeType is enabled only if the library is found, see tests/CMakeLists.txt*/
+#if LV_USE_FREETYPE
+
+#define FONT_PATH   "../examples/libs/freetype/Lato-Regular.ttf"
+
+static lv_font_t * font;
+
+static void run_timers(uint32_t ms)
+{
+    uint32_t i;
+    for(i = 0; i < ms; i++) {
+        lv_tick_inc(1);
+        lv_timer_handler();
+    }
+}
+#endif
+
+void setUp(void)
+{
+#if LV_USE_FREETYPE
+    font = lv_freetype_font_create(FONT_PATH, 24, LV_FREETYPE_FONT_STYLE_NORMAL);
+    TEST_ASSERT_NOT_NULL(font);
+#endif
+}
+
+void tearDown(void)
+{
+#if LV_USE_FREETYPE
+    lv_obj_clean(lv_scr_act());
+    lv_freetype_font_del(font);
+    font = NULL;
+#endif
+}
+
+void test_freetype_glyphs(void)
+{
+#if LV_USE_FREETYPE
+    TEST_ASSERT_GREATER_THAN(0, lv_font_get_line_height(font));
+
+    lv_font_glyph_dsc_t g;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g, 'A', '\0'));
+    TEST_ASSERT_GREATER_THAN(0, g.adv_w);
+    TEST_ASSERT_GREATER_THAN(0, g.box_w);
+    TEST_ASSERT_GREATER_THAN(0, g.box_h);
+    TEST_ASSERT_EQUAL(8, g.bpp);
+    TEST_ASSERT_NOT_NULL(lv_font_get_glyph_bitmap(font, 'A'));
+
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_label_set_text(label, "Hello FreeType");
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN(0, lv_obj_get_width(label));
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_freetype_stats_count_the_cache_hits(void)
+{
+#if LV_USE_FREETYPE
+    lv_freetype_stats_t s1;
+    lv_freetype_stats_t s2;
+    lv_font_glyph_dsc_t g;
+
+    lv_freetype_get_stats(&s1);
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g, 'x', '\0'));
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g, 'x', '\0'));
+    lv_freetype_get_stats(&s2);
+
+    TEST_ASSERT_EQUAL_UINT32(s1.miss_cnt + 1, s2.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(s1.hit_cnt + 1, s2.hit_cnt);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_freetype_warm_up(void)
+{
+#if LV_USE_FREETYPE
+    const char * txt = "Warm up these glyphs: 0123456789";
+    lv_freetype_font_warm_up(font, txt);
+    TEST_ASSERT_TRUE(lv_freetype_font_is_warming_up(font));
+
+    run_timers(1000);
+    TEST_ASSERT_FALSE(lv_freetype_font_is_warming_up(font));
+
+    /*All the glyphs should be found in the cache now*/
+    lv_freetype_stats_t s1;
+    lv_freetype_stats_t s2;
+    lv_freetype_get_stats(&s1);
+    uint32_t i = 0;
+    while(txt[i] != '\0') {
+        lv_font_glyph_dsc_t g;
+        TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g, (uint8_t)txt[i], '\0'));
+        i++;
+    }
+    lv_freetype_get_stats(&s2);
+    TEST_ASSERT_EQUAL_UINT32(s1.miss_cnt, s2.miss_cnt);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_freetype_del_while_warming_up(void)
+{
+#if LV_USE_FREETYPE
+    lv_freetype_font_warm_up(font, "Deleted before the glyphs are rendered");
+    TEST_ASSERT_TRUE(lv_freetype_font_is_warming_up(font));
+
+    lv_freetype_font_del(font);
+    font = lv_freetype_font_create(FONT_PATH, 24, LV_FREETYPE_FONT_STYLE_NORMAL);
+    TEST_ASSERT_NOT_NULL(font);
+
+    /*The timer of the deleted font must not run*/
+    run_timers(100);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_freetype_set_cache_size(void)
+{
+#if LV_USE_FREETYPE
+    lv_font_glyph_dsc_t g;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g, 'A', '\0'));
+
+    /*The existing fonts keep working with the new caches*/
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_freetype_set_cache_size(2, 4, 128 * 1024));
+    lv_font_glyph_dsc_t g2;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g2, 'A', '\0'));
+    TEST_ASSERT_EQUAL(g.box_w, g2.box_w);
+    TEST_ASSERT_EQUAL(g.box_h, g2.box_h);
+
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_freetype_set_cache_size(LV_FREETYPE_CACHE_FT_FACES, LV_FREETYPE_CACHE_FT_SIZES,
+                                                             LV_FREETYPE_CACHE_SIZE));
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_freetype_styles(void)
+{
+#if LV_USE_FREETYPE
+    lv_font_t * bold = lv_freetype_font_create(FONT_PATH, 24, LV_FREETYPE_FONT_STYLE_BOLD);
+    lv_font_t * italic = lv_freetype_font_create(FONT_PATH, 24, LV_FREETYPE_FONT_STYLE_ITALIC);
+    TEST_ASSERT_NOT_NULL(bold);
+    TEST_ASSERT_NOT_NULL(italic);
+
+    lv_font_glyph_dsc_t g;
+    lv_font_glyph_dsc_t g_bold;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g, 'W', '\0'));
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(bold, &g_bold, 'W', '\0'));
+    TEST_ASSERT_NOT_NULL(lv_font_get_glyph_bitmap(bold, 'W'));
+    TEST_ASSERT_GREATER_OR_EQUAL(g.box_w, g_bold.box_w);
+
+    lv_freetype_font_del(bold);
+    lv_freetype_font_del(italic);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_freetype_invalid_file(void)
+{
+#if LV_USE_FREETYPE
+    TEST_ASSERT_NULL(lv_freetype_font_create("../examples/libs/freetype/not_exists.ttf", 24,
+                                             LV_FREETYPE_FONT_STYLE_NORMAL));
+#else
+    TEST_PASS();
+#endif
+}
+
+#endif /*LV_BUILD_TEST*/
@@ -80,6 +80,102 @@ void test_read_random(void)
     read_random_drv('B', 1024);
 }
 
+void test_mmap(void)
+{
+    const char * fns[] = {"A:fs_mmap.bin", "B:fs_mmap.bin"};
+    uint8_t buf[300];
+    uint32_t i;
+    for(i = 0; i < sizeof(buf); i++) buf[i] = (uint8_t)(i * 7);
+
+    for(i = 0; i < 2; i++) {
+        lv_fs_file_t f;
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, fns[i], LV_FS_MODE_WR));
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, buf, sizeof(buf), NULL));
+        lv_fs_close(&f);
+
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, fns[i], LV_FS_MODE_RD));
+        const void * addr;
+        uint32_t size;
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_mmap(&f, &addr, &size));
+        TEST_ASSERT_EQUAL_UINT32(sizeof(buf), size);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(buf, addr, sizeof(buf));
+
+        /*Reading works as usual beside the mapping*/
+        uint8_t rd[16];
+        uint32_t br;
+        lv_fs_seek(&f, 100, LV_FS_SEEK_SET);
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, rd, sizeof(rd), &br));
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(&buf[100], rd, sizeof(rd));
+
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_munmap(&f, addr, size));
+        lv_fs_close(&f);
+    }
+
+    /*Drivers without mmap support*/
+    lv_fs_drv_t * drv = lv_fs_get_drv('A');
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, fns[0], LV_FS_MODE_RD));
+    const void * (*mmap_cb)(lv_fs_drv_t *, void *, uint32_t *) = drv->mmap_cb;
+    drv->mmap_cb = NULL;
+    const void * addr;
+    uint32_t size;
+    TEST_ASSERT_EQUAL(LV_FS_RES_NOT_IMP, lv_fs_mmap(&f, &addr, &size));
+    TEST_ASSERT_NULL(addr);
+    drv->mmap_cb = mmap_cb;
+    lv_fs_close(&f);
+}
+
+static uint32_t read_async_ready_cnt;
+
+static void read_async_ready_cb(lv_fs_read_req_t * req)
+{
+    uint32_t * ready_order = req->user_data;
+    *ready_order = ++read_async_ready_cnt;
+}
+
+void test_read_async(void)
+{
+    /*Each request uses its own file as the files can't be shared while reading*/
+    const char * fns[] = {"A:src/test_files/readtest.txt", "B:src/test_files/readtest.txt", "A:src/test_files/readtest.txt"};
+    const uint32_t pos[] = {0, 100, 700};
+    lv_fs_file_t f[3];
+    lv_fs_read_req_t req[3];
+    char buf[3][100];
+    uint32_t ready_order[3] = {0};
+    uint32_t i;
+
+    read_async_ready_cnt = 0;
+    for(i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f[i], fns[i], LV_FS_MODE_RD));
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read_async(&f[i], &req[i], pos[i], buf[i], sizeof(buf[i]),
+                                                         read_async_ready_cb, &ready_order[i]));
+    }
+
+    /*The results are delivered only by lv_timer_handler()*/
+    TEST_ASSERT_EQUAL_UINT32(0, read_async_ready_cnt);
+
+    for(i = 0; i < 5000 && lv_worker_get_pending_cnt(); i++) {
+        usleep(1000);
+        lv_tick_inc(1);
+        lv_timer_handler();
+    }
+    TEST_ASSERT_EQUAL_UINT32(3, read_async_ready_cnt);
+
+    for(i = 0; i < 3; i++) {
+        TEST_ASSERT_NOT_EQUAL(0, ready_order[i]);
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, req[i].res);
+        TEST_ASSERT_EQUAL_MEMORY(read_exp + pos[i], buf[i], LV_MIN(req[i].br, strlen(read_exp) - pos[i]));
+        lv_fs_close(&f[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(100, req[0].br);
+    TEST_ASSERT_EQUAL_UINT32(745 - 700, req[2].br);    /*Until the end of the file*/
+
+    /*Not opened file*/
+    lv_fs_file_t f_inv;
+    lv_memzero(&f_inv, sizeof(f_inv));
+    TEST_ASSERT_EQUAL(LV_FS_RES_INV_PARAM, lv_fs_read_async(&f_inv, &req[0], 0, buf[0], 10, read_async_ready_cb, NULL));
+}
+
 /**
  * Read bytes from the `from` index to the `to index`
  * Assume that file `f` has 256 byte of content 0..255
@@ -0,0 +1,363 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define TXT_PATH    "src/test_files/readtest.txt"
+#define TXT_SIZE    745
+#define BLOCK_CNT   ((TXT_SIZE + LV_FS_CACHE_BLOCK_SIZE - 1) / LV_FS_CACHE_BLOCK_SIZE)
+
+static char read_exp[TXT_SIZE];
+
+/*Read the whole file with an odd chunk size which is not aligned with the blocks*/
+static void read_all(const char * path)
+{
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, path, LV_FS_MODE_RD));
+
+    uint8_t buf[79];
+    uint32_t cnt = 0;
+    uint32_t br = 1;
+    while(br) {
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, sizeof(buf), &br));
+        if(br) TEST_ASSERT_EQUAL_MEMORY(read_exp + cnt, buf, br);
+        cnt += br;
+    }
+    TEST_ASSERT_EQUAL_UINT32(TXT_SIZE, cnt);
+
+    lv_fs_close(&f);
+}
+
+static void write_file(const char * path, uint8_t seed)
+{
+    uint8_t buf[300];
+    uint32_t i;
+    for(i = 0; i < sizeof(buf); i++) buf[i] = (uint8_t)(i + seed);
+
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, path, LV_FS_MODE_WR));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, buf, sizeof(buf), NULL));
+    lv_fs_close(&f);
+}
+
+/*A driver reading a file from the memory which can use the cache while reading*/
+typedef struct {
+    uint32_t pos;
+} mem_file_t;
+
+static uint8_t mem_file_data[300];
+static bool mem_read_nested;
+
+static void * mem_open_cb(lv_fs_drv_t * drv, const char * path, lv_fs_mode_t mode)
+{
+    LV_UNUSED(drv);
+    LV_UNUSED(path);
+    LV_UNUSED(mode);
+    mem_file_t * f = lv_malloc(sizeof(mem_file_t));
+    f->pos = 0;
+    return f;
+}
+
+static lv_fs_res_t mem_close_cb(lv_fs_drv_t * drv, void * file_p)
+{
+    LV_UNUSED(drv);
+    lv_free(file_p);
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t mem_read_cb(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_t btr, uint32_t * br)
+{
+    LV_UNUSED(drv);
+    if(mem_read_nested) {
+        /*It would deadlock if the cache was locked*/
+        mem_read_nested = false;
+        read_all("A:" TXT_PATH);
+        lv_fs_cache_invalidate("Z:mem");
+    }
+
+    mem_file_t * f = file_p;
+    *br = LV_MIN(btr, sizeof(mem_file_data) - f->pos);
+    lv_memcpy(buf, mem_file_data + f->pos, *br);
+    f->pos += *br;
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t mem_seek_cb(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence)
+{
+    LV_UNUSED(drv);
+    mem_file_t * f = file_p;
+    if(whence == LV_FS_SEEK_CUR) pos += f->pos;
+    else if(whence == LV_FS_SEEK_END) pos += sizeof(mem_file_data);
+    f->pos = LV_MIN(pos, sizeof(mem_file_data));
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t mem_tell_cb(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p)
+{
+    LV_UNUSED(drv);
+    *pos_p = ((mem_file_t *)file_p)->pos;
+    return LV_FS_RES_OK;
+}
+
+static void mem_drv_register(void)
+{
+    static lv_fs_drv_t drv;
+    if(drv.letter) return;
+
+    uint32_t i;
+    for(i = 0; i < sizeof(mem_file_data); i++) mem_file_data[i] = (uint8_t)(i * 3);
+
+    lv_fs_drv_init(&drv);
+    drv.letter = 'Z';
+    drv.open_cb = mem_open_cb;
+    drv.close_cb = mem_close_cb;
+    drv.read_cb = mem_read_cb;
+    drv.seek_cb = mem_seek_cb;
+    drv.tell_cb = mem_tell_cb;
+    lv_fs_drv_register(&drv);
+}
+
+void setUp(void)
+{
+    /*Read the reference without the cache*/
+    lv_fs_cache_set_mem_size(0);
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "B:" TXT_PATH, LV_FS_MODE_RD));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, read_exp, TXT_SIZE, NULL));
+    lv_fs_close(&f);
+
+    lv_fs_cache_set_mem_size(64 * 1024);
+}
+
+void tearDown(void)
+{
+    lv_fs_cache_invalidate(NULL);
+    lv_fs_cache_set_mem_size(0);
+}
+
+void test_fs_cache_read(void)
+{
+    lv_fs_cache_stats_t stats;
+    lv_fs_cache_stats_t stats_first;
+
+    read_all("A:" TXT_PATH);
+    read_all("B:" TXT_PATH);
+
+    /*The blocks are cached separately for each driver*/
+    lv_fs_cache_get_stats(&stats_first);
+    TEST_ASSERT_EQUAL_UINT32(2 * BLOCK_CNT, stats_first.entry_cnt);
+
+    /*The blocks remain available after closing the files*/
+    read_all("A:" TXT_PATH);
+    read_all("B:" TXT_PATH);
+    lv_fs_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(stats_first.miss_cnt, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(stats_first.read_ahead_cnt, stats.read_ahead_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(stats_first.hit_cnt, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2 * BLOCK_CNT, stats.entry_cnt);
+}
+
+void test_fs_cache_read_ahead(void)
+{
+    /*The counters are not reset between the tests*/
+    lv_fs_cache_stats_t stats_start;
+    lv_fs_cache_get_stats(&stats_start);
+
+    read_all("A:" TXT_PATH);
+
+    /*Every miss reads the next LV_FS_CACHE_READ_AHEAD blocks too*/
+    lv_fs_cache_stats_t stats;
+    lv_fs_cache_get_stats(&stats);
+    uint32_t miss_exp = (BLOCK_CNT + LV_FS_CACHE_READ_AHEAD) / (LV_FS_CACHE_READ_AHEAD + 1);
+    TEST_ASSERT_EQUAL_UINT32(miss_exp, stats.miss_cnt - stats_start.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(BLOCK_CNT - miss_exp, stats.read_ahead_cnt - stats_start.read_ahead_cnt);
+    TEST_ASSERT_EQUAL_UINT32(BLOCK_CNT, stats.entry_cnt);
+
+    /*No read ahead on random access*/
+    lv_fs_cache_invalidate(NULL);
+    lv_fs_cache_get_stats(&stats);
+    uint32_t read_ahead_cnt = stats.read_ahead_cnt;
+
+    lv_fs_file_t f;
+    char buf[10];
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "A:" TXT_PATH, LV_FS_MODE_RD));
+    lv_fs_seek(&f, 5 * LV_FS_CACHE_BLOCK_SIZE, LV_FS_SEEK_SET);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, sizeof(buf), NULL));
+    TEST_ASSERT_EQUAL_MEMORY(read_exp + 5 * LV_FS_CACHE_BLOCK_SIZE, buf, sizeof(buf));
+    lv_fs_seek(&f, 2 * LV_FS_CACHE_BLOCK_SIZE, LV_FS_SEEK_SET);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, sizeof(buf), NULL));
+    TEST_ASSERT_EQUAL_MEMORY(read_exp + 2 * LV_FS_CACHE_BLOCK_SIZE, buf, sizeof(buf));
+    lv_fs_close(&f);
+
+    lv_fs_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(read_ahead_cnt, stats.read_ahead_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.entry_cnt);
+}
+
+void test_fs_cache_seek_tell(void)
+{
+    lv_fs_file_t f;
+    uint32_t pos;
+    uint32_t br;
+    char buf[100];
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "A:" TXT_PATH, LV_FS_MODE_RD));
+
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_seek(&f, 0, LV_FS_SEEK_END));
+    lv_fs_tell(&f, &pos);
+    TEST_ASSERT_EQUAL_UINT32(TXT_SIZE, pos);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, sizeof(buf), &br));
+    TEST_ASSERT_EQUAL_UINT32(0, br);
+
+    lv_fs_seek(&f, 100, LV_FS_SEEK_SET);
+    lv_fs_read(&f, buf, 10, &br);
+    lv_fs_tell(&f, &pos);
+    TEST_ASSERT_EQUAL_UINT32(110, pos);
+
+    /*Across a block boundary*/
+    lv_fs_seek(&f, 10, LV_FS_SEEK_CUR);
+    lv_fs_read(&f, buf, sizeof(buf), &br);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(buf), br);
+    TEST_ASSERT_EQUAL_MEMORY(read_exp + 120, buf, sizeof(buf));
+
+    /*Until the end of the file*/
+    lv_fs_seek(&f, TXT_SIZE - 20, LV_FS_SEEK_SET);
+    lv_fs_read(&f, buf, sizeof(buf), &br);
+    TEST_ASSERT_EQUAL_UINT32(20, br);
+    TEST_ASSERT_EQUAL_MEMORY(read_exp + TXT_SIZE - 20, buf, 20);
+
+    lv_fs_close(&f);
+}
+
+void test_fs_cache_write_invalidates(void)
+{
+    uint8_t buf[300];
+    lv_fs_file_t f;
+
+    write_file("A:fs_cache.bin", 0);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "A:fs_cache.bin", LV_FS_MODE_RD));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, sizeof(buf), NULL));
+    TEST_ASSERT_EQUAL_UINT8(10, buf[10]);
+    lv_fs_close(&f);
+
+    /*Writing the file frees its blocks*/
+    write_file("A:fs_cache.bin", 7);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "A:fs_cache.bin", LV_FS_MODE_RD));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, sizeof(buf), NULL));
+    TEST_ASSERT_EQUAL_UINT8(17, buf[10]);
+    TEST_ASSERT_EQUAL_UINT8((uint8_t)(299 + 7), buf[299]);
+    lv_fs_close(&f);
+
+    lv_fs_cache_stats_t stats;
+    lv_fs_cache_invalidate("fs_cache.bin");
+    lv_fs_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.mem_size);
+}
+
+void test_fs_cache_invalidate_with_driver_letter(void)
+{
+    lv_fs_cache_stats_t stats;
+    read_all("A:" TXT_PATH);
+    lv_fs_cache_get_stats(&stats);
+    uint32_t entry_cnt_a = stats.entry_cnt;
+    read_all("B:" TXT_PATH);
+
+    /*Only the blocks read through 'B' are freed*/
+    lv_fs_cache_invalidate("B:" TXT_PATH);
+    lv_fs_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(entry_cnt_a, stats.entry_cnt);
+
+    /*Without letter the blocks of all drivers are freed*/
+    read_all("B:" TXT_PATH);
+    lv_fs_cache_invalidate(TXT_PATH);
+    lv_fs_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.entry_cnt);
+}
+
+void test_fs_cache_resize_keeps_the_blocks(void)
+{
+    lv_fs_cache_stats_t stats_first;
+    lv_fs_cache_stats_t stats;
+    read_all("A:" TXT_PATH);
+    read_all("B:" TXT_PATH);
+    lv_fs_cache_get_stats(&stats_first);
+
+    /*The blocks are found in the larger and in the smaller hash table too*/
+    lv_fs_cache_set_mem_size(1024 * 1024);
+    read_all("A:" TXT_PATH);
+    lv_fs_cache_set_mem_size(2 * BLOCK_CNT * (LV_FS_CACHE_BLOCK_SIZE + 64));
+    read_all("B:" TXT_PATH);
+
+    lv_fs_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(stats_first.miss_cnt, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(stats_first.read_ahead_cnt, stats.read_ahead_cnt);
+    TEST_ASSERT_EQUAL_UINT32(stats_first.entry_cnt, stats.entry_cnt);
+
+    /*Freeing the blocks of a file leaves the others findable*/
+    lv_fs_cache_invalidate("A:" TXT_PATH);
+    read_all("B:" TXT_PATH);
+    lv_fs_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(stats_first.miss_cnt, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(BLOCK_CNT, stats.entry_cnt);
+}
+
+void test_fs_cache_driver_reads_without_the_lock(void)
+{
+    mem_drv_register();
+    read_all("A:" TXT_PATH);
+
+    lv_fs_cache_stats_t stats_start;
+    lv_fs_cache_stats_t stats;
+    lv_fs_cache_get_stats(&stats_start);
+
+    /*The driver reads an other file through the cache and invalidates its own blocks while loading them*/
+    uint8_t buf[100];
+    lv_fs_file_t f;
+    mem_read_nested = true;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "Z:mem", LV_FS_MODE_RD));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, sizeof(buf), NULL));
+    TEST_ASSERT_EQUAL_MEMORY(mem_file_data, buf, sizeof(buf));
+    TEST_ASSERT_FALSE(mem_read_nested);
+
+    /*The invalidated blocks were not kept*/
+    lv_fs_cache_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN_UINT32(stats_start.hit_cnt, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(stats_start.entry_cnt, stats.entry_cnt);
+
+    /*Without invalidation the blocks are cached*/
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, sizeof(buf), NULL));
+    TEST_ASSERT_EQUAL_MEMORY(mem_file_data + sizeof(buf), buf, sizeof(buf));
+    lv_fs_close(&f);
+
+    lv_fs_cache_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN_UINT32(stats_start.entry_cnt, stats.entry_cnt);
+}
+
+void test_fs_cache_evict(void)
+{
+    /*Room only for a few blocks*/
+    uint32_t mem_max = 4 * LV_FS_CACHE_BLOCK_SIZE;
+    lv_fs_cache_set_mem_size(mem_max);
+
+    lv_fs_cache_stats_t stats;
+    read_all("A:" TXT_PATH);
+    lv_fs_cache_get_stats(&stats);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(mem_max, stats.mem_size);
+    TEST_ASSERT_LESS_THAN_UINT32(BLOCK_CNT, stats.entry_cnt);
+    TEST_ASSERT_NOT_EQUAL(0, stats.entry_cnt);
+
+    read_all("B:" TXT_PATH);
+    lv_fs_cache_get_stats(&stats);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(mem_max, stats.mem_size);
+
+    /*Disabling the cache frees all blocks and the files are read directly*/
+    lv_fs_cache_set_mem_size(0);
+    lv_fs_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.entry_cnt);
+
+    read_all("A:" TXT_PATH);
+    lv_fs_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.entry_cnt);
+}
+
+#endif
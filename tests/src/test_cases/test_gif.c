@@ -0,0 +1,201 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+#include <unistd.h>
+
+/*60x80 animation, the frames change only a small area*/
+#define GIF_SRC     "A:../examples/libs/gif/bulb.gif"
+#define GIF_W       60
+#define GIF_H       80
+#define FRAME_SIZE  (GIF_W * GIF_H * LV_COLOR_FORMAT_NATIVE_ALPHA_SIZE)
+#define FRAME_CNT   20
+
+static uint8_t ref_frames[FRAME_CNT][FRAME_SIZE];
+static lv_color_t partial_buf[100 * 100];
+static void * buf_ori;
+static uint32_t buf_size_ori;
+static lv_area_t inv_area;
+static uint32_t inv_cnt;
+static bool inv_cb_added;
+
+static void inv_area_event_cb(lv_event_t * e)
+{
+    lv_area_t * area = lv_event_get_param(e);
+    if(inv_cnt == 0) inv_area = *area;
+    else _lv_area_join(&inv_area, &inv_area, area);
+    inv_cnt++;
+}
+
+static void wait_for_workers(void)
+{
+    uint32_t i;
+    for(i = 0; i < 5000 && lv_worker_get_pending_cnt(); i++) {
+        usleep(1000);
+        lv_tick_inc(1);
+        lv_timer_handler();
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, lv_worker_get_pending_cnt());
+}
+
+/*Show the next frame now by calling the timer directly*/
+static void next_frame(lv_obj_t * obj)
+{
+    lv_gif_t * gifobj = (lv_gif_t *) obj;
+    gifobj->last_call = lv_tick_get() - gifobj->delay;
+    gifobj->timer->timer_cb(gifobj->timer);
+}
+
+void setUp(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    buf_ori = disp->draw_buf_1;
+    buf_size_ori = disp->draw_buf_size;
+    inv_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    if(inv_cb_added) {
+        lv_disp_remove_event(disp, lv_disp_get_event_count(disp) - 1);
+        inv_cb_added = false;
+    }
+    lv_disp_set_draw_buffers(disp, buf_ori, NULL, buf_size_ori, LV_DISP_RENDER_MODE_FULL);
+
+    lv_obj_clean(lv_scr_act());
+    wait_for_workers();
+    lv_refr_now(NULL);
+}
+
+void test_gif_invalidate_frame_area(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    lv_disp_set_draw_buffers(disp, partial_buf, NULL, sizeof(partial_buf), LV_DISP_RENDER_MODE_PARTIAL);
+
+    lv_obj_t * obj = lv_gif_create(lv_scr_act());
+    lv_gif_set_async(obj, false);
+    lv_obj_set_pos(obj, 20, 30);
+    lv_gif_set_src(obj, GIF_SRC);
+
+    /*The first frame covers the whole image*/
+    next_frame(obj);
+    lv_refr_now(NULL);
+
+    lv_area_t obj_area;
+    lv_obj_get_coords(obj, &obj_area);
+
+    lv_disp_add_event(disp, inv_area_event_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+    inv_cb_added = true;
+
+    /*Only the changed rectangles are redrawn*/
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        inv_cnt = 0;
+        next_frame(obj);
+        TEST_ASSERT_NOT_EQUAL(0, inv_cnt);
+        TEST_ASSERT_TRUE(_lv_area_is_in(&inv_area, &obj_area, 0));
+        TEST_ASSERT_LESS_THAN_UINT32(lv_area_get_size(&obj_area) / 4, lv_area_get_size(&inv_area));
+        lv_refr_now(NULL);
+    }
+
+    /*The whole object is redrawn if the image is transformed*/
+    lv_img_set_zoom(obj, 512);
+    lv_refr_now(NULL);
+    lv_obj_get_coords(obj, &obj_area);
+    inv_cnt = 0;
+    next_frame(obj);
+    TEST_ASSERT_NOT_EQUAL(0, inv_cnt);
+    TEST_ASSERT_TRUE(_lv_area_is_in(&obj_area, &inv_area, 0));
+}
+
+void test_gif_async_same_as_sync(void)
+{
+    lv_obj_t * obj = lv_gif_create(lv_scr_act());
+    lv_gif_set_async(obj, false);
+    lv_gif_set_src(obj, GIF_SRC);
+    lv_gif_t * gifobj = (lv_gif_t *) obj;
+
+    uint32_t i;
+    for(i = 0; i < FRAME_CNT; i++) {
+        lv_memcpy(ref_frames[i], gifobj->imgdsc.data, FRAME_SIZE);
+        next_frame(obj);
+    }
+    lv_obj_del(obj);
+
+    /*The next frame is decoded in the background and the buffers are swapped when it's shown*/
+    obj = lv_gif_create(lv_scr_act());
+    lv_gif_set_async(obj, true);
+    lv_gif_set_src(obj, GIF_SRC);
+    gifobj = (lv_gif_t *) obj;
+
+    for(i = 0; i < FRAME_CNT; i++) {
+        TEST_ASSERT_EQUAL_MEMORY(ref_frames[i], gifobj->imgdsc.data, FRAME_SIZE);
+
+        const void * shown = gifobj->imgdsc.data;
+        uint32_t j;
+        for(j = 0; j < 5000 && gifobj->imgdsc.data == shown; j++) {
+            usleep(1000);
+            lv_tick_inc(1);
+            lv_timer_handler();
+        }
+        TEST_ASSERT_NOT_EQUAL(shown, gifobj->imgdsc.data);
+    }
+
+    /*Restarted while decoding in the background*/
+    lv_gif_restart(obj);
+    TEST_ASSERT_TRUE(gifobj->restart_req);
+    wait_for_workers();
+    TEST_ASSERT_FALSE(gifobj->restart_req);
+    TEST_ASSERT_FALSE(gifobj->timer->paused);
+}
+
+void test_gif_del_while_decoding(void)
+{
+    lv_obj_t * obj = lv_gif_create(lv_scr_act());
+    lv_gif_set_async(obj, true);
+    lv_gif_set_src(obj, GIF_SRC);
+
+    /*The pending job frees the gif and its buffer*/
+    lv_gif_set_src(obj, GIF_SRC);
+    lv_obj_del(obj);
+    wait_for_workers();
+}
+
+void test_gif_del_while_decoding_then_deinit(void)
+{
+    _lv_worker_deinit();
+    uint32_t mem_before = lv_test_get_free_mem();
+
+    lv_obj_t * obj = lv_gif_create(lv_scr_act());
+    lv_gif_set_async(obj, true);
+    lv_gif_set_src(obj, GIF_SRC);
+    lv_obj_del(obj);
+    TEST_ASSERT_NOT_EQUAL(0, lv_worker_get_pending_cnt());
+
+    /*The pending job frees the gif and its buffer on deinit too*/
+    _lv_worker_deinit();
+    TEST_ASSERT_EQUAL_UINT32(0, lv_worker_get_pending_cnt());
+    TEST_ASSERT_EQUAL_UINT32(mem_before, lv_test_get_free_mem());
+}
+
+void test_gif_deinit_while_decoding(void)
+{
+    lv_obj_t * obj = lv_gif_create(lv_scr_act());
+    lv_gif_set_async(obj, true);
+    lv_gif_set_src(obj, GIF_SRC);
+    lv_gif_t * gifobj = (lv_gif_t *) obj;
+    TEST_ASSERT_NOT_NULL(gifobj->job);
+
+    _lv_worker_deinit();
+    TEST_ASSERT_NULL(gifobj->job);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_worker_get_pending_cnt());
+
+    /*It can continue after the workers are started again*/
+    next_frame(obj);
+    wait_for_workers();
+    TEST_ASSERT_NOT_NULL(gifobj->gif);
+}
+
+#endif
@@ -0,0 +1,146 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define IMG_W   40
+#define IMG_H   30
+
+extern lv_color_t test_fb[];
+
+static uint8_t img_buf[sizeof(lv_img_header_t) + 256 * sizeof(lv_color32_t) + IMG_W * IMG_H * 4];
+
+/**
+ * Create a "*.bin" image on both test drives. Returns the size of the pixel data.
+ */
+static uint32_t create_img(lv_color_format_t cf, uint32_t file_size_cut)
+{
+    lv_img_header_t * header = (lv_img_header_t *)img_buf;
+    lv_memzero(header, sizeof(lv_img_header_t));
+    header->cf = cf;
+    header->w = IMG_W;
+    header->h = IMG_H;
+
+    uint32_t data_size;
+    if(cf == LV_COLOR_FORMAT_I4) data_size = 16 * sizeof(lv_color32_t) + (IMG_W / 2) * IMG_H;
+    else data_size = IMG_W * IMG_H * lv_color_format_get_size(cf);
+
+    uint8_t * data = img_buf + sizeof(lv_img_header_t);
+    uint32_t i;
+    for(i = 0; i < data_size; i++) data[i] = (uint8_t)(i * 13 + i / 7);
+
+    if(cf == LV_COLOR_FORMAT_I4) {
+        /*Opaque palette*/
+        for(i = 0; i < 16; i++) data[i * 4 + 3] = 0xff;
+    }
+
+    uint32_t size = sizeof(lv_img_header_t) + data_size - file_size_cut;
+    const char * fns[] = {"A:test_img.bin", "B:test_img.bin"};
+    for(i = 0; i < 2; i++) {
+        lv_fs_file_t f;
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, fns[i], LV_FS_MODE_WR));
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, img_buf, size, NULL));
+        lv_fs_close(&f);
+    }
+
+    return data_size;
+}
+
+void setUp(void)
+{
+    lv_img_cache_invalidate_src(NULL);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_img_cache_invalidate_src(NULL);
+}
+
+void test_img_bin_is_mapped(void)
+{
+    uint32_t data_size = create_img(LV_COLOR_FORMAT_NATIVE, 0);
+
+    const char * fns[] = {"A:test_img.bin", "B:test_img.bin"};
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        lv_img_decoder_dsc_t dsc;
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, fns[i], lv_color_black(), 0));
+        TEST_ASSERT_EQUAL(IMG_W, dsc.header.w);
+        TEST_ASSERT_EQUAL(IMG_H, dsc.header.h);
+        TEST_ASSERT_TRUE(dsc.img_data_mapped);
+        TEST_ASSERT_NOT_NULL(dsc.img_data);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(img_buf + sizeof(lv_img_header_t), dsc.img_data, data_size);
+        lv_img_decoder_close(&dsc);
+    }
+}
+
+void test_img_bin_indexed_is_mapped(void)
+{
+    uint32_t data_size = create_img(LV_COLOR_FORMAT_I4, 0);
+
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, "A:test_img.bin", lv_color_black(), 0));
+    TEST_ASSERT_TRUE(dsc.img_data_mapped);
+    TEST_ASSERT_EQUAL_UINT32(16, dsc.palette_size);
+    TEST_ASSERT_NOT_NULL(dsc.palette);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(img_buf + sizeof(lv_img_header_t), dsc.palette, data_size);
+    TEST_ASSERT_EQUAL_PTR((const uint8_t *)dsc.palette + 16 * sizeof(lv_color32_t), dsc.img_data);
+    lv_img_decoder_close(&dsc);
+}
+
+void test_img_bin_too_short_is_not_mapped(void)
+{
+    create_img(LV_COLOR_FORMAT_NATIVE, 10);
+
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, "A:test_img.bin", lv_color_black(), 0));
+    TEST_ASSERT_FALSE(dsc.img_data_mapped);
+    TEST_ASSERT_NULL(dsc.img_data);
+    lv_img_decoder_close(&dsc);
+}
+
+void test_img_bin_uses_no_cache_memory(void)
+{
+    create_img(LV_COLOR_FORMAT_NATIVE, 0);
+
+    _lv_img_cache_entry_t * entry = _lv_img_cache_open("B:test_img.bin", lv_color_black(), 0);
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_TRUE(entry->dec_dsc.img_data_mapped);
+
+    lv_img_cache_stats_t stats;
+    lv_img_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.mem_size);
+}
+
+void test_img_bin_draw(void)
+{
+    create_img(LV_COLOR_FORMAT_I4, 0);
+
+    /*Draw the same image from a variable as a reference*/
+    lv_img_dsc_t img_dsc;
+    lv_memzero(&img_dsc, sizeof(img_dsc));
+    lv_memcpy(&img_dsc.header, img_buf, sizeof(lv_img_header_t));
+    img_dsc.data = img_buf + sizeof(lv_img_header_t);
+    img_dsc.data_size = sizeof(img_buf) - sizeof(lv_img_header_t);
+
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_img_set_src(img, &img_dsc);
+    lv_obj_set_pos(img, 20, 30);
+    lv_refr_now(NULL);
+
+    static lv_color_t ref_fb[800 * 480];
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    lv_img_set_src(img, "A:test_img.bin");
+    lv_refr_now(NULL);
+
+    uint32_t i;
+    for(i = 0; i < 800 * 480; i++) {
+        if(!lv_color_eq(ref_fb[i], test_fb[i])) break;
+    }
+    TEST_ASSERT_EQUAL_UINT32(800 * 480, i);
+}
+
+#endif
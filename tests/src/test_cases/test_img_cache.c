@@ -0,0 +1,392 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+#include <unistd.h>
+#include <string.h>
+
+/*Decoded size of a 100x100 ARGB8888 image*/
+#define IMG_MEM_SIZE    (100 * 100 * 4)
+
+#define IMG_A   "A:../examples/assets/img_cogwheel_argb.png"
+#define IMG_B   "A:../examples/assets/img_cogwheel_rgb.png"
+#define IMG_C   "A:../examples/assets/img_cogwheel_chroma_keyed.png"
+
+/*Recognized only by `test_decoder`*/
+#define IMG_TEST_DECODER   "A:test_decoder.img"
+
+extern lv_color_t test_fb[];
+
+static bool test_decoder_fails;
+
+static const void * open_img(const char * src, uint32_t time_to_open)
+{
+    _lv_img_cache_entry_t * entry = _lv_img_cache_open(src, lv_color_black(), 0);
+    TEST_ASSERT_NOT_NULL(entry);
+
+    /*Make the eviction independent of the real decoding time*/
+    entry->dec_dsc.time_to_open = time_to_open;
+    return entry;
+}
+
+static bool is_cached(const char * src)
+{
+    lv_img_cache_stats_t stats;
+    lv_img_cache_get_stats(&stats);
+    uint32_t hit_cnt = stats.hit_cnt;
+
+    /*Don't evict anything if the image is not cached and opened now*/
+    lv_img_cache_set_mem_size(0);
+    _lv_img_cache_entry_t * entry = _lv_img_cache_open(src, lv_color_black(), 0);
+    lv_img_cache_get_stats(&stats);
+    return entry && stats.hit_cnt == hit_cnt + 1;
+}
+
+static bool fb_equal(const lv_color_t * ref_fb)
+{
+    uint32_t i;
+    for(i = 0; i < 800 * 480; i++) {
+        if(!lv_color_eq(ref_fb[i], test_fb[i])) return false;
+    }
+    return true;
+}
+
+static lv_res_t test_decoder_info(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header)
+{
+    LV_UNUSED(decoder);
+    if(lv_img_src_get_type(src) != LV_IMG_SRC_FILE || strcmp(src, IMG_TEST_DECODER) != 0) return LV_RES_INV;
+
+    header->w = 1;
+    header->h = 1;
+    header->cf = LV_COLOR_FORMAT_NATIVE;
+    return LV_RES_OK;
+}
+
+static lv_res_t test_decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+    if(test_decoder_fails) return LV_RES_INV;
+
+    static lv_color_t px;
+    dsc->img_data = (const uint8_t *)&px;
+    return LV_RES_OK;
+}
+
+static void wait_for_decoding(void)
+{
+    uint32_t i;
+    for(i = 0; i < 5000 && lv_worker_get_pending_cnt(); i++) {
+        usleep(1000);
+        lv_tick_inc(1);
+        lv_timer_handler();
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, lv_worker_get_pending_cnt());
+}
+
+void setUp(void)
+{
+    lv_img_cache_set_size(8);
+    lv_img_cache_set_mem_size(0);
+}
+
+void tearDown(void)
+{
+    lv_img_cache_set_async(false);
+    lv_obj_clean(lv_scr_act());
+    lv_img_cache_invalidate_src(NULL);
+    lv_img_cache_set_size(LV_IMG_CACHE_DEF_SIZE);
+}
+
+void test_img_cache_hit_and_miss(void)
+{
+    lv_img_cache_stats_t stats;
+    lv_img_cache_get_stats(&stats);
+    uint32_t hit_cnt = stats.hit_cnt;
+    uint32_t miss_cnt = stats.miss_cnt;
+
+    const void * e1 = open_img(IMG_A, 10);
+    const void * e2 = open_img(IMG_A, 10);
+    open_img(IMG_B, 10);
+
+    /*Same source, but different color or frame is an other entry*/
+    _lv_img_cache_entry_t * e3 = _lv_img_cache_open(IMG_A, lv_color_white(), 0);
+    _lv_img_cache_entry_t * e4 = _lv_img_cache_open(IMG_A, lv_color_black(), 1);
+
+    lv_img_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_PTR(e1, e2);
+    TEST_ASSERT_TRUE(e1 != (const void *)e3);
+    TEST_ASSERT_TRUE(e1 != (const void *)e4);
+    TEST_ASSERT_EQUAL_UINT32(hit_cnt + 1, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(miss_cnt + 4, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(4, stats.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(4 * IMG_MEM_SIZE, stats.mem_size);
+
+    lv_img_cache_invalidate_src(IMG_A);
+    lv_img_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(IMG_MEM_SIZE, stats.mem_size);
+}
+
+void test_img_cache_variables_use_no_memory(void)
+{
+    LV_IMG_DECLARE(test_img_caret_down);
+    _lv_img_cache_entry_t * entry = _lv_img_cache_open(&test_img_caret_down, lv_color_black(), 0);
+    TEST_ASSERT_NOT_NULL(entry);
+
+    lv_img_cache_stats_t stats;
+    lv_img_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.mem_size);
+}
+
+void test_img_cache_evicts_the_least_recently_used(void)
+{
+    lv_img_cache_stats_t stats;
+    lv_img_cache_get_stats(&stats);
+    uint32_t evict_cnt = stats.evict_cnt;
+
+    open_img(IMG_A, 10);
+    open_img(IMG_B, 10);
+    open_img(IMG_A, 10);    /*A is used more recently than B*/
+
+    /*Only 2 images fit, so B should be closed*/
+    lv_img_cache_set_mem_size(2 * IMG_MEM_SIZE);
+    open_img(IMG_C, 10);
+
+    lv_img_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(evict_cnt + 1, stats.evict_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2 * IMG_MEM_SIZE, stats.mem_size);
+
+    TEST_ASSERT_TRUE(is_cached(IMG_A));
+    TEST_ASSERT_TRUE(is_cached(IMG_C));
+    TEST_ASSERT_FALSE(is_cached(IMG_B));
+}
+
+void test_img_cache_evicts_the_cheapest_from_the_old_ones(void)
+{
+    open_img(IMG_A, 100);
+    open_img(IMG_B, 5);     /*Fast to open again*/
+
+    /*A is the least recently used but B is much cheaper to open again*/
+    lv_img_cache_set_mem_size(2 * IMG_MEM_SIZE);
+    open_img(IMG_C, 100);
+
+    TEST_ASSERT_TRUE(is_cached(IMG_A));
+    TEST_ASSERT_TRUE(is_cached(IMG_C));
+    TEST_ASSERT_FALSE(is_cached(IMG_B));
+}
+
+void test_img_cache_entry_limit(void)
+{
+    lv_img_cache_set_size(2);
+
+    open_img(IMG_A, 10);
+    open_img(IMG_B, 10);
+    open_img(IMG_C, 10);
+
+    lv_img_cache_stats_t stats;
+    lv_img_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.entry_cnt);
+    TEST_ASSERT_FALSE(is_cached(IMG_A));
+}
+
+void test_img_cache_async_decode(void)
+{
+    lv_img_cache_set_async(true);
+
+    _lv_img_cache_entry_t * entry = _lv_img_cache_open(IMG_A, lv_color_black(), 0);
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_TRUE(entry->decoding);
+
+    /*Opening it again while decoding doesn't start a new decoding*/
+    TEST_ASSERT_EQUAL_PTR(entry, _lv_img_cache_open(IMG_A, lv_color_black(), 0));
+
+    lv_img_cache_stats_t stats;
+    lv_img_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.decoding_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.mem_size);
+
+    wait_for_decoding();
+
+    lv_img_cache_get_stats(&stats);
+    TEST_ASSERT_FALSE(entry->decoding);
+    TEST_ASSERT_NOT_NULL(entry->dec_dsc.img_data);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.decoding_cnt);
+    TEST_ASSERT_EQUAL_UINT32(IMG_MEM_SIZE, stats.mem_size);
+    TEST_ASSERT_TRUE(is_cached(IMG_A));
+}
+
+void test_img_cache_async_invalidate_while_decoding(void)
+{
+    lv_img_cache_set_async(true);
+
+    _lv_img_cache_entry_t * entry = _lv_img_cache_open(IMG_A, lv_color_black(), 0);
+    TEST_ASSERT_TRUE(entry->decoding);
+    lv_img_cache_invalidate_src(IMG_A);
+
+    lv_img_cache_stats_t stats;
+    lv_img_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.decoding_cnt);
+
+    /*The result is dropped when it arrives*/
+    wait_for_decoding();
+    lv_img_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.mem_size);
+}
+
+void test_img_cache_async_redraws_when_ready(void)
+{
+    /*Render the image synchronously as a reference*/
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_img_set_src(img, IMG_B);
+    lv_obj_set_pos(img, 20, 30);
+    lv_refr_now(NULL);
+
+    static lv_color_t ref_fb[800 * 480];
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    lv_img_cache_invalidate_src(NULL);
+    lv_img_cache_set_async(true);
+    lv_obj_invalidate(img);
+    lv_refr_now(NULL);
+
+    /*Nothing is drawn while decoding*/
+    TEST_ASSERT_FALSE(fb_equal(ref_fb));
+
+    /*The image is invalidated and drawn when it's decoded*/
+    wait_for_decoding();
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(fb_equal(ref_fb));
+}
+
+void test_img_cache_async_canvas_waits_for_the_image(void)
+{
+    static uint8_t ref_buf[LV_CANVAS_BUF_SIZE_TRUE_COLOR(100, 100)];
+    static uint8_t buf[LV_CANVAS_BUF_SIZE_TRUE_COLOR(100, 100)];
+    lv_draw_img_dsc_t dsc;
+    lv_draw_img_dsc_init(&dsc);
+
+    lv_obj_t * canvas = lv_canvas_create(lv_scr_act());
+    lv_canvas_set_buffer(canvas, ref_buf, 100, 100, LV_COLOR_FORMAT_NATIVE);
+    lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_COVER);
+    lv_canvas_draw_img(canvas, 0, 0, IMG_B, &dsc);
+
+    /*The canvas is not redrawn later, so the image should be decoded before drawing it*/
+    lv_img_cache_invalidate_src(NULL);
+    lv_img_cache_set_async(true);
+    lv_canvas_set_buffer(canvas, buf, 100, 100, LV_COLOR_FORMAT_NATIVE);
+    lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_COVER);
+    lv_canvas_draw_img(canvas, 0, 0, IMG_B, &dsc);
+    TEST_ASSERT_EQUAL_MEMORY(ref_buf, buf, sizeof(buf));
+
+    lv_img_cache_stats_t stats;
+    lv_img_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.decoding_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entry_cnt);
+}
+
+void test_img_cache_async_worker_deinit_finishes_the_jobs(void)
+{
+    lv_img_cache_set_async(true);
+    _lv_worker_deinit();
+    uint32_t mem_before = lv_test_get_free_mem();
+
+    _lv_img_cache_entry_t * entry = _lv_img_cache_open(IMG_A, lv_color_black(), 0);
+    TEST_ASSERT_TRUE(entry->decoding);
+
+    /*Its job only frees the result*/
+    _lv_img_cache_open(IMG_B, lv_color_black(), 0);
+    lv_img_cache_invalidate_src(IMG_B);
+
+    _lv_worker_deinit();
+    TEST_ASSERT_EQUAL_UINT32(0, lv_worker_get_pending_cnt());
+    TEST_ASSERT_FALSE(entry->decoding);
+    TEST_ASSERT_NOT_NULL(entry->dec_dsc.img_data);
+
+    lv_img_cache_stats_t stats;
+    lv_img_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.decoding_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entry_cnt);
+
+    lv_img_cache_invalidate_src(NULL);
+    TEST_ASSERT_EQUAL_UINT32(mem_before, lv_test_get_free_mem());
+}
+
+void test_img_cache_async_only_with_thread_safe_decoders(void)
+{
+    lv_img_decoder_t * dec = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(dec, test_decoder_info);
+    lv_img_decoder_set_open_cb(dec, test_decoder_open);
+    lv_img_cache_set_async(true);
+
+    /*Not thread safe by default, so it's opened right away*/
+    _lv_img_cache_entry_t * entry = _lv_img_cache_open(IMG_TEST_DECODER, lv_color_black(), 0);
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_FALSE(entry->decoding);
+    TEST_ASSERT_EQUAL_PTR(dec, entry->dec_dsc.decoder);
+
+    lv_img_cache_invalidate_src(IMG_TEST_DECODER);
+    lv_img_decoder_set_thread_safe(dec, true);
+    entry = _lv_img_cache_open(IMG_TEST_DECODER, lv_color_black(), 0);
+    TEST_ASSERT_TRUE(entry->decoding);
+
+    wait_for_decoding();
+    TEST_ASSERT_EQUAL_PTR(dec, entry->dec_dsc.decoder);
+
+    lv_img_cache_invalidate_src(IMG_TEST_DECODER);
+    lv_img_decoder_delete(dec);
+}
+
+void test_img_cache_async_retries_failed_images(void)
+{
+    lv_img_decoder_t * dec = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(dec, test_decoder_info);
+    lv_img_decoder_set_open_cb(dec, test_decoder_open);
+    lv_img_decoder_set_thread_safe(dec, true);
+    lv_img_cache_set_async(true);
+    test_decoder_fails = true;
+
+    _lv_img_cache_entry_t * entry = _lv_img_cache_open(IMG_TEST_DECODER, lv_color_black(), 0);
+    wait_for_decoding();
+    TEST_ASSERT_NOT_NULL(entry->dec_dsc.error_msg);
+
+    /*The failure is cached for a while*/
+    TEST_ASSERT_EQUAL_PTR(entry, _lv_img_cache_open(IMG_TEST_DECODER, lv_color_black(), 0));
+    TEST_ASSERT_FALSE(entry->decoding);
+
+    /*Then it's decoded again*/
+    test_decoder_fails = false;
+    lv_tick_inc(1000);
+    entry = _lv_img_cache_open(IMG_TEST_DECODER, lv_color_black(), 0);
+    TEST_ASSERT_TRUE(entry->decoding);
+    wait_for_decoding();
+    TEST_ASSERT_NULL(entry->dec_dsc.error_msg);
+    TEST_ASSERT_NOT_NULL(entry->dec_dsc.img_data);
+
+    lv_img_cache_stats_t stats;
+    lv_img_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entry_cnt);
+
+    lv_img_cache_invalidate_src(IMG_TEST_DECODER);
+    lv_img_decoder_delete(dec);
+}
+
+void test_img_cache_prefetch(void)
+{
+    lv_img_cache_set_async(true);
+    lv_img_cache_prefetch(IMG_C);
+
+    lv_img_cache_stats_t stats;
+    lv_img_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.decoding_cnt);
+
+    wait_for_decoding();
+    TEST_ASSERT_TRUE(is_cached(IMG_C));
+}
+
+#endif
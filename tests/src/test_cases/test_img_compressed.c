@@ -0,0 +1,248 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define IMG_W       100
+#define IMG_H       60
+#define IMG_FN      "A:test_img_rle.bin"
+
+extern lv_color_t test_fb[];
+
+static lv_color_t img_data[IMG_W * IMG_H];
+static lv_img_dsc_t img_dsc;
+static uint8_t rle_data[IMG_W * IMG_H * sizeof(lv_color_t) * 2];
+static lv_img_dsc_t rle_dsc;
+static lv_color_t ref_fb[800 * 480];
+static uint32_t failing_malloc_size;
+
+static void * malloc_stub(size_t size)
+{
+    if(size == failing_malloc_size) return NULL;
+    return lv_test_malloc_normal(size);
+}
+
+/**
+ * RLE compress the rows in the format of the built-in decoder
+ */
+static uint32_t compress(const uint8_t * px, uint32_t px_size, uint8_t * out)
+{
+    uint32_t ofs = (IMG_H + 1) * sizeof(uint32_t);
+    uint32_t y;
+    for(y = 0; y < IMG_H; y++) {
+        lv_memcpy(out + y * sizeof(uint32_t), &ofs, sizeof(uint32_t));
+        const uint8_t * row = px + y * IMG_W * px_size;
+        uint32_t x = 0;
+        while(x < IMG_W) {
+            uint32_t cnt = 1;
+            while(x + cnt < IMG_W && cnt < 128 && memcmp(&row[(x + cnt) * px_size], &row[x * px_size], px_size) == 0) cnt++;
+            if(cnt > 1) {
+                out[ofs++] = 0x80 | (cnt - 1);
+                lv_memcpy(&out[ofs], &row[x * px_size], px_size);
+                ofs += px_size;
+            }
+            else {
+                while(x + cnt < IMG_W && cnt < 128 &&
+                      memcmp(&row[(x + cnt) * px_size], &row[(x + cnt - 1) * px_size], px_size) != 0) cnt++;
+                out[ofs++] = cnt - 1;
+                lv_memcpy(&out[ofs], &row[x * px_size], cnt * px_size);
+                ofs += cnt * px_size;
+            }
+            x += cnt;
+        }
+    }
+    lv_memcpy(out + IMG_H * sizeof(uint32_t), &ofs, sizeof(uint32_t));
+    return ofs;
+}
+
+void setUp(void)
+{
+    /*Stripes with a noisy area*/
+    lv_coord_t x, y;
+    for(y = 0; y < IMG_H; y++) {
+        for(x = 0; x < IMG_W; x++) {
+            lv_color_t c = lv_color_make(y * 4, 0x80, 0xff - y * 4);
+            if(x > 30 && x < 60 && y > 10 && y < 40) c = lv_color_make(x * 7, y * 13, x * y);
+            img_data[y * IMG_W + x] = c;
+        }
+    }
+
+    lv_memzero(&img_dsc, sizeof(lv_img_dsc_t));
+    img_dsc.header.cf = LV_COLOR_FORMAT_NATIVE;
+    img_dsc.header.w = IMG_W;
+    img_dsc.header.h = IMG_H;
+    img_dsc.data = (const uint8_t *)img_data;
+    img_dsc.data_size = sizeof(img_data);
+
+    rle_dsc = img_dsc;
+    rle_dsc.header.compressed = 1;
+    rle_dsc.data = rle_data;
+    rle_dsc.data_size = compress((const uint8_t *)img_data, sizeof(lv_color_t), rle_data);
+
+    failing_malloc_size = 0;
+}
+
+void tearDown(void)
+{
+    lv_test_malloc_set_cb(NULL);
+    lv_obj_clean(lv_scr_act());
+    lv_img_cache_invalidate_src(NULL);
+    lv_img_tile_cache_set_mem_size(LV_IMG_TILE_CACHE_DEF_MEM_SIZE);
+}
+
+static void draw_and_compare(lv_obj_t * img, const void * src)
+{
+    lv_img_set_src(img, &img_dsc);
+    lv_refr_now(NULL);
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    lv_img_set_src(img, src);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+}
+
+void test_img_compressed_draw(void)
+{
+    TEST_ASSERT_LESS_THAN_UINT32(img_dsc.data_size / 2, rle_dsc.data_size);
+
+    /*As images are cached the whole image is decompressed when opened*/
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, &rle_dsc, lv_color_black(), 0));
+    TEST_ASSERT_NOT_NULL(dsc.img_data);
+    TEST_ASSERT_EQUAL_MEMORY(img_data, dsc.img_data, sizeof(img_data));
+    lv_img_decoder_close(&dsc);
+
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_obj_set_pos(img, 30, 20);
+    draw_and_compare(img, &rle_dsc);
+
+    /*Transformations work on the decompressed image too*/
+    lv_img_set_zoom(img, 384);
+    lv_img_set_angle(img, 300);
+    draw_and_compare(img, &rle_dsc);
+}
+
+void test_img_compressed_read_rows(void)
+{
+    /*Without memory for the whole image the rows are decompressed when needed*/
+    failing_malloc_size = sizeof(img_data);
+    lv_test_malloc_set_cb(malloc_stub);
+
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, &rle_dsc, lv_color_black(), 0));
+    TEST_ASSERT_NULL(dsc.img_data);
+
+    static lv_color_t buf[IMG_W * IMG_H];
+    lv_area_t area;
+    lv_area_set(&area, 13, 7, 57, 30);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_tile(&dsc, &area, (uint8_t *)buf));
+
+    lv_coord_t w = lv_area_get_width(&area);
+    lv_coord_t y;
+    for(y = area.y1; y <= area.y2; y++) {
+        TEST_ASSERT_EQUAL_MEMORY(&img_data[y * IMG_W + area.x1], &buf[(y - area.y1) * w], w * sizeof(lv_color_t));
+    }
+    lv_img_decoder_close(&dsc);
+
+    /*Drawn from tiles*/
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_obj_set_pos(img, -20, 50);
+    draw_and_compare(img, &rle_dsc);
+
+    /*Drawn from bands of rows*/
+    lv_img_tile_cache_set_mem_size(0);
+    lv_img_cache_invalidate_src(NULL);
+    draw_and_compare(img, &rle_dsc);
+}
+
+void test_img_compressed_file(void)
+{
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, IMG_FN, LV_FS_MODE_WR));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, &rle_dsc.header, sizeof(lv_img_header_t), NULL));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, rle_data, rle_dsc.data_size, NULL));
+    lv_fs_close(&f);
+
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_obj_set_pos(img, 100, 10);
+    draw_and_compare(img, IMG_FN);
+
+    /*Decompress the rows from the mapped file*/
+    failing_malloc_size = sizeof(img_data);
+    lv_test_malloc_set_cb(malloc_stub);
+    lv_img_cache_invalidate_src(NULL);
+    draw_and_compare(img, IMG_FN);
+
+    /*Read the compressed rows from the file*/
+    lv_fs_drv_t * drv = lv_fs_get_drv('A');
+    const void * (*mmap_cb)(lv_fs_drv_t *, void *, uint32_t *) = drv->mmap_cb;
+    drv->mmap_cb = NULL;
+    lv_img_cache_invalidate_src(NULL);
+    lv_img_tile_cache_set_mem_size(0);
+    draw_and_compare(img, IMG_FN);
+    drv->mmap_cb = mmap_cb;
+}
+
+void test_img_compressed_file_from_script(void)
+{
+    /*Created by `scripts/img_compress.py` from a 40x30 ARGB8888 "*.bin" image*/
+    const char * fn = "A:src/test_files/rle_argb8888.bin";
+    lv_img_header_t header;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_get_info(fn, &header));
+    TEST_ASSERT_EQUAL(LV_COLOR_FORMAT_ARGB8888, header.cf);
+    TEST_ASSERT_EQUAL(1, header.compressed);
+    TEST_ASSERT_EQUAL(40, header.w);
+    TEST_ASSERT_EQUAL(30, header.h);
+
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, fn, lv_color_black(), 0));
+    static uint8_t buf[40 * 30 * 4];
+    lv_area_t area;
+    lv_area_set(&area, 0, 0, 39, 29);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_tile(&dsc, &area, buf));
+    lv_img_decoder_close(&dsc);
+
+    /*Stripes with a semi-transparent noisy area, stored as B, G, R, A*/
+    lv_coord_t x, y;
+    for(y = 0; y < 30; y++) {
+        for(x = 0; x < 40; x++) {
+            uint8_t px[4] = {(uint8_t)(y * 8), 0x80, (uint8_t)(0xff - y * 8), 0xff};
+            if(x >= 10 && x < 20 && y >= 5 && y < 15) {
+                px[0] = (uint8_t)(x * 7);
+                px[1] = (uint8_t)(y * 13);
+                px[2] = (uint8_t)(x * y);
+                px[3] = (uint8_t)(0x80 + x);
+            }
+            TEST_ASSERT_EQUAL_HEX8_ARRAY(px, &buf[(y * 40 + x) * 4], 4);
+        }
+    }
+}
+
+void test_img_compressed_invalid(void)
+{
+    /*The last row is shorter than the image*/
+    rle_dsc.data_size -= 2;
+    uint32_t ofs = rle_dsc.data_size;
+    lv_memcpy(rle_data + IMG_H * sizeof(uint32_t), &ofs, sizeof(uint32_t));
+
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_open(&dsc, &rle_dsc, lv_color_black(), 0));
+
+    /*A row starts in the offset table*/
+    rle_dsc.data_size = compress((const uint8_t *)img_data, sizeof(lv_color_t), rle_data);
+    ofs = 0;
+    lv_memcpy(rle_data, &ofs, sizeof(uint32_t));
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_open(&dsc, &rle_dsc, lv_color_black(), 0));
+
+    /*Without data_size the offsets can't be checked*/
+    rle_dsc.data_size = 0;
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_open(&dsc, &rle_dsc, lv_color_black(), 0));
+    rle_dsc.data_size = IMG_H * sizeof(uint32_t);
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_open(&dsc, &rle_dsc, lv_color_black(), 0));
+
+    /*Not supported color format*/
+    rle_dsc.header.cf = LV_COLOR_FORMAT_I4;
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_open(&dsc, &rle_dsc, lv_color_black(), 0));
+}
+
+#endif
@@ -0,0 +1,197 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+/*A small image and the same image scaled up 4x by repeating the pixels*/
+#define SMALL_W     20
+#define SMALL_H     16
+#define BIG_W       (SMALL_W * 4)
+#define BIG_H       (SMALL_H * 4)
+#define PX_SIZE     LV_COLOR_FORMAT_NATIVE_ALPHA_SIZE
+
+extern lv_color_t test_fb[];
+
+static uint8_t small_data[SMALL_W * SMALL_H * PX_SIZE];
+static uint8_t big_data[BIG_W * BIG_H * PX_SIZE];
+static lv_img_dsc_t small_img;
+static lv_img_dsc_t big_img;
+
+static void init_img(lv_img_dsc_t * img, uint8_t * data, lv_coord_t w, lv_coord_t h)
+{
+    lv_memzero(img, sizeof(lv_img_dsc_t));
+    img->header.cf = LV_COLOR_FORMAT_NATIVE_ALPHA;
+    img->header.w = w;
+    img->header.h = h;
+    img->data = data;
+    img->data_size = w * h * PX_SIZE;
+}
+
+void setUp(void)
+{
+    lv_coord_t x, y;
+    for(y = 0; y < SMALL_H; y++) {
+        for(x = 0; x < SMALL_W; x++) {
+            uint8_t * px = &small_data[(y * SMALL_W + x) * PX_SIZE];
+            lv_color_t c = lv_color_make(x * 12, y * 15, 255 - x * y);
+            lv_memcpy(px, &c, sizeof(lv_color_t));
+            px[PX_SIZE - 1] = (x + y) % 3 ? 0xff : 0x80;
+        }
+    }
+
+    for(y = 0; y < BIG_H; y++) {
+        for(x = 0; x < BIG_W; x++) {
+            lv_memcpy(&big_data[(y * BIG_W + x) * PX_SIZE], &small_data[((y / 4) * SMALL_W + x / 4) * PX_SIZE], PX_SIZE);
+        }
+    }
+
+    init_img(&small_img, small_data, SMALL_W, SMALL_H);
+    init_img(&big_img, big_data, BIG_W, BIG_H);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_img_cache_invalidate_src(NULL);
+}
+
+void test_img_mipmap_levels(void)
+{
+    lv_img_decoder_dsc_t dsc;
+    uint32_t mem_size;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, &big_img, lv_color_black(), 0));
+
+    /*No need for a smaller image*/
+    TEST_ASSERT_NULL(_lv_img_mipmap_get(&dsc, LV_ZOOM_NONE, &mem_size));
+    TEST_ASSERT_NULL(_lv_img_mipmap_get(&dsc, 200, &mem_size));
+    TEST_ASSERT_NULL(dsc.mipmap);
+    TEST_ASSERT_EQUAL_UINT32(0, mem_size);
+
+    const lv_img_mipmap_t * mip1 = _lv_img_mipmap_get(&dsc, 128, &mem_size);
+    TEST_ASSERT_NOT_NULL(mip1);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(lv_img_mipmap_t) + BIG_W / 2 * BIG_H / 2 * PX_SIZE, mem_size);
+    TEST_ASSERT_EQUAL(1, mip1->level);
+    TEST_ASSERT_EQUAL(BIG_W / 2, mip1->w);
+    TEST_ASSERT_EQUAL(BIG_H / 2, mip1->h);
+
+    /*The 2nd level is the original small image and the 1st level is reused*/
+    const lv_img_mipmap_t * mip2 = _lv_img_mipmap_get(&dsc, 50, &mem_size);
+    TEST_ASSERT_NOT_NULL(mip2);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(lv_img_mipmap_t) + SMALL_W * SMALL_H * PX_SIZE, mem_size);
+    TEST_ASSERT_EQUAL(2, mip2->level);
+    TEST_ASSERT_EQUAL_PTR(mip1, dsc.mipmap);
+    TEST_ASSERT_EQUAL_PTR(mip2, mip1->next);
+    TEST_ASSERT_EQUAL(SMALL_W, mip2->w);
+    TEST_ASSERT_EQUAL(SMALL_H, mip2->h);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(small_data, mip2->data, sizeof(small_data));
+
+    /*Stop at 1x1 px*/
+    const lv_img_mipmap_t * mip_last = _lv_img_mipmap_get(&dsc, 1, &mem_size);
+    TEST_ASSERT_NOT_NULL(mip_last);
+    TEST_ASSERT_EQUAL(1, mip_last->h);
+
+    lv_img_decoder_close(&dsc);
+    TEST_ASSERT_NULL(dsc.mipmap);
+}
+
+void test_img_mipmap_averages_with_alpha(void)
+{
+    /*2x2 pixels: opaque red and transparent green in the first row, opaque blue and half opaque red in the second*/
+    uint8_t data[4 * PX_SIZE];
+    lv_color_t colors[4] = {lv_color_make(0xff, 0, 0), lv_color_make(0, 0xff, 0), lv_color_make(0, 0, 0xff), lv_color_make(0xff, 0, 0)};
+    lv_opa_t opas[4] = {0xff, 0x00, 0xff, 0x80};
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        lv_memcpy(&data[i * PX_SIZE], &colors[i], sizeof(lv_color_t));
+        data[i * PX_SIZE + PX_SIZE - 1] = opas[i];
+    }
+
+    lv_img_dsc_t img;
+    init_img(&img, data, 2, 2);
+
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, &img, lv_color_black(), 0));
+    uint32_t mem_size;
+    const lv_img_mipmap_t * mip = _lv_img_mipmap_get(&dsc, 128, &mem_size);
+    TEST_ASSERT_NOT_NULL(mip);
+
+    lv_color_t c;
+    lv_memcpy(&c, mip->data, sizeof(lv_color_t));
+    lv_color32_t c32 = lv_color_to32(c);
+    TEST_ASSERT_EQUAL_UINT8((0xff + 0xff + 0x80) / 4, mip->data[PX_SIZE - 1]);
+    /*The transparent green doesn't count*/
+    TEST_ASSERT_UINT8_WITHIN(8, 0, c32.green);
+    TEST_ASSERT_UINT8_WITHIN(8, 0xff * (0xff + 0x80) / (0xff * 2 + 0x80), c32.red);
+    TEST_ASSERT_UINT8_WITHIN(8, 0xff * 0xff / (0xff * 2 + 0x80), c32.blue);
+
+    lv_img_decoder_close(&dsc);
+}
+
+void test_img_mipmap_draw(void)
+{
+    /*Draw the small image as a reference where the zoomed big image should be*/
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_img_set_src(img, &small_img);
+    lv_obj_set_pos(img, 30 + (BIG_W - SMALL_W) / 2, 40 + (BIG_H - SMALL_H) / 2);
+    lv_refr_now(NULL);
+
+    static lv_color_t ref_fb[800 * 480];
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    /*Draw the big image zoomed out 4x around its center. The 2nd level is drawn without zoom*/
+    lv_img_set_src(img, &big_img);
+    lv_img_set_zoom(img, LV_ZOOM_NONE / 4);
+    lv_obj_set_pos(img, 30, 40);
+    lv_refr_now(NULL);
+
+    uint32_t i;
+    for(i = 0; i < 800 * 480; i++) {
+        if(!lv_color_eq(ref_fb[i], test_fb[i])) break;
+    }
+    TEST_ASSERT_EQUAL_UINT32(800 * 480, i);
+
+    /*The mipmap is kept in the image cache*/
+    _lv_img_cache_entry_t * entry = _lv_img_cache_open(&big_img, lv_color_black(), 0);
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_NOT_NULL(entry->dec_dsc.mipmap);
+
+    /*The image is used from the variable, so only the mipmap uses memory in the cache*/
+    lv_img_cache_stats_t stats;
+    lv_img_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2 * sizeof(lv_img_mipmap_t) + (BIG_W / 2 * BIG_H / 2 + SMALL_W * SMALL_H) * PX_SIZE,
+                             stats.mem_size);
+}
+
+void test_img_mipmap_counts_in_the_cache_memory_limit(void)
+{
+    /*Allow only one mipmap level in the cache*/
+    uint32_t mip_size = sizeof(lv_img_mipmap_t) + BIG_W / 2 * BIG_H / 2 * PX_SIZE;
+    lv_img_cache_set_mem_size(mip_size);
+
+    lv_obj_t * img1 = lv_img_create(lv_scr_act());
+    lv_img_set_src(img1, &big_img);
+    lv_img_set_zoom(img1, LV_ZOOM_NONE / 2);
+    lv_refr_now(NULL);
+
+    lv_img_cache_stats_t stats;
+    lv_img_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(mip_size, stats.mem_size);
+    uint32_t evict_cnt = stats.evict_cnt;
+
+    /*The mipmap of an other image doesn't fit next to it, so the first image is closed*/
+    static lv_img_dsc_t big_img2;
+    lv_memcpy(&big_img2, &big_img, sizeof(lv_img_dsc_t));
+    lv_obj_t * img2 = lv_img_create(lv_scr_act());
+    lv_img_set_src(img2, &big_img2);
+    lv_img_set_zoom(img2, LV_ZOOM_NONE / 2);
+    lv_obj_set_pos(img2, 300, 200);
+    lv_refr_now(NULL);
+
+    lv_img_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(mip_size, stats.mem_size);
+    TEST_ASSERT_EQUAL_UINT32(evict_cnt + 1, stats.evict_cnt);
+
+    lv_img_cache_set_mem_size(LV_IMG_CACHE_DEF_MEM_SIZE);
+}
+
+#endif
@@ -0,0 +1,289 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+/*A virtual image which is too large to be decoded at once*/
+#define IMG_W       600
+#define IMG_H       400
+#define IMG_SRC     "V:huge_img"
+
+extern lv_color_t test_fb[];
+
+static lv_color_t img_data[IMG_W * IMG_H];
+static lv_img_dsc_t img_dsc;
+static lv_color_t ref_fb[800 * 480];
+static lv_img_decoder_t * decoder;
+static uint32_t read_cnt;
+static lv_coord_t fail_tile_x = -1;   /*Fail to read the tile starting at this x coordinate once*/
+
+static lv_color_t get_px(lv_coord_t x, lv_coord_t y)
+{
+    return lv_color_make(x, y, (x ^ y) & 0xff);
+}
+
+static lv_res_t decoder_info(lv_img_decoder_t * dec, const void * src, lv_img_header_t * header)
+{
+    LV_UNUSED(dec);
+    if(lv_img_src_get_type(src) != LV_IMG_SRC_FILE || strcmp(src, IMG_SRC)) return LV_RES_INV;
+
+    header->cf = LV_COLOR_FORMAT_NATIVE;
+    header->w = IMG_W;
+    header->h = IMG_H;
+    return LV_RES_OK;
+}
+
+static lv_res_t decoder_open(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc)
+{
+    return decoder_info(dec, dsc->src, &dsc->header);
+}
+
+static lv_res_t decoder_read_tile(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc, const lv_area_t * area,
+                                  uint8_t * buf)
+{
+    LV_UNUSED(dec);
+    LV_UNUSED(dsc);
+    read_cnt++;
+    if(area->x1 == fail_tile_x && area->y1 == 0) {
+        fail_tile_x = -1;
+        return LV_RES_INV;
+    }
+
+    lv_color_t * px = (lv_color_t *)buf;
+    lv_coord_t x, y;
+    for(y = area->y1; y <= area->y2; y++) {
+        for(x = area->x1; x <= area->x2; x++) {
+            *px = get_px(x, y);
+            px++;
+        }
+    }
+    return LV_RES_OK;
+}
+
+static lv_res_t decoder_read_line(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
+                                  lv_coord_t len, uint8_t * buf)
+{
+    lv_area_t area;
+    lv_area_set(&area, x, y, x + len - 1, y);
+    return decoder_read_tile(dec, dsc, &area, buf);
+}
+
+void setUp(void)
+{
+    lv_coord_t x, y;
+    for(y = 0; y < IMG_H; y++) {
+        for(x = 0; x < IMG_W; x++) {
+            img_data[y * IMG_W + x] = get_px(x, y);
+        }
+    }
+
+    lv_memzero(&img_dsc, sizeof(lv_img_dsc_t));
+    img_dsc.header.cf = LV_COLOR_FORMAT_NATIVE;
+    img_dsc.header.w = IMG_W;
+    img_dsc.header.h = IMG_H;
+    img_dsc.data = (const uint8_t *)img_data;
+    img_dsc.data_size = sizeof(img_data);
+
+    decoder = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(decoder, decoder_info);
+    lv_img_decoder_set_open_cb(decoder, decoder_open);
+    lv_img_decoder_set_read_tile_cb(decoder, decoder_read_tile);
+    read_cnt = 0;
+    fail_tile_x = -1;
+
+    lv_img_tile_cache_set_mem_size(4 * 1024 * 1024);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_img_cache_invalidate_src(NULL);
+    lv_img_decoder_delete(decoder);
+}
+
+static void draw_ref(lv_obj_t * img)
+{
+    lv_img_set_src(img, &img_dsc);
+    lv_refr_now(NULL);
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+}
+
+static void compare_to_ref(void)
+{
+    uint32_t i;
+    for(i = 0; i < 800 * 480; i++) {
+        if(!lv_color_eq(ref_fb[i], test_fb[i])) break;
+    }
+    TEST_ASSERT_EQUAL_UINT32(800 * 480, i);
+}
+
+void test_img_tile_draw_visible_tiles(void)
+{
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_obj_set_pos(img, -100, -50);
+    draw_ref(img);
+
+    lv_img_tile_cache_stats_t stats_ori;
+    lv_img_tile_cache_get_stats(&stats_ori);
+
+    lv_img_set_src(img, IMG_SRC);
+    lv_refr_now(NULL);
+    compare_to_ref();
+
+    /*Only the tiles on the screen are decoded: x = 100..599, y = 50..399*/
+    uint32_t col_cnt = (IMG_W - 1) / LV_IMG_TILE_SIZE - 100 / LV_IMG_TILE_SIZE + 1;
+    uint32_t row_cnt = (IMG_H - 1) / LV_IMG_TILE_SIZE - 50 / LV_IMG_TILE_SIZE + 1;
+    lv_img_tile_cache_stats_t stats;
+    lv_img_tile_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(col_cnt * row_cnt, stats.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(col_cnt * row_cnt, read_cnt);
+    TEST_ASSERT_EQUAL_UINT32(stats_ori.miss_cnt + read_cnt, stats.miss_cnt);
+
+    /*Redrawing uses the cached tiles*/
+    lv_obj_invalidate(img);
+    lv_refr_now(NULL);
+    compare_to_ref();
+    TEST_ASSERT_EQUAL_UINT32(col_cnt * row_cnt, read_cnt);
+
+    /*The tiles are freed with the image*/
+    lv_img_cache_invalidate_src(IMG_SRC);
+    lv_img_tile_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.mem_size);
+}
+
+void test_img_tile_zoom(void)
+{
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_obj_set_pos(img, 50, 40);
+    lv_img_set_zoom(img, 600);
+    lv_img_set_antialias(img, false);
+    draw_ref(img);
+
+    lv_img_set_src(img, IMG_SRC);
+    lv_refr_now(NULL);
+    compare_to_ref();
+
+    /*Only the top left part of the image is visible*/
+    lv_img_tile_cache_stats_t stats;
+    lv_img_tile_cache_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.entry_cnt);
+    uint32_t tile_cnt = ((IMG_W + LV_IMG_TILE_SIZE - 1) / LV_IMG_TILE_SIZE) * ((IMG_H + LV_IMG_TILE_SIZE - 1) /
+                                                                              LV_IMG_TILE_SIZE);
+    TEST_ASSERT_LESS_THAN_UINT32(tile_cnt, stats.entry_cnt);
+}
+
+void test_img_tile_transform_with_antialias(void)
+{
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_obj_set_pos(img, 100, 40);
+    lv_img_set_zoom(img, 300);
+    lv_img_set_angle(img, 250);
+    draw_ref(img);
+
+    /*No seams on the edges of the tiles*/
+    lv_img_set_src(img, IMG_SRC);
+    lv_refr_now(NULL);
+    compare_to_ref();
+}
+
+void test_img_tile_failed_tile_is_drawn_line_by_line(void)
+{
+    lv_img_decoder_set_read_line_cb(decoder, decoder_read_line);
+
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_obj_set_pos(img, 30, 20);
+    draw_ref(img);
+
+    /*The second tile can't be read, but its lines can be read later*/
+    fail_tile_x = LV_IMG_TILE_SIZE;
+    lv_img_set_src(img, IMG_SRC);
+    lv_refr_now(NULL);
+    compare_to_ref();
+}
+
+void test_img_tile_read_line_fallback(void)
+{
+    lv_img_decoder_set_read_tile_cb(decoder, NULL);
+    lv_img_decoder_set_read_line_cb(decoder, decoder_read_line);
+
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_obj_set_pos(img, 30, 20);
+    draw_ref(img);
+
+    lv_img_set_src(img, IMG_SRC);
+    lv_refr_now(NULL);
+    compare_to_ref();
+
+    lv_img_tile_cache_stats_t stats;
+    lv_img_tile_cache_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.entry_cnt);
+}
+
+void test_img_tile_mem_limit(void)
+{
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_obj_set_pos(img, 10, 10);
+    draw_ref(img);
+
+    /*Only 4 tiles fit, so they are evicted while drawing*/
+    uint32_t tile_size = LV_IMG_TILE_SIZE * LV_IMG_TILE_SIZE * sizeof(lv_color_t);
+    lv_img_tile_cache_set_mem_size(4 * tile_size);
+    lv_img_set_src(img, IMG_SRC);
+    lv_refr_now(NULL);
+    compare_to_ref();
+
+    lv_img_tile_cache_stats_t stats;
+    lv_img_tile_cache_get_stats(&stats);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(4 * tile_size, stats.mem_size);
+
+    /*Without cache the image is read in bands of a few lines*/
+    lv_img_tile_cache_set_mem_size(0);
+    lv_img_tile_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.entry_cnt);
+
+    read_cnt = 0;
+    lv_obj_invalidate(img);
+    lv_refr_now(NULL);
+    compare_to_ref();
+    lv_img_tile_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.entry_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, read_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(IMG_H / 2, read_cnt);
+}
+
+void test_img_tile_bin_without_mmap(void)
+{
+    /*Save the image as a "*.bin" file*/
+    lv_img_header_t header;
+    lv_memzero(&header, sizeof(header));
+    header.cf = LV_COLOR_FORMAT_NATIVE;
+    header.w = IMG_W;
+    header.h = IMG_H;
+
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "A:test_img_tile.bin", LV_FS_MODE_WR));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, &header, sizeof(header), NULL));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, img_data, sizeof(img_data), NULL));
+    lv_fs_close(&f);
+
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_obj_set_pos(img, -200, 100);
+    draw_ref(img);
+
+    /*The file can't be mapped so it's read tile by tile*/
+    lv_fs_drv_t * drv = lv_fs_get_drv('A');
+    const void * (*mmap_cb)(lv_fs_drv_t *, void *, uint32_t *) = drv->mmap_cb;
+    drv->mmap_cb = NULL;
+
+    lv_img_set_src(img, "A:test_img_tile.bin");
+    lv_refr_now(NULL);
+    drv->mmap_cb = mmap_cb;
+    compare_to_ref();
+
+    lv_img_tile_cache_stats_t stats;
+    lv_img_tile_cache_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.entry_cnt);
+}
+
+#endif
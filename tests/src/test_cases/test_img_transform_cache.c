@@ -0,0 +1,186 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define IMG_W       40
+#define IMG_H       30
+#define PX_SIZE     LV_COLOR_FORMAT_NATIVE_ALPHA_SIZE
+
+extern lv_color_t test_fb[];
+
+static uint8_t img_data[IMG_W * IMG_H * PX_SIZE];
+static lv_img_dsc_t img_dsc;
+static lv_color_t ref_fb[800 * 480];
+
+void setUp(void)
+{
+    lv_coord_t x, y;
+    for(y = 0; y < IMG_H; y++) {
+        for(x = 0; x < IMG_W; x++) {
+            uint8_t * px = &img_data[(y * IMG_W + x) * PX_SIZE];
+            lv_color_t c = lv_color_make(x * 6, y * 8, 255 - x * y / 5);
+            lv_memcpy(px, &c, sizeof(lv_color_t));
+            px[PX_SIZE - 1] = (x + y) % 4 ? 0xff : 0x60;
+        }
+    }
+
+    lv_memzero(&img_dsc, sizeof(lv_img_dsc_t));
+    img_dsc.header.cf = LV_COLOR_FORMAT_NATIVE_ALPHA;
+    img_dsc.header.w = IMG_W;
+    img_dsc.header.h = IMG_H;
+    img_dsc.data = img_data;
+    img_dsc.data_size = sizeof(img_data);
+
+    lv_img_transform_cache_set_mem_size(LV_IMG_TRANSFORM_CACHE_DEF_MEM_SIZE);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_img_cache_invalidate_src(NULL);
+}
+
+static lv_obj_t * create_img(int16_t angle, uint16_t zoom)
+{
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_img_set_src(img, &img_dsc);
+    lv_img_set_angle(img, angle);
+    lv_img_set_zoom(img, zoom);
+    lv_obj_set_pos(img, 100, 80);
+    return img;
+}
+
+static void refr_and_compare(lv_obj_t * img)
+{
+    lv_obj_invalidate(img);
+    lv_refr_now(NULL);
+
+    uint32_t i;
+    for(i = 0; i < 800 * 480; i++) {
+        if(!lv_color_eq(ref_fb[i], test_fb[i])) break;
+    }
+    TEST_ASSERT_EQUAL_UINT32(800 * 480, i);
+}
+
+void test_img_transform_cache_hit(void)
+{
+    lv_obj_t * img = create_img(300, 384);
+
+    /*Reference without the cache*/
+    lv_img_set_transform_cache(img, false);
+    lv_refr_now(NULL);
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    lv_img_transform_cache_stats_t stats;
+    lv_img_transform_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.entry_cnt);
+
+    lv_img_set_transform_cache(img, true);
+    refr_and_compare(img);
+
+    lv_img_transform_cache_stats_t stats_miss;
+    lv_img_transform_cache_get_stats(&stats_miss);
+    TEST_ASSERT_EQUAL_UINT32(1, stats_miss.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(stats.miss_cnt + 1, stats_miss.miss_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(IMG_W * IMG_H * PX_SIZE, stats_miss.mem_size);
+
+    /*The second draw is only a copy*/
+    refr_and_compare(img);
+
+    lv_img_transform_cache_stats_t stats_hit;
+    lv_img_transform_cache_get_stats(&stats_hit);
+    TEST_ASSERT_EQUAL_UINT32(1, stats_hit.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(stats_miss.miss_cnt, stats_hit.miss_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(stats_miss.hit_cnt, stats_hit.hit_cnt);
+
+    /*A new angle is a new entry*/
+    lv_img_set_angle(img, 450);
+    lv_refr_now(NULL);
+    lv_img_transform_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.entry_cnt);
+}
+
+void test_img_transform_cache_opt_out(void)
+{
+    lv_obj_t * img = create_img(300, LV_ZOOM_NONE);
+    TEST_ASSERT_TRUE(lv_img_get_transform_cache(img));
+
+    lv_img_set_transform_cache(img, false);
+    TEST_ASSERT_FALSE(lv_img_get_transform_cache(img));
+    lv_refr_now(NULL);
+
+    lv_img_transform_cache_stats_t stats;
+    lv_img_transform_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.entry_cnt);
+
+    /*Not transformed images are not cached either*/
+    lv_img_set_transform_cache(img, true);
+    lv_img_set_angle(img, 0);
+    lv_refr_now(NULL);
+    lv_img_transform_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.entry_cnt);
+
+    /*The content of a canvas can change any time*/
+    lv_obj_t * canvas = lv_canvas_create(lv_scr_act());
+    TEST_ASSERT_FALSE(lv_img_get_transform_cache(canvas));
+}
+
+void test_img_transform_cache_mem_limit(void)
+{
+    lv_obj_t * img = create_img(300, LV_ZOOM_NONE);
+    lv_refr_now(NULL);
+
+    lv_img_transform_cache_stats_t stats;
+    lv_img_transform_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entry_cnt);
+    uint32_t entry_size = stats.mem_size;
+
+    /*Only one image fits so the older one is evicted*/
+    lv_img_transform_cache_set_mem_size(entry_size + entry_size / 2);
+    lv_img_set_angle(img, 1200);
+    lv_refr_now(NULL);
+    lv_img_transform_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entry_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(entry_size + entry_size / 2, stats.mem_size);
+
+    /*Too large images are not cached but still drawn correctly*/
+    lv_img_set_transform_cache(img, false);
+    lv_img_set_zoom(img, 512);
+    lv_refr_now(NULL);
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    lv_img_set_transform_cache(img, true);
+    refr_and_compare(img);
+    lv_img_transform_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entry_cnt);
+
+    /*0 disables the cache*/
+    lv_img_transform_cache_set_mem_size(0);
+    lv_img_transform_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.mem_size);
+}
+
+void test_img_transform_cache_invalidate_src(void)
+{
+    create_img(300, LV_ZOOM_NONE);
+    lv_refr_now(NULL);
+
+    lv_img_transform_cache_stats_t stats;
+    lv_img_transform_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entry_cnt);
+
+    /*Another source doesn't affect the entry*/
+    static lv_img_dsc_t other_dsc;
+    lv_img_cache_invalidate_src(&other_dsc);
+    lv_img_transform_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entry_cnt);
+
+    lv_img_cache_invalidate_src(&img_dsc);
+    lv_img_transform_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.mem_size);
+}
+
+#endif
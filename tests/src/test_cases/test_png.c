@@ -0,0 +1,351 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "../src/libs/png/lodepng.h"
+
+#define IMG_W   61
+#define IMG_H   45
+
+static lv_img_dsc_t img_dsc;
+static uint8_t * png_data;
+static uint32_t failing_malloc_size;
+
+static void * malloc_stub(size_t size)
+{
+    if(size == failing_malloc_size) return NULL;
+    return lv_test_malloc_normal(size);
+}
+
+static void palette_color(uint32_t i, uint8_t * px)
+{
+    px[0] = (uint8_t)(i * 16);
+    px[1] = (uint8_t)(255 - i * 16);
+    px[2] = (uint8_t)(i * 5);
+    px[3] = (uint8_t)(i * 16 + 15);
+}
+
+/**
+ * Create a test pattern which can be stored in the given color type without loss
+ */
+static uint8_t * create_pattern(uint32_t w, uint32_t h, LodePNGColorType ct, uint32_t depth)
+{
+    uint8_t * rgba = lv_malloc(w * h * 4);
+    TEST_ASSERT_NOT_NULL(rgba);
+
+    uint32_t levels = 1 << LV_MIN(depth, 8);
+    uint32_t x, y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) {
+            uint8_t * px = &rgba[(y * w + x) * 4];
+            if(ct == LCT_PALETTE) {
+                palette_color((x + y * 3) % LV_MIN(levels, 16), px);
+                continue;
+            }
+
+            px[0] = (uint8_t)(x * 7 + y * 3);
+            px[1] = (uint8_t)(x * y);
+            px[2] = (uint8_t)(255 - x * 5);
+            px[3] = (ct == LCT_RGBA || ct == LCT_GREY_ALPHA) ? (uint8_t)(x + y * 11) : 0xFF;
+            if(ct == LCT_GREY || ct == LCT_GREY_ALPHA) {
+                uint8_t v = (uint8_t)(((x + y) % levels) * (255 / (levels - 1)));
+                px[0] = v;
+                px[1] = v;
+                px[2] = v;
+            }
+        }
+    }
+
+    return rgba;
+}
+
+static void encode(uint32_t w, uint32_t h, LodePNGColorType ct, uint32_t depth, uint32_t btype, bool interlace)
+{
+    uint8_t * rgba = create_pattern(w, h, ct, depth);
+
+    LodePNGState state;
+    lodepng_state_init(&state);
+    state.encoder.auto_convert = 0;
+    state.encoder.zlibsettings.btype = btype;
+    state.info_png.interlace_method = interlace ? 1 : 0;
+    state.info_png.color.colortype = ct;
+    state.info_png.color.bitdepth = depth;
+    if(ct == LCT_PALETTE) {
+        uint32_t i;
+        for(i = 0; i < LV_MIN(1U << depth, 16); i++) {
+            uint8_t px[4];
+            palette_color(i, px);
+            lodepng_palette_add(&state.info_png.color, px[0], px[1], px[2], px[3]);
+        }
+    }
+    else if(ct == LCT_RGB) {
+        /*Make some pixels transparent with a color key*/
+        state.info_png.color.key_defined = 1;
+        state.info_png.color.key_r = rgba[0];
+        state.info_png.color.key_g = rgba[1];
+        state.info_png.color.key_b = rgba[2];
+    }
+
+    size_t size;
+    png_data = NULL;
+    uint32_t error = lodepng_encode(&png_data, &size, rgba, w, h, &state);
+    lodepng_state_cleanup(&state);
+    lv_free(rgba);
+    TEST_ASSERT_EQUAL_UINT32(0, error);
+
+    lv_memzero(&img_dsc, sizeof(img_dsc));
+    img_dsc.data = png_data;
+    img_dsc.data_size = size;
+}
+
+/**
+ * Decode the image with lodepng and convert it to the native format
+ */
+static uint8_t * decode_ref(const uint8_t * data, uint32_t size)
+{
+    uint8_t * ref;
+    unsigned w, h;
+    TEST_ASSERT_EQUAL_UINT32(0, lodepng_decode32(&ref, &w, &h, data, size));
+
+    uint32_t i;
+    for(i = 0; i < w * h; i++) {
+        uint8_t r = ref[i * 4];
+        ref[i * 4] = ref[i * 4 + 2];
+        ref[i * 4 + 2] = r;
+    }
+    return ref;
+}
+
+static void check_decoded(const void * src, uint32_t w, uint32_t h, const uint8_t * data, uint32_t size)
+{
+    uint8_t * ref = decode_ref(data, size);
+
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, src, lv_color_black(), 0));
+    TEST_ASSERT_NOT_NULL(dsc.img_data);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(ref, dsc.img_data, w * h * 4);
+    lv_img_decoder_close(&dsc);
+
+    lv_free(ref);
+}
+
+void setUp(void)
+{
+    png_data = NULL;
+}
+
+void tearDown(void)
+{
+    lv_test_malloc_set_cb(NULL);
+    lv_free(png_data);
+}
+
+void test_png_color_types(void)
+{
+    static const struct {
+        LodePNGColorType ct;
+        uint32_t depth;
+    } formats[] = {
+        {LCT_GREY, 1}, {LCT_GREY, 2}, {LCT_GREY, 4}, {LCT_GREY, 8}, {LCT_GREY, 16},
+        {LCT_RGB, 8}, {LCT_RGB, 16},
+        {LCT_PALETTE, 1}, {LCT_PALETTE, 2}, {LCT_PALETTE, 4}, {LCT_PALETTE, 8},
+        {LCT_GREY_ALPHA, 8}, {LCT_GREY_ALPHA, 16},
+        {LCT_RGBA, 8}, {LCT_RGBA, 16},
+    };
+
+    uint32_t i;
+    for(i = 0; i < sizeof(formats) / sizeof(formats[0]); i++) {
+        encode(IMG_W, IMG_H, formats[i].ct, formats[i].depth, 2, false);
+        check_decoded(&img_dsc, IMG_W, IMG_H, img_dsc.data, img_dsc.data_size);
+        lv_free(png_data);
+        png_data = NULL;
+    }
+}
+
+void test_png_block_types(void)
+{
+    /*Stored, fixed and dynamic Huffman blocks*/
+    uint32_t btype;
+    for(btype = 0; btype < 3; btype++) {
+        encode(IMG_W, IMG_H, LCT_RGBA, 8, btype, false);
+        check_decoded(&img_dsc, IMG_W, IMG_H, img_dsc.data, img_dsc.data_size);
+        lv_free(png_data);
+        png_data = NULL;
+    }
+}
+
+void test_png_interlaced(void)
+{
+    /*Interlaced images can't be decoded row by row, so they are decoded by lodepng*/
+    encode(IMG_W, IMG_H, LCT_RGBA, 8, 2, true);
+    check_decoded(&img_dsc, IMG_W, IMG_H, img_dsc.data, img_dsc.data_size);
+}
+
+void test_png_file(void)
+{
+    const char * fn = "A:ref_imgs/arc_1.png";
+    uint8_t * data;
+    size_t size;
+    TEST_ASSERT_EQUAL_UINT32(0, lodepng_load_file(&data, &size, fn));
+
+    check_decoded(fn, 800, 480, data, size);
+    lv_free(data);
+}
+
+void test_png_read_line_if_out_of_memory(void)
+{
+    uint32_t w = 160;
+    uint32_t h = 120;
+    encode(w, h, LCT_RGBA, 8, 2, false);
+    uint8_t * ref = decode_ref(img_dsc.data, img_dsc.data_size);
+
+    /*Not enough memory for the whole decoded image*/
+    failing_malloc_size = w * h * 4;
+    lv_test_malloc_set_cb(malloc_stub);
+
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, &img_dsc, lv_color_black(), 0));
+    TEST_ASSERT_NULL(dsc.img_data);
+
+    /*Read forward, then backward which restarts the decoding, and a part of a row*/
+    static const int32_t rows[] = {0, 1, 57, 119, 3, 3, 100};
+    uint8_t buf[160 * 4];
+    uint32_t i;
+    for(i = 0; i < sizeof(rows) / sizeof(rows[0]); i++) {
+        int32_t y = rows[i];
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, y, w, buf));
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(&ref[y * w * 4], buf, w * 4);
+    }
+
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 13, 42, 21, buf));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(&ref[(42 * w + 13) * 4], buf, 21 * 4);
+
+    lv_img_decoder_close(&dsc);
+    lv_free(ref);
+}
+
+static uint32_t img_malloc_size;
+static uint32_t img_malloc_cnt;
+
+/*Count the allocations for the decoded image*/
+static void * malloc_count_stub(size_t size)
+{
+    if(size == img_malloc_size) img_malloc_cnt++;
+    return lv_test_malloc_normal(size);
+}
+
+static uint8_t * find_chunk(const char * type)
+{
+    uint8_t * end = png_data + img_dsc.data_size;
+    uint8_t * chunk = lodepng_chunk_find(png_data + 8, end, type);
+    TEST_ASSERT_TRUE(chunk < end);
+    return chunk;
+}
+
+/**
+ * The image should fail without decoding it again with lodepng
+ */
+static void check_fails_once(void)
+{
+    img_malloc_size = IMG_W * IMG_H * 4;
+    img_malloc_cnt = 0;
+    lv_test_malloc_set_cb(malloc_count_stub);
+
+    lv_img_decoder_dsc_t dsc;
+    lv_res_t res = lv_img_decoder_open(&dsc, &img_dsc, lv_color_black(), 0);
+    lv_test_malloc_set_cb(NULL);
+
+    /*Only the built-in decoder might use it as raw data*/
+    if(res == LV_RES_OK) {
+        TEST_ASSERT_EQUAL_PTR(img_dsc.data, dsc.img_data);
+        lv_img_decoder_close(&dsc);
+    }
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(1, img_malloc_cnt);
+}
+
+void test_png_wrong_idat_crc(void)
+{
+    /*Change a pixel in a stored block so only the CRC is wrong*/
+    encode(IMG_W, IMG_H, LCT_RGBA, 8, 0, false);
+    uint8_t * idat = find_chunk("IDAT");
+    lodepng_chunk_data(idat)[lodepng_chunk_length(idat) / 2] ^= 0x01;
+    check_fails_once();
+}
+
+void test_png_wrong_header_crc(void)
+{
+    encode(IMG_W, IMG_H, LCT_RGBA, 8, 2, false);
+    uint8_t * ihdr = find_chunk("IHDR");
+    ihdr[8 + 13] ^= 0x01;
+    check_fails_once();
+}
+
+void test_png_wrong_adler32(void)
+{
+    /*Change a pixel in a stored block so only the Adler-32 checksum is wrong*/
+    encode(IMG_W, IMG_H, LCT_RGBA, 8, 0, false);
+    uint8_t * idat = find_chunk("IDAT");
+    lodepng_chunk_data(idat)[lodepng_chunk_length(idat) / 2] ^= 0x01;
+    lodepng_chunk_generate_crc(idat);
+    check_fails_once();
+
+    /*Change the Adler-32 itself*/
+    lodepng_chunk_data(idat)[lodepng_chunk_length(idat) / 2] ^= 0x01;
+    lodepng_chunk_data(idat)[lodepng_chunk_length(idat) - 1] ^= 0x01;
+    lodepng_chunk_generate_crc(idat);
+    check_fails_once();
+}
+
+void test_png_more_idat_chunks(void)
+{
+    /*Split the image data into chunks of 1, 100, 1, 100, ... bytes*/
+    encode(IMG_W, IMG_H, LCT_RGBA, 8, 2, false);
+    uint8_t * idat = find_chunk("IDAT");
+    const uint8_t * data = lodepng_chunk_data(idat);
+    uint32_t len = lodepng_chunk_length(idat);
+
+    uint8_t * out = NULL;
+    size_t out_size = idat - png_data;
+    out = lv_malloc(out_size);
+    TEST_ASSERT_NOT_NULL(out);
+    lv_memcpy(out, png_data, out_size);
+
+    uint32_t i = 0;
+    uint32_t n = 1;
+    while(i < len) {
+        n = LV_MIN(n == 1 ? 100 : 1, len - i);
+        TEST_ASSERT_EQUAL_UINT32(0, lodepng_chunk_create(&out, &out_size, n, "IDAT", data + i));
+        i += n;
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, lodepng_chunk_append(&out, &out_size, find_chunk("IEND")));
+
+    lv_free(png_data);
+    png_data = out;
+    img_dsc.data = out;
+    img_dsc.data_size = out_size;
+    check_decoded(&img_dsc, IMG_W, IMG_H, img_dsc.data, img_dsc.data_size);
+
+    /*A wrong CRC in a middle chunk is found too*/
+    uint8_t * chunk = lodepng_chunk_next(find_chunk("IDAT"), out + out_size);
+    chunk = lodepng_chunk_next(chunk, out + out_size);
+    lodepng_chunk_data(chunk)[0] ^= 0x01;
+    check_fails_once();
+}
+
+void test_png_corrupted(void)
+{
+    encode(IMG_W, IMG_H, LCT_RGBA, 8, 2, false);
+
+    /*Cut the image data*/
+    img_dsc.data_size /= 2;
+    lv_img_decoder_dsc_t dsc;
+    lv_res_t res = lv_img_decoder_open(&dsc, &img_dsc, lv_color_black(), 0);
+
+    /*The PNG decoder should fail, only the built-in decoder might use it as raw data*/
+    if(res == LV_RES_OK) {
+        TEST_ASSERT_EQUAL_PTR(img_dsc.data, dsc.img_data);
+        lv_img_decoder_close(&dsc);
+    }
+}
+
+#endif
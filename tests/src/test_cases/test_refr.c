@@ -0,0 +1,566 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define HOR_RES 800
+#define VER_RES 480
+
+extern lv_color_t test_fb[];
+
+static lv_color_t ref_fb[HOR_RES * VER_RES];
+static lv_color_t partial_buf[100 * 100];
+
+static lv_color_t ring_bufs[3][100 * 100];
+static void * ring_buf_ptrs[3] = {ring_bufs[0], ring_bufs[1], ring_bufs[2]};
+
+/*Flush requests queued by the "slow" driver*/
+typedef struct {
+    lv_area_t area;
+    lv_color_t * px_map;
+} queued_flush_t;
+
+static queued_flush_t flush_queue[3];
+static uint32_t flush_queue_cnt;
+static uint32_t flush_queue_max;
+static uint32_t ring_buf_used_mask;
+
+static lv_color_t direct_bufs[3][HOR_RES * VER_RES];
+static void * direct_buf_ptrs[3] = {direct_bufs[0], direct_bufs[1], direct_bufs[2]};
+static lv_color_t * direct_queue[3];
+static uint32_t direct_queue_cnt;
+static uint32_t direct_px_cnt;
+
+static void * buf_ori;
+static uint32_t buf_size_ori;
+static lv_disp_flush_cb_t flush_cb_ori;
+
+static uint32_t list_call_cnt;
+static uint32_t list_area_cnt;
+static uint32_t list_last_cnt;
+static uint32_t list_px_sum;
+
+static void flush_list_cb(lv_disp_t * disp, const lv_disp_flush_area_t * areas, uint32_t area_cnt, uint8_t * buf)
+{
+    list_call_cnt++;
+    list_area_cnt += area_cnt;
+    if(lv_disp_flush_is_last(disp)) list_last_cnt++;
+
+    uint32_t i;
+    for(i = 0; i < area_cnt; i++) {
+        const lv_area_t * a = &areas[i].area;
+        lv_color_t * px = (lv_color_t *)(buf + areas[i].buf_ofs);
+        lv_coord_t y;
+        for(y = a->y1; y <= a->y2; y++) {
+            lv_memcpy(&test_fb[y * HOR_RES + a->x1], px, lv_area_get_width(a) * sizeof(lv_color_t));
+            px += areas[i].stride;
+        }
+        list_px_sum += lv_area_get_size(a);
+    }
+
+    lv_disp_flush_ready(disp);
+}
+
+static void ring_flush_cb(lv_disp_t * disp, const lv_area_t * area, lv_color_t * px_map)
+{
+    LV_UNUSED(disp);
+
+    /*Just queue the request and complete it later in `ring_wait_cb`*/
+    TEST_ASSERT_LESS_THAN_UINT32(3, flush_queue_cnt);
+    flush_queue[flush_queue_cnt].area = *area;
+    flush_queue[flush_queue_cnt].px_map = px_map;
+    flush_queue_cnt++;
+    if(flush_queue_cnt > flush_queue_max) flush_queue_max = flush_queue_cnt;
+
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        if(px_map == ring_bufs[i]) ring_buf_used_mask |= 1 << i;
+    }
+}
+
+static void ring_wait_cb(lv_disp_t * disp)
+{
+    if(flush_queue_cnt == 0) return;
+
+    /*Finish the oldest flush*/
+    const lv_area_t * a = &flush_queue[0].area;
+    lv_color_t * px = flush_queue[0].px_map;
+    lv_coord_t y;
+    for(y = a->y1; y <= a->y2; y++) {
+        lv_memcpy(&test_fb[y * HOR_RES + a->x1], px, lv_area_get_width(a) * sizeof(lv_color_t));
+        px += lv_area_get_width(a);
+    }
+
+    uint32_t i;
+    for(i = 1; i < flush_queue_cnt; i++) flush_queue[i - 1] = flush_queue[i];
+    flush_queue_cnt--;
+    lv_disp_flush_ready(disp);
+}
+
+static void direct_flush_cb(lv_disp_t * disp, const lv_area_t * area, lv_color_t * px_map)
+{
+    direct_px_cnt += lv_area_get_size(area);
+
+    /*Only the last area is "page flipped", the others are ready immediately*/
+    if(lv_disp_flush_is_last(disp)) {
+        TEST_ASSERT_LESS_THAN_UINT32(3, direct_queue_cnt);
+        direct_queue[direct_queue_cnt] = px_map;
+        direct_queue_cnt++;
+    }
+    else {
+        lv_disp_flush_ready(disp);
+    }
+}
+
+static void direct_wait_cb(lv_disp_t * disp)
+{
+    if(direct_queue_cnt == 0) return;
+
+    /*Show the oldest buffer*/
+    lv_memcpy(test_fb, direct_queue[0], sizeof(direct_bufs[0]));
+
+    uint32_t i;
+    for(i = 1; i < direct_queue_cnt; i++) direct_queue[i - 1] = direct_queue[i];
+    direct_queue_cnt--;
+    lv_disp_flush_ready(disp);
+}
+
+/*Queue all the flushes of direct mode and process them later in `direct_all_wait_cb`*/
+static lv_area_t direct_all_areas[16];
+static lv_color_t * direct_all_bufs[16];
+static uint32_t direct_all_cnt;
+static uint32_t direct_all_last_cnt;
+
+static void direct_all_flush_cb(lv_disp_t * disp, const lv_area_t * area, lv_color_t * px_map)
+{
+    LV_UNUSED(disp);
+    TEST_ASSERT_LESS_THAN_UINT32(16, direct_all_cnt);
+    direct_all_areas[direct_all_cnt] = *area;
+    direct_all_bufs[direct_all_cnt] = px_map;
+    direct_all_cnt++;
+}
+
+static void direct_all_wait_cb(lv_disp_t * disp)
+{
+    if(direct_all_cnt == 0) return;
+
+    /*Copy the oldest area and flip the buffer on the last area*/
+    const lv_area_t * a = &direct_all_areas[0];
+    lv_color_t * buf = direct_all_bufs[0];
+    lv_coord_t y;
+    for(y = a->y1; y <= a->y2; y++) {
+        lv_memcpy(&test_fb[y * HOR_RES + a->x1], &buf[y * HOR_RES + a->x1], lv_area_get_width(a) * sizeof(lv_color_t));
+    }
+    if(lv_disp_flush_is_last(disp)) direct_all_last_cnt++;
+
+    uint32_t i;
+    for(i = 1; i < direct_all_cnt; i++) {
+        direct_all_areas[i - 1] = direct_all_areas[i];
+        direct_all_bufs[i - 1] = direct_all_bufs[i];
+    }
+    direct_all_cnt--;
+    lv_disp_flush_ready(disp);
+}
+
+/*Save the image in the logical (not rotated) orientation*/
+static void logical_flush_cb(lv_disp_t * disp, const lv_area_t * area, lv_color_t * px_map)
+{
+    lv_coord_t w = lv_disp_get_hor_res(disp);
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(&ref_fb[y * w + area->x1], px_map, lv_area_get_width(area) * sizeof(lv_color_t));
+        px_map += lv_area_get_width(area);
+    }
+
+    lv_disp_flush_ready(disp);
+}
+
+static void test_rotation(lv_disp_rotation_t rotation, lv_obj_t * inv_obj)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    lv_disp_set_draw_buffers(disp, partial_buf, NULL, sizeof(partial_buf), LV_DISP_RENDER_MODE_PARTIAL);
+
+    /*Render the reference without rotation*/
+    lv_disp_set_rotation(disp, rotation, false);
+    lv_disp_set_flush_cb(disp, logical_flush_cb);
+    lv_obj_invalidate(inv_obj);
+    lv_refr_now(disp);
+
+    /*Render with software rotation*/
+    lv_disp_set_rotation(disp, rotation, true);
+    lv_disp_set_flush_cb(disp, flush_cb_ori);
+    lv_obj_invalidate(inv_obj);
+    lv_refr_now(disp);
+
+    /*Rotate the reference in the simplest way and compare*/
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = 0; y < HOR_RES; y++) {
+        for(x = 0; x < VER_RES; x++) {
+            lv_coord_t phy_x = rotation == LV_DISP_ROTATION_90 ? y : HOR_RES - 1 - y;
+            lv_coord_t phy_y = rotation == LV_DISP_ROTATION_90 ? VER_RES - 1 - x : x;
+            if(!lv_color_eq(ref_fb[y * VER_RES + x], test_fb[phy_y * HOR_RES + phy_x])) {
+                TEST_FAIL_MESSAGE("The rotated image is different");
+            }
+        }
+    }
+}
+
+static void create_scene(void)
+{
+    lv_obj_t * btn = lv_btn_create(lv_scr_act());
+    lv_obj_set_pos(btn, 20, 30);
+    lv_obj_t * label = lv_label_create(btn);
+    lv_label_set_text(label, "Button");
+
+    lv_obj_t * slider = lv_slider_create(lv_scr_act());
+    lv_obj_set_pos(slider, 300, 200);
+
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_set_pos(obj, 500, 350);
+    lv_obj_set_style_radius(obj, 20, 0);
+    lv_obj_set_style_opa(obj, LV_OPA_50, 0);
+}
+
+static void render_ref(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+    lv_memzero(test_fb, sizeof(ref_fb));
+}
+
+static void reset_counters(void)
+{
+    list_call_cnt = 0;
+    list_area_cnt = 0;
+    list_last_cnt = 0;
+    list_px_sum = 0;
+}
+
+void setUp(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    buf_ori = disp->draw_buf_1;
+    buf_size_ori = disp->draw_buf_size;
+    flush_cb_ori = disp->flush_cb;
+    reset_counters();
+}
+
+void tearDown(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    disp->wait_cb = NULL;
+    lv_disp_set_rotation(disp, LV_DISP_ROTATION_0, false);
+    lv_disp_set_flush_cb(disp, flush_cb_ori);
+    lv_disp_set_flush_list_cb(disp, NULL);
+    lv_disp_set_draw_buffers(disp, buf_ori, NULL, buf_size_ori, LV_DISP_RENDER_MODE_FULL);
+    lv_obj_clean(lv_scr_act());
+    lv_refr_now(NULL);
+}
+
+void test_flush_list_full_mode_sends_one_area(void)
+{
+    create_scene();
+    render_ref();
+
+    lv_disp_set_flush_list_cb(NULL, flush_list_cb);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL_UINT32(1, list_call_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, list_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, list_last_cnt);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+}
+
+void test_flush_list_partial_mode_renders_the_same(void)
+{
+    create_scene();
+    render_ref();
+
+    lv_disp_set_draw_buffers(NULL, partial_buf, NULL, sizeof(partial_buf), LV_DISP_RENDER_MODE_PARTIAL);
+    lv_disp_set_flush_list_cb(NULL, flush_list_cb);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+
+    /*The whole screen doesn't fit into the buffer, so it should be flushed in bands*/
+    TEST_ASSERT_GREATER_THAN_UINT32(1, list_call_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, list_last_cnt);
+    TEST_ASSERT_EQUAL_UINT32(HOR_RES * VER_RES, list_px_sum);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+}
+
+void test_flush_list_partial_mode_packs_small_areas(void)
+{
+    lv_disp_set_draw_buffers(NULL, partial_buf, NULL, sizeof(partial_buf), LV_DISP_RENDER_MODE_PARTIAL);
+    lv_disp_set_flush_list_cb(NULL, flush_list_cb);
+    lv_refr_now(NULL);
+
+    lv_obj_t * obj1 = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(obj1, 20, 20);
+    lv_obj_set_pos(obj1, 10, 10);
+
+    lv_obj_t * obj2 = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(obj2, 20, 20);
+    lv_obj_set_pos(obj2, 400, 200);
+
+    lv_obj_t * obj3 = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(obj3, 20, 20);
+    lv_obj_set_pos(obj3, 700, 400);
+
+    lv_obj_update_layout(lv_scr_act());
+    reset_counters();
+    lv_refr_now(NULL);
+
+    /*All 3 areas fit into the draw buffer so they should be flushed together*/
+    TEST_ASSERT_EQUAL_UINT32(1, list_call_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, list_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, list_last_cnt);
+}
+
+void test_buffer_ring_pipelines_flushing(void)
+{
+    create_scene();
+    render_ref();
+
+    lv_disp_t * disp = lv_disp_get_default();
+    flush_queue_cnt = 0;
+    flush_queue_max = 0;
+    ring_buf_used_mask = 0;
+    lv_disp_set_draw_buffer_ring(disp, ring_buf_ptrs, 3, sizeof(ring_bufs[0]), LV_DISP_RENDER_MODE_PARTIAL);
+    lv_disp_set_flush_cb(disp, ring_flush_cb);
+    disp->wait_cb = ring_wait_cb;
+
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+
+    /*Complete the remaining flushes*/
+    while(flush_queue_cnt) ring_wait_cb(disp);
+
+    lv_disp_refr_stats_t stats;
+    lv_disp_get_refr_stats(disp, &stats);
+
+    /*Rendering should continue while the previous bands are being flushed*/
+    TEST_ASSERT_EQUAL_UINT32(3, flush_queue_max);
+    TEST_ASSERT_EQUAL_UINT32(0x7, ring_buf_used_mask);
+    TEST_ASSERT_GREATER_THAN_UINT32(3, stats.flush_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.flush_wait_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, disp->flushing);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+}
+
+void test_buffer_ring_direct_mode_redraws_only_the_changes(void)
+{
+    create_scene();
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(obj, 50, 50);
+
+    lv_disp_t * disp = lv_disp_get_default();
+    direct_queue_cnt = 0;
+    lv_disp_set_draw_buffer_ring(disp, direct_buf_ptrs, 3, sizeof(direct_bufs[0]), LV_DISP_RENDER_MODE_DIRECT);
+    lv_disp_set_flush_cb(disp, direct_flush_cb);
+    disp->wait_cb = direct_wait_cb;
+
+    uint32_t i;
+    for(i = 0; i < 8; i++) {
+        lv_obj_set_pos(obj, 100 + i * 30, 100 + i * 10);
+        direct_px_cnt = 0;
+        lv_refr_now(NULL);
+
+        /*The buffers are rendered the first time so they are fully redrawn.
+         *Later only the areas changed in the last 3 frames.*/
+        if(i < 3) TEST_ASSERT_EQUAL_UINT32(HOR_RES * VER_RES, direct_px_cnt);
+        else TEST_ASSERT_LESS_THAN_UINT32(HOR_RES * VER_RES / 10, direct_px_cnt);
+
+        /*There was always a free buffer as the display was flipped once per frame*/
+        lv_disp_refr_stats_t stats;
+        lv_disp_get_refr_stats(disp, &stats);
+        TEST_ASSERT_EQUAL_UINT32(0, stats.flush_wait_cnt);
+
+        /*Simulate the next vsync*/
+        direct_wait_cb(disp);
+    }
+
+    /*Render the same in full mode and compare*/
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+    disp->wait_cb = NULL;
+    lv_disp_set_flush_cb(disp, flush_cb_ori);
+    lv_disp_set_draw_buffers(disp, buf_ori, NULL, buf_size_ori, LV_DISP_RENDER_MODE_FULL);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_MEMORY(test_fb, ref_fb, sizeof(ref_fb));
+}
+
+void test_buffer_ring_direct_mode_counts_buffers_not_areas(void)
+{
+    create_scene();
+    lv_obj_t * obj1 = lv_obj_create(lv_scr_act());
+    lv_obj_t * obj2 = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(obj1, 50, 50);
+    lv_obj_set_size(obj2, 50, 50);
+    lv_obj_set_pos(obj2, 600, 300);
+
+    lv_disp_t * disp = lv_disp_get_default();
+    direct_all_cnt = 0;
+    direct_all_last_cnt = 0;
+    lv_disp_set_draw_buffer_ring(disp, direct_buf_ptrs, 3, sizeof(direct_bufs[0]), LV_DISP_RENDER_MODE_DIRECT);
+    lv_disp_set_flush_cb(disp, direct_all_flush_cb);
+    disp->wait_cb = direct_all_wait_cb;
+
+    /*Fill all the buffers, then redraw only the objects until the full screen areas leave the history*/
+    uint32_t i;
+    for(i = 0; i < 6; i++) {
+        if(i < 3) {
+            lv_obj_invalidate(lv_scr_act());
+        }
+        else {
+            lv_obj_invalidate(obj1);
+            lv_obj_invalidate(obj2);
+        }
+        lv_refr_now(NULL);
+        while(direct_all_cnt) direct_all_wait_cb(disp);
+    }
+    direct_all_last_cnt = 0;
+    lv_disp_refr_stats_t stats;
+    lv_disp_get_refr_stats(disp, &stats);
+    uint32_t wait_cnt_start = stats.flush_wait_cnt;
+
+    /*Two separate areas per frame. The second frame is rendered while all the areas of the first are queued.*/
+    for(i = 0; i < 2; i++) {
+        lv_obj_set_pos(obj1, 100 + i * 30, 100);
+        lv_obj_set_pos(obj2, 600 - i * 30, 300);
+        lv_refr_now(NULL);
+    }
+    TEST_ASSERT_GREATER_THAN_UINT32(2, direct_all_cnt);
+
+    /*A buffer was free for the second frame, so there was no waiting*/
+    lv_disp_get_refr_stats(disp, &stats);
+    TEST_ASSERT_EQUAL_UINT32(wait_cnt_start, stats.flush_wait_cnt);
+
+    /*Only the last area of each frame is reported as last when the queue is processed*/
+    while(direct_all_cnt) direct_all_wait_cb(disp);
+    TEST_ASSERT_EQUAL_UINT32(2, direct_all_last_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, disp->flushing);
+
+    /*Render the same in full mode and compare*/
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+    disp->wait_cb = NULL;
+    lv_disp_set_flush_cb(disp, flush_cb_ori);
+    lv_disp_set_draw_buffers(disp, buf_ori, NULL, buf_size_ori, LV_DISP_RENDER_MODE_FULL);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_MEMORY(test_fb, ref_fb, sizeof(ref_fb));
+}
+
+void test_partial_mode_uses_tiles_if_a_row_does_not_fit(void)
+{
+    create_scene();
+    render_ref();
+
+    /*Less than one row*/
+    lv_disp_set_draw_buffers(NULL, partial_buf, NULL, HOR_RES / 2 * sizeof(lv_color_t), LV_DISP_RENDER_MODE_PARTIAL);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+
+    lv_disp_refr_stats_t stats;
+    lv_disp_get_refr_stats(NULL, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.band_cnt);
+    TEST_ASSERT_EQUAL_UINT32(VER_RES * 2, stats.tile_cnt);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+}
+
+void test_partial_mode_uses_bands_if_tiles_are_not_better(void)
+{
+    lv_disp_set_draw_buffers(NULL, partial_buf, NULL, sizeof(partial_buf), LV_DISP_RENDER_MODE_PARTIAL);
+    lv_refr_now(NULL);
+
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(obj, 300, 40);
+    lv_obj_update_layout(obj);
+    lv_refr_now(NULL);
+
+    /*With the shadow it's ~305 x 45 px which fits into 2 bands*/
+    lv_disp_refr_stats_t stats;
+    lv_disp_get_refr_stats(NULL, &stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.band_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.tile_cnt);
+}
+
+void test_partial_mode_uses_tiles_if_less_parts_are_needed(void)
+{
+    create_scene();
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(obj, 300, 60);
+    render_ref();
+
+    lv_disp_set_draw_buffers(NULL, partial_buf, NULL, sizeof(partial_buf), LV_DISP_RENDER_MODE_PARTIAL);
+    lv_memcpy(test_fb, ref_fb, sizeof(ref_fb));
+    lv_obj_invalidate(obj);
+    lv_refr_now(NULL);
+
+    /*~305 x 65 px would need 3 bands of 32 rows, but 2 tiles with 153 px width are enough*/
+    lv_disp_refr_stats_t stats;
+    lv_disp_get_refr_stats(NULL, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.band_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.tile_cnt);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+}
+
+static uint32_t rounder_call_cnt;
+
+static void even_rows_rounder_cb(lv_event_t * e)
+{
+    lv_area_t * area = lv_event_get_param(e);
+    area->y1 = area->y1 & ~1;
+    area->y2 = area->y2 | 1;
+    rounder_call_cnt++;
+}
+
+void test_partial_mode_rounds_a_row_count_once_per_refresh(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    lv_disp_set_draw_buffers(disp, partial_buf, NULL, sizeof(partial_buf), LV_DISP_RENDER_MODE_PARTIAL);
+    lv_disp_add_event(disp, even_rows_rounder_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+
+    /*Far enough from each other to be separate areas*/
+    uint32_t i;
+    for(i = 0; i < 6; i++) {
+        lv_obj_t * obj = lv_obj_create(lv_scr_act());
+        lv_obj_set_size(obj, 300, 60);
+        lv_obj_set_pos(obj, (i % 2) * 450, (i / 2) * 150);
+    }
+    lv_refr_now(NULL);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+
+    /*The areas are invalidated and rounded before the refresh, so count only the refresh*/
+    uint32_t child_cnt = lv_obj_get_child_cnt(lv_scr_act());
+    for(i = 0; i < child_cnt; i++) lv_obj_invalidate(lv_obj_get_child(lv_scr_act(), i));
+    rounder_call_cnt = 0;
+    lv_refr_now(NULL);
+
+    /*One check of the X coordinates per area. The row counts are rounded only for the first area
+     *as the others have the same size.*/
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(6 + 3, rounder_call_cnt);
+
+    lv_disp_remove_event(disp, lv_disp_get_event_count(disp) - 1);
+}
+
+void test_sw_rotation(void)
+{
+    create_scene();
+
+    /*The whole screen is rotated in bands or tiles via a temporary buffer.
+     *Tall areas are rotated in place as a square first.*/
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(obj, 30, 150);
+    lv_obj_set_pos(obj, 10, 500);
+
+    test_rotation(LV_DISP_ROTATION_90, lv_scr_act());
+    test_rotation(LV_DISP_ROTATION_90, obj);
+    test_rotation(LV_DISP_ROTATION_270, lv_scr_act());
+    test_rotation(LV_DISP_ROTATION_270, obj);
+}
+
+#endif
@@ -0,0 +1,282 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include <unistd.h>
+#include <pthread.h>
+
+/*64x100 image with 16 px high fragments*/
+#define IMG_SRC     "A:src/test_files/gradient.sjpg"
+#define IMG_W       64
+#define IMG_H       100
+#define FRAG_H      16
+#define ROW_SIZE    (IMG_W * sizeof(lv_color_t))
+
+static uint8_t ref[IMG_H][ROW_SIZE];
+
+/*A driver reading the files of 'A'. The reads of the other threads wait until the gate is opened.*/
+static pthread_t lvgl_thread;
+static pthread_mutex_t gate_mutex = PTHREAD_MUTEX_INITIALIZER;
+static bool gate_open;
+static uint32_t bg_read_cnt;
+static uint32_t bg_waiting_cnt;
+
+static void * gated_open_cb(lv_fs_drv_t * drv, const char * path, lv_fs_mode_t mode)
+{
+    LV_UNUSED(drv);
+    char path_a[256];
+    lv_snprintf(path_a, sizeof(path_a), "A:%s", path);
+
+    lv_fs_file_t * f = lv_malloc(sizeof(lv_fs_file_t));
+    if(lv_fs_open(f, path_a, mode) != LV_FS_RES_OK) {
+        lv_free(f);
+        return NULL;
+    }
+    return f;
+}
+
+static lv_fs_res_t gated_close_cb(lv_fs_drv_t * drv, void * file_p)
+{
+    LV_UNUSED(drv);
+    lv_fs_res_t res = lv_fs_close(file_p);
+    lv_free(file_p);
+    return res;
+}
+
+static lv_fs_res_t gated_read_cb(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_t btr, uint32_t * br)
+{
+    LV_UNUSED(drv);
+    if(!pthread_equal(pthread_self(), lvgl_thread)) {
+        pthread_mutex_lock(&gate_mutex);
+        bg_read_cnt++;
+        bg_waiting_cnt++;
+        while(!gate_open) {
+            pthread_mutex_unlock(&gate_mutex);
+            usleep(1000);
+            pthread_mutex_lock(&gate_mutex);
+        }
+        bg_waiting_cnt--;
+        pthread_mutex_unlock(&gate_mutex);
+    }
+
+    return lv_fs_read(file_p, buf, btr, br);
+}
+
+static lv_fs_res_t gated_seek_cb(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence)
+{
+    LV_UNUSED(drv);
+    return lv_fs_seek(file_p, pos, whence);
+}
+
+static lv_fs_res_t gated_tell_cb(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p)
+{
+    LV_UNUSED(drv);
+    return lv_fs_tell(file_p, pos_p);
+}
+
+static void gated_drv_register(void)
+{
+    static lv_fs_drv_t drv;
+    if(drv.letter) return;
+
+    lv_fs_drv_init(&drv);
+    drv.letter = 'G';
+    drv.open_cb = gated_open_cb;
+    drv.close_cb = gated_close_cb;
+    drv.read_cb = gated_read_cb;
+    drv.seek_cb = gated_seek_cb;
+    drv.tell_cb = gated_tell_cb;
+    lv_fs_drv_register(&drv);
+}
+
+static uint32_t gated_get(uint32_t * cnt)
+{
+    pthread_mutex_lock(&gate_mutex);
+    uint32_t v = *cnt;
+    pthread_mutex_unlock(&gate_mutex);
+    return v;
+}
+
+static void wait_for_workers(void)
+{
+    uint32_t i;
+    for(i = 0; i < 5000 && lv_worker_get_pending_cnt(); i++) {
+        usleep(1000);
+        lv_tick_inc(1);
+        lv_timer_handler();
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, lv_worker_get_pending_cnt());
+}
+
+static void check_row(lv_img_decoder_dsc_t * dsc, int32_t y)
+{
+    uint8_t buf[ROW_SIZE];
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(dsc, 0, y, IMG_W, buf));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(ref[y], buf, ROW_SIZE);
+}
+
+/**
+ * Decode each fragment as the first one of a newly opened image,
+ * so they are decoded in the LVGL thread without prefetching.
+ */
+static void decode_ref(void)
+{
+    int32_t frag_y;
+    for(frag_y = 0; frag_y < IMG_H; frag_y += FRAG_H) {
+        lv_img_decoder_dsc_t dsc;
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, IMG_SRC, lv_color_black(), 0));
+        TEST_ASSERT_EQUAL(IMG_W, dsc.header.w);
+        TEST_ASSERT_EQUAL(IMG_H, dsc.header.h);
+
+        int32_t y;
+        for(y = frag_y; y < LV_MIN(frag_y + FRAG_H, IMG_H); y++) {
+            TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, y, IMG_W, ref[y]));
+        }
+
+        /*Close it while the prefetch jobs are still pending*/
+        lv_img_decoder_close(&dsc);
+    }
+
+    wait_for_workers();
+    lv_split_jpeg_reset_stats();
+}
+
+void setUp(void)
+{
+    decode_ref();
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+void test_sjpg_fragments_are_cached(void)
+{
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, IMG_SRC, lv_color_black(), 0));
+
+    /*Read the first two fragments*/
+    check_row(&dsc, 0);
+    check_row(&dsc, FRAG_H - 1);
+    check_row(&dsc, FRAG_H);
+    wait_for_workers();
+
+    /*Scroll back and forth between them*/
+    check_row(&dsc, 3);
+    check_row(&dsc, FRAG_H + 3);
+    check_row(&dsc, 5);
+
+    lv_split_jpeg_stats_t stats;
+    lv_split_jpeg_get_stats(&stats);
+    /*The second fragment was prefetched too*/
+    TEST_ASSERT_EQUAL_UINT32(4, stats.frag_hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.frag_miss_cnt);
+
+    lv_img_decoder_close(&dsc);
+    wait_for_workers();
+}
+
+void test_sjpg_next_fragments_are_prefetched(void)
+{
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, IMG_SRC, lv_color_black(), 0));
+
+    check_row(&dsc, 0);
+    wait_for_workers();
+
+    /*The next 2 fragments were decoded in the background*/
+    check_row(&dsc, FRAG_H);
+    check_row(&dsc, 2 * FRAG_H + 7);
+
+    lv_split_jpeg_stats_t stats;
+    lv_split_jpeg_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.frag_miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.frag_hit_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(2, stats.prefetch_cnt);
+
+    /*Scroll up from the bottom*/
+    int32_t y;
+    for(y = IMG_H - 1; y >= 0; y--) {
+        check_row(&dsc, y);
+        if(y % FRAG_H == 0) wait_for_workers();
+    }
+
+    lv_img_decoder_close(&dsc);
+    wait_for_workers();
+}
+
+void test_sjpg_prefetch_reads_the_file_in_the_background(void)
+{
+    gated_drv_register();
+    lvgl_thread = pthread_self();
+    gate_open = false;
+    bg_read_cnt = 0;
+
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, "G:src/test_files/gradient.sjpg", lv_color_black(), 0));
+
+    /*The first fragment is read in the LVGL thread, the next ones by the workers which are stuck in the driver*/
+    check_row(&dsc, 0);
+    uint32_t i;
+    for(i = 0; i < 5000 && gated_get(&bg_waiting_cnt) == 0; i++) usleep(1000);
+    TEST_ASSERT_EQUAL_UINT32(1, gated_get(&bg_waiting_cnt));
+
+    /*The LVGL thread is not blocked meanwhile*/
+    check_row(&dsc, 5);
+    lv_timer_handler();
+    TEST_ASSERT_GREATER_THAN_UINT32(0, lv_worker_get_pending_cnt());
+
+    pthread_mutex_lock(&gate_mutex);
+    gate_open = true;
+    pthread_mutex_unlock(&gate_mutex);
+    wait_for_workers();
+
+    /*Each prefetched fragment was read with a single read*/
+    TEST_ASSERT_EQUAL_UINT32(2, gated_get(&bg_read_cnt));
+    check_row(&dsc, FRAG_H);
+    check_row(&dsc, 2 * FRAG_H + 7);
+
+    lv_split_jpeg_stats_t stats;
+    lv_split_jpeg_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.frag_miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.prefetch_cnt);
+
+    lv_img_decoder_close(&dsc);
+    wait_for_workers();
+}
+
+void test_sjpg_variable(void)
+{
+    /*Load the file to a C array*/
+    static uint8_t data[8 * 1024];
+    lv_fs_file_t f;
+    uint32_t size;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, IMG_SRC, LV_FS_MODE_RD));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, data, sizeof(data), &size));
+    lv_fs_close(&f);
+    TEST_ASSERT_LESS_THAN_UINT32(sizeof(data), size);
+
+    lv_img_dsc_t img_dsc;
+    lv_memzero(&img_dsc, sizeof(img_dsc));
+    img_dsc.data = data;
+    img_dsc.data_size = size;
+
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, &img_dsc, lv_color_black(), 0));
+
+    int32_t y;
+    for(y = 0; y < IMG_H; y++) {
+        check_row(&dsc, y);
+        if(y % FRAG_H == 0) wait_for_workers();
+    }
+
+    lv_split_jpeg_stats_t stats;
+    lv_split_jpeg_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.frag_miss_cnt);
+
+    lv_img_decoder_close(&dsc);
+    wait_for_workers();
+}
+
+#endif
@@ -2,6 +2,7 @@
 #include "../lvgl.h"
 
 #include "unity/unity.h"
+#include "lv_test_helpers.h"
 
 void setUp(void)
 {
@@ -44,4 +45,94 @@ void test_tiny_ttf_rendering_test(void)
 #endif
 }
 
+#if LV_USE_TINY_TTF
+static void compare_glyphs(lv_font_t * f1, lv_font_t * f2, uint32_t first, uint32_t last)
+{
+    static uint8_t bmp1[64 * 64];
+    int32_t step = first <= last ? 1 : -1;
+    uint32_t letter;
+    for(letter = first; letter != last + step; letter += step) {
+        lv_font_glyph_dsc_t g1;
+        lv_font_glyph_dsc_t g2;
+        TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(f1, &g1, letter, 0));
+        TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(f2, &g2, letter, 0));
+        TEST_ASSERT_EQUAL(g1.box_w, g2.box_w);
+        TEST_ASSERT_EQUAL(g1.box_h, g2.box_h);
+
+        uint32_t size = g1.box_w * g1.box_h;
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(sizeof(bmp1), size);
+        const uint8_t * b1 = lv_font_get_glyph_bitmap(f1, letter);
+        TEST_ASSERT_NOT_NULL(b1);
+        lv_memcpy(bmp1, b1, size);
+
+        const uint8_t * b2 = lv_font_get_glyph_bitmap(f2, letter);
+        TEST_ASSERT_NOT_NULL(b2);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(bmp1, b2, size);
+    }
+}
+#endif
+
+void test_tiny_ttf_cache(void)
+{
+#if LV_USE_TINY_TTF
+    extern const uint8_t ubuntu_font[];
+    extern size_t ubuntu_font_size;
+
+    /*Everything fits to the first font, the pages of the second are cleared many times*/
+    lv_font_t * font_large = lv_tiny_ttf_create_data_ex(ubuntu_font, ubuntu_font_size, 30, 1024 * 1024);
+    lv_font_t * font_small = lv_tiny_ttf_create_data_ex(ubuntu_font, ubuntu_font_size, 30, 1024);
+
+    compare_glyphs(font_large, font_small, 0x21, 0x17F);
+    compare_glyphs(font_large, font_small, 0x17F, 0x21);
+    /*Cached and re-rendered glyphs mixed*/
+    compare_glyphs(font_large, font_small, 'a', 'f');
+    compare_glyphs(font_large, font_small, 'a', 'z');
+
+    /*The cached glyphs are dropped on resize*/
+    lv_tiny_ttf_set_size(font_small, 20);
+    lv_font_t * font_20 = lv_tiny_ttf_create_data(ubuntu_font, ubuntu_font_size, 20);
+    compare_glyphs(font_20, font_small, 0x21, 0x17F);
+
+    lv_tiny_ttf_destroy(font_large);
+    lv_tiny_ttf_destroy(font_small);
+    lv_tiny_ttf_destroy(font_20);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_tiny_ttf_cache_oversized_glyphs(void)
+{
+#if LV_USE_TINY_TTF
+    extern const uint8_t ubuntu_font[];
+    extern size_t ubuntu_font_size;
+
+    /*Most glyphs are larger than the 256 bytes pages of a 1 kB cache*/
+    lv_font_t * font_large = lv_tiny_ttf_create_data_ex(ubuntu_font, ubuntu_font_size, 50, 1024 * 1024);
+    compare_glyphs(font_large, font_large, 0x21, 0x7E);
+    lv_font_t * font_small = lv_tiny_ttf_create_data_ex(ubuntu_font, ubuntu_font_size, 50, 1024);
+    uint32_t mem_before = lv_test_get_free_mem();
+
+    compare_glyphs(font_large, font_small, 0x21, 0x7E);
+    compare_glyphs(font_large, font_small, 0x7E, 0x21);
+
+    uint32_t glyph_size_max = 0;
+    uint32_t letter;
+    for(letter = 0x21; letter <= 0x7E; letter++) {
+        lv_font_glyph_dsc_t g;
+        lv_font_get_glyph_dsc(font_small, &g, letter, 0);
+        glyph_size_max = LV_MAX(glyph_size_max, (uint32_t)g.box_w * g.box_h);
+    }
+
+    /*The pages don't grow, only the largest glyph is stored besides them and the hash table*/
+    uint32_t mem_used = mem_before - lv_test_get_free_mem();
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(1024 + glyph_size_max + 64 * 16 + 128, mem_used);
+
+    lv_tiny_ttf_destroy(font_large);
+    lv_tiny_ttf_destroy(font_small);
+#else
+    TEST_PASS();
+#endif
+}
+
 #endif